@@ -178,7 +178,7 @@ bool fullSamples = false;
 // The following type holds metrics for all the clients.  Each inner vector
 // corresponds to one metric and contains a value from each client, indexed
 // by clientIndex.
-typedef std::vector<std::vector<double>> ClientMetrics;
+typedef std::vector<std::vector<double>> ClientPerfMetrics;
 
 // Used to return results about the distribution of times for a
 // particular operation.
@@ -2334,7 +2334,7 @@ sendMetrics(double m0, double m1 = 0.0, double m2 = 0.0, double m3 = 0.0,
  *      Metrics will be read from this many clients, starting at 0.
  */
 void
-getMetrics(ClientMetrics& metrics, int clientCount)
+getMetrics(ClientPerfMetrics& metrics, int clientCount)
 {
     // First, reset the result.
     metrics.clear();
@@ -4676,7 +4676,7 @@ indexScalability()
         indexScalabilityCommonLookup(numIndexlets,
                 numObjectsPerIndexlet, range, concurrent, doc);
         sendCommand(NULL, "idle", 1, numActive-1);
-        ClientMetrics metrics;
+        ClientPerfMetrics metrics;
         getMetrics(metrics, numActive);
         double hashThroughput = sum(metrics[0])/1e03;
         double readThroughput = sum(metrics[1])/1e03;
@@ -5770,7 +5770,7 @@ transactionThroughput()
             sendCommand("output", "done", 1, numSlaves);
 
             sendMetrics(0.0);
-            ClientMetrics metrics;
+            ClientPerfMetrics metrics;
             getMetrics(metrics, numSlaves+1);
             printf("%5d         %8.3f\n", numSlaves, sum(metrics[0])/1e3);
         }
@@ -5919,7 +5919,7 @@ transactionContention()
             sendCommand("output", "done", 1, numSlaves);
 
             sendMetrics(0.0, 0.0);
-            ClientMetrics metrics;
+            ClientPerfMetrics metrics;
             getMetrics(metrics, numSlaves+1);
             printf("%5d         %8.3f        %8.3f\n",
                     numSlaves, sum(metrics[0])/1e3, sum(metrics[1])/1e3);
@@ -6078,7 +6078,7 @@ netBandwidth()
     sendMetrics(bandwidth);
 
     // Collect statistics.
-    ClientMetrics metrics;
+    ClientPerfMetrics metrics;
     getMetrics(metrics, numClients);
     RAMCLOUD_LOG(DEBUG,
             "Bandwidth (%u-byte object with %u-byte key): %.1f MB/sec",
@@ -6721,7 +6721,7 @@ readRandom()
         sendCommand("run", "running", 1, numActive-1);
         readRandomCommon(tableIds, doc);
         sendCommand(NULL, "idle", 1, numActive-1);
-        ClientMetrics metrics;
+        ClientPerfMetrics metrics;
         getMetrics(metrics, numActive);
         printf("%3d               %6.0f                    %6.2f"
                 "          %.1f%%\n",
@@ -6798,6 +6798,72 @@ readThroughputMaster(int numObjects, int size, uint16_t keyLength)
 #endif
 }
 
+/**
+ * This method implements the slave functionality for readThroughput and
+ * readThroughputZipf: it issues individual reads until told to stop.
+ * \param numObjects
+ *      Number of objects in the table.
+ * \param keyLength
+ *      Size of keys, in bytes.
+ * \param generator
+ *      If non-NULL, keys are chosen with this generator; otherwise they
+ *      are chosen uniformly at random.
+ * \param name
+ *      Name of the benchmark, used in log messages.
+ */
+void
+readThroughputSlave(int numObjects, uint16_t keyLength,
+        ZipfianGenerator* generator, const char* name)
+{
+    bool running = false;
+
+    uint64_t startTime;
+    int objectsRead;
+
+    while (true) {
+        char command[20];
+        if (running) {
+            // Write out some statistics for debugging.
+            double totalTime = Cycles::toSeconds(Cycles::rdtsc()
+                    - startTime);
+            double rate = objectsRead/totalTime;
+            RAMCLOUD_LOG(NOTICE, "Read rate: %.1f kobjects/sec",
+                    rate/1e03);
+        }
+        getCommand(command, sizeof(command), false);
+        if (strcmp(command, "run") == 0) {
+            if (!running) {
+                setSlaveState("running");
+                running = true;
+                RAMCLOUD_LOG(NOTICE, "Starting %s benchmark", name);
+            }
+
+            // Perform reads for a second (then check to see
+            // if the experiment is over).
+            startTime = Cycles::rdtsc();
+            objectsRead = 0;
+            uint64_t checkTime = startTime + Cycles::fromSeconds(1.0);
+            do {
+                char key[keyLength];
+                Buffer value;
+                uint64_t index = (generator != NULL)
+                        ? generator->nextNumber()
+                        : generateRandom() % numObjects;
+                makeKey(downCast<int>(index), keyLength, key);
+                cluster->read(dataTable, key, keyLength, &value);
+                ++objectsRead;
+            } while (Cycles::rdtsc() < checkTime);
+        } else if (strcmp(command, "done") == 0) {
+            setSlaveState("done");
+            RAMCLOUD_LOG(NOTICE, "Ending %s benchmark", name);
+            return;
+        } else {
+            RAMCLOUD_LOG(ERROR, "unknown command %s", command);
+            return;
+        }
+    }
+}
+
 // This benchmark measures total throughput of a single server (in objects
 // read per second) under a workload consisting of individual random object
 // reads.
@@ -6820,52 +6886,35 @@ readThroughput()
     } else {
         // Slaves execute the following code, which creates load by
         // issuing individual reads.
-        bool running = false;
-
-        uint64_t startTime;
-        int objectsRead;
-
-        while (true) {
-            char command[20];
-            if (running) {
-                // Write out some statistics for debugging.
-                double totalTime = Cycles::toSeconds(Cycles::rdtsc()
-                        - startTime);
-                double rate = objectsRead/totalTime;
-                RAMCLOUD_LOG(NOTICE, "Read rate: %.1f kobjects/sec",
-                        rate/1e03);
-            }
-            getCommand(command, sizeof(command), false);
-            if (strcmp(command, "run") == 0) {
-                if (!running) {
-                    setSlaveState("running");
-                    running = true;
-                    RAMCLOUD_LOG(NOTICE,
-                            "Starting readThroughput benchmark");
-                }
+        readThroughputSlave(numObjects, keyLength, NULL, "readThroughput");
+    }
+}
 
-                // Perform reads for a second (then check to see
-                // if the experiment is over).
-                startTime = Cycles::rdtsc();
-                objectsRead = 0;
-                uint64_t checkTime = startTime + Cycles::fromSeconds(1.0);
-                do {
-                    char key[keyLength];
-                    Buffer value;
-                    makeKey(downCast<int>(generateRandom() % numObjects),
-                            keyLength, key);
-                    cluster->read(dataTable, key, keyLength, &value);
-                    ++objectsRead;
-                } while (Cycles::rdtsc() < checkTime);
-            } else if (strcmp(command, "done") == 0) {
-                setSlaveState("done");
-                RAMCLOUD_LOG(NOTICE, "Ending readThroughput benchmark");
-                return;
-            } else {
-                RAMCLOUD_LOG(ERROR, "unknown command %s", command);
-                return;
-            }
-        }
+// This benchmark is a variant of readThroughput in which the objects read
+// are chosen with a Zipfian distribution (theta 0.99, as in YCSB), so a few
+// hot keys receive most of the reads. It shows how well the server copes
+// with many workers reading the same small set of objects at once.
+void
+readThroughputZipf()
+{
+    const uint16_t keyLength = 30;
+    int size = objectSize;
+    if (size < 0)
+        size = 100;
+    const int numObjects = 40000000/size;
+    if (clientIndex == 0) {
+        // This is the master client.
+        printf("# RAMCloud read throughput of a single server with a varying\n"
+                "# number of clients issuing individual reads on %d-byte\n"
+                "# objects with %d-byte keys, chosen with a Zipfian\n"
+                "# distribution (theta 0.99)\n",
+                size, keyLength);
+        printf("# Generated by 'clusterperf.py readThroughputZipf'\n");
+        readThroughputMaster(numObjects, size, keyLength);
+    } else {
+        ZipfianGenerator generator(numObjects);
+        readThroughputSlave(numObjects, keyLength, &generator,
+                "readThroughputZipf");
     }
 }
 
@@ -7202,6 +7251,72 @@ writeThroughputMaster(int numObjects, int size, uint16_t keyLength)
 #endif
 }
 
+/**
+ * This method implements the slave-client functionality for writeThroughput
+ * and writeThroughputScaling: it creates load by issuing individual writes
+ * of randomly chosen objects until the master client says it is done.
+ * \param numObjects
+ *      Number of objects in the table.
+ * \param size
+ *      Size of each object, in bytes.
+ * \param keyLength
+ *      Size of keys, in bytes.
+ * \param name
+ *      Name of the benchmark, for log messages.
+ */
+void
+writeThroughputSlave(int numObjects, int size, uint16_t keyLength,
+        const char* name)
+{
+    bool running = false;
+
+    uint64_t startTime;
+    int objectsWritten;
+
+    while (true) {
+        char command[20];
+        if (running) {
+            // Write out some statistics for debugging.
+            double totalTime = Cycles::toSeconds(Cycles::rdtsc()
+                    - startTime);
+            double rate = objectsWritten/totalTime;
+            RAMCLOUD_LOG(NOTICE, "Write rate: %.1f kobjects/sec",
+                    rate/1e03);
+        }
+        getCommand(command, sizeof(command), false);
+        if (strcmp(command, "run") == 0) {
+            if (!running) {
+                setSlaveState("running");
+                running = true;
+                RAMCLOUD_LOG(NOTICE, "Starting %s benchmark", name);
+            }
+
+            // Perform writes for a second (then check to see
+            // if the experiment is over).
+            startTime = Cycles::rdtsc();
+            objectsWritten = 0;
+            uint64_t checkTime = startTime + Cycles::fromSeconds(1.0);
+            do {
+                char key[keyLength];
+                char value[size];
+                makeKey(downCast<int>(generateRandom() % numObjects),
+                        keyLength, key);
+                Util::genRandomString(value, size);
+                cluster->write(dataTable, key, keyLength, value, size,
+                        NULL, NULL, asyncReplication);
+                ++objectsWritten;
+            } while (Cycles::rdtsc() < checkTime);
+        } else if (strcmp(command, "done") == 0) {
+            setSlaveState("done");
+            RAMCLOUD_LOG(NOTICE, "Ending %s benchmark", name);
+            return;
+        } else {
+            RAMCLOUD_LOG(ERROR, "unknown command %s", command);
+            return;
+        }
+    }
+}
+
 // This benchmark measures total throughput of a single server (in objects
 // writes per second) under a workload consisting of individual random object
 // write.
@@ -7212,7 +7327,7 @@ writeThroughput()
     int size = objectSize;
     if (size < 0)
         size = 100;
-    const int numObjects = 400000000/objectSize;
+    const int numObjects = 400000000/size;
     if (clientIndex == 0) {
         // This is the master client.
         printf("# RAMCloud write throughput of a single server with a varying\n"
@@ -7222,58 +7337,73 @@ writeThroughput()
         printf("# Generated by 'clusterperf.py writeThroughput'\n");
         writeThroughputMaster(numObjects, size, keyLength);
     } else {
-        // Slaves execute the following code, which creates load by
-        // issuing individual reads.
-        bool running = false;
-
-        uint64_t startTime;
-        int objectsWritten;
+        writeThroughputSlave(numObjects, size, keyLength, "writeThroughput");
+    }
+}
 
-        while (true) {
-            char command[20];
-            if (running) {
-                // Write out some statistics for debugging.
-                double totalTime = Cycles::toSeconds(Cycles::rdtsc()
-                        - startTime);
-                double rate = objectsWritten/totalTime;
-                RAMCLOUD_LOG(NOTICE, "Write rate: %.1f kobjects/sec",
-                        rate/1e03);
-            }
-            getCommand(command, sizeof(command), false);
-            if (strcmp(command, "run") == 0) {
-                if (!running) {
-                    setSlaveState("running");
-                    running = true;
-                    RAMCLOUD_LOG(NOTICE,
-                            "Starting writeThroughput benchmark");
-                }
+// This benchmark is a variant of writeThroughput that focuses on how write
+// throughput scales with the number of worker cores the server keeps busy.
+// It uses larger objects by default, so that copying data into the log head
+// is a significant part of each write, and reports throughput per worker
+// core along with the rate at which the log grows. Run it with different
+// --maxCores values for the server to see how far appends scale.
+void
+writeThroughputScaling()
+{
+    const uint16_t keyLength = 30;
+    int size = objectSize;
+    if (size < 0)
+        size = 2000;
+    const int numObjects = 400000000/size;
+    if (clientIndex != 0) {
+        writeThroughputSlave(numObjects, size, keyLength,
+                "writeThroughputScaling");
+        return;
+    }
 
-                // Perform writes for a second (then check to see
-                // if the experiment is over).
-                startTime = Cycles::rdtsc();
-                objectsWritten = 0;
-                uint64_t checkTime = startTime + Cycles::fromSeconds(1.0);
-                do {
-                    char key[keyLength];
-                    char value[objectSize];
-                    makeKey(downCast<int>(generateRandom() % numObjects),
-                            keyLength, key);
-                    Util::genRandomString(value, objectSize);
-                    cluster->write(dataTable, key, keyLength, value, objectSize,
-                            NULL, NULL, asyncReplication);
-                    ++objectsWritten;
-                } while (Cycles::rdtsc() < checkTime);
-            } else if (strcmp(command, "done") == 0) {
-                setSlaveState("done");
-                RAMCLOUD_LOG(NOTICE,
-                             "Ending writeThroughput benchmark");
-                return;
-            } else {
-                RAMCLOUD_LOG(ERROR, "unknown command %s", command);
-                return;
-            }
-        }
+    // This is the master client. Fill in the table, then measure
+    // throughput while gradually increasing the number of workers.
+    printf("# RAMCloud write throughput of a single server as a function of\n"
+            "# the worker cores it uses, with a varying number of clients\n"
+            "# issuing individual writes on randomly chosen %d-byte objects\n"
+            "# with %d-byte keys\n", size, keyLength);
+    printf("# Generated by 'clusterperf.py writeThroughputScaling'\n");
+    printf("#\n");
+    printf("# clients   throughput   worker    kops/sec     log\n");
+    printf("#           (kops/sec)   cores     per core    (MB/s)\n");
+    printf("#--------------------------------------------------------\n");
+    fillTable(dataTable, numObjects, keyLength, size);
+    Cycles::sleep(2000000);
+    for (int numSlaves = 1; numSlaves < numClients; numSlaves++) {
+        sendCommand("run", "running", numSlaves, 1);
+        Buffer statsBuffer;
+        cluster->objectServerControl(dataTable, "abc", 3,
+                WireFormat::ControlOp::GET_PERF_STATS, NULL, 0,
+                &statsBuffer);
+        PerfStats startStats = *statsBuffer.getStart<PerfStats>();
+        Cycles::sleep(1000000);
+        cluster->objectServerControl(dataTable, "abc", 3,
+                WireFormat::ControlOp::GET_PERF_STATS, NULL, 0,
+                &statsBuffer);
+        PerfStats finishStats = *statsBuffer.getStart<PerfStats>();
+        double elapsedCycles = static_cast<double>(
+                finishStats.collectionTime - startStats.collectionTime);
+        double elapsedTime = elapsedCycles/ finishStats.cyclesPerSecond;
+        double rate = static_cast<double>(finishStats.writeCount -
+                startStats.writeCount) / elapsedTime;
+        double workerCores = static_cast<double>(
+                finishStats.workerActiveCycles -
+                startStats.workerActiveCycles) / elapsedCycles;
+        double perCore = 0;
+        if (workerCores > 0)
+            perCore = rate / workerCores;
+        double logRate = static_cast<double>(finishStats.logBytesAppended -
+                startStats.logBytesAppended) / elapsedTime;
+        printf("%5d       %8.2f   %8.3f   %8.2f   %8.2f\n",
+                numSlaves, rate/1e03, workerCores, perCore/1e03,
+                logRate/1e06);
     }
+    sendCommand("done", "done", 1, numClients-1);
 }
 
 // This benchmark measures total throughput of a single server (in operations
@@ -7406,6 +7536,7 @@ TestInfo tests[] = {
     {"readNotFound", readNotFound},
     {"readRandom", readRandom},
     {"readThroughput", readThroughput},
+    {"readThroughputZipf", readThroughputZipf},
     {"readVaryingKeyLength", readVaryingKeyLength},
     {"writeVaryingKeyLength", writeVaryingKeyLength},
     {"writeAsyncSync", writeAsyncSync},
@@ -7413,6 +7544,7 @@ TestInfo tests[] = {
     {"writeDistWorkload", writeDistWorkload},
     {"writeInterference", writeInterference},
     {"writeThroughput", writeThroughput},
+    {"writeThroughputScaling", writeThroughputScaling},
     {"workloadThroughput", workloadThroughput},
 };
 
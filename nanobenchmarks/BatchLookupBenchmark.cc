@@ -0,0 +1,177 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/**
+ * \file
+ * A performance benchmark comparing batches of HashTable lookups resolved
+ * one at a time against the same batches warmed with
+ * HashTable::prefetchBatch() first, as MasterService::multiRead does. The
+ * table and its objects are made much larger than the processor's caches
+ * so that every lookup misses.
+ */
+
+#include "Common.h"
+#include "Context.h"
+#include "Cycles.h"
+#include "HashTable.h"
+#include "LargeBlockOfMemory.h"
+#include "OptionParser.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+namespace {
+
+class TestObject {
+  public:
+    // We don't care about tables or string keys, so we'll assume table 0
+    // and let our keys be 64-bit integers.
+    explicit TestObject(uint64_t key)
+        : key(key)
+    {
+    }
+
+    uint64_t key;
+} __attribute__((aligned(64)));
+
+/**
+ * Look up a key in the table and return its object, or NULL.
+ */
+TestObject*
+lookup(HashTable& ht, uint64_t k, KeyHash keyHash)
+{
+    HashTable::Candidates c;
+    ht.lookup(keyHash, c);
+    while (!c.isDone()) {
+        TestObject* candidate = reinterpret_cast<TestObject*>(
+                c.getReference());
+        if (candidate->key == k)
+            return candidate;
+        c.next();
+    }
+    return NULL;
+}
+
+/**
+ * Time numBatches batches of batchSize random lookups and return the
+ * average number of cycles per key.
+ */
+uint64_t
+runBatches(HashTable& ht, uint64_t nkeys, uint32_t batchSize,
+           uint32_t numBatches, bool prefetch)
+{
+    uint64_t keys[batchSize];
+    KeyHash keyHashes[batchSize];
+    uint64_t total = 0;
+    uint64_t found = 0;
+    for (uint32_t b = 0; b < numBatches; b++) {
+        // Keys and hashes are computed outside the timed region, just as
+        // multiRead parses its request before looking anything up.
+        for (uint32_t i = 0; i < batchSize; i++) {
+            keys[i] = generateRandom() % nkeys;
+            keyHashes[i] = Key::getHash(0, &keys[i], sizeof(keys[i]));
+        }
+        uint64_t start = Cycles::rdtsc();
+        if (prefetch)
+            ht.prefetchBatch(keyHashes, batchSize, sizeof(TestObject));
+        for (uint32_t i = 0; i < batchSize; i++) {
+            if (lookup(ht, keys[i], keyHashes[i]) != NULL)
+                found++;
+        }
+        total += Cycles::rdtsc() - start;
+    }
+    if (found != uint64_t(batchSize) * numBatches)
+        DIE("lookups failed: found %lu of %lu keys", found,
+            uint64_t(batchSize) * numBatches);
+    return total / (uint64_t(batchSize) * numBatches);
+}
+
+} // anonymous namespace
+
+void
+batchLookupBenchmark(uint64_t nkeys, uint64_t nlines, uint32_t batchSize,
+                     uint32_t numBatches)
+{
+    HashTable ht(nlines);
+    LargeBlockOfMemory<TestObject> block(nkeys * sizeof(TestObject));
+    TestObject* values = block.get();
+
+    printf("hash table keys: %lu\n", nkeys);
+    printf("hash table lines: %lu\n", nlines);
+    printf("batch size: %u\n", batchSize);
+
+    printf("populating table...");
+    fflush(stdout);
+    for (uint64_t i = 0; i < nkeys; i++) {
+        values[i] = TestObject(i);
+        ht.insert(Key::getHash(0, &i, sizeof(i)),
+                  reinterpret_cast<uint64_t>(&values[i]));
+    }
+    printf("done!\n");
+
+    uint64_t serial = runBatches(ht, nkeys, batchSize, numBatches, false);
+    uint64_t batched = runBatches(ht, nkeys, batchSize, numBatches, true);
+    printf("== one at a time: %lu ticks, %lu nsec per key ==\n",
+           serial, Cycles::toNanoseconds(serial));
+    printf("== prefetchBatch: %lu ticks, %lu nsec per key ==\n",
+           batched, Cycles::toNanoseconds(batched));
+    printf("    speedup: %.2fx\n", static_cast<double>(serial) /
+           static_cast<double>(batched));
+}
+
+} // namespace RAMCloud
+
+int
+main(int argc, char **argv)
+{
+    using namespace RAMCloud;
+
+    Context context(true);
+
+    uint64_t hashTableMegs, numberOfKeys;
+    uint32_t batchSize, numberOfBatches;
+
+    OptionsDescription benchmarkOptions("BatchLookupBenchmark");
+    benchmarkOptions.add_options()
+        ("BatchSize,b",
+         ProgramOptions::value<uint32_t>(&batchSize)->
+            default_value(100),
+         "Number of keys looked up together (e.g. in one multiRead)")
+        ("HashTableMegs,h",
+         ProgramOptions::value<uint64_t>(&hashTableMegs)->
+            default_value(256),
+         "Megabytes of memory allocated to the HashTable")
+        ("NumberOfBatches,i",
+         ProgramOptions::value<uint32_t>(&numberOfBatches)->
+            default_value(100000),
+         "Number of batches to time")
+        ("NumberOfKeys,n",
+         ProgramOptions::value<uint64_t>(&numberOfKeys)->
+            default_value(0),
+         "Number of keys to insert into the HashTable (default: two per "
+         "cache line)");
+
+    OptionParser optionParser(benchmarkOptions, argc, argv);
+
+    uint64_t numberOfCachelines = (hashTableMegs * 1024 * 1024) /
+        HashTable::bytesPerCacheLine();
+    // HashTable will round to a power of two to avoid divides.
+    numberOfCachelines = BitOps::powerOfTwoLessOrEqual(numberOfCachelines);
+    if (numberOfKeys == 0)
+        numberOfKeys = 2 * numberOfCachelines;
+
+    batchLookupBenchmark(numberOfKeys, numberOfCachelines, batchSize,
+                         numberOfBatches);
+    return 0;
+}
@@ -117,7 +117,7 @@ class MigrateTabletBenchmark {
         metrics->temp.count8 =
         metrics->temp.count9 = 0;
 
-        Tub<Segment> transferSeg{};
+        MasterService::MigrationStream stream;
 
         uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
         uint64_t totalBytes = 0;
@@ -129,7 +129,7 @@ class MigrateTabletBenchmark {
             SegmentIterator it{*s};
             while (!it.isDone()) {
                 Status r = service->migrateSingleLogEntry(
-                                it, transferSeg, entryTotals, totalBytes,
+                                it, &stream, 1, entryTotals, totalBytes,
                                 0, 0lu, ~0lu,
                                 ServerId{});
                 if (r != STATUS_OK) {
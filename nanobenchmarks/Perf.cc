@@ -70,6 +70,7 @@
 #include "Memory.h"
 #include "MurmurHash3.h"
 #include "Object.h"
+#include "ObjectFinder.h"
 #include "ObjectPool.h"
 #include "QueueEstimator.h"
 #include "Segment.h"
@@ -1593,6 +1594,47 @@ double murmur3()
     return Cycles::toSeconds(stop - start)/count;
 }
 
+// Measure the cost of ObjectFinder::lookupTablet (which every object RPC
+// uses to find its master) for a table with numTablets tablets, each
+// covering an equal share of the key hash space.
+template <int numTablets>
+double objectFinderLookup()
+{
+    struct Fetcher : public ObjectFinder::TableConfigFetcher {
+        bool tryGetTableConfig(uint64_t tableId,
+                std::map<TabletKey, TabletWithLocator>* tableMap,
+                std::multimap<std::pair<uint64_t, uint8_t>,
+                        IndexletWithLocator>* tableIndexMap)
+        {
+            uint64_t tabletSize = ~0lu / numTablets;
+            for (uint64_t i = 0; i < numTablets; i++) {
+                uint64_t last = (i == numTablets - 1) ? ~0lu :
+                        (i + 1) * tabletSize - 1;
+                Tablet tablet(tableId, i * tabletSize, last, ServerId(),
+                        Tablet::NORMAL, LogPosition());
+                tableMap->emplace(TabletKey{tableId, i * tabletSize},
+                        TabletWithLocator(tablet, "mock:"));
+            }
+            return true;
+        }
+    };
+    Context context;
+    ObjectFinder objectFinder(&context, new Fetcher);
+    objectFinder.lookupTablet(1, 0);
+
+    int count = 1000000;
+    uint64_t hashes[1024];
+    for (int i = 0; i < 1024; i++) {
+        hashes[i] = generateRandom();
+    }
+    uint64_t start = Cycles::rdtscp();
+    for (int i = 0; i < count; i++) {
+        objectFinder.lookupTablet(1, hashes[i & 1023]);
+    }
+    uint64_t stop = Cycles::rdtscp();
+    return Cycles::toSeconds(stop - start)/count;
+}
+
 // Starting with a new ObjectPool, measure the cost of Object
 // allocations. The pool may optionally be primed first to
 // measure the best-case performance.
@@ -2504,6 +2546,10 @@ TestInfo tests[] = {
      "128-bit MurmurHash3 (64-bit optimised) on 1 byte of data"},
     {"murmur3", murmur3<256>,
      "128-bit MurmurHash3 hash (64-bit optimised) on 256 bytes of data"},
+    {"objectFinderLookup", objectFinderLookup<1>,
+     "ObjectFinder::lookupTablet in a table with 1 tablet"},
+    {"objectFinderLookup", objectFinderLookup<4096>,
+     "ObjectFinder::lookupTablet in a table with 4096 tablets"},
     {"objectPoolAlloc", objectPoolAlloc<int, false>,
      "Cost of new allocations from an ObjectPool (no destroys)"},
     {"objectPoolRealloc", objectPoolAlloc<int, true>,
@@ -0,0 +1,674 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: EnumerationIterator.proto
+
+#include "EnumerationIterator.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR EnumerationIterator_Frame::EnumerationIterator_Frame(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.tablet_start_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.tablet_end_hash_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_buckets_)*/uint64_t{0u}
+  , /*decltype(_impl_.bucket_index_)*/uint64_t{0u}
+  , /*decltype(_impl_.bucket_next_hash_)*/uint64_t{0u}} {}
+struct EnumerationIterator_FrameDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EnumerationIterator_FrameDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EnumerationIterator_FrameDefaultTypeInternal() {}
+  union {
+    EnumerationIterator_Frame _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnumerationIterator_FrameDefaultTypeInternal _EnumerationIterator_Frame_default_instance_;
+PROTOBUF_CONSTEXPR EnumerationIterator::EnumerationIterator(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.frames_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EnumerationIteratorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EnumerationIteratorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EnumerationIteratorDefaultTypeInternal() {}
+  union {
+    EnumerationIterator _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EnumerationIteratorDefaultTypeInternal _EnumerationIterator_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_EnumerationIterator_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_EnumerationIterator_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_EnumerationIterator_2eproto = nullptr;
+
+const uint32_t TableStruct_EnumerationIterator_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_.tablet_start_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_.tablet_end_hash_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_.num_buckets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_.bucket_index_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator_Frame, _impl_.bucket_next_hash_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::EnumerationIterator, _impl_.frames_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 11, -1, sizeof(::RAMCloud::ProtoBuf::EnumerationIterator_Frame)},
+  { 16, -1, -1, sizeof(::RAMCloud::ProtoBuf::EnumerationIterator)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_EnumerationIterator_Frame_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_EnumerationIterator_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_EnumerationIterator_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031EnumerationIterator.proto\022\021RAMCloud.Pr"
+  "otoBuf\"\326\001\n\023EnumerationIterator\022<\n\006frames"
+  "\030\001 \003(\0132,.RAMCloud.ProtoBuf.EnumerationIt"
+  "erator.Frame\032\200\001\n\005Frame\022\031\n\021tablet_start_h"
+  "ash\030\001 \002(\004\022\027\n\017tablet_end_hash\030\002 \002(\004\022\023\n\013nu"
+  "m_buckets\030\003 \002(\004\022\024\n\014bucket_index\030\004 \002(\004\022\030\n"
+  "\020bucket_next_hash\030\005 \002(\004"
+  ;
+static ::_pbi::once_flag descriptor_table_EnumerationIterator_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_EnumerationIterator_2eproto = {
+    false, false, 263, descriptor_table_protodef_EnumerationIterator_2eproto,
+    "EnumerationIterator.proto",
+    &descriptor_table_EnumerationIterator_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_EnumerationIterator_2eproto::offsets,
+    file_level_metadata_EnumerationIterator_2eproto, file_level_enum_descriptors_EnumerationIterator_2eproto,
+    file_level_service_descriptors_EnumerationIterator_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_EnumerationIterator_2eproto_getter() {
+  return &descriptor_table_EnumerationIterator_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_EnumerationIterator_2eproto(&descriptor_table_EnumerationIterator_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class EnumerationIterator_Frame::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EnumerationIterator_Frame>()._impl_._has_bits_);
+  static void set_has_tablet_start_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_tablet_end_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_num_buckets(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bucket_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bucket_next_hash(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+EnumerationIterator_Frame::EnumerationIterator_Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+}
+EnumerationIterator_Frame::EnumerationIterator_Frame(const EnumerationIterator_Frame& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EnumerationIterator_Frame* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_start_hash_){}
+    , decltype(_impl_.tablet_end_hash_){}
+    , decltype(_impl_.num_buckets_){}
+    , decltype(_impl_.bucket_index_){}
+    , decltype(_impl_.bucket_next_hash_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.tablet_start_hash_, &from._impl_.tablet_start_hash_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bucket_next_hash_) -
+    reinterpret_cast<char*>(&_impl_.tablet_start_hash_)) + sizeof(_impl_.bucket_next_hash_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+}
+
+inline void EnumerationIterator_Frame::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.tablet_start_hash_){uint64_t{0u}}
+    , decltype(_impl_.tablet_end_hash_){uint64_t{0u}}
+    , decltype(_impl_.num_buckets_){uint64_t{0u}}
+    , decltype(_impl_.bucket_index_){uint64_t{0u}}
+    , decltype(_impl_.bucket_next_hash_){uint64_t{0u}}
+  };
+}
+
+EnumerationIterator_Frame::~EnumerationIterator_Frame() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EnumerationIterator_Frame::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EnumerationIterator_Frame::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EnumerationIterator_Frame::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.tablet_start_hash_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bucket_next_hash_) -
+        reinterpret_cast<char*>(&_impl_.tablet_start_hash_)) + sizeof(_impl_.bucket_next_hash_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EnumerationIterator_Frame::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 tablet_start_hash = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_tablet_start_hash(&has_bits);
+          _impl_.tablet_start_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 tablet_end_hash = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_tablet_end_hash(&has_bits);
+          _impl_.tablet_end_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 num_buckets = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_num_buckets(&has_bits);
+          _impl_.num_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 bucket_index = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_bucket_index(&has_bits);
+          _impl_.bucket_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 bucket_next_hash = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_bucket_next_hash(&has_bits);
+          _impl_.bucket_next_hash_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EnumerationIterator_Frame::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 tablet_start_hash = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_tablet_start_hash(), target);
+  }
+
+  // required uint64 tablet_end_hash = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_tablet_end_hash(), target);
+  }
+
+  // required uint64 num_buckets = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_num_buckets(), target);
+  }
+
+  // required uint64 bucket_index = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bucket_index(), target);
+  }
+
+  // required uint64 bucket_next_hash = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_bucket_next_hash(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  return target;
+}
+
+size_t EnumerationIterator_Frame::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  size_t total_size = 0;
+
+  if (_internal_has_tablet_start_hash()) {
+    // required uint64 tablet_start_hash = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tablet_start_hash());
+  }
+
+  if (_internal_has_tablet_end_hash()) {
+    // required uint64 tablet_end_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tablet_end_hash());
+  }
+
+  if (_internal_has_num_buckets()) {
+    // required uint64 num_buckets = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_buckets());
+  }
+
+  if (_internal_has_bucket_index()) {
+    // required uint64 bucket_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bucket_index());
+  }
+
+  if (_internal_has_bucket_next_hash()) {
+    // required uint64 bucket_next_hash = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bucket_next_hash());
+  }
+
+  return total_size;
+}
+size_t EnumerationIterator_Frame::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required uint64 tablet_start_hash = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tablet_start_hash());
+
+    // required uint64 tablet_end_hash = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_tablet_end_hash());
+
+    // required uint64 num_buckets = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_buckets());
+
+    // required uint64 bucket_index = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bucket_index());
+
+    // required uint64 bucket_next_hash = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bucket_next_hash());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EnumerationIterator_Frame::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EnumerationIterator_Frame::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EnumerationIterator_Frame::GetClassData() const { return &_class_data_; }
+
+
+void EnumerationIterator_Frame::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EnumerationIterator_Frame*>(&to_msg);
+  auto& from = static_cast<const EnumerationIterator_Frame&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.tablet_start_hash_ = from._impl_.tablet_start_hash_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.tablet_end_hash_ = from._impl_.tablet_end_hash_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.num_buckets_ = from._impl_.num_buckets_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.bucket_index_ = from._impl_.bucket_index_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.bucket_next_hash_ = from._impl_.bucket_next_hash_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EnumerationIterator_Frame::CopyFrom(const EnumerationIterator_Frame& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EnumerationIterator_Frame::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EnumerationIterator_Frame::InternalSwap(EnumerationIterator_Frame* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EnumerationIterator_Frame, _impl_.bucket_next_hash_)
+      + sizeof(EnumerationIterator_Frame::_impl_.bucket_next_hash_)
+      - PROTOBUF_FIELD_OFFSET(EnumerationIterator_Frame, _impl_.tablet_start_hash_)>(
+          reinterpret_cast<char*>(&_impl_.tablet_start_hash_),
+          reinterpret_cast<char*>(&other->_impl_.tablet_start_hash_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EnumerationIterator_Frame::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_EnumerationIterator_2eproto_getter, &descriptor_table_EnumerationIterator_2eproto_once,
+      file_level_metadata_EnumerationIterator_2eproto[0]);
+}
+
+// ===================================================================
+
+class EnumerationIterator::_Internal {
+ public:
+};
+
+EnumerationIterator::EnumerationIterator(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.EnumerationIterator)
+}
+EnumerationIterator::EnumerationIterator(const EnumerationIterator& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EnumerationIterator* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){from._impl_.frames_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.EnumerationIterator)
+}
+
+inline void EnumerationIterator::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.frames_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EnumerationIterator::~EnumerationIterator() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.EnumerationIterator)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EnumerationIterator::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.frames_.~RepeatedPtrField();
+}
+
+void EnumerationIterator::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EnumerationIterator::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.EnumerationIterator)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.frames_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EnumerationIterator::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.EnumerationIterator.Frame frames = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_frames(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EnumerationIterator::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.EnumerationIterator)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.EnumerationIterator.Frame frames = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_frames_size()); i < n; i++) {
+    const auto& repfield = this->_internal_frames(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.EnumerationIterator)
+  return target;
+}
+
+size_t EnumerationIterator::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.EnumerationIterator)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.EnumerationIterator.Frame frames = 1;
+  total_size += 1UL * this->_internal_frames_size();
+  for (const auto& msg : this->_impl_.frames_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EnumerationIterator::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EnumerationIterator::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EnumerationIterator::GetClassData() const { return &_class_data_; }
+
+
+void EnumerationIterator::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EnumerationIterator*>(&to_msg);
+  auto& from = static_cast<const EnumerationIterator&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.EnumerationIterator)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.frames_.MergeFrom(from._impl_.frames_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EnumerationIterator::CopyFrom(const EnumerationIterator& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.EnumerationIterator)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EnumerationIterator::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.frames_))
+    return false;
+  return true;
+}
+
+void EnumerationIterator::InternalSwap(EnumerationIterator* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.frames_.InternalSwap(&other->_impl_.frames_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EnumerationIterator::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_EnumerationIterator_2eproto_getter, &descriptor_table_EnumerationIterator_2eproto_once,
+      file_level_metadata_EnumerationIterator_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::EnumerationIterator_Frame*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::EnumerationIterator*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::EnumerationIterator >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::EnumerationIterator >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
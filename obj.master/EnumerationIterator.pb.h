@@ -0,0 +1,663 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: EnumerationIterator.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_EnumerationIterator_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_EnumerationIterator_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_EnumerationIterator_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_EnumerationIterator_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_EnumerationIterator_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class EnumerationIterator;
+struct EnumerationIteratorDefaultTypeInternal;
+extern EnumerationIteratorDefaultTypeInternal _EnumerationIterator_default_instance_;
+class EnumerationIterator_Frame;
+struct EnumerationIterator_FrameDefaultTypeInternal;
+extern EnumerationIterator_FrameDefaultTypeInternal _EnumerationIterator_Frame_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::EnumerationIterator* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::EnumerationIterator>(Arena*);
+template<> ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::EnumerationIterator_Frame>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class EnumerationIterator_Frame final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.EnumerationIterator.Frame) */ {
+ public:
+  inline EnumerationIterator_Frame() : EnumerationIterator_Frame(nullptr) {}
+  ~EnumerationIterator_Frame() override;
+  explicit PROTOBUF_CONSTEXPR EnumerationIterator_Frame(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EnumerationIterator_Frame(const EnumerationIterator_Frame& from);
+  EnumerationIterator_Frame(EnumerationIterator_Frame&& from) noexcept
+    : EnumerationIterator_Frame() {
+    *this = ::std::move(from);
+  }
+
+  inline EnumerationIterator_Frame& operator=(const EnumerationIterator_Frame& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EnumerationIterator_Frame& operator=(EnumerationIterator_Frame&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EnumerationIterator_Frame& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EnumerationIterator_Frame* internal_default_instance() {
+    return reinterpret_cast<const EnumerationIterator_Frame*>(
+               &_EnumerationIterator_Frame_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(EnumerationIterator_Frame& a, EnumerationIterator_Frame& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EnumerationIterator_Frame* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EnumerationIterator_Frame* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EnumerationIterator_Frame* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EnumerationIterator_Frame>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EnumerationIterator_Frame& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EnumerationIterator_Frame& from) {
+    EnumerationIterator_Frame::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EnumerationIterator_Frame* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.EnumerationIterator.Frame";
+  }
+  protected:
+  explicit EnumerationIterator_Frame(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletStartHashFieldNumber = 1,
+    kTabletEndHashFieldNumber = 2,
+    kNumBucketsFieldNumber = 3,
+    kBucketIndexFieldNumber = 4,
+    kBucketNextHashFieldNumber = 5,
+  };
+  // required uint64 tablet_start_hash = 1;
+  bool has_tablet_start_hash() const;
+  private:
+  bool _internal_has_tablet_start_hash() const;
+  public:
+  void clear_tablet_start_hash();
+  uint64_t tablet_start_hash() const;
+  void set_tablet_start_hash(uint64_t value);
+  private:
+  uint64_t _internal_tablet_start_hash() const;
+  void _internal_set_tablet_start_hash(uint64_t value);
+  public:
+
+  // required uint64 tablet_end_hash = 2;
+  bool has_tablet_end_hash() const;
+  private:
+  bool _internal_has_tablet_end_hash() const;
+  public:
+  void clear_tablet_end_hash();
+  uint64_t tablet_end_hash() const;
+  void set_tablet_end_hash(uint64_t value);
+  private:
+  uint64_t _internal_tablet_end_hash() const;
+  void _internal_set_tablet_end_hash(uint64_t value);
+  public:
+
+  // required uint64 num_buckets = 3;
+  bool has_num_buckets() const;
+  private:
+  bool _internal_has_num_buckets() const;
+  public:
+  void clear_num_buckets();
+  uint64_t num_buckets() const;
+  void set_num_buckets(uint64_t value);
+  private:
+  uint64_t _internal_num_buckets() const;
+  void _internal_set_num_buckets(uint64_t value);
+  public:
+
+  // required uint64 bucket_index = 4;
+  bool has_bucket_index() const;
+  private:
+  bool _internal_has_bucket_index() const;
+  public:
+  void clear_bucket_index();
+  uint64_t bucket_index() const;
+  void set_bucket_index(uint64_t value);
+  private:
+  uint64_t _internal_bucket_index() const;
+  void _internal_set_bucket_index(uint64_t value);
+  public:
+
+  // required uint64 bucket_next_hash = 5;
+  bool has_bucket_next_hash() const;
+  private:
+  bool _internal_has_bucket_next_hash() const;
+  public:
+  void clear_bucket_next_hash();
+  uint64_t bucket_next_hash() const;
+  void set_bucket_next_hash(uint64_t value);
+  private:
+  uint64_t _internal_bucket_next_hash() const;
+  void _internal_set_bucket_next_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.EnumerationIterator.Frame)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t tablet_start_hash_;
+    uint64_t tablet_end_hash_;
+    uint64_t num_buckets_;
+    uint64_t bucket_index_;
+    uint64_t bucket_next_hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_EnumerationIterator_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EnumerationIterator final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.EnumerationIterator) */ {
+ public:
+  inline EnumerationIterator() : EnumerationIterator(nullptr) {}
+  ~EnumerationIterator() override;
+  explicit PROTOBUF_CONSTEXPR EnumerationIterator(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EnumerationIterator(const EnumerationIterator& from);
+  EnumerationIterator(EnumerationIterator&& from) noexcept
+    : EnumerationIterator() {
+    *this = ::std::move(from);
+  }
+
+  inline EnumerationIterator& operator=(const EnumerationIterator& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EnumerationIterator& operator=(EnumerationIterator&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EnumerationIterator& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EnumerationIterator* internal_default_instance() {
+    return reinterpret_cast<const EnumerationIterator*>(
+               &_EnumerationIterator_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(EnumerationIterator& a, EnumerationIterator& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EnumerationIterator* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EnumerationIterator* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EnumerationIterator* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EnumerationIterator>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EnumerationIterator& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EnumerationIterator& from) {
+    EnumerationIterator::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EnumerationIterator* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.EnumerationIterator";
+  }
+  protected:
+  explicit EnumerationIterator(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef EnumerationIterator_Frame Frame;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFramesFieldNumber = 1,
+  };
+  // repeated .RAMCloud.ProtoBuf.EnumerationIterator.Frame frames = 1;
+  int frames_size() const;
+  private:
+  int _internal_frames_size() const;
+  public:
+  void clear_frames();
+  ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* mutable_frames(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >*
+      mutable_frames();
+  private:
+  const ::RAMCloud::ProtoBuf::EnumerationIterator_Frame& _internal_frames(int index) const;
+  ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* _internal_add_frames();
+  public:
+  const ::RAMCloud::ProtoBuf::EnumerationIterator_Frame& frames(int index) const;
+  ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* add_frames();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >&
+      frames() const;
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.EnumerationIterator)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame > frames_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_EnumerationIterator_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EnumerationIterator_Frame
+
+// required uint64 tablet_start_hash = 1;
+inline bool EnumerationIterator_Frame::_internal_has_tablet_start_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EnumerationIterator_Frame::has_tablet_start_hash() const {
+  return _internal_has_tablet_start_hash();
+}
+inline void EnumerationIterator_Frame::clear_tablet_start_hash() {
+  _impl_.tablet_start_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EnumerationIterator_Frame::_internal_tablet_start_hash() const {
+  return _impl_.tablet_start_hash_;
+}
+inline uint64_t EnumerationIterator_Frame::tablet_start_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.Frame.tablet_start_hash)
+  return _internal_tablet_start_hash();
+}
+inline void EnumerationIterator_Frame::_internal_set_tablet_start_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tablet_start_hash_ = value;
+}
+inline void EnumerationIterator_Frame::set_tablet_start_hash(uint64_t value) {
+  _internal_set_tablet_start_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.EnumerationIterator.Frame.tablet_start_hash)
+}
+
+// required uint64 tablet_end_hash = 2;
+inline bool EnumerationIterator_Frame::_internal_has_tablet_end_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EnumerationIterator_Frame::has_tablet_end_hash() const {
+  return _internal_has_tablet_end_hash();
+}
+inline void EnumerationIterator_Frame::clear_tablet_end_hash() {
+  _impl_.tablet_end_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t EnumerationIterator_Frame::_internal_tablet_end_hash() const {
+  return _impl_.tablet_end_hash_;
+}
+inline uint64_t EnumerationIterator_Frame::tablet_end_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.Frame.tablet_end_hash)
+  return _internal_tablet_end_hash();
+}
+inline void EnumerationIterator_Frame::_internal_set_tablet_end_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.tablet_end_hash_ = value;
+}
+inline void EnumerationIterator_Frame::set_tablet_end_hash(uint64_t value) {
+  _internal_set_tablet_end_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.EnumerationIterator.Frame.tablet_end_hash)
+}
+
+// required uint64 num_buckets = 3;
+inline bool EnumerationIterator_Frame::_internal_has_num_buckets() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool EnumerationIterator_Frame::has_num_buckets() const {
+  return _internal_has_num_buckets();
+}
+inline void EnumerationIterator_Frame::clear_num_buckets() {
+  _impl_.num_buckets_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t EnumerationIterator_Frame::_internal_num_buckets() const {
+  return _impl_.num_buckets_;
+}
+inline uint64_t EnumerationIterator_Frame::num_buckets() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.Frame.num_buckets)
+  return _internal_num_buckets();
+}
+inline void EnumerationIterator_Frame::_internal_set_num_buckets(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.num_buckets_ = value;
+}
+inline void EnumerationIterator_Frame::set_num_buckets(uint64_t value) {
+  _internal_set_num_buckets(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.EnumerationIterator.Frame.num_buckets)
+}
+
+// required uint64 bucket_index = 4;
+inline bool EnumerationIterator_Frame::_internal_has_bucket_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool EnumerationIterator_Frame::has_bucket_index() const {
+  return _internal_has_bucket_index();
+}
+inline void EnumerationIterator_Frame::clear_bucket_index() {
+  _impl_.bucket_index_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t EnumerationIterator_Frame::_internal_bucket_index() const {
+  return _impl_.bucket_index_;
+}
+inline uint64_t EnumerationIterator_Frame::bucket_index() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.Frame.bucket_index)
+  return _internal_bucket_index();
+}
+inline void EnumerationIterator_Frame::_internal_set_bucket_index(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.bucket_index_ = value;
+}
+inline void EnumerationIterator_Frame::set_bucket_index(uint64_t value) {
+  _internal_set_bucket_index(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.EnumerationIterator.Frame.bucket_index)
+}
+
+// required uint64 bucket_next_hash = 5;
+inline bool EnumerationIterator_Frame::_internal_has_bucket_next_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool EnumerationIterator_Frame::has_bucket_next_hash() const {
+  return _internal_has_bucket_next_hash();
+}
+inline void EnumerationIterator_Frame::clear_bucket_next_hash() {
+  _impl_.bucket_next_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t EnumerationIterator_Frame::_internal_bucket_next_hash() const {
+  return _impl_.bucket_next_hash_;
+}
+inline uint64_t EnumerationIterator_Frame::bucket_next_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.Frame.bucket_next_hash)
+  return _internal_bucket_next_hash();
+}
+inline void EnumerationIterator_Frame::_internal_set_bucket_next_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.bucket_next_hash_ = value;
+}
+inline void EnumerationIterator_Frame::set_bucket_next_hash(uint64_t value) {
+  _internal_set_bucket_next_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.EnumerationIterator.Frame.bucket_next_hash)
+}
+
+// -------------------------------------------------------------------
+
+// EnumerationIterator
+
+// repeated .RAMCloud.ProtoBuf.EnumerationIterator.Frame frames = 1;
+inline int EnumerationIterator::_internal_frames_size() const {
+  return _impl_.frames_.size();
+}
+inline int EnumerationIterator::frames_size() const {
+  return _internal_frames_size();
+}
+inline void EnumerationIterator::clear_frames() {
+  _impl_.frames_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* EnumerationIterator::mutable_frames(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.EnumerationIterator.frames)
+  return _impl_.frames_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >*
+EnumerationIterator::mutable_frames() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.EnumerationIterator.frames)
+  return &_impl_.frames_;
+}
+inline const ::RAMCloud::ProtoBuf::EnumerationIterator_Frame& EnumerationIterator::_internal_frames(int index) const {
+  return _impl_.frames_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::EnumerationIterator_Frame& EnumerationIterator::frames(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.EnumerationIterator.frames)
+  return _internal_frames(index);
+}
+inline ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* EnumerationIterator::_internal_add_frames() {
+  return _impl_.frames_.Add();
+}
+inline ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* EnumerationIterator::add_frames() {
+  ::RAMCloud::ProtoBuf::EnumerationIterator_Frame* _add = _internal_add_frames();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.EnumerationIterator.frames)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::EnumerationIterator_Frame >&
+EnumerationIterator::frames() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.EnumerationIterator.frames)
+  return _impl_.frames_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_EnumerationIterator_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,853 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Histogram.proto
+
+#include "Histogram.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR Histogram_Bucket::Histogram_Bucket(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.index_)*/uint64_t{0u}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}} {}
+struct Histogram_BucketDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Histogram_BucketDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Histogram_BucketDefaultTypeInternal() {}
+  union {
+    Histogram_Bucket _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Histogram_BucketDefaultTypeInternal _Histogram_Bucket_default_instance_;
+PROTOBUF_CONSTEXPR Histogram::Histogram(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bucket_)*/{}
+  , /*decltype(_impl_.num_buckets_)*/uint64_t{0u}
+  , /*decltype(_impl_.bucket_width_)*/uint64_t{0u}
+  , /*decltype(_impl_.sample_sum_high_)*/uint64_t{0u}
+  , /*decltype(_impl_.sample_sum_low_)*/uint64_t{0u}
+  , /*decltype(_impl_.outliers_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_.min_)*/uint64_t{0u}} {}
+struct HistogramDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HistogramDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HistogramDefaultTypeInternal() {}
+  union {
+    Histogram _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HistogramDefaultTypeInternal _Histogram_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_Histogram_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Histogram_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Histogram_2eproto = nullptr;
+
+const uint32_t TableStruct_Histogram_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram_Bucket, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram_Bucket, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram_Bucket, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram_Bucket, _impl_.count_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.num_buckets_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.bucket_width_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.bucket_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.sample_sum_high_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.sample_sum_low_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.outliers_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.max_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::Histogram, _impl_.min_),
+  0,
+  1,
+  ~0u,
+  2,
+  3,
+  4,
+  5,
+  6,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::RAMCloud::ProtoBuf::Histogram_Bucket)},
+  { 10, 24, -1, sizeof(::RAMCloud::ProtoBuf::Histogram)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_Histogram_Bucket_default_instance_._instance,
+  &::RAMCloud::ProtoBuf::_Histogram_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_Histogram_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017Histogram.proto\022\021RAMCloud.ProtoBuf\"\360\001\n"
+  "\tHistogram\022\023\n\013num_buckets\030\001 \002(\006\022\024\n\014bucke"
+  "t_width\030\002 \002(\006\0223\n\006bucket\030\003 \003(\0132#.RAMCloud"
+  ".ProtoBuf.Histogram.Bucket\022\027\n\017sample_sum"
+  "_high\030\004 \002(\006\022\026\n\016sample_sum_low\030\005 \002(\006\022\020\n\010o"
+  "utliers\030\006 \002(\006\022\013\n\003max\030\007 \002(\006\022\013\n\003min\030\010 \002(\006\032"
+  "&\n\006Bucket\022\r\n\005index\030\001 \002(\006\022\r\n\005count\030\002 \002(\006"
+  ;
+static ::_pbi::once_flag descriptor_table_Histogram_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Histogram_2eproto = {
+    false, false, 279, descriptor_table_protodef_Histogram_2eproto,
+    "Histogram.proto",
+    &descriptor_table_Histogram_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_Histogram_2eproto::offsets,
+    file_level_metadata_Histogram_2eproto, file_level_enum_descriptors_Histogram_2eproto,
+    file_level_service_descriptors_Histogram_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Histogram_2eproto_getter() {
+  return &descriptor_table_Histogram_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Histogram_2eproto(&descriptor_table_Histogram_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class Histogram_Bucket::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Histogram_Bucket>()._impl_._has_bits_);
+  static void set_has_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Histogram_Bucket::Histogram_Bucket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Histogram.Bucket)
+}
+Histogram_Bucket::Histogram_Bucket(const Histogram_Bucket& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Histogram_Bucket* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.index_){}
+    , decltype(_impl_.count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.index_, &from._impl_.index_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.count_) -
+    reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.count_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Histogram.Bucket)
+}
+
+inline void Histogram_Bucket::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.index_){uint64_t{0u}}
+    , decltype(_impl_.count_){uint64_t{0u}}
+  };
+}
+
+Histogram_Bucket::~Histogram_Bucket() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Histogram.Bucket)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Histogram_Bucket::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Histogram_Bucket::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Histogram_Bucket::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.index_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.count_) -
+        reinterpret_cast<char*>(&_impl_.index_)) + sizeof(_impl_.count_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Histogram_Bucket::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_index(&has_bits);
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_count(&has_bits);
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Histogram_Bucket::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 index = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_index(), target);
+  }
+
+  // required fixed64 count = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Histogram.Bucket)
+  return target;
+}
+
+size_t Histogram_Bucket::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  size_t total_size = 0;
+
+  if (_internal_has_index()) {
+    // required fixed64 index = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_count()) {
+    // required fixed64 count = 2;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Histogram_Bucket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required fixed64 index = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 count = 2;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Histogram_Bucket::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Histogram_Bucket::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Histogram_Bucket::GetClassData() const { return &_class_data_; }
+
+
+void Histogram_Bucket::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Histogram_Bucket*>(&to_msg);
+  auto& from = static_cast<const Histogram_Bucket&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.index_ = from._impl_.index_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.count_ = from._impl_.count_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Histogram_Bucket::CopyFrom(const Histogram_Bucket& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Histogram.Bucket)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Histogram_Bucket::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void Histogram_Bucket::InternalSwap(Histogram_Bucket* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Histogram_Bucket, _impl_.count_)
+      + sizeof(Histogram_Bucket::_impl_.count_)
+      - PROTOBUF_FIELD_OFFSET(Histogram_Bucket, _impl_.index_)>(
+          reinterpret_cast<char*>(&_impl_.index_),
+          reinterpret_cast<char*>(&other->_impl_.index_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Histogram_Bucket::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Histogram_2eproto_getter, &descriptor_table_Histogram_2eproto_once,
+      file_level_metadata_Histogram_2eproto[0]);
+}
+
+// ===================================================================
+
+class Histogram::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Histogram>()._impl_._has_bits_);
+  static void set_has_num_buckets(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_bucket_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_sample_sum_high(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_sample_sum_low(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_outliers(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_max(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_min(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000007f) ^ 0x0000007f) != 0;
+  }
+};
+
+Histogram::Histogram(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.Histogram)
+}
+Histogram::Histogram(const Histogram& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Histogram* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bucket_){from._impl_.bucket_}
+    , decltype(_impl_.num_buckets_){}
+    , decltype(_impl_.bucket_width_){}
+    , decltype(_impl_.sample_sum_high_){}
+    , decltype(_impl_.sample_sum_low_){}
+    , decltype(_impl_.outliers_){}
+    , decltype(_impl_.max_){}
+    , decltype(_impl_.min_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.num_buckets_, &from._impl_.num_buckets_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.min_) -
+    reinterpret_cast<char*>(&_impl_.num_buckets_)) + sizeof(_impl_.min_));
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.Histogram)
+}
+
+inline void Histogram::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bucket_){arena}
+    , decltype(_impl_.num_buckets_){uint64_t{0u}}
+    , decltype(_impl_.bucket_width_){uint64_t{0u}}
+    , decltype(_impl_.sample_sum_high_){uint64_t{0u}}
+    , decltype(_impl_.sample_sum_low_){uint64_t{0u}}
+    , decltype(_impl_.outliers_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , decltype(_impl_.min_){uint64_t{0u}}
+  };
+}
+
+Histogram::~Histogram() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.Histogram)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Histogram::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bucket_.~RepeatedPtrField();
+}
+
+void Histogram::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Histogram::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.Histogram)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bucket_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.num_buckets_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.min_) -
+        reinterpret_cast<char*>(&_impl_.num_buckets_)) + sizeof(_impl_.min_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Histogram::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required fixed64 num_buckets = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_num_buckets(&has_bits);
+          _impl_.num_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 bucket_width = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_bucket_width(&has_bits);
+          _impl_.bucket_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.Histogram.Bucket bucket = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bucket(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 sample_sum_high = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_sample_sum_high(&has_bits);
+          _impl_.sample_sum_high_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 sample_sum_low = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_sample_sum_low(&has_bits);
+          _impl_.sample_sum_low_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 outliers = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_outliers(&has_bits);
+          _impl_.outliers_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 max = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_max(&has_bits);
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      // required fixed64 min = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _Internal::set_has_min(&has_bits);
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Histogram::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.Histogram)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required fixed64 num_buckets = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_num_buckets(), target);
+  }
+
+  // required fixed64 bucket_width = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(2, this->_internal_bucket_width(), target);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Histogram.Bucket bucket = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bucket_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bucket(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // required fixed64 sample_sum_high = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(4, this->_internal_sample_sum_high(), target);
+  }
+
+  // required fixed64 sample_sum_low = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(5, this->_internal_sample_sum_low(), target);
+  }
+
+  // required fixed64 outliers = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(6, this->_internal_outliers(), target);
+  }
+
+  // required fixed64 max = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(7, this->_internal_max(), target);
+  }
+
+  // required fixed64 min = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(8, this->_internal_min(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.Histogram)
+  return target;
+}
+
+size_t Histogram::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:RAMCloud.ProtoBuf.Histogram)
+  size_t total_size = 0;
+
+  if (_internal_has_num_buckets()) {
+    // required fixed64 num_buckets = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_bucket_width()) {
+    // required fixed64 bucket_width = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_sample_sum_high()) {
+    // required fixed64 sample_sum_high = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_sample_sum_low()) {
+    // required fixed64 sample_sum_low = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_outliers()) {
+    // required fixed64 outliers = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_max()) {
+    // required fixed64 max = 7;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_min()) {
+    // required fixed64 min = 8;
+    total_size += 1 + 8;
+  }
+
+  return total_size;
+}
+size_t Histogram::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.Histogram)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000007f) ^ 0x0000007f) == 0) {  // All required fields are present.
+    // required fixed64 num_buckets = 1;
+    total_size += 1 + 8;
+
+    // required fixed64 bucket_width = 2;
+    total_size += 1 + 8;
+
+    // required fixed64 sample_sum_high = 4;
+    total_size += 1 + 8;
+
+    // required fixed64 sample_sum_low = 5;
+    total_size += 1 + 8;
+
+    // required fixed64 outliers = 6;
+    total_size += 1 + 8;
+
+    // required fixed64 max = 7;
+    total_size += 1 + 8;
+
+    // required fixed64 min = 8;
+    total_size += 1 + 8;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.Histogram.Bucket bucket = 3;
+  total_size += 1UL * this->_internal_bucket_size();
+  for (const auto& msg : this->_impl_.bucket_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Histogram::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Histogram::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Histogram::GetClassData() const { return &_class_data_; }
+
+
+void Histogram::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Histogram*>(&to_msg);
+  auto& from = static_cast<const Histogram&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.Histogram)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bucket_.MergeFrom(from._impl_.bucket_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.num_buckets_ = from._impl_.num_buckets_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.bucket_width_ = from._impl_.bucket_width_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.sample_sum_high_ = from._impl_.sample_sum_high_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.sample_sum_low_ = from._impl_.sample_sum_low_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.outliers_ = from._impl_.outliers_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.max_ = from._impl_.max_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.min_ = from._impl_.min_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Histogram::CopyFrom(const Histogram& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.Histogram)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Histogram::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.bucket_))
+    return false;
+  return true;
+}
+
+void Histogram::InternalSwap(Histogram* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.bucket_.InternalSwap(&other->_impl_.bucket_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Histogram, _impl_.min_)
+      + sizeof(Histogram::_impl_.min_)
+      - PROTOBUF_FIELD_OFFSET(Histogram, _impl_.num_buckets_)>(
+          reinterpret_cast<char*>(&_impl_.num_buckets_),
+          reinterpret_cast<char*>(&other->_impl_.num_buckets_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Histogram::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Histogram_2eproto_getter, &descriptor_table_Histogram_2eproto_once,
+      file_level_metadata_Histogram_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Histogram_Bucket*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Histogram_Bucket >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Histogram_Bucket >(arena);
+}
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::Histogram*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::Histogram >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::Histogram >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,883 @@
+// This file was automatically generated by scripts/rawmetrics.py.
+// Do not edit it.
+namespace RAMCloud {
+RawMetrics::MetricInfo RawMetrics::metricInfo(int i)
+{
+    switch (i) {
+        case 0:
+            return {"coordinator.recoveryCount",
+                    &coordinator.recoveryCount};
+        case 1:
+            return {"coordinator.recoveryTicks",
+                    &coordinator.recoveryTicks};
+        case 2:
+            return {"coordinator.recoveryBuildReplicaMapTicks",
+                    &coordinator.recoveryBuildReplicaMapTicks};
+        case 3:
+            return {"coordinator.recoveryStartTicks",
+                    &coordinator.recoveryStartTicks};
+        case 4:
+            return {"coordinator.recoveryCompleteTicks",
+                    &coordinator.recoveryCompleteTicks};
+        case 5:
+            return {"master.recoveryCount",
+                    &master.recoveryCount};
+        case 6:
+            return {"master.recoveryTicks",
+                    &master.recoveryTicks};
+        case 7:
+            return {"master.replicaManagerTicks",
+                    &master.replicaManagerTicks};
+        case 8:
+            return {"master.segmentAppendTicks",
+                    &master.segmentAppendTicks};
+        case 9:
+            return {"master.segmentAppendCopyTicks",
+                    &master.segmentAppendCopyTicks};
+        case 10:
+            return {"master.segmentReadCount",
+                    &master.segmentReadCount};
+        case 11:
+            return {"master.segmentReadTicks",
+                    &master.segmentReadTicks};
+        case 12:
+            return {"master.segmentReadStallTicks",
+                    &master.segmentReadStallTicks};
+        case 13:
+            return {"master.segmentReadByteCount",
+                    &master.segmentReadByteCount};
+        case 14:
+            return {"master.verifyChecksumTicks",
+                    &master.verifyChecksumTicks};
+        case 15:
+            return {"master.recoverSegmentTicks",
+                    &master.recoverSegmentTicks};
+        case 16:
+            return {"master.recoveryReplayThreads",
+                    &master.recoveryReplayThreads};
+        case 17:
+            return {"master.recoveryReplayTicks",
+                    &master.recoveryReplayTicks};
+        case 18:
+            return {"master.backupInRecoverTicks",
+                    &master.backupInRecoverTicks};
+        case 19:
+            return {"master.segmentCloseCount",
+                    &master.segmentCloseCount};
+        case 20:
+            return {"master.recoverySegmentEntryCount",
+                    &master.recoverySegmentEntryCount};
+        case 21:
+            return {"master.recoverySegmentEntryBytes",
+                    &master.recoverySegmentEntryBytes};
+        case 22:
+            return {"master.liveObjectCount",
+                    &master.liveObjectCount};
+        case 23:
+            return {"master.liveObjectBytes",
+                    &master.liveObjectBytes};
+        case 24:
+            return {"master.objectAppendCount",
+                    &master.objectAppendCount};
+        case 25:
+            return {"master.objectDiscardCount",
+                    &master.objectDiscardCount};
+        case 26:
+            return {"master.safeVersionRecoveryCount",
+                    &master.safeVersionRecoveryCount};
+        case 27:
+            return {"master.safeVersionNonRecoveryCount",
+                    &master.safeVersionNonRecoveryCount};
+        case 28:
+            return {"master.tombstoneAppendCount",
+                    &master.tombstoneAppendCount};
+        case 29:
+            return {"master.tombstoneDiscardCount",
+                    &master.tombstoneDiscardCount};
+        case 30:
+            return {"master.logSyncTicks",
+                    &master.logSyncTicks};
+        case 31:
+            return {"master.logSyncBytes",
+                    &master.logSyncBytes};
+        case 32:
+            return {"master.recoveryWillTicks",
+                    &master.recoveryWillTicks};
+        case 33:
+            return {"master.removeTombstoneTicks",
+                    &master.removeTombstoneTicks};
+        case 34:
+            return {"master.replicationTicks",
+                    &master.replicationTicks};
+        case 35:
+            return {"master.replicationBytes",
+                    &master.replicationBytes};
+        case 36:
+            return {"master.replicas",
+                    &master.replicas};
+        case 37:
+            return {"master.backupCloseTicks",
+                    &master.backupCloseTicks};
+        case 38:
+            return {"master.backupCloseCount",
+                    &master.backupCloseCount};
+        case 39:
+            return {"master.logSyncCloseTicks",
+                    &master.logSyncCloseTicks};
+        case 40:
+            return {"master.logSyncCloseCount",
+                    &master.logSyncCloseCount};
+        case 41:
+            return {"master.replicaRecoveries",
+                    &master.replicaRecoveries};
+        case 42:
+            return {"master.openReplicaRecoveries",
+                    &master.openReplicaRecoveries};
+        case 43:
+            return {"master.replicationTasks",
+                    &master.replicationTasks};
+        case 44:
+            return {"master.replicationTransmitCopyTicks",
+                    &master.replicationTransmitCopyTicks};
+        case 45:
+            return {"master.logSyncTransmitCopyTicks",
+                    &master.logSyncTransmitCopyTicks};
+        case 46:
+            return {"master.replayMemoryReadBytes",
+                    &master.replayMemoryReadBytes};
+        case 47:
+            return {"master.replayMemoryWrittenBytes",
+                    &master.replayMemoryWrittenBytes};
+        case 48:
+            return {"master.replicationTransmitActiveTicks",
+                    &master.replicationTransmitActiveTicks};
+        case 49:
+            return {"master.logSyncTransmitActiveTicks",
+                    &master.logSyncTransmitActiveTicks};
+        case 50:
+            return {"master.replicationPostingWriteRpcTicks",
+                    &master.replicationPostingWriteRpcTicks};
+        case 51:
+            return {"master.recoverSegmentPostingWriteRpcTicks",
+                    &master.recoverSegmentPostingWriteRpcTicks};
+        case 52:
+            return {"master.logSyncPostingWriteRpcTicks",
+                    &master.logSyncPostingWriteRpcTicks};
+        case 53:
+            return {"backup.recoveryCount",
+                    &backup.recoveryCount};
+        case 54:
+            return {"backup.recoveryTicks",
+                    &backup.recoveryTicks};
+        case 55:
+            return {"backup.serviceTicks",
+                    &backup.serviceTicks};
+        case 56:
+            return {"backup.readCompletionCount",
+                    &backup.readCompletionCount};
+        case 57:
+            return {"backup.readingDataTicks",
+                    &backup.readingDataTicks};
+        case 58:
+            return {"backup.storageReadCount",
+                    &backup.storageReadCount};
+        case 59:
+            return {"backup.storageReadBytes",
+                    &backup.storageReadBytes};
+        case 60:
+            return {"backup.storageReadTicks",
+                    &backup.storageReadTicks};
+        case 61:
+            return {"backup.writeClearTicks",
+                    &backup.writeClearTicks};
+        case 62:
+            return {"backup.writeCopyBytes",
+                    &backup.writeCopyBytes};
+        case 63:
+            return {"backup.writeCopyTicks",
+                    &backup.writeCopyTicks};
+        case 64:
+            return {"backup.storageWriteCount",
+                    &backup.storageWriteCount};
+        case 65:
+            return {"backup.storageWriteBytes",
+                    &backup.storageWriteBytes};
+        case 66:
+            return {"backup.storageWriteTicks",
+                    &backup.storageWriteTicks};
+        case 67:
+            return {"backup.filterTicks",
+                    &backup.filterTicks};
+        case 68:
+            return {"backup.primaryLoadCount",
+                    &backup.primaryLoadCount};
+        case 69:
+            return {"backup.secondaryLoadCount",
+                    &backup.secondaryLoadCount};
+        case 70:
+            return {"backup.storageType",
+                    &backup.storageType};
+        case 71:
+            return {"backup.uncommittedFramesFreed",
+                    &backup.uncommittedFramesFreed};
+        case 72:
+            return {"rpc.rpc0Count",
+                    &rpc.rpc0Count};
+        case 73:
+            return {"rpc.rpc1Count",
+                    &rpc.rpc1Count};
+        case 74:
+            return {"rpc.rpc2Count",
+                    &rpc.rpc2Count};
+        case 75:
+            return {"rpc.rpc3Count",
+                    &rpc.rpc3Count};
+        case 76:
+            return {"rpc.rpc4Count",
+                    &rpc.rpc4Count};
+        case 77:
+            return {"rpc.rpc5Count",
+                    &rpc.rpc5Count};
+        case 78:
+            return {"rpc.rpc6Count",
+                    &rpc.rpc6Count};
+        case 79:
+            return {"rpc.pingCount",
+                    &rpc.pingCount};
+        case 80:
+            return {"rpc.proxy_pingCount",
+                    &rpc.proxy_pingCount};
+        case 81:
+            return {"rpc.killCount",
+                    &rpc.killCount};
+        case 82:
+            return {"rpc.create_tableCount",
+                    &rpc.create_tableCount};
+        case 83:
+            return {"rpc.get_table_idCount",
+                    &rpc.get_table_idCount};
+        case 84:
+            return {"rpc.drop_tableCount",
+                    &rpc.drop_tableCount};
+        case 85:
+            return {"rpc.readCount",
+                    &rpc.readCount};
+        case 86:
+            return {"rpc.writeCount",
+                    &rpc.writeCount};
+        case 87:
+            return {"rpc.removeCount",
+                    &rpc.removeCount};
+        case 88:
+            return {"rpc.enlist_serverCount",
+                    &rpc.enlist_serverCount};
+        case 89:
+            return {"rpc.get_server_listCount",
+                    &rpc.get_server_listCount};
+        case 90:
+            return {"rpc.get_table_configCount",
+                    &rpc.get_table_configCount};
+        case 91:
+            return {"rpc.recoverCount",
+                    &rpc.recoverCount};
+        case 92:
+            return {"rpc.hint_server_crashedCount",
+                    &rpc.hint_server_crashedCount};
+        case 93:
+            return {"rpc.recovery_master_finishedCount",
+                    &rpc.recovery_master_finishedCount};
+        case 94:
+            return {"rpc.enumerateCount",
+                    &rpc.enumerateCount};
+        case 95:
+            return {"rpc.set_master_recovery_infoCount",
+                    &rpc.set_master_recovery_infoCount};
+        case 96:
+            return {"rpc.fill_with_test_dataCount",
+                    &rpc.fill_with_test_dataCount};
+        case 97:
+            return {"rpc.multi_opCount",
+                    &rpc.multi_opCount};
+        case 98:
+            return {"rpc.get_metricsCount",
+                    &rpc.get_metricsCount};
+        case 99:
+            return {"rpc.rpc27Count",
+                    &rpc.rpc27Count};
+        case 100:
+            return {"rpc.backup_freeCount",
+                    &rpc.backup_freeCount};
+        case 101:
+            return {"rpc.backup_getrecoverydataCount",
+                    &rpc.backup_getrecoverydataCount};
+        case 102:
+            return {"rpc.rpc30Count",
+                    &rpc.rpc30Count};
+        case 103:
+            return {"rpc.backup_startreadingdataCount",
+                    &rpc.backup_startreadingdataCount};
+        case 104:
+            return {"rpc.backup_writeCount",
+                    &rpc.backup_writeCount};
+        case 105:
+            return {"rpc.backup_recoverycompleteCount",
+                    &rpc.backup_recoverycompleteCount};
+        case 106:
+            return {"rpc.rpc34Count",
+                    &rpc.rpc34Count};
+        case 107:
+            return {"rpc.update_server_listCount",
+                    &rpc.update_server_listCount};
+        case 108:
+            return {"rpc.backup_startpartitionCount",
+                    &rpc.backup_startpartitionCount};
+        case 109:
+            return {"rpc.rpc37Count",
+                    &rpc.rpc37Count};
+        case 110:
+            return {"rpc.rpc38Count",
+                    &rpc.rpc38Count};
+        case 111:
+            return {"rpc.drop_tablet_ownershipCount",
+                    &rpc.drop_tablet_ownershipCount};
+        case 112:
+            return {"rpc.take_tablet_ownershipCount",
+                    &rpc.take_tablet_ownershipCount};
+        case 113:
+            return {"rpc.rpc41Count",
+                    &rpc.rpc41Count};
+        case 114:
+            return {"rpc.get_head_of_logCount",
+                    &rpc.get_head_of_logCount};
+        case 115:
+            return {"rpc.incrementCount",
+                    &rpc.incrementCount};
+        case 116:
+            return {"rpc.prep_for_migrationCount",
+                    &rpc.prep_for_migrationCount};
+        case 117:
+            return {"rpc.receive_migration_dataCount",
+                    &rpc.receive_migration_dataCount};
+        case 118:
+            return {"rpc.reassign_tablet_ownershipCount",
+                    &rpc.reassign_tablet_ownershipCount};
+        case 119:
+            return {"rpc.migrate_tabletCount",
+                    &rpc.migrate_tabletCount};
+        case 120:
+            return {"rpc.is_replica_neededCount",
+                    &rpc.is_replica_neededCount};
+        case 121:
+            return {"rpc.split_tabletCount",
+                    &rpc.split_tabletCount};
+        case 122:
+            return {"rpc.get_server_statisticsCount",
+                    &rpc.get_server_statisticsCount};
+        case 123:
+            return {"rpc.set_runtime_optionCount",
+                    &rpc.set_runtime_optionCount};
+        case 124:
+            return {"rpc.get_server_configCount",
+                    &rpc.get_server_configCount};
+        case 125:
+            return {"rpc.get_backup_configCount",
+                    &rpc.get_backup_configCount};
+        case 126:
+            return {"rpc.rpc54Count",
+                    &rpc.rpc54Count};
+        case 127:
+            return {"rpc.get_master_configCount",
+                    &rpc.get_master_configCount};
+        case 128:
+            return {"rpc.get_log_metricsCount",
+                    &rpc.get_log_metricsCount};
+        case 129:
+            return {"rpc.verify_membershipCount",
+                    &rpc.verify_membershipCount};
+        case 130:
+            return {"rpc.get_runtime_optionCount",
+                    &rpc.get_runtime_optionCount};
+        case 131:
+            return {"rpc.get_lease_infoCount",
+                    &rpc.get_lease_infoCount};
+        case 132:
+            return {"rpc.renew_leaseCount",
+                    &rpc.renew_leaseCount};
+        case 133:
+            return {"rpc.server_controlCount",
+                    &rpc.server_controlCount};
+        case 134:
+            return {"rpc.server_control_allCount",
+                    &rpc.server_control_allCount};
+        case 135:
+            return {"rpc.get_server_idCount",
+                    &rpc.get_server_idCount};
+        case 136:
+            return {"rpc.read_keys_and_valueCount",
+                    &rpc.read_keys_and_valueCount};
+        case 137:
+            return {"rpc.lookup_index_keysCount",
+                    &rpc.lookup_index_keysCount};
+        case 138:
+            return {"rpc.read_hashesCount",
+                    &rpc.read_hashesCount};
+        case 139:
+            return {"rpc.insert_index_entryCount",
+                    &rpc.insert_index_entryCount};
+        case 140:
+            return {"rpc.remove_index_entryCount",
+                    &rpc.remove_index_entryCount};
+        case 141:
+            return {"rpc.create_indexCount",
+                    &rpc.create_indexCount};
+        case 142:
+            return {"rpc.drop_indexCount",
+                    &rpc.drop_indexCount};
+        case 143:
+            return {"rpc.drop_indexlet_ownershipCount",
+                    &rpc.drop_indexlet_ownershipCount};
+        case 144:
+            return {"rpc.take_indexlet_ownershipCount",
+                    &rpc.take_indexlet_ownershipCount};
+        case 145:
+            return {"rpc.prep_for_indexlet_migrationCount",
+                    &rpc.prep_for_indexlet_migrationCount};
+        case 146:
+            return {"rpc.split_and_migrate_indexletCount",
+                    &rpc.split_and_migrate_indexletCount};
+        case 147:
+            return {"rpc.coord_split_and_migrate_indexletCount",
+                    &rpc.coord_split_and_migrate_indexletCount};
+        case 148:
+            return {"rpc.tx_decisionCount",
+                    &rpc.tx_decisionCount};
+        case 149:
+            return {"rpc.tx_prepareCount",
+                    &rpc.tx_prepareCount};
+        case 150:
+            return {"rpc.tx_request_abortCount",
+                    &rpc.tx_request_abortCount};
+        case 151:
+            return {"rpc.tx_hint_failedCount",
+                    &rpc.tx_hint_failedCount};
+        case 152:
+            return {"rpc.echoCount",
+                    &rpc.echoCount};
+        case 153:
+            return {"rpc.lookup_index_objectsCount",
+                    &rpc.lookup_index_objectsCount};
+        case 154:
+            return {"rpc.get_witnessesCount",
+                    &rpc.get_witnessesCount};
+        case 155:
+            return {"rpc.witness_recordCount",
+                    &rpc.witness_recordCount};
+        case 156:
+            return {"rpc.witness_gcCount",
+                    &rpc.witness_gcCount};
+        case 157:
+            return {"rpc.witness_get_recovery_dataCount",
+                    &rpc.witness_get_recovery_dataCount};
+        case 158:
+            return {"rpc.illegal_rpc_typeCount",
+                    &rpc.illegal_rpc_typeCount};
+        case 159:
+            return {"rpc.rpc0Ticks",
+                    &rpc.rpc0Ticks};
+        case 160:
+            return {"rpc.rpc1Ticks",
+                    &rpc.rpc1Ticks};
+        case 161:
+            return {"rpc.rpc2Ticks",
+                    &rpc.rpc2Ticks};
+        case 162:
+            return {"rpc.rpc3Ticks",
+                    &rpc.rpc3Ticks};
+        case 163:
+            return {"rpc.rpc4Ticks",
+                    &rpc.rpc4Ticks};
+        case 164:
+            return {"rpc.rpc5Ticks",
+                    &rpc.rpc5Ticks};
+        case 165:
+            return {"rpc.rpc6Ticks",
+                    &rpc.rpc6Ticks};
+        case 166:
+            return {"rpc.pingTicks",
+                    &rpc.pingTicks};
+        case 167:
+            return {"rpc.proxy_pingTicks",
+                    &rpc.proxy_pingTicks};
+        case 168:
+            return {"rpc.killTicks",
+                    &rpc.killTicks};
+        case 169:
+            return {"rpc.create_tableTicks",
+                    &rpc.create_tableTicks};
+        case 170:
+            return {"rpc.get_table_idTicks",
+                    &rpc.get_table_idTicks};
+        case 171:
+            return {"rpc.drop_tableTicks",
+                    &rpc.drop_tableTicks};
+        case 172:
+            return {"rpc.readTicks",
+                    &rpc.readTicks};
+        case 173:
+            return {"rpc.writeTicks",
+                    &rpc.writeTicks};
+        case 174:
+            return {"rpc.removeTicks",
+                    &rpc.removeTicks};
+        case 175:
+            return {"rpc.enlist_serverTicks",
+                    &rpc.enlist_serverTicks};
+        case 176:
+            return {"rpc.get_server_listTicks",
+                    &rpc.get_server_listTicks};
+        case 177:
+            return {"rpc.get_table_configTicks",
+                    &rpc.get_table_configTicks};
+        case 178:
+            return {"rpc.recoverTicks",
+                    &rpc.recoverTicks};
+        case 179:
+            return {"rpc.hint_server_crashedTicks",
+                    &rpc.hint_server_crashedTicks};
+        case 180:
+            return {"rpc.recovery_master_finishedTicks",
+                    &rpc.recovery_master_finishedTicks};
+        case 181:
+            return {"rpc.enumerateTicks",
+                    &rpc.enumerateTicks};
+        case 182:
+            return {"rpc.set_master_recovery_infoTicks",
+                    &rpc.set_master_recovery_infoTicks};
+        case 183:
+            return {"rpc.fill_with_test_dataTicks",
+                    &rpc.fill_with_test_dataTicks};
+        case 184:
+            return {"rpc.multi_opTicks",
+                    &rpc.multi_opTicks};
+        case 185:
+            return {"rpc.get_metricsTicks",
+                    &rpc.get_metricsTicks};
+        case 186:
+            return {"rpc.rpc27Ticks",
+                    &rpc.rpc27Ticks};
+        case 187:
+            return {"rpc.backup_freeTicks",
+                    &rpc.backup_freeTicks};
+        case 188:
+            return {"rpc.backup_getrecoverydataTicks",
+                    &rpc.backup_getrecoverydataTicks};
+        case 189:
+            return {"rpc.rpc30Ticks",
+                    &rpc.rpc30Ticks};
+        case 190:
+            return {"rpc.backup_startreadingdataTicks",
+                    &rpc.backup_startreadingdataTicks};
+        case 191:
+            return {"rpc.backup_writeTicks",
+                    &rpc.backup_writeTicks};
+        case 192:
+            return {"rpc.backup_recoverycompleteTicks",
+                    &rpc.backup_recoverycompleteTicks};
+        case 193:
+            return {"rpc.rpc34Ticks",
+                    &rpc.rpc34Ticks};
+        case 194:
+            return {"rpc.update_server_listTicks",
+                    &rpc.update_server_listTicks};
+        case 195:
+            return {"rpc.backup_startpartitionTicks",
+                    &rpc.backup_startpartitionTicks};
+        case 196:
+            return {"rpc.rpc37Ticks",
+                    &rpc.rpc37Ticks};
+        case 197:
+            return {"rpc.rpc38Ticks",
+                    &rpc.rpc38Ticks};
+        case 198:
+            return {"rpc.drop_tablet_ownershipTicks",
+                    &rpc.drop_tablet_ownershipTicks};
+        case 199:
+            return {"rpc.take_tablet_ownershipTicks",
+                    &rpc.take_tablet_ownershipTicks};
+        case 200:
+            return {"rpc.rpc41Ticks",
+                    &rpc.rpc41Ticks};
+        case 201:
+            return {"rpc.get_head_of_logTicks",
+                    &rpc.get_head_of_logTicks};
+        case 202:
+            return {"rpc.incrementTicks",
+                    &rpc.incrementTicks};
+        case 203:
+            return {"rpc.prep_for_migrationTicks",
+                    &rpc.prep_for_migrationTicks};
+        case 204:
+            return {"rpc.receive_migration_dataTicks",
+                    &rpc.receive_migration_dataTicks};
+        case 205:
+            return {"rpc.reassign_tablet_ownershipTicks",
+                    &rpc.reassign_tablet_ownershipTicks};
+        case 206:
+            return {"rpc.migrate_tabletTicks",
+                    &rpc.migrate_tabletTicks};
+        case 207:
+            return {"rpc.is_replica_neededTicks",
+                    &rpc.is_replica_neededTicks};
+        case 208:
+            return {"rpc.split_tabletTicks",
+                    &rpc.split_tabletTicks};
+        case 209:
+            return {"rpc.get_server_statisticsTicks",
+                    &rpc.get_server_statisticsTicks};
+        case 210:
+            return {"rpc.set_runtime_optionTicks",
+                    &rpc.set_runtime_optionTicks};
+        case 211:
+            return {"rpc.get_server_configTicks",
+                    &rpc.get_server_configTicks};
+        case 212:
+            return {"rpc.get_backup_configTicks",
+                    &rpc.get_backup_configTicks};
+        case 213:
+            return {"rpc.rpc54Ticks",
+                    &rpc.rpc54Ticks};
+        case 214:
+            return {"rpc.get_master_configTicks",
+                    &rpc.get_master_configTicks};
+        case 215:
+            return {"rpc.get_log_metricsTicks",
+                    &rpc.get_log_metricsTicks};
+        case 216:
+            return {"rpc.verify_membershipTicks",
+                    &rpc.verify_membershipTicks};
+        case 217:
+            return {"rpc.get_runtime_optionTicks",
+                    &rpc.get_runtime_optionTicks};
+        case 218:
+            return {"rpc.get_lease_infoTicks",
+                    &rpc.get_lease_infoTicks};
+        case 219:
+            return {"rpc.renew_leaseTicks",
+                    &rpc.renew_leaseTicks};
+        case 220:
+            return {"rpc.server_controlTicks",
+                    &rpc.server_controlTicks};
+        case 221:
+            return {"rpc.server_control_allTicks",
+                    &rpc.server_control_allTicks};
+        case 222:
+            return {"rpc.get_server_idTicks",
+                    &rpc.get_server_idTicks};
+        case 223:
+            return {"rpc.read_keys_and_valueTicks",
+                    &rpc.read_keys_and_valueTicks};
+        case 224:
+            return {"rpc.lookup_index_keysTicks",
+                    &rpc.lookup_index_keysTicks};
+        case 225:
+            return {"rpc.read_hashesTicks",
+                    &rpc.read_hashesTicks};
+        case 226:
+            return {"rpc.insert_index_entryTicks",
+                    &rpc.insert_index_entryTicks};
+        case 227:
+            return {"rpc.remove_index_entryTicks",
+                    &rpc.remove_index_entryTicks};
+        case 228:
+            return {"rpc.create_indexTicks",
+                    &rpc.create_indexTicks};
+        case 229:
+            return {"rpc.drop_indexTicks",
+                    &rpc.drop_indexTicks};
+        case 230:
+            return {"rpc.drop_indexlet_ownershipTicks",
+                    &rpc.drop_indexlet_ownershipTicks};
+        case 231:
+            return {"rpc.take_indexlet_ownershipTicks",
+                    &rpc.take_indexlet_ownershipTicks};
+        case 232:
+            return {"rpc.prep_for_indexlet_migrationTicks",
+                    &rpc.prep_for_indexlet_migrationTicks};
+        case 233:
+            return {"rpc.split_and_migrate_indexletTicks",
+                    &rpc.split_and_migrate_indexletTicks};
+        case 234:
+            return {"rpc.coord_split_and_migrate_indexletTicks",
+                    &rpc.coord_split_and_migrate_indexletTicks};
+        case 235:
+            return {"rpc.tx_decisionTicks",
+                    &rpc.tx_decisionTicks};
+        case 236:
+            return {"rpc.tx_prepareTicks",
+                    &rpc.tx_prepareTicks};
+        case 237:
+            return {"rpc.tx_request_abortTicks",
+                    &rpc.tx_request_abortTicks};
+        case 238:
+            return {"rpc.tx_hint_failedTicks",
+                    &rpc.tx_hint_failedTicks};
+        case 239:
+            return {"rpc.echoTicks",
+                    &rpc.echoTicks};
+        case 240:
+            return {"rpc.lookup_index_objectsTicks",
+                    &rpc.lookup_index_objectsTicks};
+        case 241:
+            return {"rpc.get_witnessesTicks",
+                    &rpc.get_witnessesTicks};
+        case 242:
+            return {"rpc.witness_recordTicks",
+                    &rpc.witness_recordTicks};
+        case 243:
+            return {"rpc.witness_gcTicks",
+                    &rpc.witness_gcTicks};
+        case 244:
+            return {"rpc.witness_get_recovery_dataTicks",
+                    &rpc.witness_get_recovery_dataTicks};
+        case 245:
+            return {"rpc.illegal_rpc_typeTicks",
+                    &rpc.illegal_rpc_typeTicks};
+        case 246:
+            return {"transport.transmit.ticks",
+                    &transport.transmit.ticks};
+        case 247:
+            return {"transport.transmit.messageCount",
+                    &transport.transmit.messageCount};
+        case 248:
+            return {"transport.transmit.packetCount",
+                    &transport.transmit.packetCount};
+        case 249:
+            return {"transport.transmit.iovecCount",
+                    &transport.transmit.iovecCount};
+        case 250:
+            return {"transport.transmit.byteCount",
+                    &transport.transmit.byteCount};
+        case 251:
+            return {"transport.transmit.copyTicks",
+                    &transport.transmit.copyTicks};
+        case 252:
+            return {"transport.transmit.dmaTicks",
+                    &transport.transmit.dmaTicks};
+        case 253:
+            return {"transport.receive.ticks",
+                    &transport.receive.ticks};
+        case 254:
+            return {"transport.receive.messageCount",
+                    &transport.receive.messageCount};
+        case 255:
+            return {"transport.receive.packetCount",
+                    &transport.receive.packetCount};
+        case 256:
+            return {"transport.receive.iovecCount",
+                    &transport.receive.iovecCount};
+        case 257:
+            return {"transport.receive.byteCount",
+                    &transport.receive.byteCount};
+        case 258:
+            return {"transport.infiniband.transmitActiveTicks",
+                    &transport.infiniband.transmitActiveTicks};
+        case 259:
+            return {"transport.sessionOpenTicks",
+                    &transport.sessionOpenTicks};
+        case 260:
+            return {"transport.sessionOpenCount",
+                    &transport.sessionOpenCount};
+        case 261:
+            return {"transport.sessionOpenSquaredTicks",
+                    &transport.sessionOpenSquaredTicks};
+        case 262:
+            return {"transport.retrySessionOpenCount",
+                    &transport.retrySessionOpenCount};
+        case 263:
+            return {"transport.clientRpcsActiveTicks",
+                    &transport.clientRpcsActiveTicks};
+        case 264:
+            return {"temp.ticks0",
+                    &temp.ticks0};
+        case 265:
+            return {"temp.count0",
+                    &temp.count0};
+        case 266:
+            return {"temp.ticks1",
+                    &temp.ticks1};
+        case 267:
+            return {"temp.count1",
+                    &temp.count1};
+        case 268:
+            return {"temp.ticks2",
+                    &temp.ticks2};
+        case 269:
+            return {"temp.count2",
+                    &temp.count2};
+        case 270:
+            return {"temp.ticks3",
+                    &temp.ticks3};
+        case 271:
+            return {"temp.count3",
+                    &temp.count3};
+        case 272:
+            return {"temp.ticks4",
+                    &temp.ticks4};
+        case 273:
+            return {"temp.count4",
+                    &temp.count4};
+        case 274:
+            return {"temp.ticks5",
+                    &temp.ticks5};
+        case 275:
+            return {"temp.count5",
+                    &temp.count5};
+        case 276:
+            return {"temp.ticks6",
+                    &temp.ticks6};
+        case 277:
+            return {"temp.count6",
+                    &temp.count6};
+        case 278:
+            return {"temp.ticks7",
+                    &temp.ticks7};
+        case 279:
+            return {"temp.count7",
+                    &temp.count7};
+        case 280:
+            return {"temp.ticks8",
+                    &temp.ticks8};
+        case 281:
+            return {"temp.count8",
+                    &temp.count8};
+        case 282:
+            return {"temp.ticks9",
+                    &temp.ticks9};
+        case 283:
+            return {"temp.count9",
+                    &temp.count9};
+        case 284:
+            return {"serverId",
+                    &serverId};
+        case 285:
+            return {"pid",
+                    &pid};
+        case 286:
+            return {"clockFrequency",
+                    &clockFrequency};
+        case 287:
+            return {"segmentSize",
+                    &segmentSize};
+        case 288:
+            return {"processSystemTicks",
+                    &processSystemTicks};
+        case 289:
+            return {"processUserTicks",
+                    &processUserTicks};
+        case 290:
+            return {"uptimeTicks",
+                    &uptimeTicks};
+    }
+    return {NULL, NULL};
+}
+} // namespace RAMCloud
@@ -0,0 +1,923 @@
+// This file was automatically generated by scripts/rawmetrics.py.
+// Do not edit it.
+/// server metrics
+    RawMetrics()
+        : coordinator()
+        , master()
+        , backup()
+        , rpc()
+        , transport()
+        , temp()
+        , serverId(0)
+        , pid(0)
+        , clockFrequency(0)
+        , segmentSize(0)
+        , processSystemTicks(0)
+        , processUserTicks(0)
+        , uptimeTicks(0) {init();}
+    /// metrics for coordinator
+    struct Coordinator {
+        Coordinator()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , recoveryBuildReplicaMapTicks(0)
+            , recoveryStartTicks(0)
+            , recoveryCompleteTicks(0) {}
+        /// number of recoveries in which this coordinator participated
+        RawMetric recoveryCount;
+        /// elapsed time during recoveries
+        RawMetric recoveryTicks;
+        /// time contacting backups and finding replicas for crashed master
+        RawMetric recoveryBuildReplicaMapTicks;
+        /// time in Recovery::start
+        RawMetric recoveryStartTicks;
+        /// time sending recovery complete RPCs to backups
+        RawMetric recoveryCompleteTicks;
+    } coordinator;
+    /// metrics for masters
+    struct Master {
+        Master()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , replicaManagerTicks(0)
+            , segmentAppendTicks(0)
+            , segmentAppendCopyTicks(0)
+            , segmentReadCount(0)
+            , segmentReadTicks(0)
+            , segmentReadStallTicks(0)
+            , segmentReadByteCount(0)
+            , verifyChecksumTicks(0)
+            , recoverSegmentTicks(0)
+            , recoveryReplayThreads(0)
+            , recoveryReplayTicks(0)
+            , backupInRecoverTicks(0)
+            , segmentCloseCount(0)
+            , recoverySegmentEntryCount(0)
+            , recoverySegmentEntryBytes(0)
+            , liveObjectCount(0)
+            , liveObjectBytes(0)
+            , objectAppendCount(0)
+            , objectDiscardCount(0)
+            , safeVersionRecoveryCount(0)
+            , safeVersionNonRecoveryCount(0)
+            , tombstoneAppendCount(0)
+            , tombstoneDiscardCount(0)
+            , logSyncTicks(0)
+            , logSyncBytes(0)
+            , recoveryWillTicks(0)
+            , removeTombstoneTicks(0)
+            , replicationTicks(0)
+            , replicationBytes(0)
+            , replicas(0)
+            , backupCloseTicks(0)
+            , backupCloseCount(0)
+            , logSyncCloseTicks(0)
+            , logSyncCloseCount(0)
+            , replicaRecoveries(0)
+            , openReplicaRecoveries(0)
+            , replicationTasks(0)
+            , replicationTransmitCopyTicks(0)
+            , logSyncTransmitCopyTicks(0)
+            , replayMemoryReadBytes(0)
+            , replayMemoryWrittenBytes(0)
+            , replicationTransmitActiveTicks(0)
+            , logSyncTransmitActiveTicks(0)
+            , replicationPostingWriteRpcTicks(0)
+            , recoverSegmentPostingWriteRpcTicks(0)
+            , logSyncPostingWriteRpcTicks(0) {}
+        /// number of recoveries in which this master participated
+        RawMetric recoveryCount;
+        /// the elapsed time during recoveries
+        RawMetric recoveryTicks;
+        /// time spent in ReplicaManager
+        RawMetric replicaManagerTicks;
+        /// time spent in Segment::append
+        RawMetric segmentAppendTicks;
+        /// time spent copying in Segment::append
+        RawMetric segmentAppendCopyTicks;
+        /// number of BackupClient::getRecoveryData calls issued
+        RawMetric segmentReadCount;
+        /// elapsed time for getRecoveryData calls to backups
+        RawMetric segmentReadTicks;
+        /// time stalled waiting for segments from backups
+        RawMetric segmentReadStallTicks;
+        /// bytes of recovery segments received from backups
+        RawMetric segmentReadByteCount;
+        /// time verifying checksums on objects from backups
+        RawMetric verifyChecksumTicks;
+        /// spent in MasterService::recoverSegment
+        RawMetric recoverSegmentTicks;
+        /// number of threads replaying recovery segments concurrently
+        RawMetric recoveryReplayThreads;
+        /// elapsed time from the start of the first recovery segment replay until the last one finished
+        RawMetric recoveryReplayTicks;
+        /// time spent in ReplicaManager::proceed called from MasterService::recoverSegment
+        RawMetric backupInRecoverTicks;
+        /// number of complete segments written to backups
+        RawMetric segmentCloseCount;
+        /// number of recovery segment entries (e.g. objects, tombstones)
+        RawMetric recoverySegmentEntryCount;
+        /// number of bytes in recovery segment entries (without overhead)
+        RawMetric recoverySegmentEntryBytes;
+        /// number of live objects written during recovery
+        RawMetric liveObjectCount;
+        /// number of bytes of live object data written during recovery
+        RawMetric liveObjectBytes;
+        /// number of objects appended to the log during recovery
+        RawMetric objectAppendCount;
+        /// number of objects not appended to the log during recovery
+        RawMetric objectDiscardCount;
+        /// number of safeVersion updates during recovery
+        RawMetric safeVersionRecoveryCount;
+        /// number of safeVersion discarded during recovery
+        RawMetric safeVersionNonRecoveryCount;
+        /// number of tombstones kept during recovery
+        RawMetric tombstoneAppendCount;
+        /// number of tombstones discarded during recovery
+        RawMetric tombstoneDiscardCount;
+        /// time syncing the log at the end of recovery
+        RawMetric logSyncTicks;
+        /// bytes sent during log sync
+        RawMetric logSyncBytes;
+        /// time rebuilding will at the end of recovery
+        RawMetric recoveryWillTicks;
+        /// time deleting tombstones at the end of recovery
+        RawMetric removeTombstoneTicks;
+        /// time with outstanding RPCs to backups
+        RawMetric replicationTicks;
+        /// bytes sent during recovery from first gRD response through log sync
+        RawMetric replicationBytes;
+        /// number of backups on which to replicate each segment
+        RawMetric replicas;
+        /// time closing segments in ReplicaManager
+        RawMetric backupCloseTicks;
+        /// number of segments closed in ReplicaManager
+        RawMetric backupCloseCount;
+        /// time close segments during log sync
+        RawMetric logSyncCloseTicks;
+        /// number of segments closed during log sync
+        RawMetric logSyncCloseCount;
+        /// number of replicas which have started replica recreation
+        RawMetric replicaRecoveries;
+        /// of replicaRecoveries how many were for replicas which were open
+        RawMetric openReplicaRecoveries;
+        /// max number of outstanding tasks in ReplicaManager
+        RawMetric replicationTasks;
+        /// time spent copying outgoing rpcs in transport
+        RawMetric replicationTransmitCopyTicks;
+        /// time spent copying outgoing rpcs in transport just during log sync
+        RawMetric logSyncTransmitCopyTicks;
+        /// rough estimate of memory read during log replay
+        RawMetric replayMemoryReadBytes;
+        /// rough estimate of memory written during log replay
+        RawMetric replayMemoryWrittenBytes;
+        /// time transport tx was active during replication
+        RawMetric replicationTransmitActiveTicks;
+        /// time transport tx was active during log sync
+        RawMetric logSyncTransmitActiveTicks;
+        /// time spent during recovery starting write rpcs in transport
+        RawMetric replicationPostingWriteRpcTicks;
+        /// time spent during recoverSegment starting write rpcs in transport
+        RawMetric recoverSegmentPostingWriteRpcTicks;
+        /// time spent during recovery final log sync starting write rpcs in transport
+        RawMetric logSyncPostingWriteRpcTicks;
+    } master;
+    /// metrics for backups
+    struct Backup {
+        Backup()
+            : recoveryCount(0)
+            , recoveryTicks(0)
+            , serviceTicks(0)
+            , readCompletionCount(0)
+            , readingDataTicks(0)
+            , storageReadCount(0)
+            , storageReadBytes(0)
+            , storageReadTicks(0)
+            , writeClearTicks(0)
+            , writeCopyBytes(0)
+            , writeCopyTicks(0)
+            , storageWriteCount(0)
+            , storageWriteBytes(0)
+            , storageWriteTicks(0)
+            , filterTicks(0)
+            , primaryLoadCount(0)
+            , secondaryLoadCount(0)
+            , storageType(0)
+            , uncommittedFramesFreed(0) {}
+        /// number of recoveries in which this backup participated
+        RawMetric recoveryCount;
+        /// elapsed time during recovery
+        RawMetric recoveryTicks;
+        /// time spent servicing RPC requests
+        RawMetric serviceTicks;
+        /// number of getRecoveryData requests successfully completed
+        RawMetric readCompletionCount;
+        /// time from startReadingData to done reading
+        RawMetric readingDataTicks;
+        /// number of segment reads from disk
+        RawMetric storageReadCount;
+        /// amount of bytes read from disk
+        RawMetric storageReadBytes;
+        /// time reading from disk
+        RawMetric storageReadTicks;
+        /// time clearing segment memory during segment open
+        RawMetric writeClearTicks;
+        /// bytes written to backup segments
+        RawMetric writeCopyBytes;
+        /// time copying data to backup segments
+        RawMetric writeCopyTicks;
+        /// number of segment writes to disk
+        RawMetric storageWriteCount;
+        /// bytes written to disk
+        RawMetric storageWriteBytes;
+        /// time writing to disk
+        RawMetric storageWriteTicks;
+        /// time filtering segments
+        RawMetric filterTicks;
+        /// number of primary segments requested
+        RawMetric primaryLoadCount;
+        /// number of secondary segments requested
+        RawMetric secondaryLoadCount;
+        /// 1 = in-memory, 2 = on-disk
+        RawMetric storageType;
+        /// number of segment frames freed before being fully flushed to disk
+        RawMetric uncommittedFramesFreed;
+    } backup;
+    /// metrics for remote procedure calls
+    struct Rpc {
+        Rpc()
+            : rpc0Count(0)
+            , rpc1Count(0)
+            , rpc2Count(0)
+            , rpc3Count(0)
+            , rpc4Count(0)
+            , rpc5Count(0)
+            , rpc6Count(0)
+            , pingCount(0)
+            , proxy_pingCount(0)
+            , killCount(0)
+            , create_tableCount(0)
+            , get_table_idCount(0)
+            , drop_tableCount(0)
+            , readCount(0)
+            , writeCount(0)
+            , removeCount(0)
+            , enlist_serverCount(0)
+            , get_server_listCount(0)
+            , get_table_configCount(0)
+            , recoverCount(0)
+            , hint_server_crashedCount(0)
+            , recovery_master_finishedCount(0)
+            , enumerateCount(0)
+            , set_master_recovery_infoCount(0)
+            , fill_with_test_dataCount(0)
+            , multi_opCount(0)
+            , get_metricsCount(0)
+            , rpc27Count(0)
+            , backup_freeCount(0)
+            , backup_getrecoverydataCount(0)
+            , rpc30Count(0)
+            , backup_startreadingdataCount(0)
+            , backup_writeCount(0)
+            , backup_recoverycompleteCount(0)
+            , rpc34Count(0)
+            , update_server_listCount(0)
+            , backup_startpartitionCount(0)
+            , rpc37Count(0)
+            , rpc38Count(0)
+            , drop_tablet_ownershipCount(0)
+            , take_tablet_ownershipCount(0)
+            , rpc41Count(0)
+            , get_head_of_logCount(0)
+            , incrementCount(0)
+            , prep_for_migrationCount(0)
+            , receive_migration_dataCount(0)
+            , reassign_tablet_ownershipCount(0)
+            , migrate_tabletCount(0)
+            , is_replica_neededCount(0)
+            , split_tabletCount(0)
+            , get_server_statisticsCount(0)
+            , set_runtime_optionCount(0)
+            , get_server_configCount(0)
+            , get_backup_configCount(0)
+            , rpc54Count(0)
+            , get_master_configCount(0)
+            , get_log_metricsCount(0)
+            , verify_membershipCount(0)
+            , get_runtime_optionCount(0)
+            , get_lease_infoCount(0)
+            , renew_leaseCount(0)
+            , server_controlCount(0)
+            , server_control_allCount(0)
+            , get_server_idCount(0)
+            , read_keys_and_valueCount(0)
+            , lookup_index_keysCount(0)
+            , read_hashesCount(0)
+            , insert_index_entryCount(0)
+            , remove_index_entryCount(0)
+            , create_indexCount(0)
+            , drop_indexCount(0)
+            , drop_indexlet_ownershipCount(0)
+            , take_indexlet_ownershipCount(0)
+            , prep_for_indexlet_migrationCount(0)
+            , split_and_migrate_indexletCount(0)
+            , coord_split_and_migrate_indexletCount(0)
+            , tx_decisionCount(0)
+            , tx_prepareCount(0)
+            , tx_request_abortCount(0)
+            , tx_hint_failedCount(0)
+            , echoCount(0)
+            , lookup_index_objectsCount(0)
+            , get_witnessesCount(0)
+            , witness_recordCount(0)
+            , witness_gcCount(0)
+            , witness_get_recovery_dataCount(0)
+            , illegal_rpc_typeCount(0)
+            , rpc0Ticks(0)
+            , rpc1Ticks(0)
+            , rpc2Ticks(0)
+            , rpc3Ticks(0)
+            , rpc4Ticks(0)
+            , rpc5Ticks(0)
+            , rpc6Ticks(0)
+            , pingTicks(0)
+            , proxy_pingTicks(0)
+            , killTicks(0)
+            , create_tableTicks(0)
+            , get_table_idTicks(0)
+            , drop_tableTicks(0)
+            , readTicks(0)
+            , writeTicks(0)
+            , removeTicks(0)
+            , enlist_serverTicks(0)
+            , get_server_listTicks(0)
+            , get_table_configTicks(0)
+            , recoverTicks(0)
+            , hint_server_crashedTicks(0)
+            , recovery_master_finishedTicks(0)
+            , enumerateTicks(0)
+            , set_master_recovery_infoTicks(0)
+            , fill_with_test_dataTicks(0)
+            , multi_opTicks(0)
+            , get_metricsTicks(0)
+            , rpc27Ticks(0)
+            , backup_freeTicks(0)
+            , backup_getrecoverydataTicks(0)
+            , rpc30Ticks(0)
+            , backup_startreadingdataTicks(0)
+            , backup_writeTicks(0)
+            , backup_recoverycompleteTicks(0)
+            , rpc34Ticks(0)
+            , update_server_listTicks(0)
+            , backup_startpartitionTicks(0)
+            , rpc37Ticks(0)
+            , rpc38Ticks(0)
+            , drop_tablet_ownershipTicks(0)
+            , take_tablet_ownershipTicks(0)
+            , rpc41Ticks(0)
+            , get_head_of_logTicks(0)
+            , incrementTicks(0)
+            , prep_for_migrationTicks(0)
+            , receive_migration_dataTicks(0)
+            , reassign_tablet_ownershipTicks(0)
+            , migrate_tabletTicks(0)
+            , is_replica_neededTicks(0)
+            , split_tabletTicks(0)
+            , get_server_statisticsTicks(0)
+            , set_runtime_optionTicks(0)
+            , get_server_configTicks(0)
+            , get_backup_configTicks(0)
+            , rpc54Ticks(0)
+            , get_master_configTicks(0)
+            , get_log_metricsTicks(0)
+            , verify_membershipTicks(0)
+            , get_runtime_optionTicks(0)
+            , get_lease_infoTicks(0)
+            , renew_leaseTicks(0)
+            , server_controlTicks(0)
+            , server_control_allTicks(0)
+            , get_server_idTicks(0)
+            , read_keys_and_valueTicks(0)
+            , lookup_index_keysTicks(0)
+            , read_hashesTicks(0)
+            , insert_index_entryTicks(0)
+            , remove_index_entryTicks(0)
+            , create_indexTicks(0)
+            , drop_indexTicks(0)
+            , drop_indexlet_ownershipTicks(0)
+            , take_indexlet_ownershipTicks(0)
+            , prep_for_indexlet_migrationTicks(0)
+            , split_and_migrate_indexletTicks(0)
+            , coord_split_and_migrate_indexletTicks(0)
+            , tx_decisionTicks(0)
+            , tx_prepareTicks(0)
+            , tx_request_abortTicks(0)
+            , tx_hint_failedTicks(0)
+            , echoTicks(0)
+            , lookup_index_objectsTicks(0)
+            , get_witnessesTicks(0)
+            , witness_recordTicks(0)
+            , witness_gcTicks(0)
+            , witness_get_recovery_dataTicks(0)
+            , illegal_rpc_typeTicks(0) {}
+        /// number of invocations of RPC 0 (undefined)
+        RawMetric rpc0Count;
+        /// number of invocations of RPC 1 (undefined)
+        RawMetric rpc1Count;
+        /// number of invocations of RPC 2 (undefined)
+        RawMetric rpc2Count;
+        /// number of invocations of RPC 3 (undefined)
+        RawMetric rpc3Count;
+        /// number of invocations of RPC 4 (undefined)
+        RawMetric rpc4Count;
+        /// number of invocations of RPC 5 (undefined)
+        RawMetric rpc5Count;
+        /// number of invocations of RPC 6 (undefined)
+        RawMetric rpc6Count;
+        /// number of invocations of the PING RPC
+        RawMetric pingCount;
+        /// number of invocations of the PROXY_PING RPC
+        RawMetric proxy_pingCount;
+        /// number of invocations of the KILL RPC
+        RawMetric killCount;
+        /// number of invocations of the CREATE_TABLE RPC
+        RawMetric create_tableCount;
+        /// number of invocations of the GET_TABLE_ID RPC
+        RawMetric get_table_idCount;
+        /// number of invocations of the DROP_TABLE RPC
+        RawMetric drop_tableCount;
+        /// number of invocations of the READ RPC
+        RawMetric readCount;
+        /// number of invocations of the WRITE RPC
+        RawMetric writeCount;
+        /// number of invocations of the REMOVE RPC
+        RawMetric removeCount;
+        /// number of invocations of the ENLIST_SERVER RPC
+        RawMetric enlist_serverCount;
+        /// number of invocations of the GET_SERVER_LIST RPC
+        RawMetric get_server_listCount;
+        /// number of invocations of the GET_TABLE_CONFIG RPC
+        RawMetric get_table_configCount;
+        /// number of invocations of the RECOVER RPC
+        RawMetric recoverCount;
+        /// number of invocations of the HINT_SERVER_CRASHED RPC
+        RawMetric hint_server_crashedCount;
+        /// number of invocations of the RECOVERY_MASTER_FINISHED RPC
+        RawMetric recovery_master_finishedCount;
+        /// number of invocations of the ENUMERATE RPC
+        RawMetric enumerateCount;
+        /// number of invocations of the SET_MASTER_RECOVERY_INFO RPC
+        RawMetric set_master_recovery_infoCount;
+        /// number of invocations of the FILL_WITH_TEST_DATA RPC
+        RawMetric fill_with_test_dataCount;
+        /// number of invocations of the MULTI_OP RPC
+        RawMetric multi_opCount;
+        /// number of invocations of the GET_METRICS RPC
+        RawMetric get_metricsCount;
+        /// number of invocations of RPC 27 (undefined)
+        RawMetric rpc27Count;
+        /// number of invocations of the BACKUP_FREE RPC
+        RawMetric backup_freeCount;
+        /// number of invocations of the BACKUP_GETRECOVERYDATA RPC
+        RawMetric backup_getrecoverydataCount;
+        /// number of invocations of RPC 30 (undefined)
+        RawMetric rpc30Count;
+        /// number of invocations of the BACKUP_STARTREADINGDATA RPC
+        RawMetric backup_startreadingdataCount;
+        /// number of invocations of the BACKUP_WRITE RPC
+        RawMetric backup_writeCount;
+        /// number of invocations of the BACKUP_RECOVERYCOMPLETE RPC
+        RawMetric backup_recoverycompleteCount;
+        /// number of invocations of RPC 34 (undefined)
+        RawMetric rpc34Count;
+        /// number of invocations of the UPDATE_SERVER_LIST RPC
+        RawMetric update_server_listCount;
+        /// number of invocations of the BACKUP_STARTPARTITION RPC
+        RawMetric backup_startpartitionCount;
+        /// number of invocations of RPC 37 (undefined)
+        RawMetric rpc37Count;
+        /// number of invocations of RPC 38 (undefined)
+        RawMetric rpc38Count;
+        /// number of invocations of the DROP_TABLET_OWNERSHIP RPC
+        RawMetric drop_tablet_ownershipCount;
+        /// number of invocations of the TAKE_TABLET_OWNERSHIP RPC
+        RawMetric take_tablet_ownershipCount;
+        /// number of invocations of RPC 41 (undefined)
+        RawMetric rpc41Count;
+        /// number of invocations of the GET_HEAD_OF_LOG RPC
+        RawMetric get_head_of_logCount;
+        /// number of invocations of the INCREMENT RPC
+        RawMetric incrementCount;
+        /// number of invocations of the PREP_FOR_MIGRATION RPC
+        RawMetric prep_for_migrationCount;
+        /// number of invocations of the RECEIVE_MIGRATION_DATA RPC
+        RawMetric receive_migration_dataCount;
+        /// number of invocations of the REASSIGN_TABLET_OWNERSHIP RPC
+        RawMetric reassign_tablet_ownershipCount;
+        /// number of invocations of the MIGRATE_TABLET RPC
+        RawMetric migrate_tabletCount;
+        /// number of invocations of the IS_REPLICA_NEEDED RPC
+        RawMetric is_replica_neededCount;
+        /// number of invocations of the SPLIT_TABLET RPC
+        RawMetric split_tabletCount;
+        /// number of invocations of the GET_SERVER_STATISTICS RPC
+        RawMetric get_server_statisticsCount;
+        /// number of invocations of the SET_RUNTIME_OPTION RPC
+        RawMetric set_runtime_optionCount;
+        /// number of invocations of the GET_SERVER_CONFIG RPC
+        RawMetric get_server_configCount;
+        /// number of invocations of the GET_BACKUP_CONFIG RPC
+        RawMetric get_backup_configCount;
+        /// number of invocations of RPC 54 (undefined)
+        RawMetric rpc54Count;
+        /// number of invocations of the GET_MASTER_CONFIG RPC
+        RawMetric get_master_configCount;
+        /// number of invocations of the GET_LOG_METRICS RPC
+        RawMetric get_log_metricsCount;
+        /// number of invocations of the VERIFY_MEMBERSHIP RPC
+        RawMetric verify_membershipCount;
+        /// number of invocations of the GET_RUNTIME_OPTION RPC
+        RawMetric get_runtime_optionCount;
+        /// number of invocations of the GET_LEASE_INFO RPC
+        RawMetric get_lease_infoCount;
+        /// number of invocations of the RENEW_LEASE RPC
+        RawMetric renew_leaseCount;
+        /// number of invocations of the SERVER_CONTROL RPC
+        RawMetric server_controlCount;
+        /// number of invocations of the SERVER_CONTROL_ALL RPC
+        RawMetric server_control_allCount;
+        /// number of invocations of the GET_SERVER_ID RPC
+        RawMetric get_server_idCount;
+        /// number of invocations of the READ_KEYS_AND_VALUE RPC
+        RawMetric read_keys_and_valueCount;
+        /// number of invocations of the LOOKUP_INDEX_KEYS RPC
+        RawMetric lookup_index_keysCount;
+        /// number of invocations of the READ_HASHES RPC
+        RawMetric read_hashesCount;
+        /// number of invocations of the INSERT_INDEX_ENTRY RPC
+        RawMetric insert_index_entryCount;
+        /// number of invocations of the REMOVE_INDEX_ENTRY RPC
+        RawMetric remove_index_entryCount;
+        /// number of invocations of the CREATE_INDEX RPC
+        RawMetric create_indexCount;
+        /// number of invocations of the DROP_INDEX RPC
+        RawMetric drop_indexCount;
+        /// number of invocations of the DROP_INDEXLET_OWNERSHIP RPC
+        RawMetric drop_indexlet_ownershipCount;
+        /// number of invocations of the TAKE_INDEXLET_OWNERSHIP RPC
+        RawMetric take_indexlet_ownershipCount;
+        /// number of invocations of the PREP_FOR_INDEXLET_MIGRATION RPC
+        RawMetric prep_for_indexlet_migrationCount;
+        /// number of invocations of the SPLIT_AND_MIGRATE_INDEXLET RPC
+        RawMetric split_and_migrate_indexletCount;
+        /// number of invocations of the COORD_SPLIT_AND_MIGRATE_INDEXLET RPC
+        RawMetric coord_split_and_migrate_indexletCount;
+        /// number of invocations of the TX_DECISION RPC
+        RawMetric tx_decisionCount;
+        /// number of invocations of the TX_PREPARE RPC
+        RawMetric tx_prepareCount;
+        /// number of invocations of the TX_REQUEST_ABORT RPC
+        RawMetric tx_request_abortCount;
+        /// number of invocations of the TX_HINT_FAILED RPC
+        RawMetric tx_hint_failedCount;
+        /// number of invocations of the ECHO RPC
+        RawMetric echoCount;
+        /// number of invocations of the LOOKUP_INDEX_OBJECTS RPC
+        RawMetric lookup_index_objectsCount;
+        /// number of invocations of the GET_WITNESSES RPC
+        RawMetric get_witnessesCount;
+        /// number of invocations of the WITNESS_RECORD RPC
+        RawMetric witness_recordCount;
+        /// number of invocations of the WITNESS_GC RPC
+        RawMetric witness_gcCount;
+        /// number of invocations of the WITNESS_GET_RECOVERY_DATA RPC
+        RawMetric witness_get_recovery_dataCount;
+        /// number of invocations of the ILLEGAL_RPC_TYPE RPC
+        RawMetric illegal_rpc_typeCount;
+        /// time spent executing RPC 0 (undefined)
+        RawMetric rpc0Ticks;
+        /// time spent executing RPC 1 (undefined)
+        RawMetric rpc1Ticks;
+        /// time spent executing RPC 2 (undefined)
+        RawMetric rpc2Ticks;
+        /// time spent executing RPC 3 (undefined)
+        RawMetric rpc3Ticks;
+        /// time spent executing RPC 4 (undefined)
+        RawMetric rpc4Ticks;
+        /// time spent executing RPC 5 (undefined)
+        RawMetric rpc5Ticks;
+        /// time spent executing RPC 6 (undefined)
+        RawMetric rpc6Ticks;
+        /// time spent executing the PING RPC
+        RawMetric pingTicks;
+        /// time spent executing the PROXY_PING RPC
+        RawMetric proxy_pingTicks;
+        /// time spent executing the KILL RPC
+        RawMetric killTicks;
+        /// time spent executing the CREATE_TABLE RPC
+        RawMetric create_tableTicks;
+        /// time spent executing the GET_TABLE_ID RPC
+        RawMetric get_table_idTicks;
+        /// time spent executing the DROP_TABLE RPC
+        RawMetric drop_tableTicks;
+        /// time spent executing the READ RPC
+        RawMetric readTicks;
+        /// time spent executing the WRITE RPC
+        RawMetric writeTicks;
+        /// time spent executing the REMOVE RPC
+        RawMetric removeTicks;
+        /// time spent executing the ENLIST_SERVER RPC
+        RawMetric enlist_serverTicks;
+        /// time spent executing the GET_SERVER_LIST RPC
+        RawMetric get_server_listTicks;
+        /// time spent executing the GET_TABLE_CONFIG RPC
+        RawMetric get_table_configTicks;
+        /// time spent executing the RECOVER RPC
+        RawMetric recoverTicks;
+        /// time spent executing the HINT_SERVER_CRASHED RPC
+        RawMetric hint_server_crashedTicks;
+        /// time spent executing the RECOVERY_MASTER_FINISHED RPC
+        RawMetric recovery_master_finishedTicks;
+        /// time spent executing the ENUMERATE RPC
+        RawMetric enumerateTicks;
+        /// time spent executing the SET_MASTER_RECOVERY_INFO RPC
+        RawMetric set_master_recovery_infoTicks;
+        /// time spent executing the FILL_WITH_TEST_DATA RPC
+        RawMetric fill_with_test_dataTicks;
+        /// time spent executing the MULTI_OP RPC
+        RawMetric multi_opTicks;
+        /// time spent executing the GET_METRICS RPC
+        RawMetric get_metricsTicks;
+        /// time spent executing RPC 27 (undefined)
+        RawMetric rpc27Ticks;
+        /// time spent executing the BACKUP_FREE RPC
+        RawMetric backup_freeTicks;
+        /// time spent executing the BACKUP_GETRECOVERYDATA RPC
+        RawMetric backup_getrecoverydataTicks;
+        /// time spent executing RPC 30 (undefined)
+        RawMetric rpc30Ticks;
+        /// time spent executing the BACKUP_STARTREADINGDATA RPC
+        RawMetric backup_startreadingdataTicks;
+        /// time spent executing the BACKUP_WRITE RPC
+        RawMetric backup_writeTicks;
+        /// time spent executing the BACKUP_RECOVERYCOMPLETE RPC
+        RawMetric backup_recoverycompleteTicks;
+        /// time spent executing RPC 34 (undefined)
+        RawMetric rpc34Ticks;
+        /// time spent executing the UPDATE_SERVER_LIST RPC
+        RawMetric update_server_listTicks;
+        /// time spent executing the BACKUP_STARTPARTITION RPC
+        RawMetric backup_startpartitionTicks;
+        /// time spent executing RPC 37 (undefined)
+        RawMetric rpc37Ticks;
+        /// time spent executing RPC 38 (undefined)
+        RawMetric rpc38Ticks;
+        /// time spent executing the DROP_TABLET_OWNERSHIP RPC
+        RawMetric drop_tablet_ownershipTicks;
+        /// time spent executing the TAKE_TABLET_OWNERSHIP RPC
+        RawMetric take_tablet_ownershipTicks;
+        /// time spent executing RPC 41 (undefined)
+        RawMetric rpc41Ticks;
+        /// time spent executing the GET_HEAD_OF_LOG RPC
+        RawMetric get_head_of_logTicks;
+        /// time spent executing the INCREMENT RPC
+        RawMetric incrementTicks;
+        /// time spent executing the PREP_FOR_MIGRATION RPC
+        RawMetric prep_for_migrationTicks;
+        /// time spent executing the RECEIVE_MIGRATION_DATA RPC
+        RawMetric receive_migration_dataTicks;
+        /// time spent executing the REASSIGN_TABLET_OWNERSHIP RPC
+        RawMetric reassign_tablet_ownershipTicks;
+        /// time spent executing the MIGRATE_TABLET RPC
+        RawMetric migrate_tabletTicks;
+        /// time spent executing the IS_REPLICA_NEEDED RPC
+        RawMetric is_replica_neededTicks;
+        /// time spent executing the SPLIT_TABLET RPC
+        RawMetric split_tabletTicks;
+        /// time spent executing the GET_SERVER_STATISTICS RPC
+        RawMetric get_server_statisticsTicks;
+        /// time spent executing the SET_RUNTIME_OPTION RPC
+        RawMetric set_runtime_optionTicks;
+        /// time spent executing the GET_SERVER_CONFIG RPC
+        RawMetric get_server_configTicks;
+        /// time spent executing the GET_BACKUP_CONFIG RPC
+        RawMetric get_backup_configTicks;
+        /// time spent executing RPC 54 (undefined)
+        RawMetric rpc54Ticks;
+        /// time spent executing the GET_MASTER_CONFIG RPC
+        RawMetric get_master_configTicks;
+        /// time spent executing the GET_LOG_METRICS RPC
+        RawMetric get_log_metricsTicks;
+        /// time spent executing the VERIFY_MEMBERSHIP RPC
+        RawMetric verify_membershipTicks;
+        /// time spent executing the GET_RUNTIME_OPTION RPC
+        RawMetric get_runtime_optionTicks;
+        /// time spent executing the GET_LEASE_INFO RPC
+        RawMetric get_lease_infoTicks;
+        /// time spent executing the RENEW_LEASE RPC
+        RawMetric renew_leaseTicks;
+        /// time spent executing the SERVER_CONTROL RPC
+        RawMetric server_controlTicks;
+        /// time spent executing the SERVER_CONTROL_ALL RPC
+        RawMetric server_control_allTicks;
+        /// time spent executing the GET_SERVER_ID RPC
+        RawMetric get_server_idTicks;
+        /// time spent executing the READ_KEYS_AND_VALUE RPC
+        RawMetric read_keys_and_valueTicks;
+        /// time spent executing the LOOKUP_INDEX_KEYS RPC
+        RawMetric lookup_index_keysTicks;
+        /// time spent executing the READ_HASHES RPC
+        RawMetric read_hashesTicks;
+        /// time spent executing the INSERT_INDEX_ENTRY RPC
+        RawMetric insert_index_entryTicks;
+        /// time spent executing the REMOVE_INDEX_ENTRY RPC
+        RawMetric remove_index_entryTicks;
+        /// time spent executing the CREATE_INDEX RPC
+        RawMetric create_indexTicks;
+        /// time spent executing the DROP_INDEX RPC
+        RawMetric drop_indexTicks;
+        /// time spent executing the DROP_INDEXLET_OWNERSHIP RPC
+        RawMetric drop_indexlet_ownershipTicks;
+        /// time spent executing the TAKE_INDEXLET_OWNERSHIP RPC
+        RawMetric take_indexlet_ownershipTicks;
+        /// time spent executing the PREP_FOR_INDEXLET_MIGRATION RPC
+        RawMetric prep_for_indexlet_migrationTicks;
+        /// time spent executing the SPLIT_AND_MIGRATE_INDEXLET RPC
+        RawMetric split_and_migrate_indexletTicks;
+        /// time spent executing the COORD_SPLIT_AND_MIGRATE_INDEXLET RPC
+        RawMetric coord_split_and_migrate_indexletTicks;
+        /// time spent executing the TX_DECISION RPC
+        RawMetric tx_decisionTicks;
+        /// time spent executing the TX_PREPARE RPC
+        RawMetric tx_prepareTicks;
+        /// time spent executing the TX_REQUEST_ABORT RPC
+        RawMetric tx_request_abortTicks;
+        /// time spent executing the TX_HINT_FAILED RPC
+        RawMetric tx_hint_failedTicks;
+        /// time spent executing the ECHO RPC
+        RawMetric echoTicks;
+        /// time spent executing the LOOKUP_INDEX_OBJECTS RPC
+        RawMetric lookup_index_objectsTicks;
+        /// time spent executing the GET_WITNESSES RPC
+        RawMetric get_witnessesTicks;
+        /// time spent executing the WITNESS_RECORD RPC
+        RawMetric witness_recordTicks;
+        /// time spent executing the WITNESS_GC RPC
+        RawMetric witness_gcTicks;
+        /// time spent executing the WITNESS_GET_RECOVERY_DATA RPC
+        RawMetric witness_get_recovery_dataTicks;
+        /// time spent executing the ILLEGAL_RPC_TYPE RPC
+        RawMetric illegal_rpc_typeTicks;
+    } rpc;
+    /// transport metrics
+    struct Transport {
+        Transport()
+            : transmit()
+            , receive()
+            , infiniband()
+            , sessionOpenTicks(0)
+            , sessionOpenCount(0)
+            , sessionOpenSquaredTicks(0)
+            , retrySessionOpenCount(0)
+            , clientRpcsActiveTicks(0) {}
+        /// metrics related to transmitting messages
+        struct Transmit {
+            Transmit()
+                : ticks(0)
+                , messageCount(0)
+                , packetCount(0)
+                , iovecCount(0)
+                , byteCount(0)
+                , copyTicks(0)
+                , dmaTicks(0) {}
+            /// elapsed time transmitting messages
+            RawMetric ticks;
+            /// number of messages transmitted
+            RawMetric messageCount;
+            /// number of packets transmitted
+            RawMetric packetCount;
+            /// number of Buffer chunks transmitted
+            RawMetric iovecCount;
+            /// number of bytes transmitted
+            RawMetric byteCount;
+            /// elapsed time copying messages
+            RawMetric copyTicks;
+            /// elapsed time waiting for DMA to HCA
+            RawMetric dmaTicks;
+        } transmit;
+        /// metrics related to receiving messages
+        struct Receive {
+            Receive()
+                : ticks(0)
+                , messageCount(0)
+                , packetCount(0)
+                , iovecCount(0)
+                , byteCount(0) {}
+            /// elapsed time receiving messages
+            RawMetric ticks;
+            /// number of messages received
+            RawMetric messageCount;
+            /// number of packets received
+            RawMetric packetCount;
+            /// number of Buffer chunks received
+            RawMetric iovecCount;
+            /// number of bytes received
+            RawMetric byteCount;
+        } receive;
+        /// metrics for Infiniband networking
+        struct Infiniband {
+            Infiniband()
+                : transmitActiveTicks(0) {}
+            /// time with packets on the transmit queue
+            RawMetric transmitActiveTicks;
+        } infiniband;
+        /// time opening sessions for RPCs
+        RawMetric sessionOpenTicks;
+        /// number of sessions opened for RPCs
+        RawMetric sessionOpenCount;
+        /// used for calculating the standard deviation of sessionOpenTicks
+        RawMetric sessionOpenSquaredTicks;
+        /// member of timeouts during session open
+        RawMetric retrySessionOpenCount;
+        /// time with a client RPC active on the network
+        RawMetric clientRpcsActiveTicks;
+    } transport;
+    /// metrics for temporary use
+    struct Temp {
+        Temp()
+            : ticks0(0)
+            , count0(0)
+            , ticks1(0)
+            , count1(0)
+            , ticks2(0)
+            , count2(0)
+            , ticks3(0)
+            , count3(0)
+            , ticks4(0)
+            , count4(0)
+            , ticks5(0)
+            , count5(0)
+            , ticks6(0)
+            , count6(0)
+            , ticks7(0)
+            , count7(0)
+            , ticks8(0)
+            , count8(0)
+            , ticks9(0)
+            , count9(0) {}
+        /// amount of time for some undefined activity
+        RawMetric ticks0;
+        /// number of occurrences of some undefined event
+        RawMetric count0;
+        /// amount of time for some undefined activity
+        RawMetric ticks1;
+        /// number of occurrences of some undefined event
+        RawMetric count1;
+        /// amount of time for some undefined activity
+        RawMetric ticks2;
+        /// number of occurrences of some undefined event
+        RawMetric count2;
+        /// amount of time for some undefined activity
+        RawMetric ticks3;
+        /// number of occurrences of some undefined event
+        RawMetric count3;
+        /// amount of time for some undefined activity
+        RawMetric ticks4;
+        /// number of occurrences of some undefined event
+        RawMetric count4;
+        /// amount of time for some undefined activity
+        RawMetric ticks5;
+        /// number of occurrences of some undefined event
+        RawMetric count5;
+        /// amount of time for some undefined activity
+        RawMetric ticks6;
+        /// number of occurrences of some undefined event
+        RawMetric count6;
+        /// amount of time for some undefined activity
+        RawMetric ticks7;
+        /// number of occurrences of some undefined event
+        RawMetric count7;
+        /// amount of time for some undefined activity
+        RawMetric ticks8;
+        /// number of occurrences of some undefined event
+        RawMetric count8;
+        /// amount of time for some undefined activity
+        RawMetric ticks9;
+        /// number of occurrences of some undefined event
+        RawMetric count9;
+    } temp;
+    /// server id assigned by coordinator
+    RawMetric serverId;
+    /// process ID on machine
+    RawMetric pid;
+    /// cycles per second for the cpu
+    RawMetric clockFrequency;
+    /// size in bytes of segments
+    RawMetric segmentSize;
+    /// time spent by the entire process in user code according to the kernel
+    RawMetric processSystemTicks;
+    /// time spent by the entire process in kernel code according to the kernel
+    RawMetric processUserTicks;
+    /// time elapsed since the process was started
+    RawMetric uptimeTicks;
+    static const int numMetrics = 291;
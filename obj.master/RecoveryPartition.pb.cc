@@ -0,0 +1,333 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RecoveryPartition.proto
+
+#include "RecoveryPartition.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace RAMCloud {
+namespace ProtoBuf {
+PROTOBUF_CONSTEXPR RecoveryPartition::RecoveryPartition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tablet_)*/{}
+  , /*decltype(_impl_.indexlet_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RecoveryPartitionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RecoveryPartitionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RecoveryPartitionDefaultTypeInternal() {}
+  union {
+    RecoveryPartition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RecoveryPartitionDefaultTypeInternal _RecoveryPartition_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+static ::_pb::Metadata file_level_metadata_RecoveryPartition_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_RecoveryPartition_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_RecoveryPartition_2eproto = nullptr;
+
+const uint32_t TableStruct_RecoveryPartition_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::RecoveryPartition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::RecoveryPartition, _impl_.tablet_),
+  PROTOBUF_FIELD_OFFSET(::RAMCloud::ProtoBuf::RecoveryPartition, _impl_.indexlet_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::RAMCloud::ProtoBuf::RecoveryPartition)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::RAMCloud::ProtoBuf::_RecoveryPartition_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_RecoveryPartition_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027RecoveryPartition.proto\022\021RAMCloud.Prot"
+  "oBuf\032\rTablets.proto\032\016Indexlet.proto\"u\n\021R"
+  "ecoveryPartition\0221\n\006tablet\030\001 \003(\0132!.RAMCl"
+  "oud.ProtoBuf.Tablets.Tablet\022-\n\010indexlet\030"
+  "\002 \003(\0132\033.RAMCloud.ProtoBuf.Indexlet"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_RecoveryPartition_2eproto_deps[2] = {
+  &::descriptor_table_Indexlet_2eproto,
+  &::descriptor_table_Tablets_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_RecoveryPartition_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_RecoveryPartition_2eproto = {
+    false, false, 194, descriptor_table_protodef_RecoveryPartition_2eproto,
+    "RecoveryPartition.proto",
+    &descriptor_table_RecoveryPartition_2eproto_once, descriptor_table_RecoveryPartition_2eproto_deps, 2, 1,
+    schemas, file_default_instances, TableStruct_RecoveryPartition_2eproto::offsets,
+    file_level_metadata_RecoveryPartition_2eproto, file_level_enum_descriptors_RecoveryPartition_2eproto,
+    file_level_service_descriptors_RecoveryPartition_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_RecoveryPartition_2eproto_getter() {
+  return &descriptor_table_RecoveryPartition_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_RecoveryPartition_2eproto(&descriptor_table_RecoveryPartition_2eproto);
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class RecoveryPartition::_Internal {
+ public:
+};
+
+void RecoveryPartition::clear_tablet() {
+  _impl_.tablet_.Clear();
+}
+void RecoveryPartition::clear_indexlet() {
+  _impl_.indexlet_.Clear();
+}
+RecoveryPartition::RecoveryPartition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:RAMCloud.ProtoBuf.RecoveryPartition)
+}
+RecoveryPartition::RecoveryPartition(const RecoveryPartition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RecoveryPartition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tablet_){from._impl_.tablet_}
+    , decltype(_impl_.indexlet_){from._impl_.indexlet_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:RAMCloud.ProtoBuf.RecoveryPartition)
+}
+
+inline void RecoveryPartition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tablet_){arena}
+    , decltype(_impl_.indexlet_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RecoveryPartition::~RecoveryPartition() {
+  // @@protoc_insertion_point(destructor:RAMCloud.ProtoBuf.RecoveryPartition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RecoveryPartition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tablet_.~RepeatedPtrField();
+  _impl_.indexlet_.~RepeatedPtrField();
+}
+
+void RecoveryPartition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RecoveryPartition::Clear() {
+// @@protoc_insertion_point(message_clear_start:RAMCloud.ProtoBuf.RecoveryPartition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.tablet_.Clear();
+  _impl_.indexlet_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RecoveryPartition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_tablet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .RAMCloud.ProtoBuf.Indexlet indexlet = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_indexlet(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RecoveryPartition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:RAMCloud.ProtoBuf.RecoveryPartition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tablet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tablet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Indexlet indexlet = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_indexlet_size()); i < n; i++) {
+    const auto& repfield = this->_internal_indexlet(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:RAMCloud.ProtoBuf.RecoveryPartition)
+  return target;
+}
+
+size_t RecoveryPartition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:RAMCloud.ProtoBuf.RecoveryPartition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .RAMCloud.ProtoBuf.Tablets.Tablet tablet = 1;
+  total_size += 1UL * this->_internal_tablet_size();
+  for (const auto& msg : this->_impl_.tablet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .RAMCloud.ProtoBuf.Indexlet indexlet = 2;
+  total_size += 1UL * this->_internal_indexlet_size();
+  for (const auto& msg : this->_impl_.indexlet_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RecoveryPartition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RecoveryPartition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RecoveryPartition::GetClassData() const { return &_class_data_; }
+
+
+void RecoveryPartition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RecoveryPartition*>(&to_msg);
+  auto& from = static_cast<const RecoveryPartition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:RAMCloud.ProtoBuf.RecoveryPartition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.tablet_.MergeFrom(from._impl_.tablet_);
+  _this->_impl_.indexlet_.MergeFrom(from._impl_.indexlet_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RecoveryPartition::CopyFrom(const RecoveryPartition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:RAMCloud.ProtoBuf.RecoveryPartition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RecoveryPartition::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.tablet_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.indexlet_))
+    return false;
+  return true;
+}
+
+void RecoveryPartition::InternalSwap(RecoveryPartition* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tablet_.InternalSwap(&other->_impl_.tablet_);
+  _impl_.indexlet_.InternalSwap(&other->_impl_.indexlet_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RecoveryPartition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_RecoveryPartition_2eproto_getter, &descriptor_table_RecoveryPartition_2eproto_once,
+      file_level_metadata_RecoveryPartition_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::RAMCloud::ProtoBuf::RecoveryPartition*
+Arena::CreateMaybeMessage< ::RAMCloud::ProtoBuf::RecoveryPartition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::RAMCloud::ProtoBuf::RecoveryPartition >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
+// RAMCloud pragma [GCCWARN=0]
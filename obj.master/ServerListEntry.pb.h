@@ -0,0 +1,992 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ServerListEntry.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ServerListEntry_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ServerListEntry_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "MasterRecoveryInfo.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ServerListEntry_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ServerListEntry_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ServerListEntry_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class ServerListEntry;
+struct ServerListEntryDefaultTypeInternal;
+extern ServerListEntryDefaultTypeInternal _ServerListEntry_default_instance_;
+class ServerListEntry_Update;
+struct ServerListEntry_UpdateDefaultTypeInternal;
+extern ServerListEntry_UpdateDefaultTypeInternal _ServerListEntry_Update_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::ServerListEntry* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerListEntry>(Arena*);
+template<> ::RAMCloud::ProtoBuf::ServerListEntry_Update* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::ServerListEntry_Update>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class ServerListEntry_Update final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerListEntry.Update) */ {
+ public:
+  inline ServerListEntry_Update() : ServerListEntry_Update(nullptr) {}
+  ~ServerListEntry_Update() override;
+  explicit PROTOBUF_CONSTEXPR ServerListEntry_Update(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerListEntry_Update(const ServerListEntry_Update& from);
+  ServerListEntry_Update(ServerListEntry_Update&& from) noexcept
+    : ServerListEntry_Update() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerListEntry_Update& operator=(const ServerListEntry_Update& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerListEntry_Update& operator=(ServerListEntry_Update&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerListEntry_Update& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerListEntry_Update* internal_default_instance() {
+    return reinterpret_cast<const ServerListEntry_Update*>(
+               &_ServerListEntry_Update_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ServerListEntry_Update& a, ServerListEntry_Update& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerListEntry_Update* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerListEntry_Update* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerListEntry_Update* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerListEntry_Update>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerListEntry_Update& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerListEntry_Update& from) {
+    ServerListEntry_Update::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerListEntry_Update* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerListEntry.Update";
+  }
+  protected:
+  explicit ServerListEntry_Update(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 2,
+    kSequenceNumberFieldNumber = 3,
+    kStatusFieldNumber = 1,
+  };
+  // required uint64 version = 2;
+  bool has_version() const;
+  private:
+  bool _internal_has_version() const;
+  public:
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // required uint64 sequence_number = 3;
+  bool has_sequence_number() const;
+  private:
+  bool _internal_has_sequence_number() const;
+  public:
+  void clear_sequence_number();
+  uint64_t sequence_number() const;
+  void set_sequence_number(uint64_t value);
+  private:
+  uint64_t _internal_sequence_number() const;
+  void _internal_set_sequence_number(uint64_t value);
+  public:
+
+  // required fixed32 status = 1;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  uint32_t status() const;
+  void set_status(uint32_t value);
+  private:
+  uint32_t _internal_status() const;
+  void _internal_set_status(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerListEntry.Update)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t version_;
+    uint64_t sequence_number_;
+    uint32_t status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerListEntry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerListEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.ServerListEntry) */ {
+ public:
+  inline ServerListEntry() : ServerListEntry(nullptr) {}
+  ~ServerListEntry() override;
+  explicit PROTOBUF_CONSTEXPR ServerListEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerListEntry(const ServerListEntry& from);
+  ServerListEntry(ServerListEntry&& from) noexcept
+    : ServerListEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerListEntry& operator=(const ServerListEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerListEntry& operator=(ServerListEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerListEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerListEntry* internal_default_instance() {
+    return reinterpret_cast<const ServerListEntry*>(
+               &_ServerListEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(ServerListEntry& a, ServerListEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerListEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerListEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerListEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerListEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerListEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerListEntry& from) {
+    ServerListEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerListEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.ServerListEntry";
+  }
+  protected:
+  explicit ServerListEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ServerListEntry_Update Update;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdateFieldNumber = 8,
+    kServiceLocatorFieldNumber = 3,
+    kMasterRecoveryInfoFieldNumber = 7,
+    kServerIdFieldNumber = 2,
+    kServicesFieldNumber = 1,
+    kExpectedReadMbytesPerSecFieldNumber = 4,
+    kReplicationIdFieldNumber = 6,
+    kStatusFieldNumber = 5,
+  };
+  // repeated .RAMCloud.ProtoBuf.ServerListEntry.Update update = 8;
+  int update_size() const;
+  private:
+  int _internal_update_size() const;
+  public:
+  void clear_update();
+  ::RAMCloud::ProtoBuf::ServerListEntry_Update* mutable_update(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerListEntry_Update >*
+      mutable_update();
+  private:
+  const ::RAMCloud::ProtoBuf::ServerListEntry_Update& _internal_update(int index) const;
+  ::RAMCloud::ProtoBuf::ServerListEntry_Update* _internal_add_update();
+  public:
+  const ::RAMCloud::ProtoBuf::ServerListEntry_Update& update(int index) const;
+  ::RAMCloud::ProtoBuf::ServerListEntry_Update* add_update();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerListEntry_Update >&
+      update() const;
+
+  // required string service_locator = 3;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+  bool has_master_recovery_info() const;
+  private:
+  bool _internal_has_master_recovery_info() const;
+  public:
+  void clear_master_recovery_info();
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& master_recovery_info() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::MasterRecoveryInfo* release_master_recovery_info();
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* mutable_master_recovery_info();
+  void set_allocated_master_recovery_info(::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info);
+  private:
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& _internal_master_recovery_info() const;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* _internal_mutable_master_recovery_info();
+  public:
+  void unsafe_arena_set_allocated_master_recovery_info(
+      ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info);
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* unsafe_arena_release_master_recovery_info();
+
+  // required fixed64 server_id = 2;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required fixed32 services = 1;
+  bool has_services() const;
+  private:
+  bool _internal_has_services() const;
+  public:
+  void clear_services();
+  uint32_t services() const;
+  void set_services(uint32_t value);
+  private:
+  uint32_t _internal_services() const;
+  void _internal_set_services(uint32_t value);
+  public:
+
+  // required fixed32 expected_read_mbytes_per_sec = 4;
+  bool has_expected_read_mbytes_per_sec() const;
+  private:
+  bool _internal_has_expected_read_mbytes_per_sec() const;
+  public:
+  void clear_expected_read_mbytes_per_sec();
+  uint32_t expected_read_mbytes_per_sec() const;
+  void set_expected_read_mbytes_per_sec(uint32_t value);
+  private:
+  uint32_t _internal_expected_read_mbytes_per_sec() const;
+  void _internal_set_expected_read_mbytes_per_sec(uint32_t value);
+  public:
+
+  // required fixed64 replication_id = 6;
+  bool has_replication_id() const;
+  private:
+  bool _internal_has_replication_id() const;
+  public:
+  void clear_replication_id();
+  uint64_t replication_id() const;
+  void set_replication_id(uint64_t value);
+  private:
+  uint64_t _internal_replication_id() const;
+  void _internal_set_replication_id(uint64_t value);
+  public:
+
+  // required fixed32 status = 5;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  uint32_t status() const;
+  void set_status(uint32_t value);
+  private:
+  uint32_t _internal_status() const;
+  void _internal_set_status(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.ServerListEntry)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerListEntry_Update > update_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info_;
+    uint64_t server_id_;
+    uint32_t services_;
+    uint32_t expected_read_mbytes_per_sec_;
+    uint64_t replication_id_;
+    uint32_t status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ServerListEntry_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ServerListEntry_Update
+
+// required fixed32 status = 1;
+inline bool ServerListEntry_Update::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerListEntry_Update::has_status() const {
+  return _internal_has_status();
+}
+inline void ServerListEntry_Update::clear_status() {
+  _impl_.status_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t ServerListEntry_Update::_internal_status() const {
+  return _impl_.status_;
+}
+inline uint32_t ServerListEntry_Update::status() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.Update.status)
+  return _internal_status();
+}
+inline void ServerListEntry_Update::_internal_set_status(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.status_ = value;
+}
+inline void ServerListEntry_Update::set_status(uint32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.Update.status)
+}
+
+// required uint64 version = 2;
+inline bool ServerListEntry_Update::_internal_has_version() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerListEntry_Update::has_version() const {
+  return _internal_has_version();
+}
+inline void ServerListEntry_Update::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t ServerListEntry_Update::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t ServerListEntry_Update::version() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.Update.version)
+  return _internal_version();
+}
+inline void ServerListEntry_Update::_internal_set_version(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.version_ = value;
+}
+inline void ServerListEntry_Update::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.Update.version)
+}
+
+// required uint64 sequence_number = 3;
+inline bool ServerListEntry_Update::_internal_has_sequence_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ServerListEntry_Update::has_sequence_number() const {
+  return _internal_has_sequence_number();
+}
+inline void ServerListEntry_Update::clear_sequence_number() {
+  _impl_.sequence_number_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t ServerListEntry_Update::_internal_sequence_number() const {
+  return _impl_.sequence_number_;
+}
+inline uint64_t ServerListEntry_Update::sequence_number() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.Update.sequence_number)
+  return _internal_sequence_number();
+}
+inline void ServerListEntry_Update::_internal_set_sequence_number(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sequence_number_ = value;
+}
+inline void ServerListEntry_Update::set_sequence_number(uint64_t value) {
+  _internal_set_sequence_number(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.Update.sequence_number)
+}
+
+// -------------------------------------------------------------------
+
+// ServerListEntry
+
+// required fixed32 services = 1;
+inline bool ServerListEntry::_internal_has_services() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_services() const {
+  return _internal_has_services();
+}
+inline void ServerListEntry::clear_services() {
+  _impl_.services_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t ServerListEntry::_internal_services() const {
+  return _impl_.services_;
+}
+inline uint32_t ServerListEntry::services() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.services)
+  return _internal_services();
+}
+inline void ServerListEntry::_internal_set_services(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.services_ = value;
+}
+inline void ServerListEntry::set_services(uint32_t value) {
+  _internal_set_services(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.services)
+}
+
+// required fixed64 server_id = 2;
+inline bool ServerListEntry::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void ServerListEntry::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t ServerListEntry::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t ServerListEntry::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.server_id)
+  return _internal_server_id();
+}
+inline void ServerListEntry::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_id_ = value;
+}
+inline void ServerListEntry::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.server_id)
+}
+
+// required string service_locator = 3;
+inline bool ServerListEntry::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void ServerListEntry::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ServerListEntry::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ServerListEntry::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.service_locator)
+}
+inline std::string* ServerListEntry::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerListEntry.service_locator)
+  return _s;
+}
+inline const std::string& ServerListEntry::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void ServerListEntry::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ServerListEntry::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ServerListEntry::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerListEntry.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ServerListEntry::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerListEntry.service_locator)
+}
+
+// required fixed32 expected_read_mbytes_per_sec = 4;
+inline bool ServerListEntry::_internal_has_expected_read_mbytes_per_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_expected_read_mbytes_per_sec() const {
+  return _internal_has_expected_read_mbytes_per_sec();
+}
+inline void ServerListEntry::clear_expected_read_mbytes_per_sec() {
+  _impl_.expected_read_mbytes_per_sec_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t ServerListEntry::_internal_expected_read_mbytes_per_sec() const {
+  return _impl_.expected_read_mbytes_per_sec_;
+}
+inline uint32_t ServerListEntry::expected_read_mbytes_per_sec() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.expected_read_mbytes_per_sec)
+  return _internal_expected_read_mbytes_per_sec();
+}
+inline void ServerListEntry::_internal_set_expected_read_mbytes_per_sec(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.expected_read_mbytes_per_sec_ = value;
+}
+inline void ServerListEntry::set_expected_read_mbytes_per_sec(uint32_t value) {
+  _internal_set_expected_read_mbytes_per_sec(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.expected_read_mbytes_per_sec)
+}
+
+// required fixed32 status = 5;
+inline bool ServerListEntry::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_status() const {
+  return _internal_has_status();
+}
+inline void ServerListEntry::clear_status() {
+  _impl_.status_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t ServerListEntry::_internal_status() const {
+  return _impl_.status_;
+}
+inline uint32_t ServerListEntry::status() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.status)
+  return _internal_status();
+}
+inline void ServerListEntry::_internal_set_status(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.status_ = value;
+}
+inline void ServerListEntry::set_status(uint32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.status)
+}
+
+// required fixed64 replication_id = 6;
+inline bool ServerListEntry::_internal_has_replication_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ServerListEntry::has_replication_id() const {
+  return _internal_has_replication_id();
+}
+inline void ServerListEntry::clear_replication_id() {
+  _impl_.replication_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t ServerListEntry::_internal_replication_id() const {
+  return _impl_.replication_id_;
+}
+inline uint64_t ServerListEntry::replication_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.replication_id)
+  return _internal_replication_id();
+}
+inline void ServerListEntry::_internal_set_replication_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.replication_id_ = value;
+}
+inline void ServerListEntry::set_replication_id(uint64_t value) {
+  _internal_set_replication_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.ServerListEntry.replication_id)
+}
+
+// required .RAMCloud.ProtoBuf.MasterRecoveryInfo master_recovery_info = 7;
+inline bool ServerListEntry::_internal_has_master_recovery_info() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.master_recovery_info_ != nullptr);
+  return value;
+}
+inline bool ServerListEntry::has_master_recovery_info() const {
+  return _internal_has_master_recovery_info();
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& ServerListEntry::_internal_master_recovery_info() const {
+  const ::RAMCloud::ProtoBuf::MasterRecoveryInfo* p = _impl_.master_recovery_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::MasterRecoveryInfo&>(
+      ::RAMCloud::ProtoBuf::_MasterRecoveryInfo_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::MasterRecoveryInfo& ServerListEntry::master_recovery_info() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.master_recovery_info)
+  return _internal_master_recovery_info();
+}
+inline void ServerListEntry::unsafe_arena_set_allocated_master_recovery_info(
+    ::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_recovery_info_);
+  }
+  _impl_.master_recovery_info_ = master_recovery_info;
+  if (master_recovery_info) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.ServerListEntry.master_recovery_info)
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerListEntry::release_master_recovery_info() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* temp = _impl_.master_recovery_info_;
+  _impl_.master_recovery_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerListEntry::unsafe_arena_release_master_recovery_info() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.ServerListEntry.master_recovery_info)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* temp = _impl_.master_recovery_info_;
+  _impl_.master_recovery_info_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerListEntry::_internal_mutable_master_recovery_info() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.master_recovery_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::MasterRecoveryInfo>(GetArenaForAllocation());
+    _impl_.master_recovery_info_ = p;
+  }
+  return _impl_.master_recovery_info_;
+}
+inline ::RAMCloud::ProtoBuf::MasterRecoveryInfo* ServerListEntry::mutable_master_recovery_info() {
+  ::RAMCloud::ProtoBuf::MasterRecoveryInfo* _msg = _internal_mutable_master_recovery_info();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerListEntry.master_recovery_info)
+  return _msg;
+}
+inline void ServerListEntry::set_allocated_master_recovery_info(::RAMCloud::ProtoBuf::MasterRecoveryInfo* master_recovery_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.master_recovery_info_);
+  }
+  if (master_recovery_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(master_recovery_info));
+    if (message_arena != submessage_arena) {
+      master_recovery_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, master_recovery_info, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.master_recovery_info_ = master_recovery_info;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.ServerListEntry.master_recovery_info)
+}
+
+// repeated .RAMCloud.ProtoBuf.ServerListEntry.Update update = 8;
+inline int ServerListEntry::_internal_update_size() const {
+  return _impl_.update_.size();
+}
+inline int ServerListEntry::update_size() const {
+  return _internal_update_size();
+}
+inline void ServerListEntry::clear_update() {
+  _impl_.update_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::ServerListEntry_Update* ServerListEntry::mutable_update(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.ServerListEntry.update)
+  return _impl_.update_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerListEntry_Update >*
+ServerListEntry::mutable_update() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.ServerListEntry.update)
+  return &_impl_.update_;
+}
+inline const ::RAMCloud::ProtoBuf::ServerListEntry_Update& ServerListEntry::_internal_update(int index) const {
+  return _impl_.update_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::ServerListEntry_Update& ServerListEntry::update(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.ServerListEntry.update)
+  return _internal_update(index);
+}
+inline ::RAMCloud::ProtoBuf::ServerListEntry_Update* ServerListEntry::_internal_add_update() {
+  return _impl_.update_.Add();
+}
+inline ::RAMCloud::ProtoBuf::ServerListEntry_Update* ServerListEntry::add_update() {
+  ::RAMCloud::ProtoBuf::ServerListEntry_Update* _add = _internal_add_update();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.ServerListEntry.update)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::ServerListEntry_Update >&
+ServerListEntry::update() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.ServerListEntry.update)
+  return _impl_.update_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ServerListEntry_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,665 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SpinLockStatistics.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_SpinLockStatistics_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_SpinLockStatistics_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_SpinLockStatistics_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_SpinLockStatistics_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_SpinLockStatistics_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class SpinLockStatistics;
+struct SpinLockStatisticsDefaultTypeInternal;
+extern SpinLockStatisticsDefaultTypeInternal _SpinLockStatistics_default_instance_;
+class SpinLockStatistics_Lock;
+struct SpinLockStatistics_LockDefaultTypeInternal;
+extern SpinLockStatistics_LockDefaultTypeInternal _SpinLockStatistics_Lock_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::SpinLockStatistics* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::SpinLockStatistics>(Arena*);
+template<> ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::SpinLockStatistics_Lock>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+// ===================================================================
+
+class SpinLockStatistics_Lock final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.SpinLockStatistics.Lock) */ {
+ public:
+  inline SpinLockStatistics_Lock() : SpinLockStatistics_Lock(nullptr) {}
+  ~SpinLockStatistics_Lock() override;
+  explicit PROTOBUF_CONSTEXPR SpinLockStatistics_Lock(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpinLockStatistics_Lock(const SpinLockStatistics_Lock& from);
+  SpinLockStatistics_Lock(SpinLockStatistics_Lock&& from) noexcept
+    : SpinLockStatistics_Lock() {
+    *this = ::std::move(from);
+  }
+
+  inline SpinLockStatistics_Lock& operator=(const SpinLockStatistics_Lock& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpinLockStatistics_Lock& operator=(SpinLockStatistics_Lock&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpinLockStatistics_Lock& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpinLockStatistics_Lock* internal_default_instance() {
+    return reinterpret_cast<const SpinLockStatistics_Lock*>(
+               &_SpinLockStatistics_Lock_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SpinLockStatistics_Lock& a, SpinLockStatistics_Lock& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpinLockStatistics_Lock* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpinLockStatistics_Lock* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpinLockStatistics_Lock* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpinLockStatistics_Lock>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpinLockStatistics_Lock& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpinLockStatistics_Lock& from) {
+    SpinLockStatistics_Lock::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpinLockStatistics_Lock* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.SpinLockStatistics.Lock";
+  }
+  protected:
+  explicit SpinLockStatistics_Lock(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kAcquisitionsFieldNumber = 2,
+    kContendedAcquisitionsFieldNumber = 3,
+    kContendedNsecFieldNumber = 4,
+  };
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required fixed64 acquisitions = 2;
+  bool has_acquisitions() const;
+  private:
+  bool _internal_has_acquisitions() const;
+  public:
+  void clear_acquisitions();
+  uint64_t acquisitions() const;
+  void set_acquisitions(uint64_t value);
+  private:
+  uint64_t _internal_acquisitions() const;
+  void _internal_set_acquisitions(uint64_t value);
+  public:
+
+  // required fixed64 contended_acquisitions = 3;
+  bool has_contended_acquisitions() const;
+  private:
+  bool _internal_has_contended_acquisitions() const;
+  public:
+  void clear_contended_acquisitions();
+  uint64_t contended_acquisitions() const;
+  void set_contended_acquisitions(uint64_t value);
+  private:
+  uint64_t _internal_contended_acquisitions() const;
+  void _internal_set_contended_acquisitions(uint64_t value);
+  public:
+
+  // required fixed64 contended_nsec = 4;
+  bool has_contended_nsec() const;
+  private:
+  bool _internal_has_contended_nsec() const;
+  public:
+  void clear_contended_nsec();
+  uint64_t contended_nsec() const;
+  void set_contended_nsec(uint64_t value);
+  private:
+  uint64_t _internal_contended_nsec() const;
+  void _internal_set_contended_nsec(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.SpinLockStatistics.Lock)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t acquisitions_;
+    uint64_t contended_acquisitions_;
+    uint64_t contended_nsec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SpinLockStatistics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SpinLockStatistics final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.SpinLockStatistics) */ {
+ public:
+  inline SpinLockStatistics() : SpinLockStatistics(nullptr) {}
+  ~SpinLockStatistics() override;
+  explicit PROTOBUF_CONSTEXPR SpinLockStatistics(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SpinLockStatistics(const SpinLockStatistics& from);
+  SpinLockStatistics(SpinLockStatistics&& from) noexcept
+    : SpinLockStatistics() {
+    *this = ::std::move(from);
+  }
+
+  inline SpinLockStatistics& operator=(const SpinLockStatistics& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SpinLockStatistics& operator=(SpinLockStatistics&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SpinLockStatistics& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SpinLockStatistics* internal_default_instance() {
+    return reinterpret_cast<const SpinLockStatistics*>(
+               &_SpinLockStatistics_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SpinLockStatistics& a, SpinLockStatistics& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SpinLockStatistics* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SpinLockStatistics* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SpinLockStatistics* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SpinLockStatistics>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SpinLockStatistics& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SpinLockStatistics& from) {
+    SpinLockStatistics::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SpinLockStatistics* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.SpinLockStatistics";
+  }
+  protected:
+  explicit SpinLockStatistics(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SpinLockStatistics_Lock Lock;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLocksFieldNumber = 1,
+  };
+  // repeated .RAMCloud.ProtoBuf.SpinLockStatistics.Lock locks = 1;
+  int locks_size() const;
+  private:
+  int _internal_locks_size() const;
+  public:
+  void clear_locks();
+  ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* mutable_locks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >*
+      mutable_locks();
+  private:
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock& _internal_locks(int index) const;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* _internal_add_locks();
+  public:
+  const ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock& locks(int index) const;
+  ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* add_locks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >&
+      locks() const;
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.SpinLockStatistics)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock > locks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_SpinLockStatistics_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SpinLockStatistics_Lock
+
+// required string name = 1;
+inline bool SpinLockStatistics_Lock::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SpinLockStatistics_Lock::has_name() const {
+  return _internal_has_name();
+}
+inline void SpinLockStatistics_Lock::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SpinLockStatistics_Lock::name() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SpinLockStatistics_Lock::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name)
+}
+inline std::string* SpinLockStatistics_Lock::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name)
+  return _s;
+}
+inline const std::string& SpinLockStatistics_Lock::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SpinLockStatistics_Lock::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SpinLockStatistics_Lock::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SpinLockStatistics_Lock::release_name() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SpinLockStatistics_Lock::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.name)
+}
+
+// required fixed64 acquisitions = 2;
+inline bool SpinLockStatistics_Lock::_internal_has_acquisitions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SpinLockStatistics_Lock::has_acquisitions() const {
+  return _internal_has_acquisitions();
+}
+inline void SpinLockStatistics_Lock::clear_acquisitions() {
+  _impl_.acquisitions_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SpinLockStatistics_Lock::_internal_acquisitions() const {
+  return _impl_.acquisitions_;
+}
+inline uint64_t SpinLockStatistics_Lock::acquisitions() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.acquisitions)
+  return _internal_acquisitions();
+}
+inline void SpinLockStatistics_Lock::_internal_set_acquisitions(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.acquisitions_ = value;
+}
+inline void SpinLockStatistics_Lock::set_acquisitions(uint64_t value) {
+  _internal_set_acquisitions(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.acquisitions)
+}
+
+// required fixed64 contended_acquisitions = 3;
+inline bool SpinLockStatistics_Lock::_internal_has_contended_acquisitions() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SpinLockStatistics_Lock::has_contended_acquisitions() const {
+  return _internal_has_contended_acquisitions();
+}
+inline void SpinLockStatistics_Lock::clear_contended_acquisitions() {
+  _impl_.contended_acquisitions_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SpinLockStatistics_Lock::_internal_contended_acquisitions() const {
+  return _impl_.contended_acquisitions_;
+}
+inline uint64_t SpinLockStatistics_Lock::contended_acquisitions() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.contended_acquisitions)
+  return _internal_contended_acquisitions();
+}
+inline void SpinLockStatistics_Lock::_internal_set_contended_acquisitions(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.contended_acquisitions_ = value;
+}
+inline void SpinLockStatistics_Lock::set_contended_acquisitions(uint64_t value) {
+  _internal_set_contended_acquisitions(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.contended_acquisitions)
+}
+
+// required fixed64 contended_nsec = 4;
+inline bool SpinLockStatistics_Lock::_internal_has_contended_nsec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SpinLockStatistics_Lock::has_contended_nsec() const {
+  return _internal_has_contended_nsec();
+}
+inline void SpinLockStatistics_Lock::clear_contended_nsec() {
+  _impl_.contended_nsec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SpinLockStatistics_Lock::_internal_contended_nsec() const {
+  return _impl_.contended_nsec_;
+}
+inline uint64_t SpinLockStatistics_Lock::contended_nsec() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.contended_nsec)
+  return _internal_contended_nsec();
+}
+inline void SpinLockStatistics_Lock::_internal_set_contended_nsec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.contended_nsec_ = value;
+}
+inline void SpinLockStatistics_Lock::set_contended_nsec(uint64_t value) {
+  _internal_set_contended_nsec(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.SpinLockStatistics.Lock.contended_nsec)
+}
+
+// -------------------------------------------------------------------
+
+// SpinLockStatistics
+
+// repeated .RAMCloud.ProtoBuf.SpinLockStatistics.Lock locks = 1;
+inline int SpinLockStatistics::_internal_locks_size() const {
+  return _impl_.locks_.size();
+}
+inline int SpinLockStatistics::locks_size() const {
+  return _internal_locks_size();
+}
+inline void SpinLockStatistics::clear_locks() {
+  _impl_.locks_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* SpinLockStatistics::mutable_locks(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.SpinLockStatistics.locks)
+  return _impl_.locks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >*
+SpinLockStatistics::mutable_locks() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.SpinLockStatistics.locks)
+  return &_impl_.locks_;
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock& SpinLockStatistics::_internal_locks(int index) const {
+  return _impl_.locks_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock& SpinLockStatistics::locks(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.SpinLockStatistics.locks)
+  return _internal_locks(index);
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* SpinLockStatistics::_internal_add_locks() {
+  return _impl_.locks_.Add();
+}
+inline ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* SpinLockStatistics::add_locks() {
+  ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock* _add = _internal_add_locks();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.SpinLockStatistics.locks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::SpinLockStatistics_Lock >&
+SpinLockStatistics::locks() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.SpinLockStatistics.locks)
+  return _impl_.locks_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_SpinLockStatistics_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,3106 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: Table.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_Table_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_Table_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_Table_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_Table_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Table_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class Table;
+struct TableDefaultTypeInternal;
+extern TableDefaultTypeInternal _Table_default_instance_;
+class Table_Index;
+struct Table_IndexDefaultTypeInternal;
+extern Table_IndexDefaultTypeInternal _Table_Index_default_instance_;
+class Table_Index_Indexlet;
+struct Table_Index_IndexletDefaultTypeInternal;
+extern Table_Index_IndexletDefaultTypeInternal _Table_Index_Indexlet_default_instance_;
+class Table_Reassign;
+struct Table_ReassignDefaultTypeInternal;
+extern Table_ReassignDefaultTypeInternal _Table_Reassign_default_instance_;
+class Table_ReassignIndexlet;
+struct Table_ReassignIndexletDefaultTypeInternal;
+extern Table_ReassignIndexletDefaultTypeInternal _Table_ReassignIndexlet_default_instance_;
+class Table_Split;
+struct Table_SplitDefaultTypeInternal;
+extern Table_SplitDefaultTypeInternal _Table_Split_default_instance_;
+class Table_Tablet;
+struct Table_TabletDefaultTypeInternal;
+extern Table_TabletDefaultTypeInternal _Table_Tablet_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::Table* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_Index* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Index>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_Index_Indexlet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Index_Indexlet>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_Reassign* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Reassign>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_ReassignIndexlet>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_Split* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Split>(Arena*);
+template<> ::RAMCloud::ProtoBuf::Table_Tablet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Tablet>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+enum Table_Tablet_State : int {
+  Table_Tablet_State_NORMAL = 0,
+  Table_Tablet_State_RECOVERING = 1,
+  Table_Tablet_State_BOGUS = 2
+};
+bool Table_Tablet_State_IsValid(int value);
+constexpr Table_Tablet_State Table_Tablet_State_State_MIN = Table_Tablet_State_NORMAL;
+constexpr Table_Tablet_State Table_Tablet_State_State_MAX = Table_Tablet_State_BOGUS;
+constexpr int Table_Tablet_State_State_ARRAYSIZE = Table_Tablet_State_State_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Table_Tablet_State_descriptor();
+template<typename T>
+inline const std::string& Table_Tablet_State_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Table_Tablet_State>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Table_Tablet_State_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Table_Tablet_State_descriptor(), enum_t_value);
+}
+inline bool Table_Tablet_State_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Table_Tablet_State* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Table_Tablet_State>(
+    Table_Tablet_State_descriptor(), name, value);
+}
+// ===================================================================
+
+class Table_Tablet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.Tablet) */ {
+ public:
+  inline Table_Tablet() : Table_Tablet(nullptr) {}
+  ~Table_Tablet() override;
+  explicit PROTOBUF_CONSTEXPR Table_Tablet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_Tablet(const Table_Tablet& from);
+  Table_Tablet(Table_Tablet&& from) noexcept
+    : Table_Tablet() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_Tablet& operator=(const Table_Tablet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_Tablet& operator=(Table_Tablet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_Tablet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_Tablet* internal_default_instance() {
+    return reinterpret_cast<const Table_Tablet*>(
+               &_Table_Tablet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Table_Tablet& a, Table_Tablet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_Tablet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_Tablet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_Tablet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_Tablet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_Tablet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_Tablet& from) {
+    Table_Tablet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_Tablet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.Tablet";
+  }
+  protected:
+  explicit Table_Tablet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Table_Tablet_State State;
+  static constexpr State NORMAL =
+    Table_Tablet_State_NORMAL;
+  static constexpr State RECOVERING =
+    Table_Tablet_State_RECOVERING;
+  static constexpr State BOGUS =
+    Table_Tablet_State_BOGUS;
+  static inline bool State_IsValid(int value) {
+    return Table_Tablet_State_IsValid(value);
+  }
+  static constexpr State State_MIN =
+    Table_Tablet_State_State_MIN;
+  static constexpr State State_MAX =
+    Table_Tablet_State_State_MAX;
+  static constexpr int State_ARRAYSIZE =
+    Table_Tablet_State_State_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  State_descriptor() {
+    return Table_Tablet_State_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& State_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, State>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function State_Name.");
+    return Table_Tablet_State_Name(enum_t_value);
+  }
+  static inline bool State_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      State* value) {
+    return Table_Tablet_State_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyHashFieldNumber = 1,
+    kEndKeyHashFieldNumber = 2,
+    kServerIdFieldNumber = 4,
+    kStateFieldNumber = 3,
+    kCtimeLogHeadOffsetFieldNumber = 6,
+    kCtimeLogHeadIdFieldNumber = 5,
+  };
+  // required uint64 start_key_hash = 1;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 2;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // required fixed64 server_id = 4;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::RAMCloud::ProtoBuf::Table_Tablet_State state() const;
+  void set_state(::RAMCloud::ProtoBuf::Table_Tablet_State value);
+  private:
+  ::RAMCloud::ProtoBuf::Table_Tablet_State _internal_state() const;
+  void _internal_set_state(::RAMCloud::ProtoBuf::Table_Tablet_State value);
+  public:
+
+  // required uint32 ctime_log_head_offset = 6;
+  bool has_ctime_log_head_offset() const;
+  private:
+  bool _internal_has_ctime_log_head_offset() const;
+  public:
+  void clear_ctime_log_head_offset();
+  uint32_t ctime_log_head_offset() const;
+  void set_ctime_log_head_offset(uint32_t value);
+  private:
+  uint32_t _internal_ctime_log_head_offset() const;
+  void _internal_set_ctime_log_head_offset(uint32_t value);
+  public:
+
+  // required uint64 ctime_log_head_id = 5;
+  bool has_ctime_log_head_id() const;
+  private:
+  bool _internal_has_ctime_log_head_id() const;
+  public:
+  void clear_ctime_log_head_id();
+  uint64_t ctime_log_head_id() const;
+  void set_ctime_log_head_id(uint64_t value);
+  private:
+  uint64_t _internal_ctime_log_head_id() const;
+  void _internal_set_ctime_log_head_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.Tablet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t server_id_;
+    int state_;
+    uint32_t ctime_log_head_offset_;
+    uint64_t ctime_log_head_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table_Split final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.Split) */ {
+ public:
+  inline Table_Split() : Table_Split(nullptr) {}
+  ~Table_Split() override;
+  explicit PROTOBUF_CONSTEXPR Table_Split(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_Split(const Table_Split& from);
+  Table_Split(Table_Split&& from) noexcept
+    : Table_Split() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_Split& operator=(const Table_Split& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_Split& operator=(Table_Split&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_Split& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_Split* internal_default_instance() {
+    return reinterpret_cast<const Table_Split*>(
+               &_Table_Split_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Table_Split& a, Table_Split& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_Split* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_Split* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_Split* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_Split>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_Split& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_Split& from) {
+    Table_Split::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_Split* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.Split";
+  }
+  protected:
+  explicit Table_Split(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerIdFieldNumber = 1,
+    kSplitKeyHashFieldNumber = 2,
+  };
+  // required fixed64 server_id = 1;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required uint64 split_key_hash = 2;
+  bool has_split_key_hash() const;
+  private:
+  bool _internal_has_split_key_hash() const;
+  public:
+  void clear_split_key_hash();
+  uint64_t split_key_hash() const;
+  void set_split_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_split_key_hash() const;
+  void _internal_set_split_key_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.Split)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t server_id_;
+    uint64_t split_key_hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table_Reassign final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.Reassign) */ {
+ public:
+  inline Table_Reassign() : Table_Reassign(nullptr) {}
+  ~Table_Reassign() override;
+  explicit PROTOBUF_CONSTEXPR Table_Reassign(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_Reassign(const Table_Reassign& from);
+  Table_Reassign(Table_Reassign&& from) noexcept
+    : Table_Reassign() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_Reassign& operator=(const Table_Reassign& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_Reassign& operator=(Table_Reassign&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_Reassign& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_Reassign* internal_default_instance() {
+    return reinterpret_cast<const Table_Reassign*>(
+               &_Table_Reassign_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Table_Reassign& a, Table_Reassign& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_Reassign* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_Reassign* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_Reassign* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_Reassign>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_Reassign& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_Reassign& from) {
+    Table_Reassign::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_Reassign* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.Reassign";
+  }
+  protected:
+  explicit Table_Reassign(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServerIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+  };
+  // required fixed64 server_id = 1;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.Reassign)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t server_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table_Index_Indexlet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.Index.Indexlet) */ {
+ public:
+  inline Table_Index_Indexlet() : Table_Index_Indexlet(nullptr) {}
+  ~Table_Index_Indexlet() override;
+  explicit PROTOBUF_CONSTEXPR Table_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_Index_Indexlet(const Table_Index_Indexlet& from);
+  Table_Index_Indexlet(Table_Index_Indexlet&& from) noexcept
+    : Table_Index_Indexlet() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_Index_Indexlet& operator=(const Table_Index_Indexlet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_Index_Indexlet& operator=(Table_Index_Indexlet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_Index_Indexlet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_Index_Indexlet* internal_default_instance() {
+    return reinterpret_cast<const Table_Index_Indexlet*>(
+               &_Table_Index_Indexlet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Table_Index_Indexlet& a, Table_Index_Indexlet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_Index_Indexlet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_Index_Indexlet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_Index_Indexlet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_Index_Indexlet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_Index_Indexlet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_Index_Indexlet& from) {
+    Table_Index_Indexlet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_Index_Indexlet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.Index.Indexlet";
+  }
+  protected:
+  explicit Table_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstKeyFieldNumber = 1,
+    kFirstNotOwnedKeyFieldNumber = 2,
+    kBackingTableIdFieldNumber = 3,
+    kServerIdFieldNumber = 4,
+  };
+  // required string first_key = 1;
+  bool has_first_key() const;
+  private:
+  bool _internal_has_first_key() const;
+  public:
+  void clear_first_key();
+  const std::string& first_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_key();
+  PROTOBUF_NODISCARD std::string* release_first_key();
+  void set_allocated_first_key(std::string* first_key);
+  private:
+  const std::string& _internal_first_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_key(const std::string& value);
+  std::string* _internal_mutable_first_key();
+  public:
+
+  // required string first_not_owned_key = 2;
+  bool has_first_not_owned_key() const;
+  private:
+  bool _internal_has_first_not_owned_key() const;
+  public:
+  void clear_first_not_owned_key();
+  const std::string& first_not_owned_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_not_owned_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_not_owned_key();
+  PROTOBUF_NODISCARD std::string* release_first_not_owned_key();
+  void set_allocated_first_not_owned_key(std::string* first_not_owned_key);
+  private:
+  const std::string& _internal_first_not_owned_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_not_owned_key(const std::string& value);
+  std::string* _internal_mutable_first_not_owned_key();
+  public:
+
+  // required uint64 backing_table_id = 3;
+  bool has_backing_table_id() const;
+  private:
+  bool _internal_has_backing_table_id() const;
+  public:
+  void clear_backing_table_id();
+  uint64_t backing_table_id() const;
+  void set_backing_table_id(uint64_t value);
+  private:
+  uint64_t _internal_backing_table_id() const;
+  void _internal_set_backing_table_id(uint64_t value);
+  public:
+
+  // required fixed64 server_id = 4;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.Index.Indexlet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_not_owned_key_;
+    uint64_t backing_table_id_;
+    uint64_t server_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table_Index final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.Index) */ {
+ public:
+  inline Table_Index() : Table_Index(nullptr) {}
+  ~Table_Index() override;
+  explicit PROTOBUF_CONSTEXPR Table_Index(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_Index(const Table_Index& from);
+  Table_Index(Table_Index&& from) noexcept
+    : Table_Index() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_Index& operator=(const Table_Index& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_Index& operator=(Table_Index&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_Index& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_Index* internal_default_instance() {
+    return reinterpret_cast<const Table_Index*>(
+               &_Table_Index_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Table_Index& a, Table_Index& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_Index* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_Index* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_Index* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_Index>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_Index& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_Index& from) {
+    Table_Index::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_Index* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.Index";
+  }
+  protected:
+  explicit Table_Index(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Table_Index_Indexlet Indexlet;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexletFieldNumber = 2,
+    kIndexIdFieldNumber = 1,
+  };
+  // repeated .RAMCloud.ProtoBuf.Table.Index.Indexlet indexlet = 2;
+  int indexlet_size() const;
+  private:
+  int _internal_indexlet_size() const;
+  public:
+  void clear_indexlet();
+  ::RAMCloud::ProtoBuf::Table_Index_Indexlet* mutable_indexlet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >*
+      mutable_indexlet();
+  private:
+  const ::RAMCloud::ProtoBuf::Table_Index_Indexlet& _internal_indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Index_Indexlet* _internal_add_indexlet();
+  public:
+  const ::RAMCloud::ProtoBuf::Table_Index_Indexlet& indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Index_Indexlet* add_indexlet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >&
+      indexlet() const;
+
+  // required uint32 index_id = 1;
+  bool has_index_id() const;
+  private:
+  bool _internal_has_index_id() const;
+  public:
+  void clear_index_id();
+  uint32_t index_id() const;
+  void set_index_id(uint32_t value);
+  private:
+  uint32_t _internal_index_id() const;
+  void _internal_set_index_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.Index)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index_Indexlet > indexlet_;
+    uint32_t index_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table_ReassignIndexlet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table.ReassignIndexlet) */ {
+ public:
+  inline Table_ReassignIndexlet() : Table_ReassignIndexlet(nullptr) {}
+  ~Table_ReassignIndexlet() override;
+  explicit PROTOBUF_CONSTEXPR Table_ReassignIndexlet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table_ReassignIndexlet(const Table_ReassignIndexlet& from);
+  Table_ReassignIndexlet(Table_ReassignIndexlet&& from) noexcept
+    : Table_ReassignIndexlet() {
+    *this = ::std::move(from);
+  }
+
+  inline Table_ReassignIndexlet& operator=(const Table_ReassignIndexlet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table_ReassignIndexlet& operator=(Table_ReassignIndexlet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table_ReassignIndexlet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table_ReassignIndexlet* internal_default_instance() {
+    return reinterpret_cast<const Table_ReassignIndexlet*>(
+               &_Table_ReassignIndexlet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Table_ReassignIndexlet& a, Table_ReassignIndexlet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table_ReassignIndexlet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table_ReassignIndexlet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table_ReassignIndexlet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table_ReassignIndexlet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table_ReassignIndexlet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table_ReassignIndexlet& from) {
+    Table_ReassignIndexlet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table_ReassignIndexlet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table.ReassignIndexlet";
+  }
+  protected:
+  explicit Table_ReassignIndexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFirstKeyFieldNumber = 3,
+    kFirstNotOwnedKeyFieldNumber = 4,
+    kServerIdFieldNumber = 1,
+    kBackingTableIdFieldNumber = 5,
+    kIndexIdFieldNumber = 2,
+  };
+  // required bytes first_key = 3;
+  bool has_first_key() const;
+  private:
+  bool _internal_has_first_key() const;
+  public:
+  void clear_first_key();
+  const std::string& first_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_key();
+  PROTOBUF_NODISCARD std::string* release_first_key();
+  void set_allocated_first_key(std::string* first_key);
+  private:
+  const std::string& _internal_first_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_key(const std::string& value);
+  std::string* _internal_mutable_first_key();
+  public:
+
+  // required bytes first_not_owned_key = 4;
+  bool has_first_not_owned_key() const;
+  private:
+  bool _internal_has_first_not_owned_key() const;
+  public:
+  void clear_first_not_owned_key();
+  const std::string& first_not_owned_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_first_not_owned_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_first_not_owned_key();
+  PROTOBUF_NODISCARD std::string* release_first_not_owned_key();
+  void set_allocated_first_not_owned_key(std::string* first_not_owned_key);
+  private:
+  const std::string& _internal_first_not_owned_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_first_not_owned_key(const std::string& value);
+  std::string* _internal_mutable_first_not_owned_key();
+  public:
+
+  // required fixed64 server_id = 1;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required uint64 backing_table_id = 5;
+  bool has_backing_table_id() const;
+  private:
+  bool _internal_has_backing_table_id() const;
+  public:
+  void clear_backing_table_id();
+  uint64_t backing_table_id() const;
+  void set_backing_table_id(uint64_t value);
+  private:
+  uint64_t _internal_backing_table_id() const;
+  void _internal_set_backing_table_id(uint64_t value);
+  public:
+
+  // required uint32 index_id = 2;
+  bool has_index_id() const;
+  private:
+  bool _internal_has_index_id() const;
+  public:
+  void clear_index_id();
+  uint32_t index_id() const;
+  void set_index_id(uint32_t value);
+  private:
+  uint32_t _internal_index_id() const;
+  void _internal_set_index_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table.ReassignIndexlet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr first_not_owned_key_;
+    uint64_t server_id_;
+    uint64_t backing_table_id_;
+    uint32_t index_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Table final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.Table) */ {
+ public:
+  inline Table() : Table(nullptr) {}
+  ~Table() override;
+  explicit PROTOBUF_CONSTEXPR Table(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Table(const Table& from);
+  Table(Table&& from) noexcept
+    : Table() {
+    *this = ::std::move(from);
+  }
+
+  inline Table& operator=(const Table& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Table& operator=(Table&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Table& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Table* internal_default_instance() {
+    return reinterpret_cast<const Table*>(
+               &_Table_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Table& a, Table& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Table* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Table* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Table* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Table>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Table& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Table& from) {
+    Table::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Table* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.Table";
+  }
+  protected:
+  explicit Table(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef Table_Tablet Tablet;
+  typedef Table_Split Split;
+  typedef Table_Reassign Reassign;
+  typedef Table_Index Index;
+  typedef Table_ReassignIndexlet ReassignIndexlet;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletFieldNumber = 3,
+    kIndexFieldNumber = 9,
+    kNameFieldNumber = 1,
+    kSplitFieldNumber = 7,
+    kReassignFieldNumber = 8,
+    kReassignIndexletFieldNumber = 10,
+    kIdFieldNumber = 2,
+    kSequenceNumberFieldNumber = 4,
+    kCreatedFieldNumber = 5,
+    kDeletedFieldNumber = 6,
+  };
+  // repeated .RAMCloud.ProtoBuf.Table.Tablet tablet = 3;
+  int tablet_size() const;
+  private:
+  int _internal_tablet_size() const;
+  public:
+  void clear_tablet();
+  ::RAMCloud::ProtoBuf::Table_Tablet* mutable_tablet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Tablet >*
+      mutable_tablet();
+  private:
+  const ::RAMCloud::ProtoBuf::Table_Tablet& _internal_tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Tablet* _internal_add_tablet();
+  public:
+  const ::RAMCloud::ProtoBuf::Table_Tablet& tablet(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Tablet* add_tablet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Tablet >&
+      tablet() const;
+
+  // repeated .RAMCloud.ProtoBuf.Table.Index index = 9;
+  int index_size() const;
+  private:
+  int _internal_index_size() const;
+  public:
+  void clear_index();
+  ::RAMCloud::ProtoBuf::Table_Index* mutable_index(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index >*
+      mutable_index();
+  private:
+  const ::RAMCloud::ProtoBuf::Table_Index& _internal_index(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Index* _internal_add_index();
+  public:
+  const ::RAMCloud::ProtoBuf::Table_Index& index(int index) const;
+  ::RAMCloud::ProtoBuf::Table_Index* add_index();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index >&
+      index() const;
+
+  // required string name = 1;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional .RAMCloud.ProtoBuf.Table.Split split = 7;
+  bool has_split() const;
+  private:
+  bool _internal_has_split() const;
+  public:
+  void clear_split();
+  const ::RAMCloud::ProtoBuf::Table_Split& split() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Table_Split* release_split();
+  ::RAMCloud::ProtoBuf::Table_Split* mutable_split();
+  void set_allocated_split(::RAMCloud::ProtoBuf::Table_Split* split);
+  private:
+  const ::RAMCloud::ProtoBuf::Table_Split& _internal_split() const;
+  ::RAMCloud::ProtoBuf::Table_Split* _internal_mutable_split();
+  public:
+  void unsafe_arena_set_allocated_split(
+      ::RAMCloud::ProtoBuf::Table_Split* split);
+  ::RAMCloud::ProtoBuf::Table_Split* unsafe_arena_release_split();
+
+  // optional .RAMCloud.ProtoBuf.Table.Reassign reassign = 8;
+  bool has_reassign() const;
+  private:
+  bool _internal_has_reassign() const;
+  public:
+  void clear_reassign();
+  const ::RAMCloud::ProtoBuf::Table_Reassign& reassign() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Table_Reassign* release_reassign();
+  ::RAMCloud::ProtoBuf::Table_Reassign* mutable_reassign();
+  void set_allocated_reassign(::RAMCloud::ProtoBuf::Table_Reassign* reassign);
+  private:
+  const ::RAMCloud::ProtoBuf::Table_Reassign& _internal_reassign() const;
+  ::RAMCloud::ProtoBuf::Table_Reassign* _internal_mutable_reassign();
+  public:
+  void unsafe_arena_set_allocated_reassign(
+      ::RAMCloud::ProtoBuf::Table_Reassign* reassign);
+  ::RAMCloud::ProtoBuf::Table_Reassign* unsafe_arena_release_reassign();
+
+  // optional .RAMCloud.ProtoBuf.Table.ReassignIndexlet reassign_indexlet = 10;
+  bool has_reassign_indexlet() const;
+  private:
+  bool _internal_has_reassign_indexlet() const;
+  public:
+  void clear_reassign_indexlet();
+  const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet& reassign_indexlet() const;
+  PROTOBUF_NODISCARD ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* release_reassign_indexlet();
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* mutable_reassign_indexlet();
+  void set_allocated_reassign_indexlet(::RAMCloud::ProtoBuf::Table_ReassignIndexlet* reassign_indexlet);
+  private:
+  const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet& _internal_reassign_indexlet() const;
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* _internal_mutable_reassign_indexlet();
+  public:
+  void unsafe_arena_set_allocated_reassign_indexlet(
+      ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* reassign_indexlet);
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* unsafe_arena_release_reassign_indexlet();
+
+  // required uint64 id = 2;
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // required uint64 sequence_number = 4;
+  bool has_sequence_number() const;
+  private:
+  bool _internal_has_sequence_number() const;
+  public:
+  void clear_sequence_number();
+  uint64_t sequence_number() const;
+  void set_sequence_number(uint64_t value);
+  private:
+  uint64_t _internal_sequence_number() const;
+  void _internal_set_sequence_number(uint64_t value);
+  public:
+
+  // optional bool created = 5;
+  bool has_created() const;
+  private:
+  bool _internal_has_created() const;
+  public:
+  void clear_created();
+  bool created() const;
+  void set_created(bool value);
+  private:
+  bool _internal_created() const;
+  void _internal_set_created(bool value);
+  public:
+
+  // optional bool deleted = 6;
+  bool has_deleted() const;
+  private:
+  bool _internal_has_deleted() const;
+  public:
+  void clear_deleted();
+  bool deleted() const;
+  void set_deleted(bool value);
+  private:
+  bool _internal_deleted() const;
+  void _internal_set_deleted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.Table)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Tablet > tablet_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index > index_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::RAMCloud::ProtoBuf::Table_Split* split_;
+    ::RAMCloud::ProtoBuf::Table_Reassign* reassign_;
+    ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* reassign_indexlet_;
+    uint64_t id_;
+    uint64_t sequence_number_;
+    bool created_;
+    bool deleted_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_Table_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Table_Tablet
+
+// required uint64 start_key_hash = 1;
+inline bool Table_Tablet::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void Table_Tablet::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Table_Tablet::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t Table_Tablet::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void Table_Tablet::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_key_hash_ = value;
+}
+inline void Table_Tablet::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.start_key_hash)
+}
+
+// required uint64 end_key_hash = 2;
+inline bool Table_Tablet::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void Table_Tablet::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Table_Tablet::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t Table_Tablet::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void Table_Tablet::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_key_hash_ = value;
+}
+inline void Table_Tablet::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.end_key_hash)
+}
+
+// required .RAMCloud.ProtoBuf.Table.Tablet.State state = 3;
+inline bool Table_Tablet::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_state() const {
+  return _internal_has_state();
+}
+inline void Table_Tablet::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::RAMCloud::ProtoBuf::Table_Tablet_State Table_Tablet::_internal_state() const {
+  return static_cast< ::RAMCloud::ProtoBuf::Table_Tablet_State >(_impl_.state_);
+}
+inline ::RAMCloud::ProtoBuf::Table_Tablet_State Table_Tablet::state() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.state)
+  return _internal_state();
+}
+inline void Table_Tablet::_internal_set_state(::RAMCloud::ProtoBuf::Table_Tablet_State value) {
+  assert(::RAMCloud::ProtoBuf::Table_Tablet_State_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.state_ = value;
+}
+inline void Table_Tablet::set_state(::RAMCloud::ProtoBuf::Table_Tablet_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.state)
+}
+
+// required fixed64 server_id = 4;
+inline bool Table_Tablet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Table_Tablet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Table_Tablet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Table_Tablet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.server_id)
+  return _internal_server_id();
+}
+inline void Table_Tablet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_id_ = value;
+}
+inline void Table_Tablet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.server_id)
+}
+
+// required uint64 ctime_log_head_id = 5;
+inline bool Table_Tablet::_internal_has_ctime_log_head_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_ctime_log_head_id() const {
+  return _internal_has_ctime_log_head_id();
+}
+inline void Table_Tablet::clear_ctime_log_head_id() {
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Table_Tablet::_internal_ctime_log_head_id() const {
+  return _impl_.ctime_log_head_id_;
+}
+inline uint64_t Table_Tablet::ctime_log_head_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.ctime_log_head_id)
+  return _internal_ctime_log_head_id();
+}
+inline void Table_Tablet::_internal_set_ctime_log_head_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.ctime_log_head_id_ = value;
+}
+inline void Table_Tablet::set_ctime_log_head_id(uint64_t value) {
+  _internal_set_ctime_log_head_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.ctime_log_head_id)
+}
+
+// required uint32 ctime_log_head_offset = 6;
+inline bool Table_Tablet::_internal_has_ctime_log_head_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Table_Tablet::has_ctime_log_head_offset() const {
+  return _internal_has_ctime_log_head_offset();
+}
+inline void Table_Tablet::clear_ctime_log_head_offset() {
+  _impl_.ctime_log_head_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Table_Tablet::_internal_ctime_log_head_offset() const {
+  return _impl_.ctime_log_head_offset_;
+}
+inline uint32_t Table_Tablet::ctime_log_head_offset() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Tablet.ctime_log_head_offset)
+  return _internal_ctime_log_head_offset();
+}
+inline void Table_Tablet::_internal_set_ctime_log_head_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.ctime_log_head_offset_ = value;
+}
+inline void Table_Tablet::set_ctime_log_head_offset(uint32_t value) {
+  _internal_set_ctime_log_head_offset(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Tablet.ctime_log_head_offset)
+}
+
+// -------------------------------------------------------------------
+
+// Table_Split
+
+// required fixed64 server_id = 1;
+inline bool Table_Split::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_Split::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Table_Split::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Table_Split::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Table_Split::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Split.server_id)
+  return _internal_server_id();
+}
+inline void Table_Split::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.server_id_ = value;
+}
+inline void Table_Split::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Split.server_id)
+}
+
+// required uint64 split_key_hash = 2;
+inline bool Table_Split::_internal_has_split_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Table_Split::has_split_key_hash() const {
+  return _internal_has_split_key_hash();
+}
+inline void Table_Split::clear_split_key_hash() {
+  _impl_.split_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Table_Split::_internal_split_key_hash() const {
+  return _impl_.split_key_hash_;
+}
+inline uint64_t Table_Split::split_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Split.split_key_hash)
+  return _internal_split_key_hash();
+}
+inline void Table_Split::_internal_set_split_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.split_key_hash_ = value;
+}
+inline void Table_Split::set_split_key_hash(uint64_t value) {
+  _internal_set_split_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Split.split_key_hash)
+}
+
+// -------------------------------------------------------------------
+
+// Table_Reassign
+
+// required fixed64 server_id = 1;
+inline bool Table_Reassign::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_Reassign::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Table_Reassign::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Table_Reassign::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Table_Reassign::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Reassign.server_id)
+  return _internal_server_id();
+}
+inline void Table_Reassign::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.server_id_ = value;
+}
+inline void Table_Reassign::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Reassign.server_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool Table_Reassign::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Table_Reassign::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void Table_Reassign::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Table_Reassign::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t Table_Reassign::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Reassign.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void Table_Reassign::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.start_key_hash_ = value;
+}
+inline void Table_Reassign::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Reassign.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool Table_Reassign::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Table_Reassign::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void Table_Reassign::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Table_Reassign::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t Table_Reassign::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Reassign.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void Table_Reassign::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_key_hash_ = value;
+}
+inline void Table_Reassign::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Reassign.end_key_hash)
+}
+
+// -------------------------------------------------------------------
+
+// Table_Index_Indexlet
+
+// required string first_key = 1;
+inline bool Table_Index_Indexlet::_internal_has_first_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_Index_Indexlet::has_first_key() const {
+  return _internal_has_first_key();
+}
+inline void Table_Index_Indexlet::clear_first_key() {
+  _impl_.first_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Table_Index_Indexlet::first_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key)
+  return _internal_first_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table_Index_Indexlet::set_first_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.first_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key)
+}
+inline std::string* Table_Index_Indexlet::mutable_first_key() {
+  std::string* _s = _internal_mutable_first_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key)
+  return _s;
+}
+inline const std::string& Table_Index_Indexlet::_internal_first_key() const {
+  return _impl_.first_key_.Get();
+}
+inline void Table_Index_Indexlet::_internal_set_first_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.first_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table_Index_Indexlet::_internal_mutable_first_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.first_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table_Index_Indexlet::release_first_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key)
+  if (!_internal_has_first_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.first_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table_Index_Indexlet::set_allocated_first_key(std::string* first_key) {
+  if (first_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.first_key_.SetAllocated(first_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_key)
+}
+
+// required string first_not_owned_key = 2;
+inline bool Table_Index_Indexlet::_internal_has_first_not_owned_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Table_Index_Indexlet::has_first_not_owned_key() const {
+  return _internal_has_first_not_owned_key();
+}
+inline void Table_Index_Indexlet::clear_first_not_owned_key() {
+  _impl_.first_not_owned_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Table_Index_Indexlet::first_not_owned_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key)
+  return _internal_first_not_owned_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table_Index_Indexlet::set_first_not_owned_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.first_not_owned_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key)
+}
+inline std::string* Table_Index_Indexlet::mutable_first_not_owned_key() {
+  std::string* _s = _internal_mutable_first_not_owned_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key)
+  return _s;
+}
+inline const std::string& Table_Index_Indexlet::_internal_first_not_owned_key() const {
+  return _impl_.first_not_owned_key_.Get();
+}
+inline void Table_Index_Indexlet::_internal_set_first_not_owned_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.first_not_owned_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table_Index_Indexlet::_internal_mutable_first_not_owned_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.first_not_owned_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table_Index_Indexlet::release_first_not_owned_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key)
+  if (!_internal_has_first_not_owned_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.first_not_owned_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table_Index_Indexlet::set_allocated_first_not_owned_key(std::string* first_not_owned_key) {
+  if (first_not_owned_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.first_not_owned_key_.SetAllocated(first_not_owned_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.Index.Indexlet.first_not_owned_key)
+}
+
+// required uint64 backing_table_id = 3;
+inline bool Table_Index_Indexlet::_internal_has_backing_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Table_Index_Indexlet::has_backing_table_id() const {
+  return _internal_has_backing_table_id();
+}
+inline void Table_Index_Indexlet::clear_backing_table_id() {
+  _impl_.backing_table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Table_Index_Indexlet::_internal_backing_table_id() const {
+  return _impl_.backing_table_id_;
+}
+inline uint64_t Table_Index_Indexlet::backing_table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.Indexlet.backing_table_id)
+  return _internal_backing_table_id();
+}
+inline void Table_Index_Indexlet::_internal_set_backing_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.backing_table_id_ = value;
+}
+inline void Table_Index_Indexlet::set_backing_table_id(uint64_t value) {
+  _internal_set_backing_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Index.Indexlet.backing_table_id)
+}
+
+// required fixed64 server_id = 4;
+inline bool Table_Index_Indexlet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Table_Index_Indexlet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Table_Index_Indexlet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Table_Index_Indexlet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Table_Index_Indexlet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.Indexlet.server_id)
+  return _internal_server_id();
+}
+inline void Table_Index_Indexlet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.server_id_ = value;
+}
+inline void Table_Index_Indexlet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Index.Indexlet.server_id)
+}
+
+// -------------------------------------------------------------------
+
+// Table_Index
+
+// required uint32 index_id = 1;
+inline bool Table_Index::_internal_has_index_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_Index::has_index_id() const {
+  return _internal_has_index_id();
+}
+inline void Table_Index::clear_index_id() {
+  _impl_.index_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t Table_Index::_internal_index_id() const {
+  return _impl_.index_id_;
+}
+inline uint32_t Table_Index::index_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.index_id)
+  return _internal_index_id();
+}
+inline void Table_Index::_internal_set_index_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.index_id_ = value;
+}
+inline void Table_Index::set_index_id(uint32_t value) {
+  _internal_set_index_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.Index.index_id)
+}
+
+// repeated .RAMCloud.ProtoBuf.Table.Index.Indexlet indexlet = 2;
+inline int Table_Index::_internal_indexlet_size() const {
+  return _impl_.indexlet_.size();
+}
+inline int Table_Index::indexlet_size() const {
+  return _internal_indexlet_size();
+}
+inline void Table_Index::clear_indexlet() {
+  _impl_.indexlet_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::Table_Index_Indexlet* Table_Index::mutable_indexlet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.Index.indexlet)
+  return _impl_.indexlet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >*
+Table_Index::mutable_indexlet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.Table.Index.indexlet)
+  return &_impl_.indexlet_;
+}
+inline const ::RAMCloud::ProtoBuf::Table_Index_Indexlet& Table_Index::_internal_indexlet(int index) const {
+  return _impl_.indexlet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Table_Index_Indexlet& Table_Index::indexlet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.Index.indexlet)
+  return _internal_indexlet(index);
+}
+inline ::RAMCloud::ProtoBuf::Table_Index_Indexlet* Table_Index::_internal_add_indexlet() {
+  return _impl_.indexlet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Table_Index_Indexlet* Table_Index::add_indexlet() {
+  ::RAMCloud::ProtoBuf::Table_Index_Indexlet* _add = _internal_add_indexlet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.Table.Index.indexlet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index_Indexlet >&
+Table_Index::indexlet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.Table.Index.indexlet)
+  return _impl_.indexlet_;
+}
+
+// -------------------------------------------------------------------
+
+// Table_ReassignIndexlet
+
+// required fixed64 server_id = 1;
+inline bool Table_ReassignIndexlet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Table_ReassignIndexlet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void Table_ReassignIndexlet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Table_ReassignIndexlet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t Table_ReassignIndexlet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.ReassignIndexlet.server_id)
+  return _internal_server_id();
+}
+inline void Table_ReassignIndexlet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.server_id_ = value;
+}
+inline void Table_ReassignIndexlet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.ReassignIndexlet.server_id)
+}
+
+// required uint32 index_id = 2;
+inline bool Table_ReassignIndexlet::_internal_has_index_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Table_ReassignIndexlet::has_index_id() const {
+  return _internal_has_index_id();
+}
+inline void Table_ReassignIndexlet::clear_index_id() {
+  _impl_.index_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t Table_ReassignIndexlet::_internal_index_id() const {
+  return _impl_.index_id_;
+}
+inline uint32_t Table_ReassignIndexlet::index_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.ReassignIndexlet.index_id)
+  return _internal_index_id();
+}
+inline void Table_ReassignIndexlet::_internal_set_index_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.index_id_ = value;
+}
+inline void Table_ReassignIndexlet::set_index_id(uint32_t value) {
+  _internal_set_index_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.ReassignIndexlet.index_id)
+}
+
+// required bytes first_key = 3;
+inline bool Table_ReassignIndexlet::_internal_has_first_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table_ReassignIndexlet::has_first_key() const {
+  return _internal_has_first_key();
+}
+inline void Table_ReassignIndexlet::clear_first_key() {
+  _impl_.first_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Table_ReassignIndexlet::first_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_key)
+  return _internal_first_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table_ReassignIndexlet::set_first_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.first_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_key)
+}
+inline std::string* Table_ReassignIndexlet::mutable_first_key() {
+  std::string* _s = _internal_mutable_first_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_key)
+  return _s;
+}
+inline const std::string& Table_ReassignIndexlet::_internal_first_key() const {
+  return _impl_.first_key_.Get();
+}
+inline void Table_ReassignIndexlet::_internal_set_first_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.first_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table_ReassignIndexlet::_internal_mutable_first_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.first_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table_ReassignIndexlet::release_first_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_key)
+  if (!_internal_has_first_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.first_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table_ReassignIndexlet::set_allocated_first_key(std::string* first_key) {
+  if (first_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.first_key_.SetAllocated(first_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_key_.IsDefault()) {
+    _impl_.first_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_key)
+}
+
+// required bytes first_not_owned_key = 4;
+inline bool Table_ReassignIndexlet::_internal_has_first_not_owned_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Table_ReassignIndexlet::has_first_not_owned_key() const {
+  return _internal_has_first_not_owned_key();
+}
+inline void Table_ReassignIndexlet::clear_first_not_owned_key() {
+  _impl_.first_not_owned_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Table_ReassignIndexlet::first_not_owned_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_not_owned_key)
+  return _internal_first_not_owned_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table_ReassignIndexlet::set_first_not_owned_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.first_not_owned_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_not_owned_key)
+}
+inline std::string* Table_ReassignIndexlet::mutable_first_not_owned_key() {
+  std::string* _s = _internal_mutable_first_not_owned_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_not_owned_key)
+  return _s;
+}
+inline const std::string& Table_ReassignIndexlet::_internal_first_not_owned_key() const {
+  return _impl_.first_not_owned_key_.Get();
+}
+inline void Table_ReassignIndexlet::_internal_set_first_not_owned_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.first_not_owned_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table_ReassignIndexlet::_internal_mutable_first_not_owned_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.first_not_owned_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table_ReassignIndexlet::release_first_not_owned_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_not_owned_key)
+  if (!_internal_has_first_not_owned_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.first_not_owned_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table_ReassignIndexlet::set_allocated_first_not_owned_key(std::string* first_not_owned_key) {
+  if (first_not_owned_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.first_not_owned_key_.SetAllocated(first_not_owned_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.first_not_owned_key_.IsDefault()) {
+    _impl_.first_not_owned_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.ReassignIndexlet.first_not_owned_key)
+}
+
+// required uint64 backing_table_id = 5;
+inline bool Table_ReassignIndexlet::_internal_has_backing_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Table_ReassignIndexlet::has_backing_table_id() const {
+  return _internal_has_backing_table_id();
+}
+inline void Table_ReassignIndexlet::clear_backing_table_id() {
+  _impl_.backing_table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Table_ReassignIndexlet::_internal_backing_table_id() const {
+  return _impl_.backing_table_id_;
+}
+inline uint64_t Table_ReassignIndexlet::backing_table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.ReassignIndexlet.backing_table_id)
+  return _internal_backing_table_id();
+}
+inline void Table_ReassignIndexlet::_internal_set_backing_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.backing_table_id_ = value;
+}
+inline void Table_ReassignIndexlet::set_backing_table_id(uint64_t value) {
+  _internal_set_backing_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.ReassignIndexlet.backing_table_id)
+}
+
+// -------------------------------------------------------------------
+
+// Table
+
+// required string name = 1;
+inline bool Table::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Table::has_name() const {
+  return _internal_has_name();
+}
+inline void Table::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Table::name() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Table::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.name)
+}
+inline std::string* Table::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.name)
+  return _s;
+}
+inline const std::string& Table::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Table::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Table::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Table::release_name() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Table::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.name)
+}
+
+// required uint64 id = 2;
+inline bool Table::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Table::has_id() const {
+  return _internal_has_id();
+}
+inline void Table::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t Table::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Table::id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.id)
+  return _internal_id();
+}
+inline void Table::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.id_ = value;
+}
+inline void Table::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.id)
+}
+
+// repeated .RAMCloud.ProtoBuf.Table.Tablet tablet = 3;
+inline int Table::_internal_tablet_size() const {
+  return _impl_.tablet_.size();
+}
+inline int Table::tablet_size() const {
+  return _internal_tablet_size();
+}
+inline void Table::clear_tablet() {
+  _impl_.tablet_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::Table_Tablet* Table::mutable_tablet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.tablet)
+  return _impl_.tablet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Tablet >*
+Table::mutable_tablet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.Table.tablet)
+  return &_impl_.tablet_;
+}
+inline const ::RAMCloud::ProtoBuf::Table_Tablet& Table::_internal_tablet(int index) const {
+  return _impl_.tablet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Table_Tablet& Table::tablet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.tablet)
+  return _internal_tablet(index);
+}
+inline ::RAMCloud::ProtoBuf::Table_Tablet* Table::_internal_add_tablet() {
+  return _impl_.tablet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Table_Tablet* Table::add_tablet() {
+  ::RAMCloud::ProtoBuf::Table_Tablet* _add = _internal_add_tablet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.Table.tablet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Tablet >&
+Table::tablet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.Table.tablet)
+  return _impl_.tablet_;
+}
+
+// required uint64 sequence_number = 4;
+inline bool Table::_internal_has_sequence_number() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Table::has_sequence_number() const {
+  return _internal_has_sequence_number();
+}
+inline void Table::clear_sequence_number() {
+  _impl_.sequence_number_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Table::_internal_sequence_number() const {
+  return _impl_.sequence_number_;
+}
+inline uint64_t Table::sequence_number() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.sequence_number)
+  return _internal_sequence_number();
+}
+inline void Table::_internal_set_sequence_number(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.sequence_number_ = value;
+}
+inline void Table::set_sequence_number(uint64_t value) {
+  _internal_set_sequence_number(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.sequence_number)
+}
+
+// optional bool created = 5;
+inline bool Table::_internal_has_created() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Table::has_created() const {
+  return _internal_has_created();
+}
+inline void Table::clear_created() {
+  _impl_.created_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool Table::_internal_created() const {
+  return _impl_.created_;
+}
+inline bool Table::created() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.created)
+  return _internal_created();
+}
+inline void Table::_internal_set_created(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.created_ = value;
+}
+inline void Table::set_created(bool value) {
+  _internal_set_created(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.created)
+}
+
+// optional bool deleted = 6;
+inline bool Table::_internal_has_deleted() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Table::has_deleted() const {
+  return _internal_has_deleted();
+}
+inline void Table::clear_deleted() {
+  _impl_.deleted_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Table::_internal_deleted() const {
+  return _impl_.deleted_;
+}
+inline bool Table::deleted() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.deleted)
+  return _internal_deleted();
+}
+inline void Table::_internal_set_deleted(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.deleted_ = value;
+}
+inline void Table::set_deleted(bool value) {
+  _internal_set_deleted(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.Table.deleted)
+}
+
+// optional .RAMCloud.ProtoBuf.Table.Split split = 7;
+inline bool Table::_internal_has_split() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.split_ != nullptr);
+  return value;
+}
+inline bool Table::has_split() const {
+  return _internal_has_split();
+}
+inline void Table::clear_split() {
+  if (_impl_.split_ != nullptr) _impl_.split_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::RAMCloud::ProtoBuf::Table_Split& Table::_internal_split() const {
+  const ::RAMCloud::ProtoBuf::Table_Split* p = _impl_.split_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Table_Split&>(
+      ::RAMCloud::ProtoBuf::_Table_Split_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Table_Split& Table::split() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.split)
+  return _internal_split();
+}
+inline void Table::unsafe_arena_set_allocated_split(
+    ::RAMCloud::ProtoBuf::Table_Split* split) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.split_);
+  }
+  _impl_.split_ = split;
+  if (split) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.Table.split)
+}
+inline ::RAMCloud::ProtoBuf::Table_Split* Table::release_split() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::Table_Split* temp = _impl_.split_;
+  _impl_.split_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_Split* Table::unsafe_arena_release_split() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.split)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::RAMCloud::ProtoBuf::Table_Split* temp = _impl_.split_;
+  _impl_.split_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_Split* Table::_internal_mutable_split() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.split_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Split>(GetArenaForAllocation());
+    _impl_.split_ = p;
+  }
+  return _impl_.split_;
+}
+inline ::RAMCloud::ProtoBuf::Table_Split* Table::mutable_split() {
+  ::RAMCloud::ProtoBuf::Table_Split* _msg = _internal_mutable_split();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.split)
+  return _msg;
+}
+inline void Table::set_allocated_split(::RAMCloud::ProtoBuf::Table_Split* split) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.split_;
+  }
+  if (split) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(split);
+    if (message_arena != submessage_arena) {
+      split = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, split, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.split_ = split;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.split)
+}
+
+// optional .RAMCloud.ProtoBuf.Table.Reassign reassign = 8;
+inline bool Table::_internal_has_reassign() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reassign_ != nullptr);
+  return value;
+}
+inline bool Table::has_reassign() const {
+  return _internal_has_reassign();
+}
+inline void Table::clear_reassign() {
+  if (_impl_.reassign_ != nullptr) _impl_.reassign_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::RAMCloud::ProtoBuf::Table_Reassign& Table::_internal_reassign() const {
+  const ::RAMCloud::ProtoBuf::Table_Reassign* p = _impl_.reassign_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Table_Reassign&>(
+      ::RAMCloud::ProtoBuf::_Table_Reassign_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Table_Reassign& Table::reassign() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.reassign)
+  return _internal_reassign();
+}
+inline void Table::unsafe_arena_set_allocated_reassign(
+    ::RAMCloud::ProtoBuf::Table_Reassign* reassign) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reassign_);
+  }
+  _impl_.reassign_ = reassign;
+  if (reassign) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.Table.reassign)
+}
+inline ::RAMCloud::ProtoBuf::Table_Reassign* Table::release_reassign() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::Table_Reassign* temp = _impl_.reassign_;
+  _impl_.reassign_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_Reassign* Table::unsafe_arena_release_reassign() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.reassign)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::RAMCloud::ProtoBuf::Table_Reassign* temp = _impl_.reassign_;
+  _impl_.reassign_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_Reassign* Table::_internal_mutable_reassign() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.reassign_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_Reassign>(GetArenaForAllocation());
+    _impl_.reassign_ = p;
+  }
+  return _impl_.reassign_;
+}
+inline ::RAMCloud::ProtoBuf::Table_Reassign* Table::mutable_reassign() {
+  ::RAMCloud::ProtoBuf::Table_Reassign* _msg = _internal_mutable_reassign();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.reassign)
+  return _msg;
+}
+inline void Table::set_allocated_reassign(::RAMCloud::ProtoBuf::Table_Reassign* reassign) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reassign_;
+  }
+  if (reassign) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reassign);
+    if (message_arena != submessage_arena) {
+      reassign = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reassign, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.reassign_ = reassign;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.reassign)
+}
+
+// repeated .RAMCloud.ProtoBuf.Table.Index index = 9;
+inline int Table::_internal_index_size() const {
+  return _impl_.index_.size();
+}
+inline int Table::index_size() const {
+  return _internal_index_size();
+}
+inline void Table::clear_index() {
+  _impl_.index_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::Table_Index* Table::mutable_index(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.index)
+  return _impl_.index_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index >*
+Table::mutable_index() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.Table.index)
+  return &_impl_.index_;
+}
+inline const ::RAMCloud::ProtoBuf::Table_Index& Table::_internal_index(int index) const {
+  return _impl_.index_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::Table_Index& Table::index(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.index)
+  return _internal_index(index);
+}
+inline ::RAMCloud::ProtoBuf::Table_Index* Table::_internal_add_index() {
+  return _impl_.index_.Add();
+}
+inline ::RAMCloud::ProtoBuf::Table_Index* Table::add_index() {
+  ::RAMCloud::ProtoBuf::Table_Index* _add = _internal_add_index();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.Table.index)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::Table_Index >&
+Table::index() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.Table.index)
+  return _impl_.index_;
+}
+
+// optional .RAMCloud.ProtoBuf.Table.ReassignIndexlet reassign_indexlet = 10;
+inline bool Table::_internal_has_reassign_indexlet() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.reassign_indexlet_ != nullptr);
+  return value;
+}
+inline bool Table::has_reassign_indexlet() const {
+  return _internal_has_reassign_indexlet();
+}
+inline void Table::clear_reassign_indexlet() {
+  if (_impl_.reassign_indexlet_ != nullptr) _impl_.reassign_indexlet_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet& Table::_internal_reassign_indexlet() const {
+  const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* p = _impl_.reassign_indexlet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet&>(
+      ::RAMCloud::ProtoBuf::_Table_ReassignIndexlet_default_instance_);
+}
+inline const ::RAMCloud::ProtoBuf::Table_ReassignIndexlet& Table::reassign_indexlet() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.Table.reassign_indexlet)
+  return _internal_reassign_indexlet();
+}
+inline void Table::unsafe_arena_set_allocated_reassign_indexlet(
+    ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* reassign_indexlet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reassign_indexlet_);
+  }
+  _impl_.reassign_indexlet_ = reassign_indexlet;
+  if (reassign_indexlet) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:RAMCloud.ProtoBuf.Table.reassign_indexlet)
+}
+inline ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* Table::release_reassign_indexlet() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* temp = _impl_.reassign_indexlet_;
+  _impl_.reassign_indexlet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* Table::unsafe_arena_release_reassign_indexlet() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.Table.reassign_indexlet)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* temp = _impl_.reassign_indexlet_;
+  _impl_.reassign_indexlet_ = nullptr;
+  return temp;
+}
+inline ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* Table::_internal_mutable_reassign_indexlet() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.reassign_indexlet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::RAMCloud::ProtoBuf::Table_ReassignIndexlet>(GetArenaForAllocation());
+    _impl_.reassign_indexlet_ = p;
+  }
+  return _impl_.reassign_indexlet_;
+}
+inline ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* Table::mutable_reassign_indexlet() {
+  ::RAMCloud::ProtoBuf::Table_ReassignIndexlet* _msg = _internal_mutable_reassign_indexlet();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.Table.reassign_indexlet)
+  return _msg;
+}
+inline void Table::set_allocated_reassign_indexlet(::RAMCloud::ProtoBuf::Table_ReassignIndexlet* reassign_indexlet) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reassign_indexlet_;
+  }
+  if (reassign_indexlet) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reassign_indexlet);
+    if (message_arena != submessage_arena) {
+      reassign_indexlet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reassign_indexlet, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.reassign_indexlet_ = reassign_indexlet;
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.Table.reassign_indexlet)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::RAMCloud::ProtoBuf::Table_Tablet_State> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::RAMCloud::ProtoBuf::Table_Tablet_State>() {
+  return ::RAMCloud::ProtoBuf::Table_Tablet_State_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_Table_2eproto
+// RAMCloud pragma [GCCWARN=0]
@@ -0,0 +1,1777 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: TableConfig.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_TableConfig_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_TableConfig_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_TableConfig_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_TableConfig_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_TableConfig_2eproto;
+namespace RAMCloud {
+namespace ProtoBuf {
+class TableConfig;
+struct TableConfigDefaultTypeInternal;
+extern TableConfigDefaultTypeInternal _TableConfig_default_instance_;
+class TableConfig_Index;
+struct TableConfig_IndexDefaultTypeInternal;
+extern TableConfig_IndexDefaultTypeInternal _TableConfig_Index_default_instance_;
+class TableConfig_Index_Indexlet;
+struct TableConfig_Index_IndexletDefaultTypeInternal;
+extern TableConfig_Index_IndexletDefaultTypeInternal _TableConfig_Index_Indexlet_default_instance_;
+class TableConfig_Tablet;
+struct TableConfig_TabletDefaultTypeInternal;
+extern TableConfig_TabletDefaultTypeInternal _TableConfig_Tablet_default_instance_;
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+PROTOBUF_NAMESPACE_OPEN
+template<> ::RAMCloud::ProtoBuf::TableConfig* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableConfig>(Arena*);
+template<> ::RAMCloud::ProtoBuf::TableConfig_Index* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableConfig_Index>(Arena*);
+template<> ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet>(Arena*);
+template<> ::RAMCloud::ProtoBuf::TableConfig_Tablet* Arena::CreateMaybeMessage<::RAMCloud::ProtoBuf::TableConfig_Tablet>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace RAMCloud {
+namespace ProtoBuf {
+
+enum TableConfig_Tablet_State : int {
+  TableConfig_Tablet_State_NORMAL = 0,
+  TableConfig_Tablet_State_RECOVERING = 1
+};
+bool TableConfig_Tablet_State_IsValid(int value);
+constexpr TableConfig_Tablet_State TableConfig_Tablet_State_State_MIN = TableConfig_Tablet_State_NORMAL;
+constexpr TableConfig_Tablet_State TableConfig_Tablet_State_State_MAX = TableConfig_Tablet_State_RECOVERING;
+constexpr int TableConfig_Tablet_State_State_ARRAYSIZE = TableConfig_Tablet_State_State_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* TableConfig_Tablet_State_descriptor();
+template<typename T>
+inline const std::string& TableConfig_Tablet_State_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, TableConfig_Tablet_State>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function TableConfig_Tablet_State_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    TableConfig_Tablet_State_descriptor(), enum_t_value);
+}
+inline bool TableConfig_Tablet_State_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, TableConfig_Tablet_State* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<TableConfig_Tablet_State>(
+    TableConfig_Tablet_State_descriptor(), name, value);
+}
+// ===================================================================
+
+class TableConfig_Tablet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableConfig.Tablet) */ {
+ public:
+  inline TableConfig_Tablet() : TableConfig_Tablet(nullptr) {}
+  ~TableConfig_Tablet() override;
+  explicit PROTOBUF_CONSTEXPR TableConfig_Tablet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableConfig_Tablet(const TableConfig_Tablet& from);
+  TableConfig_Tablet(TableConfig_Tablet&& from) noexcept
+    : TableConfig_Tablet() {
+    *this = ::std::move(from);
+  }
+
+  inline TableConfig_Tablet& operator=(const TableConfig_Tablet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableConfig_Tablet& operator=(TableConfig_Tablet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableConfig_Tablet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableConfig_Tablet* internal_default_instance() {
+    return reinterpret_cast<const TableConfig_Tablet*>(
+               &_TableConfig_Tablet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TableConfig_Tablet& a, TableConfig_Tablet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableConfig_Tablet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableConfig_Tablet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableConfig_Tablet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableConfig_Tablet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableConfig_Tablet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableConfig_Tablet& from) {
+    TableConfig_Tablet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableConfig_Tablet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableConfig.Tablet";
+  }
+  protected:
+  explicit TableConfig_Tablet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TableConfig_Tablet_State State;
+  static constexpr State NORMAL =
+    TableConfig_Tablet_State_NORMAL;
+  static constexpr State RECOVERING =
+    TableConfig_Tablet_State_RECOVERING;
+  static inline bool State_IsValid(int value) {
+    return TableConfig_Tablet_State_IsValid(value);
+  }
+  static constexpr State State_MIN =
+    TableConfig_Tablet_State_State_MIN;
+  static constexpr State State_MAX =
+    TableConfig_Tablet_State_State_MAX;
+  static constexpr int State_ARRAYSIZE =
+    TableConfig_Tablet_State_State_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  State_descriptor() {
+    return TableConfig_Tablet_State_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& State_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, State>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function State_Name.");
+    return TableConfig_Tablet_State_Name(enum_t_value);
+  }
+  static inline bool State_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      State* value) {
+    return TableConfig_Tablet_State_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kServiceLocatorFieldNumber = 6,
+    kTableIdFieldNumber = 1,
+    kStartKeyHashFieldNumber = 2,
+    kEndKeyHashFieldNumber = 3,
+    kServerIdFieldNumber = 5,
+    kStateFieldNumber = 4,
+    kCtimeLogHeadOffsetFieldNumber = 9,
+    kUserDataFieldNumber = 7,
+    kCtimeLogHeadIdFieldNumber = 8,
+  };
+  // optional string service_locator = 6;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required uint64 table_id = 1;
+  bool has_table_id() const;
+  private:
+  bool _internal_has_table_id() const;
+  public:
+  void clear_table_id();
+  uint64_t table_id() const;
+  void set_table_id(uint64_t value);
+  private:
+  uint64_t _internal_table_id() const;
+  void _internal_set_table_id(uint64_t value);
+  public:
+
+  // required uint64 start_key_hash = 2;
+  bool has_start_key_hash() const;
+  private:
+  bool _internal_has_start_key_hash() const;
+  public:
+  void clear_start_key_hash();
+  uint64_t start_key_hash() const;
+  void set_start_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_start_key_hash() const;
+  void _internal_set_start_key_hash(uint64_t value);
+  public:
+
+  // required uint64 end_key_hash = 3;
+  bool has_end_key_hash() const;
+  private:
+  bool _internal_has_end_key_hash() const;
+  public:
+  void clear_end_key_hash();
+  uint64_t end_key_hash() const;
+  void set_end_key_hash(uint64_t value);
+  private:
+  uint64_t _internal_end_key_hash() const;
+  void _internal_set_end_key_hash(uint64_t value);
+  public:
+
+  // optional fixed64 server_id = 5;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet_State state() const;
+  void set_state(::RAMCloud::ProtoBuf::TableConfig_Tablet_State value);
+  private:
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet_State _internal_state() const;
+  void _internal_set_state(::RAMCloud::ProtoBuf::TableConfig_Tablet_State value);
+  public:
+
+  // required uint32 ctime_log_head_offset = 9;
+  bool has_ctime_log_head_offset() const;
+  private:
+  bool _internal_has_ctime_log_head_offset() const;
+  public:
+  void clear_ctime_log_head_offset();
+  uint32_t ctime_log_head_offset() const;
+  void set_ctime_log_head_offset(uint32_t value);
+  private:
+  uint32_t _internal_ctime_log_head_offset() const;
+  void _internal_set_ctime_log_head_offset(uint32_t value);
+  public:
+
+  // optional fixed64 user_data = 7;
+  bool has_user_data() const;
+  private:
+  bool _internal_has_user_data() const;
+  public:
+  void clear_user_data();
+  uint64_t user_data() const;
+  void set_user_data(uint64_t value);
+  private:
+  uint64_t _internal_user_data() const;
+  void _internal_set_user_data(uint64_t value);
+  public:
+
+  // required uint64 ctime_log_head_id = 8;
+  bool has_ctime_log_head_id() const;
+  private:
+  bool _internal_has_ctime_log_head_id() const;
+  public:
+  void clear_ctime_log_head_id();
+  uint64_t ctime_log_head_id() const;
+  void set_ctime_log_head_id(uint64_t value);
+  private:
+  uint64_t _internal_ctime_log_head_id() const;
+  void _internal_set_ctime_log_head_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableConfig.Tablet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t table_id_;
+    uint64_t start_key_hash_;
+    uint64_t end_key_hash_;
+    uint64_t server_id_;
+    int state_;
+    uint32_t ctime_log_head_offset_;
+    uint64_t user_data_;
+    uint64_t ctime_log_head_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableConfig_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TableConfig_Index_Indexlet final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet) */ {
+ public:
+  inline TableConfig_Index_Indexlet() : TableConfig_Index_Indexlet(nullptr) {}
+  ~TableConfig_Index_Indexlet() override;
+  explicit PROTOBUF_CONSTEXPR TableConfig_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableConfig_Index_Indexlet(const TableConfig_Index_Indexlet& from);
+  TableConfig_Index_Indexlet(TableConfig_Index_Indexlet&& from) noexcept
+    : TableConfig_Index_Indexlet() {
+    *this = ::std::move(from);
+  }
+
+  inline TableConfig_Index_Indexlet& operator=(const TableConfig_Index_Indexlet& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableConfig_Index_Indexlet& operator=(TableConfig_Index_Indexlet&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableConfig_Index_Indexlet& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableConfig_Index_Indexlet* internal_default_instance() {
+    return reinterpret_cast<const TableConfig_Index_Indexlet*>(
+               &_TableConfig_Index_Indexlet_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TableConfig_Index_Indexlet& a, TableConfig_Index_Indexlet& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableConfig_Index_Indexlet* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableConfig_Index_Indexlet* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableConfig_Index_Indexlet* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableConfig_Index_Indexlet>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableConfig_Index_Indexlet& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableConfig_Index_Indexlet& from) {
+    TableConfig_Index_Indexlet::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableConfig_Index_Indexlet* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableConfig.Index.Indexlet";
+  }
+  protected:
+  explicit TableConfig_Index_Indexlet(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartKeyFieldNumber = 1,
+    kEndKeyFieldNumber = 2,
+    kServiceLocatorFieldNumber = 4,
+    kServerIdFieldNumber = 3,
+  };
+  // required bytes start_key = 1;
+  bool has_start_key() const;
+  private:
+  bool _internal_has_start_key() const;
+  public:
+  void clear_start_key();
+  const std::string& start_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start_key();
+  PROTOBUF_NODISCARD std::string* release_start_key();
+  void set_allocated_start_key(std::string* start_key);
+  private:
+  const std::string& _internal_start_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start_key(const std::string& value);
+  std::string* _internal_mutable_start_key();
+  public:
+
+  // required bytes end_key = 2;
+  bool has_end_key() const;
+  private:
+  bool _internal_has_end_key() const;
+  public:
+  void clear_end_key();
+  const std::string& end_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end_key();
+  PROTOBUF_NODISCARD std::string* release_end_key();
+  void set_allocated_end_key(std::string* end_key);
+  private:
+  const std::string& _internal_end_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end_key(const std::string& value);
+  std::string* _internal_mutable_end_key();
+  public:
+
+  // required string service_locator = 4;
+  bool has_service_locator() const;
+  private:
+  bool _internal_has_service_locator() const;
+  public:
+  void clear_service_locator();
+  const std::string& service_locator() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_service_locator(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_service_locator();
+  PROTOBUF_NODISCARD std::string* release_service_locator();
+  void set_allocated_service_locator(std::string* service_locator);
+  private:
+  const std::string& _internal_service_locator() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_service_locator(const std::string& value);
+  std::string* _internal_mutable_service_locator();
+  public:
+
+  // required fixed64 server_id = 3;
+  bool has_server_id() const;
+  private:
+  bool _internal_has_server_id() const;
+  public:
+  void clear_server_id();
+  uint64_t server_id() const;
+  void set_server_id(uint64_t value);
+  private:
+  uint64_t _internal_server_id() const;
+  void _internal_set_server_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr service_locator_;
+    uint64_t server_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableConfig_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TableConfig_Index final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableConfig.Index) */ {
+ public:
+  inline TableConfig_Index() : TableConfig_Index(nullptr) {}
+  ~TableConfig_Index() override;
+  explicit PROTOBUF_CONSTEXPR TableConfig_Index(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableConfig_Index(const TableConfig_Index& from);
+  TableConfig_Index(TableConfig_Index&& from) noexcept
+    : TableConfig_Index() {
+    *this = ::std::move(from);
+  }
+
+  inline TableConfig_Index& operator=(const TableConfig_Index& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableConfig_Index& operator=(TableConfig_Index&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableConfig_Index& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableConfig_Index* internal_default_instance() {
+    return reinterpret_cast<const TableConfig_Index*>(
+               &_TableConfig_Index_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TableConfig_Index& a, TableConfig_Index& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableConfig_Index* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableConfig_Index* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableConfig_Index* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableConfig_Index>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableConfig_Index& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableConfig_Index& from) {
+    TableConfig_Index::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableConfig_Index* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableConfig.Index";
+  }
+  protected:
+  explicit TableConfig_Index(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TableConfig_Index_Indexlet Indexlet;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIndexletFieldNumber = 3,
+    kIndexIdFieldNumber = 1,
+    kIndexTypeFieldNumber = 2,
+  };
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index.Indexlet indexlet = 3;
+  int indexlet_size() const;
+  private:
+  int _internal_indexlet_size() const;
+  public:
+  void clear_indexlet();
+  ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* mutable_indexlet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >*
+      mutable_indexlet();
+  private:
+  const ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet& _internal_indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* _internal_add_indexlet();
+  public:
+  const ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet& indexlet(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* add_indexlet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >&
+      indexlet() const;
+
+  // required uint32 index_id = 1;
+  bool has_index_id() const;
+  private:
+  bool _internal_has_index_id() const;
+  public:
+  void clear_index_id();
+  uint32_t index_id() const;
+  void set_index_id(uint32_t value);
+  private:
+  uint32_t _internal_index_id() const;
+  void _internal_set_index_id(uint32_t value);
+  public:
+
+  // required uint32 index_type = 2;
+  bool has_index_type() const;
+  private:
+  bool _internal_has_index_type() const;
+  public:
+  void clear_index_type();
+  uint32_t index_type() const;
+  void set_index_type(uint32_t value);
+  private:
+  uint32_t _internal_index_type() const;
+  void _internal_set_index_type(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableConfig.Index)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet > indexlet_;
+    uint32_t index_id_;
+    uint32_t index_type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableConfig_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TableConfig final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:RAMCloud.ProtoBuf.TableConfig) */ {
+ public:
+  inline TableConfig() : TableConfig(nullptr) {}
+  ~TableConfig() override;
+  explicit PROTOBUF_CONSTEXPR TableConfig(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TableConfig(const TableConfig& from);
+  TableConfig(TableConfig&& from) noexcept
+    : TableConfig() {
+    *this = ::std::move(from);
+  }
+
+  inline TableConfig& operator=(const TableConfig& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TableConfig& operator=(TableConfig&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TableConfig& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TableConfig* internal_default_instance() {
+    return reinterpret_cast<const TableConfig*>(
+               &_TableConfig_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TableConfig& a, TableConfig& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TableConfig* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TableConfig* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TableConfig* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TableConfig>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TableConfig& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TableConfig& from) {
+    TableConfig::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TableConfig* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "RAMCloud.ProtoBuf.TableConfig";
+  }
+  protected:
+  explicit TableConfig(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef TableConfig_Tablet Tablet;
+  typedef TableConfig_Index Index;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTabletFieldNumber = 1,
+    kIndexFieldNumber = 2,
+  };
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Tablet tablet = 1;
+  int tablet_size() const;
+  private:
+  int _internal_tablet_size() const;
+  public:
+  void clear_tablet();
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet* mutable_tablet(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Tablet >*
+      mutable_tablet();
+  private:
+  const ::RAMCloud::ProtoBuf::TableConfig_Tablet& _internal_tablet(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet* _internal_add_tablet();
+  public:
+  const ::RAMCloud::ProtoBuf::TableConfig_Tablet& tablet(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet* add_tablet();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Tablet >&
+      tablet() const;
+
+  // repeated .RAMCloud.ProtoBuf.TableConfig.Index index = 2;
+  int index_size() const;
+  private:
+  int _internal_index_size() const;
+  public:
+  void clear_index();
+  ::RAMCloud::ProtoBuf::TableConfig_Index* mutable_index(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index >*
+      mutable_index();
+  private:
+  const ::RAMCloud::ProtoBuf::TableConfig_Index& _internal_index(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Index* _internal_add_index();
+  public:
+  const ::RAMCloud::ProtoBuf::TableConfig_Index& index(int index) const;
+  ::RAMCloud::ProtoBuf::TableConfig_Index* add_index();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index >&
+      index() const;
+
+  // @@protoc_insertion_point(class_scope:RAMCloud.ProtoBuf.TableConfig)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Tablet > tablet_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index > index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TableConfig_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TableConfig_Tablet
+
+// required uint64 table_id = 1;
+inline bool TableConfig_Tablet::_internal_has_table_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_table_id() const {
+  return _internal_has_table_id();
+}
+inline void TableConfig_Tablet::clear_table_id() {
+  _impl_.table_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t TableConfig_Tablet::_internal_table_id() const {
+  return _impl_.table_id_;
+}
+inline uint64_t TableConfig_Tablet::table_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.table_id)
+  return _internal_table_id();
+}
+inline void TableConfig_Tablet::_internal_set_table_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.table_id_ = value;
+}
+inline void TableConfig_Tablet::set_table_id(uint64_t value) {
+  _internal_set_table_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.table_id)
+}
+
+// required uint64 start_key_hash = 2;
+inline bool TableConfig_Tablet::_internal_has_start_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_start_key_hash() const {
+  return _internal_has_start_key_hash();
+}
+inline void TableConfig_Tablet::clear_start_key_hash() {
+  _impl_.start_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t TableConfig_Tablet::_internal_start_key_hash() const {
+  return _impl_.start_key_hash_;
+}
+inline uint64_t TableConfig_Tablet::start_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.start_key_hash)
+  return _internal_start_key_hash();
+}
+inline void TableConfig_Tablet::_internal_set_start_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.start_key_hash_ = value;
+}
+inline void TableConfig_Tablet::set_start_key_hash(uint64_t value) {
+  _internal_set_start_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.start_key_hash)
+}
+
+// required uint64 end_key_hash = 3;
+inline bool TableConfig_Tablet::_internal_has_end_key_hash() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_end_key_hash() const {
+  return _internal_has_end_key_hash();
+}
+inline void TableConfig_Tablet::clear_end_key_hash() {
+  _impl_.end_key_hash_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t TableConfig_Tablet::_internal_end_key_hash() const {
+  return _impl_.end_key_hash_;
+}
+inline uint64_t TableConfig_Tablet::end_key_hash() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.end_key_hash)
+  return _internal_end_key_hash();
+}
+inline void TableConfig_Tablet::_internal_set_end_key_hash(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_key_hash_ = value;
+}
+inline void TableConfig_Tablet::set_end_key_hash(uint64_t value) {
+  _internal_set_end_key_hash(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.end_key_hash)
+}
+
+// required .RAMCloud.ProtoBuf.TableConfig.Tablet.State state = 4;
+inline bool TableConfig_Tablet::_internal_has_state() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_state() const {
+  return _internal_has_state();
+}
+inline void TableConfig_Tablet::clear_state() {
+  _impl_.state_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Tablet_State TableConfig_Tablet::_internal_state() const {
+  return static_cast< ::RAMCloud::ProtoBuf::TableConfig_Tablet_State >(_impl_.state_);
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Tablet_State TableConfig_Tablet::state() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.state)
+  return _internal_state();
+}
+inline void TableConfig_Tablet::_internal_set_state(::RAMCloud::ProtoBuf::TableConfig_Tablet_State value) {
+  assert(::RAMCloud::ProtoBuf::TableConfig_Tablet_State_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.state_ = value;
+}
+inline void TableConfig_Tablet::set_state(::RAMCloud::ProtoBuf::TableConfig_Tablet_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.state)
+}
+
+// optional fixed64 server_id = 5;
+inline bool TableConfig_Tablet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void TableConfig_Tablet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t TableConfig_Tablet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t TableConfig_Tablet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.server_id)
+  return _internal_server_id();
+}
+inline void TableConfig_Tablet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.server_id_ = value;
+}
+inline void TableConfig_Tablet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.server_id)
+}
+
+// optional string service_locator = 6;
+inline bool TableConfig_Tablet::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void TableConfig_Tablet::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableConfig_Tablet::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableConfig_Tablet::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator)
+}
+inline std::string* TableConfig_Tablet::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator)
+  return _s;
+}
+inline const std::string& TableConfig_Tablet::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void TableConfig_Tablet::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableConfig_Tablet::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableConfig_Tablet::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableConfig_Tablet::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableConfig.Tablet.service_locator)
+}
+
+// optional fixed64 user_data = 7;
+inline bool TableConfig_Tablet::_internal_has_user_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_user_data() const {
+  return _internal_has_user_data();
+}
+inline void TableConfig_Tablet::clear_user_data() {
+  _impl_.user_data_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t TableConfig_Tablet::_internal_user_data() const {
+  return _impl_.user_data_;
+}
+inline uint64_t TableConfig_Tablet::user_data() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.user_data)
+  return _internal_user_data();
+}
+inline void TableConfig_Tablet::_internal_set_user_data(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.user_data_ = value;
+}
+inline void TableConfig_Tablet::set_user_data(uint64_t value) {
+  _internal_set_user_data(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.user_data)
+}
+
+// required uint64 ctime_log_head_id = 8;
+inline bool TableConfig_Tablet::_internal_has_ctime_log_head_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_ctime_log_head_id() const {
+  return _internal_has_ctime_log_head_id();
+}
+inline void TableConfig_Tablet::clear_ctime_log_head_id() {
+  _impl_.ctime_log_head_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t TableConfig_Tablet::_internal_ctime_log_head_id() const {
+  return _impl_.ctime_log_head_id_;
+}
+inline uint64_t TableConfig_Tablet::ctime_log_head_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.ctime_log_head_id)
+  return _internal_ctime_log_head_id();
+}
+inline void TableConfig_Tablet::_internal_set_ctime_log_head_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.ctime_log_head_id_ = value;
+}
+inline void TableConfig_Tablet::set_ctime_log_head_id(uint64_t value) {
+  _internal_set_ctime_log_head_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.ctime_log_head_id)
+}
+
+// required uint32 ctime_log_head_offset = 9;
+inline bool TableConfig_Tablet::_internal_has_ctime_log_head_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool TableConfig_Tablet::has_ctime_log_head_offset() const {
+  return _internal_has_ctime_log_head_offset();
+}
+inline void TableConfig_Tablet::clear_ctime_log_head_offset() {
+  _impl_.ctime_log_head_offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t TableConfig_Tablet::_internal_ctime_log_head_offset() const {
+  return _impl_.ctime_log_head_offset_;
+}
+inline uint32_t TableConfig_Tablet::ctime_log_head_offset() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Tablet.ctime_log_head_offset)
+  return _internal_ctime_log_head_offset();
+}
+inline void TableConfig_Tablet::_internal_set_ctime_log_head_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.ctime_log_head_offset_ = value;
+}
+inline void TableConfig_Tablet::set_ctime_log_head_offset(uint32_t value) {
+  _internal_set_ctime_log_head_offset(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Tablet.ctime_log_head_offset)
+}
+
+// -------------------------------------------------------------------
+
+// TableConfig_Index_Indexlet
+
+// required bytes start_key = 1;
+inline bool TableConfig_Index_Indexlet::_internal_has_start_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableConfig_Index_Indexlet::has_start_key() const {
+  return _internal_has_start_key();
+}
+inline void TableConfig_Index_Indexlet::clear_start_key() {
+  _impl_.start_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableConfig_Index_Indexlet::start_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.start_key)
+  return _internal_start_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableConfig_Index_Indexlet::set_start_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.start_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.start_key)
+}
+inline std::string* TableConfig_Index_Indexlet::mutable_start_key() {
+  std::string* _s = _internal_mutable_start_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.start_key)
+  return _s;
+}
+inline const std::string& TableConfig_Index_Indexlet::_internal_start_key() const {
+  return _impl_.start_key_.Get();
+}
+inline void TableConfig_Index_Indexlet::_internal_set_start_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::_internal_mutable_start_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.start_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::release_start_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.start_key)
+  if (!_internal_has_start_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.start_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableConfig_Index_Indexlet::set_allocated_start_key(std::string* start_key) {
+  if (start_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.start_key_.SetAllocated(start_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_key_.IsDefault()) {
+    _impl_.start_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.start_key)
+}
+
+// required bytes end_key = 2;
+inline bool TableConfig_Index_Indexlet::_internal_has_end_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableConfig_Index_Indexlet::has_end_key() const {
+  return _internal_has_end_key();
+}
+inline void TableConfig_Index_Indexlet::clear_end_key() {
+  _impl_.end_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& TableConfig_Index_Indexlet::end_key() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.end_key)
+  return _internal_end_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableConfig_Index_Indexlet::set_end_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.end_key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.end_key)
+}
+inline std::string* TableConfig_Index_Indexlet::mutable_end_key() {
+  std::string* _s = _internal_mutable_end_key();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.end_key)
+  return _s;
+}
+inline const std::string& TableConfig_Index_Indexlet::_internal_end_key() const {
+  return _impl_.end_key_.Get();
+}
+inline void TableConfig_Index_Indexlet::_internal_set_end_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::_internal_mutable_end_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.end_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::release_end_key() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.end_key)
+  if (!_internal_has_end_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.end_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableConfig_Index_Indexlet::set_allocated_end_key(std::string* end_key) {
+  if (end_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.end_key_.SetAllocated(end_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_key_.IsDefault()) {
+    _impl_.end_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.end_key)
+}
+
+// required fixed64 server_id = 3;
+inline bool TableConfig_Index_Indexlet::_internal_has_server_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool TableConfig_Index_Indexlet::has_server_id() const {
+  return _internal_has_server_id();
+}
+inline void TableConfig_Index_Indexlet::clear_server_id() {
+  _impl_.server_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t TableConfig_Index_Indexlet::_internal_server_id() const {
+  return _impl_.server_id_;
+}
+inline uint64_t TableConfig_Index_Indexlet::server_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.server_id)
+  return _internal_server_id();
+}
+inline void TableConfig_Index_Indexlet::_internal_set_server_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.server_id_ = value;
+}
+inline void TableConfig_Index_Indexlet::set_server_id(uint64_t value) {
+  _internal_set_server_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.server_id)
+}
+
+// required string service_locator = 4;
+inline bool TableConfig_Index_Indexlet::_internal_has_service_locator() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool TableConfig_Index_Indexlet::has_service_locator() const {
+  return _internal_has_service_locator();
+}
+inline void TableConfig_Index_Indexlet::clear_service_locator() {
+  _impl_.service_locator_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& TableConfig_Index_Indexlet::service_locator() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator)
+  return _internal_service_locator();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableConfig_Index_Indexlet::set_service_locator(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.service_locator_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator)
+}
+inline std::string* TableConfig_Index_Indexlet::mutable_service_locator() {
+  std::string* _s = _internal_mutable_service_locator();
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator)
+  return _s;
+}
+inline const std::string& TableConfig_Index_Indexlet::_internal_service_locator() const {
+  return _impl_.service_locator_.Get();
+}
+inline void TableConfig_Index_Indexlet::_internal_set_service_locator(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.service_locator_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::_internal_mutable_service_locator() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.service_locator_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableConfig_Index_Indexlet::release_service_locator() {
+  // @@protoc_insertion_point(field_release:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator)
+  if (!_internal_has_service_locator()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.service_locator_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableConfig_Index_Indexlet::set_allocated_service_locator(std::string* service_locator) {
+  if (service_locator != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.service_locator_.SetAllocated(service_locator, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.service_locator_.IsDefault()) {
+    _impl_.service_locator_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:RAMCloud.ProtoBuf.TableConfig.Index.Indexlet.service_locator)
+}
+
+// -------------------------------------------------------------------
+
+// TableConfig_Index
+
+// required uint32 index_id = 1;
+inline bool TableConfig_Index::_internal_has_index_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableConfig_Index::has_index_id() const {
+  return _internal_has_index_id();
+}
+inline void TableConfig_Index::clear_index_id() {
+  _impl_.index_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t TableConfig_Index::_internal_index_id() const {
+  return _impl_.index_id_;
+}
+inline uint32_t TableConfig_Index::index_id() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.index_id)
+  return _internal_index_id();
+}
+inline void TableConfig_Index::_internal_set_index_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.index_id_ = value;
+}
+inline void TableConfig_Index::set_index_id(uint32_t value) {
+  _internal_set_index_id(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.index_id)
+}
+
+// required uint32 index_type = 2;
+inline bool TableConfig_Index::_internal_has_index_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool TableConfig_Index::has_index_type() const {
+  return _internal_has_index_type();
+}
+inline void TableConfig_Index::clear_index_type() {
+  _impl_.index_type_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t TableConfig_Index::_internal_index_type() const {
+  return _impl_.index_type_;
+}
+inline uint32_t TableConfig_Index::index_type() const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.index_type)
+  return _internal_index_type();
+}
+inline void TableConfig_Index::_internal_set_index_type(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.index_type_ = value;
+}
+inline void TableConfig_Index::set_index_type(uint32_t value) {
+  _internal_set_index_type(value);
+  // @@protoc_insertion_point(field_set:RAMCloud.ProtoBuf.TableConfig.Index.index_type)
+}
+
+// repeated .RAMCloud.ProtoBuf.TableConfig.Index.Indexlet indexlet = 3;
+inline int TableConfig_Index::_internal_indexlet_size() const {
+  return _impl_.indexlet_.size();
+}
+inline int TableConfig_Index::indexlet_size() const {
+  return _internal_indexlet_size();
+}
+inline void TableConfig_Index::clear_indexlet() {
+  _impl_.indexlet_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* TableConfig_Index::mutable_indexlet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.Index.indexlet)
+  return _impl_.indexlet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >*
+TableConfig_Index::mutable_indexlet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.TableConfig.Index.indexlet)
+  return &_impl_.indexlet_;
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet& TableConfig_Index::_internal_indexlet(int index) const {
+  return _impl_.indexlet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet& TableConfig_Index::indexlet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.Index.indexlet)
+  return _internal_indexlet(index);
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* TableConfig_Index::_internal_add_indexlet() {
+  return _impl_.indexlet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* TableConfig_Index::add_indexlet() {
+  ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet* _add = _internal_add_indexlet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.TableConfig.Index.indexlet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index_Indexlet >&
+TableConfig_Index::indexlet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.TableConfig.Index.indexlet)
+  return _impl_.indexlet_;
+}
+
+// -------------------------------------------------------------------
+
+// TableConfig
+
+// repeated .RAMCloud.ProtoBuf.TableConfig.Tablet tablet = 1;
+inline int TableConfig::_internal_tablet_size() const {
+  return _impl_.tablet_.size();
+}
+inline int TableConfig::tablet_size() const {
+  return _internal_tablet_size();
+}
+inline void TableConfig::clear_tablet() {
+  _impl_.tablet_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Tablet* TableConfig::mutable_tablet(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.tablet)
+  return _impl_.tablet_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Tablet >*
+TableConfig::mutable_tablet() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.TableConfig.tablet)
+  return &_impl_.tablet_;
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Tablet& TableConfig::_internal_tablet(int index) const {
+  return _impl_.tablet_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Tablet& TableConfig::tablet(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.tablet)
+  return _internal_tablet(index);
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Tablet* TableConfig::_internal_add_tablet() {
+  return _impl_.tablet_.Add();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Tablet* TableConfig::add_tablet() {
+  ::RAMCloud::ProtoBuf::TableConfig_Tablet* _add = _internal_add_tablet();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.TableConfig.tablet)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Tablet >&
+TableConfig::tablet() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.TableConfig.tablet)
+  return _impl_.tablet_;
+}
+
+// repeated .RAMCloud.ProtoBuf.TableConfig.Index index = 2;
+inline int TableConfig::_internal_index_size() const {
+  return _impl_.index_.size();
+}
+inline int TableConfig::index_size() const {
+  return _internal_index_size();
+}
+inline void TableConfig::clear_index() {
+  _impl_.index_.Clear();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index* TableConfig::mutable_index(int index) {
+  // @@protoc_insertion_point(field_mutable:RAMCloud.ProtoBuf.TableConfig.index)
+  return _impl_.index_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index >*
+TableConfig::mutable_index() {
+  // @@protoc_insertion_point(field_mutable_list:RAMCloud.ProtoBuf.TableConfig.index)
+  return &_impl_.index_;
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Index& TableConfig::_internal_index(int index) const {
+  return _impl_.index_.Get(index);
+}
+inline const ::RAMCloud::ProtoBuf::TableConfig_Index& TableConfig::index(int index) const {
+  // @@protoc_insertion_point(field_get:RAMCloud.ProtoBuf.TableConfig.index)
+  return _internal_index(index);
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index* TableConfig::_internal_add_index() {
+  return _impl_.index_.Add();
+}
+inline ::RAMCloud::ProtoBuf::TableConfig_Index* TableConfig::add_index() {
+  ::RAMCloud::ProtoBuf::TableConfig_Index* _add = _internal_add_index();
+  // @@protoc_insertion_point(field_add:RAMCloud.ProtoBuf.TableConfig.index)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::RAMCloud::ProtoBuf::TableConfig_Index >&
+TableConfig::index() const {
+  // @@protoc_insertion_point(field_list:RAMCloud.ProtoBuf.TableConfig.index)
+  return _impl_.index_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoBuf
+}  // namespace RAMCloud
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::RAMCloud::ProtoBuf::TableConfig_Tablet_State> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::RAMCloud::ProtoBuf::TableConfig_Tablet_State>() {
+  return ::RAMCloud::ProtoBuf::TableConfig_Tablet_State_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_TableConfig_2eproto
+// RAMCloud pragma [GCCWARN=0]
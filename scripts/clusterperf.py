@@ -914,6 +914,7 @@ graph_tests = [
     Test("readLoaded", readLoaded),
     Test("readRandom", readRandom),
     Test("readThroughput", readThroughput),
+    Test("readThroughputZipf", readThroughput),
     Test("readVaryingKeyLength", default),
     Test("transaction_collision", txCollision),
     Test("transaction_oneMaster", multiOp),
@@ -927,6 +928,7 @@ graph_tests = [
     Test("writeDistWorkload", workloadDist),
     Test("writeInterference", default),
     Test("writeThroughput", readThroughput),
+    Test("writeThroughputScaling", readThroughput),
     Test("workloadThroughput", readThroughput),
     Test("migrateLoaded", migrateLoaded),
 ]
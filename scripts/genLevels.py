@@ -56,6 +56,7 @@ callees = {
     "HINT_SERVER_CRASHED":   ["PING"],
     "INCREMENT":             ["BACKUP_WRITE"],
     "INSERT_INDEX_ENTRY":    ["BACKUP_WRITE"],
+    "LOOKUP_INDEX_OBJECTS":  ["READ_HASHES"],
     "MIGRATE_TABLET":        ["RECEIVE_MIGRATION_DATA",
                               "REASSIGN_TABLET_OWNERSHIP"],
     "MULTI_OP":              ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
@@ -65,7 +66,8 @@ callees = {
     "READ_KEYS_AND_VALUE":   ["BACKUP_WRITE"],
     "REASSIGN_TABLET_OWNERSHIP": ["TAKE_TABLET_OWNERSHIP"],
     "RECEIVE_MIGRATION_DATA":["BACKUP_WRITE"],
-    "RECOVER":               ["BACKUP_GETRECOVERYDATA", "BACKUP_WRITE"],
+    "RECOVER":               ["BACKUP_GETRECOVERYDATA", "BACKUP_WRITE",
+                              "WITNESS_GET_RECOVERY_DATA"],
     "REMOVE":                ["BACKUP_WRITE", "REMOVE_INDEX_ENTRY"],
     "REMOVE_INDEX_ENTRY":    ["BACKUP_WRITE"],
     "SERVER_CONTROL_ALL":    ["SERVER_CONTROL"],
@@ -77,7 +79,7 @@ callees = {
     "TX_PREPARE":            ["BACKUP_WRITE"],
     "TX_REQUEST_ABORT":      ["BACKUP_WRITE"],
     "WRITE":                 ["BACKUP_WRITE", "INSERT_INDEX_ENTRY",
-                              "REMOVE_INDEX_ENTRY"],
+                              "REMOVE_INDEX_ENTRY", "WITNESS_GC"],
 }
 
 # The following dictionary maps from the name of an opcode to its
@@ -187,6 +187,11 @@ master.metric('verifyChecksumTicks',
     'time verifying checksums on objects from backups')
 master.metric('recoverSegmentTicks',
     'spent in MasterService::recoverSegment')
+master.metric('recoveryReplayThreads',
+    'number of threads replaying recovery segments concurrently')
+master.metric('recoveryReplayTicks',
+    'elapsed time from the start of the first recovery segment replay '
+    'until the last one finished')
 master.metric('backupInRecoverTicks',
     'time spent in ReplicaManager::proceed '
     'called from MasterService::recoverSegment')
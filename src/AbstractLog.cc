@@ -82,37 +82,45 @@ bool
 AbstractLog::append(AppendVector* appends, uint32_t numAppends)
 {
     CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
-    SpinLock::Guard lock(appendLock);
-    metrics.totalAppendCalls++;
-
-    uint32_t lengths[numAppends];
-    for (uint32_t i = 0; i < numAppends; i++)
-        lengths[i] = appends[i].buffer.size();
+    PendingCopy copies[numAppends];
+    {
+        SpinLock::Guard lock(appendLock);
+        metrics.totalAppendCalls++;
+
+        uint32_t lengths[numAppends];
+        for (uint32_t i = 0; i < numAppends; i++)
+            lengths[i] = appends[i].buffer.size();
+
+        if (head == NULL || !head->hasSpaceFor(lengths, numAppends)) {
+            if (!allocNewWritableHead())
+                return false;
+        }
 
-    if (head == NULL || !head->hasSpaceFor(lengths, numAppends)) {
-        if (!allocNewWritableHead())
+        if (head->isEmergencyHead)
             return false;
-    }
 
-    if (head->isEmergencyHead)
-        return false;
-
-    if (!head->hasSpaceFor(lengths, numAppends))
-        throw FatalError(HERE, "too much data to append to one segment");
-
-    LogSegment* headBefore = head;
-    for (uint32_t i = 0; i < numAppends; i++) {
-        bool enoughSpace = append(lock,
-                                  appends[i].type,
-                                  appends[i].buffer,
-                                  &appends[i].reference);
-        if (!enoughSpace)
-            throw FatalError(HERE, "Guaranteed append managed to fail");
-    }
-    if (head != headBefore) {
-        assert(head == headBefore);
+        if (!head->hasSpaceFor(lengths, numAppends))
+            throw FatalError(HERE, "too much data to append to one segment");
+
+        LogSegment* headBefore = head;
+        for (uint32_t i = 0; i < numAppends; i++) {
+            bool enoughSpace = append(lock,
+                                      appends[i].type,
+                                      appends[i].buffer,
+                                      &appends[i].reference,
+                                      NULL,
+                                      &copies[i]);
+            if (!enoughSpace)
+                throw FatalError(HERE, "Guaranteed append managed to fail");
+        }
+        if (head != headBefore) {
+            assert(head == headBefore);
+        }
     }
 
+    for (uint32_t i = 0; i < numAppends; i++)
+        copies[i].finish();
+
     return true;
 }
 
@@ -134,46 +142,54 @@ AbstractLog::append(Buffer *logBuffer, Reference *references,
                     uint32_t numEntries)
 {
     CycleCounter<uint64_t> _(&metrics.totalAppendTicks);
-    SpinLock::Guard lock(appendLock);
-    metrics.totalAppendCalls++;
+    PendingCopy copies[numEntries];
+    {
+        SpinLock::Guard lock(appendLock);
+        metrics.totalAppendCalls++;
+
+        if (head == NULL || !head->hasSpaceFor(logBuffer->size())) {
+            if (!allocNewWritableHead())
+                return false;
+        }
 
-    if (head == NULL || !head->hasSpaceFor(logBuffer->size())) {
-        if (!allocNewWritableHead())
+        if (head->isEmergencyHead)
             return false;
-    }
 
-    if (head->isEmergencyHead)
-        return false;
+        if (!head->hasSpaceFor(logBuffer->size()))
+            throw FatalError(HERE, "too much data to append to one segment");
 
-    if (!head->hasSpaceFor(logBuffer->size()))
-        throw FatalError(HERE, "too much data to append to one segment");
+        LogSegment* headBefore = head;
 
-    LogSegment* headBefore = head;
+        // Makes sense to call getRange on the entire logBuffer here because
+        // everything n the buffer has to be written out before this function
+        // can return
+        const uint8_t* buffer = reinterpret_cast<const uint8_t*>(logBuffer->
+                                    getRange(0, logBuffer->size()));
+        if (!buffer) {
+            throw FatalError(HERE, "Ill-formed log entries in the buffer");
+        }
 
-    // Makes sense to call getRange on the entire logBuffer here because
-    // everything n the buffer has to be written out before this function
-    // can return
-    const uint8_t* buffer = reinterpret_cast<const uint8_t*>(logBuffer->
-                                getRange(0, logBuffer->size()));
-    if (!buffer) {
-        throw FatalError(HERE, "Ill-formed log entries in the buffer");
-    }
+        uint32_t entryLength = 0;
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < numEntries; i++) {
+            bool enoughSpace = append(lock,
+                                      buffer + offset,
+                                      &entryLength,
+                                      &references[i],
+                                      NULL,
+                                      &copies[i]);
+            if (!enoughSpace)
+                throw FatalError(HERE, "Guaranteed append managed to fail");
+            offset+= entryLength;
+        }
 
-    uint32_t entryLength = 0;
-    uint32_t offset = 0;
-    for (uint32_t i = 0; i < numEntries; i++) {
-        bool enoughSpace = append(lock,
-                                  buffer + offset,
-                                  &entryLength,
-                                  &references[i]);
-        if (!enoughSpace)
-            throw FatalError(HERE, "Guaranteed append managed to fail");
-        offset+= entryLength;
+        if (head != headBefore) {
+            assert(head == headBefore);
+        }
     }
 
-    if (head != headBefore) {
-        assert(head == headBefore);
-    }
+    for (uint32_t i = 0; i < numEntries; i++)
+        copies[i].finish();
 
     return true;
 }
@@ -342,6 +358,44 @@ AbstractLog::getSegment(Reference reference)
         reinterpret_cast<const void*>(reference.toInteger()));
 }
 
+/**
+ * Wait until every entry reserved in the given segment has had its contents
+ * copied in. Anything that reads, replicates, or closes a segment up to its
+ * current appended length must call this first.
+ *
+ * This method must be called with the appendLock held. No new reservations
+ * can be made, so this only waits for appending threads that have already
+ * dropped the lock to finish their memcpy.
+ *
+ * \param segment
+ *      The segment whose pending copies to wait for.
+ */
+void
+AbstractLog::waitForPendingCopies(LogSegment* segment)
+{
+    assert(!appendLock.try_lock());
+    while (segment->pendingCopies.load(std::memory_order_acquire) != 0) {
+        // Copies in flight are bounded by the number of appending threads
+        // and each is just a memcpy, so spin.
+    }
+}
+
+/**
+ * Copy an entry's contents into the space reserved for it and let anyone
+ * waiting in waitForPendingCopies() know that it is there. Must be called
+ * exactly once for every PendingCopy filled in by the private append
+ * methods, after the append lock has been released.
+ */
+void
+AbstractLog::PendingCopy::finish()
+{
+    if (segment == NULL)
+        return;
+    segment->copyInReserved(offset, data, length);
+    segment->pendingCopies.fetch_sub(1, std::memory_order_release);
+    segment = NULL;
+}
+
 /**
  * Append a typed entry to the log by copying in the data. Entries are binary
  * blobs described by a simple <type, length> tuple.
@@ -366,6 +420,11 @@ AbstractLog::getSegment(Reference reference)
  * \param[out] outTickCounter
  *      If non-NULL, store the number of processor ticks spent executing this
  *      method.
+ * \param[out] outCopy
+ *      If non-NULL, only reserve space for the entry's contents and describe
+ *      the copy still to be done here; the caller must finish() it after
+ *      releasing the append lock. If NULL, the contents are copied in before
+ *      returning.
  * \return
  *      True if the append succeeded, false if there was insufficient space
  *      to complete the operation.
@@ -376,7 +435,8 @@ AbstractLog::append(const SpinLock::Guard& lock,
             const void* buffer,
             uint32_t length,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            uint64_t* outTickCounter,
+            PendingCopy* outCopy)
 {
     CycleCounter<uint64_t> _(outTickCounter);
 
@@ -393,14 +453,15 @@ AbstractLog::append(const SpinLock::Guard& lock,
 
     // Try to append. If we can't, try to allocate a new head to get more space.
     Reference reference;
+    uint32_t dataOffset;
     uint32_t bytesUsedBefore = head->getAppendedLength();
-    bool enoughSpace = head->append(type, buffer, length, &reference);
+    bool enoughSpace = head->reserve(type, length, &dataOffset, &reference);
     if (!enoughSpace) {
         if (!allocNewWritableHead())
             return false;
 
         bytesUsedBefore = head->getAppendedLength();
-        if (!head->append(type, buffer, length, &reference)) {
+        if (!head->reserve(type, length, &dataOffset, &reference)) {
             LOG(ERROR, "Entry too big to append to log: %u bytes of type %d",
                 length, static_cast<int>(type));
             throw FatalError(HERE, "Entry too big to append to log");
@@ -410,6 +471,16 @@ AbstractLog::append(const SpinLock::Guard& lock,
     if (outReference != NULL)
         *outReference = reference;
 
+    if (outCopy != NULL) {
+        head->pendingCopies++;
+        outCopy->segment = head;
+        outCopy->offset = dataOffset;
+        outCopy->data = buffer;
+        outCopy->length = length;
+    } else {
+        head->copyInReserved(dataOffset, buffer, length);
+    }
+
     uint32_t lengthWithMetadata = head->getAppendedLength() - bytesUsedBefore;
 
     // Update log statistics so that the cleaner can make intelligent decisions
@@ -448,6 +519,11 @@ AbstractLog::append(const SpinLock::Guard& lock,
  * \param[out] outTickCounter
  *      If non-NULL, store the number of processor ticks spent executing this
  *      method.
+ * \param[out] outCopy
+ *      If non-NULL, only reserve space for the entry's contents and describe
+ *      the copy still to be done here; the caller must finish() it after
+ *      releasing the append lock. If NULL, the contents are copied in before
+ *      returning.
  * \return
  *      True if the append succeeded, false if there was insufficient space
  *      to complete the operation.
@@ -457,7 +533,8 @@ AbstractLog::append(const SpinLock::Guard& lock,
             const void* buffer,
             uint32_t *entryLength,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            uint64_t* outTickCounter,
+            PendingCopy* outCopy)
 {
     CycleCounter<uint64_t> _(outTickCounter);
 
@@ -476,15 +553,17 @@ AbstractLog::append(const SpinLock::Guard& lock,
     Reference reference;
     LogEntryType type;
     uint32_t entryDataLength = 0;
+    uint32_t dataOffset;
     uint32_t bytesUsedBefore = head->getAppendedLength();
-    bool enoughSpace = head->append(buffer, &entryDataLength,
-                                    &type, &reference);
+    bool enoughSpace = head->reserve(buffer, &entryDataLength,
+                                     &type, &dataOffset, &reference);
     if (!enoughSpace) {
         if (!allocNewWritableHead())
             return false;
 
         bytesUsedBefore = head->getAppendedLength();
-        if (!head->append(buffer, &entryDataLength, &type, &reference)) {
+        if (!head->reserve(buffer, &entryDataLength, &type, &dataOffset,
+                           &reference)) {
             LOG(ERROR, "Entry too big to append to log: %u bytes of type %d",
                 entryDataLength, static_cast<int>(type));
             throw FatalError(HERE, "Entry too big to append to log");
@@ -494,6 +573,20 @@ AbstractLog::append(const SpinLock::Guard& lock,
     if (outReference != NULL)
         *outReference = reference;
 
+    // The entry's contents follow its header in the source buffer exactly
+    // as they do in the segment.
+    const void* entryContents = static_cast<const uint8_t*>(buffer) +
+                                (dataOffset - bytesUsedBefore);
+    if (outCopy != NULL) {
+        head->pendingCopies++;
+        outCopy->segment = head;
+        outCopy->offset = dataOffset;
+        outCopy->data = entryContents;
+        outCopy->length = entryDataLength;
+    } else {
+        head->copyInReserved(dataOffset, entryContents, entryDataLength);
+    }
+
     uint32_t lengthWithMetadata = head->getAppendedLength() - bytesUsedBefore;
 
     if (entryLength)
@@ -535,6 +628,11 @@ AbstractLog::append(const SpinLock::Guard& lock,
  * \param[out] outTickCounter
  *      If non-NULL, store the number of processor ticks spent executing this
  *      method.
+ * \param[out] outCopy
+ *      If non-NULL, only reserve space for the entry's contents and describe
+ *      the copy still to be done here; the caller must finish() it after
+ *      releasing the append lock. If NULL, the contents are copied in before
+ *      returning.
  * \return
  *      True if the append succeeded, false if there was insufficient space to
  *      complete the operation.
@@ -544,14 +642,16 @@ AbstractLog::append(const SpinLock::Guard& lock,
             LogEntryType type,
             Buffer& buffer,
             Reference* outReference,
-            uint64_t* outTickCounter)
+            uint64_t* outTickCounter,
+            PendingCopy* outCopy)
 {
     return append(lock,
                   type,
                   buffer.getRange(0, buffer.size()),
                   buffer.size(),
                   outReference,
-                  outTickCounter);
+                  outTickCounter,
+                  outCopy);
 }
 
 /**
@@ -566,6 +666,11 @@ AbstractLog::append(const SpinLock::Guard& lock,
 bool
 AbstractLog::allocNewWritableHead()
 {
+    // The old head is closed (and its final length replicated) once the
+    // new one has been allocated, so its contents must be complete.
+    if (head != NULL)
+        waitForPendingCopies(head);
+
     LogSegment* newHead = allocNextSegment(false);
     if (newHead != NULL)
         head = newHead;
@@ -128,7 +128,8 @@ class AbstractLog {
      * These methods all call a common private append() core that is optimized
      * for the single const void* case. They also acquire append locks, since
      * the core function is lockless (to support atomic appends of multiple
-     * entries).
+     * entries). Only space is reserved while the lock is held; the entry's
+     * contents are copied in after it has been released.
      */
 
     /**
@@ -140,14 +141,17 @@ class AbstractLog {
            uint32_t length,
            Reference* outReference = NULL)
     {
-        SpinLock::Guard lock(appendLock);
-        metrics.totalAppendCalls++;
-        return append(lock,
-                      type,
-                      buffer,
-                      length,
-                      outReference,
-                      &metrics.totalAppendTicks);
+        PendingCopy copy;
+        {
+            SpinLock::Guard lock(appendLock);
+            metrics.totalAppendCalls++;
+            if (!append(lock, type, buffer, length, outReference,
+                        &metrics.totalAppendTicks, &copy)) {
+                return false;
+            }
+        }
+        copy.finish();
+        return true;
     }
 
     /**
@@ -158,19 +162,50 @@ class AbstractLog {
            Buffer& buffer,
            Reference* outReference = NULL)
     {
-        SpinLock::Guard lock(appendLock);
-        metrics.totalAppendCalls++;
-        return append(lock,
-                      type,
+        return append(type,
                       buffer.getRange(0, buffer.size()),
                       buffer.size(),
-                      outReference,
-                      &metrics.totalAppendTicks);
+                      outReference);
     }
 
 
   PROTECTED:
+    /**
+     * Describes the contents of an entry whose space was reserved in a segment
+     * while holding #appendLock, but which have not yet been copied in.
+     * Appending threads finish their copies after dropping the lock, so only
+     * the small, order-dependent metadata updates (entry headers, checksum,
+     * statistics) are serialized among them.
+     */
+    class PendingCopy {
+      public:
+        PendingCopy()
+            : segment(NULL),
+              offset(0),
+              data(NULL),
+              length(0)
+        {
+        }
+
+        void finish();
+
+        /// Segment the space was reserved in, or NULL if there is nothing
+        /// to copy.
+        LogSegment* segment;
+
+        /// Offset in #segment at which the contents belong.
+        uint32_t offset;
+
+        /// The entry's contents. The caller's memory; it must remain valid
+        /// until finish() returns.
+        const void* data;
+
+        /// Number of bytes at #data.
+        uint32_t length;
+    };
+
     LogSegment* getSegment(Reference reference);
+    void waitForPendingCopies(LogSegment* segment);
 
     /**
      * This virtual method is used to allocate the next segment to append
@@ -199,17 +234,20 @@ class AbstractLog {
                 const void* data,
                 uint32_t length,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
+                uint64_t* outTickCounter = NULL,
+                PendingCopy* outCopy = NULL);
     bool append(const SpinLock::Guard& lock,
                 const void* data,
                 uint32_t *entryLength = NULL,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
+                uint64_t* outTickCounter = NULL,
+                PendingCopy* outCopy = NULL);
     bool append(const SpinLock::Guard& lock,
                 LogEntryType type,
                 Buffer& buffer,
                 Reference* outReference = NULL,
-                uint64_t* outTickCounter = NULL);
+                uint64_t* outTickCounter = NULL,
+                PendingCopy* outCopy = NULL);
     bool allocNewWritableHead();
 
     /// Various handlers for entries appended to this log. Used to obtain
@@ -243,9 +281,11 @@ class AbstractLog {
     LogSegment* head;
 
     /// Lock taken around log append operations. This ensures that parallel
-    /// writers do not modify the head segment concurrently. The sync()
-    /// method also uses this lock to get a consistent view of the head
-    /// segment in the presence of multiple appending threads.
+    /// writers do not modify the head segment's metadata concurrently (entry
+    /// contents are copied in after it is released; see PendingCopy). The
+    /// sync() method also uses this lock, together with
+    /// waitForPendingCopies(), to get a consistent view of the head segment
+    /// in the presence of multiple appending threads.
     SpinLock appendLock;
 
     // Total amount of log space occupied by long-term data such as
@@ -302,9 +342,10 @@ class AbstractLog {
         /// called.
         uint64_t totalAppendCalls;
 
-        /// Total number of cpu cycles spent appending data. Includes any
-        /// synchronous replication time, but does not include waiting for
-        /// the log lock.
+        /// Total number of cpu cycles spent appending data while holding
+        /// the log lock. Includes any synchronous replication time, but
+        /// does not include waiting for the log lock or copying in entry
+        /// contents after it has been released.
         uint64_t totalAppendTicks;
 
         /// Total number of ticks spent out of memory and unable to service
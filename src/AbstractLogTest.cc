@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <thread>
+
 #include "TestUtil.h"
 
 #include "Segment.h"
@@ -185,6 +187,45 @@ TEST_F(AbstractLogTest, append_multipleLogEntries) {
     delete[] data;
 }
 
+TEST_F(AbstractLogTest, append_pendingCopy) {
+    Log::Reference reference;
+    AbstractLog::PendingCopy copy;
+    {
+        SpinLock::Guard lock(l.appendLock);
+        EXPECT_TRUE(l.append(lock, LOG_ENTRY_TYPE_OBJ, "hello", 6,
+                             &reference, NULL, &copy));
+    }
+    EXPECT_EQ(l.head, copy.segment);
+    EXPECT_EQ(1U, l.head->pendingCopies);
+    EXPECT_EQ(6U, copy.length);
+
+    copy.finish();
+    EXPECT_EQ(0U, l.head->pendingCopies);
+    EXPECT_TRUE(copy.segment == NULL);
+    Buffer buffer;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, l.getEntry(reference, buffer));
+    EXPECT_STREQ("hello", buffer.getStart<char>());
+
+    // A second finish() is a no-op.
+    copy.finish();
+    EXPECT_EQ(0U, l.head->pendingCopies);
+}
+
+TEST_F(AbstractLogTest, waitForPendingCopies) {
+    AbstractLog::PendingCopy copy;
+    SpinLock::Guard lock(l.appendLock);
+    EXPECT_TRUE(l.append(lock, LOG_ENTRY_TYPE_OBJ, "hello", 6,
+                         NULL, NULL, &copy));
+
+    std::thread copier([&copy] {
+        usleep(1000);
+        copy.finish();
+    });
+    l.waitForPendingCopies(l.head);
+    EXPECT_EQ(0U, l.head->pendingCopies);
+    copier.join();
+}
+
 TEST_F(AbstractLogTest, free) {
     uint64_t data = 0x123456789ABCDEF0UL;
     Buffer sourceBuffer;
@@ -298,11 +339,14 @@ class MockLog : public AbstractLog {
 TEST_F(AbstractLogTest, allocNewWritableHead) {
     TestLog::Enable _;
     MockLog ml(&l);
+    SpinLock::Guard lock(ml.appendLock);
 
-    ml.head = reinterpret_cast<LogSegment*>(0xdeadbeef);
+    vector<Seglet*> emptySegletVector;
+    LogSegment oldHead(emptySegletVector, 2, 2, 1982, 11, 0, false);
+    ml.head = &oldHead;
     EXPECT_FALSE(ml.metrics.noSpaceTimer);
     EXPECT_FALSE(ml.allocNewWritableHead());
-    EXPECT_EQ(reinterpret_cast<LogSegment*>(0xdeadbeef), ml.head);
+    EXPECT_EQ(&oldHead, ml.head);
     EXPECT_TRUE(ml.metrics.noSpaceTimer);
     EXPECT_EQ("allocNewWritableHead: No clean segments available; deferring "
             "operations until cleaner runs", TestLog::get());
@@ -652,4 +652,139 @@ WriteSegmentRpc::wait()
     waitAndCheckErrors();
 }
 
+/**
+ * Tell a witness that a master has made some writes durable, so the
+ * witness can drop its records of them.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param witnessId
+ *      The id of a server holding records for \a masterId.
+ * \param masterId
+ *      The id of the master that executed the writes.
+ * \param entries
+ *      Identifies the writes whose records can be dropped.
+ *
+ * \throw ServerNotUpException
+ *      The witness is not part of the cluster.
+ */
+void
+BackupClient::witnessGc(Context* context, ServerId witnessId,
+        ServerId masterId,
+        const std::vector<WireFormat::WitnessGc::Entry>& entries)
+{
+    WitnessGcRpc rpc(context, witnessId, masterId, entries);
+    rpc.wait();
+}
+
+/**
+ * Constructor for WitnessGcRpc: initiates an RPC in the same way as
+ * #BackupClient::witnessGc, but returns once the RPC has been initiated,
+ * without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param witnessId
+ *      The id of a server holding records for \a masterId.
+ * \param masterId
+ *      The id of the master that executed the writes.
+ * \param entries
+ *      Identifies the writes whose records can be dropped.
+ */
+WitnessGcRpc::WitnessGcRpc(Context* context, ServerId witnessId,
+        ServerId masterId,
+        const std::vector<WireFormat::WitnessGc::Entry>& entries)
+    : ServerIdRpcWrapper(context, witnessId,
+            sizeof(WireFormat::WitnessGc::Response))
+{
+    WireFormat::WitnessGc::Request* reqHdr(
+            allocHeader<WireFormat::WitnessGc>(witnessId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->numEntries = downCast<uint32_t>(entries.size());
+    request.appendCopy(entries.data(), downCast<uint32_t>(
+            entries.size() * sizeof(WireFormat::WitnessGc::Entry)));
+    send();
+}
+
+/**
+ * This method is invoked by recovery masters during crash recovery: it
+ * retrieves from a witness all the writes clients recorded there for the
+ * crashed master. The witness accepts no more records for that master.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param witnessId
+ *      The id of a server that may hold records for \a crashedMasterId.
+ * \param crashedMasterId
+ *      The id of the master being recovered.
+ * \param[out] response
+ *      A sequence of WireFormat::WitnessGetRecoveryData::Record structures,
+ *      each followed by the recorded WRITE request, is returned here.
+ * \return
+ *      The number of records in \a response.
+ *
+ * \throw ServerNotUpException
+ *      The witness is not part of the cluster.
+ */
+uint32_t
+BackupClient::witnessGetRecoveryData(Context* context, ServerId witnessId,
+        ServerId crashedMasterId, Buffer* response)
+{
+    WitnessGetRecoveryDataRpc rpc(context, witnessId, crashedMasterId,
+            response);
+    return rpc.wait();
+}
+
+/**
+ * Constructor for WitnessGetRecoveryDataRpc: initiates an RPC in the same
+ * way as #BackupClient::witnessGetRecoveryData, but returns once the RPC
+ * has been initiated, without waiting for it to complete.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server.
+ * \param witnessId
+ *      The id of a server that may hold records for \a crashedMasterId.
+ * \param crashedMasterId
+ *      The id of the master being recovered.
+ * \param[out] responseBuffer
+ *      The records are returned here; see
+ *      #BackupClient::witnessGetRecoveryData.
+ */
+WitnessGetRecoveryDataRpc::WitnessGetRecoveryDataRpc(Context* context,
+        ServerId witnessId, ServerId crashedMasterId, Buffer* responseBuffer)
+    : ServerIdRpcWrapper(context, witnessId,
+            sizeof(WireFormat::WitnessGetRecoveryData::Response),
+            responseBuffer)
+{
+    WireFormat::WitnessGetRecoveryData::Request* reqHdr(
+            allocHeader<WireFormat::WitnessGetRecoveryData>(witnessId));
+    reqHdr->crashedMasterId = crashedMasterId.getId();
+    send();
+}
+
+/**
+ * Wait for a witnessGetRecoveryData RPC to complete.
+ *
+ * \return
+ *      The number of records returned in the response buffer, which now
+ *      starts with the first record.
+ *
+ * \throw ServerNotUpException
+ *      The intended server for this RPC is not part of the cluster;
+ *      if it ever existed, it has since crashed.
+ */
+uint32_t
+WitnessGetRecoveryDataRpc::wait()
+{
+    waitAndCheckErrors();
+    const WireFormat::WitnessGetRecoveryData::Response* respHdr(
+            getResponseHeader<WireFormat::WitnessGetRecoveryData>());
+    uint32_t numRecords = respHdr->numRecords;
+
+    // respHdr off limits.
+    response->truncateFront(sizeof(
+            WireFormat::WitnessGetRecoveryData::Response));
+    return numRecords;
+}
+
 } // namespace RAMCloud
@@ -199,6 +199,37 @@ class WriteSegmentRpc : public ServerIdRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(WriteSegmentRpc);
 };
 
+/**
+ * Encapsulates the state of a BackupClient::witnessGc operation,
+ * allowing it to execute asynchronously.
+ */
+class WitnessGcRpc : public ServerIdRpcWrapper {
+  public:
+    WitnessGcRpc(Context* context, ServerId witnessId, ServerId masterId,
+            const std::vector<WireFormat::WitnessGc::Entry>& entries);
+    ~WitnessGcRpc() {}
+    /// \copydoc ServerIdRpcWrapper::waitAndCheckErrors
+    void wait() {waitAndCheckErrors();}
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(WitnessGcRpc);
+};
+
+/**
+ * Encapsulates the state of a BackupClient::witnessGetRecoveryData
+ * operation, allowing it to execute asynchronously.
+ */
+class WitnessGetRecoveryDataRpc : public ServerIdRpcWrapper {
+  public:
+    WitnessGetRecoveryDataRpc(Context* context, ServerId witnessId,
+            ServerId crashedMasterId, Buffer* responseBuffer);
+    ~WitnessGetRecoveryDataRpc() {}
+    uint32_t wait();
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(WitnessGetRecoveryDataRpc);
+};
+
 /**
  * This class implements RPC requests that are sent to backup servers
  * to manage segment replicas. The class contains only static methods,
@@ -230,6 +261,11 @@ class BackupClient {
             const Segment* segment, uint32_t offset, uint32_t length,
             const SegmentCertificate* certificate,
             bool open, bool close, bool primary);
+    static void witnessGc(Context* context, ServerId witnessId,
+            ServerId masterId,
+            const std::vector<WireFormat::WitnessGc::Entry>& entries);
+    static uint32_t witnessGetRecoveryData(Context* context,
+            ServerId witnessId, ServerId crashedMasterId, Buffer* response);
 
   private:
     BackupClient();
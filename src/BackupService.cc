@@ -47,6 +47,7 @@ BackupService::BackupService(Context* context,
     , storage()
     , frames()
     , recoveries()
+    , witnesses()
     , segmentSize(config->segmentSize)
     , readSpeed()
     , bytesWritten(0)
@@ -78,7 +79,8 @@ BackupService::BackupService(Context* context,
                                            config->backup.writeRateLimit,
                                            maxWriteBuffers,
                                            config->backup.file.c_str(),
-                                           O_DIRECT | O_SYNC));
+                                           O_DIRECT | O_SYNC,
+                                           config->backup.ioQueueDepth));
     }
     if (storage->getMetadataSize() < sizeof(BackupReplicaMetadata))
         DIE("Storage metadata block too small to hold BackupReplicaMetadata");
@@ -215,6 +217,18 @@ BackupService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::BackupWrite, BackupService,
                         &BackupService::writeSegment>(rpc);
             break;
+        case WireFormat::WitnessGc::opcode:
+            callHandler<WireFormat::WitnessGc, BackupService,
+                        &BackupService::witnessGc>(rpc);
+            break;
+        case WireFormat::WitnessGetRecoveryData::opcode:
+            callHandler<WireFormat::WitnessGetRecoveryData, BackupService,
+                        &BackupService::witnessGetRecoveryData>(rpc);
+            break;
+        case WireFormat::WitnessRecord::opcode:
+            callHandler<WireFormat::WitnessRecord, BackupService,
+                        &BackupService::witnessRecord>(rpc);
+            break;
         default:
             throw UnimplementedRequestError(HERE);
     }
@@ -655,6 +669,100 @@ BackupService::writeSegment(const WireFormat::BackupWrite::Request* reqHdr,
     }
 }
 
+/**
+ * Drop the records of writes that a master has made durable; see
+ * Witness::gc.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; the entries to drop follow it.
+ * \param respHdr
+ *      Header for the Rpc response.
+ * \param rpc
+ *      The Rpc being serviced.
+ */
+void
+BackupService::witnessGc(const WireFormat::WitnessGc::Request* reqHdr,
+                         WireFormat::WitnessGc::Response* respHdr,
+                         Rpc* rpc)
+{
+    auto it = witnesses.find(ServerId(reqHdr->masterId));
+    if (it == witnesses.end())
+        return;
+    uint32_t offset = sizeof32(*reqHdr);
+    for (uint32_t i = 0; i < reqHdr->numEntries; i++) {
+        const WireFormat::WitnessGc::Entry* entry =
+                rpc->requestPayload->getOffset<WireFormat::WitnessGc::Entry>(
+                offset);
+        if (entry == NULL)
+            throw MessageTooShortError(HERE);
+        offset += sizeof32(*entry);
+        it->second->gc(entry->keyHash, entry->clientId, entry->rpcId);
+    }
+}
+
+/**
+ * Return all of the writes recorded for a crashed master, so that a
+ * recovery master can replay them. The witness accepts no more records
+ * for that master afterwards.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request.
+ * \param respHdr
+ *      Header for the Rpc response; the records are appended after it.
+ * \param rpc
+ *      The Rpc being serviced.
+ */
+void
+BackupService::witnessGetRecoveryData(
+        const WireFormat::WitnessGetRecoveryData::Request* reqHdr,
+        WireFormat::WitnessGetRecoveryData::Response* respHdr,
+        Rpc* rpc)
+{
+    ServerId masterId(reqHdr->crashedMasterId);
+    std::unique_ptr<Witness>& witness = witnesses[masterId];
+    if (!witness)
+        witness.reset(new Witness(WITNESS_SLOTS));
+    respHdr->numRecords = witness->getRecoveryData(rpc->replyPayload);
+    LOG(NOTICE, "Returning %u witness records for crashed master %s",
+        respHdr->numRecords, masterId.toString().c_str());
+}
+
+/**
+ * Record a write that a client has sent to a master, so that it can be
+ * recovered if the master crashes before replicating it; see
+ * Witness::record.
+ *
+ * \param reqHdr
+ *      Header of the Rpc request; the write's request follows it.
+ * \param respHdr
+ *      Header for the Rpc response.
+ * \param rpc
+ *      The Rpc being serviced.
+ */
+void
+BackupService::witnessRecord(const WireFormat::WitnessRecord::Request* reqHdr,
+                             WireFormat::WitnessRecord::Response* respHdr,
+                             Rpc* rpc)
+{
+    ServerId masterId(reqHdr->masterId);
+    respHdr->accepted = 0;
+    if (!context->serverList->isUp(masterId) && !testingSkipCallerIdCheck) {
+        // Either the master has crashed (its recovery may already have
+        // collected our records) or we haven't heard of it yet.
+        return;
+    }
+    const void* request = rpc->requestPayload->getRange(sizeof32(*reqHdr),
+            reqHdr->requestLength);
+    if (request == NULL)
+        throw MessageTooShortError(HERE);
+
+    std::unique_ptr<Witness>& witness = witnesses[masterId];
+    if (!witness)
+        witness.reset(new Witness(WITNESS_SLOTS));
+    respHdr->accepted = witness->record(reqHdr->keyHash, reqHdr->clientId,
+            reqHdr->rpcId, request, reqHdr->requestLength);
+}
+
 /**
  * Runs garbage collection tasks.
  */
@@ -907,6 +1015,10 @@ BackupService::GarbageCollectDownServerTask::performTask()
         recovery->free();
     }
 
+    // The master's recovery has replayed any writes recorded on this
+    // witness, so they can go too.
+    service.witnesses.erase(masterId);
+
     // Then, if replica garbage collection is enabled, clean up replicas stored
     // for that now irrelevant master.
     if (!service.config->backup.gc) {
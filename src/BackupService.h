@@ -28,6 +28,7 @@
 #include "Service.h"
 #include "ServerConfig.h"
 #include "TaskQueue.h"
+#include "Witness.h"
 
 namespace RAMCloud {
 
@@ -72,6 +73,16 @@ class BackupService : public Service
     void writeSegment(const WireFormat::BackupWrite::Request* req,
                       WireFormat::BackupWrite::Response* resp,
                       Rpc* rpc);
+    void witnessGc(const WireFormat::WitnessGc::Request* reqHdr,
+                   WireFormat::WitnessGc::Response* respHdr,
+                   Rpc* rpc);
+    void witnessGetRecoveryData(
+        const WireFormat::WitnessGetRecoveryData::Request* reqHdr,
+        WireFormat::WitnessGetRecoveryData::Response* respHdr,
+        Rpc* rpc);
+    void witnessRecord(const WireFormat::WitnessRecord::Request* reqHdr,
+                       WireFormat::WitnessRecord::Response* respHdr,
+                       Rpc* rpc);
     void gcMain();
     void initOnceEnlisted();
     void trackerChangesEnqueued();
@@ -149,6 +160,17 @@ class BackupService : public Service
      */
     std::map<ServerId, BackupMasterRecovery*> recoveries;
 
+    /// Number of records each Witness in #witnesses can hold.
+    static const uint32_t WITNESS_SLOTS = 4096;
+
+    /**
+     * Unsynced writes recorded by clients, for each master this server is
+     * a witness for. Entries are created by the first record for a master
+     * and removed by garbage collection tasks when the master is removed
+     * from the server list (i.e. once its recovery has replayed them).
+     */
+    std::map<ServerId, std::unique_ptr<Witness>> witnesses;
+
     /// The uniform size of each segment this backup deals with.
     const uint32_t segmentSize;
 
@@ -580,6 +580,37 @@ TEST_F(BackupServiceTest, writeSegment_openSegmentOutOfStorage) {
         BackupOpenRejectedException);
 }
 
+TEST_F(BackupServiceTest, witnessGcAndGetRecoveryData) {
+    ServerId masterId(99, 0);
+    backup->witnesses[masterId].reset(new Witness(16));
+    Witness* witness = backup->witnesses[masterId].get();
+    witness->record(1, 5, 10, "abc", 3);
+    witness->record(2, 5, 11, "def", 3);
+
+    std::vector<WitnessGc::Entry> entries;
+    entries.push_back({1, 5, 10});
+    entries.push_back({3, 5, 12});
+    BackupClient::witnessGc(&context, backupId, masterId, entries);
+    EXPECT_EQ(1u, witness->getNumRecords());
+
+    // Unknown masters are ignored.
+    BackupClient::witnessGc(&context, backupId, ServerId(98, 0), entries);
+
+    Buffer response;
+    EXPECT_EQ(1u, BackupClient::witnessGetRecoveryData(&context, backupId,
+            masterId, &response));
+    const WitnessGetRecoveryData::Record* record =
+            response.getStart<WitnessGetRecoveryData::Record>();
+    EXPECT_EQ(2u, record->keyHash);
+    EXPECT_EQ(3u, record->requestLength);
+    EXPECT_TRUE(witness->isFrozen());
+
+    // A master with no witness records.
+    EXPECT_EQ(0u, BackupClient::witnessGetRecoveryData(&context, backupId,
+            ServerId(98, 0), &response));
+    EXPECT_EQ(0u, response.size());
+}
+
 TEST_F(BackupServiceTest, GarbageCollectDownServerTask) {
     openSegment({99, 0}, 88);
     openSegment({99, 0}, 89);
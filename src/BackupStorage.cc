@@ -31,7 +31,8 @@ BackupStorage::BackupStorage(size_t segmentSize,
 }
 
 /**
- * Report the read speed of this storage in MB/s.
+ * Report the read speed of this storage in MB/s. The measured speeds and
+ * per-replica load latencies are also logged.
  *
  * \return
  *      Storage read speed in MB/s.
@@ -41,6 +42,7 @@ BackupStorage::benchmark(BackupStrategy backupStrategy)
 {
     const uint32_t count = 16;
     uint32_t readSpeeds[count];
+    uint64_t loadNs[count];
     BackupStorage::FrameRef frames[count];
 
     for (uint32_t i = 0; i < count; ++i) {
@@ -52,6 +54,7 @@ BackupStorage::benchmark(BackupStrategy backupStrategy)
         CycleCounter<> counter;
         frames[i]->load();
         uint64_t ns = Cycles::toNanoseconds(counter.stop());
+        loadNs[i] = ns;
         readSpeeds[i] = downCast<uint32_t>(
                             segmentSize * 1000UL * 1000 * 1000 /
                             (1 << 20) / ns);
@@ -67,6 +70,15 @@ BackupStorage::benchmark(BackupStrategy backupStrategy)
 
     LOG(NOTICE, "Backup storage speeds (min): %u MB/s read", minRead);
     LOG(NOTICE, "Backup storage speeds (avg): %u MB/s read,", avgRead);
+    uint64_t maxLoadNs = *std::max_element(loadNs, loadNs + count);
+    uint64_t avgLoadNs = ({
+        uint64_t sum = 0;
+        foreach (uint64_t ns, loadNs)
+            sum += ns;
+        sum / count;
+    });
+    LOG(NOTICE, "Backup storage replica load latency: %lu us avg, "
+        "%lu us max", avgLoadNs / 1000, maxLoadNs / 1000);
 
     if (backupStrategy == RANDOM_REFINE_MIN) {
         LOG(NOTICE, "RANDOM_REFINE_MIN BackupStrategy selected");
@@ -86,8 +86,19 @@ CleanableSegmentManager::getUndeadTombstoneUtilization()
     return downCast<int>((100 * undeadTombstoneBytes) / totalSegletBytes);
 }
 
+/**
+ * Choose the next segment to compact in memory and stop tracking it.
+ *
+ * \param numaNode
+ *      If non-negative, prefer a segment whose memory is on this NUMA node,
+ *      so that the compacting thread works on local memory. Only the best
+ *      few candidates are considered; if none is local, the best overall is
+ *      returned.
+ * \return
+ *      The segment to compact, or NULL if there are no candidates.
+ */
 LogSegment*
-CleanableSegmentManager::getSegmentToCompact()
+CleanableSegmentManager::getSegmentToCompact(int numaNode)
 {
     SpinLock::Guard guard(lock);
     update(guard);
@@ -95,10 +106,22 @@ CleanableSegmentManager::getSegmentToCompact()
     if (compactionCandidates.empty())
         return NULL;
 
-    LogSegment& segment = *compactionCandidates.begin();
-    eraseFromAll(&segment, guard);
+    LogSegment* segment = &*compactionCandidates.begin();
+    if (numaNode >= 0 && segment->numaNode != numaNode) {
+        int considered = 0;
+        foreach (LogSegment& candidate, compactionCandidates) {
+            if (++considered > NUMA_COMPACTION_CANDIDATES)
+                break;
+            if (candidate.numaNode == numaNode) {
+                segment = &candidate;
+                break;
+            }
+        }
+    }
+
+    eraseFromAll(segment, guard);
     segmentsToCleaner++;
-    return &segment;
+    return segment;
 }
 
 void
@@ -76,10 +76,16 @@ class CleanableSegmentManager {
     ~CleanableSegmentManager();
     int getLiveObjectUtilization();
     int getUndeadTombstoneUtilization();
-    LogSegment* getSegmentToCompact();
+    LogSegment* getSegmentToCompact(int numaNode = -1);
     void getSegmentsToClean(LogSegmentVector& outSegsToClean);
 
   PRIVATE:
+    /// When looking for a segment to compact on a particular NUMA node, how
+    /// many of the best candidates to consider before settling for the best
+    /// one regardless of node. This bounds how much worse a candidate we'll
+    /// accept in exchange for locality.
+    static const int NUMA_COMPACTION_CANDIDATES = 16;
+
     void update(const SpinLock::Guard& guard);
     void scanSegmentTombstones(const SpinLock::Guard& guard);
     uint64_t computeCleaningCostBenefitScore(LogSegment* s);
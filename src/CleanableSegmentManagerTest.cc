@@ -111,6 +111,24 @@ class CleanableSegmentManagerTest : public ::testing::Test {
     DISALLOW_COPY_AND_ASSIGN(CleanableSegmentManagerTest);
 };
 
+TEST_F(CleanableSegmentManagerTest, getSegmentToCompact_numaNode) {
+    CleanableSegmentManager& csm = cleaner.cleanableSegments;
+    LogSegment* s1 = segmentManager.allocHeadSegment();
+    LogSegment* s2 = segmentManager.allocHeadSegment();
+    LogSegment* s3 = segmentManager.allocHeadSegment();
+    segmentManager.allocHeadSegment();
+    s2->numaNode = 1;
+
+    EXPECT_EQ(s2, csm.getSegmentToCompact(1));
+    // No candidates left on node 1: take the best one anyway. Both
+    // remaining segments are equally good, so either may come first.
+    LogSegment* first = csm.getSegmentToCompact(1);
+    LogSegment* second = csm.getSegmentToCompact(-1);
+    EXPECT_TRUE((first == s1 && second == s3) ||
+            (first == s3 && second == s1));
+    EXPECT_TRUE(csm.getSegmentToCompact(0) == NULL);
+}
+
 TEST_F(CleanableSegmentManagerTest, update) {
     CleanableSegmentManager& csm = cleaner.cleanableSegments;
         SpinLock::Guard guard(csm.lock);
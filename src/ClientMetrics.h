@@ -0,0 +1,69 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_CLIENTMETRICS_H
+#define RAMCLOUD_CLIENTMETRICS_H
+
+#include <cstdint>
+
+namespace RAMCloud {
+
+/**
+ * Counters describing activity inside a single RamCloud client object that
+ * never reaches the servers, and so can't be found with ServerMetrics.
+ * Retrieve them with RamCloud::getClientMetrics.
+ */
+struct ClientMetrics {
+    /// Reads answered from the near cache after the master confirmed
+    /// that the cached version is still current (no value bytes were
+    /// transferred).
+    uint64_t nearCacheHits;
+
+    /// Reads for which the near cache held nothing, so the full object
+    /// was fetched.
+    uint64_t nearCacheMisses;
+
+    /// Reads for which the near cache held an out-of-date version; the
+    /// master returned the current object, which replaced the cached one.
+    uint64_t nearCacheStale;
+
+    /// Entries discarded from the near cache to stay within its size limit.
+    uint64_t nearCacheEvictions;
+
+    /// Bytes of object data currently held in the near cache.
+    uint64_t nearCacheBytes;
+
+    /// Writes acknowledged in a single round trip because they were
+    /// recorded on all of the master's witnesses.
+    uint64_t witnessedWrites;
+
+    /// Writes sent to witnesses that had to wait for the master to
+    /// replicate them, because some witness didn't record them.
+    uint64_t witnessSyncs;
+
+    ClientMetrics()
+        : nearCacheHits(0)
+        , nearCacheMisses(0)
+        , nearCacheStale(0)
+        , nearCacheEvictions(0)
+        , nearCacheBytes(0)
+        , witnessedWrites(0)
+        , witnessSyncs(0)
+    {}
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_CLIENTMETRICS_H
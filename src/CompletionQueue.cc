@@ -0,0 +1,331 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "CompletionQueue.h"
+#include "ClientException.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a CompletionQueue.
+ *
+ * \param ramcloud
+ *      The RAMCloud object that will be used to issue requests.
+ * \param maxOutstanding
+ *      Maximum number of operations that may have RPCs outstanding at
+ *      once; operations submitted beyond this are queued until earlier
+ *      ones complete. Must be at least 1.
+ */
+CompletionQueue::CompletionQueue(RamCloud* ramcloud, uint32_t maxOutstanding)
+    : ramcloud(ramcloud)
+    , maxOutstanding(std::max(maxOutstanding, 1u))
+    , pending()
+    , active()
+    , opPool()
+{
+}
+
+/**
+ * Destructor for CompletionQueues: any operations whose results haven't
+ * been returned are abandoned (their RPCs are canceled, so they may or
+ * may not have taken effect).
+ */
+CompletionQueue::~CompletionQueue()
+{
+    foreach (Op* op, pending) {
+        opPool.destroy(op);
+    }
+    foreach (Op* op, active) {
+        opPool.destroy(op);
+    }
+}
+
+/**
+ * Submit an operation that atomically adds a value to an object
+ * containing a 64-bit integer (see RamCloud::incrementInt64).
+ *
+ * \param tag
+ *      Arbitrary value that will be returned in the operation's
+ *      Completion.
+ * \param tableId
+ *      The table containing the object.
+ * \param key
+ *      Variable length key that uniquely identifies the object within
+ *      tableId. It does not necessarily have to be null terminated. The
+ *      caller must ensure that the storage for this key is unchanged
+ *      until the operation's Completion has been returned.
+ * \param keyLength
+ *      Size in bytes of the key.
+ * \param incrementValue
+ *      This value is added to the current contents of the object.
+ */
+void
+CompletionQueue::incrementInt64(uint64_t tag, uint64_t tableId,
+        const void* key, uint16_t keyLength, int64_t incrementValue)
+{
+    Op* op = opPool.construct(INCREMENT, tag, tableId, key, keyLength);
+    op->incrementValue = incrementValue;
+    submit(op);
+}
+
+/**
+ * Submit an operation that reads an object (see RamCloud::read).
+ *
+ * \param tag
+ *      Arbitrary value that will be returned in the operation's
+ *      Completion.
+ * \param tableId
+ *      The table containing the object.
+ * \param key
+ *      Variable length key that uniquely identifies the object within
+ *      tableId. It does not necessarily have to be null terminated. The
+ *      caller must ensure that the storage for this key is unchanged
+ *      until the operation's Completion has been returned.
+ * \param keyLength
+ *      Size in bytes of the key.
+ * \param[out] value
+ *      If the operation succeeds, the object's value will be returned
+ *      here. The buffer must remain valid until the operation's
+ *      Completion has been returned.
+ */
+void
+CompletionQueue::read(uint64_t tag, uint64_t tableId, const void* key,
+        uint16_t keyLength, Buffer* value)
+{
+    Op* op = opPool.construct(READ, tag, tableId, key, keyLength);
+    op->value = value;
+    submit(op);
+}
+
+/**
+ * Submit an operation that deletes an object (see RamCloud::remove).
+ *
+ * \param tag
+ *      Arbitrary value that will be returned in the operation's
+ *      Completion.
+ * \param tableId
+ *      The table containing the object.
+ * \param key
+ *      Variable length key that uniquely identifies the object within
+ *      tableId. It does not necessarily have to be null terminated. The
+ *      caller must ensure that the storage for this key is unchanged
+ *      until the operation's Completion has been returned.
+ * \param keyLength
+ *      Size in bytes of the key.
+ */
+void
+CompletionQueue::remove(uint64_t tag, uint64_t tableId, const void* key,
+        uint16_t keyLength)
+{
+    submit(opPool.construct(REMOVE, tag, tableId, key, keyLength));
+}
+
+/**
+ * Submit an operation that replaces the value of an object, or creates
+ * the object if it doesn't exist (see RamCloud::write).
+ *
+ * \param tag
+ *      Arbitrary value that will be returned in the operation's
+ *      Completion.
+ * \param tableId
+ *      The table containing the object.
+ * \param key
+ *      Variable length key that uniquely identifies the object within
+ *      tableId. It does not necessarily have to be null terminated. The
+ *      caller must ensure that the storage for this key is unchanged
+ *      until the operation's Completion has been returned.
+ * \param keyLength
+ *      Size in bytes of the key.
+ * \param buf
+ *      Address of the first byte of the new contents for the object.
+ *      The caller must ensure that this storage is unchanged until the
+ *      operation's Completion has been returned.
+ * \param length
+ *      Size in bytes of the new contents for the object.
+ */
+void
+CompletionQueue::write(uint64_t tag, uint64_t tableId, const void* key,
+        uint16_t keyLength, const void* buf, uint32_t length)
+{
+    Op* op = opPool.construct(WRITE, tag, tableId, key, keyLength);
+    op->buf = buf;
+    op->length = length;
+    submit(op);
+}
+
+/**
+ * Make progress on outstanding operations and return the results of
+ * those that have completed. This method doesn't block; it is intended
+ * to be called repeatedly from an application's event loop.
+ *
+ * \param[out] completions
+ *      Array in which to return results.
+ * \param maxCompletions
+ *      Number of entries in completions.
+ * \return
+ *      The number of entries of completions that were filled in.
+ */
+uint32_t
+CompletionQueue::poll(Completion* completions, uint32_t maxCompletions)
+{
+    ramcloud->poll();
+    uint32_t count = 0;
+    for (size_t i = 0; (i < active.size()) && (count < maxCompletions); ) {
+        Op* op = active[i];
+        if (!finish(op, &completions[count])) {
+            i++;
+            continue;
+        }
+        count++;
+        opPool.destroy(op);
+        active[i] = active.back();
+        active.pop_back();
+    }
+    startPending();
+    return count;
+}
+
+/**
+ * Wait until at least one outstanding operation has completed, and
+ * return the results of all operations that have completed.
+ *
+ * \param[out] completions
+ *      Array in which to return results.
+ * \param maxCompletions
+ *      Number of entries in completions; must be at least 1.
+ * \return
+ *      The number of entries of completions that were filled in. 0 means
+ *      there were no outstanding operations.
+ */
+uint32_t
+CompletionQueue::wait(Completion* completions, uint32_t maxCompletions)
+{
+    while (size() > 0) {
+        uint32_t count = poll(completions, maxCompletions);
+        if (count > 0) {
+            return count;
+        }
+    }
+    return 0;
+}
+
+/**
+ * If an operation's RPC has completed, collect its result.
+ *
+ * \param op
+ *      An active operation.
+ * \param[out] completion
+ *      If the operation has completed, its result is stored here.
+ * \return
+ *      True means the operation has completed and completion has been
+ *      filled in; false means the operation is still in progress.
+ */
+bool
+CompletionQueue::finish(Op* op, Completion* completion)
+{
+    switch (op->type) {
+        case READ:
+            if (!op->readRpc->isReady())
+                return false;
+            break;
+        case WRITE:
+            if (!op->writeRpc->isReady())
+                return false;
+            break;
+        case REMOVE:
+            if (!op->removeRpc->isReady())
+                return false;
+            break;
+        case INCREMENT:
+            if (!op->incrementRpc->isReady())
+                return false;
+            break;
+    }
+
+    completion->tag = op->tag;
+    completion->type = op->type;
+    completion->status = STATUS_OK;
+    completion->version = 0;
+    completion->newValue = 0;
+    try {
+        switch (op->type) {
+            case READ:
+                op->readRpc->wait(&completion->version);
+                break;
+            case WRITE:
+                op->writeRpc->wait(&completion->version);
+                break;
+            case REMOVE:
+                op->removeRpc->wait(&completion->version);
+                break;
+            case INCREMENT:
+                completion->newValue =
+                        op->incrementRpc->wait(&completion->version);
+                break;
+        }
+    } catch (ClientException& e) {
+        completion->status = e.status;
+    }
+    return true;
+}
+
+/**
+ * Start queued operations, until there are none left or the limit on
+ * outstanding operations has been reached.
+ */
+void
+CompletionQueue::startPending()
+{
+    while (!pending.empty() && (active.size() < maxOutstanding)) {
+        Op* op = pending.front();
+        pending.pop_front();
+        switch (op->type) {
+            case READ:
+                op->readRpc.construct(ramcloud, op->tableId, op->key,
+                        op->keyLength, op->value);
+                break;
+            case WRITE:
+                op->writeRpc.construct(ramcloud, op->tableId, op->key,
+                        op->keyLength, op->buf, op->length);
+                break;
+            case REMOVE:
+                op->removeRpc.construct(ramcloud, op->tableId, op->key,
+                        op->keyLength);
+                break;
+            case INCREMENT:
+                op->incrementRpc.construct(ramcloud, op->tableId, op->key,
+                        op->keyLength, op->incrementValue);
+                break;
+        }
+        active.push_back(op);
+    }
+}
+
+/**
+ * Queue a newly submitted operation, and start it right away if the
+ * limit on outstanding operations permits.
+ *
+ * \param op
+ *      The operation.
+ */
+void
+CompletionQueue::submit(Op* op)
+{
+    pending.push_back(op);
+    startPending();
+}
+
+} // namespace RAMCloud
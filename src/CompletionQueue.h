@@ -0,0 +1,172 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_COMPLETIONQUEUE_H
+#define RAMCLOUD_COMPLETIONQUEUE_H
+
+#include <deque>
+#include <vector>
+
+#include "ObjectPool.h"
+#include "RamCloud.h"
+
+namespace RAMCloud {
+
+/**
+ * A CompletionQueue lets a single-threaded, event-driven application keep
+ * many RAMCloud operations outstanding at once without managing RPC
+ * wrappers itself. Operations are submitted along with a tag chosen by
+ * the caller; their results are later collected in batches by calling
+ * #poll (for example, from the application's event loop) or #wait.
+ *
+ * The number of operations with RPCs in flight is bounded; operations
+ * submitted beyond that limit are queued and started as earlier ones
+ * complete. Results are returned in the order operations complete, which
+ * may differ from the order in which they were submitted.
+ *
+ * This class is not thread-safe: it should be used only in the thread
+ * that polls the RamCloud object's dispatcher.
+ */
+class CompletionQueue {
+  public:
+    /// The kinds of operations that can be submitted.
+    enum OpType {
+        READ,
+        WRITE,
+        REMOVE,
+        INCREMENT
+    };
+
+    /**
+     * Describes the result of one operation; filled in by #poll.
+     */
+    struct Completion {
+        /// The tag passed in when the operation was submitted.
+        uint64_t tag;
+
+        /// The kind of the operation.
+        OpType type;
+
+        /// STATUS_OK means the operation succeeded; otherwise this is
+        /// the status of the ClientException the corresponding
+        /// synchronous RamCloud method would have thrown.
+        Status status;
+
+        /// Version of the object after the operation (or, for reads,
+        /// the version that was read). Only valid if status is STATUS_OK.
+        uint64_t version;
+
+        /// For INCREMENT operations, the new value of the object. Only
+        /// valid if status is STATUS_OK.
+        int64_t newValue;
+    };
+
+    explicit CompletionQueue(RamCloud* ramcloud, uint32_t maxOutstanding = 64);
+    ~CompletionQueue();
+    void incrementInt64(uint64_t tag, uint64_t tableId, const void* key,
+            uint16_t keyLength, int64_t incrementValue);
+    uint32_t poll(Completion* completions, uint32_t maxCompletions);
+    void read(uint64_t tag, uint64_t tableId, const void* key,
+            uint16_t keyLength, Buffer* value);
+    void remove(uint64_t tag, uint64_t tableId, const void* key,
+            uint16_t keyLength);
+    uint32_t wait(Completion* completions, uint32_t maxCompletions);
+    void write(uint64_t tag, uint64_t tableId, const void* key,
+            uint16_t keyLength, const void* buf, uint32_t length);
+
+    /**
+     * Returns the number of operations that have been submitted but
+     * whose results haven't yet been returned by #poll or #wait.
+     */
+    size_t size()
+    {
+        return pending.size() + active.size();
+    }
+
+  PRIVATE:
+    /**
+     * Holds the arguments and RPC for one submitted operation.
+     */
+    struct Op {
+        Op(OpType type, uint64_t tag, uint64_t tableId, const void* key,
+                uint16_t keyLength)
+            : type(type)
+            , tag(tag)
+            , tableId(tableId)
+            , key(key)
+            , keyLength(keyLength)
+            , buf(NULL)
+            , length(0)
+            , value(NULL)
+            , incrementValue(0)
+            , readRpc()
+            , writeRpc()
+            , removeRpc()
+            , incrementRpc()
+        {}
+
+        /// Arguments passed to the submitting method; see there for
+        /// details. Fields not used by this op's type are left at
+        /// their default values.
+        OpType type;
+        uint64_t tag;
+        uint64_t tableId;
+        const void* key;
+        uint16_t keyLength;
+        const void* buf;
+        uint32_t length;
+        Buffer* value;
+        int64_t incrementValue;
+
+        /// Exactly one of the following is constructed once the
+        /// operation has been started.
+        Tub<ReadRpc> readRpc;
+        Tub<WriteRpc> writeRpc;
+        Tub<RemoveRpc> removeRpc;
+        Tub<IncrementInt64Rpc> incrementRpc;
+
+        DISALLOW_COPY_AND_ASSIGN(Op);
+    };
+
+    bool finish(Op* op, Completion* completion);
+    void startPending();
+    void submit(Op* op);
+
+    /// Used to issue RPCs.
+    RamCloud* ramcloud;
+
+    /// Maximum number of operations whose RPCs may be outstanding at
+    /// once.
+    uint32_t maxOutstanding;
+
+    /// Operations that have been submitted but not yet started, because
+    /// maxOutstanding operations were already active; in submission
+    /// order.
+    std::deque<Op*> pending;
+
+    /// Operations whose RPCs have been started but whose results haven't
+    /// yet been returned (no particular order).
+    std::vector<Op*> active;
+
+    /// Allocates Ops.
+    ObjectPool<Op> opPool;
+
+    DISALLOW_COPY_AND_ASSIGN(CompletionQueue);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_COMPLETIONQUEUE_H
@@ -0,0 +1,145 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "CompletionQueue.h"
+#include "MockCluster.h"
+
+namespace RAMCloud {
+
+class CompletionQueueTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    Tub<RamCloud> ramcloud;
+    uint64_t tableId;
+    CompletionQueue::Completion completions[10];
+
+    CompletionQueueTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , ramcloud()
+        , tableId(-1)
+        , completions()
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+
+        ServerConfig config = ServerConfig::forTesting();
+        config.services = {WireFormat::MASTER_SERVICE,
+                           WireFormat::ADMIN_SERVICE};
+        config.localLocator = "mock:host=master1";
+        cluster.addServer(config);
+
+        ramcloud.construct(&context, "mock:host=coordinator");
+        tableId = ramcloud->createTable("table1");
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(CompletionQueueTest);
+};
+
+TEST_F(CompletionQueueTest, basics) {
+    CompletionQueue queue(ramcloud.get());
+    Buffer value;
+    queue.write(1, tableId, "0", 1, "abc", 3);
+    EXPECT_EQ(1U, queue.wait(completions, 10));
+    EXPECT_EQ(1U, completions[0].tag);
+    EXPECT_EQ(CompletionQueue::WRITE, completions[0].type);
+    EXPECT_EQ(STATUS_OK, completions[0].status);
+    uint64_t writeVersion = completions[0].version;
+    EXPECT_NE(0U, writeVersion);
+
+    queue.read(2, tableId, "0", 1, &value);
+    EXPECT_EQ(1U, queue.wait(completions, 10));
+    EXPECT_EQ(2U, completions[0].tag);
+    EXPECT_EQ(CompletionQueue::READ, completions[0].type);
+    EXPECT_EQ(STATUS_OK, completions[0].status);
+    EXPECT_EQ(writeVersion, completions[0].version);
+    EXPECT_EQ("abc", TestUtil::toString(&value));
+
+    queue.remove(3, tableId, "0", 1);
+    EXPECT_EQ(1U, queue.wait(completions, 10));
+    EXPECT_EQ(3U, completions[0].tag);
+    EXPECT_EQ(CompletionQueue::REMOVE, completions[0].type);
+    EXPECT_EQ(STATUS_OK, completions[0].status);
+    EXPECT_EQ(0U, queue.size());
+    EXPECT_EQ(0U, queue.wait(completions, 10));
+}
+
+TEST_F(CompletionQueueTest, incrementInt64) {
+    CompletionQueue queue(ramcloud.get());
+    queue.incrementInt64(7, tableId, "counter", 7, 5);
+    queue.incrementInt64(8, tableId, "counter", 7, -2);
+    uint32_t count = 0;
+    while (count < 2) {
+        count += queue.poll(completions + count, 10 - count);
+    }
+    int64_t values[2];
+    for (int i = 0; i < 2; i++) {
+        EXPECT_EQ(CompletionQueue::INCREMENT, completions[i].type);
+        EXPECT_EQ(STATUS_OK, completions[i].status);
+        values[completions[i].tag - 7] = completions[i].newValue;
+    }
+    EXPECT_EQ(5, values[0]);
+    EXPECT_EQ(3, values[1]);
+}
+
+TEST_F(CompletionQueueTest, errorStatus) {
+    CompletionQueue queue(ramcloud.get());
+    Buffer value;
+    queue.read(1, tableId, "missing", 7, &value);
+    EXPECT_EQ(1U, queue.wait(completions, 10));
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST, completions[0].status);
+}
+
+TEST_F(CompletionQueueTest, boundedWindow) {
+    CompletionQueue queue(ramcloud.get(), 2);
+    const char* keys[] = {"0", "1", "2", "3", "4"};
+    for (uint64_t i = 0; i < 5; i++) {
+        queue.write(i, tableId, keys[i], 1, "value", 5);
+    }
+    EXPECT_EQ(2U, queue.active.size());
+    EXPECT_EQ(3U, queue.pending.size());
+    EXPECT_EQ(5U, queue.size());
+
+    // Collecting results lets queued operations start.
+    EXPECT_EQ(1U, queue.poll(completions, 1));
+    EXPECT_EQ(2U, queue.active.size());
+    EXPECT_EQ(2U, queue.pending.size());
+    uint32_t count = 1;
+    while (queue.size() > 0) {
+        count += queue.wait(completions + count, 10 - count);
+    }
+    EXPECT_EQ(5U, count);
+    uint64_t tags = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        EXPECT_EQ(STATUS_OK, completions[i].status);
+        tags |= 1 << completions[i].tag;
+    }
+    EXPECT_EQ(0x1fU, tags);
+}
+
+TEST_F(CompletionQueueTest, destructor_abandonOperations) {
+    Tub<CompletionQueue> queue;
+    queue.construct(ramcloud.get(), 1);
+    queue->write(1, tableId, "0", 1, "abc", 3);
+    queue->write(2, tableId, "1", 1, "abc", 3);
+    EXPECT_EQ(2U, queue->size());
+    queue.destroy();
+}
+
+}  // namespace RAMCloud
@@ -54,9 +54,18 @@ main(int argc, char *argv[])
     uint32_t maxCores;
     bool reset;
     bool neverKill;
+    double balanceInterval;
+    uint32_t maxConcurrentMigrations;
     try {
         OptionsDescription coordinatorOptions("Coordinator");
         coordinatorOptions.add_options()
+            ("balanceInterval",
+             ProgramOptions::value<double>(&balanceInterval)->
+                default_value(0),
+             "Number of seconds between rounds of tablet load balancing, in "
+             "which the coordinator splits hot tablets and moves them from "
+             "overloaded masters to underloaded ones. 0 (the default) "
+             "disables load balancing.")
             ("deadServerTimeout,d",
              ProgramOptions::value<uint32_t>(&deadServerTimeout)->
                 default_value(250),
@@ -74,6 +83,11 @@ main(int argc, char *argv[])
              "under this limit, but may occasionally need to exceed it "
              "(e.g., to avoid distributed deadlocks). Th limit does not "
              "include cleaner threads and some other miscellaneous functions.")
+            ("maxConcurrentMigrations",
+             ProgramOptions::value<uint32_t>(&maxConcurrentMigrations)->
+                default_value(2),
+             "Limit on the number of tablet migrations that load balancing "
+             "(see --balanceInterval) may have in progress at once.")
             ("neverKill,n",
              ProgramOptions::bool_switch(&neverKill),
              "If specified, the coordinator will never attempt to kill any "
@@ -144,6 +158,8 @@ main(int argc, char *argv[])
                                               deadServerTimeout,
                                               false,
                                               neverKill);
+        coordinatorService.tabletBalancer.startBalancing(balanceInterval,
+                maxConcurrentMigrations);
         AdminService adminService(&context, NULL, NULL);
         while (true) {
             context.dispatch->poll();
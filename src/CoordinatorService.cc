@@ -52,6 +52,7 @@ CoordinatorService::CoordinatorService(Context* context,
     , serverList(context)
     , tableManager(context, &updateManager)
     , leaseAuthority(context)
+    , tabletBalancer(context, &tableManager)
     , runtimeOptions()
     , recoveryManager(context, tableManager, &runtimeOptions)
     , activeVerifications()
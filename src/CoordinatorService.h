@@ -38,6 +38,7 @@
 #include "RuntimeOptions.h"
 #include "Service.h"
 #include "TableManager.h"
+#include "TabletBalancer.h"
 #include "TransportManager.h"
 #include "ServerConfig.h"
 
@@ -191,6 +192,12 @@ class CoordinatorService : public Service {
      */
     ClientLeaseAuthority leaseAuthority;
 
+    /**
+     * Moves tablets between masters to even out their load; idle unless
+     * started with TabletBalancer::startBalancing.
+     */
+    TabletBalancer tabletBalancer;
+
   PRIVATE:
     /**
      * Contains coordinator configuration options which can be modified while
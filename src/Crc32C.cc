@@ -15,6 +15,10 @@
 
 // RAMCloud pragma [CPPLINT=0]
 
+#if __SSE4_2__
+#include <immintrin.h>
+#endif
+
 #include "Crc32C.h"
 #include "Logger.h"
 #include "ShortMacros.h"
@@ -36,14 +40,166 @@ haveSse42() {
         LOG(DEBUG, "Processor does not have SSE 4.2");
     return ret;
 }
+
+#if __SSE4_2__
+bool
+havePclmul() {
+    uint32_t a, b, c, d;
+    CPUID(1, a, b, c, d);
+    bool ret = ((c & (1 << 1)) != 0);
+    if (ret)
+        LOG(DEBUG, "Processor has PCLMULQDQ");
+    else
+        LOG(DEBUG, "Processor does not have PCLMULQDQ");
+    return ret;
+}
+#endif
+
+/// Number of bytes each of the three streams covers per iteration of the
+/// main loop in intelCrc32CMultiStream(). Combining the streams has a fixed
+/// cost, so streams should be long enough to amortize it.
+const uint32_t LONG_STREAM_BYTES = 2048;
+
+/// Number of bytes each stream covers in the second, shorter loop of
+/// intelCrc32CMultiStream(), which handles what is left over after the
+/// long loop.
+const uint32_t SHORT_STREAM_BYTES = 256;
+
+#if __SSE4_2__
+/**
+ * Multiply two bit-reflected CRC32C values as polynomials modulo the CRC32C
+ * polynomial. PCLMULQDQ does the carry-less multiplication and the crc32
+ * instruction does the reduction back to 32 bits. 0x80000000 (the
+ * polynomial 1) is the identity.
+ */
+__attribute__((target("pclmul")))
+uint32_t
+multiplyModP(uint32_t a, uint32_t b)
+{
+    __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, a),
+                                           _mm_set_epi64x(0, b), 0x00);
+    // Reflected operands yield a product that is one bit short; the crc32
+    // instruction then multiplies the low half by x^32 as it reduces it.
+    uint64_t shifted = static_cast<uint64_t>(_mm_cvtsi128_si64(product)) << 1;
+    return downCast<uint32_t>(__builtin_ia32_crc32si(0,
+                    static_cast<uint32_t>(shifted))) ^
+           static_cast<uint32_t>(shifted >> 32);
+}
+
+/**
+ * Return the value that, when multiplied by a CRC in progress with
+ * multiplyModP(), has the same effect as feeding it \a bytes zero bytes. This
+ * is how the CRCs of consecutive streams are combined: a stream's CRC must
+ * be advanced over the bytes of the streams after it.
+ */
+uint32_t
+zeroesOperator(uint32_t bytes)
+{
+    static const uint64_t zeroes[LONG_STREAM_BYTES / 8] = {0};
+    return intelCrc32C(0x80000000, zeroes, bytes);
+}
+
+/// Operators used to combine the streams in intelCrc32CMultiStream(). Set
+/// by initMultiStream().
+uint32_t longStreamOperator = 0;
+uint32_t shortStreamOperator = 0;
+
+/**
+ * Determine whether intelCrc32CMultiStream() can be used on this machine
+ * and, if so, compute the constants it needs. Must only be called if the
+ * crc32 instruction is available.
+ */
+bool
+initMultiStream()
+{
+    if (!havePclmul())
+        return false;
+    longStreamOperator = zeroesOperator(LONG_STREAM_BYTES);
+    shortStreamOperator = zeroesOperator(SHORT_STREAM_BYTES);
+    return true;
+}
+#endif
+
 } // anonymous namespace
 
 #if __SSE4_2__
 bool Crc32C::haveHardware = haveSse42();
+bool Crc32C::haveMultiStream = Crc32C::haveHardware && initMultiStream();
 #else
 bool Crc32C::haveHardware = false;
+bool Crc32C::haveMultiStream = false;
 #endif
 
+#if __SSE4_2__
+namespace {
+/**
+ * Checksum \a rounds consecutive groups of three streams, each
+ * \a streamBytes long, starting at \a p. Returns the CRC of the whole range.
+ */
+__attribute__((target("pclmul")))
+uint32_t
+crcStreams(uint32_t crc, const uint64_t*& p, uint64_t rounds,
+           uint32_t streamBytes, uint32_t streamOperator)
+{
+    const uint64_t streamWords = streamBytes / 8;
+    while (rounds-- > 0) {
+        // The three crc32 chains are independent, so the processor can
+        // overlap them and hide the instruction's 3-cycle latency.
+        uint64_t crc0 = crc, crc1 = 0, crc2 = 0;
+        const uint64_t* end = p + streamWords;
+        while (p < end) {
+            crc0 = __builtin_ia32_crc32di(crc0, p[0]);
+            crc1 = __builtin_ia32_crc32di(crc1, p[streamWords]);
+            crc2 = __builtin_ia32_crc32di(crc2, p[2 * streamWords]);
+            p++;
+        }
+        p += 2 * streamWords;
+        crc = multiplyModP(downCast<uint32_t>(crc0), streamOperator) ^
+              downCast<uint32_t>(crc1);
+        crc = multiplyModP(crc, streamOperator) ^ downCast<uint32_t>(crc2);
+    }
+    return crc;
+}
+} // anonymous namespace
+#endif
+
+/**
+ * Same function as intelCrc32C(), but for large buffers: it splits the data
+ * into three interleaved streams whose CRCs are computed in parallel and
+ * then combined using carry-less multiplication. Since the crc32
+ * instruction has a latency of three cycles but can issue every cycle, this
+ * can nearly triple throughput on large buffers. Only call this if
+ * Crc32C::haveMultiStream is true.
+ *
+ * \param crc
+ *      The CRC accumulated so far (before inversion).
+ * \param buffer
+ *      Memory to checksum.
+ * \param bytes
+ *      Number of bytes at \a buffer.
+ * \return
+ *      The new accumulated CRC (before inversion).
+ */
+uint32_t
+intelCrc32CMultiStream(uint32_t crc, const void* buffer, uint64_t bytes)
+{
+#if __SSE4_2__
+    const uint64_t* p = static_cast<const uint64_t*>(buffer);
+
+    uint64_t rounds = bytes / (3 * LONG_STREAM_BYTES);
+    crc = crcStreams(crc, p, rounds, LONG_STREAM_BYTES, longStreamOperator);
+    bytes -= rounds * 3 * LONG_STREAM_BYTES;
+
+    rounds = bytes / (3 * SHORT_STREAM_BYTES);
+    crc = crcStreams(crc, p, rounds, SHORT_STREAM_BYTES, shortStreamOperator);
+    bytes -= rounds * 3 * SHORT_STREAM_BYTES;
+
+    return intelCrc32C(crc, p, bytes);
+#else
+    throw FatalError(HERE, "SSE 4.2 was not enabled at compile-time");
+#endif
+}
+
 } // namespace RAMCloud
 
 namespace Crc32CSlicingBy8 {
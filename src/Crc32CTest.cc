@@ -126,6 +126,57 @@ TEST_P(Crc32CTest, updateFromBuffer) {
     EXPECT_EQ(c.result, d.result);
 }
 
+TEST_P(Crc32CTest, intelCrc32CMultiStream) {
+    if (forceSoftware || !Crc32C::haveMultiStream)
+        return;
+
+    // Large enough to cover the long tier, the short tier, and the serial
+    // tail at every misalignment.
+    static uint8_t buf[3 * 2048 + 3 * 256 + 64];
+    for (uint32_t i = 0; i < sizeof(buf); i++)
+        buf[i] = static_cast<uint8_t>(i * 31 + 7);
+
+    uint32_t lengths[] = { 0, 1, 767, 768, 769, 3 * 256 + 8, 6143, 6144,
+                           6145, 3 * 2048 + 3 * 256 + 13 };
+    foreach (uint32_t length, lengths) {
+        for (uint32_t misalign = 0; misalign < 8; misalign++) {
+            if (length + misalign > sizeof(buf))
+                continue;
+            EXPECT_EQ(softwareCrc32C(0x12345678, &buf[misalign], length),
+                      intelCrc32CMultiStream(0x12345678, &buf[misalign],
+                                             length))
+                << "length " << length << " misalign " << misalign;
+        }
+    }
+}
+
+TEST_P(Crc32CTest, batch) {
+    static uint8_t buf[10000];
+    for (uint32_t i = 0; i < sizeof(buf); i++)
+        buf[i] = static_cast<uint8_t>(i * 17 + 3);
+
+    // Piece sizes chosen to fill the staging area exactly, overflow it, and
+    // bypass it entirely.
+    uint32_t pieces[] = { 1, 6, 81, 3000, 3056, 2, 7000, 8, 0, 4 };
+    Crc32C expected(forceSoftware);
+    Crc32C actual(forceSoftware);
+    {
+        Crc32C::Batch batch(actual);
+        uint32_t offset = 0;
+        foreach (uint32_t length, pieces) {
+            expected.update(&buf[offset % 2000], length);
+            batch.add(&buf[offset % 2000], length);
+            offset += length;
+        }
+        batch.flush();
+        EXPECT_EQ(expected.getResult(), actual.getResult());
+
+        expected.update(buf, 13);
+        batch.add(buf, 13);
+    }
+    EXPECT_EQ(expected.getResult(), actual.getResult());
+}
+
 TEST_P(Crc32CTest, assignmentOperator) {
     Crc32C a;
     a.update(&a, sizeof(a));
@@ -214,6 +214,9 @@ Dispatch::poll()
             // It's possible that the desired events may have changed while
             // an event was being reported.
             // events &= file->events;
+            if (!(file->events & ERROR_PENDING)) {
+                events &= ~ERROR_PENDING;
+            }
             if (events != 0) {
                 file->handleFileEvent(events);
                 result++;
@@ -563,6 +566,10 @@ Dispatch::File::setEvents(int events)
     if (events & WRITABLE) {
         epollEvent.events |= EPOLLOUT|EPOLLONESHOT;
     }
+    if (events & ERROR_PENDING) {
+        // epoll always reports EPOLLERR, so there is no flag to request.
+        epollEvent.events |= EPOLLONESHOT;
+    }
     epollEvent.data.fd = fd;
     if (sys->epoll_ctl(owner->epollFd,
             active ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &epollEvent) != 0) {
@@ -613,6 +620,9 @@ try {
             if (events[i].events & EPOLLOUT) {
                 readyEvents |= WRITABLE;
             }
+            if (events[i].events & EPOLLERR) {
+                readyEvents |= ERROR_PENDING;
+            }
             if (fd == -1) {
                 // This is a special value associated with exitPipeFd[0],
                 // and indicates that this thread should exit.
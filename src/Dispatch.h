@@ -127,11 +127,15 @@ class Dispatch {
 
     /**
      * Defines the kinds of events for which File handlers can be defined
-     * (some combination of readable and writable).
+     * (some combination of readable and writable). ERROR_PENDING means the
+     * fd has an error condition, such as a non-empty socket error queue;
+     * epoll watches for it regardless, but it is only reported to handlers
+     * that include it in their events.
      */
     enum FileEvent {
         READABLE = 1,
-        WRITABLE = 2
+        WRITABLE = 2,
+        ERROR_PENDING = 4
     };
 
     /**
@@ -152,6 +152,12 @@ class DummyFile : public Dispatch::File {
             }
             eventInfo.append("WRITABLE");
         }
+        if (events & Dispatch::FileEvent::ERROR_PENDING) {
+            if (eventInfo.size() > 0) {
+                eventInfo.append("|");
+            }
+            eventInfo.append("ERROR_PENDING");
+        }
         if (readData) {
             size_t count = read(fd, buffer, sizeof(buffer) - 1);
             buffer[count] = 0;
@@ -400,6 +406,29 @@ TEST_F(DispatchTest, poll_fileDeletedDuringInvocation) {
     close(fds[0]);
 }
 
+TEST_F(DispatchTest, poll_errorPending) {
+    // Closing the read end of a pipe puts its write end in error.
+    int fds[2];
+    EXPECT_EQ(0, pipe(fds));
+    close(fds[0]);
+    DummyFile* f = new DummyFile("f1", false, fds[1],
+            Dispatch::FileEvent::ERROR_PENDING, &dispatch);
+    EXPECT_EQ(1, waitForPollSuccess(1.0));
+    EXPECT_EQ("file f1 invoked", *localLog);
+    EXPECT_EQ("ERROR_PENDING", f->eventInfo);
+
+    // Handlers that didn't ask for errors don't hear about them.
+    f->setEvents(Dispatch::FileEvent::READABLE);
+    localLog->clear();
+    for (int i = 0; i < 10; i++) {
+        dispatch.poll();
+        usleep(1000);
+    }
+    EXPECT_EQ("", *localLog);
+    delete f;
+    close(fds[1]);
+}
+
 TEST_F(DispatchTest, poll_dontEvenCheckTimers) {
     DummyTimer t1("t1", &dispatch);
     t1.start(150);
@@ -747,7 +776,7 @@ TEST_F(DispatchTest, epollThreadMain_signalEventsAndExit) {
     // * Exiting when fd -1 is seen.
     epoll_event events[3];
     events[0].data.fd = 43;
-    events[0].events = EPOLLOUT;
+    events[0].events = EPOLLOUT|EPOLLERR;
     events[1].data.fd = 19;
     events[1].events = EPOLLIN|EPOLLOUT;
     events[2].data.fd = -1;
@@ -759,7 +788,8 @@ TEST_F(DispatchTest, epollThreadMain_signalEventsAndExit) {
     std::thread(epollThreadWrapper, &dispatch).detach();
     waitForReadyFd(1.0);
     EXPECT_EQ(43, dispatch.readyFd);
-    EXPECT_EQ(Dispatch::FileEvent::WRITABLE, dispatch.readyEvents);
+    EXPECT_EQ(Dispatch::FileEvent::WRITABLE|Dispatch::FileEvent::ERROR_PENDING,
+            dispatch.readyEvents);
 
     // The polling thread should already be waiting on readyFd,
     // so clearing it should cause another fd to appear immediately.
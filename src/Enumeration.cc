@@ -18,6 +18,8 @@
 
 namespace RAMCloud {
 
+uint64_t Enumeration::maxFilteredBuckets = 65536;
+
 /**
  * Used internally by enumerateTablet() to pass arguments to
  * enumerateBucket().
@@ -38,6 +40,9 @@ struct EnumerateBucketArgs {
 
     /// A vector in which to place the resulting objects.
     std::vector<Log::Reference>* objectReferences;
+
+    /// If non-NULL, only objects that match this filter are returned.
+    const EnumerationFilter* filter;
 };
 
 /**
@@ -104,6 +109,12 @@ enumerateBucket(uint64_t reference, void* cookie)
         return;
     }
 
+    if (args.filter != NULL) {
+        Object object(buffer);
+        if (!args.filter->matches(object, keyHash))
+            return;
+    }
+
     args.objectReferences->push_back(Log::Reference(reference));
 }
 
@@ -119,17 +130,16 @@ enumerateBucket(uint64_t reference, void* cookie)
  *      The objects to append.
  * \param maxBytes
  *      The maximum number of bytes to append.
- * \param keysOnly
- *      False means that full objects are returned, containing both keys
- *      and data. True means that the returned objects have
- *      been truncated so that the object data (normally the last
- *      field of the object) is omitted.       
+ * \param maxValueBytes
+ *      Each object is truncated so that at most this many bytes of its
+ *      data (normally the last field of the object) are returned; 0 means
+ *      only keys are returned.
  */
 static int64_t
 appendObjectsToBuffer(Log& log,
                       Buffer* buffer,
                       std::vector<Log::Reference>& references,
-                      uint32_t maxBytes, bool keysOnly)
+                      uint32_t maxBytes, uint32_t maxValueBytes)
 {
     for (uint32_t index = 0; index < references.size(); index++) {
         Buffer objectBuffer;
@@ -137,9 +147,9 @@ appendObjectsToBuffer(Log& log,
 
         Object object(objectBuffer);
         uint32_t length = objectBuffer.size();
-        if (keysOnly) {
-            uint32_t dataLength = object.getValueLength();
-            length -= dataLength;
+        uint32_t dataLength = object.getValueLength();
+        if (dataLength > maxValueBytes) {
+            length -= dataLength - maxValueBytes;
         }
 
         if (buffer->size() + sizeof(length) + length > maxBytes) {
@@ -234,6 +244,14 @@ class ObjectHashComparator {
  *      A Buffer to hold the resulting objects.
  * \param maxPayloadBytes
  *      The maximum number of bytes of objects to be returned.
+ * \param membership
+ *      The master's index of key hashes by table, or NULL if it doesn't
+ *      keep one. If given, enumerating a small tablet skips the buckets
+ *      that can't hold any of its objects.
+ * \param filter
+ *      If non-NULL, only objects matching this filter are returned, and
+ *      they are truncated as its maxValueBytes says. Must remain valid
+ *      until complete returns.
  */
 Enumeration::Enumeration(uint64_t tableId,
                          bool keysOnly,
@@ -244,7 +262,9 @@ Enumeration::Enumeration(uint64_t tableId,
                          EnumerationIterator& iter,
                          Log& log,
                          HashTable& objectMap,
-                         Buffer& payload, uint32_t maxPayloadBytes)
+                         Buffer& payload, uint32_t maxPayloadBytes,
+                         TabletMembership* membership,
+                         const EnumerationFilter* filter)
     : tableId(tableId)
     , keysOnly(keysOnly)
     , requestedTabletStartHash(requestedTabletStartHash)
@@ -256,7 +276,57 @@ Enumeration::Enumeration(uint64_t tableId,
     , objectMap(objectMap)
     , payload(payload)
     , maxPayloadBytes(maxPayloadBytes)
+    , membership(membership)
+    , filter(filter)
+    , maxValueBytes(keysOnly ? 0 : ~0u)
 {
+    if (filter != NULL && filter->maxValueBytes < maxValueBytes)
+        maxValueBytes = filter->maxValueBytes;
+}
+
+/**
+ * Find the hash table buckets that may hold objects of the tablet being
+ * enumerated, if the tablet is small enough for visiting just those to be
+ * worthwhile.
+ *
+ * \param firstBucket
+ *      Only buckets at this index or later are of interest.
+ * \param numBuckets
+ *      Number of buckets in the hash table.
+ * \param[out] buckets
+ *      Filled in with the indexes of the buckets to visit, in increasing
+ *      order and without duplicates.
+ * \return
+ *      True if \a buckets was filled in. False if there is no membership
+ *      index or the tablet is too large, in which case every bucket should
+ *      be visited.
+ */
+bool
+Enumeration::getTabletBuckets(uint64_t firstBucket, uint64_t numBuckets,
+                              vector<uint64_t>* buckets)
+{
+    if (membership == NULL || firstBucket >= numBuckets)
+        return false;
+
+    vector<KeyHash> keyHashes;
+    if (!membership->getKeyHashes(tableId, requestedTabletStartHash,
+            actualTabletEndHash, &keyHashes,
+            (numBuckets - firstBucket) / SPARSE_BUCKET_RATIO)) {
+        return false;
+    }
+
+    buckets->clear();
+    foreach (KeyHash keyHash, keyHashes) {
+        uint64_t unused;
+        uint64_t bucket = HashTable::findBucketIndex(numBuckets, keyHash,
+                                                     &unused);
+        if (bucket >= firstBucket)
+            buckets->push_back(bucket);
+    }
+    std::sort(buckets->begin(), buckets->end());
+    buckets->erase(std::unique(buckets->begin(), buckets->end()),
+                   buckets->end());
+    return true;
 }
 
 /**
@@ -294,18 +364,63 @@ Enumeration::complete()
     args.log = &log;
     args.iter = &iter;
     args.objectReferences = &objectRefs;
+    args.filter = (filter != NULL && !filter->selectsAll()) ? filter : NULL;
     void* cookie = static_cast<void*>(&args);
+    vector<uint64_t> tabletBuckets;
+    bool sparse = getTabletBuckets(bucketIndex, numBuckets, &tabletBuckets);
+    vector<uint64_t>::iterator nextTabletBucket = tabletBuckets.begin();
+    uint64_t bucketsScanned = 0;
     while (bucketIndex < numBuckets) {
+        if (sparse) {
+            // Skip straight to the next bucket holding one of the tablet's
+            // key hashes.
+            while (nextTabletBucket != tabletBuckets.end() &&
+                    *nextTabletBucket < bucketIndex) {
+                nextTabletBucket++;
+            }
+            if (nextTabletBucket == tabletBuckets.end()) {
+                bucketIndex = numBuckets;
+                break;
+            }
+            if (payload.size() == initialPayloadLength &&
+                    iter.top().bucketIndex == bucketIndex) {
+                iter.top().bucketIndex = *nextTabletBucket;
+            }
+            bucketIndex = *nextTabletBucket;
+        }
         objectRefs.clear();
         bucketStart = payload.size();
         objectMap.forEachInBucket(enumerateBucket, cookie, bucketIndex);
         int64_t overflow = appendObjectsToBuffer(log, &payload, objectRefs,
-                                                 maxPayloadBytes, keysOnly);
+                                                 maxPayloadBytes,
+                                                 maxValueBytes);
         payloadFull = overflow >= 0;
         if (payloadFull) {
             break;
         }
         bucketIndex++;
+
+        if (bucketIndex < numBuckets &&
+                objectMap.getNumBuckets() != numBuckets) {
+            // The hash table started or finished a resize, so bucket indexes
+            // have changed meaning. Record our progress; the next pass
+            // pushes a new iterator frame for the new size (see the check at
+            // the top of this method). Don't return an empty payload, since
+            // the client would take that to mean the tablet is exhausted.
+            iter.top().bucketIndex = bucketIndex;
+            if (payload.size() == initialPayloadLength) {
+                complete();
+                return;
+            }
+            break;
+        }
+
+        if (args.filter != NULL && ++bucketsScanned >= maxFilteredBuckets) {
+            // Return what we have, even if it's nothing. The payload may be
+            // empty, but nextTabletStartHash is left unchanged, which tells
+            // the client to send another request for the same tablet.
+            break;
+        }
     }
 
     // Clean up if last bucket is incomplete.
@@ -320,7 +435,8 @@ Enumeration::complete()
             std::sort(objectRefs.begin(), objectRefs.end(), comparator);
 
             int64_t overflow = appendObjectsToBuffer(log, &payload, objectRefs,
-                                                     maxPayloadBytes, keysOnly);
+                                                     maxPayloadBytes,
+                                                     maxValueBytes);
             if (overflow >= 0) {
                 LogEntryType type;
                 Buffer buffer;
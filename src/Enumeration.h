@@ -17,9 +17,11 @@
 #define RAMCLOUD_ENUMERATION_H
 
 #include "Buffer.h"
+#include "EnumerationFilter.h"
 #include "EnumerationIterator.h"
 #include "HashTable.h"
 #include "Log.h"
+#include "TabletMembership.h"
 
 namespace RAMCloud {
 
@@ -45,7 +47,9 @@ class Enumeration {
                 EnumerationIterator& iter,
                 Log& log,
                 HashTable& objectMap,
-                Buffer& payload, uint32_t maxPayloadBytes);
+                Buffer& payload, uint32_t maxPayloadBytes,
+                TabletMembership* membership = NULL,
+                const EnumerationFilter* filter = NULL);
     void complete();
 
   PRIVATE:
@@ -84,6 +88,34 @@ class Enumeration {
 
     /// The maximum number of bytes of objects to be returned.
     uint32_t maxPayloadBytes;
+
+    /// If non-NULL, used to visit only the buckets that may hold objects
+    /// of the tablet, when it is small compared to the hash table.
+    TabletMembership* membership;
+
+    /// If non-NULL, only objects matching this filter are returned.
+    const EnumerationFilter* filter;
+
+    /// Each returned object is truncated so that at most this many bytes
+    /// of its value are included; derived from keysOnly and #filter.
+    uint32_t maxValueBytes;
+
+    /**
+     * Enumerate by visiting only the buckets of the tablet's key hashes if
+     * there are fewer than one per this many buckets left to scan.
+     */
+    static const uint64_t SPARSE_BUCKET_RATIO = 8;
+
+    /**
+     * When a filter is applied, stop after scanning this many buckets even
+     * if the payload has room. A selective filter may match nothing for a
+     * long stretch of the hash table, and without a limit one RPC could
+     * walk all of it. Not const so that tests can lower it.
+     */
+    static uint64_t maxFilteredBuckets;
+
+    bool getTabletBuckets(uint64_t firstBucket, uint64_t numBuckets,
+                          vector<uint64_t>* buckets);
 };
 
 }
@@ -0,0 +1,189 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "ClientException.h"
+#include "EnumerationFilter.h"
+#include "IndexKey.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a filter that selects every object, whole.
+ */
+EnumerationFilter::EnumerationFilter()
+    : lastKeyHash(~0lu)
+    , minVersion(0)
+    , maxValueBytes(~0u)
+    , keyPrefix()
+    , indexId(0)
+    , firstIndexKey()
+    , lastIndexKey()
+{
+}
+
+/**
+ * Only select objects whose secondary key for a given index lies within a
+ * range. The key blobs are copied.
+ *
+ * \param indexId
+ *      Identifies the secondary key to test; must be nonzero.
+ * \param firstKey
+ *      Smallest secondary key to select (inclusive).
+ * \param firstKeyLength
+ *      Number of bytes in \a firstKey.
+ * \param lastKey
+ *      Largest secondary key to select (inclusive).
+ * \param lastKeyLength
+ *      Number of bytes in \a lastKey.
+ */
+void
+EnumerationFilter::setIndexKeyRange(uint8_t indexId, const void* firstKey,
+        uint16_t firstKeyLength, const void* lastKey, uint16_t lastKeyLength)
+{
+    this->indexId = indexId;
+    firstIndexKey.assign(static_cast<const char*>(firstKey), firstKeyLength);
+    lastIndexKey.assign(static_cast<const char*>(lastKey), lastKeyLength);
+}
+
+/**
+ * Only select objects whose primary keys start with a given prefix. The
+ * prefix is copied.
+ *
+ * \param prefix
+ *      First bytes of the keys to select.
+ * \param length
+ *      Number of bytes in \a prefix.
+ */
+void
+EnumerationFilter::setKeyPrefix(const void* prefix, uint16_t length)
+{
+    keyPrefix.assign(static_cast<const char*>(prefix), length);
+}
+
+/**
+ * Decide whether an object satisfies the filter's predicates.
+ *
+ * \param object
+ *      The object to test.
+ * \param keyHash
+ *      Hash of the object's primary key.
+ * \return
+ *      True if the object should be returned.
+ */
+bool
+EnumerationFilter::matches(Object& object, KeyHash keyHash) const
+{
+    if (keyHash > lastKeyHash || object.getVersion() < minVersion)
+        return false;
+
+    if (!keyPrefix.empty()) {
+        KeyLength keyLength;
+        const void* key = object.getKey(0, &keyLength);
+        if (keyLength < keyPrefix.size() ||
+                memcmp(key, keyPrefix.data(), keyPrefix.size()) != 0)
+            return false;
+    }
+
+    if (indexId != 0) {
+        if (indexId >= object.getKeyCount())
+            return false;
+        IndexKey::IndexKeyRange range(indexId,
+                firstIndexKey.data(), downCast<uint16_t>(firstIndexKey.size()),
+                lastIndexKey.data(), downCast<uint16_t>(lastIndexKey.size()));
+        if (!IndexKey::isKeyInRange(&object, &range))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Return true if the filter has no predicates set (every object matches,
+ * so there is no need to call #matches). It may still truncate values.
+ */
+bool
+EnumerationFilter::selectsAll() const
+{
+    return lastKeyHash == ~0lu && minVersion == 0 && keyPrefix.empty() &&
+            indexId == 0;
+}
+
+/**
+ * Fill in a filter from an incoming ENUMERATE request.
+ *
+ * \param reqHdr
+ *      Header of the request.
+ * \param request
+ *      The request; the key blobs are read from it.
+ * \param offset
+ *      Offset within \a request of the first key blob (i.e. the end of
+ *      the header).
+ * \return
+ *      The number of bytes of key blobs that were consumed; the
+ *      enumeration iterator follows them.
+ *
+ * \throw MessageTooShortError
+ *      The request doesn't hold as many key bytes as the header says.
+ */
+uint32_t
+EnumerationFilter::parseFromRequest(
+        const WireFormat::Enumerate::Request* reqHdr, Buffer* request,
+        uint32_t offset)
+{
+    lastKeyHash = reqHdr->lastKeyHash;
+    minVersion = reqHdr->minVersion;
+    maxValueBytes = reqHdr->maxValueBytes;
+    indexId = reqHdr->indexId;
+
+    uint32_t length = reqHdr->keyPrefixLength + reqHdr->firstIndexKeyLength
+            + reqHdr->lastIndexKeyLength;
+    const char* keys = static_cast<const char*>(
+            request->getRange(offset, length));
+    if (keys == NULL && length > 0)
+        throw MessageTooShortError(HERE);
+    keyPrefix.assign(keys, reqHdr->keyPrefixLength);
+    keys += reqHdr->keyPrefixLength;
+    firstIndexKey.assign(keys, reqHdr->firstIndexKeyLength);
+    keys += reqHdr->firstIndexKeyLength;
+    lastIndexKey.assign(keys, reqHdr->lastIndexKeyLength);
+    return length;
+}
+
+/**
+ * Describe the filter in an outgoing ENUMERATE request. This must be
+ * invoked before anything following the key blobs (i.e. the iterator) is
+ * appended to the request.
+ *
+ * \param reqHdr
+ *      Header of the request, already allocated in \a request.
+ * \param request
+ *      The key blobs are appended here.
+ */
+void
+EnumerationFilter::serializeToRequest(WireFormat::Enumerate::Request* reqHdr,
+        Buffer* request) const
+{
+    reqHdr->lastKeyHash = lastKeyHash;
+    reqHdr->minVersion = minVersion;
+    reqHdr->maxValueBytes = maxValueBytes;
+    reqHdr->keyPrefixLength = downCast<uint16_t>(keyPrefix.size());
+    reqHdr->indexId = indexId;
+    reqHdr->firstIndexKeyLength = downCast<uint16_t>(firstIndexKey.size());
+    reqHdr->lastIndexKeyLength = downCast<uint16_t>(lastIndexKey.size());
+    request->appendCopy(keyPrefix.data(), reqHdr->keyPrefixLength);
+    request->appendCopy(firstIndexKey.data(), reqHdr->firstIndexKeyLength);
+    request->appendCopy(lastIndexKey.data(), reqHdr->lastIndexKeyLength);
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_ENUMERATIONFILTER_H
+#define RAMCLOUD_ENUMERATIONFILTER_H
+
+#include "Common.h"
+#include "Buffer.h"
+#include "Object.h"
+#include "WireFormat.h"
+
+namespace RAMCloud {
+
+/**
+ * Describes which objects a table scan should return and how much of each
+ * one; masters apply it while enumerating, so objects that don't match
+ * never cross the network. The client sets the fields it cares about (the
+ * defaults select every object, whole) and TableScanner ships the filter
+ * with each ENUMERATE request.
+ *
+ * Predicates are conjunctive: an object is returned only if it satisfies
+ * all of the ones that are set.
+ */
+class EnumerationFilter {
+  public:
+    EnumerationFilter();
+
+    void setIndexKeyRange(uint8_t indexId, const void* firstKey,
+            uint16_t firstKeyLength, const void* lastKey,
+            uint16_t lastKeyLength);
+    void setKeyPrefix(const void* prefix, uint16_t length);
+
+    bool matches(Object& object, KeyHash keyHash) const;
+    bool selectsAll() const;
+    uint32_t parseFromRequest(const WireFormat::Enumerate::Request* reqHdr,
+            Buffer* request, uint32_t offset);
+    void serializeToRequest(WireFormat::Enumerate::Request* reqHdr,
+            Buffer* request) const;
+
+    /// Objects whose key hashes exceed this are skipped.
+    uint64_t lastKeyHash;
+
+    /// Objects whose versions are lower than this are skipped; used to
+    /// find what has changed since some earlier point.
+    uint64_t minVersion;
+
+    /// Projection: at most this many bytes of each object's value are
+    /// returned; the rest is truncated, as for keys-only enumeration.
+    uint32_t maxValueBytes;
+
+    /// If nonempty, only objects whose primary keys start with these
+    /// bytes are returned.
+    string keyPrefix;
+
+    /// If nonzero, only objects whose secondary key for this index lies
+    /// within [firstIndexKey, lastIndexKey] are returned.
+    uint8_t indexId;
+
+    /// Smallest secondary key to return (inclusive); see #indexId.
+    string firstIndexKey;
+
+    /// Largest secondary key to return (inclusive); see #indexId.
+    string lastIndexKey;
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_ENUMERATIONFILTER_H
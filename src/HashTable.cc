@@ -152,7 +152,8 @@ HashTable::Entry::pack(uint64_t hash, bool chain, uint64_t ptr)
  * Construct an empty set of candidates.
  */
 HashTable::Candidates::Candidates()
-    : bucket(NULL)
+    : table(NULL)
+    , bucket(NULL)
     , index()
     , secondaryHash()
 {
@@ -164,8 +165,10 @@ HashTable::Candidates::Candidates()
  * given secondaryHash.
  */
 void
-HashTable::Candidates::init(CacheLine* cl, uint64_t secondaryHash)
+HashTable::Candidates::init(HashTable* table, CacheLine* cl,
+                            uint64_t secondaryHash)
 {
+    this->table = table;
     bucket = cl;
     index = -1;
     this->secondaryHash = secondaryHash;
@@ -202,8 +205,10 @@ HashTable::Candidates::setReference(uint64_t reference)
 void
 HashTable::Candidates::remove()
 {
-    if (bucket != NULL)
+    if (bucket != NULL) {
         bucket->entries[index].clear();
+        table->numEntries--;
+    }
 }
 
 /**
@@ -265,6 +270,16 @@ HashTable::Candidates::isDone()
 HashTable::HashTable(uint64_t numBuckets, bool useHugepages)
     : numBuckets(BitOps::powerOfTwoLessOrEqual(numBuckets))
     , buckets(this->numBuckets * sizeof(CacheLine), useHugepages)
+    , useHugepages(useHugepages)
+    , resizeNumBuckets(0)
+    , resizeBuckets()
+    , preparedBuckets()
+    , migratedUnits(0)
+    , retiredNumBuckets(0)
+    , numEntries(0)
+    , numOverflowLines(0)
+    , maxChainLength(1)
+    , numResizes(0)
 {
     if (numBuckets != this->numBuckets) {
         RAMCLOUD_LOG(DEBUG,
@@ -282,22 +297,10 @@ HashTable::HashTable(uint64_t numBuckets, bool useHugepages)
  */
 HashTable::~HashTable()
 {
-    uint32_t lastEntryIndex = ENTRIES_PER_CACHE_LINE - 1;
-
-    for (uint64_t i = 0; i < numBuckets; ++i) {
-        CacheLine* currBucket = &buckets.get()[i];
-
-        // Skip the first bucket and break the chain
-        Entry* last = &currBucket->entries[lastEntryIndex];
-        currBucket = last->getChainPointer();
-        last->clear();
-
-        while (currBucket != NULL) {
-            CacheLine *nextBucket
-                        = currBucket->entries[lastEntryIndex].getChainPointer();
-            free(currBucket);
-            currBucket = nextBucket;
-        }
+    freeChains(buckets.get(), numBuckets);
+    if (resizeBuckets) {
+        freeChains(resizeBuckets->get(),
+                   isResizing() ? resizeNumBuckets : retiredNumBuckets);
     }
 }
 
@@ -322,7 +325,7 @@ HashTable::lookup(KeyHash keyHash, Candidates& candidates)
     // caller as it examines possible candidates.
     uint64_t secondaryHash;
     CacheLine *bucket = findBucket(keyHash, &secondaryHash);
-    candidates.init(bucket, secondaryHash);
+    candidates.init(this, bucket, secondaryHash);
 }
 
 /**
@@ -341,28 +344,55 @@ void
 HashTable::insert(KeyHash keyHash, uint64_t reference)
 {
     uint64_t secondaryHash;
-    int overflowBuckets = 0;
     CacheLine* bucket = findBucket(keyHash, &secondaryHash);
+    insertInBucket(bucket, secondaryHash, reference);
+    numEntries++;
+}
+
+/**
+ * Helper for #insert() and #migrateBucket(): store a reference in the first
+ * free entry of a bucket's chain, extending the chain with a new overflow
+ * cache line if the bucket is full.
+ *
+ * \param bucket
+ *      First cache line of the bucket to insert into.
+ * \param secondaryHash
+ *      The secondary hash bits (16 bits) of the key being inserted.
+ * \param reference
+ *      Reference to the new element to insert into the hash table.
+ * \return
+ *      The number of cache lines from the start of the bucket to the
+ *      one the reference was stored in (1 means the bucket's first line).
+ */
+uint32_t
+HashTable::insertInBucket(CacheLine* bucket, uint64_t secondaryHash,
+                          uint64_t reference)
+{
+    uint32_t chainLength = 1;
     while (true) {
         Entry* entry = bucket->entries;
         for (size_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
             if (entry->isAvailable()) {
                 entry->setReference(secondaryHash, reference);
-                return;
+                uint64_t longest = maxChainLength;
+                while (chainLength > longest &&
+                       !maxChainLength.compare_exchange_weak(longest,
+                                                             chainLength)) {
+                    // compare_exchange_weak reloaded longest; try again.
+                }
+                return chainLength;
             }
             entry++;
         }
 
         // No free space in the current bucket; see if there is an
         // overflow bucket chained onto this one.
-        ++overflowBuckets;
         Entry* last = &bucket->entries[ENTRIES_PER_CACHE_LINE - 1];
         bucket = last->getChainPointer();
         if (bucket == NULL) {
             // no empty space found, allocate a new cache line
-            RAMCLOUD_CLOG(NOTICE, "Allocating overflow bucket %d for index %lu",
-                    overflowBuckets,
-                    findBucketIndex(numBuckets, keyHash, &secondaryHash));
+            RAMCLOUD_CLOG(NOTICE, "Allocating overflow bucket %u",
+                    chainLength);
             void *buf = Memory::xmemalign(HERE, sizeof(CacheLine),
                                           sizeof(CacheLine));
             bucket = static_cast<CacheLine *>(buf);
@@ -370,7 +400,9 @@ HashTable::insert(KeyHash keyHash, uint64_t reference)
             for (size_t i = 1; i < ENTRIES_PER_CACHE_LINE; i++)
                 bucket->entries[i].clear();
             last->setChainPointer(bucket);
+            numOverflowLines++;
         }
+        ++chainLength;
     }
 }
 
@@ -391,9 +423,44 @@ uint64_t
 HashTable::forEachInBucket(void (*callback)(uint64_t, void *),
                            void *cookie,
                            uint64_t bucket)
+{
+    if (expect_true(!isResizing()))
+        return forEachInChain(callback, cookie, &buckets.get()[bucket]);
+
+    // While resizing, bucket indexes name units: visit every bucket of the
+    // unit in whichever array currently holds its keys.
+    uint64_t numUnits = getNumUnits();
+    CacheLine* array = buckets.get();
+    uint64_t arraySize = numBuckets;
+    if (bucket < migratedUnits) {
+        array = resizeBuckets->get();
+        arraySize = resizeNumBuckets;
+    }
+
+    uint64_t numCalls = 0;
+    for (uint64_t i = bucket; i < arraySize; i += numUnits)
+        numCalls += forEachInChain(callback, cookie, &array[i]);
+    return numCalls;
+}
+
+/**
+ * Helper for #forEachInBucket(): apply the given callback function to each
+ * element stored in a single chain of cache lines.
+ * \param callback
+ *      The callback to fire on each element stored in the chain.
+ * \param cookie
+ *      An opaque parameter to pass to the callback function.
+ * \param cl
+ *      The first cache line of the chain (the one in the bucket array).
+ * \return
+ *      The total number of callbacks fired.
+ */
+uint64_t
+HashTable::forEachInChain(void (*callback)(uint64_t, void *),
+                          void *cookie,
+                          CacheLine* cl)
 {
     uint64_t numCalls = 0;
-    CacheLine *cl = &buckets.get()[bucket];
     while (1) {
         for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
             Entry *e = &cl->entries[j];
@@ -426,8 +493,9 @@ uint64_t
 HashTable::forEach(void (*callback)(uint64_t, void *), void *cookie)
 {
     uint64_t numCalls = 0;
+    uint64_t numUnits = getNumUnits();
 
-    for (uint64_t i = 0; i < numBuckets; i++)
+    for (uint64_t i = 0; i < numUnits; i++)
         numCalls += forEachInBucket(callback, cookie, i);
 
     return numCalls;
@@ -443,6 +511,68 @@ HashTable::prefetchBucket(KeyHash keyHash)
     prefetch(findBucket(keyHash, &dummy));
 }
 
+/**
+ * Prefetch the elements referenced by the entries in the first cache line of
+ * the given key hash's bucket whose secondary hash matches; these are the
+ * candidates a subsequent lookup() will return. This reads the bucket, so
+ * it's most useful once the bucket has already been prefetched. Overflow
+ * chains aren't followed. No lock is needed, but the caller must ensure that
+ * no resize starts or finishes while this runs.
+ *
+ * \param keyHash
+ *      Hash of the key that will be looked up.
+ * \param numBytes
+ *      Number of bytes to prefetch starting at each referenced address.
+ */
+void
+HashTable::prefetchReferences(KeyHash keyHash, uint32_t numBytes)
+{
+    uint64_t secondaryHash;
+    CacheLine* bucket = findBucket(keyHash, &secondaryHash);
+    for (uint32_t i = 0; i < ENTRIES_PER_CACHE_LINE; i++) {
+        // Copied because other threads may be changing the bucket.
+        Entry entry = bucket->entries[i];
+        if (entry.hashMatches(secondaryHash)) {
+            prefetch(reinterpret_cast<const void*>(entry.getReference()),
+                     numBytes);
+        }
+    }
+}
+
+/**
+ * Prefetch everything needed to look up a batch of keys: first their
+ * buckets, then the elements those buckets reference. The two stages are
+ * staggered a window of keys apart (in the style of AMAC), so that many
+ * misses are outstanding at once and each stage finds the lines the
+ * previous one asked for already in cache. Callers resolve the lookups
+ * afterwards as usual; nothing here takes locks or changes the table. As
+ * with prefetchReferences(), the caller must ensure that no resize starts or
+ * finishes while this runs.
+ *
+ * \param keyHashes
+ *      Hashes of the keys that will be looked up.
+ * \param count
+ *      Number of entries in \a keyHashes.
+ * \param referenceBytes
+ *      Number of bytes to prefetch from each referenced element (see
+ *      prefetchReferences()).
+ */
+void
+HashTable::prefetchBatch(const KeyHash* keyHashes, uint32_t count,
+                         uint32_t referenceBytes)
+{
+    uint32_t window = PREFETCH_BATCH_WINDOW;
+    for (uint32_t i = 0; i < std::min(window, count); i++)
+        prefetchBucket(keyHashes[i]);
+    for (uint32_t start = 0; start < count; start += window) {
+        uint32_t next = start + window;
+        for (uint32_t i = next; i < std::min(next + window, count); i++)
+            prefetchBucket(keyHashes[i]);
+        for (uint32_t i = start; i < std::min(next, count); i++)
+            prefetchReferences(keyHashes[i], referenceBytes);
+    }
+}
+
 /**
  * Return the number of bytes per cache line.
  */
@@ -463,12 +593,23 @@ HashTable::entriesPerCacheLine()
 }
 
 /**
- * Returns the number of buckets allocated to the table.
+ * Returns the number of buckets that keys currently map to. While a resize
+ * is in progress this is the number of units (the smaller of the old and
+ * new sizes); indexes passed to #forEachInBucket() must be less than it.
  */
 uint64_t
 HashTable::getNumBuckets() const
 {
-    return numBuckets;
+    return getNumUnits();
+}
+
+/**
+ * Returns the number of references currently stored in the table.
+ */
+uint64_t
+HashTable::getNumEntries() const
+{
+    return numEntries;
 }
 
 /**
@@ -513,8 +654,311 @@ HashTable::findBucketIndex(uint64_t numBuckets,
 HashTable::CacheLine*
 HashTable::findBucket(KeyHash keyHash, uint64_t *secondaryHash) //const
 {
+    if (expect_false(isResizing()))
+        return findMigratingBucket(keyHash, secondaryHash);
     uint64_t bucketIndex = findBucketIndex(numBuckets, keyHash, secondaryHash);
     return &buckets.get()[bucketIndex];
 }
 
+/**
+ * Slow path of #findBucket() used while a resize is in progress: a key lives
+ * in the new bucket array if its unit has already been migrated, and in the
+ * old one otherwise.
+ * \param[in] keyHash
+ *      Hash of key representing the element we're looking for.
+ * \param[out] secondaryHash
+ *      The secondary hash bits (16 bits).
+ * \return
+ *      The bucket corresponding to the given key.
+ */
+HashTable::CacheLine*
+HashTable::findMigratingBucket(KeyHash keyHash, uint64_t *secondaryHash)
+{
+    uint64_t unit = findBucketIndex(getNumUnits(), keyHash, secondaryHash);
+    if (unit < migratedUnits) {
+        uint64_t bucketIndex = findBucketIndex(resizeNumBuckets, keyHash,
+                                               secondaryHash);
+        return &resizeBuckets->get()[bucketIndex];
+    }
+    uint64_t bucketIndex = findBucketIndex(numBuckets, keyHash, secondaryHash);
+    return &buckets.get()[bucketIndex];
+}
+
+/**
+ * Returns the number of units (see \ref resize) in the table. When no
+ * resize is in progress every bucket is its own unit.
+ */
+uint64_t
+HashTable::getNumUnits() const
+{
+    if (expect_true(!isResizing()))
+        return numBuckets;
+    return std::min(numBuckets, resizeNumBuckets);
+}
+
+/**
+ * Free all overflow cache lines chained off of an array of buckets.
+ * \param buckets
+ *      The array of buckets whose chains should be freed.
+ * \param numBuckets
+ *      Number of buckets in \a buckets.
+ * \return
+ *      The number of cache lines freed.
+ */
+uint64_t
+HashTable::freeChains(CacheLine* buckets, uint64_t numBuckets)
+{
+    uint32_t lastEntryIndex = ENTRIES_PER_CACHE_LINE - 1;
+    uint64_t numFreed = 0;
+
+    for (uint64_t i = 0; i < numBuckets; ++i) {
+        CacheLine* currBucket = &buckets[i];
+
+        // Skip the first bucket and break the chain
+        Entry* last = &currBucket->entries[lastEntryIndex];
+        currBucket = last->getChainPointer();
+        last->clear();
+
+        while (currBucket != NULL) {
+            CacheLine *nextBucket
+                        = currBucket->entries[lastEntryIndex].getChainPointer();
+            free(currBucket);
+            currBucket = nextBucket;
+            numFreed++;
+        }
+    }
+    return numFreed;
+}
+
+/**
+ * Decide whether the table ought to be resized, given the number of entries
+ * it holds. The table is doubled when it averages more than
+ * #MAX_ENTRIES_PER_BUCKET entries per bucket and halved when it has more
+ * than #MIN_BUCKETS_PER_ENTRY buckets per entry.
+ * \param minBuckets
+ *      The table will never be shrunk below this many buckets, and is never
+ *      resized at all if it is already smaller. Must be a power of two.
+ * \return
+ *      The number of buckets the table should have. If this is the same as
+ *      #getNumBuckets(), or a resize is already in progress, no resize is
+ *      needed.
+ */
+uint64_t
+HashTable::getResizeTarget(uint64_t minBuckets) const
+{
+    if (isResizing() || numBuckets < minBuckets)
+        return getNumBuckets();
+
+    uint64_t entries = numEntries;
+    if (entries > numBuckets * MAX_ENTRIES_PER_BUCKET)
+        return numBuckets * 2;
+    if (entries * MIN_BUCKETS_PER_ENTRY < numBuckets &&
+            numBuckets / 2 >= minBuckets)
+        return numBuckets / 2;
+    return numBuckets;
+}
+
+/**
+ * Allocate the bucket array for a future #startResize(). Allocating (and
+ * faulting in) a large array can take a long time, so this is separate
+ * from #startResize(): it may run concurrently with any other operation on
+ * the table except #startResize() and #prepareResize() themselves.
+ *
+ * \param newNumBuckets
+ *      Number of buckets in the resized table. Must be a power of two and
+ *      differ from the current size.
+ * \throw Exception
+ *      The new size is not valid.
+ */
+void
+HashTable::prepareResize(uint64_t newNumBuckets)
+{
+    if (!BitOps::isPowerOfTwo(newNumBuckets) || newNumBuckets == numBuckets) {
+        throw Exception(HERE, format("Can't resize HashTable from %lu to "
+                "%lu buckets", numBuckets, newNumBuckets));
+    }
+    preparedBuckets.destroy();
+    preparedBuckets.construct(newNumBuckets * sizeof(CacheLine), useHugepages);
+}
+
+/**
+ * Begin resizing the table to a new number of buckets. This only installs
+ * the new bucket array; entries are moved by #migrateBucket(). The caller
+ * must have exclusive access to the table. The array is the one allocated
+ * by #prepareResize() if its size matches, otherwise it is allocated here.
+ *
+ * \param newNumBuckets
+ *      Number of buckets in the resized table. Must be a power of two and
+ *      differ from the current size.
+ * \throw Exception
+ *      A resize is already in progress, the previous bucket array has not
+ *      yet been freed, or the new size is not valid.
+ */
+void
+HashTable::startResize(uint64_t newNumBuckets)
+{
+    if (isResizing() || hasRetiredBuckets())
+        throw Exception(HERE, "HashTable resize already in progress");
+    if (!BitOps::isPowerOfTwo(newNumBuckets) || newNumBuckets == numBuckets) {
+        throw Exception(HERE, format("Can't resize HashTable from %lu to "
+                "%lu buckets", numBuckets, newNumBuckets));
+    }
+    if (!preparedBuckets ||
+            preparedBuckets->length != newNumBuckets * sizeof(CacheLine)) {
+        prepareResize(newNumBuckets);
+    }
+
+    resizeBuckets.construct(0);
+    resizeBuckets->swap(*preparedBuckets);
+    preparedBuckets.destroy();
+    resizeNumBuckets = newNumBuckets;
+    migratedUnits = 0;
+    maxChainLength = 1;
+}
+
+/**
+ * Returns true if a resize has been started and not yet finished.
+ */
+bool
+HashTable::isResizing() const
+{
+    return resizeNumBuckets != 0;
+}
+
+/**
+ * Returns the index of the unit that the next call to #migrateBucket() must
+ * be given. Units are migrated in increasing order.
+ */
+uint64_t
+HashTable::getNextBucketToMigrate() const
+{
+    return migratedUnits;
+}
+
+/**
+ * Move all entries belonging to one unit (see \ref resize) from the old
+ * bucket array into the new one. The caller must prevent any other operation
+ * on keys in this unit for the duration of the call; operations on other
+ * units may proceed concurrently.
+ *
+ * The old buckets are left untouched so that unsynchronized readers that
+ * already started scanning them still see a consistent snapshot; they are
+ * reclaimed by #freeRetiredBuckets().
+ *
+ * \param bucket
+ *      The unit to migrate; must be #getNextBucketToMigrate().
+ * \param hasher
+ *      Invoked on each reference in the unit to obtain the full hash of its
+ *      key.
+ * \param cookie
+ *      An opaque parameter to pass to \a hasher.
+ * \return
+ *      True if every unit has now been migrated and #finishResize() may be
+ *      called; false if more units remain.
+ * \throw Exception
+ *      No resize is in progress or \a bucket is out of order.
+ */
+bool
+HashTable::migrateBucket(uint64_t bucket, ReferenceHasher hasher, void* cookie)
+{
+    if (!isResizing() || bucket != migratedUnits) {
+        throw Exception(HERE, format("Can't migrate HashTable bucket %lu",
+                bucket));
+    }
+
+    uint64_t numUnits = getNumUnits();
+    for (uint64_t i = bucket; i < numBuckets; i += numUnits) {
+        CacheLine* cl = &buckets.get()[i];
+        while (cl != NULL) {
+            for (uint32_t j = 0; j < ENTRIES_PER_CACHE_LINE; j++) {
+                Entry* e = &cl->entries[j];
+                if (e->isAvailable() || e->getChainPointer() != NULL)
+                    continue;
+
+                uint64_t reference = e->getReference();
+                uint64_t secondaryHash;
+                uint64_t newIndex = findBucketIndex(resizeNumBuckets,
+                        hasher(reference, cookie), &secondaryHash);
+                assert(e->hashMatches(secondaryHash));
+                insertInBucket(&resizeBuckets->get()[newIndex], secondaryHash,
+                               reference);
+            }
+            cl = cl->entries[ENTRIES_PER_CACHE_LINE - 1].getChainPointer();
+        }
+    }
+
+    migratedUnits = bucket + 1;
+    return migratedUnits == numUnits;
+}
+
+/**
+ * Complete a resize once every unit has been migrated: the new bucket array
+ * becomes current and the old one is retired until #freeRetiredBuckets().
+ * The caller must have exclusive access to the table.
+ *
+ * \throw Exception
+ *      No resize is in progress or some units have not been migrated.
+ */
+void
+HashTable::finishResize()
+{
+    if (!isResizing() || migratedUnits != getNumUnits())
+        throw Exception(HERE, "HashTable resize is not ready to finish");
+
+    buckets.swap(*resizeBuckets);
+    retiredNumBuckets = numBuckets;
+    numBuckets = resizeNumBuckets;
+    resizeNumBuckets = 0;
+    migratedUnits = 0;
+    numResizes++;
+}
+
+/**
+ * Returns true if a previous resize left behind a bucket array that
+ * #freeRetiredBuckets() has not yet released.
+ */
+bool
+HashTable::hasRetiredBuckets() const
+{
+    return retiredNumBuckets != 0;
+}
+
+/**
+ * Release the bucket array (and its overflow cache lines) that was current
+ * before the last completed resize. The caller must ensure that no reader
+ * that could have started scanning the old array before #finishResize() is
+ * still running.
+ */
+void
+HashTable::freeRetiredBuckets()
+{
+    if (!hasRetiredBuckets())
+        return;
+    numOverflowLines -= freeChains(resizeBuckets->get(), retiredNumBuckets);
+    resizeBuckets.destroy();
+    retiredNumBuckets = 0;
+}
+
+/**
+ * Fill in a protocol buffer with the table's occupancy, chain length, and
+ * resize progress.
+ * \param stats
+ *      Protocol buffer to fill in.
+ */
+void
+HashTable::getStatistics(ProtoBuf::ServerStatistics_HashTableStats* stats)
+        const
+{
+    stats->set_num_buckets(getNumBuckets());
+    stats->set_num_entries(numEntries);
+    stats->set_num_overflow_cache_lines(numOverflowLines);
+    stats->set_max_chain_length(maxChainLength);
+    stats->set_num_resizes(numResizes);
+    if (isResizing()) {
+        stats->set_resize_target_buckets(resizeNumBuckets);
+        stats->set_resize_migrated_units(migratedUnits);
+        stats->set_resize_total_units(getNumUnits());
+    }
+}
+
 } // namespace RAMCloud
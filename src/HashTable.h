@@ -16,6 +16,8 @@
 #ifndef RAMCLOUD_HASHTABLE_H
 #define RAMCLOUD_HASHTABLE_H
 
+#include <atomic>
+
 #include "Common.h"
 #include "BitOps.h"
 #include "CycleCounter.h"
@@ -23,6 +25,8 @@
 #include "Memory.h"
 #include "MurmurHash3.h"
 #include "Key.h"
+#include "ServerStatistics.pb.h"
+#include "Tub.h"
 
 namespace RAMCloud {
 
@@ -52,6 +56,29 @@ namespace RAMCloud {
  * buckets). In this case, the last hash table entry in each of the
  * non-terminal cache lines has a pointer to the next cache line instead of a
  * log reference.
+ *
+ * \section resize Incremental Resizing
+ *
+ * The table may be doubled or halved while it is in use. #prepareResize()
+ * allocates a second bucket array, #startResize() publishes it, and
+ * #migrateBucket() then moves entries
+ * from the old array to the new one a "unit" at a time. A unit is the set
+ * of buckets (in both arrays) whose keys agree on the low log2(n) hash bits,
+ * where n is the smaller of the two array sizes; #getNumBuckets() returns n
+ * while a resize is in progress, so bucket indexes handed to
+ * #forEachInBucket() always name whole units. A key lives in the new array
+ * if and only if its unit has been migrated, so every operation touches a
+ * single array. Once every unit has moved, #finishResize() makes the new
+ * array current. The old array is kept intact (it still holds a snapshot of
+ * each migrated unit) until #freeRetiredBuckets() is called, so that
+ * unsynchronized readers never touch freed memory.
+ *
+ * Since the hash table itself is not thread-safe, callers must serialize
+ * operations on any given unit with #migrateBucket(), and must have
+ * exclusive access to the whole table in #startResize() and
+ * #finishResize(). #prepareResize() needs no exclusive access, so the
+ * (possibly very large) new array can be allocated and faulted in without
+ * blocking other operations.
  */
 class HashTable {
   PRIVATE:
@@ -200,7 +227,11 @@ class HashTable {
         bool isDone();
 
       PRIVATE:
-        void init(CacheLine* cl, uint64_t secondaryHash);
+        void init(HashTable* table, CacheLine* cl, uint64_t secondaryHash);
+
+        /// The table being iterated over; used to keep its entry count
+        /// up to date in #remove().
+        HashTable* table;
 
         /// Pointer to the hash table bucket we're currently iterating over.
         CacheLine* bucket;
@@ -217,6 +248,14 @@ class HashTable {
         friend class HashTable;
     };
 
+    /**
+     * Callback used by #migrateBucket() to recover the full hash of the key
+     * a reference refers to. The table only stores 16 bits of each key's
+     * hash, which is not enough to tell which bucket of a larger table the
+     * entry belongs in.
+     */
+    typedef KeyHash (*ReferenceHasher)(uint64_t reference, void* cookie);
+
     explicit HashTable(uint64_t numBuckets, bool useHugepages = false);
     ~HashTable();
     void lookup(KeyHash keyHash, Candidates& candidates);
@@ -226,13 +265,50 @@ class HashTable {
                              uint64_t bucket);
     uint64_t forEach(void (*callback)(uint64_t, void *), void *cookie);
     void prefetchBucket(KeyHash keyHash);
+    void prefetchReferences(KeyHash keyHash, uint32_t numBytes);
+    void prefetchBatch(const KeyHash* keyHashes, uint32_t count,
+                       uint32_t referenceBytes);
     static uint32_t bytesPerCacheLine();
     static uint32_t entriesPerCacheLine();
     uint64_t getNumBuckets() const;
+    uint64_t getNumEntries() const;
     static uint64_t findBucketIndex(uint64_t numBuckets,
                                     KeyHash keyHash,
                                     uint64_t *secondaryHash);
 
+    uint64_t getResizeTarget(uint64_t minBuckets) const;
+    void prepareResize(uint64_t newNumBuckets);
+    void startResize(uint64_t newNumBuckets);
+    bool isResizing() const;
+    uint64_t getNextBucketToMigrate() const;
+    bool migrateBucket(uint64_t bucket, ReferenceHasher hasher, void* cookie);
+    void finishResize();
+    bool hasRetiredBuckets() const;
+    void freeRetiredBuckets();
+    void getStatistics(ProtoBuf::ServerStatistics_HashTableStats* stats) const;
+
+    /**
+     * The table is grown when it holds more than this many entries per
+     * bucket on average. This leaves room in each bucket's first cache line
+     * for most keys, so that overflow chains stay short.
+     */
+    static const uint64_t MAX_ENTRIES_PER_BUCKET = 4;
+
+    /**
+     * The table is shrunk when it holds fewer than one entry per this many
+     * buckets on average. The gap between this and #MAX_ENTRIES_PER_BUCKET
+     * keeps the table from oscillating between two sizes.
+     */
+    static const uint64_t MIN_BUCKETS_PER_ENTRY = 2;
+
+    /**
+     * Number of keys prefetchBatch() has buckets in flight for while it
+     * prefetches the elements referenced by the previous window's buckets.
+     * Large enough to keep the core's miss buffers busy, small enough that
+     * nothing is evicted before it's used.
+     */
+    static const uint32_t PREFETCH_BATCH_WINDOW = 16;
+
   PRIVATE:
 
     // forward declarations
@@ -240,11 +316,20 @@ class HashTable {
     struct CacheLine;
 
     CacheLine * findBucket(KeyHash keyHash, uint64_t *secondaryHash);
+    CacheLine * findMigratingBucket(KeyHash keyHash, uint64_t *secondaryHash);
+    uint32_t insertInBucket(CacheLine* bucket, uint64_t secondaryHash,
+                            uint64_t reference);
+    static uint64_t forEachInChain(void (*callback)(uint64_t, void *),
+                                   void *cookie,
+                                   CacheLine* cl);
+    static uint64_t freeChains(CacheLine* buckets, uint64_t numBuckets);
+    uint64_t getNumUnits() const;
 
     /**
-     * The number of buckets allocated to the table.
+     * The number of buckets allocated to #buckets. Keys that have not been
+     * migrated during a resize map into buckets of this size.
      */
-    const uint64_t numBuckets;
+    uint64_t numBuckets;
 
     /**
      * The array of buckets.
@@ -252,6 +337,57 @@ class HashTable {
      */
     LargeBlockOfMemory<CacheLine> buckets;
 
+    /// Copy of the constructor argument; used for arrays allocated while
+    /// resizing.
+    const bool useHugepages;
+
+    /**
+     * The number of buckets in #resizeBuckets if a resize is in progress,
+     * otherwise 0.
+     */
+    uint64_t resizeNumBuckets;
+
+    /**
+     * While a resize is in progress, the bucket array that the table is
+     * being resized into. After the resize finishes, the bucket array that
+     * used to be current; it (and its overflow cache lines) are held until
+     * #freeRetiredBuckets() so that unsynchronized readers never see freed
+     * memory.
+     */
+    Tub<LargeBlockOfMemory<CacheLine>> resizeBuckets;
+
+    /**
+     * A bucket array allocated by #prepareResize() that #startResize() has
+     * not yet published. Nothing else refers to it.
+     */
+    Tub<LargeBlockOfMemory<CacheLine>> preparedBuckets;
+
+    /**
+     * The number of units (see \ref resize) that have been moved into
+     * #resizeBuckets. Units are migrated in order, so a key has moved if and
+     * only if its unit index is less than this value. This is atomic because
+     * operations on different units may run concurrently with migration.
+     */
+    std::atomic<uint64_t> migratedUnits;
+
+    /// If #resizeBuckets holds a retired bucket array, the number of
+    /// buckets in it; otherwise 0.
+    uint64_t retiredNumBuckets;
+
+    /// Number of references currently stored in the table.
+    std::atomic<uint64_t> numEntries;
+
+    /// Number of overflow cache lines currently allocated, including those
+    /// hanging off of #resizeBuckets.
+    std::atomic<uint64_t> numOverflowLines;
+
+    /// Longest chain (in cache lines) that an entry has been inserted into
+    /// since the table was constructed or the last resize began.
+    std::atomic<uint64_t> maxChainLength;
+
+    /// Number of resizes completed since the table was constructed.
+    uint64_t numResizes;
+
     friend void hashTableBenchmark(uint64_t nkeys, uint64_t nlines);
     DISALLOW_COPY_AND_ASSIGN(HashTable);
 };
@@ -672,6 +672,37 @@ TEST_F(HashTableTest, lookup) {
     EXPECT_EQ(outRef, vRef);
 }
 
+TEST_F(HashTableTest, prefetchBatch) {
+    // Spans several windows; every other key is in the table.
+    HashTable ht(64);
+    vector<string> stringKeys;
+    KeyHash keyHashes[40];
+    for (uint32_t i = 0; i < arrayLength(keyHashes); i++)
+        stringKeys.push_back(format("%u", i));
+    for (uint32_t i = 0; i < arrayLength(keyHashes); i++) {
+        values.push_back(new TestObject(0, stringKeys[i].c_str()));
+        Key key(0, stringKeys[i].c_str(),
+                downCast<uint16_t>(stringKeys[i].length()));
+        keyHashes[i] = key.getHash();
+        if (i % 2 == 0)
+            replace(&ht, key, values[i]->u64Address());
+    }
+
+    ht.prefetchBatch(keyHashes, arrayLength(keyHashes), 64);
+    ht.prefetchBatch(keyHashes, 0, 64);
+
+    EXPECT_EQ(20UL, ht.getNumEntries());
+    for (uint32_t i = 0; i < arrayLength(keyHashes); i++) {
+        Key key(0, stringKeys[i].c_str(),
+                downCast<uint16_t>(stringKeys[i].length()));
+        uint64_t outRef = 0;
+        EXPECT_EQ(i % 2 == 0, lookup(&ht, key, outRef));
+        if (i % 2 == 0) {
+            EXPECT_EQ(values[i]->u64Address(), outRef);
+        }
+    }
+}
+
 #if 0
 TEST_F(HashTableTest, remove) {
     HashTable ht(1);
@@ -821,4 +852,261 @@ TEST_F(HashTableTest, forEach) {
         EXPECT_EQ(1U, checkoff[i].count);
 }
 
+/**
+ * HashTable::ReferenceHasher for tables whose references are TestObjects.
+ */
+static KeyHash
+test_resize_hasher(uint64_t ref, void *cookie)
+{
+    EXPECT_EQ(cookie, reinterpret_cast<void *>(57));
+    TestObject* obj = reinterpret_cast<TestObject*>(ref);
+    Key key(obj->tableId, obj->stringKeyPtr, obj->stringKeyLength);
+    return key.getHash();
+}
+
+/**
+ * Check that every object in an array can be found in a hash table, and
+ * that forEach visits each of them exactly once.
+ */
+static void
+checkAllPresent(HashTableTest* test, HashTable* ht, TestObject* objects,
+                uint32_t numObjects)
+{
+    for (uint32_t i = 0; i < numObjects; i++) {
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        uint64_t outRef = 0;
+        EXPECT_TRUE(test->lookup(ht, key, outRef)) << i;
+        EXPECT_EQ(objects[i].u64Address(), outRef);
+        objects[i].count = 0;
+    }
+    EXPECT_EQ(numObjects, ht->forEach(test_forEach_callback,
+                                      reinterpret_cast<void *>(57)));
+    for (uint32_t i = 0; i < numObjects; i++)
+        EXPECT_EQ(1U, objects[i].count) << i;
+}
+
+TEST_F(HashTableTest, getResizeTarget) {
+    HashTable ht(4);
+    TestObject objects[20] = {};
+    EXPECT_EQ(4U, ht.getResizeTarget(4));
+    EXPECT_EQ(2U, ht.getResizeTarget(1));
+
+    for (uint32_t i = 0; i < 17; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        replace(&ht, key, objects[i].u64Address());
+    }
+    EXPECT_EQ(17U, ht.getNumEntries());
+    EXPECT_EQ(8U, ht.getResizeTarget(4));
+
+    // Tables smaller than the minimum are never resized.
+    EXPECT_EQ(4U, ht.getResizeTarget(8));
+
+    // Nor is a table that is already being resized.
+    ht.startResize(8);
+    EXPECT_EQ(4U, ht.getResizeTarget(4));
+}
+
+TEST_F(HashTableTest, startResize) {
+    HashTable ht(4);
+    EXPECT_THROW(ht.startResize(4), Exception);
+    EXPECT_THROW(ht.startResize(6), Exception);
+    EXPECT_FALSE(ht.isResizing());
+
+    ht.startResize(8);
+    EXPECT_TRUE(ht.isResizing());
+    EXPECT_EQ(8U, ht.resizeNumBuckets);
+    EXPECT_EQ(0U, ht.getNextBucketToMigrate());
+    EXPECT_EQ(4U, ht.getNumBuckets());
+    EXPECT_THROW(ht.startResize(16), Exception);
+}
+
+TEST_F(HashTableTest, prepareResize) {
+    HashTable ht(4);
+    EXPECT_THROW(ht.prepareResize(4), Exception);
+    EXPECT_THROW(ht.prepareResize(6), Exception);
+    EXPECT_FALSE(ht.preparedBuckets);
+
+    ht.prepareResize(8);
+    EXPECT_FALSE(ht.isResizing());
+    HashTable::CacheLine* prepared = ht.preparedBuckets->get();
+
+    // startResize publishes the prepared array rather than allocating.
+    ht.startResize(8);
+    EXPECT_EQ(prepared, ht.resizeBuckets->get());
+    EXPECT_FALSE(ht.preparedBuckets);
+}
+
+TEST_F(HashTableTest, prepareResize_sizeMismatch) {
+    HashTable ht(4);
+    ht.prepareResize(8);
+    ht.startResize(2);
+    EXPECT_EQ(2U, ht.resizeNumBuckets);
+    EXPECT_EQ(2 * sizeof(HashTable::CacheLine), ht.resizeBuckets->length);
+    EXPECT_FALSE(ht.preparedBuckets);
+}
+
+TEST_F(HashTableTest, migrateBucket_outOfOrder) {
+    HashTable ht(4);
+    void* cookie = reinterpret_cast<void *>(57);
+    EXPECT_THROW(ht.migrateBucket(0, test_resize_hasher, cookie), Exception);
+    ht.startResize(2);
+    EXPECT_THROW(ht.migrateBucket(1, test_resize_hasher, cookie), Exception);
+    EXPECT_FALSE(ht.migrateBucket(0, test_resize_hasher, cookie));
+    EXPECT_THROW(ht.finishResize(), Exception);
+    EXPECT_TRUE(ht.migrateBucket(1, test_resize_hasher, cookie));
+    ht.finishResize();
+}
+
+TEST_F(HashTableTest, resize_grow) {
+    HashTable ht(4);
+    void* cookie = reinterpret_cast<void *>(57);
+    const uint32_t arrayLen = 128;
+    TestObject objects[arrayLen] = {};
+    for (uint32_t i = 0; i < arrayLen / 2; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        replace(&ht, key, objects[i].u64Address());
+    }
+
+    ht.startResize(8);
+    EXPECT_FALSE(ht.migrateBucket(0, test_resize_hasher, cookie));
+    EXPECT_FALSE(ht.migrateBucket(1, test_resize_hasher, cookie));
+    checkAllPresent(this, &ht, objects, arrayLen / 2);
+
+    // Keys inserted mid-resize land in whichever array holds their unit.
+    for (uint32_t i = arrayLen / 2; i < arrayLen; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        replace(&ht, key, objects[i].u64Address());
+    }
+    checkAllPresent(this, &ht, objects, arrayLen);
+
+    EXPECT_FALSE(ht.migrateBucket(2, test_resize_hasher, cookie));
+    EXPECT_TRUE(ht.migrateBucket(3, test_resize_hasher, cookie));
+    checkAllPresent(this, &ht, objects, arrayLen);
+
+    ht.finishResize();
+    EXPECT_FALSE(ht.isResizing());
+    EXPECT_TRUE(ht.hasRetiredBuckets());
+    EXPECT_EQ(8U, ht.getNumBuckets());
+    EXPECT_EQ(arrayLen, ht.getNumEntries());
+    checkAllPresent(this, &ht, objects, arrayLen);
+
+    ht.freeRetiredBuckets();
+    EXPECT_FALSE(ht.hasRetiredBuckets());
+    EXPECT_FALSE(ht.resizeBuckets);
+    checkAllPresent(this, &ht, objects, arrayLen);
+}
+
+TEST_F(HashTableTest, prefetchBatch_duringResize) {
+    HashTable ht(4);
+    void* cookie = reinterpret_cast<void *>(57);
+    const uint32_t arrayLen = 64;
+    TestObject objects[arrayLen] = {};
+    KeyHash keyHashes[arrayLen];
+    for (uint32_t i = 0; i < arrayLen; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        keyHashes[i] = key.getHash();
+        replace(&ht, key, objects[i].u64Address());
+    }
+
+    // Half of the units are in the new array and half in the old one, so
+    // the batch reads buckets in both.
+    ht.startResize(8);
+    EXPECT_FALSE(ht.migrateBucket(0, test_resize_hasher, cookie));
+    EXPECT_FALSE(ht.migrateBucket(1, test_resize_hasher, cookie));
+    ht.prefetchBatch(keyHashes, arrayLen, 64);
+    checkAllPresent(this, &ht, objects, arrayLen);
+
+    EXPECT_FALSE(ht.migrateBucket(2, test_resize_hasher, cookie));
+    EXPECT_TRUE(ht.migrateBucket(3, test_resize_hasher, cookie));
+    ht.finishResize();
+    ht.prefetchBatch(keyHashes, arrayLen, 64);
+    EXPECT_EQ(arrayLen, ht.getNumEntries());
+    checkAllPresent(this, &ht, objects, arrayLen);
+}
+
+TEST_F(HashTableTest, resize_shrink) {
+    HashTable ht(8);
+    void* cookie = reinterpret_cast<void *>(57);
+    const uint32_t arrayLen = 64;
+    TestObject objects[arrayLen] = {};
+    for (uint32_t i = 0; i < arrayLen; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        replace(&ht, key, objects[i].u64Address());
+    }
+
+    ht.startResize(2);
+    EXPECT_EQ(2U, ht.getNumBuckets());
+    EXPECT_FALSE(ht.migrateBucket(0, test_resize_hasher, cookie));
+    checkAllPresent(this, &ht, objects, arrayLen);
+
+    // Removal from a migrated unit.
+    Key key(objects[0].tableId,
+            objects[0].stringKeyPtr,
+            objects[0].stringKeyLength);
+    HashTable::Candidates candidates;
+    ht.lookup(key.getHash(), candidates);
+    while (candidates.getReference() != objects[0].u64Address())
+        candidates.next();
+    candidates.remove();
+    EXPECT_EQ(arrayLen - 1, ht.getNumEntries());
+    checkAllPresent(this, &ht, objects + 1, arrayLen - 1);
+
+    EXPECT_TRUE(ht.migrateBucket(1, test_resize_hasher, cookie));
+    ht.finishResize();
+    EXPECT_EQ(2U, ht.getNumBuckets());
+    checkAllPresent(this, &ht, objects + 1, arrayLen - 1);
+}
+
+TEST_F(HashTableTest, getStatistics) {
+    HashTable ht(1);
+    TestObject objects[16] = {};
+    for (uint32_t i = 0; i < 16; i++) {
+        objects[i].setKey(format("%u", i));
+        Key key(objects[i].tableId,
+                objects[i].stringKeyPtr,
+                objects[i].stringKeyLength);
+        replace(&ht, key, objects[i].u64Address());
+    }
+
+    ProtoBuf::ServerStatistics_HashTableStats stats;
+    ht.getStatistics(&stats);
+    EXPECT_EQ("num_buckets: 1 num_entries: 16 num_overflow_cache_lines: 2 "
+              "max_chain_length: 3 num_resizes: 0",
+              stats.ShortDebugString());
+
+    ht.startResize(4);
+    ht.migrateBucket(0, test_resize_hasher, reinterpret_cast<void *>(57));
+    stats.Clear();
+    ht.getStatistics(&stats);
+    EXPECT_EQ("num_buckets: 1 num_entries: 16 num_overflow_cache_lines: 2 "
+              "max_chain_length: 1 num_resizes: 0 resize_target_buckets: 4 "
+              "resize_migrated_units: 1 resize_total_units: 1",
+              stats.ShortDebugString());
+
+    ht.finishResize();
+    ht.freeRetiredBuckets();
+    stats.Clear();
+    ht.getStatistics(&stats);
+    EXPECT_EQ("num_buckets: 4 num_entries: 16 num_overflow_cache_lines: 0 "
+              "max_chain_length: 1 num_resizes: 1",
+              stats.ShortDebugString());
+}
+
 } // namespace RAMCloud
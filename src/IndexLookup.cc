@@ -106,16 +106,20 @@ IndexLookup::isReady()
     if (!finishedLookup) {
 
         // Rule 1:
-        // Handle the completion of a LookupIndexKeys RPC.
+        // Handle the completion of a LookupIndexObjects RPC.
         if (lookupRpc.status == SENT && lookupRpc.rpc->isReady()) {
             uint16_t oldKeyLength = nextKeyLength; // should be 0 for first rpc.
             lookupRpc.rpc->wait(&lookupRpc.numHashes, &nextKeyLength,
-                    &nextKeyHash);
-            lookupRpc.offset = sizeof32(WireFormat::LookupIndexKeys::Response);
+                    &nextKeyHash, &lookupRpc.numHashesRead,
+                    &lookupRpc.numObjects);
+            lookupRpc.offset =
+                    sizeof32(WireFormat::LookupIndexObjects::Response);
+            lookupRpc.objectsOffset = lookupRpc.offset
+                    + lookupRpc.numHashes * sizeof32(KeyHash) + nextKeyLength;
 
             // Save the "next key" information from this response,
             // which will be used as the starting key for the next
-            // lookupIndexKeys request.
+            // lookupIndexObjects request.
             if (nextKeyLength > 0) {
                 // malloc for first use or if previous key was smaller
                 if (nextKeyLength > oldKeyLength) {
@@ -130,10 +134,59 @@ IndexLookup::isReady()
             lookupRpc.status = RESULT_READY;
         }
 
+        // Rule 2a:
+        // If the index server returned the objects for the first few
+        // PKHashes along with them, hand those objects to a free readRpc as
+        // if that readRpc had fetched them, so no readHashes RPC is needed
+        // for these PKHashes. If no readRpc is free or activeHashes has no
+        // room for the PKHashes right now, leave the objects in
+        // lookupRpc.resp until there is (Rule 2 waits as well, so that
+        // PKHashes stay in index order). If the server found no objects for
+        // these PKHashes, there is nothing to return for them; skip them.
+        if (lookupRpc.status == RESULT_READY && lookupRpc.numHashesRead > 0
+                && lookupRpc.numObjects == 0) {
+            lookupRpc.offset += lookupRpc.numHashesRead * sizeof32(KeyHash);
+            lookupRpc.numHashes -= lookupRpc.numHashesRead;
+            lookupRpc.numHashesRead = 0;
+        }
+        if (lookupRpc.status == RESULT_READY && lookupRpc.numHashesRead > 0) {
+            uint8_t i = 0;
+            while (i < NUM_READ_RPCS && readRpcs[i].status != FREE)
+                i++;
+            if (i < NUM_READ_RPCS && MAX_NUM_PK - (numInserted - numRemoved)
+                        >= lookupRpc.numHashesRead) {
+                ReadRpc& readRpc = readRpcs[i];
+                uint32_t length =
+                        lookupRpc.resp.size() - lookupRpc.objectsOffset;
+                readRpc.rpc.destroy();
+                readRpc.resp.reset();
+                readRpc.resp.appendCopy(lookupRpc.resp.getRange(
+                        lookupRpc.objectsOffset, length), length);
+                readRpc.numUnreadObjects = lookupRpc.numObjects;
+                readRpc.offset = 0;
+                readRpc.pKHashes.reset();
+                readRpc.numHashes = lookupRpc.numHashesRead;
+                readRpc.session = Transport::SessionRef();
+                readRpc.status = RESULT_READY;
+                for (uint32_t h = 0; h < lookupRpc.numHashesRead; h++) {
+                    activeHashes[numInserted & ARRAY_MASK]
+                        = *lookupRpc.resp.getOffset<KeyHash>(lookupRpc.offset);
+                    activeRpcIds[numInserted & ARRAY_MASK] = i;
+                    lookupRpc.offset += sizeof32(KeyHash);
+                    lookupRpc.numHashes--;
+                    numInserted++;
+                }
+                readRpc.maxPos = numInserted - 1;
+                lookupRpc.numHashesRead = 0;
+            }
+        }
+
         // Rule 2:
-        // If a returned lookupIndexKeys RPC still has some activeHashes
-        // unread, copy as much of them into activeHashes as possible.
-        if (lookupRpc.status == RESULT_READY && lookupRpc.numHashes > 0) {
+        // If a returned lookupIndexObjects RPC still has some activeHashes
+        // unread, and Rule 2a is done with it, copy as much of them into
+        // activeHashes as possible.
+        if (lookupRpc.status == RESULT_READY && lookupRpc.numHashes > 0
+                && lookupRpc.numHashesRead == 0) {
             while (lookupRpc.numHashes > 0
                     && numInserted - numRemoved < MAX_NUM_PK) {
                 // Possible optimization: Consider copying all PKHashes at once.
@@ -149,10 +202,10 @@ IndexLookup::isReady()
         }
 
         // Rule 3:
-        // If a returned lookupIndexKeys RPC has no unread PKHashes,
-        // issue the next lookupIndexKeys RPC, if another RPC is still needed,
-        // and set the status of the RPC to free if another RPC is not needed
-        // (and the lookup is all done).
+        // If a returned lookupIndexObjects RPC has no unread PKHashes,
+        // issue the next lookupIndexObjects RPC, if another RPC is still
+        // needed, and set the status of the RPC to free if another RPC is
+        // not needed (and the lookup is all done).
         if (lookupRpc.status == RESULT_READY && lookupRpc.numHashes == 0) {
             // Here we exploit the fact that 'nextKeyLength == 0'
             // indicates the index server contains the index key up to lastKey
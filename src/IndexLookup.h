@@ -63,10 +63,10 @@ class IndexLookup {
         RESULT_READY
     };
 
-    /// Struct for lookupIndexKeys RPC.
+    /// Struct for lookupIndexObjects RPC.
     struct LookupRpc {
-        /// The tub that contains RamCloud::LookupIndexKeysRpc.
-        Tub<LookupIndexKeysRpc> rpc;
+        /// The tub that contains RamCloud::LookupIndexObjectsRpc.
+        Tub<LookupIndexObjectsRpc> rpc;
 
         /// The status of rpc.
         RpcStatus status;
@@ -82,8 +82,21 @@ class IndexLookup {
         /// been copied to activeHashes.
         uint32_t offset;
 
+        /// Number of primary key hashes, starting with the first one in
+        /// resp, whose objects the index server returned along with the
+        /// hashes. Set to 0 once those objects have been handed to a
+        /// ReadRpc (or, if there are none, once the hashes are skipped).
+        uint32_t numHashesRead;
+
+        /// Number of objects the index server returned in resp.
+        uint32_t numObjects;
+
+        /// Offset of the first object in resp.
+        uint32_t objectsOffset;
+
         LookupRpc()
             : rpc(), status(FREE), resp(), numHashes(), offset()
+            , numHashesRead(), numObjects(), objectsOffset()
         {}
     };
 
@@ -136,7 +149,7 @@ class IndexLookup {
 
     /// Instance of a LookupRpc.
     /// We only keep a single LookupRpc at a time, since each
-    /// RamCloud::LookupIndexKeysRpc needs the return value  of the
+    /// RamCloud::LookupIndexObjectsRpc needs the return value  of the
     /// previous call to an rpc of the same type.
     LookupRpc lookupRpc;
 
@@ -173,8 +186,8 @@ class IndexLookup {
 
     //////////////////////////////////////////////////////////////////////////
     // The next four variables are used to handle the case where we have
-    // to issue multiple RamCloud::LookupIndexKeysRpc's, since indexes may span
-    // multiple servers.
+    // to issue multiple RamCloud::LookupIndexObjectsRpc's, since indexes may
+    // span multiple servers.
     //////////////////////////////////////////////////////////////////////////
 
     /// Maximum number of hashes that the server is allowed to return
@@ -182,14 +195,14 @@ class IndexLookup {
     static const uint32_t MAX_ALLOWED_HASHES = 1000;
 
     /// Key blob marking the start of the indexed key range for the next
-    /// RamCloud::LookupIndexKeysRpc.
+    /// RamCloud::LookupIndexObjectsRpc.
     void *nextKey;
 
     /// Length of nextKey in bytes.
     uint16_t nextKeyLength;
 
     /// Lowest allowed pKHash corresponding to nextKey, for which objects are
-    /// to be returned in the next RamCloud::LookupIndexKeysRpc.
+    /// to be returned in the next RamCloud::LookupIndexObjectsRpc.
     uint64_t nextKeyHash;
 
     //////////////////////////////////////////////////////////////////////////
@@ -267,8 +280,8 @@ class IndexLookup {
     uint8_t curIdx;
 
     /// True means that all of the relevant key hashes have been
-    /// received from index servers, so no more RamCloud::LookupIndexKeysRpc's
-    /// need to be issued.
+    /// received from index servers, so no more
+    /// RamCloud::LookupIndexObjectsRpc's need to be issued.
     bool finishedLookup;
 
     DISALLOW_COPY_AND_ASSIGN(IndexLookup);
@@ -145,6 +145,10 @@ TEST_F(IndexLookupTest, isReady_lookupComplete) {
     respBuffer->emplaceAppend<uint16_t>(uint16_t(nextKeyLen));
     // nextKeyHash
     respBuffer->emplaceAppend<uint64_t>(0);
+    // numHashesRead
+    respBuffer->emplaceAppend<uint32_t>(0);
+    // numObjects
+    respBuffer->emplaceAppend<uint32_t>(0);
     for (KeyHash i = 0; i < 10; i++) {
         respBuffer->emplaceAppend<KeyHash>(i);
     }
@@ -168,6 +172,8 @@ TEST_F(IndexLookupTest, isReady_activeHashes) {
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(10);
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint16_t>(uint16_t(0));
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint64_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
     for (KeyHash i = 0; i < 10; i++) {
         indexLookup.lookupRpc.rpc->response->emplaceAppend<KeyHash>(i);
     }
@@ -180,6 +186,102 @@ TEST_F(IndexLookupTest, isReady_activeHashes) {
     }
 }
 
+// Rule 2a:
+// Hand objects returned by the index server to a free readRpc.
+TEST_F(IndexLookupTest, isReady_objectsWithHashes) {
+    TestLog::Enable _;
+    IndexLookup indexLookup(ramcloud.get(), 10, azKeyRange);
+    Buffer* respBuffer = indexLookup.lookupRpc.rpc->response;
+    respBuffer->emplaceAppend<WireFormat::ResponseCommon>()->status = STATUS_OK;
+    respBuffer->emplaceAppend<uint32_t>(10);
+    respBuffer->emplaceAppend<uint16_t>(uint16_t(0));
+    respBuffer->emplaceAppend<uint64_t>(0);
+    respBuffer->emplaceAppend<uint32_t>(4);
+    respBuffer->emplaceAppend<uint32_t>(1);
+    for (KeyHash i = 0; i < 10; i++) {
+        respBuffer->emplaceAppend<KeyHash>(i);
+    }
+    respBuffer->emplaceAppend<uint64_t>(1);
+    respBuffer->emplaceAppend<uint32_t>(3);
+    respBuffer->appendCopy("abc", 3);
+    indexLookup.lookupRpc.rpc->completed();
+    indexLookup.isReady();
+
+    EXPECT_EQ(10U, indexLookup.numInserted);
+    EXPECT_EQ(IndexLookup::RESULT_READY, indexLookup.readRpcs[0].status);
+    EXPECT_EQ(4U, indexLookup.readRpcs[0].numHashes);
+    EXPECT_EQ(3U, indexLookup.readRpcs[0].maxPos);
+    EXPECT_EQ(1U, indexLookup.readRpcs[0].numUnreadObjects);
+    EXPECT_EQ(15U, indexLookup.readRpcs[0].resp.size());
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_EQ(0U, indexLookup.activeRpcIds[i]);
+    }
+    // The remaining hashes go to a readHashes RPC.
+    EXPECT_EQ(IndexLookup::SENT, indexLookup.readRpcs[1].status);
+    EXPECT_EQ(6U, indexLookup.readRpcs[1].numHashes);
+    EXPECT_EQ(0U, indexLookup.lookupRpc.numHashesRead);
+}
+
+TEST_F(IndexLookupTest, isReady_objectsWithHashes_noFreeReadRpc) {
+    TestLog::Enable _;
+    IndexLookup indexLookup(ramcloud.get(), 10, azKeyRange);
+    Buffer* respBuffer = indexLookup.lookupRpc.rpc->response;
+    respBuffer->emplaceAppend<WireFormat::ResponseCommon>()->status = STATUS_OK;
+    respBuffer->emplaceAppend<uint32_t>(10);
+    respBuffer->emplaceAppend<uint16_t>(uint16_t(0));
+    respBuffer->emplaceAppend<uint64_t>(0);
+    respBuffer->emplaceAppend<uint32_t>(4);
+    respBuffer->emplaceAppend<uint32_t>(1);
+    for (KeyHash i = 0; i < 10; i++) {
+        respBuffer->emplaceAppend<KeyHash>(i);
+    }
+    respBuffer->emplaceAppend<uint64_t>(1);
+    respBuffer->emplaceAppend<uint32_t>(3);
+    respBuffer->appendCopy("abc", 3);
+    indexLookup.lookupRpc.rpc->completed();
+    for (size_t i = 0; i < IndexLookup::NUM_READ_RPCS; i++) {
+        indexLookup.readRpcs[i].status = IndexLookup::RESULT_READY;
+    }
+    indexLookup.isReady();
+
+    // The objects are kept, and no PKHashes are read ahead of them.
+    EXPECT_EQ(4U, indexLookup.lookupRpc.numHashesRead);
+    EXPECT_EQ(10U, indexLookup.lookupRpc.numHashes);
+    EXPECT_EQ(0U, indexLookup.numInserted);
+
+    indexLookup.readRpcs[0].status = IndexLookup::FREE;
+    indexLookup.isReady();
+    EXPECT_EQ(0U, indexLookup.lookupRpc.numHashesRead);
+    EXPECT_EQ(10U, indexLookup.numInserted);
+    EXPECT_EQ(IndexLookup::RESULT_READY, indexLookup.readRpcs[0].status);
+    EXPECT_EQ(4U, indexLookup.readRpcs[0].numHashes);
+    EXPECT_EQ(1U, indexLookup.readRpcs[0].numUnreadObjects);
+}
+
+TEST_F(IndexLookupTest, isReady_objectsWithHashes_noObjects) {
+    TestLog::Enable _;
+    IndexLookup indexLookup(ramcloud.get(), 10, azKeyRange);
+    Buffer* respBuffer = indexLookup.lookupRpc.rpc->response;
+    respBuffer->emplaceAppend<WireFormat::ResponseCommon>()->status = STATUS_OK;
+    respBuffer->emplaceAppend<uint32_t>(10);
+    respBuffer->emplaceAppend<uint16_t>(uint16_t(0));
+    respBuffer->emplaceAppend<uint64_t>(0);
+    respBuffer->emplaceAppend<uint32_t>(4);
+    respBuffer->emplaceAppend<uint32_t>(0);
+    for (KeyHash i = 0; i < 10; i++) {
+        respBuffer->emplaceAppend<KeyHash>(i);
+    }
+    indexLookup.lookupRpc.rpc->completed();
+    indexLookup.isReady();
+
+    // The first 4 PKHashes have no objects, so they are never read.
+    EXPECT_EQ(0U, indexLookup.lookupRpc.numHashesRead);
+    EXPECT_EQ(6U, indexLookup.numInserted);
+    EXPECT_EQ(4U, indexLookup.activeHashes[0]);
+    EXPECT_EQ(IndexLookup::SENT, indexLookup.readRpcs[0].status);
+    EXPECT_EQ(6U, indexLookup.readRpcs[0].numHashes);
+}
+
 // Rule 3(a):
 // Issue next lookup RPC if an RESULT_READY lookupIndexKeys RPC
 // has no unread RPC
@@ -191,6 +293,8 @@ TEST_F(IndexLookupTest, isReady_issueNextLookup) {
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(10);
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint16_t>(uint16_t(1));
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint64_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
     for (KeyHash i = 0; i < 10; i++) {
         indexLookup.lookupRpc.rpc->response->emplaceAppend<KeyHash>(i);
     }
@@ -216,6 +320,8 @@ TEST_F(IndexLookupTest, isReady_allLookupCompleted) {
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(10);
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint16_t>(uint16_t(0));
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint64_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
     for (KeyHash i = 0; i < 10; i++) {
         indexLookup.lookupRpc.rpc->response->emplaceAppend<KeyHash>(i);
     }
@@ -236,6 +342,8 @@ TEST_F(IndexLookupTest, isReady_assignPKHashesToSameServer) {
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(10);
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint16_t>(uint16_t(0));
     indexLookup.lookupRpc.rpc->response->emplaceAppend<uint64_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
+    indexLookup.lookupRpc.rpc->response->emplaceAppend<uint32_t>(0);
     for (KeyHash i = 0; i < 10; i++) {
         indexLookup.lookupRpc.rpc->response->emplaceAppend<KeyHash>(i);
     }
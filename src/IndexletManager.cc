@@ -614,8 +614,6 @@ IndexletManager::lookupIndexKeys(
         WireFormat::LookupIndexKeys::Response* respHdr,
         Service::Rpc* rpc)
 {
-    Lock indexletMapLock(mutex);
-
     uint32_t reqOffset = sizeof32(*reqHdr);
     uint16_t firstKeyLength = reqHdr->firstKeyLength;
     uint16_t lastKeyLength = reqHdr->lastKeyLength;
@@ -632,80 +630,133 @@ IndexletManager::lookupIndexKeys(
         return;
     }
 
+    respHdr->common.status = lookupIndexKeys(reqHdr->tableId, reqHdr->indexId,
+            firstKey, firstKeyLength, reqHdr->firstAllowedKeyHash,
+            lastKey, lastKeyLength, reqHdr->maxNumHashes,
+            rpc->replyPayload, &respHdr->numHashes,
+            &respHdr->nextKeyLength, &respHdr->nextKeyHash);
+    if (respHdr->common.status != STATUS_OK)
+        rpc->sendReply();
+}
+
+/**
+ * Look up a range of keys in an index and append the primary key hashes
+ * of the matching entries, in index order, to a buffer. This does the
+ * work for both LOOKUP_INDEX_KEYS and LOOKUP_INDEX_OBJECTS.
+ *
+ * \param tableId
+ *      Id of the table the index belongs to.
+ * \param indexId
+ *      Id of the index to look up.
+ * \param firstKey
+ *      Smallest key in the range to be returned.
+ * \param firstKeyLength
+ *      Length of firstKey in bytes.
+ * \param firstAllowedKeyHash
+ *      Smallest primary key hash allowed for entries whose key is firstKey.
+ * \param lastKey
+ *      Largest key in the range to be returned.
+ * \param lastKeyLength
+ *      Length of lastKey in bytes.
+ * \param maxNumHashes
+ *      Maximum number of primary key hashes to return.
+ * \param[out] out
+ *      The primary key hashes are appended here, followed by the bytes of
+ *      the next key to look up (if any).
+ * \param[out] numHashes
+ *      Set to the number of primary key hashes appended to out.
+ * \param[out] nextKeyLength
+ *      Set to the length of the next key to look up, or 0 if the lookup
+ *      is complete.
+ * \param[out] nextKeyHash
+ *      Set to the smallest primary key hash allowed for the next key.
+ *
+ * \return
+ *      Returns STATUS_OK if the lookup succeeded, or STATUS_UNKNOWN_INDEXLET
+ *      if the server does not own an indexlet containing firstKey.
+ */
+Status
+IndexletManager::lookupIndexKeys(uint64_t tableId, uint8_t indexId,
+        const void* firstKey, uint16_t firstKeyLength,
+        uint64_t firstAllowedKeyHash,
+        const void* lastKey, uint16_t lastKeyLength,
+        uint32_t maxNumHashes, Buffer* out, uint32_t* numHashes,
+        uint16_t* nextKeyLength, uint64_t* nextKeyHash)
+{
+    Lock indexletMapLock(mutex);
+
     RAMCLOUD_LOG(DEBUG, "Looking up: tableId %lu, indexId %u.\n"
                         "first key: %s\n last  key: %s\n",
-                        reqHdr->tableId, reqHdr->indexId,
+                        tableId, indexId,
                         Util::hexDump(firstKey, firstKeyLength).c_str(),
                         Util::hexDump(lastKey, lastKeyLength).c_str());
 
     IndexletMap::iterator mapIter =
-            findIndexlet(reqHdr->tableId, reqHdr->indexId, firstKey,
+            findIndexlet(tableId, indexId, firstKey,
                     firstKeyLength, indexletMapLock);
-    if (mapIter == indexletMap.end()) {
-        respHdr->common.status = STATUS_UNKNOWN_INDEXLET;
-        rpc->sendReply();
-        return;
-    }
+    if (mapIter == indexletMap.end())
+        return STATUS_UNKNOWN_INDEXLET;
     Indexlet* indexlet = &mapIter->second;
 
-    Lock indexletLock(indexlet->indexletMutex);
     indexletMapLock.unlock();
 
-    // We want to use lower_bound() instead of find() because the firstKey
-    // may not correspond to a key in the indexlet.
-    auto iter = indexlet->bt->lower_bound(BtreeEntry {
-            firstKey, firstKeyLength, reqHdr->firstAllowedKeyHash});
-    auto iterEnd = indexlet->bt->end();
+    // Lookups don't take the indexlet's lock unless they keep colliding
+    // with modifications: the tree is read optimistically, and whatever was
+    // read is thrown away and read again if the tree changed in the
+    // meantime. This lets any number of lookups proceed in parallel with
+    // each other and with a writer.
+    IndexBtree* bt = indexlet->bt;
+    BtreeEntry firstEntry {firstKey, firstKeyLength, firstAllowedKeyHash};
+    uint32_t initialLength = out->size();
     bool rpcMaxedOut = false;
-
-    respHdr->numHashes = 0;
-
-    while (iter != iterEnd) {
-        BtreeEntry currEntry = *iter;
-        // If we have overshot the range to be returned (indicated by lastKey),
-        // then break. Otherwise continue appending entries to response rpc.
+    auto visit = [&](const BtreeEntry& currEntry) {
+        // If we have overshot the range to be returned (indicated by
+        // lastKey), then stop. Otherwise continue appending entries to
+        // the response.
         if (IndexKey::keyCompare(currEntry.key, currEntry.keyLength,
-                lastKey, lastKeyLength) > 0)
-        {
-            break;
+                lastKey, lastKeyLength) > 0) {
+            return false;
         }
 
-        if (respHdr->numHashes < reqHdr->maxNumHashes) {
-            // Can alternatively use iter.data() instead of iter.key().pKHash,
-            // but we might want to make data NULL in the future, so might
-            // as well use the pKHash from key right away.
-            rpc->replyPayload->emplaceAppend<uint64_t>(currEntry.pKHash);
-            respHdr->numHashes += 1;
-            ++iter;
-        } else {
-            rpcMaxedOut = true;
-            break;
+        if (*numHashes < maxNumHashes) {
+            out->emplaceAppend<uint64_t>(currEntry.pKHash);
+            *numHashes += 1;
+            return true;
         }
-    }
 
-    if (rpcMaxedOut) {
-
-        respHdr->nextKeyLength = uint16_t(iter->keyLength);
-        respHdr->nextKeyHash = iter->pKHash;
-        rpc->replyPayload->append(iter->key, uint32_t(iter->keyLength));
+        rpcMaxedOut = true;
+        *nextKeyLength = uint16_t(currEntry.keyLength);
+        *nextKeyHash = currEntry.pKHash;
+        out->appendCopy(currEntry.key, uint32_t(currEntry.keyLength));
+        return false;
+    };
+
+    Tub<Lock> indexletLock;
+    for (uint32_t attempt = 1; ; attempt++) {
+        if (attempt > MAX_OPTIMISTIC_LOOKUPS && !indexletLock)
+            indexletLock.construct(indexlet->indexletMutex);
+
+        *numHashes = 0;
+        *nextKeyHash = 0;
+        *nextKeyLength = 0;
+        rpcMaxedOut = false;
+        if (bt->scanOptimistic(firstEntry, bt->readBegin(), visit))
+            break;
+        out->truncate(initialLength);
+    }
 
-    } else if (IndexKey::keyCompare(
+    // If the response filled up, visit() has already filled in the key to
+    // resume from; otherwise resume at the next indexlet, if the range
+    // extends that far.
+    if (!rpcMaxedOut && IndexKey::keyCompare(
             lastKey, lastKeyLength,
             indexlet->firstNotOwnedKey, indexlet->firstNotOwnedKeyLength) > 0) {
-
-        respHdr->nextKeyLength = indexlet->firstNotOwnedKeyLength;
-        respHdr->nextKeyHash = 0;
-        rpc->replyPayload->append(indexlet->firstNotOwnedKey,
+        *nextKeyLength = indexlet->firstNotOwnedKeyLength;
+        out->append(indexlet->firstNotOwnedKey,
                 indexlet->firstNotOwnedKeyLength);
-
-    } else {
-
-        respHdr->nextKeyHash = 0;
-        respHdr->nextKeyLength = 0;
-
     }
 
-    respHdr->common.status = STATUS_OK;
+    return STATUS_OK;
 }
 
 /**
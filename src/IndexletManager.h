@@ -110,8 +110,9 @@ class IndexletManager {
         State state;
 
         /// Mutex to protect the indexlet from concurrent access.
-        /// A lock for this mutex MUST be held to read or modify any state in
-        /// the indexlet.
+        /// A lock for this mutex MUST be held to modify any state in the
+        /// indexlet. Lookups may read #bt without it, validating what they
+        /// read with IndexBtree::readBegin() and IndexBtree::readValidate().
         SpinLock indexletMutex;
     };
 
@@ -152,6 +153,12 @@ class IndexletManager {
     void lookupIndexKeys(const WireFormat::LookupIndexKeys::Request* reqHdr,
             WireFormat::LookupIndexKeys::Response* respHdr,
             Service::Rpc* rpc);
+    Status lookupIndexKeys(uint64_t tableId, uint8_t indexId,
+            const void* firstKey, uint16_t firstKeyLength,
+            uint64_t firstAllowedKeyHash,
+            const void* lastKey, uint16_t lastKeyLength,
+            uint32_t maxNumHashes, Buffer* out, uint32_t* numHashes,
+            uint16_t* nextKeyLength, uint64_t* nextKeyHash);
     Status removeEntry(uint64_t tableId, uint8_t indexId,
             const void* key, KeyLength keyLength,
             uint64_t pKHash);
@@ -217,6 +224,11 @@ class IndexletManager {
     /// Object Manager to handle mapping of index as objects
     ObjectManager* objectManager;
 
+    /// Number of times lookupIndexKeys() reads an indexlet's tree without
+    /// its lock before giving up and taking the lock, so that a steady
+    /// stream of writes can't starve a lookup.
+    static const uint32_t MAX_OPTIMISTIC_LOOKUPS = 8;
+
     /////////////////////////// Meta-data related functions //////////////////
 
     IndexletManager::IndexletMap::iterator findIndexlet(
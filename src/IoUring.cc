@@ -0,0 +1,362 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <errno.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define HAVE_IO_URING 1
+#endif
+#endif
+
+#include "IoUring.h"
+
+namespace RAMCloud {
+
+#if HAVE_IO_URING
+
+/**
+ * Create an io_uring.
+ *
+ * \param queueDepth
+ *      Maximum number of operations that may be outstanding (prepared but
+ *      not yet reaped) at once.
+ * \throw IoUringException
+ *      The kernel doesn't support io_uring or refused to create one.
+ */
+IoUring::IoUring(uint32_t queueDepth)
+    : ringFd(-1)
+    , queueDepth(queueDepth)
+    , numQueued(0)
+    , numInFlight(0)
+    , sqRing(MAP_FAILED)
+    , sqRingBytes(0)
+    , cqRing(MAP_FAILED)
+    , cqRingBytes(0)
+    , sqes(MAP_FAILED)
+    , sqesBytes(0)
+    , sqTail(NULL)
+    , sqMask(NULL)
+    , sqArray(NULL)
+    , cqHead(NULL)
+    , cqTail(NULL)
+    , cqMask(NULL)
+    , cqes(NULL)
+    , registeredBuffers()
+{
+    if (queueDepth == 0)
+        throw IoUringException(HERE, "io_uring queue depth must be positive");
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    ringFd = downCast<int>(syscall(__NR_io_uring_setup, queueDepth, &params));
+    if (ringFd < 0)
+        throw IoUringException(HERE, "io_uring_setup failed", errno);
+
+    // Map the rings shared with the kernel. Newer kernels let both rings
+    // come from a single mapping.
+    sqRingBytes = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cqRingBytes = params.cq_off.cqes +
+                  params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        sqRingBytes = std::max(sqRingBytes, cqRingBytes);
+        cqRingBytes = 0;
+    }
+    sqRing = mmap(NULL, sqRingBytes, PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+    if (sqRing == MAP_FAILED) {
+        int e = errno;
+        release();
+        throw IoUringException(HERE, "couldn't map io_uring queue", e);
+    }
+    if (cqRingBytes == 0) {
+        cqRing = sqRing;
+    } else {
+        cqRing = mmap(NULL, cqRingBytes, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+        if (cqRing == MAP_FAILED) {
+            int e = errno;
+            release();
+            throw IoUringException(HERE, "couldn't map io_uring queue", e);
+        }
+    }
+    sqesBytes = params.sq_entries * sizeof(struct io_uring_sqe);
+    sqes = mmap(NULL, sqesBytes, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+        int e = errno;
+        release();
+        throw IoUringException(HERE, "couldn't map io_uring queue", e);
+    }
+
+    char* sq = static_cast<char*>(sqRing);
+    sqTail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    sqMask = reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    sqArray = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    char* cq = static_cast<char*>(cqRing);
+    cqHead = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    cqTail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    cqMask = reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    cqes = cq + params.cq_off.cqes;
+
+    // The kernel may round the ring sizes up, but never down.
+    assert(params.sq_entries >= queueDepth);
+    assert(params.cq_entries >= queueDepth);
+}
+
+/**
+ * Tear down the ring. Any operations still in flight are left to finish in
+ * the kernel; the buffers they use must remain valid until they do.
+ */
+IoUring::~IoUring()
+{
+    release();
+}
+
+/**
+ * Unmap the queues and close the ring; used by the destructor and to clean
+ * up after a constructor failure.
+ */
+void
+IoUring::release()
+{
+    if (sqes != MAP_FAILED)
+        munmap(sqes, sqesBytes);
+    if (cqRing != MAP_FAILED && cqRing != sqRing)
+        munmap(cqRing, cqRingBytes);
+    if (sqRing != MAP_FAILED)
+        munmap(sqRing, sqRingBytes);
+    sqes = cqRing = sqRing = MAP_FAILED;
+    if (ringFd >= 0)
+        close(ringFd);
+    ringFd = -1;
+}
+
+/**
+ * Pin a set of buffers in the kernel so that operations on memory within
+ * them avoid the cost of pinning pages on every operation. This replaces any
+ * buffers registered before; it must only be called while no operations are
+ * outstanding.
+ *
+ * \param buffers
+ *      The buffers to register. May be empty to just unregister the old
+ *      buffers.
+ * \throw IoUringException
+ *      The kernel refused to register the buffers (for example because of
+ *      RLIMIT_MEMLOCK); no buffers are registered in that case.
+ */
+void
+IoUring::registerBuffers(const std::vector<struct iovec>& buffers)
+{
+    assert(getOutstanding() == 0);
+    if (!registeredBuffers.empty()) {
+        syscall(__NR_io_uring_register, ringFd, IORING_UNREGISTER_BUFFERS,
+                NULL, 0);
+        registeredBuffers.clear();
+    }
+    if (buffers.empty())
+        return;
+    long r = syscall(__NR_io_uring_register, ringFd, IORING_REGISTER_BUFFERS,
+                     &buffers[0], buffers.size());
+    if (r < 0)
+        throw IoUringException(HERE, "couldn't register io_uring buffers",
+                               errno);
+    registeredBuffers = buffers;
+}
+
+/**
+ * Queue a read. It isn't handed to the kernel until submit() or
+ * waitForCompletion() is called. There must be a free slot (see
+ * getFreeSlots()).
+ *
+ * \param fd
+ *      File to read from.
+ * \param buf
+ *      Where to store the data read. Must remain valid until the read's
+ *      completion is reaped.
+ * \param length
+ *      Number of bytes to read.
+ * \param offset
+ *      Offset in the file to start reading at.
+ * \param userData
+ *      Returned in the Completion for this read.
+ */
+void
+IoUring::prepareRead(int fd, void* buf, uint32_t length, uint64_t offset,
+                     uint64_t userData)
+{
+    prepare(IORING_OP_READ, IORING_OP_READ_FIXED, fd, buf, length, offset,
+            userData);
+}
+
+/**
+ * Queue a write. Identical to prepareRead() except that data is written to
+ * \a fd from \a buf.
+ */
+void
+IoUring::prepareWrite(int fd, const void* buf, uint32_t length,
+                      uint64_t offset, uint64_t userData)
+{
+    prepare(IORING_OP_WRITE, IORING_OP_WRITE_FIXED, fd, buf, length, offset,
+            userData);
+}
+
+/**
+ * Shared implementation of prepareRead() and prepareWrite(). Uses
+ * \a fixedOpcode if the memory lies within a registered buffer, and
+ * \a opcode otherwise.
+ */
+void
+IoUring::prepare(uint8_t opcode, uint8_t fixedOpcode, int fd, const void* buf,
+                 uint32_t length, uint64_t offset, uint64_t userData)
+{
+    if (getFreeSlots() == 0)
+        throw IoUringException(HERE, "io_uring is full");
+
+    uint32_t tail = *sqTail;
+    uint32_t index = tail & *sqMask;
+    struct io_uring_sqe* sqe = &static_cast<struct io_uring_sqe*>(sqes)[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(buf);
+    sqe->len = length;
+    sqe->off = offset;
+    sqe->user_data = userData;
+
+    const char* start = static_cast<const char*>(buf);
+    for (size_t i = 0; i < registeredBuffers.size(); i++) {
+        const char* base = static_cast<const char*>(
+                registeredBuffers[i].iov_base);
+        if (start >= base &&
+                start + length <= base + registeredBuffers[i].iov_len) {
+            sqe->opcode = fixedOpcode;
+            sqe->buf_index = downCast<uint16_t>(i);
+            break;
+        }
+    }
+
+    sqArray[index] = index;
+    __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+    numQueued++;
+}
+
+/**
+ * Hand all prepared operations to the kernel without waiting for any of
+ * them to finish.
+ */
+void
+IoUring::submit()
+{
+    if (numQueued > 0)
+        enter(numQueued, 0, 0);
+}
+
+/**
+ * Return the outcome of one operation, submitting any prepared operations
+ * first and blocking until one finishes if none has yet. Operations complete
+ * in no particular order.
+ *
+ * \throw IoUringException
+ *      There are no outstanding operations to wait for.
+ */
+IoUring::Completion
+IoUring::waitForCompletion()
+{
+    if (getOutstanding() == 0)
+        throw IoUringException(HERE, "no io_uring operations to wait for");
+
+    while (true) {
+        uint32_t head = *cqHead;
+        if (head != __atomic_load_n(cqTail, __ATOMIC_ACQUIRE)) {
+            struct io_uring_cqe* cqe =
+                &static_cast<struct io_uring_cqe*>(cqes)[head & *cqMask];
+            Completion completion{cqe->user_data, cqe->res};
+            __atomic_store_n(cqHead, head + 1, __ATOMIC_RELEASE);
+            numInFlight--;
+            return completion;
+        }
+        enter(numQueued, 1, IORING_ENTER_GETEVENTS);
+    }
+}
+
+/**
+ * Wrapper around the io_uring_enter system call that retries after signals
+ * and keeps #numQueued and #numInFlight up to date.
+ *
+ * \return
+ *      The number of operations submitted.
+ * \throw IoUringException
+ *      The kernel rejected the call.
+ */
+int
+IoUring::enter(uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    while (true) {
+        long r = syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete,
+                         flags, NULL, 0);
+        if (r >= 0) {
+            uint32_t submitted = downCast<uint32_t>(r);
+            numQueued -= submitted;
+            numInFlight += submitted;
+            return downCast<int>(r);
+        }
+        if (errno != EINTR)
+            throw IoUringException(HERE, "io_uring_enter failed", errno);
+    }
+}
+
+#else // HAVE_IO_URING
+
+IoUring::IoUring(uint32_t queueDepth)
+    : ringFd(-1)
+    , queueDepth(queueDepth)
+    , numQueued(0)
+    , numInFlight(0)
+    , sqRing(NULL)
+    , sqRingBytes(0)
+    , cqRing(NULL)
+    , cqRingBytes(0)
+    , sqes(NULL)
+    , sqesBytes(0)
+    , sqTail(NULL)
+    , sqMask(NULL)
+    , sqArray(NULL)
+    , cqHead(NULL)
+    , cqTail(NULL)
+    , cqMask(NULL)
+    , cqes(NULL)
+    , registeredBuffers()
+{
+    throw IoUringException(HERE, "io_uring was not available at compile-time");
+}
+
+IoUring::~IoUring() {}
+void IoUring::release() {}
+void IoUring::registerBuffers(const std::vector<struct iovec>& buffers) {}
+void IoUring::prepareRead(int fd, void* buf, uint32_t length, uint64_t offset,
+                          uint64_t userData) {}
+void IoUring::prepareWrite(int fd, const void* buf, uint32_t length,
+                           uint64_t offset, uint64_t userData) {}
+void IoUring::submit() {}
+IoUring::Completion IoUring::waitForCompletion() { return {0, -ENOSYS}; }
+
+#endif // HAVE_IO_URING
+
+} // namespace RAMCloud
@@ -0,0 +1,162 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_IOURING_H
+#define RAMCLOUD_IOURING_H
+
+#include <sys/uio.h>
+
+#include "Common.h"
+
+namespace RAMCloud {
+
+/**
+ * Thrown if an io_uring can't be created or used, for example because the
+ * kernel doesn't support it.
+ */
+struct IoUringException : public Exception {
+    IoUringException(const CodeLocation& where, std::string msg)
+        : Exception(where, msg) {}
+    IoUringException(const CodeLocation& where, string msg, int errNo)
+        : Exception(where, msg, errNo) {}
+};
+
+/**
+ * A minimal wrapper around a Linux io_uring: a pair of queues shared with
+ * the kernel through which many reads and writes can be issued and reaped
+ * with a single system call each way. Unlike POSIX AIO (which glibc
+ * emulates with a handful of helper threads) this keeps as many operations
+ * outstanding on a device as the caller wants, which is what NVMe devices
+ * need to reach full bandwidth.
+ *
+ * Users queue operations with prepareRead() and prepareWrite(), each tagged
+ * with an opaque value, then call waitForCompletion() repeatedly to learn
+ * how each one turned out. Buffers passed to registerBuffers() are pinned
+ * by the kernel once, rather than on every operation that uses them.
+ *
+ * This class is not thread-safe; each instance should be used by a single
+ * thread at a time. This talks to the kernel directly rather than through
+ * liburing, so it has no dependencies beyond the kernel headers.
+ */
+class IoUring {
+  public:
+    /// Describes the outcome of one operation; see waitForCompletion().
+    struct Completion {
+        /// The value passed to prepareRead() or prepareWrite().
+        uint64_t userData;
+
+        /// Number of bytes transferred, or a negated errno value.
+        int32_t result;
+    };
+
+    explicit IoUring(uint32_t queueDepth);
+    ~IoUring();
+
+    void registerBuffers(const std::vector<struct iovec>& buffers);
+    void prepareRead(int fd, void* buf, uint32_t length, uint64_t offset,
+                     uint64_t userData);
+    void prepareWrite(int fd, const void* buf, uint32_t length,
+                      uint64_t offset, uint64_t userData);
+    void submit();
+    Completion waitForCompletion();
+
+    /**
+     * Return the number of operations that may be prepared before some
+     * must be reaped with waitForCompletion().
+     */
+    uint32_t
+    getFreeSlots() const
+    {
+        return queueDepth - numQueued - numInFlight;
+    }
+
+    /// Return the maximum number of operations outstanding at once.
+    uint32_t
+    getQueueDepth() const
+    {
+        return queueDepth;
+    }
+
+    /// Return the number of operations prepared but not yet reaped.
+    uint32_t
+    getOutstanding() const
+    {
+        return numQueued + numInFlight;
+    }
+
+    /// Return the number of buffers registered with registerBuffers().
+    size_t
+    getNumRegisteredBuffers() const
+    {
+        return registeredBuffers.size();
+    }
+
+  PRIVATE:
+    void prepare(uint8_t opcode, uint8_t fixedOpcode, int fd, const void* buf,
+                 uint32_t length, uint64_t offset, uint64_t userData);
+    int enter(uint32_t toSubmit, uint32_t minComplete, uint32_t flags);
+    void release();
+
+    /// File descriptor returned by io_uring_setup.
+    int ringFd;
+
+    /// Maximum number of operations prepared or in flight at once.
+    const uint32_t queueDepth;
+
+    /// Operations prepared but not yet handed to the kernel.
+    uint32_t numQueued;
+
+    /// Operations handed to the kernel but not yet reaped.
+    uint32_t numInFlight;
+
+    /// Mapping of the submission queue ring (indexes of entries to submit).
+    void* sqRing;
+
+    /// Size in bytes of the #sqRing mapping.
+    size_t sqRingBytes;
+
+    /// Mapping of the completion queue ring. Same as #sqRing if the kernel
+    /// maps both rings together.
+    void* cqRing;
+
+    /// Size in bytes of the #cqRing mapping.
+    size_t cqRingBytes;
+
+    /// Mapping of the array of submission queue entries.
+    void* sqes;
+
+    /// Size in bytes of the #sqes mapping.
+    size_t sqesBytes;
+
+    /// Pointers into #sqRing; see the io_uring_setup man page.
+    uint32_t* sqTail;
+    uint32_t* sqMask;
+    uint32_t* sqArray;
+
+    /// Pointers into #cqRing; see the io_uring_setup man page.
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t* cqMask;
+    void* cqes;
+
+    /// The buffers most recently passed to registerBuffers(), in order.
+    std::vector<struct iovec> registeredBuffers;
+
+    DISALLOW_COPY_AND_ASSIGN(IoUring);
+};
+
+} // namespace RAMCloud
+
+#endif  // RAMCLOUD_IOURING_H
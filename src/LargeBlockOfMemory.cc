@@ -13,7 +13,12 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <sched.h>
+#include <thread>
+
+#include "Cycles.h"
 #include "LargeBlockOfMemory.h"
+#include "Util.h"
 
 namespace RAMCloud {
 
@@ -40,6 +45,128 @@ namespace LargeBlockOfMemoryInternal {
 #else
     uint64_t nextProbeBase = (uint64_t)1 << 30;
 #endif
+
+/**
+ * Set the NUMA memory policy of a newly mapped block according to the
+ * caller's wishes. This should be done before the block is touched, so that
+ * pages are allocated in the right place rather than migrated there later.
+ *
+ * \param block
+ *      Start of the block.
+ * \param length
+ *      Size of the block in bytes.
+ * \param pageSize
+ *      Size of the pages backing the block. Per-node ranges are made a
+ *      multiple of this.
+ * \param placement
+ *      How the block's pages should be spread across nodes.
+ * \param[out] bytesPerNode
+ *      Set to the size of each node's range if the block was split (see
+ *      NumaPlacement::SPLIT), otherwise to length.
+ * \return
+ *      The number of nodes the block was split across, or 1 if it wasn't
+ *      (because of the placement requested, because this isn't a NUMA
+ *      machine, or because the kernel refused).
+ */
+int
+placeOnNumaNodes(void* block, size_t length, size_t pageSize,
+                 NumaPlacement placement, size_t* bytesPerNode)
+{
+    *bytesPerNode = length;
+    int nodes = Util::getNumaNodeCount();
+    if (placement == NumaPlacement::DEFAULT || nodes <= 1)
+        return 1;
+
+    if (placement == NumaPlacement::INTERLEAVE) {
+        if (Util::interleaveMemoryAcrossNumaNodes(block, length, nodes)) {
+            RAMCLOUD_LOG(NOTICE, "Interleaved %lu-byte block across %d NUMA "
+                         "nodes", length, nodes);
+        }
+        return 1;
+    }
+
+    size_t perNode = length / nodes / pageSize * pageSize;
+    if (perNode == 0)
+        return 1;
+    uint8_t* base = static_cast<uint8_t*>(block);
+    for (int node = 0; node < nodes; node++) {
+        size_t offset = node * perNode;
+        size_t bytes = (node == nodes - 1) ? length - offset : perNode;
+        if (!Util::bindMemoryToNumaNode(base + offset, bytes, node)) {
+            RAMCLOUD_LOG(WARNING, "Could not place memory on NUMA node %d; "
+                         "leaving placement to the kernel", node);
+            return 1;
+        }
+    }
+    *bytesPerNode = perNode;
+    RAMCLOUD_LOG(NOTICE, "Split %lu-byte block across %d NUMA nodes "
+                 "(%lu MB each)", length, nodes, perNode >> 20);
+    return nodes;
 }
 
+/**
+ * Touch every page of a block of memory so that the kernel allocates (and
+ * zeroes) them all now rather than on first use. The work is divided among
+ * up to one thread per core; if the block was split across NUMA nodes, each
+ * thread runs on the node whose memory it touches.
+ *
+ * \param block
+ *      Start of the block.
+ * \param length
+ *      Size of the block in bytes.
+ * \param pageSize
+ *      Size of the pages backing the block; one byte is written per page.
+ * \param numaNodes
+ *      Number of nodes the block was split across; see placeOnNumaNodes().
+ * \param bytesPerNode
+ *      Size of each node's range; see placeOnNumaNodes().
+ */
+void
+prefault(void* block, size_t length, size_t pageSize, int numaNodes,
+         size_t bytesPerNode)
+{
+    // Don't bother starting threads for less than this much memory each;
+    // it's cheaper to do it ourselves.
+    const size_t minBytesPerThread = 256 * 1024 * 1024;
+
+    size_t pages = (length + pageSize - 1) / pageSize;
+    size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, length / minBytesPerThread);
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < length; i += pageSize)
+            static_cast<volatile uint8_t*>(block)[i] = 0;
+        return;
+    }
+
+    RAMCLOUD_LOG(NOTICE, "Populating %lu MB of pages with %lu threads",
+                 length >> 20, numThreads);
+    uint64_t start = Cycles::rdtsc();
+    size_t pagesPerThread = (pages + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < numThreads; t++) {
+        size_t first = t * pagesPerThread * pageSize;
+        size_t last = std::min(length, first + pagesPerThread * pageSize);
+        if (first >= last)
+            break;
+        int node = -1;
+        if (numaNodes > 1) {
+            node = downCast<int>(std::min(first / bytesPerNode,
+                    static_cast<size_t>(numaNodes - 1)));
+        }
+        threads.emplace_back([block, first, last, pageSize, node] {
+            cpu_set_t cpus;
+            if (node >= 0 && Util::getNumaNodeCpus(node, &cpus))
+                sched_setaffinity(0, sizeof(cpus), &cpus);
+            for (size_t i = first; i < last; i += pageSize)
+                static_cast<volatile uint8_t*>(block)[i] = 0;
+        });
+    }
+    foreach (std::thread& thread, threads)
+        thread.join();
+    RAMCLOUD_LOG(NOTICE, "Populated %lu MB of pages in %.1f seconds",
+                 length >> 20, Cycles::toSeconds(Cycles::rdtsc() - start));
+}
+
+} // namespace LargeBlockOfMemoryInternal
+
 }
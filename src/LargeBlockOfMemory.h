@@ -31,6 +31,23 @@
 
 namespace RAMCloud {
 
+/**
+ * Specifies how the pages of a #LargeBlockOfMemory are spread across the
+ * NUMA nodes of the machine. Has no effect on machines with a single node.
+ */
+enum class NumaPlacement {
+    /// Leave placement to the kernel (normally each page goes on the node of
+    /// the core that first touches it).
+    DEFAULT,
+
+    /// Spread pages round-robin across all nodes.
+    INTERLEAVE,
+
+    /// Split the block into one contiguous range per node, in node order.
+    /// See LargeBlockOfMemory::numaNodes and #bytesPerNumaNode.
+    SPLIT
+};
+
 /**
  * We'd like to share class state across all instances of all templated
  * versions of #LargeBlockOfMemory. However, due to templating, using
@@ -40,6 +57,10 @@ namespace RAMCloud {
  */
 namespace LargeBlockOfMemoryInternal {
     extern uint64_t nextProbeBase;
+    int placeOnNumaNodes(void* block, size_t length, size_t pageSize,
+                         NumaPlacement placement, size_t* bytesPerNode);
+    void prefault(void* block, size_t length, size_t pageSize,
+                  int numaNodes, size_t bytesPerNode);
 }
 
 /**
@@ -56,19 +77,48 @@ struct LargeBlockOfMemory {
      * \param length
      *      The number of bytes of memory to allocate.
      * \param hugepage
-     *      True if we are allowed to use hugepage memory.
+     *      True if we are allowed to use hugepage memory. 1GB pages are used
+     *      if the kernel has enough of them reserved, otherwise 2MB pages,
+     *      otherwise regular pages.
+     * \param placement
+     *      How to spread the memory across NUMA nodes.
      * \throw FatalError
      *      If the memory could not be allocated.
      */
-    explicit LargeBlockOfMemory(size_t length, bool hugepage = false)
+    explicit LargeBlockOfMemory(size_t length, bool hugepage = false,
+                                NumaPlacement placement =
+                                    NumaPlacement::DEFAULT)
         : length(length)
         , block()
+        , pageSize(sysconf(_SC_PAGESIZE))
+        , numaNodes(1)
+        , bytesPerNumaNode(length)
     {
-        int flags = MAP_ANONYMOUS;
-        if (hugepage) {
-            flags |= MAP_HUGETLB;
+        block = static_cast<T*>(MAP_FAILED);
+        if (hugepage && length != 0) {
+            // Larger pages mean fewer TLB misses (a 1GB page covers as much
+            // as 512 2MB pages), so use the largest size that fits.
+            const size_t sizes[] = { GIGABYTE, 2 * 1024 * 1024 };
+            const int flags[] = { 30 << HUGEPAGE_SIZE_SHIFT,
+                                  21 << HUGEPAGE_SIZE_SHIFT };
+            for (int i = 0; i < 2 && block == MAP_FAILED; i++) {
+                if (length % sizes[i] != 0)
+                    continue;
+                block = static_cast<T*>(mmapGigabyteAligned(length,
+                        MAP_ANONYMOUS | MAP_HUGETLB | flags[i]));
+                if (block != MAP_FAILED)
+                    pageSize = sizes[i];
+            }
+            if (block == MAP_FAILED) {
+                RAMCLOUD_LOG(WARNING, "Couldn't allocate %lu bytes from "
+                             "hugepages; using regular pages", length);
+            } else {
+                RAMCLOUD_LOG(NOTICE, "Allocated %lu bytes from %lu MB "
+                             "hugepages", length, pageSize >> 20);
+            }
         }
-        block = static_cast<T*>(mmapGigabyteAligned(length, flags));
+        if (block == MAP_FAILED)
+            block = static_cast<T*>(mmapGigabyteAligned(length, MAP_ANONYMOUS));
         if (block == MAP_FAILED) {
             if (length == 0)
                 return;
@@ -76,6 +126,35 @@ struct LargeBlockOfMemory {
                              format("Could not allocate %lu bytes", length),
                              errno);
         }
+
+        // Set the placement before anything touches the memory, so that
+        // pages are allocated on the right node to begin with.
+        numaNodes = LargeBlockOfMemoryInternal::placeOnNumaNodes(block,
+                length, pageSize, placement, &bytesPerNumaNode);
+
+        // Do not pin and fault in pages if we're testing, since that just
+        // slows things down considerably (we usually don't touch anywhere
+        // near all of the memory we allocate).
+#if !TESTING
+        // Force the OS to populate backing pages.  MAP_POPULATE doesn't seem
+        // to do the trick and using it makes polling mmap for aligned base
+        // addresses much slower. Faulting in (and zeroing) hundreds of
+        // gigabytes one page at a time takes minutes, so it's done by many
+        // threads at once.
+        LargeBlockOfMemoryInternal::prefault(block, length, pageSize,
+                                             numaNodes, bytesPerNumaNode);
+
+#ifdef MLOCK_PAGES
+        // Pin the pages. Don't do this with the mmap() MAP_LOCKED flag since
+        // that slows down probing considerably (Linux might be locking down
+        // pages before it knows that it can actually give us the entire
+        // range?).
+        if (mlock(block, length)) {
+            munmap(block, length);
+            throw FatalError(HERE, "Couldn't pin down the memory!", errno);
+        }
+#endif
+#endif // !TESTING
     }
 
     /**
@@ -94,7 +173,10 @@ struct LargeBlockOfMemory {
      */
     LargeBlockOfMemory(string filePath, size_t length)
         : length(length),
-          block(NULL)
+          block(NULL),
+          pageSize(sysconf(_SC_PAGESIZE)),
+          numaNodes(1),
+          bytesPerNumaNode(length)
     {
         const char* path = filePath.c_str();
 
@@ -137,9 +219,8 @@ struct LargeBlockOfMemory {
                      length, path, reinterpret_cast<void*>(block));
 
         // Fault in each mapping.
-        uint64_t pageSize = sysconf(_SC_PAGESIZE);
-        for (uint64_t i = 0; i < length; i += pageSize)
-            reinterpret_cast<uint8_t*>(block)[i] = 0;
+        LargeBlockOfMemoryInternal::prefault(block, length, pageSize,
+                                             numaNodes, bytesPerNumaNode);
     }
 
     ~LargeBlockOfMemory()
@@ -152,6 +233,9 @@ struct LargeBlockOfMemory {
     void swap(LargeBlockOfMemory<T>& other) {
         std::swap(this->length, other.length);
         std::swap(this->block, other.block);
+        std::swap(this->pageSize, other.pageSize);
+        std::swap(this->numaNodes, other.numaNodes);
+        std::swap(this->bytesPerNumaNode, other.bytesPerNumaNode);
     }
 
     /// Returns #block.
@@ -173,11 +257,29 @@ struct LargeBlockOfMemory {
      */
     T* block;
 
+    /// Size of the pages backing #block: larger than the system's base page
+    /// size if hugepages were used.
+    size_t pageSize;
+
+    /// Number of NUMA nodes #block was split across with NumaPlacement::SPLIT,
+    /// or 1 if it wasn't split (in which case nothing is known about where
+    /// any particular page lives).
+    int numaNodes;
+
+    /// Number of bytes of #block on each NUMA node when #numaNodes > 1: node
+    /// i holds bytes [i * bytesPerNumaNode, (i + 1) * bytesPerNumaNode),
+    /// except that the last node also holds any remainder. Equal to #length
+    /// otherwise.
+    size_t bytesPerNumaNode;
+
   private:
+    /// The value of MAP_HUGE_SHIFT from <linux/mman.h>: mmap(2) flags
+    /// select a hugepage size by shifting log2(size) left this many bits.
+    static const int HUGEPAGE_SIZE_SHIFT = 26;
+
     /**
      * Mmap the desired amount of space with gigabyte alignment (lower 30
-     * bits of the address are 0). Also, ensure that all mappings are faulted
-     * in by touching each page. This is used to give the log memory that's
+     * bits of the address are 0). This is used to give the log memory that's
      * well-aligned, which makes things like computing base addresses of
      * Segments from random pointers really easy if Segments are aligned as
      * well (to a power-of-two less than or equal to 1GB).
@@ -210,11 +312,14 @@ struct LargeBlockOfMemory {
             if (base == reinterpret_cast<void*>(tryBase))
                 break;
 
-            if (base != MAP_FAILED) {
-                if (munmap(base, length)) {
-                    RAMCLOUD_LOG(ERROR, "couldn't munmap undesirable mapping!");
-                    return MAP_FAILED;
-                }
+            // The address we ask for is only a hint, so a failure means the
+            // mapping can't be made anywhere (e.g., no hugepages left).
+            if (base == MAP_FAILED)
+                return MAP_FAILED;
+
+            if (munmap(base, length)) {
+                RAMCLOUD_LOG(ERROR, "couldn't munmap undesirable mapping!");
+                return MAP_FAILED;
             }
 
             tryBase += GIGABYTE;
@@ -227,35 +332,6 @@ struct LargeBlockOfMemory {
 
         void* block = reinterpret_cast<void*>(tryBase);
 
-        // Do not pin and fault in pages if we're testing, since that just
-        // slows things down considerably (we usually don't touch anywhere near
-        // all of the memory we allocate).
-#if !TESTING
-#ifdef MLOCK_PAGES
-        // Pin the pages. Don't do this with the mmap() MAP_LOCKED flag since
-        // that slows down probing considerably (Linux might be locking down
-        // pages before it knows that it can actually give us the entire
-        // range?).
-        if (mlock(block, length)) {
-            munmap(block, length);
-            RAMCLOUD_LOG(ERROR, "Couldn't pin down the memory!");
-            return MAP_FAILED;
-        }
-#endif
-
-        // Force the OS to populate backing pages.  MAP_POPULATE doesn't seem
-        // to do the trick and using it makes polling mmap for aligned base
-        // addresses much slower.
-        uint64_t pageSize = sysconf(_SC_PAGESIZE);
-        for (uint64_t i = 0; i < length; i += pageSize) {
-            reinterpret_cast<uint8_t*>(block)[i] = 0;
-            if (!(i & ((1 << 30) - 1))) {
-                RAMCLOUD_LOG(NOTICE, "Populating pages; progress %lu of %lu MB",
-                             i / (1 << 20), length / (1 << 20));
-            }
-        }
-#endif // !TESTING
-
         // Cache last mapped address to avoid re-probing same addresses later.
         LargeBlockOfMemoryInternal::nextProbeBase =
             (tryBase + length + GIGABYTE - 1) & ~(GIGABYTE - 1);
@@ -124,6 +124,7 @@ Log::getMetrics(ProtoBuf::LogMetrics& m)
 LogPosition
 Log::getHead() {
     SpinLock::Guard _(appendLock);
+    waitForPendingCopies(head);
     return LogPosition(head->id, head->getAppendedLength());
 }
 
@@ -195,6 +196,7 @@ Log::sync()
     if (appendedLength > originalHead->syncedLength) {
         // Get the latest segment length and certificate. This allows us to
         // batch up other appends that came in while we were waiting.
+        waitForPendingCopies(originalHead);
         SegmentCertificate certificate;
         appendedLength = originalHead->getAppendedLength(&certificate);
 
@@ -258,6 +260,7 @@ Log::syncTo(Log::Reference reference)
         // If segment != head, segment must have been closed and its replication
         // is queued already. Forcing sync of head segment will also make sure
         // that the closed segment is fully replicated.
+        waitForPendingCopies(head);
         uint32_t appendedLength = head->getAppendedLength(&certificate);
 
         // Drop the append lock. We don't want to block other appending
@@ -299,6 +302,8 @@ Log::rollHeadOver()
     // for SideLog::commit(), which rolls the head over to inject a SideLog
     // into the main log (by adding segments to a new log digest and syncing
     // that to disk). See RAM-489.
+    if (head != NULL)
+        waitForPendingCopies(head);
     head = allocNextSegment(true);
     SegmentCertificate certificate;
     uint32_t appendedLength = head->getAppendedLength(&certificate);
@@ -63,10 +63,11 @@ class ServerConfig;
  * replicated. If the data must be made durable before continuing, code must
  * explicitly invoke the sync() method to flush all previous appends to backups.
  *
- * This class is thread-safe. Multiple threads may invoke append() in parallel,
- * but all appends are serialized by a single SpinLock. The sync() method will
- * batch multiple append operations to backups to improve throughput, especially
- * when individual entries are small.
+ * This class is thread-safe. Multiple threads may invoke append() in parallel.
+ * Space in the head segment is reserved under a single SpinLock, but entry
+ * contents are copied in by the appending threads concurrently. The sync()
+ * method will batch multiple append operations to backups to improve
+ * throughput, especially when individual entries are small.
  */
 class Log : public AbstractLog {
   public:
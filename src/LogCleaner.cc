@@ -25,6 +25,7 @@
 #include "Segment.h"
 #include "SegmentIterator.h"
 #include "ServerConfig.h"
+#include "Util.h"
 #include "WallTime.h"
 
 namespace RAMCloud {
@@ -61,6 +62,8 @@ LogCleaner::LogCleaner(Context* context,
       writeCostThreshold(config->master.cleanerWriteCostThreshold),
       disableInMemoryCleaning(config->master.disableInMemoryCleaning),
       numThreads(config->master.cleanerThreadCount),
+      numaNodes(config->master.disableNumaAwareCleaning ? 1 :
+                segmentManager.getAllocator().getNumaNodeCount()),
       segletSize(config->segletSize),
       segmentSize(config->segmentSize),
       activeThreads(0),
@@ -72,6 +75,7 @@ LogCleaner::LogCleaner(Context* context,
       inMemoryMetrics(),
       onDiskMetrics(),
       threadMetrics(numThreads),
+      numaNodeMetrics(numaNodes),
       threadsShouldExit(false),
       threads(),
       balancer(NULL)
@@ -180,6 +184,10 @@ LogCleaner::getMetrics(ProtoBuf::LogMetrics_CleanerMetrics& m)
     inMemoryMetrics.serialize(*m.mutable_in_memory_metrics());
     onDiskMetrics.serialize(*m.mutable_on_disk_metrics());
     threadMetrics.serialize(*m.mutable_thread_metrics());
+    for (int i = 0; i < numaNodes; i++) {
+        numaNodeMetrics[i].serialize(*m.add_numa_node_metrics(),
+                                     downCast<uint32_t>(i));
+    }
 }
 
 /******************************************************************************
@@ -192,6 +200,10 @@ static volatile uint32_t threadCnt;
  * Static entry point for the cleaner thread. This is invoked via the
  * std::thread() constructor. This thread performs continuous cleaning on an
  * as-needed basis.
+ *
+ * On NUMA machines threads are assigned to nodes round-robin and pinned to
+ * their node's cores, so that the segments they compact and the survivors
+ * they write are (mostly) in local memory.
  */
 void
 LogCleaner::cleanerThreadEntry(LogCleaner* logCleaner, Context* context)
@@ -201,6 +213,16 @@ LogCleaner::cleanerThreadEntry(LogCleaner* logCleaner, Context* context)
 
     CleanerThreadState state;
     state.threadNumber = __sync_fetch_and_add(&threadCnt, 1);
+    state.numaNode = state.threadNumber % logCleaner->numaNodes;
+    logCleaner->numaNodeMetrics[state.numaNode].threads++;
+    if (logCleaner->numaNodes > 1) {
+        cpu_set_t cpus;
+        if (!Util::getNumaNodeCpus(state.numaNode, &cpus) ||
+                sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+            LOG(WARNING, "Couldn't pin cleaner thread %u to NUMA node %d",
+                state.threadNumber, state.numaNode);
+        }
+    }
     try {
         while (1) {
             Fence::lfence();
@@ -213,6 +235,8 @@ LogCleaner::cleanerThreadEntry(LogCleaner* logCleaner, Context* context)
         DIE("Fatal error in cleaner thread: %s", e.what());
     }
 
+    logCleaner->numaNodeMetrics[state.numaNode].threads--;
+
     LOG(NOTICE, "LogCleaner thread stopping");
 }
 
@@ -255,14 +279,14 @@ LogCleaner::doWork(CleanerThreadState* state)
         case Balancer::CLEAN_DISK:
           {
             CycleCounter<uint64_t> __(&state->diskCleaningTicks);
-            doDiskCleaning();
+            doDiskCleaning(state->numaNode);
             break;
           }
 
         case Balancer::COMPACT_MEMORY:
           {
             CycleCounter<uint64_t> __(&state->memoryCompactionTicks);
-            doMemoryCleaning();
+            doMemoryCleaning(state->numaNode);
             break;
           }
 
@@ -298,9 +322,13 @@ LogCleaner::doWork(CleanerThreadState* state)
  * Perform an in-memory cleaning pass. This takes a segment and compacts it,
  * re-packing all live entries together sequentially, allowing us to reclaim
  * some of the dead space.
+ *
+ * \param numaNode
+ *      NUMA node the calling thread runs on. A segment on this node is
+ *      compacted, if a good one exists, into a survivor on the same node.
  */
 void
-LogCleaner::doMemoryCleaning()
+LogCleaner::doMemoryCleaning(int numaNode)
 {
     TEST_LOG("called");
     AtomicCycleCounter _(&inMemoryMetrics.totalTicks);
@@ -309,7 +337,9 @@ LogCleaner::doMemoryCleaning()
     if (disableInMemoryCleaning)
         return;
 
-    LogSegment* segment = getSegmentToCompact();
+    // Only express a preference if memory is actually split across nodes.
+    int preferredNode = (numaNodes > 1) ? numaNode : -1;
+    LogSegment* segment = getSegmentToCompact(preferredNode);
     if (segment == NULL)
         return;
 
@@ -325,7 +355,7 @@ LogCleaner::doMemoryCleaning()
     CycleCounter<uint64_t> waitTicks(&localMetrics.waitForFreeSurvivorTicks);
     LogSegment* survivor = segmentManager.allocSideSegment(
             SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL,
-            segment);
+            segment, preferredNode);
     assert(survivor != NULL);
     waitTicks.stop();
 
@@ -407,6 +437,17 @@ LogCleaner::doMemoryCleaning()
     PerfStats::threadStats.compactorActiveCycles +=
             Cycles::rdtsc() - startTicks;
 
+    LogCleanerMetrics::NumaNode& nodeMetrics = numaNodeMetrics[numaNode];
+    nodeMetrics.totalTicks += Cycles::rdtsc() - startTicks;
+    nodeMetrics.totalInputBytes += localMetrics.totalBytesInCompactedSegments;
+    nodeMetrics.totalBytesFreed += bytesFreed;
+    nodeMetrics.totalSurvivorBytes +=
+            localMetrics.totalBytesAppendedToSurvivors;
+    if (segment->numaNode != numaNode)
+        nodeMetrics.totalRemoteSegments++;
+    if (survivor->numaNode != numaNode)
+        nodeMetrics.totalRemoteSurvivors++;
+
     AtomicCycleCounter __(&inMemoryMetrics.compactionCompleteTicks);
     segmentManager.compactionComplete(segment, survivor);
 }
@@ -415,9 +456,13 @@ LogCleaner::doMemoryCleaning()
  * Perform a disk cleaning pass if possible. Doing so involves choosing segments
  * to clean, extracting entries from those segments, writing them out into new
  * "survivor" segments, and alerting the segment manager upon completion.
+ *
+ * \param numaNode
+ *      NUMA node the calling thread runs on. Survivor segments are allocated
+ *      on this node if possible.
  */
 void
-LogCleaner::doDiskCleaning()
+LogCleaner::doDiskCleaning(int numaNode)
 {
     TEST_LOG("called");
     AtomicCycleCounter _(&onDiskMetrics.totalTicks);
@@ -456,7 +501,7 @@ LogCleaner::doDiskCleaning()
     // cache line ping-ponging in the hot path.
     LogSegmentVector survivors;
     uint64_t entryBytesAppended = relocateLiveEntries(entries, survivors,
-            &localMetrics);
+            (numaNodes > 1) ? numaNode : -1, &localMetrics);
 
     uint32_t segmentsAfter = downCast<uint32_t>(survivors.size());
     uint32_t segletsAfter = 0;
@@ -504,6 +549,21 @@ LogCleaner::doDiskCleaning()
     PerfStats::threadStats.cleanerActiveCycles +=
             Cycles::rdtsc() - startTicks;
 
+    LogCleanerMetrics::NumaNode& nodeMetrics = numaNodeMetrics[numaNode];
+    nodeMetrics.totalTicks += Cycles::rdtsc() - startTicks;
+    nodeMetrics.totalInputBytes +=
+            localMetrics.totalMemoryBytesInCleanedSegments;
+    nodeMetrics.totalBytesFreed += memoryBytesFreed;
+    nodeMetrics.totalSurvivorBytes += entryBytesAppended;
+    foreach (LogSegment* segment, segmentsToClean) {
+        if (segment->numaNode != numaNode)
+            nodeMetrics.totalRemoteSegments++;
+    }
+    foreach (LogSegment* segment, survivors) {
+        if (segment->numaNode != numaNode)
+            nodeMetrics.totalRemoteSurvivors++;
+    }
+
     AtomicCycleCounter __(&onDiskMetrics.cleaningCompleteTicks);
     segmentManager.cleaningComplete(segmentsToClean, survivors);
 
@@ -516,12 +576,16 @@ LogCleaner::doDiskCleaning()
  * number of freeable seglets that will keep the segment under our maximum
  * cleanable utilization after compaction. This ensures that we will always be
  * able to use the compacted version of this segment during disk cleaning.
+ *
+ * \param numaNode
+ *      If non-negative, prefer a segment on this NUMA node; see
+ *      CleanableSegmentManager::getSegmentToCompact().
  */
 LogSegment*
-LogCleaner::getSegmentToCompact()
+LogCleaner::getSegmentToCompact(int numaNode)
 {
     AtomicCycleCounter _(&inMemoryMetrics.getSegmentToCompactTicks);
-    return cleanableSegments.getSegmentToCompact();
+    return cleanableSegments.getSegmentToCompact(numaNode);
 }
 
 /**
@@ -617,6 +681,9 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
  * \param outSurvivors
  *      The new survivor segments created to hold the relocated live data are
  *      returned here.
+ * \param numaNode
+ *      NUMA node to prefer when allocating survivor segments, or -1 for
+ *      no preference.
  * \param[out] localMetrics
  *      Contains various performance counters that are incremented here.
  * \return
@@ -628,6 +695,7 @@ LogCleaner::getSortedEntries(LogSegmentVector& segmentsToClean,
 uint64_t
 LogCleaner::relocateLiveEntries(EntryVector& entries,
                             LogSegmentVector& outSurvivors,
+                            int numaNode,
                             LogCleanerMetrics::OnDisk<uint64_t>* localMetrics)
 {
     CycleCounter<uint64_t> _(&localMetrics->relocateLiveEntriesTicks);
@@ -669,7 +737,7 @@ LogCleaner::relocateLiveEntries(EntryVector& entries,
                 &localMetrics->waitForFreeSurvivorsTicks);
             survivor = segmentManager.allocSideSegment(
                 SegmentManager::FOR_CLEANING | SegmentManager::MUST_NOT_FAIL,
-                NULL);
+                NULL, numaNode);
             assert(survivor != NULL);
             waitTicks.stop();
             outSurvivors.push_back(survivor);
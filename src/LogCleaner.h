@@ -166,11 +166,14 @@ class LogCleaner {
       public:
         CleanerThreadState()
             : threadNumber(0)
+            , numaNode(0)
             , diskCleaningTicks(0)
             , memoryCompactionTicks(0)
         {
         }
         uint32_t threadNumber;
+        /// NUMA node this thread is pinned to and prefers to clean.
+        int numaNode;
         uint64_t diskCleaningTicks;
         uint64_t memoryCompactionTicks;
     };
@@ -226,9 +229,9 @@ class LogCleaner {
     bool checkIfCleaningNeeded(CleanerThreadState* thread);
     bool checkIfDiskCleaningNeeded(CleanerThreadState* thread);
     void doWork(CleanerThreadState* state);
-    void doMemoryCleaning();
-    void doDiskCleaning();
-    LogSegment* getSegmentToCompact();
+    void doMemoryCleaning(int numaNode = 0);
+    void doDiskCleaning(int numaNode = 0);
+    LogSegment* getSegmentToCompact(int numaNode = -1);
     void sortSegmentsByCostBenefit(LogSegmentVector& segments);
     void debugDumpSegments(LogSegmentVector& segments);
     void getSegmentsToClean(LogSegmentVector& outSegmentsToClean);
@@ -238,6 +241,7 @@ class LogCleaner {
                           LogCleanerMetrics::OnDisk<uint64_t>* localMetrics);
     uint64_t relocateLiveEntries(EntryVector& entries,
                             LogSegmentVector& outSurvivors,
+                            int numaNode,
                             LogCleanerMetrics::OnDisk<uint64_t>* localMetrics);
     void closeSurvivor(LogSegment* survivor);
     void waitForAvailableSurvivors(size_t count, uint64_t& outTicks);
@@ -369,6 +373,12 @@ class LogCleaner {
     /// keep up with higher write rates and memory utilizations.
     const int numThreads;
 
+    /// Number of NUMA nodes the log's memory is spread across (see
+    /// SegletAllocator::getNumaNodeCount()). Cleaner threads are spread
+    /// round-robin over the nodes and each prefers to clean its own node's
+    /// segments into survivors on that node.
+    const int numaNodes;
+
     /// Size of each seglet in bytes. Used to calculate the best segment for in-
     /// memory cleaning.
     uint32_t segletSize;
@@ -418,6 +428,9 @@ class LogCleaner {
     /// Metrics kept for measuring how many threads the cleaner is using.
     LogCleanerMetrics::Threads threadMetrics;
 
+    /// Metrics kept for each NUMA node's cleaner threads; indexed by node.
+    vector<LogCleanerMetrics::NumaNode> numaNodeMetrics;
+
     /// Set by halt() to indicate that the cleaning thread(s) should exit.
     bool threadsShouldExit;
 
@@ -619,6 +619,78 @@ class Threads {
     Tub<CycleCounter<uint64_t>> cycleCounter;
 };
 
+/**
+ * Metrics for the cleaning work done on behalf of one NUMA node: that is, by
+ * the cleaner threads pinned to the node. Both in-memory and on-disk cleaning
+ * are counted. The "remote" counters measure how often a thread had to work
+ * on memory from some other node; if they're large, the nodes' memory isn't
+ * being cleaned evenly.
+ */
+class NumaNode {
+  public:
+    /**
+     * Construct a new NumaNode metrics object with all counters zeroed.
+     */
+    NumaNode()
+        : threads(0),
+          totalTicks(0),
+          totalInputBytes(0),
+          totalBytesFreed(0),
+          totalSurvivorBytes(0),
+          totalRemoteSegments(0),
+          totalRemoteSurvivors(0)
+    {
+    }
+
+    /**
+     * Serialize the metrics in this class to the given protocol buffer so we
+     * can ship it to another machine.
+     *
+     * \param[out] m
+     *      The protocol buffer to fill in.
+     * \param node
+     *      The NUMA node these metrics describe.
+     */
+    void
+    serialize(ProtoBuf::LogMetrics_CleanerMetrics_NumaNodeMetrics& m,
+              uint32_t node)
+    {
+        m.set_node(node);
+        m.set_threads(threads);
+        m.set_total_ticks(totalTicks);
+        m.set_total_input_bytes(totalInputBytes);
+        m.set_total_bytes_freed(totalBytesFreed);
+        m.set_total_survivor_bytes(totalSurvivorBytes);
+        m.set_total_remote_segments(totalRemoteSegments);
+        m.set_total_remote_survivors(totalRemoteSurvivors);
+    }
+
+    /// Number of cleaner threads pinned to this node.
+    std::atomic<uint32_t> threads;
+
+    /// Number of cycles this node's threads have spent compacting and
+    /// cleaning.
+    Atomic64BitType totalTicks;
+
+    /// Number of bytes in the segments this node's threads compacted or
+    /// cleaned.
+    Atomic64BitType totalInputBytes;
+
+    /// Number of bytes of memory freed by this node's threads.
+    Atomic64BitType totalBytesFreed;
+
+    /// Number of bytes this node's threads appended to survivor segments.
+    Atomic64BitType totalSurvivorBytes;
+
+    /// Number of segments this node's threads compacted or cleaned whose
+    /// memory was on another node.
+    Atomic64BitType totalRemoteSegments;
+
+    /// Number of survivor segments this node's threads wrote to whose memory
+    /// was on another node.
+    Atomic64BitType totalRemoteSurvivors;
+};
+
 } // namespace LogCleanerMetrics
 
 } // namespace RAMCloud
@@ -78,15 +78,21 @@ LogIterator::next()
         // That means that all of the relevant entries are now present
         // in the log. Record the current log head position: it will
         // define the end of the iteration.
-        lastSegment = log.head;
         SegmentCertificate dummy;
-        lastSegmentLength = lastSegment->getAppendedLength(&dummy);
+        uint32_t currentSegmentLength;
+        {
+            SpinLock::Guard _(log.appendLock);
+            log.waitForPendingCopies(log.head);
+            lastSegment = log.head;
+            lastSegmentLength = lastSegment->getAppendedLength(&dummy);
+            currentSegmentLength =
+                    segmentList.back()->getAppendedLength(&dummy);
+        }
 
         // The current segment (which was the head at the time of the last
         // call to this method) may have grown between then and now, so
         // reset the length of currentIterator.
-        currentIterator->setLimit(
-                segmentList.back()->getAppendedLength(&dummy));
+        currentIterator->setLimit(currentSegmentLength);
     }
 
     // First, see if there are more entries in the current segment
@@ -129,6 +135,13 @@ LogIterator::next()
     currentSegmentId = nextSegment->id;
     if (nextSegment == lastSegment) {
         currentIterator->setLimit(lastSegmentLength);
+    } else if (headReached) {
+        // Appends may still be copying their contents into the head; don't
+        // iterate over entries that aren't complete yet.
+        SegmentCertificate dummy;
+        SpinLock::Guard _(log.appendLock);
+        log.waitForPendingCopies(nextSegment);
+        currentIterator->setLimit(nextSegment->getAppendedLength(&dummy));
     }
 }
 
@@ -170,6 +170,21 @@ LogMetricsStringer::getGenericCleanerMetrics()
             i++, d(ticks) / d(totalTicks) * 100);
     }
 
+    if (cleanerMetrics.numa_node_metrics_size() > 1) {
+        s += ls + format("  NUMA Nodes:\n");
+        foreach (const ProtoBuf::LogMetrics_CleanerMetrics_NumaNodeMetrics& n,
+                 cleanerMetrics.numa_node_metrics()) {
+            double seconds = Cycles::toSeconds(n.total_ticks(), serverHz);
+            s += ls + format("    Node %u (%u threads):          "
+                "%.2f MB/s in, %.2f MB/s freed, %lu remote segments, "
+                "%lu remote survivors\n",
+                n.node(), n.threads(),
+                d(n.total_input_bytes()) / seconds / 1024 / 1024,
+                d(n.total_bytes_freed()) / seconds / 1024 / 1024,
+                n.total_remote_segments(), n.total_remote_survivors());
+        }
+    }
+
     return s;
 }
 
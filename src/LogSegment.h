@@ -84,6 +84,7 @@ class LogSegment : public Segment {
           segmentSize(segmentSize),
           creationTimestamp(creationTimestamp),
           isEmergencyHead(isEmergencyHead),
+          numaNode(0),
           cleanedEpoch(0),
           cachedCleaningCostBenefitScore(0),
           cachedCompactionCostBenefitScore(0),
@@ -95,6 +96,7 @@ class LogSegment : public Segment {
           cleanableCompactionEntries(),
           tombstoneScanEntries(),
           syncedLength(0),
+          pendingCopies(0),
           lastCompactionTimestamp(WallTime::secondsTimestamp()),
           lastTombstoneScanTimestamp(WallTime::secondsTimestamp()),
           entryCounts(),
@@ -247,6 +249,11 @@ class LogSegment : public Segment {
     /// that is expected to live longer.
     const bool isEmergencyHead;
 
+    /// NUMA node this segment's memory was placed on (that of its first
+    /// seglet; see SegletAllocator::getNumaNode()). Used by the cleaner to
+    /// prefer compacting segments local to each cleaner thread.
+    int numaNode;
+
     /// The epoch value when cleaning was completed on this segment. Once no
     /// more RPCs in the system exist with epochs less than or equal to this,
     /// there can be no more outstanding references into the segment and its
@@ -304,6 +311,14 @@ class LogSegment : public Segment {
     /// appending to the log.
     std::atomic<uint32_t> syncedLength;
 
+    /// Number of entries whose space has been reserved in this segment by
+    /// AbstractLog but whose contents are still being copied in by the
+    /// appending threads (which do so after dropping the append lock). The
+    /// segment must not be replicated, iterated, or closed past its reserved
+    /// entries until this drops to zero; see
+    /// AbstractLog::waitForPendingCopies().
+    std::atomic<uint32_t> pendingCopies;
+
     /// Timestamp when this segment was last compacted or created. Used by the
     /// cleaner to decide when to scan for dead tombstones. Sometimes segments
     /// will accumulate tombstones and appear cold even though many of the
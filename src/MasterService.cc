@@ -13,6 +13,11 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -30,6 +35,7 @@
 #include "ObjectBuffer.h"
 #include "PerfCounter.h"
 #include "ProtoBuf.h"
+#include "RamCloud.h"
 #include "RawMetrics.h"
 #include "Segment.h"
 #include "ServerRpcPool.h"
@@ -99,6 +105,7 @@ MasterService::MasterService(Context* context, const ServerConfig* config)
                          objectManager.getLog(),
                          &unackedRpcResults,
                          &tabletManager)
+    , witnessManager(context, &serverId, config->master.numWitnesses)
     , disableCount(0)
     , initCalled(false)
     , logEverSynced(false)
@@ -162,6 +169,10 @@ MasterService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::GetServerStatistics, MasterService,
                         &MasterService::getServerStatistics>(rpc);
             break;
+        case WireFormat::GetWitnesses::opcode:
+            callHandler<WireFormat::GetWitnesses, MasterService,
+                        &MasterService::getWitnesses>(rpc);
+            break;
         case WireFormat::FillWithTestData::opcode:
             callHandler<WireFormat::FillWithTestData, MasterService,
                         &MasterService::fillWithTestData>(rpc);
@@ -182,6 +193,10 @@ MasterService::dispatch(WireFormat::Opcode opcode, Rpc* rpc)
             callHandler<WireFormat::LookupIndexKeys, MasterService,
                         &MasterService::lookupIndexKeys>(rpc);
             break;
+        case WireFormat::LookupIndexObjects::opcode:
+            callHandler<WireFormat::LookupIndexObjects, MasterService,
+                        &MasterService::lookupIndexObjects>(rpc);
+            break;
         case WireFormat::MigrateTablet::opcode:
             callHandler<WireFormat::MigrateTablet, MasterService,
                         &MasterService::migrateTablet>(rpc);
@@ -430,8 +445,12 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
     uint64_t actualTabletStartHash = tablet.startKeyHash;
     uint64_t actualTabletEndHash = tablet.endKeyHash;
 
+    EnumerationFilter filter;
+    uint32_t filterBytes = filter.parseFromRequest(reqHdr,
+            rpc->requestPayload, downCast<uint32_t>(sizeof(*reqHdr)));
     EnumerationIterator iter(*rpc->requestPayload,
-            downCast<uint32_t>(sizeof(*reqHdr)), reqHdr->iteratorBytes);
+            downCast<uint32_t>(sizeof(*reqHdr)) + filterBytes,
+            reqHdr->iteratorBytes);
 
     // Put at most maxPayloadBytes of enumerated objects in the reply. This
     // limit is used to leave enough room in the reply buffer for the response
@@ -445,7 +464,8 @@ MasterService::enumerate(const WireFormat::Enumerate::Request* reqHdr,
             &respHdr->tabletFirstHash, iter,
             *objectManager.getLog(),
             *objectManager.getObjectMap(),
-            *rpc->replyPayload, maxPayloadBytes);
+            *rpc->replyPayload, maxPayloadBytes,
+            objectManager.getTabletMembership(), &filter);
     enumeration.complete();
     respHdr->payloadBytes = rpc->replyPayload->size()
             - downCast<uint32_t>(sizeof(*respHdr));
@@ -497,11 +517,36 @@ MasterService::getServerStatistics(
 {
     ProtoBuf::ServerStatistics serverStats;
     tabletManager.getStatistics(&serverStats);
+    for (int i = 0; i < serverStats.tabletentry_size(); i++) {
+        ProtoBuf::ServerStatistics_TabletEntry* entry =
+                serverStats.mutable_tabletentry(i);
+        uint64_t byteCount = TableStats::estimateByteCount(
+                &masterTableMetadata, entry->table_id(),
+                entry->start_key_hash(), entry->end_key_hash());
+        if (byteCount > 0)
+            entry->set_byte_count(byteCount);
+    }
     SpinLock::getStatistics(serverStats.mutable_spin_lock_stats());
+    objectManager.getObjectMap()->getStatistics(
+            serverStats.mutable_hash_table_stats());
     respHdr->serverStatsLength = serializeToResponse(
             rpc->replyPayload, &serverStats);
 }
 
+/**
+ * Top-level server method to handle the GET_WITNESSES request.
+ * \copydetails Service::ping
+ */
+void
+MasterService::getWitnesses(
+        const WireFormat::GetWitnesses::Request* reqHdr,
+        WireFormat::GetWitnesses::Response* respHdr,
+        Rpc* rpc)
+{
+    respHdr->masterId = serverId.getId();
+    respHdr->numWitnesses = witnessManager.getWitnesses(rpc->replyPayload);
+}
+
 /**
  * Fill a master server with the given number of objects, each of the
  * same given size. Objects are added to all tables in the master in
@@ -808,6 +853,147 @@ MasterService::readHashes(
             rpc->replyPayload, &respHdr->numHashes, &respHdr->numObjects);
 }
 
+/**
+ * Helper for lookupIndexObjects: append to a response the objects for a
+ * list of primary key hashes, in the order of the hashes. Objects stored
+ * here are read directly; runs of hashes whose objects are stored on other
+ * masters are forwarded to those masters with READ_HASHES requests, which
+ * are all issued before any results are collected so that their latencies
+ * overlap. This stops at the first hash whose objects can't be returned
+ * (for example because its tablet is moving, or because the response is
+ * full); the caller's client reads the rest itself.
+ *
+ * \param tableId
+ *      Id of the table containing the objects.
+ * \param numHashes
+ *      Number of primary key hashes in pKHashes.
+ * \param pKHashes
+ *      Buffer containing the primary key hashes.
+ * \param pKHashesOffset
+ *      Offset of the first primary key hash in pKHashes.
+ * \param[out] response
+ *      The objects are appended here, in the format of a READ_HASHES
+ *      response.
+ * \param[out] numHashesRead
+ *      Set to the number of hashes, starting with the first, for which all
+ *      matching objects were appended to response.
+ * \param[out] numObjects
+ *      Set to the number of objects appended to response.
+ */
+void
+MasterService::readIndexedObjects(uint64_t tableId, uint32_t numHashes,
+        Buffer* pKHashes, uint32_t pKHashesOffset, Buffer* response,
+        uint32_t* numHashesRead, uint32_t* numObjects)
+{
+    *numHashesRead = 0;
+    *numObjects = 0;
+
+    // A run of consecutive hashes whose objects are all stored on the same
+    // master.
+    struct Run {
+        Run()
+            : first(0), count(0), local(false), session(), hashes()
+            , readResponse(), rpc()
+        {}
+        uint32_t first;
+        uint32_t count;
+        bool local;
+        Transport::SessionRef session;
+        Buffer hashes;
+        Buffer readResponse;
+        Tub<ReadHashesRpc> rpc;
+        DISALLOW_COPY_AND_ASSIGN(Run);
+    };
+    Run runs[MAX_INDEXED_READ_RUNS];
+    uint32_t numRuns = 0;
+
+    for (uint32_t i = 0; i < numHashes; i++) {
+        KeyHash pKHash = *pKHashes->getOffset<KeyHash>(
+                pKHashesOffset + i * sizeof32(KeyHash));
+        bool local = tabletManager.getTablet(tableId, pKHash);
+        Transport::SessionRef session;
+        if (!local) {
+            try {
+                session = context->objectFinder->tryLookup(tableId, pKHash);
+            } catch (const ClientException& e) {
+                // The table is gone; the client will find out on its own.
+            }
+            if (!session)
+                break;
+        }
+        if (numRuns > 0) {
+            Run& last = runs[numRuns - 1];
+            if (last.local == local && last.session == session) {
+                last.count++;
+                continue;
+            }
+        }
+        if (numRuns == MAX_INDEXED_READ_RUNS)
+            break;
+        Run& run = runs[numRuns++];
+        run.first = i;
+        run.count = 1;
+        run.local = local;
+        run.session = session;
+    }
+
+    for (uint32_t r = 0; r < numRuns; r++) {
+        Run& run = runs[r];
+        if (run.local)
+            continue;
+        run.hashes.append(pKHashes,
+                pKHashesOffset + run.first * sizeof32(KeyHash),
+                run.count * sizeof32(KeyHash));
+        run.rpc.construct(context, tableId, run.count, &run.hashes,
+                &run.readResponse);
+    }
+
+    // Outstanding RPCs for runs that aren't used are canceled when runs
+    // is destroyed.
+    for (uint32_t r = 0; r < numRuns; r++) {
+        Run& run = runs[r];
+        uint32_t initialLength = response->size();
+        if (initialLength >= maxResponseRpcLen)
+            break;
+        uint32_t maxLength = maxResponseRpcLen - initialLength;
+        uint32_t runHashesRead = 0;
+        uint32_t runObjects = 0;
+        if (run.local) {
+            try {
+                objectManager.readHashes(tableId, run.count, pKHashes,
+                        pKHashesOffset + run.first * sizeof32(KeyHash),
+                        maxLength, response, &runHashesRead, &runObjects);
+            } catch (const RetryException& e) {
+                response->truncate(initialLength);
+                break;
+            }
+            // readHashes always returns the objects for the first hash.
+            if (response->size() - initialLength > maxLength) {
+                response->truncate(initialLength);
+                break;
+            }
+        } else {
+            try {
+                runHashesRead = run.rpc->wait(&runObjects);
+            } catch (const ClientException& e) {
+                break;
+            }
+            uint32_t offset = sizeof32(WireFormat::ReadHashes::Response);
+            uint32_t length = run.readResponse.size() - offset;
+            if (length > maxLength)
+                break;
+            if (length > 0) {
+                response->appendCopy(run.readResponse.getRange(offset, length),
+                        length);
+            }
+        }
+        *numHashesRead += runHashesRead;
+        *numObjects += runObjects;
+        if (runHashesRead < run.count)
+            break;
+    }
+}
+
 /**
  * Perform once-only initialization for the master service after having
  * enlisted the process with the coordinator.
@@ -893,21 +1079,77 @@ MasterService::lookupIndexKeys(
     indexletManager.lookupIndexKeys(reqHdr, respHdr, rpc);
 }
 
+/**
+ * Top-level server method to handle the LOOKUP_INDEX_OBJECTS request. This
+ * does the work of LOOKUP_INDEX_KEYS and then also returns the objects for
+ * as many of the matching primary key hashes as it can, so that clients
+ * don't need separate READ_HASHES requests in the common case.
+ *
+ * \copydetails Service::ping
+ */
+void
+MasterService::lookupIndexObjects(
+        const WireFormat::LookupIndexObjects::Request* reqHdr,
+        WireFormat::LookupIndexObjects::Response* respHdr,
+        Rpc* rpc)
+{
+    uint32_t reqOffset = sizeof32(*reqHdr);
+    uint16_t firstKeyLength = reqHdr->firstKeyLength;
+    uint16_t lastKeyLength = reqHdr->lastKeyLength;
+    const void* firstKey =
+            rpc->requestPayload->getRange(reqOffset, firstKeyLength);
+    reqOffset += firstKeyLength;
+    const void* lastKey =
+            rpc->requestPayload->getRange(reqOffset, lastKeyLength);
+
+    if ((firstKey == NULL && firstKeyLength > 0) ||
+            (lastKey == NULL && lastKeyLength > 0)) {
+        respHdr->common.status = STATUS_REQUEST_FORMAT_ERROR;
+        return;
+    }
+
+    uint32_t hashesOffset = rpc->replyPayload->size();
+    uint32_t numHashes = 0;
+    uint16_t nextKeyLength = 0;
+    uint64_t nextKeyHash = 0;
+    respHdr->common.status = indexletManager.lookupIndexKeys(
+            reqHdr->tableId, reqHdr->indexId,
+            firstKey, firstKeyLength, reqHdr->firstAllowedKeyHash,
+            lastKey, lastKeyLength, reqHdr->maxNumHashes,
+            rpc->replyPayload, &numHashes, &nextKeyLength, &nextKeyHash);
+    if (respHdr->common.status != STATUS_OK)
+        return;
+    respHdr->numHashes = numHashes;
+    respHdr->nextKeyLength = nextKeyLength;
+    respHdr->nextKeyHash = nextKeyHash;
+
+    uint32_t numHashesRead = 0;
+    uint32_t numObjects = 0;
+    readIndexedObjects(reqHdr->tableId, numHashes, rpc->replyPayload,
+            hashesOffset, rpc->replyPayload, &numHashesRead, &numObjects);
+    respHdr->numHashesRead = numHashesRead;
+    respHdr->numObjects = numObjects;
+}
+
 /**
  * Helper function to avoid code duplication in migrateTablet which copies a log
  * entry to a segment for migration if it is a live log entry.
  *
- * If the segment is full, it will send the segment to the target of the
- * migration, destroy the segment, and create a new one.
+ * The entry goes to the stream responsible for its key hash. If that
+ * stream's segment is full, it will send the segment to the target of the
+ * migration and start a new one.
  *
  * If there is an error, this method will set the status code of the response
  * to the client to be an error.
  *
  * \param it
  *      The iterator that points at the object we are attempting to migrate.
- * \param[out] transferSeg
- *      Segment object that we append objects to, and possibly send when it gets
- *      full.
+ * \param[in,out] streams
+ *      The streams the migration is divided into; the tablet's key hash
+ *      range is split evenly between them. The entry is appended to the
+ *      segment of the one covering its key hash.
+ * \param numStreams
+ *      Number of entries in \a streams.
  * \param[out] entryTotals
  *      Array indexed by type of the total number of log entries copied into
  *      segments for transfer thus far, which we increment whenever we append an
@@ -934,7 +1176,8 @@ MasterService::lookupIndexKeys(
 Status
 MasterService::migrateSingleLogEntry(
         SegmentIterator& it,
-        Tub<Segment>& transferSeg,
+        MigrationStream streams[],
+        uint32_t numStreams,
         uint64_t entryTotals[],
         uint64_t& totalBytes,
         uint64_t tableId,
@@ -1039,26 +1282,33 @@ MasterService::migrateSingleLogEntry(
     totalBytes += buffer.size();
     PerfStats::threadStats.migrationPhase1Bytes += buffer.size();
 
-    if (!transferSeg)
-        transferSeg.construct();
+    // The width can't be computed for a single stream covering the whole
+    // key hash space: it would overflow.
+    uint32_t streamIndex = 0;
+    if (numStreams > 1) {
+        uint64_t streamWidth = (lastKeyHash - firstKeyHash) / numStreams + 1;
+        streamIndex = downCast<uint32_t>(std::min<uint64_t>(
+                (entryKeyHash - firstKeyHash) / streamWidth, numStreams - 1));
+    }
+    MigrationStream* stream = &streams[streamIndex];
+    CycleCounter<> streamCycles;
+    if (streamIndex < PerfStats::MAX_MIGRATION_STREAMS) {
+        PerfStats::threadStats.migrationStreamBytes[streamIndex] +=
+                buffer.size();
+    }
+
+    if (!stream->transferSeg)
+        stream->transferSeg.reset(new Segment());
 
 #if !MIGRATION_SKIP_APPEND
     // If we can't fit it, send the current buffer and retry.
-    if (!transferSeg->append(type, buffer)) {
-        transferSeg->close();
+    if (!stream->transferSeg->append(type, buffer)) {
         LOG(DEBUG, "Sending migration segment");
-        if (expect_true(receiver != ServerId{})) {
-#if !MIGRATION_SKIP_TX
-            MasterClient::receiveMigrationData(context, receiver,
-                    transferSeg.get(), tableId, firstKeyHash);
-#endif
-        }
-
-        transferSeg.destroy();
-        transferSeg.construct();
+        sendMigrationSegment(stream, tableId, firstKeyHash, receiver);
+        stream->transferSeg.reset(new Segment());
 
         // If it doesn't fit this time, we're in trouble.
-        if (!transferSeg->append(type, buffer)) {
+        if (!stream->transferSeg->append(type, buffer)) {
             LOG(ERROR, "Tablet migration failed: could not fit object "
                     "into empty segment (obj bytes %u)",
                     buffer.size());
@@ -1066,12 +1316,67 @@ MasterService::migrateSingleLogEntry(
         }
     }
 #endif
+    if (streamIndex < PerfStats::MAX_MIGRATION_STREAMS) {
+        PerfStats::threadStats.migrationStreamCycles[streamIndex] +=
+                streamCycles.stop();
+    }
 
     TEST_LOG("Migrated log entry type %s",
             LogEntryTypeHelpers::toString(type));
     return STATUS_OK;
 }
 
+/**
+ * Close the segment a migration stream has been filling and start sending
+ * it to the new owner of the tablet. The previous segment sent by the
+ * stream, if any, is waited for first, so that each stream's segments are
+ * replayed in order; other streams aren't affected.
+ *
+ * \param stream
+ *      The stream whose transferSeg is to be sent. On return its
+ *      transferSeg is empty.
+ * \param tableId
+ *      ID of the table from which objects are being migrated.
+ * \param firstKeyHash
+ *      Lowest key hash of the tablet being migrated; used by the receiver
+ *      to find the tablet.
+ * \param receiver
+ *      ServerId of the master that is receiving the migration data. If
+ *      invalid, the segment is discarded instead of sent.
+ */
+void
+MasterService::sendMigrationSegment(MigrationStream* stream,
+        uint64_t tableId, uint64_t firstKeyHash, ServerId receiver)
+{
+    waitForMigrationSegment(stream);
+    stream->transferSeg->close();
+    stream->sentSeg = std::move(stream->transferSeg);
+    if (expect_true(receiver != ServerId{})) {
+#if !MIGRATION_SKIP_TX
+        stream->rpc.construct(context, receiver, stream->sentSeg.get(),
+                tableId, firstKeyHash, false, 0lu, uint8_t(0),
+                static_cast<const void*>(NULL), uint16_t(0));
+#endif
+    }
+}
+
+/**
+ * Wait for the new owner of a tablet to finish replaying the last segment
+ * sent by a migration stream, then discard the segment.
+ *
+ * \param stream
+ *      The stream whose outstanding segment (if any) is to be waited for.
+ */
+void
+MasterService::waitForMigrationSegment(MigrationStream* stream)
+{
+    if (stream->rpc) {
+        stream->rpc->wait();
+        stream->rpc.destroy();
+    }
+    stream->sentSeg.reset();
+}
+
 /**
  * Top-level server method to handle the MIGRATE_TABLET request.
  *
@@ -1130,8 +1435,15 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
         context->serverList->toString(receiver).c_str());
 
     // We'll send over objects in Segment containers for better network
-    // efficiency and convenience.
-    Tub<Segment> transferSeg;
+    // efficiency and convenience. The tablet is divided into several
+    // streams, each with its own segments, so that the new owner can
+    // replay several segments at once instead of one at a time.
+    uint32_t numStreams = std::min(
+            std::max(config->master.migrationStreams, 1u),
+            PerfStats::MAX_MIGRATION_STREAMS);
+    if (lastKeyHash - firstKeyHash < numStreams)
+        numStreams = 1;
+    MigrationStream streams[PerfStats::MAX_MIGRATION_STREAMS];
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -1144,7 +1456,7 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
         while (true) {
             Status error = migrateSingleLogEntry(
                     *it.getCurrentSegmentIterator(),
-                    transferSeg, entryTotals, totalBytes,
+                    streams, numStreams, entryTotals, totalBytes,
                     tableId, firstKeyHash, lastKeyHash,
                     receiver);
             if (error) return;
@@ -1172,18 +1484,22 @@ MasterService::migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
             break;
         Status error = migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                streams, numStreams, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) return;
     }
 
-    if (transferSeg) {
-        transferSeg->close();
-        LOG(DEBUG, "Sending last migration segment");
-        MasterClient::receiveMigrationData(context, receiver,
-                transferSeg.get(), tableId, firstKeyHash);
-        transferSeg.destroy();
+    for (uint32_t i = 0; i < numStreams; i++) {
+        if (streams[i].transferSeg) {
+            LOG(DEBUG, "Sending last migration segment");
+            sendMigrationSegment(&streams[i], tableId, firstKeyHash, receiver);
+        }
+    }
+    for (uint32_t i = 0; i < numStreams; i++) {
+        CycleCounter<> streamCycles;
+        waitForMigrationSegment(&streams[i]);
+        PerfStats::threadStats.migrationStreamCycles[i] += streamCycles.stop();
     }
 
     // Now that all data has been transferred, we can reassign ownership of
@@ -1359,6 +1675,29 @@ MasterService::multiRead(const WireFormat::MultiOp::Request* reqHdr,
     respHdr->count = numRequests;
     uint32_t oldResponseLength = rpc->replyPayload->size();
 
+    // Parse all of the keys up front and prefetch what their lookups will
+    // touch, so that the cache misses for the whole batch overlap rather
+    // than being taken one key at a time in the loop below.
+    Tub<Key> keys[numRequests];
+    KeyHash keyHashes[numRequests];
+    uint32_t numKeys = 0;
+    for (uint32_t offset = reqOffset; numKeys < numRequests; numKeys++) {
+        const WireFormat::MultiOp::Request::ReadPart *part =
+                rpc->requestPayload->getOffset<
+                WireFormat::MultiOp::Request::ReadPart>(offset);
+        if (part == NULL)
+            break;
+        offset += sizeof32(WireFormat::MultiOp::Request::ReadPart);
+        const void* stringKey = rpc->requestPayload->getRange(
+                offset, part->keyLength);
+        if (stringKey == NULL)
+            break;
+        offset += part->keyLength;
+        keys[numKeys].construct(part->tableId, stringKey, part->keyLength);
+        keyHashes[numKeys] = keys[numKeys]->getHash();
+    }
+    objectManager.prefetchLookups(keyHashes, numKeys);
+
     // Each iteration extracts one request from request rpc, finds the
     // corresponding object, and appends the response to the response rpc.
     for (uint32_t i = 0; ; i++) {
@@ -1395,7 +1734,7 @@ MasterService::multiRead(const WireFormat::MultiOp::Request* reqHdr,
             break;
         }
 
-        Key key(currentReq->tableId, stringKey, currentReq->keyLength);
+        Key& key = *keys[i];
 
         WireFormat::MultiOp::Response::ReadPart* currentResp =
                rpc->replyPayload->emplaceAppend<
@@ -1535,6 +1874,30 @@ MasterService::multiWrite(const WireFormat::MultiOp::Request* reqHdr,
     // Buffer on stack.
     Buffer oldObjectBuffers[numRequests];
 
+    // Prefetch the hash table buckets and current versions of all of the
+    // objects being written before writing any of them (see multiRead).
+    KeyHash keyHashes[numRequests];
+    uint32_t numKeys = 0;
+    for (uint32_t offset = reqOffset; numKeys < numRequests; numKeys++) {
+        const WireFormat::MultiOp::Request::WritePart *part =
+                rpc->requestPayload->getOffset<
+                WireFormat::MultiOp::Request::WritePart>(offset);
+        if (part == NULL)
+            break;
+        offset += sizeof32(WireFormat::MultiOp::Request::WritePart);
+        if (rpc->requestPayload->size() < offset + part->length)
+            break;
+        Object object(part->tableId, 0, 0, *(rpc->requestPayload),
+                offset, part->length);
+        KeyLength keyLength;
+        const void* key = object.getKey(0, &keyLength);
+        if (key == NULL)
+            break;
+        keyHashes[numKeys] = Key::getHash(part->tableId, key, keyLength);
+        offset += part->length;
+    }
+    objectManager.prefetchLookups(keyHashes, numKeys);
+
     // Each iteration extracts one request from the rpc, writes the object
     // if possible, and appends a status and version to the response buffer.
     for (uint32_t i = 0; i < numRequests; i++) {
@@ -3163,6 +3526,11 @@ MasterService::write(const WireFormat::Write::Request* reqHdr,
                         reqHdr->lease, reqHdr->rpcId, reqHdr->ackId);
     if (rh.isDuplicate()) {
         *respHdr = parseRpcResult<WireFormat::Write>(rh.resultLoc());
+        // Clients retry a write that was acknowledged before it was
+        // replicated (see below) if they couldn't record it on all of our
+        // witnesses; they need to know that it's durable now.
+        if (!reqHdr->async)
+            objectManager.syncChanges();
         rpc->sendReply();
         return;
     }
@@ -3201,19 +3569,42 @@ MasterService::write(const WireFormat::Write::Request* reqHdr,
             &rpcResult, &rpcResultPtr);
 
     if (respHdr->common.status == STATUS_OK) {
+        // An asynchronous write is acknowledged before it is replicated:
+        // either the client doesn't care about durability, or it has also
+        // recorded the write on our witnesses, which will keep it until we
+        // tell them it is durable.
+        bool async = reqHdr->async;
+        if (async)
+            rpc->sendReply();
+        // reqHdr, respHdr, and rpc are off-limits now if async is set.
         objectManager.syncChanges();
         rh.recordCompletion(rpcResultPtr); // Complete only if RpcResult is
                                            // written.
                                            // Otherwise, RPC state should reset
                                            // especially for STATUS_RETRY.
-    } else if (respHdr->common.status != STATUS_RETRY &&
-               respHdr->common.status != STATUS_UNKNOWN_TABLET) {
-        // Above status requires a client to retry. We should not write
-        // RpcResult record in log for the two status values.
+        if (async && witnessManager.isEnabled()) {
+            witnessManager.synced(rpcResult.getKeyHash(),
+                    rpcResult.getLeaseId(), rpcResult.getRpcId());
+        }
+    } else {
+        if (respHdr->common.status != STATUS_RETRY &&
+                respHdr->common.status != STATUS_UNKNOWN_TABLET) {
+            // Above status requires a client to retry. We should not write
+            // RpcResult record in log for the two status values.
 
-        // Write RpcResult with failed (by RejectRule) status.
-        objectManager.writeRpcResultOnly(&rpcResult, &rpcResultPtr);
-        rh.recordCompletion(rpcResultPtr);
+            // Write RpcResult with failed (by RejectRule) status.
+            objectManager.writeRpcResultOnly(&rpcResult, &rpcResultPtr);
+            rh.recordCompletion(rpcResultPtr);
+        }
+        if (reqHdr->async && witnessManager.isEnabled()) {
+            // The client may have recorded the write on our witnesses. This
+            // attempt didn't happen, and a client that resends a witnessed
+            // write waits for it to be replicated rather than relying on
+            // the witnesses, so they needn't keep the record; left behind,
+            // it would block other writes with the same key hash.
+            witnessManager.synced(rpcResult.getKeyHash(),
+                    rpcResult.getLeaseId(), rpcResult.getRpcId());
+        }
     }
 
     // If this is a overwrite, delete old index entries if any (this can
@@ -3340,6 +3731,11 @@ class RecoveryTask {
         , response()
         , startTime(Cycles::rdtsc())
         , rpc()
+        , iterator()
+        , replaying(false)
+        , replayed(false)
+        , replayError()
+        , replayTicks(0)
     {
         rpc.construct(context, replica.backupId, recoveryId, masterId,
                 replica.segmentId, partitionId, &response);
@@ -3366,8 +3762,159 @@ class RecoveryTask {
     Buffer response;
     const uint64_t startTime;
     Tub<GetRecoveryDataRpc> rpc;
+
+    /// Iterates over #response once it has arrived and been checked; used
+    /// by a SegmentReplayer thread.
+    Tub<SegmentIterator> iterator;
+
+    /// True once #response has been handed to a SegmentReplayer.
+    bool replaying;
+
+    /// Set by the SegmentReplayer thread when it has finished replaying
+    /// #response; nothing else in this object is touched by that thread
+    /// afterwards.
+    std::atomic<bool> replayed;
+
+    /// If replay failed, the exception it threw.
+    std::exception_ptr replayError;
+
+    /// Time the SegmentReplayer thread spent replaying #response.
+    uint64_t replayTicks;
     DISALLOW_COPY_AND_ASSIGN(RecoveryTask);
 };
+
+/**
+ * Replays recovery segments on a pool of threads so that a recovery master
+ * can use more than one core for replay. Each thread appends to its own
+ * SideLog; objects that show up in segments being replayed by different
+ * threads are settled by the usual version and tombstone rules in
+ * ObjectManager::replaySegment, which holds the key's hash table bucket
+ * lock while it does so.
+ */
+class SegmentReplayer {
+  PUBLIC:
+    SegmentReplayer(ObjectManager* objectManager, uint32_t numThreads,
+            const std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap)
+        : objectManager(objectManager)
+        , mutex()
+        , workAvailable()
+        , queue()
+        , exiting(false)
+        , sideLogs()
+        , nextNodeIdMaps(numThreads, nextNodeIdMap)
+        , threads()
+    {
+        for (uint32_t i = 0; i < numThreads; i++) {
+            sideLogs.emplace_back(new SideLog(objectManager->getLog()));
+        }
+        for (uint32_t i = 0; i < numThreads; i++) {
+            threads.emplace_back(&SegmentReplayer::replayThread, this, i);
+        }
+    }
+
+    ~SegmentReplayer()
+    {
+        stop();
+    }
+
+    /**
+     * Queue a task whose response has arrived and whose iterator has been
+     * constructed; its #replayed flag is set once a thread has replayed it.
+     */
+    void
+    start(RecoveryTask* task)
+    {
+        task->replaying = true;
+        std::lock_guard<std::mutex> _(mutex);
+        queue.push_back(task);
+        workAvailable.notify_one();
+    }
+
+    /**
+     * Wait for the threads to exit (any queued tasks are replayed first),
+     * fold each thread's view of the B+ tree node ids into
+     * \a nextNodeIdMap, and commit all of the SideLogs.
+     */
+    void
+    finish(std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap)
+    {
+        stop();
+        foreach (auto& threadMap, nextNodeIdMaps) {
+            foreach (auto& entry, threadMap) {
+                uint64_t& nextNodeId = nextNodeIdMap[entry.first];
+                nextNodeId = std::max(nextNodeId, entry.second);
+            }
+        }
+        foreach (auto& sideLog, sideLogs)
+            sideLog->commit();
+    }
+
+  PRIVATE:
+    void
+    stop()
+    {
+        {
+            std::lock_guard<std::mutex> _(mutex);
+            exiting = true;
+            workAvailable.notify_all();
+        }
+        foreach (auto& thread, threads) {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    void
+    replayThread(uint32_t index)
+    {
+        while (true) {
+            RecoveryTask* task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (queue.empty() && !exiting)
+                    workAvailable.wait(lock);
+                if (queue.empty())
+                    return;
+                task = queue.front();
+                queue.pop_front();
+            }
+            uint64_t start = Cycles::rdtsc();
+            try {
+                objectManager->replaySegment(sideLogs[index].get(),
+                        *task->iterator, &nextNodeIdMaps[index]);
+            } catch (...) {
+                task->replayError = std::current_exception();
+            }
+            task->replayTicks = Cycles::rdtsc() - start;
+            task->replayed = true;
+        }
+    }
+
+    /// Where segments are replayed to.
+    ObjectManager* objectManager;
+
+    /// Protects #queue and #exiting.
+    std::mutex mutex;
+
+    /// Signaled when #queue becomes non-empty or #exiting is set.
+    std::condition_variable workAvailable;
+
+    /// Tasks waiting for a thread to replay them.
+    std::deque<RecoveryTask*> queue;
+
+    /// Set to tell the threads to exit once #queue is empty.
+    bool exiting;
+
+    /// One per thread; each is only appended to by its own thread.
+    std::vector<std::unique_ptr<SideLog>> sideLogs;
+
+    /// One copy of the caller's map per thread; see finish().
+    std::vector<std::unordered_map<uint64_t, uint64_t>> nextNodeIdMaps;
+
+    std::vector<std::thread> threads;
+
+    DISALLOW_COPY_AND_ASSIGN(SegmentReplayer);
+};
 } // namespace MasterServiceInternal
 
 using namespace MasterServiceInternal; // NOLINT
@@ -3504,17 +4051,28 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
     LOG(NOTICE, "Recovering master %s, partition %lu, %lu replicas available",
             masterId.toString().c_str(), partitionId, replicas.size());
 
+    // With more than one replay thread, segments are handed to a
+    // SegmentReplayer as they arrive and each task stays busy until its
+    // segment has been replayed; extra tasks keep fetches going meanwhile.
+    uint32_t replayThreads = std::max(config->master.recoveryReplayThreads,
+                                      1u);
+    metrics->master.recoveryReplayThreads = replayThreads;
     std::unordered_set<uint64_t> runningSet;
-    Tub<RecoveryTask> tasks[4];
+    std::vector<Tub<RecoveryTask>> tasks(replayThreads > 1 ?
+                                         4 + replayThreads : 4);
     uint32_t activeRequests = 0;
+    uint64_t firstReplayStart = 0;
 
     auto notStarted = replicas.begin();
     auto replicasEnd = replicas.end();
 
     // The SideLog we'll append recovered entries to. It will be committed after
     // replay completes on all segments, making all of the recovered data
-    // durable.
+    // durable. The SegmentReplayer, if any, has SideLogs of its own instead.
     SideLog sideLog(objectManager.getLog());
+    Tub<SegmentReplayer> replayer;
+    if (replayThreads > 1)
+        replayer.construct(&objectManager, replayThreads, nextNodeIdMap);
 
     // Start RPCs
     auto replicaIt = notStarted;
@@ -3559,78 +4117,94 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
         foreach (auto& task, tasks) {
             if (!task)
                 continue;
-            if (!task->rpc->isReady())
+            if (task->replaying ? !task->replayed : !task->rpc->isReady())
                 continue;
             readStallTicks.destroy();
-            LOG(DEBUG, "Waiting on recovery data for segment %lu from %s",
-                    task->replica.segmentId,
-                    context->serverList->toString(
-                            task->replica.backupId).c_str());
             try {
-                SegmentCertificate certificate = task->rpc->wait();
-                task->rpc.destroy();
-                uint64_t grdTime = Cycles::rdtsc() - task->startTime;
-                metrics->master.segmentReadTicks += grdTime;
-
-                if (!gotFirstGRD) {
-                    metrics->master.replicationBytes = 0 -
-                            metrics->transport.transmit.byteCount;
-                    metrics->master.replicationTransmitCopyTicks = 0 -
-                            metrics->transport.transmit.copyTicks;
-                    metrics->master.replicationTransmitActiveTicks = 0 -
-                            metrics->transport.infiniband.transmitActiveTicks;
-                    metrics->master.replicationPostingWriteRpcTicks = 0;
-                    metrics->master.replayMemoryReadBytes = 0 - (
-                            // tx
-                            metrics->master.replicationBytes +
-                            // tx copy
-                            metrics->master.replicationBytes +
-                            // backup write copy
-                            metrics->backup.writeCopyBytes +
-                            // read from filtering objects
-                            metrics->backup.storageReadBytes +
-                            // log append copy
-                            metrics->master.liveObjectBytes);
-                    metrics->master.replayMemoryWrittenBytes = 0 - (
-                            // tx copy
-                            metrics->master.replicationBytes +
-                            // backup write copy
-                            metrics->backup.writeCopyBytes +
-                            // disk read into memory
-                            metrics->backup.storageReadBytes +
-                            // copy from filtering objects
-                            metrics->backup.storageReadBytes +
-                            // rx into memory
-                            metrics->transport.receive.byteCount +
-                            // log append copy
-                            metrics->master.liveObjectBytes);
-                    gotFirstGRD = true;
-                }
-                if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
-                    LOG(DEBUG, "@%7lu: Got getRecoveryData response from %s, "
-                            "took %.1f us on channel %ld",
-                            Cycles::toMicroseconds(Cycles::rdtsc() -
-                                ReplicatedSegment::recoveryStart),
+                if (task->replaying) {
+                    // A SegmentReplayer thread has finished with the segment.
+                    usefulTime += task->replayTicks;
+                    if (task->replayError)
+                        std::rethrow_exception(task->replayError);
+                } else {
+                    LOG(DEBUG, "Waiting on recovery data for segment %lu "
+                            "from %s",
+                            task->replica.segmentId,
                             context->serverList->toString(
-                                task->replica.backupId).c_str(),
-                            Cycles::toSeconds(grdTime)*1e06,
-                            &task - &tasks[0]);
-                }
-
-                uint32_t responseLen = task->response.size();
-                metrics->master.segmentReadByteCount += responseLen;
-                uint64_t startUseful = Cycles::rdtsc();
-                SegmentIterator it(task->response.getRange(0, responseLen),
-                        responseLen, certificate);
-                it.checkMetadataIntegrity();
-                if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
-                    LOG(DEBUG, "@%7lu: Replaying segment %lu with length %u",
-                            Cycles::toMicroseconds(Cycles::rdtsc() -
+                                    task->replica.backupId).c_str());
+                    SegmentCertificate certificate = task->rpc->wait();
+                    task->rpc.destroy();
+                    uint64_t grdTime = Cycles::rdtsc() - task->startTime;
+                    metrics->master.segmentReadTicks += grdTime;
+
+                    if (!gotFirstGRD) {
+                        metrics->master.replicationBytes = 0 -
+                                metrics->transport.transmit.byteCount;
+                        metrics->master.replicationTransmitCopyTicks = 0 -
+                                metrics->transport.transmit.copyTicks;
+                        metrics->master.replicationTransmitActiveTicks = 0 -
+                            metrics->transport.infiniband.transmitActiveTicks;
+                        metrics->master.replicationPostingWriteRpcTicks = 0;
+                        metrics->master.replayMemoryReadBytes = 0 - (
+                                // tx
+                                metrics->master.replicationBytes +
+                                // tx copy
+                                metrics->master.replicationBytes +
+                                // backup write copy
+                                metrics->backup.writeCopyBytes +
+                                // read from filtering objects
+                                metrics->backup.storageReadBytes +
+                                // log append copy
+                                metrics->master.liveObjectBytes);
+                        metrics->master.replayMemoryWrittenBytes = 0 - (
+                                // tx copy
+                                metrics->master.replicationBytes +
+                                // backup write copy
+                                metrics->backup.writeCopyBytes +
+                                // disk read into memory
+                                metrics->backup.storageReadBytes +
+                                // copy from filtering objects
+                                metrics->backup.storageReadBytes +
+                                // rx into memory
+                                metrics->transport.receive.byteCount +
+                                // log append copy
+                                metrics->master.liveObjectBytes);
+                        gotFirstGRD = true;
+                    }
+                    if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
+                        LOG(DEBUG, "@%7lu: Got getRecoveryData response "
+                                "from %s, took %.1f us on channel %ld",
+                                Cycles::toMicroseconds(Cycles::rdtsc() -
                                     ReplicatedSegment::recoveryStart),
-                            task->replica.segmentId, responseLen);
+                                context->serverList->toString(
+                                    task->replica.backupId).c_str(),
+                                Cycles::toSeconds(grdTime)*1e06,
+                                &task - &tasks[0]);
+                    }
+
+                    uint32_t responseLen = task->response.size();
+                    metrics->master.segmentReadByteCount += responseLen;
+                    uint64_t startUseful = Cycles::rdtsc();
+                    SegmentIterator it(task->response.getRange(0, responseLen),
+                            responseLen, certificate);
+                    it.checkMetadataIntegrity();
+                    if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
+                        LOG(DEBUG, "@%7lu: Replaying segment %lu with "
+                                "length %u",
+                                Cycles::toMicroseconds(Cycles::rdtsc() -
+                                        ReplicatedSegment::recoveryStart),
+                                task->replica.segmentId, responseLen);
+                    }
+                    if (firstReplayStart == 0)
+                        firstReplayStart = Cycles::rdtsc();
+                    if (replayer) {
+                        task->iterator.construct(it);
+                        replayer->start(task.get());
+                        continue;
+                    }
+                    objectManager.replaySegment(&sideLog, it, &nextNodeIdMap);
+                    usefulTime += Cycles::rdtsc() - startUseful;
                 }
-                objectManager.replaySegment(&sideLog, it, &nextNodeIdMap);
-                usefulTime += Cycles::rdtsc() - startUseful;
                 TEST_LOG("Segment %lu replay complete",
                          task->replica.segmentId);
                 if (LOG_RECOVERY_REPLICATION_RPC_TIMING) {
@@ -3715,6 +4289,10 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
         }
     }
     readStallTicks.destroy();
+    if (firstReplayStart != 0) {
+        metrics->master.recoveryReplayTicks +=
+                Cycles::rdtsc() - firstReplayStart;
+    }
 
     detectSegmentRecoveryFailure(masterId, partitionId, replicas);
 
@@ -3729,6 +4307,8 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
                 0 - metrics->transport.infiniband.transmitActiveTicks;
         metrics->master.logSyncPostingWriteRpcTicks =
                 0 - metrics->master.replicationPostingWriteRpcTicks;
+        if (replayer)
+            replayer->finish(nextNodeIdMap);
         sideLog.commit();
         metrics->master.logSyncBytes += metrics->transport.transmit.byteCount;
         metrics->master.logSyncTransmitCopyTicks +=
@@ -3768,6 +4348,117 @@ MasterService::recover(uint64_t recoveryId, ServerId masterId,
             totalSecs * 1e03, usefulSecs * 1e03, 100 * usefulSecs / totalSecs);
 }
 
+/**
+ * Helper for public recover() method.
+ * Re-execute the writes that the crashed master acknowledged before
+ * replicating them, as recorded by its witnesses (see WitnessManager).
+ * Writes that made it into the recovered log are recognized as
+ * duplicates by UnackedRpcResults and skipped, as are writes whose
+ * clients have since acknowledged them; writes for tablets in other
+ * partitions are left to the recovery masters for those partitions.
+ * Recorded writes never conflict with one another (witnesses only keep
+ * one per key hash), so they can be replayed in any order.
+ *
+ * \param crashedMasterId
+ *      The id of the crashed master being recovered.
+ * \param recoveryPartition
+ *      The tablets this master is recovering; they must be installed
+ *      (in the NOT_READY state) and the log replayed.
+ */
+void
+MasterService::replayWitnessRecords(ServerId crashedMasterId,
+        const ProtoBuf::RecoveryPartition& recoveryPartition)
+{
+    std::vector<string> requests;
+    WitnessManager::getRecoveryData(context, crashedMasterId, &requests);
+    if (requests.empty())
+        return;
+
+    // ObjectManager only accepts writes for NORMAL tablets. No client can
+    // reach the recovering tablets until the coordinator hears that this
+    // recovery has finished, so it's safe to open them up briefly.
+    foreach (const ProtoBuf::Tablets::Tablet& tablet,
+            recoveryPartition.tablet()) {
+        tabletManager.changeState(tablet.table_id(),
+                tablet.start_key_hash(), tablet.end_key_hash(),
+                TabletManager::NOT_READY, TabletManager::NORMAL);
+    }
+
+    uint32_t replayed = 0;
+    foreach (const string& request, requests) {
+        Buffer buffer;
+        buffer.appendExternal(request.data(),
+                downCast<uint32_t>(request.size()));
+        const WireFormat::Write::Request* reqHdr =
+                buffer.getStart<WireFormat::Write::Request>();
+        if (reqHdr == NULL || reqHdr->common.opcode != WireFormat::WRITE ||
+                buffer.size() < sizeof32(*reqHdr) + reqHdr->length) {
+            LOG(WARNING, "Ignoring malformed witness record for master %s",
+                crashedMasterId.toString().c_str());
+            continue;
+        }
+
+        Object object(reqHdr->tableId, 0, 0, buffer, sizeof32(*reqHdr));
+        KeyLength pKeyLen;
+        const void* pKey = object.getKey(0, &pKeyLen);
+        KeyHash keyHash = Key::getHash(reqHdr->tableId, pKey, pKeyLen);
+        bool inPartition = false;
+        foreach (const ProtoBuf::Tablets::Tablet& tablet,
+                recoveryPartition.tablet()) {
+            if (tablet.table_id() == reqHdr->tableId &&
+                    tablet.start_key_hash() <= keyHash &&
+                    keyHash <= tablet.end_key_hash()) {
+                inPartition = true;
+                break;
+            }
+        }
+        if (!inPartition)
+            continue;
+
+        try {
+            UnackedRpcHandle rh(&unackedRpcResults,
+                    reqHdr->lease, reqHdr->rpcId, reqHdr->ackId);
+            if (rh.isDuplicate())
+                continue;
+
+            WireFormat::Write::Response respHdr;
+            respHdr.common.status = STATUS_OK;
+            respHdr.version = 0;
+            RejectRules rejectRules = reqHdr->rejectRules;
+            uint64_t rpcResultPtr;
+            RpcResult rpcResult(reqHdr->tableId, keyHash,
+                    reqHdr->lease.leaseId, reqHdr->rpcId, reqHdr->ackId,
+                    &respHdr, sizeof(respHdr));
+            respHdr.common.status = objectManager.writeObject(object,
+                    &rejectRules, &respHdr.version, NULL, &rpcResult,
+                    &rpcResultPtr);
+            if (respHdr.common.status == STATUS_OK) {
+                rh.recordCompletion(rpcResultPtr);
+                replayed++;
+            } else {
+                LOG(WARNING, "Replaying witness record for table %lu, "
+                    "key hash 0x%lx failed: %s", reqHdr->tableId, keyHash,
+                    statusToString(respHdr.common.status));
+            }
+        } catch (const ClientException& e) {
+            // The client has already acknowledged the write (so it's in
+            // the log or superseded), or its lease has expired.
+            LOG(DEBUG, "Skipping witness record for table %lu, key hash "
+                "0x%lx: %s", reqHdr->tableId, keyHash, e.str().c_str());
+        }
+    }
+    objectManager.syncChanges();
+
+    foreach (const ProtoBuf::Tablets::Tablet& tablet,
+            recoveryPartition.tablet()) {
+        tabletManager.changeState(tablet.table_id(),
+                tablet.start_key_hash(), tablet.end_key_hash(),
+                TabletManager::NORMAL, TabletManager::NOT_READY);
+    }
+    LOG(NOTICE, "Replayed %u of %lu witness records for crashed master %s",
+        replayed, requests.size(), crashedMasterId.toString().c_str());
+}
+
 /**
  * Thrown during recovery in recoverSegment when a log append fails. Caught
  * by recover() which aborts the recovery cleanly and notifies the coordinator
@@ -3868,6 +4559,7 @@ MasterService::recover(const WireFormat::Recover::Request* reqHdr,
         }
         recover(recoveryId, crashedServerId, partitionId, replicas,
                 nextNodeIdMap);
+        replayWitnessRecords(crashedServerId, recoveryPartition);
         // Install indexlets we are recovering
         foreach (const ProtoBuf::Indexlet& newIndexlet,
                  recoveryPartition.indexlet()) {
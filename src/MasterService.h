@@ -24,6 +24,7 @@
 #include "LogCleaner.h"
 #include "LogIterator.h"
 #include "HashTable.h"
+#include "MasterClient.h"
 #include "MasterTableMetadata.h"
 #include "Object.h"
 #include "ObjectFinder.h"
@@ -44,6 +45,7 @@
 #include "IndexletManager.h"
 #include "WireFormat.h"
 #include "UnackedRpcResults.h"
+#include "WitnessManager.h"
 
 namespace RAMCloud {
 
@@ -135,6 +137,12 @@ class MasterService : public Service {
      */
     TransactionManager transactionManager;
 
+    /**
+     * Keeps track of the servers on which clients record writes that this
+     * master acknowledges before replicating them.
+     */
+    WitnessManager witnessManager;
+
 #ifdef TESTING
     /// Used to pause the read-increment-write cycle in incrementObject
     /// between the read and the write.  While paused, a second thread can
@@ -172,6 +180,9 @@ class MasterService : public Service {
                 const WireFormat::GetServerStatistics::Request* reqHdr,
                 WireFormat::GetServerStatistics::Response* respHdr,
                 Rpc* rpc);
+    void getWitnesses(const WireFormat::GetWitnesses::Request* reqHdr,
+                WireFormat::GetWitnesses::Response* respHdr,
+                Rpc* rpc);
     void fillWithTestData(const WireFormat::FillWithTestData::Request* reqHdr,
                 WireFormat::FillWithTestData::Response* respHdr,
                 Rpc* rpc);
@@ -191,6 +202,9 @@ class MasterService : public Service {
                 const WireFormat::ReadHashes::Request* reqHdr,
                 WireFormat::ReadHashes::Response* respHdr,
                 Rpc* rpc);
+    void readIndexedObjects(uint64_t tableId, uint32_t numHashes,
+                Buffer* pKHashes, uint32_t pKHashesOffset, Buffer* response,
+                uint32_t* numHashesRead, uint32_t* numObjects);
     void initOnceEnlisted();
     void insertIndexEntry(const WireFormat::InsertIndexEntry::Request* reqHdr,
                 WireFormat::InsertIndexEntry::Response* respHdr,
@@ -201,6 +215,10 @@ class MasterService : public Service {
     void lookupIndexKeys(const WireFormat::LookupIndexKeys::Request* reqHdr,
                 WireFormat::LookupIndexKeys::Response* respHdr,
                 Rpc* rpc);
+    void lookupIndexObjects(
+                const WireFormat::LookupIndexObjects::Request* reqHdr,
+                WireFormat::LookupIndexObjects::Response* respHdr,
+                Rpc* rpc);
     int migrateSingleIndexObject(
                 ServerId newOwnerMasterId, uint64_t tableId, uint8_t indexId,
                 uint64_t currentBackingTableId, uint64_t newBackingTableId,
@@ -212,8 +230,36 @@ class MasterService : public Service {
                 uint64_t& totalBytes,
                 WireFormat::SplitAndMigrateIndexlet::Response* respHdr);
   public: // For MigrateTabletBenchmark.
+    /**
+     * One of the parallel streams over which migrateTablet() sends a
+     * tablet: a contiguous piece of the tablet's key hash range whose log
+     * entries are packed into segments and sent to the new owner in order.
+     * At most one segment per stream is in flight at a time, so the new
+     * owner sees each stream's entries in log order while replaying the
+     * streams concurrently.
+     */
+    struct MigrationStream {
+        MigrationStream()
+            : transferSeg()
+            , sentSeg()
+            , rpc()
+        {}
+
+        /// Segment being filled with log entries to send next.
+        std::unique_ptr<Segment> transferSeg;
+
+        /// Segment being sent by #rpc; it must live until #rpc completes.
+        std::unique_ptr<Segment> sentSeg;
+
+        /// Outstanding request to the new owner to replay #sentSeg, if any.
+        Tub<ReceiveMigrationDataRpc> rpc;
+
+        DISALLOW_COPY_AND_ASSIGN(MigrationStream);
+    };
+
     Status migrateSingleLogEntry(SegmentIterator& it,
-                Tub<Segment>& transferSeg,
+                MigrationStream streams[],
+                uint32_t numStreams,
                 uint64_t entryTotals[],
                 uint64_t& totalBytes,
                 uint64_t tableId,
@@ -221,6 +267,11 @@ class MasterService : public Service {
                 uint64_t lastKeyHash,
                 ServerId receiver);
   PRIVATE:
+    void sendMigrationSegment(MigrationStream* stream,
+                uint64_t tableId,
+                uint64_t firstKeyHash,
+                ServerId receiver);
+    void waitForMigrationSegment(MigrationStream* stream);
     void migrateTablet(const WireFormat::MigrateTablet::Request* reqHdr,
                 WireFormat::MigrateTablet::Response* respHdr,
                 Rpc* rpc);
@@ -375,6 +426,13 @@ class MasterService : public Service {
      */
     uint32_t maxResponseRpcLen;
 
+    /**
+     * Maximum number of runs of hashes (each stored on a single master)
+     * for which a LOOKUP_INDEX_OBJECTS request returns objects. This bounds
+     * the number of READ_HASHES requests it forwards to other masters.
+     */
+    static const uint32_t MAX_INDEXED_READ_RUNS = 8;
+
     /*
      * Used to identify tablets for which migration is underway.
      */
@@ -486,6 +544,8 @@ class MasterService : public Service {
                 uint64_t partitionId,
                 vector<Replica>& replicas,
                 std::unordered_map<uint64_t, uint64_t>& nextNodeIdMap);
+    void replayWitnessRecords(ServerId crashedMasterId,
+                const ProtoBuf::RecoveryPartition& recoveryPartition);
 
 ///////////////////////////////////////////////////////////////////////////////
 /////////////////////////End of Recovery related code./////////////////////////
@@ -555,6 +555,32 @@ TEST_F(MasterServiceTest, enumerate_basics) {
     EXPECT_EQ(0U, objects.size());
 }
 
+TEST_F(MasterServiceTest, enumerate_tabletMembership) {
+    ramcloud->write(1, "0", 1, "abcdef", 6);
+
+    // Only buckets holding key hashes known to the membership index are
+    // visited, so an object written before it existed isn't found.
+    service->objectManager.tabletMembership.construct();
+    ramcloud->write(1, "1", 1, "ghijkl", 6);
+    Buffer iter, nextIter, finalIter, objects;
+    EnumerateTableRpc rpc(ramcloud.get(), 1, false, 0, iter, objects);
+    uint64_t nextTabletStartHash = rpc.wait(nextIter);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(38U, objects.size());
+    Buffer buffer;
+    buffer.appendExternal(objects.getRange(4, objects.size() - 4),
+            objects.size() - 4);
+    Object object(buffer);
+    EXPECT_EQ("1", string(reinterpret_cast<const char*>(
+            object.getKey()), 1));
+
+    EnumerateTableRpc rpc2(ramcloud.get(), 1, false, nextTabletStartHash,
+            nextIter, objects);
+    nextTabletStartHash = rpc2.wait(finalIter);
+    EXPECT_EQ(0U, nextTabletStartHash);
+    EXPECT_EQ(0U, objects.size());
+}
+
 TEST_F(MasterServiceTest, enumerate_tabletNotOnServer) {
     TestLog::Enable _;
     Buffer iter, nextIter, objects;
@@ -632,6 +658,9 @@ TEST_F(MasterServiceTest, getServerStatistics) {
     uint64_t version;
     int64_t objectValue = 16;
 
+    // The fixture adds the tablet directly, so record its ownership as
+    // takeTabletOwnership would; byte estimates depend on it.
+    TableStats::addKeyHashRange(&service->masterTableMetadata, 1, 0, ~0UL);
     ramcloud->write(1, "key0", 4, &objectValue, 8, NULL, &version);
     ramcloud->read(1, "key0", 4, &value);
     ramcloud->read(1, "key0", 4, &value);
@@ -641,8 +670,11 @@ TEST_F(MasterServiceTest, getServerStatistics) {
     ramcloud->getServerStatistics("mock:host=master", serverStats);
     EXPECT_TRUE(StringUtil::startsWith(serverStats.ShortDebugString(),
             "tabletentry { table_id: 1 start_key_hash: 0 "
-            "end_key_hash: 18446744073709551615 number_read_and_writes: 4 } "
+            "end_key_hash: 18446744073709551615 number_read_and_writes: 4 "
+            "read_count: 3 write_count: 1 byte_count: "));
+    EXPECT_NE(string::npos, serverStats.ShortDebugString().find(
             "spin_lock_stats { locks { name:"));
+    EXPECT_LT(0U, serverStats.tabletentry(0).byte_count());
 
     MasterClient::splitMasterTablet(&context, masterServer->serverId, 1,
             (~0UL/2));
@@ -872,7 +904,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_basic) {
     EXPECT_EQ(STATUS_OK, service->objectManager.writeObject(obj, 0, 0));
 
     LogIterator it(*service->objectManager.getLog());
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -886,7 +918,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_basic) {
         TestLog::reset();
         error = service->migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -907,7 +939,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_wrongTable) {
     EXPECT_EQ(STATUS_OK, service->objectManager.writeObject(obj, 0, 0));
 
     LogIterator it(*service->objectManager.getLog());
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -921,7 +953,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_wrongTable) {
         TestLog::reset();
         error = service->migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -943,7 +975,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_wrongKeyHash) {
     EXPECT_EQ(STATUS_OK, service->objectManager.writeObject(obj, 0, 0));
 
     LogIterator it(*service->objectManager.getLog());
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -957,7 +989,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_wrongKeyHash) {
         TestLog::reset();
         error = service->migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -998,7 +1030,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_rpcResult) {
         ASSERT_TRUE(segment.append(LOG_ENTRY_TYPE_RPCRESULT, buffer));
     }
 
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -1013,7 +1045,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_rpcResult) {
     for (SegmentIterator it(segment); !it.isDone(); it.next()) {
         error = service->migrateSingleLogEntry(
                 it,
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -1086,7 +1118,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_prepAndprepTomb) {
         ASSERT_TRUE(segment.append(LOG_ENTRY_TYPE_PREPTOMB, buffer));
     }
 
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -1101,7 +1133,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_prepAndprepTomb) {
     for (SegmentIterator it(segment); !it.isDone(); it.next()) {
         error = service->migrateSingleLogEntry(
                 it,
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -1146,7 +1178,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_decisionRecord) {
     }
 
     LogIterator it(*service->objectManager.getLog());
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -1160,7 +1192,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_decisionRecord) {
     for (; !it.isDone(); it.next()) {
         error = service->migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -1231,7 +1263,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_participantList) {
     }
 
     LogIterator it(*service->objectManager.getLog());
-    Tub<Segment> transferSeg;
+    MasterService::MigrationStream stream;
 
     uint64_t entryTotals[TOTAL_LOG_ENTRY_TYPES] = {0};
     uint64_t totalBytes = 0;
@@ -1245,7 +1277,7 @@ TEST_F(MasterServiceTest, migrateSingleLogEntry_participantList) {
     for (; !it.isDone(); it.next()) {
         error = service->migrateSingleLogEntry(
                 *it.getCurrentSegmentIterator(),
-                transferSeg, entryTotals, totalBytes,
+                &stream, 1, entryTotals, totalBytes,
                 tableId, firstKeyHash, lastKeyHash,
                 receiver);
         if (error) break;
@@ -1361,6 +1393,102 @@ TEST_F(MasterServiceTest, migrateTablet_movingData) {
     EXPECT_LT(ctimeCoord, master2HeadPositionAfter);
 }
 
+TEST_F(MasterServiceTest, migrateTablet_parallelStreams) {
+    ramcloud->createTable("migrationTable");
+    uint64_t tbl = ramcloud->getTableId("migrationTable");
+    for (int i = 0; i < 20; i++) {
+        string key = format("key%d", i);
+        ramcloud->write(tbl, key.c_str(), downCast<uint16_t>(key.length()),
+                "abcdefg", 7);
+    }
+
+    ServerConfig master2Config = masterConfig;
+    master2Config.master.numReplicas = 0;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    ServerConfig config = *service->config;
+    config.master.migrationStreams = 3;
+    const ServerConfig* oldConfig = service->config;
+    service->config = &config;
+    PerfStats::threadStats.migrationStreamBytes[0] = 0;
+    PerfStats::threadStats.migrationStreamBytes[1] = 0;
+    PerfStats::threadStats.migrationStreamBytes[2] = 0;
+    PerfStats::threadStats.migrationStreamBytes[3] = 0;
+    TestLog::Enable _("migrateTablet");
+    ramcloud->migrateTablet(tbl, 0, -1, master2->serverId);
+    string log = TestLog::get();
+    int lastSegments = 0;
+    for (size_t pos = log.find("Sending last migration segment");
+            pos != string::npos;
+            pos = log.find("Sending last migration segment", pos + 1)) {
+        lastSegments++;
+    }
+    EXPECT_EQ(3, lastSegments);
+
+    // The default thread (and any worker threads in the mock cluster) all
+    // share one PerfStats here, so every stream shows up.
+    uint64_t totalBytes = 0;
+    for (uint32_t i = 0; i < 3; i++) {
+        EXPECT_LT(0U, PerfStats::threadStats.migrationStreamBytes[i]);
+        totalBytes += PerfStats::threadStats.migrationStreamBytes[i];
+    }
+    EXPECT_EQ(0U, PerfStats::threadStats.migrationStreamBytes[3]);
+    EXPECT_NE(string::npos, log.find(
+            format("%lu bytes in total", totalBytes)));
+
+    // This test's ObjectFinder always sends requests for the table to the
+    // old master, so look for the objects on master2 directly.
+    for (int i = 0; i < 20; i++) {
+        string keyString = format("key%d", i);
+        Key key(tbl, keyString.c_str(), downCast<uint16_t>(keyString.length()));
+        Buffer value;
+        EXPECT_EQ(STATUS_OK, master2->master->objectManager.readObject(
+                key, &value, NULL, NULL, true));
+        EXPECT_EQ("abcdefg", TestUtil::toString(&value));
+    }
+    Key key(tbl, "key0", 4);
+    EXPECT_TRUE(master2->master->tabletManager.getTablet(key));
+    service->config = oldConfig;
+}
+
+TEST_F(MasterServiceTest, migrateTablet_singleStreamWholeTable) {
+    ramcloud->createTable("migrationTable");
+    uint64_t tbl = ramcloud->getTableId("migrationTable");
+    for (int i = 0; i < 5; i++) {
+        string key = format("key%d", i);
+        ramcloud->write(tbl, key.c_str(), downCast<uint16_t>(key.length()),
+                "abcdefg", 7);
+    }
+
+    ServerConfig master2Config = masterConfig;
+    master2Config.master.numReplicas = 0;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    // A single stream spans the entire key hash space.
+    ServerConfig config = *service->config;
+    config.master.migrationStreams = 1;
+    const ServerConfig* oldConfig = service->config;
+    service->config = &config;
+    TestLog::Enable _("migrateTablet");
+    ramcloud->migrateTablet(tbl, 0, -1, master2->serverId);
+    service->config = oldConfig;
+    string log = TestLog::get();
+    EXPECT_NE(string::npos, log.find("Sending last migration segment"));
+    EXPECT_EQ(log.find("Sending last migration segment"),
+            log.rfind("Sending last migration segment"));
+
+    for (int i = 0; i < 5; i++) {
+        string keyString = format("key%d", i);
+        Key key(tbl, keyString.c_str(), downCast<uint16_t>(keyString.length()));
+        Buffer value;
+        EXPECT_EQ(STATUS_OK, master2->master->objectManager.readObject(
+                key, &value, NULL, NULL, true));
+        EXPECT_EQ("abcdefg", TestUtil::toString(&value));
+    }
+}
+
 TEST_F(MasterServiceTest, multiIncrement_basics) {
     uint64_t tableId1 = ramcloud->createTable("table1");
 
@@ -1895,6 +2023,86 @@ TEST_F(MasterServiceTest, readHashes) {
             o1.getValueLength()));
 }
 
+TEST_F(MasterServiceTest, readIndexedObjects) {
+    ServerConfig master2Config = masterConfig;
+    master2Config.master.numReplicas = 0;
+    master2Config.localLocator = "mock:host=master2";
+    Server* master2 = cluster.addServer(master2Config);
+
+    // The coordinator places the whole table on master2, but this master
+    // owns the upper part of it too (starting at the hash of key3), so
+    // hashes there are read locally and the rest are forwarded to master2.
+    // The fixture gave this master table 1 without telling the
+    // coordinator, so use up that id first.
+    cluster.coordinator->tableManager.createTable("filler", 1,
+            master2->serverId);
+    uint64_t tableId = cluster.coordinator->tableManager.createTable(
+            "table", 1, master2->serverId);
+    vector<uint64_t> hashes;
+    for (int i = 0; i < 6; i++) {
+        string keyString = format("key%d", i);
+        hashes.push_back(Key(tableId, keyString.c_str(),
+                uint16_t(keyString.length())).getHash());
+    }
+    vector<uint64_t> sortedHashes(hashes);
+    std::sort(sortedHashes.begin(), sortedHashes.end());
+    uint64_t splitHash = sortedHashes[3];
+    service->tabletManager.addTablet(tableId, splitHash, ~0UL,
+            TabletManager::NORMAL);
+
+    Buffer pKHashes;
+    uint32_t numLocal = 0;
+    for (int i = 0; i < 6; i++) {
+        string keyString = format("key%d", i);
+        Key key(tableId, keyString.c_str(), uint16_t(keyString.length()));
+        Buffer buffer;
+        Object obj(key, "value", 5, 0, 0, buffer);
+        if (key.getHash() >= splitHash) {
+            EXPECT_EQ(STATUS_OK, service->objectManager.writeObject(obj, 0, 0));
+            numLocal++;
+        } else {
+            EXPECT_EQ(STATUS_OK,
+                    master2->master->objectManager.writeObject(obj, 0, 0));
+        }
+        pKHashes.emplaceAppend<uint64_t>(key.getHash());
+    }
+    EXPECT_LT(0U, numLocal);
+    EXPECT_GT(6U, numLocal);
+    // A hash that matches no object.
+    pKHashes.emplaceAppend<uint64_t>(0);
+
+    Buffer response;
+    uint32_t numHashesRead;
+    uint32_t numObjects;
+    service->readIndexedObjects(tableId, 7, &pKHashes, 0, &response,
+            &numHashesRead, &numObjects);
+    EXPECT_EQ(7U, numHashesRead);
+    EXPECT_EQ(6U, numObjects);
+
+    // The objects come back in the order of the hashes.
+    uint32_t offset = 0;
+    for (int i = 0; i < 6; i++) {
+        offset += sizeof32(uint64_t);
+        uint32_t length = *response.getOffset<uint32_t>(offset);
+        offset += sizeof32(uint32_t);
+        Object object(tableId, 1, 0, response, offset, length);
+        offset += length;
+        EXPECT_EQ(format("key%d", i), string(
+                reinterpret_cast<const char*>(object.getKey()),
+                object.getKeyLength()));
+    }
+    EXPECT_EQ(offset, response.size());
+
+    // Nothing fits in the response; the client reads the objects itself.
+    service->maxResponseRpcLen = 1;
+    response.reset();
+    service->readIndexedObjects(tableId, 7, &pKHashes, 0, &response,
+            &numHashesRead, &numObjects);
+    EXPECT_EQ(0U, numHashesRead);
+    EXPECT_EQ(0U, numObjects);
+    EXPECT_EQ(0U, response.size());
+}
+
 TEST_F(MasterServiceTest, read_basics) {
     ramcloud->write(1, "0", 1, "abcdef", 6);
     Buffer value;
@@ -2609,7 +2817,7 @@ TEST_F(MasterServiceTest, splitAndMigrateIndexlet_moveData) {
             "migrateSingleIndexObject: Migrating an index entry. | "
             "splitAndMigrateIndexlet: Sending last migration segment | "
             "splitAndMigrateIndexlet: Sent 1 total objects, "
-            "1 total tombstones, 259 total bytes.",
+            "1 total tombstones, 130 total bytes.",
                     TestLog::get());
 }
 
@@ -4343,6 +4551,51 @@ TEST_F(MasterServiceTest, recover_basics) {
             ,  curPos, &curPos));
 }
 
+TEST_F(MasterServiceTest, recover_parallelReplay) {
+    ServerId serverId(123, 0);
+    ReplicaManager mgr(&context, &serverId, 1, false, false, false);
+    writeRecoverableSegment(&context, mgr, serverId, serverId.getId(), 87, 23U);
+    writeRecoverableSegment(&context, mgr, serverId, serverId.getId(), 88, 40U);
+    writeRecoverableSegment(&context, mgr, serverId, serverId.getId(), 89, 31U);
+
+    ProtoBuf::RecoveryPartition recoveryPartition;
+    createRecoveryPartition(recoveryPartition);
+    BackupClient::startReadingData(&context, backup1Id, 456lu, serverId);
+    BackupClient::StartPartitioningReplicas(&context, backup1Id, 456lu,
+            serverId, &recoveryPartition);
+
+    ServerConfig config = *service->config;
+    config.master.recoveryReplayThreads = 3;
+    const ServerConfig* oldConfig = service->config;
+    service->config = &config;
+    SegmentManager* segmentManager = &service->objectManager.segmentManager;
+    segmentManager->safeVersion = 1U;
+    metrics->master.recoveryReplayTicks = 0;
+
+    vector<MasterService::Replica> replicas {
+        {backup1Id.getId(), 87},
+        {backup1Id.getId(), 88},
+        {backup1Id.getId(), 89},
+    };
+    TestLog::Enable _("recover");
+    std::unordered_map<uint64_t, uint64_t> nextNodeIdMap;
+    service->recover(456lu, serverId, 0, replicas, nextNodeIdMap);
+    service->config = oldConfig;
+
+    typedef MasterService::Replica::State State;
+    foreach (auto& replica, replicas)
+        EXPECT_EQ(State::OK, replica.state);
+    EXPECT_EQ(40U, segmentManager->safeVersion);
+    EXPECT_EQ(3U, metrics->master.recoveryReplayThreads);
+    EXPECT_LT(0U, metrics->master.recoveryReplayTicks);
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+            "recover: Segment 87 replay complete", TestLog::get()));
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+            "recover: Segment 88 replay complete", TestLog::get()));
+    EXPECT_TRUE(TestUtil::matchesPosixRegex(
+            "recover: Segment 89 replay complete", TestLog::get()));
+}
+
 TEST_F(MasterServiceTest, recover_basic_indexlet) {
     cluster.coordinator->recoveryManager.start();
     ServerId serverId(123, 0);
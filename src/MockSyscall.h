@@ -42,7 +42,7 @@ class MockSyscall : public Syscall {
                     getsocknameErrno(0), ioctlErrno(0),
                     ioctlRetriesToSuccess(0), listenErrno(0), pipeErrno(0),
                     recvErrno(0), recvEof(false), recvfromErrno(0),
-                    recvfromEof(false), recvmmsgErrno(0),
+                    recvfromEof(false), recvmmsgErrno(0), recvmsgErrno(0),
                     sendmsgErrno(0), sendmsgReturnCount(-1),
                     sendtoErrno(0), sendtoReturnCount(-1), setsockoptErrno(0),
                     socketErrno(0), writeErrno(0) {}
@@ -255,6 +255,15 @@ class MockSyscall : public Syscall {
 
     }
 
+    int recvmsgErrno;
+    ssize_t recvmsg(int sockfd, msghdr *msg, int flags) {
+        if (recvmsgErrno == 0) {
+            return ::recvmsg(sockfd, msg, flags);
+        }
+        errno = recvmsgErrno;
+        return -1;
+    }
+
     int sendmsgErrno;
     int sendmsgReturnCount;
     ssize_t sendmsg(int sockfd, const msghdr *msg, int flags) {
@@ -54,6 +54,13 @@ enum { MAX_POOLED_BUFFERS = 128 };
  */
 enum { INIT_POOLED_BUFFERS = MAX_POOLED_BUFFERS };
 
+/**
+ * When IO goes through an io_uring, transfers are broken into pieces of at
+ * most this many bytes so that a single framelet keeps several operations
+ * outstanding on its device rather than just one.
+ */
+enum { RING_IO_CHUNK_BYTES = 256 * 1024 };
+
 // --- MultiFileStorage::Frame ---
 
 bool MultiFileStorage::Frame::testingSkipRealIo = false;
@@ -569,6 +576,35 @@ MultiFileStorage::unlockedRead(Frame::Lock& lock, void* buf, size_t frameIndex,
     lock.unlock();
     CycleCounter<RawMetric> _(&metrics->backup.storageReadTicks);
 
+    if (ringQueueDepth > 0) {
+        RingIo ios[fds.size()];
+        size_t frameletStart = offsetOfFramelet(frameIndex);
+        for (size_t fileIndex = 0; fileIndex < fds.size(); fileIndex++) {
+            size_t frameletSize = bytesInFramelet(fileIndex);
+            ios[fileIndex] = {fileIndex,
+                static_cast<char*>(buf) + (frameletSize * fileIndex),
+                frameletSize, downCast<off_t>(frameletStart), 0};
+        }
+        performRingIo(false, ios, fds.size());
+        for (size_t i = 0; i < fds.size(); i++) {
+            RingIo* io = &ios[i];
+            if (io->result < 0) {
+                DIE("Failed to read replica: %s, "
+                    "reading %lu bytes from backup file %lu at offset %lu.",
+                    strerror(downCast<int>(-io->result)), io->length, i,
+                    io->offset);
+            } else if (io->result != downCast<ssize_t>(io->length)) {
+                if (!usingDevNull)
+                    DIE("Failure performing asynchronous IO (short read: "
+                        "wanted %lu, got %lu at offset %lu in file %lu)",
+                        io->length, io->result, io->offset, i);
+            }
+        }
+        PerfStats::threadStats.backupReadActiveCycles += _.stop();
+        lock.lock();
+        return;
+    }
+
     // Use asynchronous IO to initiate concurrent IO operations on all of the
     // storage files to read the replica in parallel.
     // Keep one control block for each file.
@@ -648,6 +684,74 @@ MultiFileStorage::unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
     off_t frameletStart = offsetOfFramelet(frameIndex);
     off_t offsetInFramelet = offsetInFrame;
 
+    if (ringQueueDepth > 0) {
+        // One transfer per file, plus an extra (the last one) for metadata.
+        RingIo ios[fds.size() + 1];
+        size_t numIos = 0;
+        for (size_t fileIndex = 0; remaining > 0; fileIndex++) {
+            size_t frameletSize = bytesInFramelet(fileIndex);
+            if (static_cast<size_t>(offsetInFramelet) > frameletSize) {
+                // The offset that we want to write is past this framelet.
+                offsetInFramelet -= frameletSize;
+                continue;
+            }
+
+            size_t bytesToWrite = std::min(frameletSize - offsetInFramelet,
+                                           remaining);
+            ios[numIos++] = {fileIndex, buf, bytesToWrite,
+                             frameletStart + offsetInFramelet, 0};
+            remaining -= bytesToWrite;
+            buf = static_cast<char*>(buf) + bytesToWrite;
+            offsetInFramelet = 0;
+        }
+        ios[numIos++] = {0, metadataBuf, metadataCount,
+                         offsetOfFrameMetadata(frameIndex), 0};
+        performRingIo(true, ios, numIos);
+
+        for (size_t i = 0; i < numIos; i++) {
+            RingIo* io = &ios[i];
+            bool isMetadata = (i == numIos - 1);
+            if (io->result < 0) {
+                if (isMetadata)
+                    DIE("Failed to write metadata for replica: %s, "
+                        "writing %lu bytes to backup file 0 at offset %lu.",
+                        strerror(downCast<int>(-io->result)),
+                        io->length, io->offset);
+                else
+                    DIE("Failed to write replica: %s, "
+                        "writing %lu bytes to backup file %lu at offset %lu.",
+                        strerror(downCast<int>(-io->result)),
+                        io->length, io->fileIndex, io->offset);
+            } else if (io->result != downCast<ssize_t>(io->length)) {
+                if (isMetadata)
+                    DIE("Unexpectedly short write to metadata for replica, "
+                        "file 0 at offset %lu, "
+                        "expected length %lu, actual write length %lu",
+                        io->offset, io->length, io->result);
+                else
+                    DIE("Unexpectedly short write to replica, "
+                        "file %lu at offset %lu, "
+                        "expected length %lu, actual write length %lu",
+                        io->fileIndex, io->offset, io->length, io->result);
+            }
+        }
+        double elapsedSeconds = Cycles::toSeconds(Cycles::rdtsc() - start);
+        if (elapsedSeconds > 0.1) {
+            LOG(WARNING, "Slow write to replica storage: %.1f ms "
+                    "for %lu bytes", elapsedSeconds*1e03,
+                    count + metadataCount);
+        }
+
+        // Reduce our bandwidth (if so configured) by delaying this operation.
+        sleepToThrottleWrites(count + metadataCount, Cycles::rdtsc() - start);
+
+        uint64_t elapsed = Cycles::rdtsc() - start;
+        metrics->backup.storageWriteTicks += elapsed;
+        PerfStats::threadStats.backupWriteActiveCycles += elapsed;
+        lock.lock();
+        return;
+    }
+
     // Use asynchronous IO to initiate concurrent IO operations on all of the
     // storage files to read the replica in parallel.
     // Keep one control block for each file, plus an extra (the last one) for
@@ -733,6 +837,147 @@ MultiFileStorage::unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
     lock.lock();
 }
 
+/**
+ * Issue a batch of transfers through an io_uring and wait for all of them
+ * to finish. The ring is used exclusively by this call, so concurrent
+ * calls proceed in parallel. Each transfer is split into pieces of at
+ * most RING_IO_CHUNK_BYTES and as many pieces as the ring's queue depth
+ * allows are kept outstanding at once, across all of the files involved.
+ * Errors are not fatal here; they are reported through RingIo::result so
+ * that callers can describe the failure in their own terms.
+ *
+ * \param isWrite
+ *      True to write each transfer's buffer to storage; false to read into
+ *      it.
+ * \param ios
+ *      Transfers to perform. The result field of each is filled in on
+ *      return.
+ * \param count
+ *      Number of entries in \a ios.
+ */
+void
+MultiFileStorage::performRingIo(bool isWrite, RingIo* ios, size_t count)
+{
+    IoUring* ring = acquireRing();
+
+    // Each operation is tagged with the index of the transfer it belongs
+    // to so that its outcome can be folded into that transfer's result.
+    auto reap = [&] {
+        IoUring::Completion completion = ring->waitForCompletion();
+        RingIo* io = &ios[completion.userData];
+        if (io->result < 0)
+            return;
+        if (completion.result < 0)
+            io->result = completion.result;
+        else
+            io->result += completion.result;
+    };
+
+    try {
+        for (size_t i = 0; i < count; i++) {
+            RingIo* io = &ios[i];
+            io->result = 0;
+            for (size_t done = 0; done < io->length;
+                    done += RING_IO_CHUNK_BYTES) {
+                uint32_t length = downCast<uint32_t>(
+                        std::min<size_t>(RING_IO_CHUNK_BYTES,
+                                         io->length - done));
+                char* buf = static_cast<char*>(io->buf) + done;
+                uint64_t offset = io->offset + done;
+                while (ring->getFreeSlots() == 0)
+                    reap();
+                if (isWrite) {
+                    ring->prepareWrite(fds[io->fileIndex], buf, length,
+                                       offset, i);
+                } else {
+                    ring->prepareRead(fds[io->fileIndex], buf, length,
+                                      offset, i);
+                }
+            }
+        }
+        while (ring->getOutstanding() > 0)
+            reap();
+    } catch (const IoUringException& e) {
+        DIE("Failure performing backup storage IO through io_uring: %s",
+            e.what());
+    }
+    releaseRing(ring);
+}
+
+/**
+ * Create another ring with the same queue depth and registered buffers as
+ * the others and add it to #rings. The caller must hold #ringMutex.
+ *
+ * \throw IoUringException
+ *      The ring couldn't be created.
+ */
+IoUring*
+MultiFileStorage::createRing()
+{
+    std::unique_ptr<IoUring> ring(new IoUring(ringQueueDepth));
+    if (!registeredBuffers.empty()) {
+        try {
+            ring->registerBuffers(registeredBuffers);
+        } catch (const IoUringException& e) {
+            LOG(WARNING, "Couldn't register replica buffers with an "
+                "additional io_uring (%s); it will do without", e.what());
+        }
+    }
+    rings.push_back(std::move(ring));
+    return rings.back().get();
+}
+
+/**
+ * Take a ring for the exclusive use of the caller, creating a new one if
+ * all are in use. If no more rings can be created, wait for one to be
+ * returned with releaseRing().
+ */
+IoUring*
+MultiFileStorage::acquireRing()
+{
+    std::unique_lock<std::mutex> lock(ringMutex);
+    while (idleRings.empty()) {
+        if (ringCreationFailed) {
+            ringIdle.wait(lock);
+            continue;
+        }
+        try {
+            idleRings.push_back(createRing());
+        } catch (const IoUringException& e) {
+            LOG(WARNING, "Couldn't create another io_uring for backup "
+                "storage (%s); sharing the existing %lu", e.what(),
+                rings.size());
+            ringCreationFailed = true;
+        }
+    }
+    IoUring* ring = idleRings.back();
+    idleRings.pop_back();
+    return ring;
+}
+
+/**
+ * Return a ring obtained from acquireRing(). It must have no outstanding
+ * operations.
+ */
+void
+MultiFileStorage::releaseRing(IoUring* ring)
+{
+    std::lock_guard<std::mutex> _(ringMutex);
+    idleRings.push_back(ring);
+    ringIdle.notify_one();
+}
+
+/**
+ * Return true if \a buffer was carved out of #bufferSlab.
+ */
+bool
+MultiFileStorage::isSlabBuffer(void* buffer) const
+{
+    char* p = static_cast<char*>(buffer);
+    return bufferSlab != NULL && p >= bufferSlab &&
+           p < bufferSlab + bufferSlabBytes;
+}
+
 namespace {
 /**
  * Round \a offset down to a block boundary.
@@ -888,7 +1133,8 @@ void
 MultiFileStorage::BufferDeleter::operator()(void* buffer)
 {
     if (buffer) {
-        if (storage->buffers.size() >= MAX_POOLED_BUFFERS) {
+        if (storage->buffers.size() >= MAX_POOLED_BUFFERS &&
+                !storage->isSlabBuffer(buffer)) {
             std::free(buffer);
         } else {
             storage->buffers.push(buffer);
@@ -920,13 +1166,19 @@ MultiFileStorage::BufferDeleter::operator()(void* buffer)
  * \param openFlags
  *      Extra flags for use while opening files in filePathsStr (default to 0,
  *      O_DIRECT may be used to disable the OS buffer cache.
+ * \param ioQueueDepth
+ *      If non-0, issue storage IO through an io_uring which keeps up to this
+ *      many operations outstanding, and register the pooled replica buffers
+ *      with it. If 0, or if the kernel doesn't support io_uring, POSIX AIO
+ *      is used instead.
  */
 MultiFileStorage::MultiFileStorage(size_t segmentSize,
                                    size_t frameCount,
                                    size_t writeRateLimit,
                                    size_t maxWriteBuffers,
                                    const char* filePathsStr,
-                                   int openFlags)
+                                   int openFlags,
+                                   uint32_t ioQueueDepth)
     : BackupStorage(segmentSize, Type::DISK, writeRateLimit)
     , mutex()
     , ioQueue()
@@ -943,6 +1195,15 @@ MultiFileStorage::MultiFileStorage(size_t segmentSize,
     , maxWriteBuffers(maxWriteBuffers)
     , bufferDeleter(this)
     , buffers()
+    , ringQueueDepth(0)
+    , rings()
+    , idleRings()
+    , ringMutex()
+    , ringIdle()
+    , ringCreationFailed(false)
+    , registeredBuffers()
+    , bufferSlab(NULL)
+    , bufferSlabBytes(0)
 {
     assert(filePathsStr);
 
@@ -1005,7 +1266,39 @@ MultiFileStorage::MultiFileStorage(size_t segmentSize,
     // 1.75 ms.
     std::free(Memory::xmemalign(HERE, BUFFER_ALIGNMENT, segmentSize));
 
-    { // Pre-fill the buffer pool.
+    if (ioQueueDepth > 0) {
+        try {
+            rings.emplace_back(new IoUring(ioQueueDepth));
+            idleRings.push_back(rings.back().get());
+            ringQueueDepth = ioQueueDepth;
+        } catch (const IoUringException& e) {
+            LOG(WARNING, "Couldn't create an io_uring for backup storage "
+                "(%s); falling back to POSIX AIO", e.what());
+        }
+    }
+
+    if (ringQueueDepth > 0) {
+        // Carve the initial pool out of one allocation and register it with
+        // the ring, so the kernel pins these pages once rather than on
+        // every read and write. Rings created later register it too.
+        size_t bufferBytes = segmentSize + METADATA_SIZE;
+        bufferSlabBytes = bufferBytes * INIT_POOLED_BUFFERS;
+        bufferSlab = static_cast<char*>(Memory::xmemalign(HERE,
+                BUFFER_ALIGNMENT, bufferSlabBytes));
+        std::vector<struct iovec> iovecs;
+        for (int i = INIT_POOLED_BUFFERS - 1; i >= 0; --i) {
+            char* buffer = bufferSlab + i * bufferBytes;
+            buffers.push(buffer);
+            iovecs.push_back({buffer, bufferBytes});
+        }
+        try {
+            rings[0]->registerBuffers(iovecs);
+            registeredBuffers = iovecs;
+        } catch (const IoUringException& e) {
+            LOG(WARNING, "Couldn't register replica buffers with io_uring "
+                "(%s); continuing without registered buffers", e.what());
+        }
+    } else { // Pre-fill the buffer pool.
         std::vector<BufferPtr> buffers;
         for (int i = 0; i < INIT_POOLED_BUFFERS; ++i)
             buffers.emplace_back(allocateBuffer());
@@ -1033,9 +1326,15 @@ MultiFileStorage::~MultiFileStorage()
     }
 
     while (!buffers.empty()) {
-        std::free(buffers.top());
+        if (!isSlabBuffer(buffers.top()))
+            std::free(buffers.top());
         buffers.pop();
     }
+
+    // The rings must go before the slab they have registered.
+    idleRings.clear();
+    rings.clear();
+    std::free(bufferSlab);
 }
 
 /**
@@ -1119,11 +1418,31 @@ MultiFileStorage::open(bool sync, ServerId masterId, uint64_t segmentId)
  * the segment frames that may have been used during benchmarking.
  * This allows benchmark to be called without
  * wasting early segment frames on the disk which may be faster.
+ * The log also records which IO engine produced the measurements, along
+ * with the aggregate throughput of the benchmark's loads.
  */
 uint32_t
 MultiFileStorage::benchmark(BackupStrategy backupStrategy)
 {
+    if (ringQueueDepth > 0) {
+        std::lock_guard<std::mutex> _(ringMutex);
+        LOG(NOTICE, "Benchmarking backup storage IO through io_uring "
+            "(queue depth %u, %lu registered buffers)", ringQueueDepth,
+            registeredBuffers.size());
+    } else {
+        LOG(NOTICE, "Benchmarking backup storage IO through POSIX AIO");
+    }
+    uint64_t loadTicksBefore = metrics->backup.storageReadTicks;
+    uint64_t loadBytesBefore = metrics->backup.storageReadBytes;
     uint32_t r = BackupStorage::benchmark(backupStrategy);
+    uint64_t loadNs = Cycles::toNanoseconds(
+            metrics->backup.storageReadTicks - loadTicksBefore);
+    uint64_t loadBytes = metrics->backup.storageReadBytes - loadBytesBefore;
+    if (loadNs > 0) {
+        LOG(NOTICE, "Backup storage benchmark loaded %lu MB in %lu us "
+            "(%lu MB/s)", loadBytes >> 20, loadNs / 1000,
+            (loadBytes >> 20) * 1000 * 1000 * 1000 / loadNs);
+    }
     lastAllocatedFrame = FreeMap::npos;
     return r;
 }
@@ -1159,8 +1478,34 @@ MultiFileStorage::loadAllMetadata()
 {
     std::vector<FrameRef> ret;
     ret.reserve(frames.size());
+
+    // With a ring, read every frame's metadata block in one batch rather
+    // than with one synchronous read per frame.
+    bool metadataLoaded = false;
+    if (ringQueueDepth > 0) {
+        std::vector<RingIo> ios;
+        ios.reserve(frames.size());
+        foreach (Frame& frame, frames) {
+            ios.push_back({0, frame.appendedMetadata.get(), METADATA_SIZE,
+                           offsetOfFrameMetadata(frame.frameIndex), 0});
+        }
+        performRingIo(false, &ios[0], ios.size());
+        foreach (const RingIo& io, ios) {
+            if (io.result < 0) {
+                DIE("Failed to read metadata stored at offset %lu: %s, "
+                    "length %d", io.offset,
+                    strerror(downCast<int>(-io.result)), METADATA_SIZE);
+            } else if (io.result != METADATA_SIZE) {
+                DIE("Failed to read metadata stored at offset %lu: reached "
+                    "end of file, length %d", io.offset, METADATA_SIZE);
+            }
+        }
+        metadataLoaded = true;
+    }
+
     foreach (Frame& frame, frames) {
-        frame.loadMetadata();
+        if (!metadataLoaded)
+            frame.loadMetadata();
         assert(freeMap[frame.frameIndex] == 1);
         freeMap[frame.frameIndex] = 0;
 
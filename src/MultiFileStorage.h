@@ -16,10 +16,13 @@
 #ifndef RAMCLOUD_MULTIFILESTORAGE_H
 #define RAMCLOUD_MULTIFILESTORAGE_H
 
+#include <condition_variable>
+#include <memory>
 #include <stack>
 
 #include "Common.h"
 #include "BackupStorage.h"
+#include "IoUring.h"
 #include "PriorityTaskQueue.h"
 
 namespace RAMCloud {
@@ -228,7 +231,8 @@ class MultiFileStorage : public BackupStorage {
                      size_t writeRateLimit,
                      size_t maxNonVolatileBuffers,
                      const char* filePaths,
-                     int openFlags = 0);
+                     int openFlags = 0,
+                     uint32_t ioQueueDepth = 0);
     ~MultiFileStorage();
 
     FrameRef open(bool sync, ServerId masterId, uint64_t segmentId);
@@ -260,6 +264,30 @@ class MultiFileStorage : public BackupStorage {
     enum { METADATA_SIZE = BLOCK_SIZE };
 
   PRIVATE:
+    /**
+     * Describes one contiguous transfer between memory and a storage file
+     * issued through performRingIo().
+     */
+    struct RingIo {
+        /// Index into #fds of the file to transfer to or from.
+        size_t fileIndex;
+
+        /// Memory to transfer to or from.
+        void* buf;
+
+        /// Number of bytes to transfer.
+        size_t length;
+
+        /// Offset in the file where the transfer starts.
+        off_t offset;
+
+        /**
+         * Set by performRingIo() to the number of bytes transferred, or to
+         * a negated errno value if any part of the transfer failed.
+         */
+        ssize_t result;
+    };
+
     size_t bytesInFramelet(size_t fileIndex) const;
     off_t offsetOfFramelet(size_t frameIndex) const;
     off_t offsetOfFrameMetadata(size_t frameIndex) const;
@@ -269,6 +297,11 @@ class MultiFileStorage : public BackupStorage {
     void unlockedWrite(Frame::Lock& lock, void* buf, size_t count,
                        size_t frameIndex, off_t offsetInFrame,
                        void* metadataBuf, size_t metadataCount);
+    void performRingIo(bool isWrite, RingIo* ios, size_t count);
+    IoUring* createRing();
+    IoUring* acquireRing();
+    void releaseRing(IoUring* ring);
+    bool isSlabBuffer(void* buffer) const;
 
     void reserveSpace(int fd);
     Tub<Superblock> tryLoadSuperblock(uint32_t superblockFrame);
@@ -359,6 +392,58 @@ class MultiFileStorage : public BackupStorage {
      */
     std::stack<void*, std::vector<void*>> buffers;
 
+    /**
+     * Queue depth of each ring in #rings. If 0, storage IO is issued
+     * through POSIX AIO rather than io_uring; see the ioQueueDepth
+     * constructor argument. Never changes after construction.
+     */
+    uint32_t ringQueueDepth;
+
+    /**
+     * Every io_uring created for storage IO. A ring isn't thread-safe, so
+     * performRingIo() takes one out of #idleRings for the length of each
+     * batch, creating another if none is idle. Threads doing IO at the
+     * same time therefore never wait for one another.
+     */
+    std::vector<std::unique_ptr<IoUring>> rings;
+
+    /// The rings in #rings that no performRingIo() call is using.
+    std::vector<IoUring*> idleRings;
+
+    /**
+     * Protects #rings, #idleRings and #ringCreationFailed. Only held while
+     * a ring is taken or returned, never while IO is outstanding.
+     */
+    std::mutex ringMutex;
+
+    /// Notified whenever a ring is returned to #idleRings.
+    std::condition_variable ringIdle;
+
+    /**
+     * Set once creating a ring fails (for example because of the
+     * io_uring instance limit); from then on threads wait for an idle
+     * ring rather than trying to create more.
+     */
+    bool ringCreationFailed;
+
+    /**
+     * The buffers (carved from #bufferSlab) registered with every ring in
+     * #rings; empty if registration was refused.
+     */
+    std::vector<struct iovec> registeredBuffers;
+
+    /**
+     * When #rings are in use the initial pool of buffers is carved out of
+     * this single allocation, which is registered with each ring so the
+     * kernel needn't pin their pages on every IO. Buffers from the slab
+     * are always returned to #buffers rather than to the OS. NULL if
+     * #rings aren't in use.
+     */
+    char* bufferSlab;
+
+    /// Size in bytes of #bufferSlab.
+    size_t bufferSlabBytes;
+
     DISALLOW_COPY_AND_ASSIGN(MultiFileStorage);
 };
 
@@ -538,6 +538,111 @@ TEST_F(MultiFileStorageTest, unlockedWriteMiddleOfSegment) {
     }
 }
 
+TEST_F(MultiFileStorageTest, unlockedWriteIoUring) {
+    // This test also implicitly tests unlockedRead and loadAllMetadata.
+    storage2.destroy();
+    std::string twoFiles = std::string(filePath21) + "," + filePath22;
+    storage2.construct(segmentSize, segmentFrames, 0, segmentFrames,
+                       twoFiles.c_str(), O_DIRECT | O_SYNC, 4);
+    if (storage2->ringQueueDepth == 0) {
+        // The kernel running the tests doesn't support io_uring.
+        return;
+    }
+    EXPECT_TRUE(storage2->isSlabBuffer(storage2->buffers.top()));
+
+    Memory::unique_ptr_free data(
+        Memory::xmemalign(HERE, getpagesize(), segmentSize),
+        std::free);
+    memset(data.get(), 'x', segmentSize - 1);
+    static_cast<char*>(data.get())[segmentSize - 1] = '\0';
+
+    size_t metadataLen = storage2->getMetadataSize();
+    Memory::unique_ptr_free metadata(
+        Memory::xmemalign(HERE, getpagesize(), metadataLen),
+        std::free);
+    memset(metadata.get(), 'y', metadataLen - 1);
+    static_cast<char*>(metadata.get())[metadataLen - 1] = '\0';
+
+    Buffer source;
+    source.appendExternal(data.get(), segmentSize);
+
+    Frame::testingSkipRealIo = false;
+
+    BackupStorage::FrameRef frameRef = storage2->open(false, ServerId(), 0);
+    Frame* frame = static_cast<Frame*>(frameRef.get());
+    frame->append(source, 0, segmentSize, 0, metadata.get(), metadataLen);
+    while (!frame->isSynced());
+
+    // Force a read from disk.
+    frame->buffer.reset();
+    {
+        Frame::Lock lock(frame->storage->mutex);
+        frame->loadRequested = true;
+        frame->performRead(lock);
+    }
+    char* replica = bytes(frame->load());
+    EXPECT_STREQ(bytes(data.get()), replica);
+    frame->free();
+
+    auto frames = storage2->loadAllMetadata();
+    EXPECT_STREQ(bytes(metadata.get()),
+                 bytes(const_cast<void*>(frames[0]->getMetadata())));
+    EXPECT_EQ(storage2->frames.size(), frames.size());
+}
+
+TEST_F(MultiFileStorageTest, acquireRing) {
+    storage2.destroy();
+    std::string twoFiles = std::string(filePath21) + "," + filePath22;
+    storage2.construct(segmentSize, segmentFrames, 0, segmentFrames,
+                       twoFiles.c_str(), 0, 4);
+    if (storage2->ringQueueDepth == 0) {
+        // The kernel running the tests doesn't support io_uring.
+        return;
+    }
+    EXPECT_EQ(1U, storage2->rings.size());
+
+    // Concurrent users each get a ring of their own.
+    IoUring* first = storage2->acquireRing();
+    EXPECT_EQ(storage2->rings[0].get(), first);
+    IoUring* second = storage2->acquireRing();
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2U, storage2->rings.size());
+    EXPECT_EQ(4U, second->getQueueDepth());
+    EXPECT_EQ(storage2->registeredBuffers.size(),
+              second->getNumRegisteredBuffers());
+
+    storage2->releaseRing(second);
+    storage2->releaseRing(first);
+    EXPECT_EQ(2U, storage2->idleRings.size());
+
+    // Idle rings are reused rather than new ones created.
+    EXPECT_EQ(first, storage2->acquireRing());
+    EXPECT_EQ(2U, storage2->rings.size());
+    storage2->releaseRing(first);
+}
+
+TEST_F(MultiFileStorageTest, acquireRing_creationFailed) {
+    storage2.destroy();
+    std::string twoFiles = std::string(filePath21) + "," + filePath22;
+    storage2.construct(segmentSize, segmentFrames, 0, segmentFrames,
+                       twoFiles.c_str(), 0, 4);
+    if (storage2->ringQueueDepth == 0)
+        return;
+
+    // Once no more rings can be created, callers wait for an idle one.
+    storage2->ringCreationFailed = true;
+    IoUring* ring = storage2->acquireRing();
+    IoUring* second = NULL;
+    std::thread thread([&] { second = storage2->acquireRing(); });
+    usleep(1000);
+    EXPECT_TRUE(second == NULL);
+    storage2->releaseRing(ring);
+    thread.join();
+    EXPECT_EQ(ring, second);
+    EXPECT_EQ(1U, storage2->rings.size());
+    storage2->releaseRing(second);
+}
+
 TEST_F(MultiFileStorageTest, Frame_performWrite) {
     storage1->ioQueue.halt();
     BackupStorage::FrameRef frameRef = storage1->open(false, ServerId(), 0);
@@ -752,6 +857,23 @@ TEST_F(MultiFileStorageTest, loadAllMetadata) {
     EXPECT_EQ(storage1->frames.size(), frames.size());
 }
 
+TEST_F(MultiFileStorageTest, benchmark) {
+    // benchmark() needs 16 frames.
+    const char* path = "/tmp/ramcloud-backup-storage-test-delete-this-bench";
+    MultiFileStorage storage(segmentSize, 16, 0, 16, path, O_DIRECT | O_SYNC);
+    Frame::testingSkipRealIo = false;
+    TestLog::Enable _("benchmark");
+    EXPECT_EQ(100u, storage.benchmark(EVEN_DISTRIBUTION));
+    EXPECT_TRUE(TestLog::get().find(
+        "benchmark: Benchmarking backup storage IO through") == 0);
+    EXPECT_NE(string::npos, TestLog::get().find(
+        "benchmark: Backup storage replica load latency: "));
+    EXPECT_NE(string::npos, TestLog::get().find(
+        "benchmark: Backup storage benchmark loaded "));
+    EXPECT_EQ(MultiFileStorage::FreeMap::npos, storage.lastAllocatedFrame);
+    unlink(path);
+}
+
 TEST_F(MultiFileStorageTest, resetSuperblock) {
     for (uint32_t expectedVersion = 1; expectedVersion < 3; ++expectedVersion) {
         storage1->resetSuperblock({9999, expectedVersion}, "hasso");
@@ -41,9 +41,22 @@ MultiRead::MultiRead(RamCloud* ramcloud,
         : MultiOp(ramcloud, type,
                   reinterpret_cast<MultiOpObject* const *>(requests),
                   numRequests)
+        , nearCache(ramcloud->nearCache)
+        , metrics(&ramcloud->clientMetrics)
+        , cachedEntries()
 {
     for (uint32_t i = 0; i < numRequests; i++) {
         requests[i]->value->destroy();
+        if (nearCache != NULL && requests[i]->rejectRules == NULL) {
+            NearCache::EntryRef entry = nearCache->lookup(
+                    requests[i]->tableId, requests[i]->key,
+                    requests[i]->keyLength);
+            // Entries cached by RamCloud::read lack the object's keys,
+            // so they can't be used to fill in an ObjectBuffer.
+            if (entry && entry->keysIncluded) {
+                cachedEntries[requests[i]] = entry;
+            }
+        }
     }
 
     startRpcs();
@@ -63,13 +76,19 @@ void
 MultiRead::appendRequest(MultiOpObject* request, Buffer* buf)
 {
     MultiReadObject* req = reinterpret_cast<MultiReadObject*>(request);
+    RejectRules rejectRules = req->rejectRules ? *req->rejectRules :
+                                                 defaultRejectRules;
+    auto cached = cachedEntries.find(req);
+    if (cached != cachedEntries.end()) {
+        // Only transfer the object if it has changed since it was cached.
+        rejectRules.givenVersion = cached->second->version;
+        rejectRules.versionLeGiven = 1;
+    }
 
     // Add the current object to the list of those being
     // fetched by this RPC.
     buf->emplaceAppend<WireFormat::MultiOp::Request::ReadPart>(
-            req->tableId, req->keyLength,
-            req->rejectRules ? *req->rejectRules :
-                               defaultRejectRules);
+            req->tableId, req->keyLength, rejectRules);
     buf->appendCopy(req->key, req->keyLength);
 }
 
@@ -110,6 +129,20 @@ MultiRead::readResponse(MultiOpObject* request,
     req->status = part->status;
     *respOffset += sizeof32(*part);
 
+    auto cached = cachedEntries.find(req);
+    if (cached != cachedEntries.end() &&
+            part->status == STATUS_WRONG_VERSION) {
+        // The cached copy is still current.
+        const NearCache::EntryRef& entry = cached->second;
+        req->status = STATUS_OK;
+        req->value->construct();
+        req->value->get()->appendCopy(entry->data.data(),
+                downCast<uint32_t>(entry->data.size()));
+        req->version = entry->version;
+        metrics->nearCacheHits++;
+        return false;
+    }
+
     if (part->status == STATUS_OK) {
         if (response->size() < *respOffset + part->length) {
             TEST_LOG("missing object data");
@@ -120,7 +153,20 @@ MultiRead::readResponse(MultiOpObject* request,
         void* data = req->value->get()->alloc(part->length);
         response->copy(*respOffset, part->length, data);
         req->version = part->version;
+        if (nearCache != NULL && req->rejectRules == NULL) {
+            if (cached != cachedEntries.end()) {
+                metrics->nearCacheStale++;
+            } else {
+                metrics->nearCacheMisses++;
+            }
+            nearCache->insert(req->tableId, req->key, req->keyLength,
+                    part->version, true, response, *respOffset,
+                    part->length);
+        }
         *respOffset += part->length;
+    } else if (part->status == STATUS_OBJECT_DOESNT_EXIST &&
+            nearCache != NULL && req->rejectRules == NULL) {
+        nearCache->remove(req->tableId, req->key, req->keyLength);
     }
 
     return false;
@@ -16,7 +16,10 @@
 #ifndef RAMCLOUD_MULTIREAD_H
 #define RAMCLOUD_MULTIREAD_H
 
+#include <unordered_map>
+
 #include "MultiOp.h"
+#include "NearCache.h"
 
 namespace RAMCloud {
 
@@ -41,6 +44,19 @@ class MultiRead : public MultiOp {
     bool readResponse(MultiOpObject* request, Buffer* response,
                       uint32_t* respOffset);
 
+  PRIVATE:
+    /// The client's near cache, or NULL if it is disabled.
+    NearCache* nearCache;
+
+    /// Hit and miss counts for the near cache are recorded here.
+    ClientMetrics* metrics;
+
+    /// Requests for which the near cache held a copy of the object when
+    /// this operation started, and that copy. The master only returns
+    /// data for these if it has changed.
+    std::unordered_map<const MultiOpObject*, NearCache::EntryRef>
+            cachedEntries;
+
     DISALLOW_COPY_AND_ASSIGN(MultiRead);
 };
 
@@ -247,6 +247,35 @@ TEST_F(MultiReadTest, rejectRules_end_to_end) {
                     statusToSymbol(objects[5].status));
 }
 
+TEST_F(MultiReadTest, nearCache) {
+    ramcloud->enableNearCache(10000);
+    MultiReadObject* requests[] = {&objects[0], &objects[1]};
+    MultiRead request(ramcloud.get(), requests, 2);
+    request.wait();
+    EXPECT_EQ(2U, ramcloud->getClientMetrics().nearCacheMisses);
+
+    ramcloud->write(tableId1, "object1-2", 9, "new:1-2");
+    MultiRead request2(ramcloud.get(), requests, 2);
+    request2.wait();
+    EXPECT_EQ(1U, ramcloud->getClientMetrics().nearCacheHits);
+    EXPECT_EQ(1U, ramcloud->getClientMetrics().nearCacheStale);
+    EXPECT_STREQ("STATUS_OK", statusToSymbol(objects[0].status));
+    EXPECT_EQ("value:1-1", string(reinterpret_cast<const char*>(
+                           bufferString(values[0])), 9));
+    EXPECT_EQ("object1-1", string(reinterpret_cast<const char*>(
+                           values[0].get()->getKey()), 9));
+    EXPECT_EQ(1U, objects[0].version);
+    EXPECT_STREQ("STATUS_OK", statusToSymbol(objects[1].status));
+    EXPECT_EQ("new:1-2", string(reinterpret_cast<const char*>(
+                         bufferString(values[1])), 7));
+
+    // Entries cached by multiRead also serve RamCloud::read.
+    Buffer value;
+    ramcloud->read(tableId1, "object1-1", 9, &value);
+    EXPECT_EQ("value:1-1", TestUtil::toString(&value));
+    EXPECT_EQ(2U, ramcloud->getClientMetrics().nearCacheHits);
+}
+
 TEST_F(MultiReadTest, appendRequest) {
     MultiReadObject* requests[] = {&objects[0]};
     uint32_t dif, before;
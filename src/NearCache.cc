@@ -0,0 +1,163 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "NearCache.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty NearCache.
+ *
+ * \param capacityBytes
+ *      The cache will discard least recently used objects to keep the
+ *      total size of their keys and data below this many bytes.
+ * \param metrics
+ *      Hit and miss counts are recorded here by the cache's users; the
+ *      cache itself maintains the eviction count and size.
+ */
+NearCache::NearCache(uint64_t capacityBytes, ClientMetrics* metrics)
+    : capacityBytes(capacityBytes)
+    , metrics(metrics)
+    , lru()
+    , map()
+{
+}
+
+NearCache::~NearCache()
+{
+    metrics->nearCacheBytes = 0;
+}
+
+/**
+ * Return the cached copy of an object, if there is one.
+ *
+ * \param tableId
+ *      Table containing the object.
+ * \param key
+ *      Primary key of the object.
+ * \param keyLength
+ *      Size in bytes of key.
+ * \return
+ *      The cached entry, or an empty reference if the object isn't cached.
+ *      Caching is advisory: the caller must confirm with the master that
+ *      the entry's version is current before using its data.
+ */
+NearCache::EntryRef
+NearCache::lookup(uint64_t tableId, const void* key, uint16_t keyLength)
+{
+    auto it = map.find(makeKey(tableId, key, keyLength));
+    if (it == map.end()) {
+        return EntryRef();
+    }
+    lru.splice(lru.begin(), lru, it->second.lruPosition);
+    return it->second.entry;
+}
+
+/**
+ * Add an object to the cache, replacing any existing entry for it and
+ * evicting older objects as needed to make room.
+ *
+ * \param tableId
+ *      Table containing the object.
+ * \param key
+ *      Primary key of the object.
+ * \param keyLength
+ *      Size in bytes of key.
+ * \param version
+ *      Version of the object whose contents are being cached.
+ * \param keysIncluded
+ *      True means the data includes the object's keys; see
+ *      Entry::keysIncluded.
+ * \param buffer
+ *      Holds the object's contents.
+ * \param offset
+ *      Offset within buffer of the first byte of the contents.
+ * \param length
+ *      Number of bytes of contents.
+ */
+void
+NearCache::insert(uint64_t tableId, const void* key, uint16_t keyLength,
+        uint64_t version, bool keysIncluded, Buffer* buffer,
+        uint32_t offset, uint32_t length)
+{
+    remove(tableId, key, keyLength);
+    if (keyLength + length > capacityBytes) {
+        return;
+    }
+    string data;
+    data.resize(length);
+    buffer->copy(offset, length, &data[0]);
+    CacheKey cacheKey = makeKey(tableId, key, keyLength);
+    lru.push_front(cacheKey);
+    Slot& slot = map[cacheKey];
+    slot.lruPosition = lru.begin();
+    slot.entry = std::make_shared<const Entry>(version, keysIncluded, data);
+    metrics->nearCacheBytes += keyLength + length;
+    evict();
+}
+
+/**
+ * Discard any cached copy of an object; for example, because it no longer
+ * exists.
+ *
+ * \param tableId
+ *      Table containing the object.
+ * \param key
+ *      Primary key of the object.
+ * \param keyLength
+ *      Size in bytes of key.
+ */
+void
+NearCache::remove(uint64_t tableId, const void* key, uint16_t keyLength)
+{
+    auto it = map.find(makeKey(tableId, key, keyLength));
+    if (it == map.end()) {
+        return;
+    }
+    metrics->nearCacheBytes -= keyLength + it->second.entry->data.size();
+    lru.erase(it->second.lruPosition);
+    map.erase(it);
+}
+
+/**
+ * Build the map key for an object.
+ */
+NearCache::CacheKey
+NearCache::makeKey(uint64_t tableId, const void* key, uint16_t keyLength)
+{
+    CacheKey cacheKey(reinterpret_cast<const char*>(&tableId),
+            sizeof(tableId));
+    cacheKey.append(static_cast<const char*>(key), keyLength);
+    return cacheKey;
+}
+
+/**
+ * Discard least recently used objects until the cache is within its
+ * capacity.
+ */
+void
+NearCache::evict()
+{
+    while (metrics->nearCacheBytes > capacityBytes) {
+        auto it = map.find(lru.back());
+        metrics->nearCacheBytes -= it->first.size() - sizeof(uint64_t) +
+                it->second.entry->data.size();
+        map.erase(it);
+        lru.pop_back();
+        metrics->nearCacheEvictions++;
+    }
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,111 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_NEARCACHE_H
+#define RAMCLOUD_NEARCACHE_H
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "Buffer.h"
+#include "ClientMetrics.h"
+
+namespace RAMCloud {
+
+/**
+ * A size-bounded, least-recently-used cache of objects read by a client,
+ * keyed by table and primary key. It allows ReadRpc and MultiRead to avoid
+ * transferring object data that the client already has: instead of a
+ * plain read they send a read that the master rejects (with
+ * STATUS_WRONG_VERSION, and no data) if the object's version hasn't
+ * advanced past the cached one. Every read still goes to the master, so
+ * cached data is never returned once it has been overwritten or deleted.
+ * Entries inserted by ReadRpc hold only the object's value, so MultiRead
+ * ignores them; entries inserted by MultiRead serve both.
+ *
+ * Like RamCloud objects, this class is not thread-safe.
+ */
+class NearCache {
+  public:
+    /**
+     * A cached object. Entries are immutable; an RPC holds a reference
+     * to the entry it is validating, so the data remains available even
+     * if the entry is evicted or replaced while the RPC is outstanding.
+     */
+    struct Entry {
+        Entry(uint64_t version, bool keysIncluded, const string& data)
+            : version(version)
+            , keysIncluded(keysIncluded)
+            , data(data)
+        {}
+
+        /// Version of the object when it was read.
+        const uint64_t version;
+
+        /// True means #data holds the object's keys and value in the
+        /// format returned by readKeysAndValue and multiRead; false means
+        /// it holds only the value (as returned by read).
+        const bool keysIncluded;
+
+        /// Contents of the object.
+        const string data;
+    };
+    typedef std::shared_ptr<const Entry> EntryRef;
+
+    NearCache(uint64_t capacityBytes, ClientMetrics* metrics);
+    ~NearCache();
+    EntryRef lookup(uint64_t tableId, const void* key, uint16_t keyLength);
+    void insert(uint64_t tableId, const void* key, uint16_t keyLength,
+            uint64_t version, bool keysIncluded, Buffer* buffer,
+            uint32_t offset, uint32_t length);
+    void remove(uint64_t tableId, const void* key, uint16_t keyLength);
+
+  PRIVATE:
+    /// Identifies a cached object: a table id followed by the object's
+    /// primary key.
+    typedef string CacheKey;
+
+    static CacheKey makeKey(uint64_t tableId, const void* key,
+            uint16_t keyLength);
+    void evict();
+
+    /// Position of an object in #lru, and its entry.
+    struct Slot {
+        Slot() : lruPosition(), entry() {}
+        std::list<CacheKey>::iterator lruPosition;
+        EntryRef entry;
+    };
+
+    /// Upper limit on the total size of cached data (keys and object
+    /// contents), in bytes.
+    const uint64_t capacityBytes;
+
+    /// Usage statistics are recorded here; its nearCacheBytes field is the
+    /// current size of the cache.
+    ClientMetrics* metrics;
+
+    /// Keys of all cached objects, most recently used first.
+    std::list<CacheKey> lru;
+
+    /// All cached objects.
+    std::unordered_map<CacheKey, Slot> map;
+
+    DISALLOW_COPY_AND_ASSIGN(NearCache);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_NEARCACHE_H
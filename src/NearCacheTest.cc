@@ -0,0 +1,97 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "NearCache.h"
+
+namespace RAMCloud {
+
+class NearCacheTest : public ::testing::Test {
+  public:
+    ClientMetrics metrics;
+    NearCache cache;
+    Buffer buffer;
+
+    NearCacheTest()
+        : metrics()
+        , cache(40, &metrics)
+        , buffer()
+    {
+        buffer.appendCopy("header:0123456789", 17);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(NearCacheTest);
+};
+
+TEST_F(NearCacheTest, lookup) {
+    EXPECT_FALSE(cache.lookup(1, "a", 1));
+    cache.insert(1, "a", 1, 5, false, &buffer, 7, 4);
+    EXPECT_FALSE(cache.lookup(2, "a", 1));
+    EXPECT_FALSE(cache.lookup(1, "ab", 2));
+    NearCache::EntryRef entry = cache.lookup(1, "a", 1);
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(5u, entry->version);
+    EXPECT_FALSE(entry->keysIncluded);
+    EXPECT_EQ("0123", entry->data);
+    EXPECT_EQ(5u, metrics.nearCacheBytes);
+}
+
+TEST_F(NearCacheTest, insert_replace) {
+    cache.insert(1, "a", 1, 5, false, &buffer, 7, 4);
+    NearCache::EntryRef old = cache.lookup(1, "a", 1);
+    cache.insert(1, "a", 1, 6, true, &buffer, 7, 10);
+    EXPECT_EQ(11u, metrics.nearCacheBytes);
+    EXPECT_EQ(6u, cache.lookup(1, "a", 1)->version);
+    EXPECT_EQ(1u, cache.map.size());
+
+    // References held by outstanding RPCs remain valid.
+    EXPECT_EQ("0123", old->data);
+}
+
+TEST_F(NearCacheTest, insert_tooLarge) {
+    cache.insert(1, "a", 1, 5, false, &buffer, 7, 4);
+    Buffer big;
+    TestUtil::fillLargeBuffer(&big, 100);
+    cache.insert(1, "a", 1, 6, false, &big, 0, 100);
+    EXPECT_FALSE(cache.lookup(1, "a", 1));
+    EXPECT_EQ(0u, metrics.nearCacheBytes);
+    EXPECT_EQ(0u, metrics.nearCacheEvictions);
+}
+
+TEST_F(NearCacheTest, insert_evictLeastRecentlyUsed) {
+    cache.insert(1, "a", 1, 1, false, &buffer, 7, 10);
+    cache.insert(1, "b", 1, 1, false, &buffer, 7, 10);
+    cache.insert(1, "c", 1, 1, false, &buffer, 7, 10);
+    EXPECT_EQ(33u, metrics.nearCacheBytes);
+    cache.lookup(1, "a", 1);
+    cache.insert(1, "d", 1, 1, false, &buffer, 7, 10);
+    EXPECT_EQ(1u, metrics.nearCacheEvictions);
+    EXPECT_EQ(33u, metrics.nearCacheBytes);
+    EXPECT_TRUE(cache.lookup(1, "a", 1));
+    EXPECT_FALSE(cache.lookup(1, "b", 1));
+    EXPECT_TRUE(cache.lookup(1, "c", 1));
+    EXPECT_TRUE(cache.lookup(1, "d", 1));
+}
+
+TEST_F(NearCacheTest, remove) {
+    cache.remove(1, "a", 1);
+    cache.insert(1, "a", 1, 5, false, &buffer, 7, 4);
+    cache.remove(1, "a", 1);
+    EXPECT_FALSE(cache.lookup(1, "a", 1));
+    EXPECT_EQ(0u, metrics.nearCacheBytes);
+    EXPECT_EQ(0u, cache.lru.size());
+}
+
+} // namespace RAMCloud
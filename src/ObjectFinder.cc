@@ -151,13 +151,24 @@ class RealTableConfigFetcher : public ObjectFinder::TableConfigFetcher {
  * Constructor.
  * \param context
  *      Overall information about this client.
+ * \param tableConfigFetcher
+ *      Source of table configurations; this object takes ownership of it.
+ *      NULL (the usual case) means fetch them from the coordinator. Others
+ *      are useful for benchmarks and tests.
  */
-ObjectFinder::ObjectFinder(Context* context)
+ObjectFinder::ObjectFinder(Context* context,
+                           TableConfigFetcher* tableConfigFetcher)
     : context(context)
     , mutex("ObjectFinder")
-    , tableConfigFetcher(new RealTableConfigFetcher(context))
+    , tableConfigFetcher(tableConfigFetcher != NULL ? tableConfigFetcher :
+                         new RealTableConfigFetcher(context))
     , tableIndexMap()
     , tableMap()
+    , flatTabletsVersion(0)
+    , flatTablets(NULL)
+    , numFlatTablets(0)
+    , flatTabletsCapacity(0)
+    , flatTabletArrays()
 {
 }
 
@@ -277,6 +288,12 @@ ObjectFinder::flushImpl(const SpinLock::Guard& guard, uint64_t tableId)
     TabletKey end {tableId, std::numeric_limits<KeyHash>::max()};
     TabletIter lower = tableMap.lower_bound(start);
     TabletIter upper = tableMap.upper_bound(end);
+    bool tabletsErased = (lower != upper);
+    if (tabletsErased) {
+        // Lock-free readers must stop using the flat array before the
+        // entries it points to are freed.
+        invalidateFlatTablets(guard);
+    }
     tableMap.erase(lower, upper);
 
     IndexletIter indexLower = tableIndexMap.lower_bound
@@ -284,6 +301,10 @@ ObjectFinder::flushImpl(const SpinLock::Guard& guard, uint64_t tableId)
     IndexletIter indexUpper = tableIndexMap.upper_bound(
             std::make_pair(tableId, std::numeric_limits<uint8_t>::max()));
     tableIndexMap.erase(indexLower, indexUpper);
+
+    if (tabletsErased) {
+        rebuildFlatTablets(guard);
+    }
 }
 
 /**
@@ -454,6 +475,120 @@ ObjectFinder::lookupTabletInCache(const SpinLock::Guard& guard,
     return NULL;
 }
 
+/**
+ * Find the tablet containing a key hash using only the flat array of
+ * NORMAL tablets, without acquiring the monitor lock.
+ *
+ * \param tableId
+ *      The table containing the desired object.
+ * \param keyHash
+ *      A hash value in the space of key hashes.
+ * \return
+ *      The tablet that owns the key hash, or NULL if there is no NORMAL
+ *      tablet for it in the array (or the array is being rebuilt); the
+ *      caller should then take the slow path through tableMap.
+ */
+TabletWithLocator*
+ObjectFinder::lookupTabletLockFree(uint64_t tableId, KeyHash keyHash)
+{
+    while (true) {
+        uint64_t version = flatTabletsVersion.load(std::memory_order_acquire);
+        if (version & 1) {
+            return NULL;
+        }
+        const FlatTablet* tablets =
+                flatTablets.load(std::memory_order_relaxed);
+        uint32_t count = numFlatTablets.load(std::memory_order_relaxed);
+
+        // Find the first tablet that starts after keyHash; the one before
+        // it is the only candidate. The loop body is branch-free so that
+        // its cost doesn't depend on branch prediction.
+        const FlatTablet* first = tablets;
+        while (count > 0) {
+            uint32_t half = count / 2;
+            const FlatTablet* middle = first + half;
+            bool before = (middle->tableId < tableId) ||
+                    (middle->tableId == tableId &&
+                    middle->startKeyHash <= keyHash);
+            first = before ? middle + 1 : first;
+            count = before ? count - half - 1 : half;
+        }
+        TabletWithLocator* result = NULL;
+        if (first != tablets) {
+            const FlatTablet* candidate = first - 1;
+            if (candidate->tableId == tableId &&
+                    keyHash <= candidate->endKeyHash) {
+                result = candidate->tablet;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (flatTabletsVersion.load(std::memory_order_relaxed) == version) {
+            return result;
+        }
+    }
+}
+
+/**
+ * Stop lock-free readers from using the flat array until the next call to
+ * rebuildFlatTablets. Must be invoked before removing entries from
+ * tableMap, since the array points at them.
+ *
+ * \param guard
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ */
+void
+ObjectFinder::invalidateFlatTablets(const SpinLock::Guard& guard)
+{
+    uint64_t version = flatTabletsVersion.load(std::memory_order_relaxed);
+    if (version & 1) {
+        return;
+    }
+    flatTabletsVersion.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * Regenerate the flat array used by lookupTabletLockFree from tableMap.
+ * Must be invoked whenever tableMap is modified.
+ *
+ * \param guard
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ */
+void
+ObjectFinder::rebuildFlatTablets(const SpinLock::Guard& guard)
+{
+    uint32_t count = 0;
+    for (auto& entry : tableMap) {
+        if (entry.second.tablet.status == Tablet::Status::NORMAL) {
+            count++;
+        }
+    }
+
+    invalidateFlatTablets(guard);
+    uint64_t version = flatTabletsVersion.load(std::memory_order_relaxed);
+
+    if (count > flatTabletsCapacity) {
+        flatTabletsCapacity = std::max(2 * flatTabletsCapacity, count);
+        flatTabletArrays.emplace_back(new FlatTablet[flatTabletsCapacity]);
+        flatTablets.store(flatTabletArrays.back().get(),
+                std::memory_order_relaxed);
+    }
+    FlatTablet* tablets = flatTablets.load(std::memory_order_relaxed);
+    uint32_t i = 0;
+    for (auto& entry : tableMap) {
+        const Tablet& tablet = entry.second.tablet;
+        if (tablet.status == Tablet::Status::NORMAL) {
+            tablets[i] = {tablet.tableId, tablet.startKeyHash,
+                          tablet.endKeyHash, &entry.second};
+            i++;
+        }
+    }
+    numFlatTablets.store(count, std::memory_order_relaxed);
+
+    flatTabletsVersion.store(version + 1, std::memory_order_release);
+}
+
 /**
  * This method deletes all cached information, restoring the object
  * to its original pristine state. It's used primarily to force cached
@@ -463,10 +598,12 @@ ObjectFinder::lookupTabletInCache(const SpinLock::Guard& guard,
  */
 void ObjectFinder::reset()
 {
-    SpinLock::Guard _(mutex);
+    SpinLock::Guard guard(mutex);
+    invalidateFlatTablets(guard);
     tableMap.clear();
     tableIndexMap.clear();
     tableConfigFetcher->clear();
+    rebuildFlatTablets(guard);
 }
 
 /**
@@ -613,6 +750,7 @@ ObjectFinder::tryLookupIndexlet(uint64_t tableId, uint8_t indexId,
                 tableId, &tableMap, &tableIndexMap)) {
             return NULL;
         }
+        rebuildFlatTablets(guard);
     } catch (TableDoesntExistException& e) {
         *indexDoesntExist = true;
         return NULL;
@@ -650,10 +788,17 @@ ObjectFinder::tryLookupIndexlet(uint64_t tableId, uint8_t indexId,
 TabletWithLocator*
 ObjectFinder::tryLookupTablet(uint64_t tableId, KeyHash keyHash)
 {
+    // Fast path: the tablet is known and available.
+    TabletWithLocator* tabletWithLocator =
+            lookupTabletLockFree(tableId, keyHash);
+    if (tabletWithLocator != NULL) {
+        return tabletWithLocator;
+    }
+
     SpinLock::Guard guard(mutex);
     // First lookup the tablet in our local cache
     TabletKey key{tableId, keyHash};
-    TabletWithLocator* tabletWithLocator = lookupTabletInCache(guard, &key);
+    tabletWithLocator = lookupTabletInCache(guard, &key);
     if (tabletWithLocator != NULL) {
         if (tabletWithLocator->tablet.status == Tablet::Status::NORMAL) {
             return tabletWithLocator;
@@ -671,6 +816,7 @@ ObjectFinder::tryLookupTablet(uint64_t tableId, KeyHash keyHash)
             tableId, &tableMap, &tableIndexMap)) {
         return NULL;
     }
+    rebuildFlatTablets(guard);
 
     // The response of our last RPC to the coordinator has come back; we can
     // finally throw a TableDoesntExistException for sure if needed
@@ -702,6 +848,7 @@ ObjectFinder::waitForTabletDown(uint64_t tableId)
                 tableId, &tableMap, &tableIndexMap)) {
             context->dispatch->poll();
         };
+        rebuildFlatTablets(guard);
         TabletKey start {tableId, 0U};
         TabletKey end {tableId, std::numeric_limits<KeyHash>::max()};
         TabletIter lower = tableMap.lower_bound(start);
@@ -736,6 +883,7 @@ ObjectFinder::waitForAllTabletsNormal(uint64_t tableId, uint64_t timeoutNs)
                 tableId, &tableMap, &tableIndexMap)) {
             context->dispatch->poll();
         };
+        rebuildFlatTablets(guard);
         TabletKey start {tableId, 0U};
         TabletKey end {tableId, std::numeric_limits<KeyHash>::max()};
         TabletIter lower = tableMap.lower_bound(start);
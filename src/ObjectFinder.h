@@ -22,7 +22,9 @@
 #include <boost/function.hpp>
 #pragma GCC diagnostic pop
 
+#include <atomic>
 #include <map>
+#include <memory>
 
 #include "Common.h"
 #include "CoordinatorClient.h"
@@ -119,12 +121,20 @@ struct TabletWithLocator {
  * that can be used to communicate with the master that stores the object.
  * It retrieves configuration information from the coordinator and caches it.
  * This class is thread-safe.
+ *
+ * Clients with many threads and tables with thousands of tablets look up
+ * tablets constantly, but the configuration changes rarely. So in addition
+ * to tableMap, which is the authoritative cache and is only touched with
+ * the lock held, the tablets that are available for use are kept in a
+ * sorted flat array that lookups binary-search without taking any lock.
+ * The array is rebuilt whenever tableMap changes.
  */
 class ObjectFinder {
   public:
     class TableConfigFetcher; // forward declaration, see full declaration below
 
-    explicit ObjectFinder(Context* context);
+    explicit ObjectFinder(Context* context,
+                          TableConfigFetcher* tableConfigFetcher = NULL);
 
     /*
      * Used only for debug purposes. This function created a string
@@ -156,7 +166,22 @@ class ObjectFinder {
     void waitForAllTabletsNormal(uint64_t tableId, uint64_t timeoutNs = ~0lu);
 
   PRIVATE:
+    /**
+     * An element of the array used for lock-free lookups: the key hash
+     * range of one NORMAL tablet and its entry in tableMap.
+     */
+    struct FlatTablet {
+        uint64_t tableId;
+        KeyHash startKeyHash;
+        KeyHash endKeyHash;
+        TabletWithLocator* tablet;
+    };
+
     void flushImpl(const SpinLock::Guard& guard, uint64_t tableId);
+    TabletWithLocator* lookupTabletLockFree(uint64_t tableId,
+                                            KeyHash keyHash);
+    void invalidateFlatTablets(const SpinLock::Guard& guard);
+    void rebuildFlatTablets(const SpinLock::Guard& guard);
 
     IndexletWithLocator* lookupIndexletInCache(const SpinLock::Guard& guard,
                                                uint64_t tableId,
@@ -210,6 +235,36 @@ class ObjectFinder {
     std::map<TabletKey, TabletWithLocator> tableMap;
     typedef std::map<TabletKey, TabletWithLocator>::iterator TabletIter;
 
+    /**
+     * Sequence number for the contents of flatTablets, in the style of
+     * a seqlock: odd from invalidateFlatTablets (or the start of
+     * rebuildFlatTablets) until rebuildFlatTablets finishes, which covers
+     * any removal of the tableMap entries they point to. Readers retry if
+     * it changes during their lookup.
+     */
+    std::atomic<uint64_t> flatTabletsVersion;
+
+    /**
+     * All NORMAL tablets in tableMap, sorted by table id and start key
+     * hash. Points into flatTabletArrays.
+     */
+    std::atomic<FlatTablet*> flatTablets;
+
+    /// Number of valid entries in flatTablets.
+    std::atomic<uint32_t> numFlatTablets;
+
+    /// Number of entries that fit in flatTablets.
+    uint32_t flatTabletsCapacity;
+
+    /**
+     * Every array ever used for flatTablets. A lock-free reader may still
+     * be searching an array after it has been replaced by a larger one, so
+     * arrays are only freed when this object is destroyed; since each is
+     * at least twice the size of the previous one, this wastes at most as
+     * much memory as the current array uses.
+     */
+    std::vector<std::unique_ptr<FlatTablet[]>> flatTabletArrays;
+
     DISALLOW_COPY_AND_ASSIGN(ObjectFinder);
 };
 
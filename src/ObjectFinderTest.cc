@@ -248,6 +248,73 @@ TEST_F(ObjectFinderTest, lookupTabletInCache) {
     EXPECT_TRUE(tabletWithLocator == NULL);
 }
 
+TEST_F(ObjectFinderTest, lookupTabletLockFree) {
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(2, 0) == NULL);
+
+    // Fetch the configuration; table 1's tablet is still RECOVERING the
+    // first time, so it mustn't be found without the lock.
+    EXPECT_TRUE(objectFinder->tryLookupTablet(2, 0) != NULL);
+    EXPECT_EQ(6U, objectFinder->numFlatTablets.load());
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(1, 0) == NULL);
+
+    TabletWithLocator* tablet = objectFinder->lookupTabletLockFree(2, 1000);
+    ASSERT_TRUE(tablet != NULL);
+    EXPECT_EQ("mock:host=server6", tablet->serviceLocator);
+    tablet = objectFinder->lookupTabletLockFree(2, 999);
+    ASSERT_TRUE(tablet != NULL);
+    EXPECT_EQ("mock:host=server2", tablet->serviceLocator);
+    tablet = objectFinder->lookupTabletLockFree(5, ~0lu);
+    EXPECT_TRUE(tablet == NULL);
+
+    // Gap between tablets; before the first table; after the last.
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 5000) == NULL);
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(0, 5) == NULL);
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(6, 0) == NULL);
+
+    // Version is left even when rebuilding is done.
+    EXPECT_EQ(0U, objectFinder->flatTabletsVersion.load() & 1);
+}
+
+TEST_F(ObjectFinderTest, invalidateFlatTablets) {
+    EXPECT_TRUE(objectFinder->tryLookupTablet(2, 0) != NULL);
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 0) != NULL);
+    uint64_t version = objectFinder->flatTabletsVersion.load();
+
+    SpinLock::Guard guard(objectFinder->mutex);
+    objectFinder->invalidateFlatTablets(guard);
+    EXPECT_EQ(version + 1, objectFinder->flatTabletsVersion.load());
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 0) == NULL);
+
+    // A second call leaves the version odd.
+    objectFinder->invalidateFlatTablets(guard);
+    EXPECT_EQ(version + 1, objectFinder->flatTabletsVersion.load());
+
+    objectFinder->rebuildFlatTablets(guard);
+    EXPECT_EQ(version + 2, objectFinder->flatTabletsVersion.load());
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 0) != NULL);
+}
+
+TEST_F(ObjectFinderTest, rebuildFlatTablets) {
+    EXPECT_TRUE(objectFinder->tryLookupTablet(2, 0) != NULL);
+    EXPECT_EQ(6U, objectFinder->numFlatTablets.load());
+    EXPECT_EQ(1U, objectFinder->flatTabletArrays.size());
+
+    // Erasing and rebuilding happen within a single odd version.
+    uint64_t version = objectFinder->flatTabletsVersion.load();
+    objectFinder->flush(2);
+    EXPECT_EQ(version + 2, objectFinder->flatTabletsVersion.load());
+    EXPECT_EQ(4U, objectFinder->numFlatTablets.load());
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(2, 0) == NULL);
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 0) != NULL);
+
+    // Shrinking reuses the existing array.
+    EXPECT_EQ(1U, objectFinder->flatTabletArrays.size());
+
+    objectFinder->reset();
+    EXPECT_EQ(0U, objectFinder->numFlatTablets.load());
+    EXPECT_TRUE(objectFinder->lookupTabletLockFree(3, 0) == NULL);
+}
+
 TEST_F(ObjectFinderTest, lookupIndexletInCache) {
     reinterpret_cast<Refresher*>(objectFinder->tableConfigFetcher.get())->
             setupTableIndexMap(&objectFinder->tableIndexMap);
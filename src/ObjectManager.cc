@@ -20,6 +20,7 @@
 #include "EnumerationIterator.h"
 #include "IndexletManager.h"
 #include "LogEntryRelocator.h"
+#include "LogProtector.h"
 #include "ObjectManager.h"
 #include "Object.h"
 #include "PerfStats.h"
@@ -95,13 +96,30 @@ ObjectManager::ObjectManager(Context* context, ServerId* serverId,
             config->master.useHugepages)
     , anyWrites(false)
     , hashTableBucketLocks()
+    , hashTableBucketVersions()
+    , optimisticReads(true)
     , lockTable(1000, log)
     , mutex("ObjectManager::mutex")
+    , replayRecordLock("ObjectManager::replayRecordLock")
+    , replayFreeLock("ObjectManager::replayFreeLock")
     , tombstoneRemover(this, &objectMap)
     , tombstoneProtectorCount(0)
+    , hashTableResizer(this)
+    , tabletMembership()
 {
-    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++)
+    if (config->master.trackTabletMembership)
+        tabletMembership.construct();
+
+    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++) {
         hashTableBucketLocks[i].setName("hashTableBucketLock");
+    }
+
+    if (config->master.hashTableResize &&
+            objectMap.getNumBuckets() < arrayLength(hashTableBucketLocks)) {
+        LOG(WARNING, "Hash table has only %lu buckets; it must have at least "
+                "%u to be resized, so it will keep its initial size",
+                objectMap.getNumBuckets(), arrayLength(hashTableBucketLocks));
+    }
 }
 
 /**
@@ -182,14 +200,17 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
             uint32_t maxLength, Buffer* response, uint32_t* respNumHashes,
             uint32_t* numObjects)
 {
-    // The current length of the response buffer in bytes. This is the
-    // cumulative length of all the objects that have been appended to response
-    // till now.
+    // Length of the response buffer before anything was appended to it.
+    uint32_t initialLength = response->size();
+    // The cumulative length of all the objects that have been appended to
+    // response till now.
     // This length should be less than maxLength before returning to the client.
     uint32_t currentLength = 0;
-    // The length for the data corresponding to the object that was just
+    // The length for the data corresponding to the objects that were just
     // appended to the response buffer.
     uint32_t partLength = 0;
+    // Number of objects appended for the key hash being processed.
+    uint32_t partObjects = 0;
     // The primary key hash being processed (that is, for which the objects
     // are being looked up) in the current iteration of the loop below.
     uint64_t pKHash;
@@ -227,6 +248,7 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
 
         HashTable::Candidates candidates;
         objectMap.lookup(pKHash, candidates);
+        partObjects = 0;
         for (; !candidates.isDone(); candidates.next()) {
             Buffer candidateBuffer;
             Log::Reference candidateRef(candidates.getReference());
@@ -239,7 +261,7 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
 
             // Candidate may have only partially matching primary key hash.
             if (object.getPKHash() == pKHash) {
-                *numObjects += 1;
+                partObjects += 1;
                 response->emplaceAppend<uint64_t>(object.getVersion());
                 response->emplaceAppend<uint32_t>(
                         object.getKeysAndValueLength());
@@ -255,30 +277,34 @@ ObjectManager::readHashes(const uint64_t tableId, uint32_t reqNumHashes,
             }
         }
 
-        partLength = response->size() - currentLength;
-        if (currentLength > maxLength) {
-            response->truncate(response->size() - partLength);
+        // The objects for the first key hash are always returned, even if
+        // they don't fit, so that the caller can make progress.
+        partLength = response->size() - initialLength - currentLength;
+        if (*respNumHashes > 0 && currentLength + partLength > maxLength) {
+            response->truncate(initialLength + currentLength);
             break;
         }
         currentLength += partLength;
+        *numObjects += partObjects;
     }
 }
 
 /**
- * This method is used by replaySegment() to prefetch the hash table bucket
- * corresponding to the next entry to be replayed. Doing so avoids a cache
- * miss for subsequent hash table lookups and significantly speeds up replay.
+ * Find the hash of the key named by the log entry an iterator points at,
+ * for use by replaySegment()'s prefetching.
  *
  * \param it
- *      SegmentIterator to use for prefetching. Whatever is currently pointed
- *      to by this iterator will be used to prefetch, if possible. Some entries
- *      do not contain keys; they are safely ignored.
+ *      Iterator pointing at the entry.
+ * \param[out] keyHash
+ *      The key's hash is returned here.
+ * \return
+ *      False if the iterator is done or the entry doesn't name a key.
  */
-inline void
-ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
+static inline bool
+getReplayKeyHash(SegmentIterator* it, KeyHash* keyHash)
 {
     if (expect_false(it->isDone()))
-        return;
+        return false;
 
     if (expect_true(it->getType() == LOG_ENTRY_TYPE_OBJ)) {
         const Object::Header* obj =
@@ -288,15 +314,81 @@ ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
         KeyLength primaryKeyLen = 0;
         const void *primaryKey = prefetchObj.getKey(0, &primaryKeyLen);
 
-        Key key(obj->tableId, primaryKey, primaryKeyLen);
-        objectMap.prefetchBucket(key.getHash());
+        *keyHash = Key::getHash(obj->tableId, primaryKey, primaryKeyLen);
+        return true;
     } else if (it->getType() == LOG_ENTRY_TYPE_OBJTOMB) {
         const ObjectTombstone::Header* tomb =
             it->getContiguous<ObjectTombstone::Header>(NULL, 0);
-        Key key(tomb->tableId, tomb->key,
+        *keyHash = Key::getHash(tomb->tableId, tomb->key,
             downCast<uint16_t>(it->getLength() - sizeof32(*tomb)));
-        objectMap.prefetchBucket(key.getHash());
+        return true;
     }
+    return false;
+}
+
+/**
+ * This method is used by replaySegment() to prefetch the hash table bucket
+ * corresponding to an entry that will be replayed soon. Doing so avoids a
+ * cache miss for subsequent hash table lookups and significantly speeds up
+ * replay.
+ *
+ * \param it
+ *      SegmentIterator to use for prefetching. Whatever is currently pointed
+ *      to by this iterator will be used to prefetch, if possible. Some entries
+ *      do not contain keys; they are safely ignored.
+ */
+inline void
+ObjectManager::prefetchHashTableBucket(SegmentIterator* it)
+{
+    KeyHash keyHash;
+    if (getReplayKeyHash(it, &keyHash))
+        objectMap.prefetchBucket(keyHash);
+}
+
+/**
+ * This method is used by replaySegment() to prefetch the log entries that
+ * an entry about to be replayed will be compared against (an earlier
+ * version of the same object, or its tombstone). The entry's hash table
+ * bucket should already have been prefetched with prefetchHashTableBucket().
+ * This reads the bucket without its lock, so it does nothing while
+ * optimistic reads are disabled (see prefetchLookups).
+ *
+ * \param it
+ *      SegmentIterator to use for prefetching; see prefetchHashTableBucket().
+ */
+inline void
+ObjectManager::prefetchHashTableReferences(SegmentIterator* it)
+{
+    KeyHash keyHash;
+    if (optimisticReads.load() && getReplayKeyHash(it, &keyHash))
+        objectMap.prefetchReferences(keyHash, PREFETCH_ENTRY_BYTES);
+}
+
+/**
+ * Warm the processor's caches for a batch of upcoming lookups (for example
+ * the keys of a multiRead), so that the lookups' cache misses overlap
+ * instead of being taken one key at a time. The hash table buckets for all
+ * of the keys are prefetched first, and then the log entries they refer to;
+ * see HashTable::prefetchBatch. This takes no locks and has no effect other
+ * than on performance.
+ *
+ * Like an OptimisticBucketRead, this reads the hash table without holding
+ * any bucket lock, so it is skipped while optimistic reads are disabled:
+ * the table's bucket arrays may be swapped under it during a resize. The
+ * HashTableResizer doesn't start or finish a resize until every RPC that
+ * could have seen optimistic reads enabled has finished.
+ *
+ * \param keyHashes
+ *      Hashes of the keys that will be looked up (see Key::getHash).
+ * \param count
+ *      Number of entries in \a keyHashes.
+ */
+void
+ObjectManager::prefetchLookups(const KeyHash* keyHashes, uint32_t count)
+{
+    if (!optimisticReads.load())
+        return;
+    objectMap.prefetchBatch(keyHashes, count, PREFETCH_ENTRY_BYTES);
 }
 
 /**
@@ -327,17 +419,50 @@ ObjectManager::readObject(Key& key, Buffer* outBuffer,
                 bool valueOnly)
 {
     objectMap.prefetchBucket(key.getHash());
-    HashTableBucketLock lock(*this, key);
-
-    // If the tablet doesn't exist in the NORMAL state, we must plead ignorance.
-    if (!tabletManager->checkAndIncrementReadCount(key))
-        return STATUS_UNKNOWN_TABLET;
 
     Buffer buffer;
     LogEntryType type;
     uint64_t version;
     Log::Reference reference;
-    bool found = lookup(lock, key, type, buffer, &version, &reference);
+    bool found = false;
+    bool counted = false;
+    bool validated = false;
+
+    // Reads vastly outnumber writes, so first try the lookup without taking
+    // the bucket lock; it is only redone under the lock if a writer touched
+    // the bucket while it ran.
+    {
+        OptimisticBucketRead read(*this, key);
+        if (read.mayProceed()) {
+            // The tablet check must happen after the read begins: objects
+            // are purged from the hash table (under the bucket lock) after
+            // their tablet goes away, so this ensures we either see the
+            // tablet or notice the purge.
+            if (!tabletManager->checkAndIncrementReadCount(key))
+                return STATUS_UNKNOWN_TABLET;
+            counted = true;
+            found = lookup(read, key, type, buffer, &version, &reference);
+            validated = read.isValid();
+        }
+    }
+
+    if (!validated) {
+        buffer.reset();
+        HashTableBucketLock lock(*this, key);
+
+        // If the tablet doesn't exist in the NORMAL state, we must plead
+        // ignorance. Don't count the read twice if the optimistic attempt
+        // already did.
+        if (!counted) {
+            if (!tabletManager->checkAndIncrementReadCount(key))
+                return STATUS_UNKNOWN_TABLET;
+        } else {
+            if (!tabletManager->checkReadable(key))
+                return STATUS_UNKNOWN_TABLET;
+        }
+        found = lookup(lock, key, type, buffer, &version, &reference);
+    }
+
     if (!found || type != LOG_ENTRY_TYPE_OBJ)
         return STATUS_OBJECT_DOESNT_EXIST;
 
@@ -487,21 +612,98 @@ ObjectManager::removeObject(Key& key, RejectRules* rejectRules,
     segmentManager.raiseSafeVersion(object.getVersion() + 1);
     log.free(reference);
     remove(lock, key);
+    maybeResizeHashTable();
     return STATUS_OK;
 }
 
 /**
  * Scan the hashtable and remove all objects that do not belong to a
  * tablet currently owned by this master. Used to clean up any objects
- * created as part of an aborted recovery.
+ * created as part of an aborted recovery, and after a tablet is dropped or
+ * migrated away.
  */
 void
 ObjectManager::removeOrphanedObjects()
 {
-    for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
-        HashTableBucketLock lock(*this, i);
+    if (tabletMembership) {
+        removeOrphanedKeyHashes();
+        return;
+    }
+
+    // If the hash table is resized while we scan it, bucket indexes change
+    // meaning part way through; start over so that no bucket is missed.
+    uint64_t numBuckets;
+    do {
+        numBuckets = objectMap.getNumBuckets();
+        for (uint64_t i = 0; i < objectMap.getNumBuckets(); i++) {
+            HashTableBucketLock lock(*this, i);
+            CleanupParameters params = { this , &lock };
+            objectMap.forEachInBucket(removeIfOrphanedObject, &params, i);
+        }
+    } while (numBuckets != objectMap.getNumBuckets());
+}
+
+/**
+ * Does the work of removeOrphanedObjects() when #tabletMembership is kept:
+ * only the buckets holding key hashes outside every tablet this master
+ * owns are visited, so the cost is proportional to the number of orphaned
+ * objects rather than to the size of the hash table.
+ */
+void
+ObjectManager::removeOrphanedKeyHashes()
+{
+    vector<TabletManager::Tablet> tablets;
+    tabletManager->getTablets(&tablets);
+    std::sort(tablets.begin(), tablets.end(),
+        [](const TabletManager::Tablet& a, const TabletManager::Tablet& b) {
+            return a.tableId < b.tableId ||
+                (a.tableId == b.tableId && a.startKeyHash < b.startKeyHash);
+        });
+
+    vector<uint64_t> tableIds;
+    tabletMembership->getTableIds(&tableIds);
+    vector<KeyHash> orphans;
+    vector<TabletManager::Tablet>::iterator tablet = tablets.begin();
+    foreach (uint64_t tableId, tableIds) {
+        while (tablet != tablets.end() && tablet->tableId < tableId)
+            tablet++;
+
+        // Collect the hashes in each gap between this table's tablets.
+        KeyHash gapStart = 0;
+        bool done = false;
+        for (; tablet != tablets.end() && tablet->tableId == tableId;
+                tablet++) {
+            if (done || tablet->startKeyHash < gapStart)
+                continue;
+            if (tablet->startKeyHash > gapStart) {
+                tabletMembership->getKeyHashes(tableId, gapStart,
+                        tablet->startKeyHash - 1, &orphans);
+            }
+            if (tablet->endKeyHash == ~0lu)
+                done = true;
+            else
+                gapStart = tablet->endKeyHash + 1;
+        }
+        if (!done)
+            tabletMembership->getKeyHashes(tableId, gapStart, ~0lu, &orphans);
+    }
+
+    vector<uint64_t> references;
+    foreach (KeyHash keyHash, orphans) {
+        uint64_t unused;
+        HashTableBucketLock lock(*this, HashTable::findBucketIndex(
+                objectMap.getNumBuckets(), keyHash, &unused));
         CleanupParameters params = { this , &lock };
-        objectMap.forEachInBucket(removeIfOrphanedObject, &params, i);
+
+        // Removing entries may rearrange the candidates, so find them all
+        // before removing any.
+        references.clear();
+        HashTable::Candidates candidates;
+        objectMap.lookup(keyHash, candidates);
+        for (; !candidates.isDone(); candidates.next())
+            references.push_back(candidates.getReference());
+        foreach (uint64_t reference, references)
+            removeIfOrphanedObject(reference, &params);
     }
 }
 
@@ -610,13 +812,24 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
     uint64_t safeVersionRecoveryCount = 0;
     uint64_t safeVersionNonRecoveryCount = 0;
 
-    SegmentIterator prefetcher = it;
-    prefetcher.next();
+    // Hash table buckets are prefetched REPLAY_PREFETCH_DISTANCE entries
+    // ahead of replay, and the log entries those buckets refer to half as
+    // far ahead, by which time the buckets should have arrived.
+    SegmentIterator bucketPrefetcher = it;
+    for (uint32_t i = 0; i < REPLAY_PREFETCH_DISTANCE; i++) {
+        prefetchHashTableBucket(&bucketPrefetcher);
+        bucketPrefetcher.next();
+    }
+    SegmentIterator referencePrefetcher = it;
+    for (uint32_t i = 0; i < REPLAY_PREFETCH_DISTANCE / 2; i++)
+        referencePrefetcher.next();
 
     uint64_t bytesIterated = 0;
     for (; expect_true(!it.isDone()); it.next()) {
-        prefetchHashTableBucket(&prefetcher);
-        prefetcher.next();
+        prefetchHashTableBucket(&bucketPrefetcher);
+        bucketPrefetcher.next();
+        prefetchHashTableReferences(&referencePrefetcher);
+        referencePrefetcher.next();
 
         LogEntryType type = it.getType();
 
@@ -629,6 +842,16 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
         recoverySegmentEntryCount++;
         recoverySegmentEntryBytes += it.getLength();
 
+        // Several segments may be replayed at once (see
+        // MasterService::recover). Objects and tombstones are settled key
+        // by key under the hash table bucket locks, but the other entries
+        // check and update master-wide state (linearizability and
+        // transaction records) in several steps, so they are replayed one
+        // at a time.
+        Tub<SpinLock::Guard> recordGuard;
+        if (type != LOG_ENTRY_TYPE_OBJ && type != LOG_ENTRY_TYPE_OBJTOMB)
+            recordGuard.construct(replayRecordLock);
+
         if (expect_true(type == LOG_ENTRY_TYPE_OBJ)) {
             // The recovery segment is guaranteed to be contiguous, so we need
             // not provide a copyout buffer.
@@ -712,7 +935,11 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
 
                     // Track the death of the object
                     liveObjectBytes -= currentBuffer.size();
-                    sideLog->free(currentReference);
+                    {
+                        // The entry may live in another replay's SideLog.
+                        SpinLock::Guard _(replayFreeLock);
+                        sideLog->free(currentReference);
+                    }
                     liveObjectCount--;
                 }
             }
@@ -823,7 +1050,11 @@ ObjectManager::replaySegment(SideLog* sideLog, SegmentIterator& it,
 
                     // Track the death of the object
                     liveObjectBytes -= currentBuffer.size();
-                    sideLog->free(currentReference);
+                    {
+                        // The entry may live in another replay's SideLog.
+                        SpinLock::Guard _(replayFreeLock);
+                        sideLog->free(currentReference);
+                    }
                     liveObjectCount--;
 
                     // Optimization to avoid appending two tombstones with the
@@ -1304,7 +1535,8 @@ ObjectManager::writeObject(Object& newObject, RejectRules* rejectRules,
         currentHashTableEntry.setReference(appends[0].reference.toInteger());
         log.free(currentReference);
     } else {
-        objectMap.insert(key.getHash(), appends[0].reference.toInteger());
+        insert(lock, key, appends[0].reference);
+        maybeResizeHashTable();
     }
 
     if (rpcResult && rpcResultPtr)
@@ -2069,7 +2301,7 @@ ObjectManager::commitWrite(PreparedOp& op,
         currentHashTableEntry.setReference(appends[1].reference.toInteger());
         log.free(oldReference);
     } else {
-        objectMap.insert(key.getHash(), appends[1].reference.toInteger());
+        insert(lock, key, appends[1].reference);
     }
     return STATUS_OK;
 }
@@ -2154,7 +2386,7 @@ ObjectManager::flushEntriesToLog(Buffer *logBuffer, uint32_t& numEntries)
                 if (currentType == LOG_ENTRY_TYPE_OBJTOMB) {
                     CleanupParameters params = { this , &lock };
                     removeIfTombstone(currentReference.toInteger(), &params);
-                    objectMap.insert(key.getHash(), references[i].toInteger());
+                    insert(lock, key, references[i]);
                 }
 
                 if (currentType == LOG_ENTRY_TYPE_OBJ) {
@@ -2163,7 +2395,7 @@ ObjectManager::flushEntriesToLog(Buffer *logBuffer, uint32_t& numEntries)
                     log.free(currentReference);
                 }
             } else {
-                objectMap.insert(key.getHash(), references[i].toInteger());
+                insert(lock, key, references[i]);
             }
 
             tabletManager->incrementWriteCount(key);
@@ -2515,6 +2747,120 @@ ObjectManager::TombstoneProtector::~TombstoneProtector()
     }
 }
 
+/**
+ * Construct a HashTableResizer. It does nothing until started.
+ *
+ * \param objectManager
+ *      The instance of ObjectManager that owns the #objectMap.
+ */
+ObjectManager::HashTableResizer::HashTableResizer(ObjectManager* objectManager)
+    : WorkerTimer(objectManager->context->dispatch)
+    , objectManager(objectManager)
+    , retiredEpoch(0)
+    , quiesceEpoch(0)
+{
+}
+
+/**
+ * Advance any resize of the hash table: free the bucket array left by the
+ * last resize once no RPC can still reference it, start a new resize if the
+ * table's occupancy calls for one, and migrate a batch of buckets. We
+ * reschedule ourselves after each batch so we don't lock out other
+ * WorkerTimers for a long time.
+ *
+ * Optimistic readers (see OptimisticBucketRead) and batch prefetches (see
+ * prefetchLookups) can't detect the bucket arrays being swapped, so they
+ * are turned off for the duration of a resize, and a resize only begins
+ * once every RPC that might have started one has finished.
+ */
+void
+ObjectManager::HashTableResizer::handleTimerEvent()
+{
+    HashTable* objectMap = &objectManager->objectMap;
+
+    if (objectMap->hasRetiredBuckets()) {
+        if (!epochFinished(retiredEpoch)) {
+            start(Cycles::rdtsc() + Cycles::fromMicroseconds(100));
+            return;
+        }
+        objectMap->freeRetiredBuckets();
+    }
+
+    if (!objectMap->isResizing()) {
+        uint64_t target = objectMap->getResizeTarget(
+                arrayLength(objectManager->hashTableBucketLocks));
+        if (target == objectMap->getNumBuckets()) {
+            objectManager->optimisticReads = true;
+            return;
+        }
+
+        // Bucket indexes change meaning when a resize starts, which would
+        // confuse a TombstoneRemover scan in progress; wait for it.
+        {
+            SpinLock::Guard guard(objectManager->mutex);
+            if (objectManager->tombstoneProtectorCount > 0 ||
+                    objectManager->tombstoneRemover.isRunning()) {
+                start(Cycles::rdtsc() + Cycles::fromSeconds(0.1));
+                return;
+            }
+        }
+
+        if (objectManager->optimisticReads) {
+            objectManager->optimisticReads = false;
+            quiesceEpoch = LogProtector::incrementCurrentEpoch() - 1;
+        }
+        if (!epochFinished(quiesceEpoch)) {
+            start(Cycles::rdtsc() + Cycles::fromMicroseconds(100));
+            return;
+        }
+
+        LOG(NOTICE, "Resizing hash table from %lu to %lu buckets "
+                "(%lu entries)", objectMap->getNumBuckets(), target,
+                objectMap->getNumEntries());
+        // Allocating the new array can take seconds for a large table, so
+        // do it before locking out every other operation.
+        objectMap->prepareResize(target);
+        objectManager->lockAllBuckets();
+        objectMap->startResize(target);
+        objectManager->unlockAllBuckets();
+    }
+
+    for (int i = 0; i < 100; i++) {
+        uint64_t bucket = objectMap->getNextBucketToMigrate();
+        bool done;
+        {
+            HashTableBucketLock lock(*objectManager, bucket);
+            done = objectMap->migrateBucket(bucket, getReferenceHash,
+                                            objectManager);
+        }
+        if (done) {
+            objectManager->lockAllBuckets();
+            objectMap->finishResize();
+            objectManager->unlockAllBuckets();
+            objectManager->optimisticReads = true;
+            retiredEpoch = LogProtector::incrementCurrentEpoch() - 1;
+            LOG(NOTICE, "Hash table resize complete: %lu buckets",
+                    objectMap->getNumBuckets());
+            break;
+        }
+    }
+
+    // Either more buckets remain to be migrated or the old bucket array
+    // must still be freed.
+    start(0);
+}
+
+/**
+ * Returns true if no RPC that started in the given LogProtector epoch or
+ * earlier is still running.
+ */
+bool
+ObjectManager::HashTableResizer::epochFinished(uint64_t epoch)
+{
+    Dispatch::Lock lock(objectManager->context->dispatch);
+    return LogProtector::getEarliestOutstandingEpoch(~0) > epoch;
+}
+
 /**
  * Produce a human-readable description of the contents of a segment.
  * Intended primarily for use in unit tests.
@@ -2706,6 +3052,49 @@ ObjectManager::lookup(HashTableBucketLock& lock, Key& key,
                 uint64_t* outVersion,
                 Log::Reference* outReference,
                 HashTable::Candidates* outCandidates)
+{
+    return lookupInternal(key, outType, buffer, outVersion, outReference,
+                          outCandidates);
+}
+
+/**
+ * Variant of lookup() for callers that don't hold the key's bucket lock.
+ * The results are garbage unless read.isValid() returns true afterwards.
+ *
+ * \param read
+ *      Tracks whether the bucket changed during the lookup; must have been
+ *      constructed for \a key and read.mayProceed() must be true.
+ * \param key
+ *      Key of the object being looked up.
+ * \param[out] outType
+ *      The type of the log entry found is returned here.
+ * \param[out] buffer
+ *      The entry, if found, is appended to this buffer.
+ * \param[out] outVersion
+ *      If non-NULL, the version of the object or tombstone found is
+ *      returned here.
+ * \param[out] outReference
+ *      If non-NULL, the log reference to the entry found is returned here.
+ * \return
+ *      True if an object or tombstone for the key was found.
+ */
+bool
+ObjectManager::lookup(OptimisticBucketRead& read, Key& key,
+                LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference)
+{
+    return lookupInternal(key, outType, buffer, outVersion, outReference,
+                          NULL);
+}
+
+/**
+ * Shared implementation of the two lookup() variants; see the first one for
+ * a description of the parameters.
+ */
+bool
+ObjectManager::lookupInternal(Key& key, LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference,
+                HashTable::Candidates* outCandidates)
 {
     HashTable::Candidates candidates;
     objectMap.lookup(key.getHash(), candidates);
@@ -2740,6 +3129,27 @@ ObjectManager::lookup(HashTableBucketLock& lock, Key& key,
     return false;
 }
 
+/**
+ * Add a new entry to the hash table for a key that doesn't already have one.
+ *
+ * \param lock
+ *      This method must be invoked with the appropriate hash table bucket
+ *      lock already held. This parameter exists to help ensure correct
+ *      caller behaviour.
+ * \param key
+ *      Key of the object or tombstone being added.
+ * \param reference
+ *      Log reference of the object or tombstone.
+ */
+void
+ObjectManager::insert(HashTableBucketLock& lock, Key& key,
+                Log::Reference reference)
+{
+    objectMap.insert(key.getHash(), reference.toInteger());
+    if (tabletMembership)
+        tabletMembership->add(key.getTableId(), key.getHash());
+}
+
 /**
  * Remove an object from the hash table, if it exists in it. Return whether or
  * not it was found and removed.
@@ -2766,6 +3176,8 @@ ObjectManager::remove(HashTableBucketLock& lock, Key& key)
         Key candidateKey(type, buffer);
         if (key == candidateKey) {
             candidates.remove();
+            if (tabletMembership)
+                tabletMembership->remove(key.getTableId(), key.getHash());
             return true;
         }
         candidates.next();
@@ -2858,6 +3270,68 @@ ObjectManager::removeIfTombstone(uint64_t maybeTomb, void *cookie)
     }
 }
 
+/**
+ * HashTable::ReferenceHasher used when migrating buckets during a resize of
+ * #objectMap: returns the hash of the key of the object or tombstone that a
+ * hash table reference points to.
+ *
+ * \param reference
+ *      Log reference stored in the hash table.
+ * \param cookie
+ *      Pointer to the ObjectManager that owns the log.
+ */
+KeyHash
+ObjectManager::getReferenceHash(uint64_t reference, void* cookie)
+{
+    ObjectManager* objectManager = static_cast<ObjectManager*>(cookie);
+    Buffer buffer;
+    LogEntryType type = objectManager->log.getEntry(
+            Log::Reference(reference), buffer);
+    Key key(type, buffer);
+    return key.getHash();
+}
+
+/**
+ * Acquire every hash table bucket lock, giving the caller exclusive access
+ * to #objectMap (used to start and finish resizes). Locks are always taken
+ * in the same order, and no one else holds more than one at a time, so this
+ * cannot deadlock.
+ */
+void
+ObjectManager::lockAllBuckets()
+{
+    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++)
+        lockBucketStripe(i);
+}
+
+/**
+ * Release the locks acquired by #lockAllBuckets().
+ */
+void
+ObjectManager::unlockAllBuckets()
+{
+    for (size_t i = 0; i < arrayLength(hashTableBucketLocks); i++)
+        unlockBucketStripe(i);
+}
+
+/**
+ * Start the HashTableResizer if online resizing is enabled and #objectMap
+ * has become too full or too empty. This is called after every insertion
+ * and removal, so the common case must be cheap.
+ */
+void
+ObjectManager::maybeResizeHashTable()
+{
+    if (expect_true(!config->master.hashTableResize) ||
+            hashTableResizer.isRunning()) {
+        return;
+    }
+    if (objectMap.getResizeTarget(arrayLength(hashTableBucketLocks)) !=
+            objectMap.getNumBuckets()) {
+        hashTableResizer.start(0);
+    }
+}
+
 /**
  * Synchronously remove leftover tombstones in the hash table added during
  * replaySegment calls (for example, as caused by a recovery). This private
@@ -3295,7 +3769,7 @@ ObjectManager::replace(HashTableBucketLock& lock, Key& key,
         candidates.next();
     }
 
-    objectMap.insert(key.getHash(), reference.toInteger());
+    insert(lock, key, reference);
     return false;
 }
 
@@ -32,6 +32,7 @@
 #include "ServerConfig.h"
 #include "SpinLock.h"
 #include "TabletManager.h"
+#include "TabletMembership.h"
 #include "TransactionManager.h"
 #include "TxDecisionRecord.h"
 #include "TxRecoveryManager.h"
@@ -74,6 +75,8 @@ class ObjectManager : public LogEntryHandlers,
                 uint32_t maxLength, Buffer* response, uint32_t* respNumHashes,
                 uint32_t* numObjects);
     void prefetchHashTableBucket(SegmentIterator* it);
+    void prefetchHashTableReferences(SegmentIterator* it);
+    void prefetchLookups(const KeyHash* keyHashes, uint32_t count);
     Status readObject(Key& key, Buffer* outBuffer,
                 RejectRules* rejectRules, uint64_t* outVersion,
                 bool valueOnly = false);
@@ -134,6 +137,16 @@ class ObjectManager : public LogEntryHandlers,
     ReplicaManager* getReplicaManager() { return &replicaManager; }
     HashTable* getObjectMap() { return &objectMap; }
 
+    /**
+     * Return the index of key hashes by table, or NULL if this master
+     * doesn't keep one (see ServerConfig::Master::trackTabletMembership).
+     */
+    TabletMembership*
+    getTabletMembership()
+    {
+        return tabletMembership ? tabletMembership.get() : NULL;
+    }
+
     /**
      * An object of this class must be held by any activity that places
      * tombstones in the hash table temporarily (e.g., anyone who calls
@@ -155,6 +168,19 @@ class ObjectManager : public LogEntryHandlers,
     };
 
   PRIVATE:
+    /**
+     * Number of bytes prefetched from each log entry referenced by a hash
+     * table bucket in prefetchLookups() and during replay: enough for the
+     * entry and object headers and a typical key.
+     */
+    static const uint32_t PREFETCH_ENTRY_BYTES = 128;
+
+    /**
+     * How many log entries ahead of the one being replayed replaySegment()
+     * prefetches hash table buckets.
+     */
+    static const uint32_t REPLAY_PREFETCH_DISTANCE = 8;
+
     /**
      * An instance of this class locks the bucket of the hash table that a given
      * key maps into. The lock is taken in the constructor and released in the
@@ -164,6 +190,12 @@ class ObjectManager : public LogEntryHandlers,
      * belonging to that key. ObjectManager maintains a number of fine-grained
      * locks to reduce the likelihood of contention between operations on
      * different keys (see ObjectManager::hashTableBucketLocks).
+     *
+     * Each lock also has a version (see
+     * ObjectManager::hashTableBucketVersions) that is incremented when the
+     * lock is taken and again when it is released, so that readers using
+     * OptimisticBucketRead can tell whether the buckets it covers may have
+     * changed underneath them.
      */
     class HashTableBucketLock {
       public:
@@ -177,7 +209,8 @@ class ObjectManager : public LogEntryHandlers,
          *      Key whose corresponding bucket in the hash table will be locked.
          */
         HashTableBucketLock(ObjectManager& objectManager, Key& key)
-            : lock(NULL)
+            : objectManager(objectManager)
+            , stripe(0)
         {
             uint64_t unused;
             uint64_t bucket = HashTable::findBucketIndex(
@@ -196,14 +229,15 @@ class ObjectManager : public LogEntryHandlers,
          *      Index of the hash table bucket to lock.
          */
         HashTableBucketLock(ObjectManager& objectManager, uint64_t bucket)
-            : lock(NULL)
+            : objectManager(objectManager)
+            , stripe(0)
         {
             takeBucketLock(objectManager, bucket);
         }
 
         ~HashTableBucketLock()
         {
-            lock->unlock();
+            objectManager.unlockBucketStripe(stripe);
         }
 
       PRIVATE:
@@ -219,21 +253,109 @@ class ObjectManager : public LogEntryHandlers,
         void
         takeBucketLock(ObjectManager& objectManager, uint64_t bucket)
         {
-            assert(lock == NULL);
+            stripe = getStripe(objectManager, bucket);
+            objectManager.lockBucketStripe(stripe);
+        }
+
+      public:
+        /**
+         * Return the index into ObjectManager::hashTableBucketLocks of the
+         * lock that protects a given hash table bucket.
+         */
+        static uint64_t
+        getStripe(ObjectManager& objectManager, uint64_t bucket)
+        {
             uint32_t numLocks = arrayLength(objectManager.hashTableBucketLocks);
             assert(BitOps::isPowerOfTwo(numLocks));
-            uint64_t lockIndex = bucket & (numLocks - 1);
-            lock = &objectManager.hashTableBucketLocks[lockIndex];
-            lock->lock();
+            return bucket & (numLocks - 1);
         }
 
-        /// The hash table bucket spinlock this object acquired in the
-        /// constructor and will release in the destructor.
-        SpinLock* lock;
+      PRIVATE:
+        /// The ObjectManager whose lock this object holds.
+        ObjectManager& objectManager;
+
+        /// Index of the lock in ObjectManager::hashTableBucketLocks that this
+        /// object acquired in the constructor and will release in the
+        /// destructor.
+        uint64_t stripe;
 
         DISALLOW_COPY_AND_ASSIGN(HashTableBucketLock);
     };
 
+    /**
+     * Lets a reader look up a key in the hash table without taking its
+     * HashTableBucketLock. The constructor records the version of the lock
+     * covering the key's bucket; if isValid() returns true after the lookup,
+     * nobody held that lock in the meantime, so the lookup saw a consistent
+     * bucket and its result can be used just as if the lock had been held.
+     * Otherwise the result must be discarded and the lookup retried under
+     * the lock.
+     *
+     * Readers never write to shared memory this way, so reads of hot keys
+     * don't bounce lock cache lines between cores. Log entries found this
+     * way stay valid for the rest of the RPC for the same reason they do
+     * under the lock: segments are only freed once every RPC that could
+     * refer to them has finished (see LogProtector).
+     */
+    class OptimisticBucketRead {
+      public:
+        /**
+         * \param objectManager
+         *      The ObjectManager whose hash table is to be read.
+         * \param key
+         *      Key whose bucket will be read.
+         */
+        OptimisticBucketRead(ObjectManager& objectManager, Key& key)
+            : version(NULL)
+            , startVersion(1)
+        {
+            if (!objectManager.optimisticReads.load())
+                return;
+            uint64_t unused;
+            uint64_t bucket = HashTable::findBucketIndex(
+                        objectManager.objectMap.getNumBuckets(),
+                        key.getHash(), &unused);
+            version = &objectManager.hashTableBucketVersions[
+                        HashTableBucketLock::getStripe(objectManager,
+                                                       bucket)].value;
+            startVersion = version->load(std::memory_order_acquire);
+        }
+
+        /**
+         * Returns false if the bucket was locked (or optimistic reads were
+         * disabled) when this object was constructed, in which case there
+         * is no point in trying the lookup.
+         */
+        bool
+        mayProceed() const
+        {
+            return (startVersion & 1) == 0;
+        }
+
+        /**
+         * Returns true if the bucket can't have been modified since this
+         * object was constructed.
+         */
+        bool
+        isValid() const
+        {
+            if (!mayProceed())
+                return false;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return version->load(std::memory_order_relaxed) == startVersion;
+        }
+
+      PRIVATE:
+        /// Version of the lock covering the bucket being read.
+        const std::atomic<uint64_t>* version;
+
+        /// The value of #version when this object was constructed. Odd if
+        /// the lookup should not be attempted.
+        uint64_t startVersion;
+
+        DISALLOW_COPY_AND_ASSIGN(OptimisticBucketRead);
+    };
+
     /**
      * Struct used to pass parameters into the removeIfOrphanedObject and
      * removeIfTombstone methods through the generic HashTable::forEachInBucket
@@ -274,7 +396,38 @@ class ObjectManager : public LogEntryHandlers,
         DISALLOW_COPY_AND_ASSIGN(TombstoneRemover);
     };
 
+    /**
+     * This object executes in the background (as a WorkerTimer) to resize
+     * #objectMap when it becomes too full or too empty. Buckets are migrated
+     * a batch at a time, each under its HashTableBucketLock, so that lookups
+     * and writes continue while the table is being resized.
+     */
+    class HashTableResizer : public WorkerTimer {
+      public:
+        explicit HashTableResizer(ObjectManager* objectManager);
+        void handleTimerEvent();
+
+      PRIVATE:
+        bool epochFinished(uint64_t epoch);
+
+        /// The ObjectManager that owns the hash table to resize.
+        ObjectManager* objectManager;
+
+        /// LogProtector epoch in which the last resize finished. The
+        /// retired bucket array may be freed once no RPC from this epoch
+        /// or earlier is still running.
+        uint64_t retiredEpoch;
+
+        /// LogProtector epoch in which optimistic reads were last disabled
+        /// in preparation for a resize. The resize may start once no RPC
+        /// from this epoch or earlier is still running.
+        uint64_t quiesceEpoch;
+
+        DISALLOW_COPY_AND_ASSIGN(HashTableResizer);
+    };
+
     static string dumpSegment(Segment* segment);
+    static KeyHash getReferenceHash(uint64_t reference, void* cookie);
     uint32_t getObjectTimestamp(Buffer& buffer);
     uint32_t getTombstoneTimestamp(Buffer& buffer);
     uint32_t getTxDecisionRecordTimestamp(Buffer& buffer);
@@ -283,11 +436,49 @@ class ObjectManager : public LogEntryHandlers,
                 uint64_t* outVersion = NULL,
                 Log::Reference* outReference = NULL,
                 HashTable::Candidates* outCandidates = NULL);
+    bool lookup(OptimisticBucketRead& read, Key& key,
+                LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference);
+    bool lookupInternal(Key& key, LogEntryType& outType, Buffer& buffer,
+                uint64_t* outVersion, Log::Reference* outReference,
+                HashTable::Candidates* outCandidates);
     friend void recoveryCleanup(uint64_t maybeTomb, void *cookie);
+    void insert(HashTableBucketLock& lock, Key& key, Log::Reference reference);
     bool remove(HashTableBucketLock& lock, Key& key);
+    void removeOrphanedKeyHashes();
     static void removeIfOrphanedObject(uint64_t reference, void *cookie);
     static void removeIfTombstone(uint64_t maybeTomb, void *cookie);
     void removeTombstones();
+    void lockAllBuckets();
+    void unlockAllBuckets();
+
+    /**
+     * Acquire one of #hashTableBucketLocks and mark its version odd to warn
+     * OptimisticBucketRead users that its buckets may be changing.
+     */
+    void
+    lockBucketStripe(uint64_t stripe)
+    {
+        hashTableBucketLocks[stripe].lock();
+        std::atomic<uint64_t>& version = hashTableBucketVersions[stripe].value;
+        version.store(version.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /**
+     * Release a lock acquired with #lockBucketStripe().
+     */
+    void
+    unlockBucketStripe(uint64_t stripe)
+    {
+        std::atomic<uint64_t>& version = hashTableBucketVersions[stripe].value;
+        version.store(version.load(std::memory_order_relaxed) + 1,
+                      std::memory_order_release);
+        hashTableBucketLocks[stripe].unlock();
+    }
+
+    void maybeResizeHashTable();
     Status rejectOperation(const RejectRules* rejectRules, uint64_t version)
                 __attribute__((warn_unused_result));
     void relocateObject(Buffer& oldBuffer, Log::Reference oldReference,
@@ -394,6 +585,36 @@ class ObjectManager : public LogEntryHandlers,
      */
     UnnamedSpinLock hashTableBucketLocks[1024];
 
+    /**
+     * An entry in #hashTableBucketVersions. Each is padded to the size of a
+     * cache line so that no two versions share one, and writers on one
+     * stripe don't invalidate the lines that optimistic readers of
+     * neighbouring stripes are polling. (Padding rather than alignment,
+     * since objects containing an over-aligned ObjectManager would not be
+     * allocated correctly by operator new.)
+     */
+    struct BucketVersion {
+        BucketVersion() : value(0), pad() {}
+        std::atomic<uint64_t> value;
+        char pad[CACHE_LINE_SIZE - sizeof(std::atomic<uint64_t>)];
+    };
+
+    /**
+     * One version per entry in #hashTableBucketLocks, odd while the lock is
+     * held and incremented every time it is acquired or released. Kept in
+     * a separate array so that optimistic readers (see OptimisticBucketRead)
+     * only ever read these cache lines.
+     */
+    BucketVersion hashTableBucketVersions[1024];
+
+    /**
+     * If false, readObject() always takes the bucket lock and nothing
+     * prefetches through #objectMap without it. Cleared while #objectMap
+     * is being resized: its bucket arrays are swapped without any
+     * synchronization that unlocked readers could observe.
+     */
+    std::atomic<bool> optimisticReads;
+
     /**
      * Locks objects during transactions.
      */
@@ -404,6 +625,22 @@ class ObjectManager : public LogEntryHandlers,
      */
     SpinLock mutex;
 
+    /**
+     * Serializes replaySegment()'s handling of log entries other than
+     * objects and tombstones when several segments are replayed at once.
+     * May be acquired before a hash table bucket lock, never after.
+     */
+    SpinLock replayRecordLock;
+
+    /**
+     * Serializes the freeing of superseded entries during concurrent
+     * replaySegment() calls: the segment holding such an entry may belong
+     * to another replay's SideLog, and its dead entry counters aren't
+     * atomic. Acquired while holding a bucket lock; nothing is acquired
+     * while holding it.
+     */
+    SpinLock replayFreeLock;
+
     /**
      * This object automatically garbage collects tombstones that were added
      * to the hash table during replaySegment() calls.
@@ -416,6 +653,20 @@ class ObjectManager : public LogEntryHandlers,
      */
     int tombstoneProtectorCount;
 
+    /**
+     * Grows or shrinks #objectMap in the background; only used if
+     * config->master.hashTableResize is set.
+     */
+    HashTableResizer hashTableResizer;
+
+    /**
+     * Records which key hashes of which tables are in #objectMap, so that a
+     * single tablet's objects can be found without scanning the whole hash
+     * table. Only constructed if config->master.trackTabletMembership is
+     * set; kept up to date by insert() and remove().
+     */
+    Tub<TabletMembership> tabletMembership;
+
     friend class CleanerCompactionBenchmark;
     friend class ObjectManagerBenchmark;
 
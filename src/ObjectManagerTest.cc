@@ -565,6 +565,54 @@ TEST_F(ObjectManagerTest, readHashes) {
                                   o1.getValueLength()));
 }
 
+TEST_F(ObjectManagerTest, readHashes_maxLength) {
+    Key key0(0, "0", 1);
+    Key key1(0, "1", 1);
+    storeObject(key0, "value0");
+    storeObject(key1, "value1");
+
+    Buffer pKHashes;
+    pKHashes.emplaceAppend<uint64_t>(key0.getHash());
+    pKHashes.emplaceAppend<uint64_t>(key1.getHash());
+
+    // The objects for the first hash are returned even though they don't
+    // fit; the second hash's are dropped and not counted.
+    Buffer responseBuffer;
+    responseBuffer.emplaceAppend<uint32_t>(0);
+    uint32_t numHashesResponse;
+    uint32_t numObjectsResponse;
+    objectManager.readHashes(0, 2, &pKHashes, 0, 1, &responseBuffer,
+            &numHashesResponse, &numObjectsResponse);
+    EXPECT_EQ(1U, numHashesResponse);
+    EXPECT_EQ(1U, numObjectsResponse);
+    uint32_t length = *responseBuffer.getOffset<uint32_t>(12);
+    EXPECT_EQ(16U + length, responseBuffer.size());
+}
+
+TEST_F(ObjectManagerTest, prefetchLookups_resizing) {
+    Key key(1, "1", 1);
+    storeObject(key, "hi", 93);
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+    KeyHash keyHash = key.getHash();
+    objectManager.prefetchLookups(&keyHash, 1);
+
+    // Mimic a resize that has been started but whose new bucket array
+    // isn't visible yet: anything that looked through the table now would
+    // follow a NULL pointer. Optimistic reads are always disabled by then.
+    HashTable* objectMap = &objectManager.objectMap;
+    objectManager.optimisticReads = false;
+    objectMap->resizeNumBuckets = objectMap->numBuckets * 2;
+    objectMap->migratedUnits = objectMap->numBuckets;
+    objectManager.prefetchLookups(&keyHash, 1);
+    objectMap->resizeNumBuckets = 0;
+    objectMap->migratedUnits = 0;
+    objectManager.optimisticReads = true;
+
+    Buffer buffer;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, 0, true));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+}
+
 TEST_F(ObjectManagerTest, readObject) {
     Buffer buffer;
     Key key(1, "1", 1);
@@ -614,6 +662,94 @@ TEST_F(ObjectManagerTest, readObject) {
         tabletManager.toString());
 }
 
+/**
+ * Return the version of the hash table bucket lock covering a key (see
+ * ObjectManager::hashTableBucketVersions).
+ */
+static std::atomic<uint64_t>&
+getBucketVersion(ObjectManager& objectManager, Key& key)
+{
+    uint64_t unused;
+    uint64_t bucket = HashTable::findBucketIndex(
+            objectManager.objectMap.getNumBuckets(), key.getHash(), &unused);
+    return objectManager.hashTableBucketVersions[
+            ObjectManager::HashTableBucketLock::getStripe(objectManager,
+                                                          bucket)].value;
+}
+
+TEST_F(ObjectManagerTest, readObject_optimistic) {
+    Buffer buffer;
+    Key key(1, "1", 1);
+    storeObject(key, "hi", 93);
+    tabletManager.addTablet(1, 0, ~0UL, TabletManager::NORMAL);
+    std::atomic<uint64_t>& version = getBucketVersion(objectManager, key);
+
+    // Reads that find the bucket unlocked never take the lock.
+    uint64_t before = version;
+    EXPECT_EQ(0U, before & 1);
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, 0, true));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+    EXPECT_EQ(before, version);
+
+    // If a writer appears to hold the lock, fall back to taking it.
+    buffer.reset();
+    version = before + 1;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, 0, true));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+    EXPECT_EQ(before + 3, version);
+    version = before;
+
+    // Likewise if optimistic reads are disabled.
+    buffer.reset();
+    objectManager.optimisticReads = false;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key, &buffer, 0, 0, true));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+    EXPECT_EQ(before + 2, version);
+
+    // Each read was counted exactly once.
+    EXPECT_EQ(
+        "{ tableId: 0 startKeyHash: 0 "
+            "endKeyHash: 18446744073709551615 state: 0 reads: 0 writes: 0 }\n"
+        "{ tableId: 1 startKeyHash: 0 "
+            "endKeyHash: 18446744073709551615 state: 0 reads: 3 writes: 0 }",
+        tabletManager.toString());
+}
+
+TEST_F(ObjectManagerTest, HashTableBucketLock_version) {
+    Key key(1, "1", 1);
+    std::atomic<uint64_t>& version = getBucketVersion(objectManager, key);
+    uint64_t before = version;
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+        EXPECT_EQ(before + 1, version);
+        ObjectManager::OptimisticBucketRead read(objectManager, key);
+        EXPECT_FALSE(read.mayProceed());
+        EXPECT_FALSE(read.isValid());
+    }
+    EXPECT_EQ(before + 2, version);
+
+    ObjectManager::OptimisticBucketRead read(objectManager, key);
+    EXPECT_TRUE(read.mayProceed());
+    EXPECT_TRUE(read.isValid());
+    {
+        ObjectManager::HashTableBucketLock lock(objectManager, key);
+    }
+    EXPECT_FALSE(read.isValid());
+
+    objectManager.lockAllBuckets();
+    EXPECT_EQ(before + 5, version);
+    objectManager.unlockAllBuckets();
+    EXPECT_EQ(before + 6, version);
+}
+
+TEST_F(ObjectManagerTest, HashTableBucketLock_versionsOnSeparateLines) {
+    EXPECT_EQ(CACHE_LINE_SIZE, sizeof(ObjectManager::BucketVersion));
+    EXPECT_EQ(CACHE_LINE_SIZE,
+            reinterpret_cast<char*>(&objectManager.hashTableBucketVersions[1])
+            - reinterpret_cast<char*>(
+                    &objectManager.hashTableBucketVersions[0]));
+}
+
 static bool
 antiGetEntryFilter(string s)
 {
@@ -786,6 +922,60 @@ TEST_F(ObjectManagerTest, removeOrphanedObjects) {
     EXPECT_EQ(32lu, objectManager.log.totalLiveBytes);
 }
 
+TEST_F(ObjectManagerTest, removeOrphanedObjects_tabletMembership) {
+    objectManager.tabletMembership.construct();
+    Key key1(97, "1", 1);
+    Key key2(97, "2", 1);
+    Key key3(98, "3", 1);
+
+    // Table 97 is split around key2, which is orphaned along with all of
+    // table 98.
+    tabletManager.addTablet(97, 0, key2.getHash() - 1, TabletManager::NORMAL);
+    tabletManager.addTablet(97, key2.getHash(), key2.getHash(),
+                            TabletManager::NORMAL);
+    tabletManager.addTablet(97, key2.getHash() + 1, ~0UL,
+                            TabletManager::NORMAL);
+    tabletManager.addTablet(98, 0, ~0UL, TabletManager::NORMAL);
+    storeObject(key1, "a");
+    storeObject(key2, "b");
+    storeObject(key3, "c");
+    EXPECT_EQ(3U, objectManager.tabletMembership->getNumKeyHashes());
+    tabletManager.deleteTablet(97, key2.getHash(), key2.getHash());
+    tabletManager.deleteTablet(98, 0, ~0UL);
+
+    objectManager.removeOrphanedObjects();
+    EXPECT_EQ(1U, objectManager.tabletMembership->getNumKeyHashes());
+    vector<uint64_t> tableIds;
+    objectManager.tabletMembership->getTableIds(&tableIds);
+    EXPECT_EQ(1U, tableIds.size());
+    EXPECT_EQ(97U, tableIds[0]);
+
+    Buffer value;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key1, &value, NULL, NULL));
+    tabletManager.addTablet(97, key2.getHash(), key2.getHash(),
+                            TabletManager::NORMAL);
+    tabletManager.addTablet(98, 0, ~0UL, TabletManager::NORMAL);
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              objectManager.readObject(key2, &value, NULL, NULL));
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST,
+              objectManager.readObject(key3, &value, NULL, NULL));
+}
+
+TEST_F(ObjectManagerTest, tabletMembership_writeAndRemove) {
+    objectManager.tabletMembership.construct();
+    tabletManager.addTablet(97, 0, ~0UL, TabletManager::NORMAL);
+    Key key(97, "1", 1);
+    storeObject(key, "a");
+    storeObject(key, "b");
+    vector<KeyHash> keyHashes;
+    objectManager.tabletMembership->getKeyHashes(97, 0, ~0UL, &keyHashes);
+    EXPECT_EQ(1U, keyHashes.size());
+    EXPECT_EQ(key.getHash(), keyHashes[0]);
+
+    EXPECT_EQ(STATUS_OK, objectManager.removeObject(key, NULL, NULL));
+    EXPECT_EQ(0U, objectManager.tabletMembership->getNumKeyHashes());
+}
+
 TEST_F(ObjectManagerTest, replaySegment_nextNodeIdMap) {
     ObjectManager::TombstoneProtector p(&objectManager);
     uint32_t segLen = 8192;
@@ -2242,6 +2432,61 @@ TEST_F(ObjectManagerTest, TombstoneProtector) {
             TestLog::get());
 }
 
+TEST_F(ObjectManagerTest, HashTableResizer_shrink) {
+    TestLog::Enable logEnabler("handleTimerEvent");
+    masterConfig.master.hashTableResize = true;
+    HashTable* objectMap = &objectManager.objectMap;
+    ObjectManager::HashTableResizer* resizer = &objectManager.hashTableResizer;
+    EXPECT_EQ(16384lu, objectMap->getNumBuckets());
+
+    Key key1(0, "key1", 4);
+    storeObject(key1, "value1");
+    objectManager.maybeResizeHashTable();
+    EXPECT_TRUE(resizer->isRunning());
+
+    // The table shrinks by half at a time until it reaches one bucket
+    // per lock.
+    for (int i = 0; i < 1000 && resizer->isRunning(); i++) {
+        resizer->stop();
+        resizer->handleTimerEvent();
+    }
+    EXPECT_FALSE(resizer->isRunning());
+    EXPECT_EQ(1024lu, objectMap->getNumBuckets());
+    EXPECT_FALSE(objectMap->isResizing());
+    EXPECT_FALSE(objectMap->hasRetiredBuckets());
+    EXPECT_TRUE(objectManager.optimisticReads);
+    EXPECT_EQ("handleTimerEvent: Resizing hash table from 16384 to 8192 "
+            "buckets (1 entries)",
+            TestLog::get().substr(0, TestLog::get().find(" | ")));
+    EXPECT_NE(string::npos, TestLog::get().find(
+            "Hash table resize complete: 1024 buckets"));
+
+    Buffer buffer;
+    EXPECT_EQ(STATUS_OK, objectManager.readObject(key1, &buffer, 0, 0, true));
+    EXPECT_EQ("value1", string(reinterpret_cast<const char*>(
+            buffer.getRange(0, buffer.size())), buffer.size()));
+}
+
+TEST_F(ObjectManagerTest, HashTableResizer_waitForTombstones) {
+    TestLog::Enable logEnabler("handleTimerEvent");
+    ObjectManager::HashTableResizer* resizer = &objectManager.hashTableResizer;
+    Tub<ObjectManager::TombstoneProtector> protector;
+    protector.construct(&objectManager);
+
+    resizer->handleTimerEvent();
+    EXPECT_TRUE(resizer->isRunning());
+    EXPECT_FALSE(objectManager.objectMap.isResizing());
+    EXPECT_EQ("", TestLog::get());
+    resizer->stop();
+}
+
+TEST_F(ObjectManagerTest, maybeResizeHashTable_disabled) {
+    Key key1(0, "key1", 4);
+    storeObject(key1, "value1");
+    objectManager.maybeResizeHashTable();
+    EXPECT_FALSE(objectManager.hashTableResizer.isRunning());
+}
+
 TEST_F(ObjectManagerTest, lookup_object) {
     Key key(1, "1", 1);
     Buffer buffer;
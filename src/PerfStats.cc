@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <algorithm>
+
 #include "Cycles.h"
 #include "Minimal.h"
 #include "PerfStats.h"
@@ -24,6 +26,7 @@ namespace RAMCloud {
 SpinLock PerfStats::mutex("PerfStats");
 std::vector<PerfStats*> PerfStats::registeredStats;
 int PerfStats::nextThreadId = 1;
+const uint32_t PerfStats::MAX_MIGRATION_STREAMS;
 __thread PerfStats PerfStats::threadStats;
 
 /**
@@ -113,8 +116,16 @@ PerfStats::collectStats(PerfStats* total)
         total->backupWriteOps += stats->backupWriteOps;
         total->backupWriteBytes += stats->backupWriteBytes;
         total->backupWriteActiveCycles += stats->backupWriteActiveCycles;
+        for (uint32_t i = 0; i < WireFormat::ILLEGAL_RPC_TYPE; i++) {
+            total->rpcQueueCount[i] += stats->rpcQueueCount[i];
+            total->rpcQueueCycles[i] += stats->rpcQueueCycles[i];
+        }
         total->migrationPhase1Bytes += stats->migrationPhase1Bytes;
         total->migrationPhase1Cycles += stats->migrationPhase1Cycles;
+        for (uint32_t i = 0; i < MAX_MIGRATION_STREAMS; i++) {
+            total->migrationStreamBytes[i] += stats->migrationStreamBytes[i];
+            total->migrationStreamCycles[i] += stats->migrationStreamCycles[i];
+        }
         total->networkInputBytes += stats->networkInputBytes;
         total->networkOutputBytes += stats->networkOutputBytes;
         total->temp1 += stats->temp1;
@@ -299,6 +310,31 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
             formatMetricRatio(&diff, "backupReadActiveCycles",
             "collectionTime", " %8.3f").c_str()));
 
+    result.append("\nWorker queueing:\n");
+    for (uint32_t i = 0; i < WireFormat::ILLEGAL_RPC_TYPE; i++) {
+        string count = format("rpcQueueCount%u", i);
+        std::vector<double>& values = diff[count];
+        if (std::count(values.begin(), values.end(), 0.0) ==
+                static_cast<int64_t>(values.size())) {
+            // No server executed RPCs with this opcode.
+            continue;
+        }
+        string cycles = format("rpcQueueCycles%u", i);
+        string micros = format("rpcQueueMicros%u", i);
+        for (size_t j = 0; j < values.size(); j++) {
+            diff[micros].push_back(diff[cycles][j] * 1e06
+                    / diff["cyclesPerSecond"][j]);
+        }
+        result.append(format("%-30s %s\n",
+                format("  %s (K)", WireFormat::opcodeSymbol(i)).c_str(),
+                formatMetric(&diff, count.c_str(), " %8.1f", 1e-3).c_str()));
+        result.append(format("%-30s %s\n",
+                format("  %s avg delay (us)",
+                WireFormat::opcodeSymbol(i)).c_str(),
+                formatMetricRatio(&diff, micros.c_str(), count.c_str(),
+                " %8.2f").c_str()));
+    }
+
     result.append("\nMigration:\n");
     result.append(format("%-30s %s\n", "  P1 migrated bytes (MB/s)",
             formatMetricRate(&diff, "migrationPhase1Bytes",
@@ -306,6 +342,24 @@ PerfStats::printClusterStats(Buffer* first, Buffer* second)
     result.append(format("%-30s %s\n", "  P1 load factor",
             formatMetricRatio(&diff, "migrationPhase1Cycles",
             "collectionTime", " %8.3f").c_str()));
+    for (uint32_t i = 0; i < MAX_MIGRATION_STREAMS; i++) {
+        string bytes = format("migrationStream%uBytes", i);
+        std::vector<double>& values = diff[bytes];
+        if (std::count(values.begin(), values.end(), 0.0) ==
+                static_cast<int64_t>(values.size())) {
+            // This stream wasn't used by any server.
+            continue;
+        }
+        result.append(format("%-30s %s\n",
+                format("  Stream %u migrated (MB/s)", i).c_str(),
+                formatMetricRate(&diff, bytes.c_str(),
+                " %8.2f", 1e-6).c_str()));
+        result.append(format("%-30s %s\n",
+                format("  Stream %u load factor", i).c_str(),
+                formatMetricRatio(&diff,
+                format("migrationStream%uCycles", i).c_str(),
+                "collectionTime", " %8.3f").c_str()));
+    }
 
     result.append("\nNetwork:\n");
     result.append(format("%-30s %s\n", "  Input bytes (MB/s)",
@@ -397,8 +451,24 @@ PerfStats::clusterDiff(Buffer* before, Buffer* after,
         ADD_METRIC(backupWriteOps);
         ADD_METRIC(backupWriteBytes);
         ADD_METRIC(backupWriteActiveCycles);
+        for (uint32_t j = 0; j < WireFormat::ILLEGAL_RPC_TYPE; j++) {
+            (*diff)[format("rpcQueueCount%u", j)].push_back(
+                    static_cast<double>(p2.rpcQueueCount[j]
+                    - p1.rpcQueueCount[j]));
+            (*diff)[format("rpcQueueCycles%u", j)].push_back(
+                    static_cast<double>(p2.rpcQueueCycles[j]
+                    - p1.rpcQueueCycles[j]));
+        }
         ADD_METRIC(migrationPhase1Bytes);
         ADD_METRIC(migrationPhase1Cycles);
+        for (uint32_t j = 0; j < MAX_MIGRATION_STREAMS; j++) {
+            (*diff)[format("migrationStream%uBytes", j)].push_back(
+                    static_cast<double>(p2.migrationStreamBytes[j]
+                    - p1.migrationStreamBytes[j]));
+            (*diff)[format("migrationStream%uCycles", j)].push_back(
+                    static_cast<double>(p2.migrationStreamCycles[j]
+                    - p1.migrationStreamCycles[j]));
+        }
         ADD_METRIC(networkInputBytes);
         ADD_METRIC(networkOutputBytes);
         ADD_METRIC(temp1);
@@ -20,6 +20,7 @@
 #include <vector>
 #include "Buffer.h"
 #include "SpinLock.h"
+#include "WireFormat.h"
 
 namespace RAMCloud {
 
@@ -205,6 +206,19 @@ struct PerfStats {
     /// storage device(s) were actively performing backup writes.
     uint64_t backupWriteActiveCycles;
 
+    //--------------------------------------------------------------------
+    // Statistics for worker thread scheduling follow below.
+    //--------------------------------------------------------------------
+
+    /// Total number of RPCs with each opcode that were handed off to
+    /// worker threads.
+    uint64_t rpcQueueCount[WireFormat::ILLEGAL_RPC_TYPE];
+
+    /// Total time (in Cycles::rdtsc ticks) that RPCs with each opcode
+    /// spent waiting for a worker thread, from the time the transport
+    /// handed them to the WorkerManager until a worker was assigned.
+    uint64_t rpcQueueCycles[WireFormat::ILLEGAL_RPC_TYPE];
+
     //--------------------------------------------------------------------
     // Statistics for the migration follow below.
     //--------------------------------------------------------------------
@@ -218,6 +232,20 @@ struct PerfStats {
     /// side to complete replay during Phase 1.
     uint64_t migrationPhase1Cycles;
 
+    /// Maximum number of parallel streams over which a tablet is migrated
+    /// (see ServerConfig::Master::migrationStreams) whose progress is
+    /// recorded separately below.
+    static const uint32_t MAX_MIGRATION_STREAMS = 8;
+
+    /// Total number of bytes put into migration segments for transmit by
+    /// each stream of a migration (all phases).
+    uint64_t migrationStreamBytes[MAX_MIGRATION_STREAMS];
+
+    /// Total amount of time each stream of a migration spent putting items
+    /// into migration segments and waiting for the remote side to replay
+    /// the previous segment it sent.
+    uint64_t migrationStreamCycles[MAX_MIGRATION_STREAMS];
+
     //--------------------------------------------------------------------
     // Statistics for the network follow below.
     //--------------------------------------------------------------------
@@ -31,6 +31,7 @@
 #include "Object.h"
 #include "ObjectFinder.h"
 #include "ProtoBuf.h"
+#include "RequestCoalescer.h"
 #include "RpcTracker.h"
 #include "ShortMacros.h"
 #include "TimeTrace.h"
@@ -60,6 +61,10 @@ RamCloud::RamCloud(CommandLineOptions* options)
     , clientLeaseAgent(new ClientLeaseAgent(this))
     , rpcTracker(new RpcTracker())
     , transactionManager(new ClientTransactionManager())
+    , clientMetrics()
+    , nearCache(NULL)
+    , witnessCache(NULL)
+    , coalescer(NULL)
 {
     coordinatorLocator = options->getExternalStorageLocator();
     if (coordinatorLocator.size() == 0) {
@@ -82,6 +87,10 @@ RamCloud::RamCloud(Context* context)
     , clientLeaseAgent(new ClientLeaseAgent(this))
     , rpcTracker(new RpcTracker())
     , transactionManager(new ClientTransactionManager())
+    , clientMetrics()
+    , nearCache(NULL)
+    , witnessCache(NULL)
+    , coalescer(NULL)
 {
     coordinatorLocator = context->options->getExternalStorageLocator();
     if (coordinatorLocator.size() == 0) {
@@ -101,6 +110,10 @@ RamCloud::RamCloud(const char* locator, const char* clusterName)
     , clientLeaseAgent(new ClientLeaseAgent(this))
     , rpcTracker(new RpcTracker())
     , transactionManager(new ClientTransactionManager())
+    , clientMetrics()
+    , nearCache(NULL)
+    , witnessCache(NULL)
+    , coalescer(NULL)
 {
     clientContext->coordinatorSession->setLocation(locator, clusterName);
 }
@@ -112,6 +125,10 @@ RamCloud::RamCloud(Context* context, const char* locator,
     , clientLeaseAgent(new ClientLeaseAgent(this))
     , rpcTracker(new RpcTracker())
     , transactionManager(new ClientTransactionManager())
+    , clientMetrics()
+    , nearCache(NULL)
+    , witnessCache(NULL)
+    , coalescer(NULL)
 {
     clientContext->coordinatorSession->setLocation(locator, clusterName);
 }
@@ -122,12 +139,17 @@ RamCloud::RamCloud(Context* context, const char* locator,
 
 RamCloud::~RamCloud()
 {
+    // The coalescer is a poller, so it must go before the dispatcher.
+    if (coalescer != NULL)
+        enableCoalescing(0, 0);
     delete clientLeaseAgent;
 
     delete rpcTracker;
     delete realClientContext;
 
     delete transactionManager;
+    delete nearCache;
+    delete witnessCache;
 }
 
 /**
@@ -706,9 +728,18 @@ RamCloud::enumerateTable(uint64_t tableId, bool keysOnly,
  * \param[out] objects
  *      After a successful return, this buffer will contain zero or
  *      more objects from the requested tablet.
+ * \param filter
+ *      If non-NULL, the master only returns objects that match this
+ *      filter, truncated as it says (see TableScanner). NULL means all
+ *      objects are returned. With a filter, the master may return no
+ *      objects before reaching the end of the tablet, because it limits
+ *      how much of its hash table one request scans; in that case wait
+ *      returns \a tabletFirstHash unchanged along with a non-empty state,
+ *      and the request should be repeated with the new state.
  */
 EnumerateTableRpc::EnumerateTableRpc(RamCloud* ramcloud, uint64_t tableId,
-        bool keysOnly, uint64_t tabletFirstHash, Buffer& state, Buffer& objects)
+        bool keysOnly, uint64_t tabletFirstHash, Buffer& state, Buffer& objects,
+        const EnumerationFilter* filter)
     : ObjectRpcWrapper(ramcloud->clientContext, tableId, tabletFirstHash,
             sizeof(WireFormat::Enumerate::Response), &objects)
 {
@@ -717,6 +748,11 @@ EnumerateTableRpc::EnumerateTableRpc(RamCloud* ramcloud, uint64_t tableId,
     reqHdr->tableId = tableId;
     reqHdr->keysOnly = keysOnly;
     reqHdr->tabletFirstHash = tabletFirstHash;
+    if (filter != NULL) {
+        filter->serializeToRequest(reqHdr, &request);
+    } else {
+        EnumerationFilter().serializeToRequest(reqHdr, &request);
+    }
     reqHdr->iteratorBytes = state.size();
     for (Buffer::Iterator it(&state); !it.isDone(); it.next())
         request.append(it.getData(), it.getLength());
@@ -772,6 +808,93 @@ EnumerateTableRpc::wait(Buffer& state)
     return result;
 }
 
+/**
+ * Enable (or disable) client-side caching of objects read with read and
+ * multiRead. Reads of cached objects still go to the master, but the
+ * master only returns the object's data if it has changed; otherwise the
+ * cached copy is used. This saves bandwidth and server work for large,
+ * frequently read, rarely modified objects, but never returns stale data.
+ * Reads that specify RejectRules bypass the cache. Objects cached by
+ * multiRead can satisfy later reads, but not the reverse: read doesn't
+ * receive an object's secondary keys, which multiRead must return.
+ *
+ * \param capacityBytes
+ *      Maximum number of bytes of keys and data to cache; least recently
+ *      used objects are discarded to stay below this. 0 disables the
+ *      cache and discards its contents. Must not be called while a
+ *      multiRead is outstanding.
+ */
+void
+RamCloud::enableNearCache(uint64_t capacityBytes)
+{
+    delete nearCache;
+    nearCache = NULL;
+    if (capacityBytes > 0) {
+        nearCache = new NearCache(capacityBytes, &clientMetrics);
+    }
+}
+
+/**
+ * Enable (or disable) single round-trip writes. When enabled, each
+ * unconditional, single-key write is also recorded on its master's
+ * witnesses (servers chosen by the master, which keep the write until the
+ * master has replicated it), and the master acknowledges the write without
+ * waiting for replication. If a witness doesn't record the write, the
+ * client waits for the master to replicate it, as usual. Writes to masters
+ * that have no witnesses are unaffected.
+ *
+ * \param enable
+ *      True means record writes on witnesses; false means don't.
+ */
+void
+RamCloud::enableWitnesses(bool enable)
+{
+    delete witnessCache;
+    witnessCache = NULL;
+    if (enable) {
+        witnessCache = new WitnessCache();
+    }
+}
+
+/**
+ * Enable (or disable) coalescing of point reads and writes. When enabled,
+ * unconditional reads and synchronous, unconditional writes that are
+ * issued concurrently by different threads are combined into MultiRead
+ * and MultiWrite operations, which reduces the number of RPCs each master
+ * must handle at the cost of some added latency; see RequestCoalescer.
+ * A single thread gains nothing from this, since it issues one request at
+ * a time. Unless this object's context has a dedicated dispatch thread,
+ * threads must not use it for anything else while issuing coalesced
+ * requests (see RequestCoalescer).
+ *
+ * \param windowMicros
+ *      How long (in microseconds) to wait for other requests before
+ *      sending a batch that isn't full.
+ * \param maxBatch
+ *      Batches are sent as soon as they contain this many requests.
+ *      0 means disable coalescing.
+ */
+void
+RamCloud::enableCoalescing(uint32_t windowMicros, uint32_t maxBatch)
+{
+    Dispatch::Lock lock(clientContext->dispatch);
+    delete coalescer;
+    coalescer = NULL;
+    if (maxBatch > 0) {
+        coalescer = new RequestCoalescer(this, windowMicros, maxBatch);
+    }
+}
+
+/**
+ * Return statistics about operations that were handled by this client
+ * object without involving the servers, such as near cache hits.
+ */
+ClientMetrics
+RamCloud::getClientMetrics()
+{
+    return clientMetrics;
+}
+
 /**
  * Retrieve various metrics from a master server's log module.
  *
@@ -1502,7 +1625,33 @@ RamCloud::readHashes(uint64_t tableId, uint32_t numHashes, Buffer* pKHashes,
  */
 ReadHashesRpc::ReadHashesRpc(RamCloud* ramcloud, uint64_t tableId,
         uint32_t numHashes, Buffer* pKHashes, Buffer* response)
-    : ObjectRpcWrapper(ramcloud->clientContext, tableId,
+    : ReadHashesRpc(ramcloud->clientContext, tableId, numHashes, pKHashes,
+            response)
+{
+}
+
+/**
+ * Constructor for ReadHashesRpc that doesn't need a RamCloud object; masters
+ * use this to fetch objects from other masters on behalf of a
+ * LOOKUP_INDEX_OBJECTS request.
+ *
+ * \param context
+ *      Overall information about this RAMCloud server or client.
+ * \param tableId
+ *      Id of the table to read from.
+ * \param numHashes
+ *      Number of primary key hashes in the following buffer.
+ * \param pKHashes
+ *      Buffer of primary key hashes of objects desired in this request.
+ *
+ * \param[out] response
+ *      Return all the objects matching the given primary key hashes
+ *      along with their versions, in the format specified by
+ *      WireFormat::ReadHashes::Response.
+ */
+ReadHashesRpc::ReadHashesRpc(Context* context, uint64_t tableId,
+        uint32_t numHashes, Buffer* pKHashes, Buffer* response)
+    : ObjectRpcWrapper(context, tableId,
             *(pKHashes->getStart<uint64_t>()),
             sizeof(WireFormat::ReadHashes::Response), response)
 {
@@ -1846,6 +1995,114 @@ LookupIndexKeysRpc::wait(uint32_t* numHashes, uint16_t* nextKeyLength,
     *nextKeyHash = respHdr->nextKeyHash;
 }
 
+/**
+ * Constructor for LookupIndexObjectsRpc: looks up a range of keys in an
+ * index like LookupIndexKeysRpc, but asks the index server to also return
+ * the objects for as many of the matching primary key hashes as it can.
+ * The index server reads objects it stores itself and forwards the rest
+ * of the hashes to the masters that store them, so that in the common case
+ * a range lookup needs no separate ReadHashesRpcs.
+ *
+ * \param ramcloud
+ *      The RAMCloud object that governs this RPC.
+ * \param tableId
+ *      Id of the table in which lookup is to be done.
+ * \param indexId
+ *      Id of the index for which keys have to be compared.
+ *      Must be greater than 0. Id 0 is reserved for "primary key".
+ * \param firstKey
+ *      Starting key for the key range in which keys are to be matched.
+ *      The key range includes the firstKey.
+ *      If NULL, then it refers to the lowest possible key for this index.
+ * \param firstKeyLength
+ *      Length in bytes of the firstKey.
+ * \param firstAllowedKeyHash
+ *      Smallest primary key hash value allowed for firstKey.
+ * \param lastKey
+ *      Ending key for the key range in which keys are to be matched.
+ *      The key range includes the lastKey.
+ *      If NULL, then it refers to the highest possible key for this index.
+ * \param lastKeyLength
+ *      Length in byes of the lastKey.
+ * \param maxNumHashes
+ *      Maximum number of hashes that the server is allowed to return
+ *      in a single rpc.
+ *
+ * \param[out] responseBuffer
+ *      Return the primary key hashes, the next key and the objects in the
+ *      format specified by WireFormat::LookupIndexObjects::Response.
+ */
+LookupIndexObjectsRpc::LookupIndexObjectsRpc(
+        RamCloud* ramcloud, uint64_t tableId, uint8_t indexId,
+        const void* firstKey, uint16_t firstKeyLength,
+        uint64_t firstAllowedKeyHash,
+        const void* lastKey, uint16_t lastKeyLength,
+        uint32_t maxNumHashes, Buffer* responseBuffer)
+    : IndexRpcWrapper(ramcloud->clientContext, tableId, indexId,
+            firstKey, firstKeyLength,
+            sizeof(WireFormat::LookupIndexObjects::Response), responseBuffer)
+{
+    WireFormat::LookupIndexObjects::Request* reqHdr(
+            allocHeader<WireFormat::LookupIndexObjects>());
+    reqHdr->tableId = tableId;
+    reqHdr->indexId = indexId;
+    reqHdr->firstKeyLength = firstKeyLength;
+    reqHdr->firstAllowedKeyHash = firstAllowedKeyHash;
+    reqHdr->lastKeyLength = lastKeyLength;
+    reqHdr->maxNumHashes = maxNumHashes;
+    request.append(firstKey, firstKeyLength);
+    request.append(lastKey, lastKeyLength);
+    send();
+}
+
+// See IndexRpcWrapper for documentation.
+void
+LookupIndexObjectsRpc::handleIndexDoesntExist()
+{
+    response->reset();
+    WireFormat::LookupIndexObjects::Response* respHdr =
+            response->emplaceAppend<WireFormat::LookupIndexObjects::Response>();
+    respHdr->common.status = STATUS_OK;
+    respHdr->numHashes = 0;
+    respHdr->nextKeyLength = 0;
+    respHdr->nextKeyHash = 0;
+    respHdr->numHashesRead = 0;
+    respHdr->numObjects = 0;
+}
+
+/**
+ * Wait for a lookupIndexObjects RPC to complete.
+ *
+ * \param[out] numHashes
+ *      Return the number of objects that matched the lookup, for which
+ *      the primary key hashes are being returned here.
+ * \param[out] nextKeyLength
+ *      Length of nextKey in bytes.
+ * \param[out] nextKeyHash
+ *      Results starting at nextKey + nextKeyHash couldn't be returned.
+ *      Client can send another request according to this.
+ * \param[out] numHashesRead
+ *      Number of primary key hashes, starting with the first one, for
+ *      which all matching objects are returned. Objects for the remaining
+ *      hashes must be fetched with ReadHashesRpcs.
+ * \param[out] numObjects
+ *      Number of objects returned.
+ */
+void
+LookupIndexObjectsRpc::wait(uint32_t* numHashes, uint16_t* nextKeyLength,
+        uint64_t* nextKeyHash, uint32_t* numHashesRead, uint32_t* numObjects)
+{
+    simpleWait(context);
+
+    const WireFormat::LookupIndexObjects::Response* respHdr(
+            getResponseHeader<WireFormat::LookupIndexObjects>());
+    *numHashes = respHdr->numHashes;
+    *nextKeyLength = respHdr->nextKeyLength;
+    *nextKeyHash = respHdr->nextKeyHash;
+    *numHashesRead = respHdr->numHashesRead;
+    *numObjects = respHdr->numObjects;
+}
+
 /**
  * Request that the master owning a particular tablet migrate it
  * to another designated master.
@@ -2013,6 +2270,10 @@ RamCloud::read(uint64_t tableId, const void* key, uint16_t keyLength,
         Buffer* value, const RejectRules* rejectRules, uint64_t* version,
         bool* objectExists)
 {
+    if (coalescer != NULL && rejectRules == NULL && nearCache == NULL) {
+        coalescer->read(tableId, key, keyLength, value, version, objectExists);
+        return;
+    }
     ReadRpc rpc(this, tableId, key, keyLength, value, rejectRules);
     rpc.wait(version, objectExists);
 }
@@ -2080,12 +2341,27 @@ ReadRpc::ReadRpc(RamCloud* ramcloud, uint64_t tableId,
         const RejectRules* rejectRules)
     : ObjectRpcWrapper(ramcloud->clientContext, tableId, key, keyLength,
             sizeof(WireFormat::Read::Response), value)
+    , ramcloud(ramcloud)
+    , key()
+    , useNearCache((ramcloud->nearCache != NULL) && (rejectRules == NULL))
+    , cachedEntry()
 {
     value->reset();
     WireFormat::Read::Request* reqHdr(allocHeader<WireFormat::Read>());
     reqHdr->tableId = tableId;
     reqHdr->keyLength = keyLength;
     reqHdr->rejectRules = rejectRules ? *rejectRules : defaultRejectRules;
+    if (useNearCache) {
+        this->key.assign(static_cast<const char*>(key), keyLength);
+        cachedEntry = ramcloud->nearCache->lookup(tableId, key, keyLength);
+        if (cachedEntry) {
+            // Only transfer the object if it has changed since it was
+            // cached; versions of an object never decrease, even across
+            // deletion and recreation.
+            reqHdr->rejectRules.givenVersion = cachedEntry->version;
+            reqHdr->rejectRules.versionLeGiven = 1;
+        }
+    }
     request.append(key, keyLength);
     send();
 }
@@ -2109,16 +2385,57 @@ ReadRpc::wait(uint64_t* version, bool* objectExists)
     waitInternal(context->dispatch);
     const WireFormat::Read::Response* respHdr(
             getResponseHeader<WireFormat::Read>());
+
+    if (cachedEntry && respHdr->common.status == STATUS_WRONG_VERSION) {
+        // The cached copy is still current.
+        ramcloud->clientMetrics.nearCacheHits++;
+        if (version != NULL)
+            *version = cachedEntry->version;
+        response->reset();
+        if (cachedEntry->keysIncluded) {
+            // The entry was cached by multiRead; return just the value.
+            ObjectBuffer object;
+            object.appendExternal(cachedEntry->data.data(),
+                    downCast<uint32_t>(cachedEntry->data.size()));
+            uint32_t valueOffset;
+            object.getValueOffset(&valueOffset);
+            response->appendCopy(cachedEntry->data.data() + valueOffset,
+                    downCast<uint32_t>(cachedEntry->data.size() -
+                    valueOffset));
+        } else {
+            response->appendCopy(cachedEntry->data.data(),
+                    downCast<uint32_t>(cachedEntry->data.size()));
+        }
+        return;
+    }
+
     if (version != NULL)
         *version = respHdr->version;
 
+    // The cache may have been disabled while this RPC was outstanding.
+    if (ramcloud->nearCache == NULL)
+        useNearCache = false;
+
     if (respHdr->common.status != STATUS_OK) {
+        if (useNearCache) {
+            ramcloud->nearCache->remove(tableId, key.data(),
+                    downCast<uint16_t>(key.size()));
+        }
         if (objectExists != NULL &&
                 respHdr->common.status == STATUS_OBJECT_DOESNT_EXIST) {
             *objectExists = false;
         } else {
             ClientException::throwException(HERE, respHdr->common.status);
         }
+    } else if (useNearCache) {
+        if (cachedEntry) {
+            ramcloud->clientMetrics.nearCacheStale++;
+        } else {
+            ramcloud->clientMetrics.nearCacheMisses++;
+        }
+        ramcloud->nearCache->insert(tableId, key.data(),
+                downCast<uint16_t>(key.size()), respHdr->version, false,
+                response, sizeof32(*respHdr), respHdr->length);
     }
 
     // Truncate the response Buffer so that it consists of nothing
@@ -2786,6 +3103,123 @@ RamCloud::testingWaitForAllTabletsNormal(uint64_t tableId, uint64_t timeoutNs)
     clientContext->objectFinder->waitForAllTabletsNormal(tableId, timeoutNs);
 }
 
+/**
+ * Constructor for GetWitnessesRpc: asks the master that owns a key hash for
+ * its witnesses, returning once the RPC has been initiated.
+ *
+ * \param ramcloud
+ *      The RAMCloud object that governs this RPC.
+ * \param tableId
+ *      Table containing keyHash.
+ * \param keyHash
+ *      Selects the master to ask.
+ */
+GetWitnessesRpc::GetWitnessesRpc(RamCloud* ramcloud, uint64_t tableId,
+        uint64_t keyHash)
+    : ObjectRpcWrapper(ramcloud->clientContext, tableId, keyHash,
+            sizeof(WireFormat::GetWitnesses::Response))
+{
+    allocHeader<WireFormat::GetWitnesses>();
+    send();
+}
+
+/**
+ * Wait for a GetWitnessesRpc to complete.
+ *
+ * \param[out] witnesses
+ *      Filled in with the master's witnesses; empty if the master doesn't
+ *      accept witnessed writes.
+ * \return
+ *      The id of the master that responded.
+ */
+ServerId
+GetWitnessesRpc::wait(WitnessCache::WitnessList* witnesses)
+{
+    simpleWait(context);
+    const WireFormat::GetWitnesses::Response* respHdr(
+            getResponseHeader<WireFormat::GetWitnesses>());
+    witnesses->clear();
+    uint32_t offset = sizeof32(*respHdr);
+    for (uint32_t i = 0; i < respHdr->numWitnesses; i++) {
+        const WireFormat::GetWitnesses::Witness* witness =
+                response->getOffset<WireFormat::GetWitnesses::Witness>(
+                offset);
+        offset += sizeof32(*witness);
+        const char* locator = static_cast<const char*>(
+                response->getRange(offset, witness->locatorLength));
+        witnesses->emplace_back(ServerId(witness->serverId),
+                string(locator, witness->locatorLength));
+        offset += witness->locatorLength;
+    }
+    return ServerId(respHdr->masterId);
+}
+
+/**
+ * Constructor for WitnessRecordRpc: sends a copy of a write request to
+ * a witness, returning once the RPC has been initiated.
+ *
+ * \param ramcloud
+ *      The RAMCloud object that governs this RPC.
+ * \param witness
+ *      The witness to record the write on.
+ * \param masterId
+ *      The master the write is sent to.
+ * \param keyHash
+ *      Key hash of the object written.
+ * \param clientId
+ *      Lease id of the client, from the write request.
+ * \param rpcId
+ *      Rpc id of the write, from the write request.
+ * \param writeRequest
+ *      The complete WRITE request, header included.
+ */
+WitnessRecordRpc::WitnessRecordRpc(RamCloud* ramcloud,
+        const WitnessCache::Witness& witness, ServerId masterId,
+        uint64_t keyHash, uint64_t clientId, uint64_t rpcId,
+        Buffer* writeRequest)
+    : RpcWrapper(sizeof(WireFormat::WitnessRecord::Response))
+    , ramcloud(ramcloud)
+{
+    try {
+        session = ramcloud->clientContext->transportManager->getSession(
+                witness.locator);
+    } catch (const TransportException& e) {
+        session = FailSession::get();
+    }
+    WireFormat::WitnessRecord::Request* reqHdr(
+            allocHeader<WireFormat::WitnessRecord>(witness.serverId));
+    reqHdr->masterId = masterId.getId();
+    reqHdr->keyHash = keyHash;
+    reqHdr->clientId = clientId;
+    reqHdr->rpcId = rpcId;
+    reqHdr->requestLength = writeRequest->size();
+    request.append(writeRequest);
+    send();
+}
+
+/**
+ * Wait for a WitnessRecordRpc to complete.
+ *
+ * \return
+ *      True means the witness recorded the write; false means it declined
+ *      (for example, because it holds another write of the same object).
+ *
+ * \throw ClientException
+ *      The witness couldn't be reached, or is no longer a witness.
+ */
+bool
+WitnessRecordRpc::wait()
+{
+    waitInternal(ramcloud->clientContext->dispatch);
+    if (getState() != RpcState::FINISHED)
+        throw ServerNotUpException(HERE);
+    const WireFormat::WitnessRecord::Response* respHdr(
+            getResponseHeader<WireFormat::WitnessRecord>());
+    if (respHdr->common.status != STATUS_OK)
+        ClientException::throwException(HERE, respHdr->common.status);
+    return respHdr->accepted;
+}
+
 /**
  * Replace the value of a given object, or create a new object if none
  * previously existed.
@@ -2825,6 +3259,11 @@ RamCloud::write(uint64_t tableId, const void* key, uint16_t keyLength,
         const void* buf, uint32_t length, const RejectRules* rejectRules,
         uint64_t* version, bool async)
 {
+    if (coalescer != NULL && rejectRules == NULL && !async &&
+            witnessCache == NULL) {
+        coalescer->write(tableId, key, keyLength, buf, length, version);
+        return;
+    }
     WriteRpc rpc(this, tableId, key, keyLength, buf, length, rejectRules,
             async);
     rpc.wait(version);
@@ -3009,6 +3448,10 @@ WriteRpc::WriteRpc(RamCloud* ramcloud, uint64_t tableId,
         const RejectRules* rejectRules, bool async)
     : LinearizableObjectRpcWrapper(ramcloud, true, tableId, key,
             keyLength, sizeof(WireFormat::Write::Response))
+    , masterId()
+    , sends(0)
+    , numWitnessRecords(0)
+    , witnessRecords()
 {
     WireFormat::Write::Request* reqHdr(allocHeader<WireFormat::Write>());
     reqHdr->tableId = tableId;
@@ -3031,6 +3474,8 @@ WriteRpc::WriteRpc(RamCloud* ramcloud, uint64_t tableId,
 
     fillLinearizabilityHeader<WireFormat::Write::Request>(reqHdr);
 
+    if (ramcloud->witnessCache != NULL && rejectRules == NULL && !async)
+        recordOnWitnesses(reqHdr);
     send();
 }
 
@@ -3071,6 +3516,10 @@ WriteRpc::WriteRpc(RamCloud* ramcloud, uint64_t tableId,
     : LinearizableObjectRpcWrapper(ramcloud, true, tableId,
             keyList[0].key, keyList[0].keyLength,
             sizeof(WireFormat::Write::Response))
+    , masterId()
+    , sends(0)
+    , numWitnessRecords(0)
+    , witnessRecords()
 {
     WireFormat::Write::Request* reqHdr(allocHeader<WireFormat::Write>());
     reqHdr->tableId = tableId;
@@ -3100,6 +3549,7 @@ WriteRpc::WriteRpc(RamCloud* ramcloud, uint64_t tableId,
 void
 WriteRpc::wait(uint64_t* version)
 {
+    waitForWitnesses();
     waitInternal(context->dispatch);
     const WireFormat::Write::Response* respHdr(
             getResponseHeader<WireFormat::Write>());
@@ -3111,4 +3561,109 @@ WriteRpc::wait(uint64_t* version)
         ClientException::throwException(HERE, respHdr->common.status);
 }
 
+/**
+ * Arrange for this write to be recorded on the witnesses of its master, so
+ * that the master can acknowledge it before replicating it. Does nothing
+ * if the master has no witnesses or they can't be determined; the write
+ * then proceeds as usual.
+ *
+ * \param reqHdr
+ *      Header of the write request, otherwise complete; its async flag is
+ *      set if the write is recorded.
+ */
+void
+WriteRpc::recordOnWitnesses(WireFormat::Write::Request* reqHdr)
+{
+    WitnessCache* cache = ramcloud->witnessCache;
+    WitnessCache::WitnessList witnesses;
+    try {
+        ServerId owner = context->objectFinder->lookupTablet(tableId,
+                keyHash)->tablet.serverId;
+        if (!cache->lookup(owner, &witnesses)) {
+            GetWitnessesRpc rpc(ramcloud, tableId, keyHash);
+            ServerId responder = rpc.wait(&witnesses);
+            cache->insert(responder, witnesses);
+            if (responder != owner) {
+                // The tablet moved while we were asking; the write will
+                // find its new owner, without witnesses.
+                return;
+            }
+        }
+        masterId = owner;
+    } catch (const ClientException& e) {
+        // Let the write itself report problems such as a missing table.
+        return;
+    }
+    if (witnesses.empty() ||
+            witnesses.size() > WireFormat::GetWitnesses::MAX_WITNESSES)
+        return;
+
+    reqHdr->async = 1;
+    uint64_t clientId = reqHdr->lease.leaseId;
+    uint64_t rpcId = reqHdr->rpcId;
+    for (const WitnessCache::Witness& witness : witnesses) {
+        witnessRecords[numWitnessRecords++].construct(ramcloud, witness,
+                masterId, keyHash, clientId, rpcId, &request);
+    }
+}
+
+/**
+ * Counts the times the request is sent, then sends it as usual.
+ */
+void
+WriteRpc::send()
+{
+    sends++;
+    ObjectRpcWrapper::send();
+}
+
+// See RpcTracker::TrackedRpc for documentation.
+void
+WriteRpc::tryFinish()
+{
+    waitForWitnesses();
+    waitInternal(context->dispatch);
+}
+
+/**
+ * If this write was recorded on witnesses, wait for the witnesses and the
+ * master to respond. If the master acknowledged the write but some witness
+ * didn't record it (or the request had to be resent, perhaps to a different
+ * master), the write might not survive a crash of the master yet, so it is
+ * resent without the async flag: the master recognizes it as a duplicate
+ * and responds once the write has been replicated. The caller must then
+ * wait for that response.
+ */
+void
+WriteRpc::waitForWitnesses()
+{
+    if (numWitnessRecords == 0)
+        return;
+    bool recorded = true;
+    for (uint32_t i = 0; i < numWitnessRecords; i++) {
+        try {
+            if (!witnessRecords[i]->wait())
+                recorded = false;
+        } catch (const ClientException& e) {
+            recorded = false;
+            ramcloud->witnessCache->invalidate(masterId);
+        }
+        witnessRecords[i].destroy();
+    }
+    numWitnessRecords = 0;
+
+    ObjectRpcWrapper::waitInternal(context->dispatch);
+    const WireFormat::Write::Response* respHdr(
+            getResponseHeader<WireFormat::Write>());
+    if (respHdr->common.status != STATUS_OK)
+        return;
+    if (recorded && sends == 1) {
+        ramcloud->clientMetrics.witnessedWrites++;
+        return;
+    }
+    ramcloud->clientMetrics.witnessSyncs++;
+    request.getStart<WireFormat::Write::Request>()->async = 0;
+    send();
+}
+
 }  // namespace RAMCloud
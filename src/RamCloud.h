@@ -16,13 +16,17 @@
 #ifndef RAMCLOUD_RAMCLOUD_H
 #define RAMCLOUD_RAMCLOUD_H
 
+#include "ClientMetrics.h"
 #include "CoordinatorRpcWrapper.h"
+#include "EnumerationFilter.h"
 #include "IndexRpcWrapper.h"
 #include "LinearizableObjectRpcWrapper.h"
+#include "NearCache.h"
 #include "ObjectBuffer.h"
 #include "ObjectRpcWrapper.h"
 #include "OptionParser.h"
 #include "ServerMetrics.h"
+#include "WitnessCache.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -40,6 +44,7 @@ class MultiReadObject;
 class MultiRemoveObject;
 class MultiWriteObject;
 class ObjectFinder;
+class RequestCoalescer;
 class RpcTracker;
 
 /**
@@ -80,8 +85,12 @@ class RamCloud {
     void dropIndex(uint64_t tableId, uint8_t indexId);
     void echo(const char* serviceLocator, const void* message, uint32_t length,
          uint32_t echoLength, Buffer* reply = NULL);
+    void enableCoalescing(uint32_t windowMicros, uint32_t maxBatch);
+    void enableNearCache(uint64_t capacityBytes);
+    void enableWitnesses(bool enable);
     uint64_t enumerateTable(uint64_t tableId, bool keysOnly,
          uint64_t tabletFirstHash, Buffer& state, Buffer& objects);
+    ClientMetrics getClientMetrics();
     void getLogMetrics(const char* serviceLocator,
             ProtoBuf::LogMetrics& logMetrics);
     ServerMetrics getMetrics(uint64_t tableId, const void* key,
@@ -203,6 +212,24 @@ class RamCloud {
     RpcTracker *rpcTracker;
     ClientTransactionManager *transactionManager;
 
+    /// Statistics about this client; see getClientMetrics.
+    ClientMetrics clientMetrics;
+
+    /// Objects recently read by this client, used to avoid transferring
+    /// data that hasn't changed. NULL means the near cache is disabled
+    /// (the default); see enableNearCache.
+    NearCache *nearCache;
+
+    /// Witnesses of the masters this client has written to. NULL means
+    /// writes are never recorded on witnesses (the default); see
+    /// enableWitnesses.
+    WitnessCache *witnessCache;
+
+    /// Combines concurrent reads and writes into multi-operations. NULL
+    /// means each read and write is sent by itself (the default); see
+    /// enableCoalescing.
+    RequestCoalescer *coalescer;
+
   private:
     DISALLOW_COPY_AND_ASSIGN(RamCloud);
 };
@@ -334,7 +361,8 @@ class EchoRpc : public RpcWrapper {
 class EnumerateTableRpc : public ObjectRpcWrapper {
   public:
     EnumerateTableRpc(RamCloud* ramcloud, uint64_t tableId, bool keysOnly,
-            uint64_t tabletFirstHash, Buffer& iter, Buffer& objects);
+            uint64_t tabletFirstHash, Buffer& iter, Buffer& objects,
+            const EnumerationFilter* filter = NULL);
     ~EnumerateTableRpc() {}
     uint64_t wait(Buffer& nextIter);
 
@@ -403,6 +431,20 @@ class GetMetricsLocatorRpc : public RpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(GetMetricsLocatorRpc);
 };
 
+/**
+ * Asks the master owning a given key hash which servers are its witnesses.
+ * Used internally by WriteRpc; see WitnessCache.
+ */
+class GetWitnessesRpc : public ObjectRpcWrapper {
+  public:
+    GetWitnessesRpc(RamCloud* ramcloud, uint64_t tableId, uint64_t keyHash);
+    ~GetWitnessesRpc() {}
+    ServerId wait(WitnessCache::WitnessList* witnesses);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(GetWitnessesRpc);
+};
+
 /**
  * Encapsulate the state of RamCloud:: getRuntimeOption operation
  * allowing to execute asynchronously.
@@ -501,6 +543,8 @@ class ReadHashesRpc : public ObjectRpcWrapper {
   public:
     ReadHashesRpc(RamCloud* ramcloud, uint64_t tableId, uint32_t numHashes,
             Buffer* pKHashes, Buffer* response);
+    ReadHashesRpc(Context* context, uint64_t tableId, uint32_t numHashes,
+            Buffer* pKHashes, Buffer* response);
     ~ReadHashesRpc() {}
     /// \copydoc RpcWrapper::docForWait
     uint32_t wait(uint32_t* numObjects);
@@ -567,6 +611,29 @@ class LookupIndexKeysRpc : public IndexRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(LookupIndexKeysRpc);
 };
 
+/**
+ * Encapsulates the state of a LOOKUP_INDEX_OBJECTS operation, which combines
+ * a lookupIndexKeys operation with reading the matching objects. It is used
+ * by IndexLookup.
+ */
+class LookupIndexObjectsRpc : public IndexRpcWrapper {
+  public:
+    LookupIndexObjectsRpc(RamCloud* ramcloud, uint64_t tableId,
+            uint8_t indexId, const void* firstKey, uint16_t firstKeyLength,
+            uint64_t firstAllowedKeyHash,
+            const void* lastKey, uint16_t lastKeyLength,
+            uint32_t maxNumHashes, Buffer* responseBuffer);
+    ~LookupIndexObjectsRpc() {}
+
+    void handleIndexDoesntExist();
+    void wait(uint32_t* numHashes, uint16_t* nextKeyLength,
+            uint64_t* nextKeyHash, uint32_t* numHashesRead,
+            uint32_t* numObjects);
+
+  PRIVATE:
+    DISALLOW_COPY_AND_ASSIGN(LookupIndexObjectsRpc);
+};
+
 /**
  * Encapsulates the state of a RamCloud::migrateTablet operation,
  * allowing it to execute asynchronously.
@@ -968,6 +1035,22 @@ class ReadRpc : public ObjectRpcWrapper {
     void wait(uint64_t* version = NULL, bool* objectExists = NULL);
 
   PRIVATE:
+    /// The RAMCloud object that governs this RPC.
+    RamCloud* ramcloud;
+
+    /// Copy of the constructor's key, used to update the near cache. It
+    /// is copied because callers may free their key as soon as the
+    /// constructor returns.
+    string key;
+
+    /// True means the result of this read is recorded in the near cache.
+    bool useNearCache;
+
+    /// If the near cache held the object when this RPC started, this
+    /// refers to that copy; the master only returns data if its version
+    /// is newer.
+    NearCache::EntryRef cachedEntry;
+
     DISALLOW_COPY_AND_ASSIGN(ReadRpc);
 };
 
@@ -1051,6 +1134,24 @@ class SplitTabletRpc : public CoordinatorRpcWrapper {
     DISALLOW_COPY_AND_ASSIGN(SplitTabletRpc);
 };
 
+/**
+ * Records a write on one of its master's witnesses, so that the master may
+ * acknowledge the write before replicating it. Used internally by WriteRpc.
+ */
+class WitnessRecordRpc : public RpcWrapper {
+  public:
+    WitnessRecordRpc(RamCloud* ramcloud,
+            const WitnessCache::Witness& witness, ServerId masterId,
+            uint64_t keyHash, uint64_t clientId, uint64_t rpcId,
+            Buffer* writeRequest);
+    ~WitnessRecordRpc() {}
+    bool wait();
+
+  PRIVATE:
+    RamCloud* ramcloud;
+    DISALLOW_COPY_AND_ASSIGN(WitnessRecordRpc);
+};
+
 /**
  * Encapsulates the state of a RamCloud::write operation,
  * allowing it to execute asynchronously.
@@ -1069,6 +1170,28 @@ class WriteRpc : public LinearizableObjectRpcWrapper {
     void wait(uint64_t* version = NULL);
 
   PRIVATE:
+    void recordOnWitnesses(WireFormat::Write::Request* reqHdr);
+    virtual void send();
+    virtual void tryFinish();
+    void waitForWitnesses();
+
+    /// Master the write was sent to, if it was also sent to witnesses.
+    ServerId masterId;
+
+    /// Number of times the request has been sent to a master; a write
+    /// that was sent more than once may not match the records on the
+    /// witnesses.
+    uint32_t sends;
+
+    /// Number of entries of #witnessRecords in use; 0 means the write
+    /// isn't recorded on witnesses (or waitForWitnesses has finished
+    /// with them).
+    uint32_t numWitnessRecords;
+
+    /// RPCs recording this write on the master's witnesses.
+    Tub<WitnessRecordRpc>
+            witnessRecords[WireFormat::GetWitnesses::MAX_WITNESSES];
+
     DISALLOW_COPY_AND_ASSIGN(WriteRpc);
 };
 
@@ -523,6 +523,64 @@ TEST_F(RamCloudTest, read) {
                         value.size()));
 }
 
+TEST_F(RamCloudTest, read_nearCache) {
+    ramcloud->enableNearCache(1000);
+    ramcloud->write(tableId1, "0", 1, "abcdef", 6);
+    Buffer value;
+    uint64_t version;
+
+    // First read: miss.
+    ramcloud->read(tableId1, "0", 1, &value, NULL, &version);
+    EXPECT_EQ("abcdef", TestUtil::toString(&value));
+    EXPECT_EQ(1U, ramcloud->getClientMetrics().nearCacheMisses);
+    EXPECT_EQ(0U, ramcloud->getClientMetrics().nearCacheHits);
+
+    // Unchanged: hit.
+    ramcloud->read(tableId1, "0", 1, &value, NULL, &version);
+    EXPECT_EQ("abcdef", TestUtil::toString(&value));
+    EXPECT_EQ(1U, version);
+    EXPECT_EQ(1U, ramcloud->getClientMetrics().nearCacheHits);
+
+    // Overwritten: the new value is returned.
+    ramcloud->write(tableId1, "0", 1, "xyz", 3);
+    ramcloud->read(tableId1, "0", 1, &value, NULL, &version);
+    EXPECT_EQ("xyz", TestUtil::toString(&value));
+    EXPECT_EQ(2U, version);
+    EXPECT_EQ(1U, ramcloud->getClientMetrics().nearCacheStale);
+
+    // Deleted: the cached copy must not be returned.
+    ramcloud->remove(tableId1, "0", 1);
+    bool objectExists = true;
+    ramcloud->read(tableId1, "0", 1, &value, NULL, &version, &objectExists);
+    EXPECT_FALSE(objectExists);
+    EXPECT_FALSE(ramcloud->nearCache->lookup(tableId1, "0", 1));
+
+    // RejectRules bypass the cache.
+    ramcloud->write(tableId1, "0", 1, "abcdef", 6);
+    RejectRules rules = {0, 1, 0, 0, 0};
+    ramcloud->read(tableId1, "0", 1, &value, &rules);
+    EXPECT_FALSE(ramcloud->nearCache->lookup(tableId1, "0", 1));
+
+    ramcloud->enableNearCache(0);
+    EXPECT_TRUE(ramcloud->nearCache == NULL);
+    EXPECT_EQ(0U, ramcloud->getClientMetrics().nearCacheBytes);
+}
+
+TEST_F(RamCloudTest, read_nearCacheKeyReused) {
+    ramcloud->enableNearCache(1000);
+    ramcloud->write(tableId1, "key0", 4, "abcdef", 6);
+
+    // The caller may reuse its key as soon as the RPC has been started.
+    char key[] = "key0";
+    Buffer value;
+    ReadRpc rpc(ramcloud.get(), tableId1, key, 4, &value);
+    memcpy(key, "junk", 4);
+    rpc.wait();
+    EXPECT_EQ("abcdef", TestUtil::toString(&value));
+    EXPECT_TRUE(ramcloud->nearCache->lookup(tableId1, "key0", 4));
+    EXPECT_FALSE(ramcloud->nearCache->lookup(tableId1, "junk", 4));
+}
+
 TEST_F(RamCloudTest, read_objectExists) {
     Buffer value;
     uint64_t version;
@@ -772,6 +830,97 @@ TEST_F(RamCloudTest, writeNullValue) {
     EXPECT_EQ(0U, valueLength);
 }
 
+TEST(RamCloudWitnessTest, write) {
+    Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+    Context context(true);
+    MockCluster cluster(&context);
+    ServerConfig config = ServerConfig::forTesting();
+    config.services = {WireFormat::MASTER_SERVICE,
+                       WireFormat::ADMIN_SERVICE};
+    config.master.numWitnesses = 1;
+    config.localLocator = "mock:host=master";
+    Server* master = cluster.addServer(config);
+    config.services = {WireFormat::BACKUP_SERVICE,
+                       WireFormat::ADMIN_SERVICE};
+    config.localLocator = "mock:host=backup";
+    Server* backup = cluster.addServer(config);
+    RamCloud ramcloud(&context, "mock:host=coordinator");
+    uint64_t tableId = ramcloud.createTable("table");
+
+    // Witnesses disabled.
+    ramcloud.write(tableId, "0", 1, "abc", 3);
+    EXPECT_EQ(0U, ramcloud.getClientMetrics().witnessedWrites);
+
+    ramcloud.enableWitnesses(true);
+    ramcloud.write(tableId, "0", 1, "def", 3);
+    EXPECT_EQ(1U, ramcloud.getClientMetrics().witnessedWrites);
+    EXPECT_EQ(0U, ramcloud.getClientMetrics().witnessSyncs);
+    Witness* witness =
+            backup->backup->witnesses[master->serverId].get();
+    ASSERT_TRUE(witness != NULL);
+    // The master has synced the write, so the record is gone.
+    EXPECT_EQ(0U, witness->getNumRecords());
+
+    // Another write of the same object is pending on the witness: the
+    // write must wait for the master to sync.
+    witness->record(Key::getHash(tableId, "0", 1), 99, 99, "", 0);
+    ramcloud.write(tableId, "0", 1, "ghi", 3);
+    EXPECT_EQ(1U, ramcloud.getClientMetrics().witnessedWrites);
+    EXPECT_EQ(1U, ramcloud.getClientMetrics().witnessSyncs);
+
+    // Conditional writes don't use witnesses.
+    RejectRules rules;
+    memset(&rules, 0, sizeof(rules));
+    ramcloud.write(tableId, "1", 1, "jkl", 3, &rules);
+    EXPECT_EQ(1U, ramcloud.getClientMetrics().witnessedWrites);
+
+    Buffer value;
+    ramcloud.read(tableId, "0", 1, &value);
+    EXPECT_EQ("ghi", TestUtil::toString(&value));
+
+    ramcloud.enableWitnesses(false);
+    EXPECT_TRUE(ramcloud.witnessCache == NULL);
+}
+
+TEST(RamCloudWitnessTest, write_rejected) {
+    Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+    Context context(true);
+    MockCluster cluster(&context);
+    ServerConfig config = ServerConfig::forTesting();
+    config.services = {WireFormat::MASTER_SERVICE,
+                       WireFormat::ADMIN_SERVICE};
+    config.master.numWitnesses = 1;
+    config.localLocator = "mock:host=master";
+    Server* master = cluster.addServer(config);
+    config.services = {WireFormat::BACKUP_SERVICE,
+                       WireFormat::ADMIN_SERVICE};
+    config.localLocator = "mock:host=backup";
+    Server* backup = cluster.addServer(config);
+    RamCloud ramcloud(&context, "mock:host=coordinator");
+    uint64_t tableId = ramcloud.createTable("table");
+    ramcloud.enableWitnesses(true);
+    ramcloud.write(tableId, "0", 1, "abc", 3);
+    Witness* witness =
+            backup->backup->witnesses[master->serverId].get();
+    ASSERT_TRUE(witness != NULL);
+
+    // The master turns the write away; the witness mustn't keep its
+    // record, or it would hold up later writes of the object.
+    TabletManager* tabletManager = &master->master->tabletManager;
+    tabletManager->changeState(tableId, 0, ~0UL, TabletManager::NORMAL,
+            TabletManager::NOT_READY);
+    WriteRpc rpc(&ramcloud, tableId, "0", 1, "def", 3);
+    EXPECT_EQ(0U, witness->getNumRecords());
+
+    tabletManager->changeState(tableId, 0, ~0UL, TabletManager::NOT_READY,
+            TabletManager::NORMAL);
+    rpc.wait();
+    EXPECT_EQ(1U, ramcloud.getClientMetrics().witnessSyncs);
+    Buffer value;
+    ramcloud.read(tableId, "0", 1, &value);
+    EXPECT_EQ("def", TestUtil::toString(&value));
+}
+
 TEST_F(RamCloudTest, readHashes) {
     uint64_t tableId = ramcloud->createTable("table");
     ramcloud->createIndex(tableId, 1, 0);
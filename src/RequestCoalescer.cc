@@ -0,0 +1,327 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "RequestCoalescer.h"
+#include "ClientException.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a RequestCoalescer. If the dispatcher has a dedicated thread
+ * and this isn't it, the caller must hold a Dispatch::Lock.
+ *
+ * \param ramcloud
+ *      The RAMCloud object used to send batches.
+ * \param windowMicros
+ *      How long (in microseconds) to wait for more requests to arrive
+ *      before sending a batch that isn't full.
+ * \param maxBatch
+ *      Batches are sent as soon as they hold this many requests.
+ */
+RequestCoalescer::RequestCoalescer(RamCloud* ramcloud, uint32_t windowMicros,
+        uint32_t maxBatch)
+    : Poller(ramcloud->clientContext->dispatch, "RequestCoalescer")
+    , ramcloud(ramcloud)
+    , window(windowMicros)
+    , maxBatch(std::max(maxBatch, 1u))
+    , mutex()
+    , batchChanged()
+    , openReads(NULL)
+    , openWrites(NULL)
+    , closedBatches()
+    , polling(false)
+    , inPoll(false)
+{
+}
+
+/**
+ * Invoked by the dispatcher on each pass through its polling loop. Closes
+ * batches whose windows have expired, starts sending closed batches, and
+ * wakes up the threads whose batches have finished.
+ *
+ * Starting a batch may poll the dispatcher itself (for example, while
+ * ObjectFinder waits for a table's configuration to arrive from the
+ * coordinator), which calls this method again. Nested calls return
+ * immediately: the outer call is still constructing one batch's operation
+ * and holds pointers to the others, so none of them may be touched until
+ * it returns.
+ *
+ * \return
+ *      1 means at least one batch finished; 0 otherwise.
+ */
+int
+RequestCoalescer::poll()
+{
+    if (inPoll) {
+        return 0;
+    }
+    inPoll = true;
+    int result;
+    try {
+        result = pollBatches();
+    } catch (...) {
+        inPoll = false;
+        throw;
+    }
+    inPoll = false;
+    return result;
+}
+
+/**
+ * Does all of the work of #poll, which handles re-entrancy.
+ *
+ * \return
+ *      1 means at least one batch finished; 0 otherwise.
+ */
+int
+RequestCoalescer::pollBatches()
+{
+    std::vector<Batch*> batches;
+    {
+        Lock lock(mutex);
+        if (openReads == NULL && openWrites == NULL &&
+                closedBatches.empty()) {
+            return 0;
+        }
+        std::chrono::steady_clock::time_point now =
+                std::chrono::steady_clock::now();
+        if (openReads != NULL && now >= openReads->deadline) {
+            close(&openReads);
+        }
+        if (openWrites != NULL && now >= openWrites->deadline) {
+            close(&openWrites);
+        }
+        batches = closedBatches;
+    }
+
+    // Batches are only modified here once they're closed, so there's no
+    // need to hold the monitor lock while sending them.
+    int result = 0;
+    foreach (Batch* batch, batches) {
+        if (!checkBatch(batch)) {
+            continue;
+        }
+        Lock lock(mutex);
+        closedBatches.erase(std::find(closedBatches.begin(),
+                closedBatches.end(), batch));
+        batch->done = true;
+        batchChanged.notify_all();
+        result = 1;
+    }
+    return result;
+}
+
+/**
+ * Read the current contents of an object, as part of a batch of reads
+ * (see RamCloud::read for documentation of the arguments). This method
+ * returns once the read has completed.
+ *
+ * \throw ClientException
+ *      The read failed, for the same reasons RamCloud::read would throw.
+ */
+void
+RequestCoalescer::read(uint64_t tableId, const void* key, uint16_t keyLength,
+        Buffer* value, uint64_t* version, bool* objectExists)
+{
+    Tub<ObjectBuffer> object;
+    MultiReadObject request(tableId, key, keyLength, &object);
+    Status status;
+    {
+        Lock lock(mutex);
+        Batch* batch = join(&openReads);
+        batch->reads.push_back(&request);
+        if (batch->reads.size() >= maxBatch) {
+            close(&openReads);
+        }
+        waitForBatch(lock, batch);
+        status = request.status;
+        release(batch);
+    }
+
+    if (status == STATUS_OK) {
+        uint32_t length;
+        const void* data = object->getValue(&length);
+        value->reset();
+        value->appendCopy(data, length);
+        if (version != NULL)
+            *version = request.version;
+        if (objectExists != NULL)
+            *objectExists = true;
+        return;
+    }
+    if ((status == STATUS_OBJECT_DOESNT_EXIST) && (objectExists != NULL)) {
+        *objectExists = false;
+        return;
+    }
+    ClientException::throwException(HERE, status);
+}
+
+/**
+ * Write an object, as part of a batch of writes (see RamCloud::write for
+ * documentation of the arguments). This method returns once the write
+ * has completed.
+ *
+ * \throw ClientException
+ *      The write failed, for the same reasons RamCloud::write would throw.
+ */
+void
+RequestCoalescer::write(uint64_t tableId, const void* key, uint16_t keyLength,
+        const void* buf, uint32_t length, uint64_t* version)
+{
+    MultiWriteObject request(tableId, key, keyLength, buf, length);
+    Status status;
+    {
+        Lock lock(mutex);
+        Batch* batch = join(&openWrites);
+        batch->writes.push_back(&request);
+        if (batch->writes.size() >= maxBatch) {
+            close(&openWrites);
+        }
+        waitForBatch(lock, batch);
+        status = request.status;
+        release(batch);
+    }
+
+    if (version != NULL)
+        *version = request.version;
+    if (status != STATUS_OK)
+        ClientException::throwException(HERE, status);
+}
+
+/**
+ * Start sending a closed batch, or check on the progress of one that has
+ * already been started. Only invoked by #poll, without the monitor lock.
+ *
+ * \param batch
+ *      The batch to send.
+ * \return
+ *      True means the batch has finished and the status of each of its
+ *      requests has been filled in; false means it is still in progress.
+ */
+bool
+RequestCoalescer::checkBatch(Batch* batch)
+{
+    try {
+        if (!batch->reads.empty()) {
+            if (!batch->readOp) {
+                batch->readOp.construct(ramcloud, batch->reads.data(),
+                        downCast<uint32_t>(batch->reads.size()));
+            }
+            if (!batch->readOp->isReady()) {
+                return false;
+            }
+        } else {
+            if (!batch->writeOp) {
+                batch->writeOp.construct(ramcloud, batch->writes.data(),
+                        downCast<uint32_t>(batch->writes.size()));
+            }
+            if (!batch->writeOp->isReady()) {
+                return false;
+            }
+        }
+    } catch (ClientException& e) {
+        foreach (MultiReadObject* request, batch->reads) {
+            request->status = e.status;
+        }
+        foreach (MultiWriteObject* request, batch->writes) {
+            request->status = e.status;
+        }
+    }
+    batch->readOp.destroy();
+    batch->writeOp.destroy();
+    return true;
+}
+
+/**
+ * Stop adding requests to an open batch, so that #poll will send it. The
+ * caller must hold the monitor lock.
+ *
+ * \param openBatch
+ *      Either &openReads or &openWrites; must not refer to NULL.
+ */
+void
+RequestCoalescer::close(Batch** openBatch)
+{
+    closedBatches.push_back(*openBatch);
+    *openBatch = NULL;
+}
+
+/**
+ * Add the calling thread to the open batch of a given kind, creating a
+ * new batch if there isn't one. The caller must hold the monitor lock.
+ *
+ * \param openBatch
+ *      Either &openReads or &openWrites.
+ * \return
+ *      The batch the caller should add its request to.
+ */
+RequestCoalescer::Batch*
+RequestCoalescer::join(Batch** openBatch)
+{
+    if (*openBatch == NULL) {
+        *openBatch = new Batch(std::chrono::steady_clock::now() + window);
+    }
+    (*openBatch)->references++;
+    return *openBatch;
+}
+
+/**
+ * Called by each thread once it has collected its result from a batch;
+ * deletes the batch once all of the threads are done with it. The caller
+ * must hold the monitor lock.
+ */
+void
+RequestCoalescer::release(Batch* batch)
+{
+    batch->references--;
+    if (batch->references == 0) {
+        delete batch;
+    }
+}
+
+/**
+ * Wait for the batch containing the caller's request to finish. If the
+ * caller may poll the dispatcher and no other thread is doing so, the
+ * caller polls it until its batch finishes; otherwise it sleeps.
+ *
+ * \param lock
+ *      Holds the monitor lock; it is released while waiting.
+ * \param batch
+ *      The batch containing the caller's request.
+ */
+void
+RequestCoalescer::waitForBatch(Lock& lock, Batch* batch)
+{
+    Dispatch* dispatch = ramcloud->clientContext->dispatch;
+    while (!batch->done) {
+        if (!polling && dispatch->isDispatchThread()) {
+            polling = true;
+            while (!batch->done) {
+                lock.unlock();
+                dispatch->poll();
+                lock.lock();
+            }
+            polling = false;
+
+            // Some other waiting thread must take over polling.
+            batchChanged.notify_all();
+            return;
+        }
+        batchChanged.wait(lock);
+    }
+}
+
+} // namespace RAMCloud
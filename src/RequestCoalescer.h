@@ -0,0 +1,152 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_REQUESTCOALESCER_H
+#define RAMCLOUD_REQUESTCOALESCER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "Dispatch.h"
+#include "MultiRead.h"
+#include "MultiWrite.h"
+
+namespace RAMCloud {
+
+/**
+ * A RequestCoalescer combines point reads and writes that are issued
+ * concurrently by different threads into MultiRead and MultiWrite
+ * operations, so that each master receives one MULTI_OP RPC per batch
+ * instead of one RPC per request. RamCloud::read and RamCloud::write use
+ * it once RamCloud::enableCoalescing has been invoked.
+ *
+ * Requests are collected into a batch until either the batch holds
+ * maxBatch requests or windowMicros have elapsed since the first request
+ * in the batch arrived; requests that arrive after that start a new
+ * batch. Batches are sent and completed by #poll, which runs as a
+ * Dispatch::Poller, so all RPCs are issued from whichever thread is
+ * polling the dispatcher. If the RamCloud object's context has a
+ * dedicated dispatch thread, that thread does the work and the requesting
+ * threads just sleep. Otherwise one requesting thread at a time polls the
+ * dispatcher on behalf of all of them, and hands the job to another
+ * waiting thread once its own request completes. In that case nothing
+ * else may use the RamCloud object concurrently, since Dispatch does no
+ * locking of its own.
+ *
+ * This class is thread-safe.
+ */
+class RequestCoalescer : public Dispatch::Poller {
+  public:
+    RequestCoalescer(RamCloud* ramcloud, uint32_t windowMicros,
+            uint32_t maxBatch);
+    ~RequestCoalescer() {}
+    int poll();
+    void read(uint64_t tableId, const void* key, uint16_t keyLength,
+            Buffer* value, uint64_t* version, bool* objectExists);
+    void write(uint64_t tableId, const void* key, uint16_t keyLength,
+            const void* buf, uint32_t length, uint64_t* version);
+
+  PRIVATE:
+    typedef std::unique_lock<std::mutex> Lock;
+
+    /**
+     * A group of requests of one type that will be sent together.
+     */
+    struct Batch {
+        explicit Batch(std::chrono::steady_clock::time_point deadline)
+            : reads()
+            , writes()
+            , deadline(deadline)
+            , readOp()
+            , writeOp()
+            , done(false)
+            , references(0)
+        {}
+
+        /// Requests in the batch; only one of these is used, depending
+        /// on the kind of batch.
+        std::vector<MultiReadObject*> reads;
+        std::vector<MultiWriteObject*> writes;
+
+        /// Time at which the batch will be sent, even if it isn't full.
+        std::chrono::steady_clock::time_point deadline;
+
+        /// The operation sending the batch, once it has been started;
+        /// only one of these is used. Only accessed by #poll.
+        Tub<MultiRead> readOp;
+        Tub<MultiWrite> writeOp;
+
+        /// True means the batch has been sent and the status of each of
+        /// its requests has been filled in.
+        bool done;
+
+        /// Number of threads with requests in this batch; the last one
+        /// to finish with it deletes it.
+        int references;
+    };
+
+    bool checkBatch(Batch* batch);
+    void close(Batch** openBatch);
+    Batch* join(Batch** openBatch);
+    int pollBatches();
+    void release(Batch* batch);
+    void waitForBatch(Lock& lock, Batch* batch);
+
+    /// Used to issue requests.
+    RamCloud* ramcloud;
+
+    /// How long to wait for more requests before sending a batch.
+    std::chrono::microseconds window;
+
+    /// Batches are sent as soon as they contain this many requests.
+    uint32_t maxBatch;
+
+    /// Monitor-style lock protecting all of the fields below.
+    std::mutex mutex;
+
+    /// Notified whenever a batch has been sent, or a thread stops polling
+    /// the dispatcher.
+    std::condition_variable batchChanged;
+
+    /// The batch to which new reads are added; NULL means the next read
+    /// will start a new batch.
+    Batch* openReads;
+
+    /// The batch to which new writes are added; NULL means the next
+    /// write will start a new batch.
+    Batch* openWrites;
+
+    /// Batches that no longer accept requests but haven't finished yet,
+    /// in the order they were closed.
+    std::vector<Batch*> closedBatches;
+
+    /// True means one of the threads in #waitForBatch is polling the
+    /// dispatcher; the others sleep until it stops.
+    bool polling;
+
+    /// True means #poll is running; nested calls to it do nothing. Only
+    /// accessed by the thread polling the dispatcher, so it isn't covered
+    /// by the monitor lock.
+    bool inPoll;
+
+    DISALLOW_COPY_AND_ASSIGN(RequestCoalescer);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_REQUESTCOALESCER_H
@@ -0,0 +1,325 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <thread>
+
+#include "TestUtil.h"
+#include "MockCluster.h"
+#include "MultiRead.h"
+#include "MultiWrite.h"
+#include "ObjectFinder.h"
+#include "RequestCoalescer.h"
+
+namespace RAMCloud {
+
+/**
+ * Makes a table's configuration arrive asynchronously: the first few
+ * fetches report that it hasn't arrived yet, so ObjectFinder polls the
+ * dispatcher while it waits.
+ */
+struct SlowConfigFetcher : public ObjectFinder::TableConfigFetcher {
+    SlowConfigFetcher(ObjectFinder::TableConfigFetcher* fetcher,
+            RequestCoalescer* coalescer)
+        : fetcher(fetcher)
+        , coalescer(coalescer)
+        , delays(3)
+        , nestedPolls(0)
+    {}
+
+    bool
+    tryGetTableConfig(uint64_t tableId,
+            std::map<TabletKey, TabletWithLocator>* tableMap,
+            std::multimap<std::pair<uint64_t, uint8_t>,
+                    IndexletWithLocator>* tableIndexMap)
+    {
+        if (delays > 0) {
+            delays--;
+            if (coalescer->inPoll) {
+                nestedPolls++;
+            }
+            return false;
+        }
+        return fetcher->tryGetTableConfig(tableId, tableMap, tableIndexMap);
+    }
+
+    std::unique_ptr<ObjectFinder::TableConfigFetcher> fetcher;
+    RequestCoalescer* coalescer;
+    int delays;
+    int nestedPolls;
+
+    DISALLOW_COPY_AND_ASSIGN(SlowConfigFetcher);
+};
+
+class RequestCoalescerTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    Tub<RamCloud> ramcloud;
+    uint64_t tableId;
+
+    RequestCoalescerTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , ramcloud()
+        , tableId(-1)
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+
+        ServerConfig config = ServerConfig::forTesting();
+        config.services = {WireFormat::MASTER_SERVICE,
+                           WireFormat::ADMIN_SERVICE};
+        config.localLocator = "mock:host=master1";
+        cluster.addServer(config);
+
+        ramcloud.construct(&context, "mock:host=coordinator");
+        tableId = ramcloud->createTable("table1");
+    }
+
+    string
+    valueString(Tub<ObjectBuffer>* object)
+    {
+        uint32_t length;
+        const char* value = (*object)->get<char>(&length);
+        return string(value, length);
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(RequestCoalescerTest);
+};
+
+TEST_F(RequestCoalescerTest, readAndWrite) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    uint64_t writeVersion = 0;
+    coalescer.write(tableId, "0", 1, "abcde", 5, &writeVersion);
+    EXPECT_NE(0U, writeVersion);
+
+    Buffer value;
+    uint64_t readVersion = 0;
+    bool exists = false;
+    coalescer.read(tableId, "0", 1, &value, &readVersion, &exists);
+    EXPECT_EQ("abcde", TestUtil::toString(&value));
+    EXPECT_EQ(writeVersion, readVersion);
+    EXPECT_TRUE(exists);
+    EXPECT_TRUE(coalescer.openReads == NULL);
+    EXPECT_TRUE(coalescer.openWrites == NULL);
+}
+
+TEST_F(RequestCoalescerTest, read_objectDoesntExist) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    Buffer value;
+    bool exists = true;
+    coalescer.read(tableId, "missing", 7, &value, NULL, &exists);
+    EXPECT_FALSE(exists);
+
+    EXPECT_THROW(coalescer.read(tableId, "missing", 7, &value, NULL, NULL),
+            ObjectDoesntExistException);
+}
+
+TEST_F(RequestCoalescerTest, write_error) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    EXPECT_THROW(coalescer.write(tableId + 1, "0", 1, "abc", 3, NULL),
+            TableDoesntExistException);
+}
+
+TEST_F(RequestCoalescerTest, multipleThreads) {
+    RequestCoalescer coalescer(ramcloud.get(), 100, 4);
+    std::atomic<int> errors(0);
+    auto worker = [&](int id) {
+        for (int i = 0; i < 20; i++) {
+            string key = format("%d.%d", id, i);
+            string value = format("value %d.%d", id, i);
+            try {
+                coalescer.write(tableId, key.data(),
+                        downCast<uint16_t>(key.size()), value.data(),
+                        downCast<uint32_t>(value.size()), NULL);
+                Buffer result;
+                coalescer.read(tableId, key.data(),
+                        downCast<uint16_t>(key.size()), &result, NULL, NULL);
+                if (TestUtil::toString(&result) != value) {
+                    errors++;
+                }
+            } catch (ClientException& e) {
+                errors++;
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int id = 0; id < 8; id++) {
+        threads.emplace_back(worker, id);
+    }
+    foreach (std::thread& thread, threads) {
+        thread.join();
+    }
+    EXPECT_EQ(0, errors.load());
+    EXPECT_FALSE(coalescer.polling);
+    EXPECT_EQ(0U, coalescer.closedBatches.size());
+}
+
+TEST_F(RequestCoalescerTest, poll_tableConfigArrivesLater) {
+    ramcloud->write(tableId, "0", 1, "abcde");
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    ObjectFinder* objectFinder = ramcloud->clientContext->objectFinder;
+    SlowConfigFetcher* fetcher = new SlowConfigFetcher(
+            objectFinder->tableConfigFetcher.release(), &coalescer);
+    objectFinder->tableConfigFetcher.reset(fetcher);
+    objectFinder->flush(tableId);
+
+    // Starting the batch polls the dispatcher until the configuration
+    // arrives; the nested calls to poll must leave the batch alone.
+    Buffer value;
+    coalescer.read(tableId, "0", 1, &value, NULL, NULL);
+    EXPECT_EQ("abcde", TestUtil::toString(&value));
+    EXPECT_EQ(0, fetcher->delays);
+    EXPECT_EQ(3, fetcher->nestedPolls);
+    EXPECT_FALSE(coalescer.inPoll);
+    EXPECT_EQ(0U, coalescer.closedBatches.size());
+}
+
+TEST_F(RequestCoalescerTest, poll_closesExpiredBatches) {
+    RequestCoalescer coalescer(ramcloud.get(), 100000000, 8);
+    Tub<ObjectBuffer> value;
+    MultiReadObject request(tableId, "0", 1, &value);
+    RequestCoalescer::Batch* batch = coalescer.join(&coalescer.openReads);
+    batch->reads.push_back(&request);
+    EXPECT_EQ(0, coalescer.poll());
+    EXPECT_EQ(batch, coalescer.openReads);
+
+    batch->deadline = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000 && !batch->done; i++) {
+        ramcloud->poll();
+    }
+    EXPECT_TRUE(batch->done);
+    EXPECT_TRUE(coalescer.openReads == NULL);
+    EXPECT_EQ(0U, coalescer.closedBatches.size());
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST, request.status);
+    coalescer.release(batch);
+}
+
+TEST_F(RequestCoalescerTest, checkBatch_combinesReads) {
+    ramcloud->write(tableId, "0", 1, "first");
+    ramcloud->write(tableId, "1", 1, "second");
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    RequestCoalescer::Batch batch(std::chrono::steady_clock::now());
+    Tub<ObjectBuffer> value0, value1, value2;
+    MultiReadObject request0(tableId, "0", 1, &value0);
+    MultiReadObject request1(tableId, "1", 1, &value1);
+    MultiReadObject request2(tableId, "2", 1, &value2);
+    batch.reads.push_back(&request0);
+    batch.reads.push_back(&request1);
+    batch.reads.push_back(&request2);
+    while (!coalescer.checkBatch(&batch)) {
+        ramcloud->poll();
+    }
+
+    EXPECT_FALSE(batch.readOp);
+    EXPECT_EQ(STATUS_OK, request0.status);
+    EXPECT_EQ("first", valueString(&value0));
+    EXPECT_EQ(STATUS_OK, request1.status);
+    EXPECT_EQ("second", valueString(&value1));
+    EXPECT_EQ(STATUS_OBJECT_DOESNT_EXIST, request2.status);
+}
+
+TEST_F(RequestCoalescerTest, checkBatch_combinesWrites) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    RequestCoalescer::Batch batch(std::chrono::steady_clock::now());
+    MultiWriteObject request0(tableId, "0", 1, "abc", 3);
+    MultiWriteObject request1(tableId, "1", 1, "xyz", 3);
+    batch.writes.push_back(&request0);
+    batch.writes.push_back(&request1);
+    while (!coalescer.checkBatch(&batch)) {
+        ramcloud->poll();
+    }
+
+    EXPECT_FALSE(batch.writeOp);
+    EXPECT_EQ(STATUS_OK, request0.status);
+    EXPECT_EQ(STATUS_OK, request1.status);
+    Buffer value;
+    ramcloud->read(tableId, "1", 1, &value);
+    EXPECT_EQ("xyz", TestUtil::toString(&value));
+}
+
+TEST_F(RequestCoalescerTest, join) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    RequestCoalescer::Batch* batch = coalescer.join(&coalescer.openReads);
+    EXPECT_EQ(batch, coalescer.openReads);
+    EXPECT_EQ(1, batch->references);
+
+    EXPECT_EQ(batch, coalescer.join(&coalescer.openReads));
+    EXPECT_EQ(2, batch->references);
+    EXPECT_TRUE(coalescer.openWrites == NULL);
+
+    coalescer.close(&coalescer.openReads);
+    EXPECT_TRUE(coalescer.openReads == NULL);
+    EXPECT_EQ(batch, coalescer.closedBatches.back());
+    EXPECT_NE(batch, coalescer.join(&coalescer.openReads));
+
+    coalescer.closedBatches.clear();
+    coalescer.release(batch);
+    coalescer.release(batch);
+    coalescer.release(coalescer.openReads);
+    coalescer.openReads = NULL;
+}
+
+TEST_F(RequestCoalescerTest, waitForBatch_fullBatchSentImmediately) {
+    // With a long window, the batch would only be sent early because it
+    // is full.
+    RequestCoalescer coalescer(ramcloud.get(), 100000000, 1);
+    Buffer value;
+    bool exists = true;
+    coalescer.read(tableId, "0", 1, &value, NULL, &exists);
+    EXPECT_FALSE(exists);
+}
+
+TEST_F(RequestCoalescerTest, waitForBatch_anotherThreadPolling) {
+    RequestCoalescer coalescer(ramcloud.get(), 0, 8);
+    RequestCoalescer::Batch* batch = coalescer.join(&coalescer.openReads);
+    coalescer.close(&coalescer.openReads);
+    coalescer.polling = true;
+    std::thread waiter([&] {
+        RequestCoalescer::Lock lock(coalescer.mutex);
+        coalescer.waitForBatch(lock, batch);
+    });
+
+    // The waiter must sleep rather than poll, so the batch is never
+    // sent.
+    usleep(1000);
+    {
+        RequestCoalescer::Lock lock(coalescer.mutex);
+        EXPECT_EQ(1U, coalescer.closedBatches.size());
+        EXPECT_FALSE(batch->done);
+        coalescer.closedBatches.clear();
+        batch->done = true;
+        coalescer.batchChanged.notify_all();
+    }
+    waiter.join();
+    EXPECT_TRUE(coalescer.polling);
+    coalescer.release(batch);
+}
+
+TEST_F(RequestCoalescerTest, ramCloudUsesCoalescer) {
+    ramcloud->enableCoalescing(0, 8);
+    EXPECT_TRUE(ramcloud->coalescer != NULL);
+    uint64_t version;
+    ramcloud->write(tableId, "0", 1, "abc", 3, NULL, &version);
+    Buffer value;
+    ramcloud->read(tableId, "0", 1, &value);
+    EXPECT_EQ("abc", TestUtil::toString(&value));
+
+    ramcloud->enableCoalescing(0, 0);
+    EXPECT_TRUE(ramcloud->coalescer == NULL);
+}
+
+}  // namespace RAMCloud
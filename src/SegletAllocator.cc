@@ -20,6 +20,7 @@
 #include "Segment.h"
 #include "ServerConfig.h"
 #include "ShortMacros.h"
+#include "Util.h"
 
 namespace RAMCloud {
 
@@ -43,14 +44,22 @@ SegletAllocator::SegletAllocator(const ServerConfig* config)
       cleanerPoolReserve(0),
       defaultPool(),
       segletToSegmentTable(),
-      block(config->master.logBytes, config->master.useHugepages)
+      block(config->master.logBytes, config->master.useHugepages,
+            parseNumaPolicy(config->master.logMemoryNumaPolicy)),
+      numaNodes(block.numaNodes),
+      segletsPerNode(block.bytesPerNumaNode / segletSize)
 {
     assert(BitOps::isPowerOfTwo(segletSize));
+    if (segletsPerNode == 0) {
+        numaNodes = 1;
+        segletsPerNode = block.length / segletSize;
+    }
+
     uint8_t* segletBlock = block.get();
     for (size_t i = 0; i < (block.length / segletSize); i++) {
         Seglet* seglet = new Seglet(*this, segletBlock, segletSize);
         segletToSegmentTable.push_back(NULL);
-        defaultPool.push_back(seglet);
+        defaultPool.push(seglet, getNumaNode(segletBlock));
         segletBlock += segletSize;
     }
 }
@@ -69,11 +78,10 @@ SegletAllocator::~SegletAllocator()
     if (totalFree != expectedFree)
         LOG(WARNING, "Destructor called before all seglets freed!");
 
-    foreach (Seglet* s, emergencyHeadPool)
-        delete s;
-    foreach (Seglet* s, cleanerPool)
-        delete s;
-    foreach (Seglet* s, defaultPool)
+    vector<Seglet*> seglets(emergencyHeadPool);
+    cleanerPool.take(downCast<uint32_t>(cleanerPool.size()), -1, seglets);
+    defaultPool.take(downCast<uint32_t>(defaultPool.size()), -1, seglets);
+    foreach (Seglet* s, seglets)
         delete s;
 }
 
@@ -110,11 +118,17 @@ SegletAllocator::getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m)
  *      The number of seglets to allocate.
  * \param[out] outSeglets
  *      Vector in which allocated seglets will be returned.
+ * \param numaNode
+ *      If non-negative, prefer seglets placed on this NUMA node (see
+ *      getNumaNode()). Seglets from other nodes are used if there aren't
+ *      enough local ones; see NodePool::take() for the order. Ignored for
+ *      emergency heads.
  */
 bool
 SegletAllocator::alloc(AllocationType type,
                        uint32_t count,
-                       vector<Seglet*>& outSeglets)
+                       vector<Seglet*>& outSeglets,
+                       int numaNode)
 {
     std::lock_guard<SpinLock> guard(lock);
 
@@ -122,9 +136,9 @@ SegletAllocator::alloc(AllocationType type,
         return allocFromPool(emergencyHeadPool, count, outSeglets);
 
     if (type == CLEANER)
-        return allocFromPool(cleanerPool, count, outSeglets);
+        return cleanerPool.take(count, numaNode, outSeglets);
 
-    return allocFromPool(defaultPool, count, outSeglets);
+    return defaultPool.take(count, numaNode, outSeglets);
 }
 
 /**
@@ -148,7 +162,7 @@ SegletAllocator::initializeEmergencyHeadReserve(uint32_t numSeglets)
     if (emergencyHeadPoolReserve != 0)
         return false;
 
-    if (!allocFromPool(defaultPool, numSeglets, emergencyHeadPool))
+    if (!defaultPool.take(numSeglets, -1, emergencyHeadPool))
         return false;
 
     foreach (Seglet* seglet, emergencyHeadPool)
@@ -186,8 +200,11 @@ SegletAllocator::initializeCleanerReserve(uint32_t numSeglets)
     if (cleanerPoolReserve != 0)
         return false;
 
-    if (!allocFromPool(defaultPool, numSeglets, cleanerPool))
+    vector<Seglet*> seglets;
+    if (!defaultPool.take(numSeglets, -1, seglets))
         return false;
+    foreach (Seglet* seglet, seglets)
+        cleanerPool.push(seglet, getNumaNode(seglet->get()));
 
     LOG(NOTICE, "Reserved %u seglets for the cleaner (%lu MB). %lu seglets "
         "(%lu MB) left in default pool.",
@@ -232,15 +249,16 @@ SegletAllocator::free(Seglet* seglet)
     // space in the cleaner reserve. The cleaner maintains the invariant that
     // after every pass it has consumed no more seglets than it has freed. Thus
     // this pool should never remain non-full for long.
+    int numaNode = getNumaNode(seglet->get());
     if (cleanerPool.size() < cleanerPoolReserve) {
-        cleanerPool.push_back(seglet);
+        cleanerPool.push(seglet, numaNode);
         return;
     }
 
     // If we're making forward progress, any excess clean seglets accumulate in
     // the default pool. New log heads can allocate from this to service new
     // log appends.
-    defaultPool.push_back(seglet);
+    defaultPool.push(seglet, numaNode);
 }
 
 /**
@@ -328,6 +346,27 @@ SegletAllocator::getMemoryUtilization()
                          maxDefaultPoolSize);
 }
 
+/**
+ * Return the NUMA node the memory at the given address was placed on. The
+ * pointer must refer to memory inside one of this allocator's seglets.
+ */
+int
+SegletAllocator::getNumaNode(const void* p)
+{
+    size_t node = getSegletIndex(p) / segletsPerNode;
+    return downCast<int>(std::min(node, static_cast<size_t>(numaNodes - 1)));
+}
+
+/**
+ * Return the number of NUMA nodes seglet memory is spread across. Node
+ * numbers returned by getNumaNode() are in the range [0, this value).
+ */
+int
+SegletAllocator::getNumaNodeCount()
+{
+    return numaNodes;
+}
+
 /**
  * XXX
  */
@@ -400,4 +439,95 @@ SegletAllocator::allocFromPool(vector<Seglet*>& pool,
     return true;
 }
 
+/**
+ * Add a free seglet to the pool.
+ *
+ * \param seglet
+ *      The seglet to add.
+ * \param numaNode
+ *      The NUMA node the seglet's memory is placed on (see getNumaNode()).
+ */
+void
+SegletAllocator::NodePool::push(Seglet* seglet, int numaNode)
+{
+    size_t node = downCast<size_t>(numaNode);
+    if (node >= lists.size())
+        lists.resize(node + 1);
+    lists[node].push_back(seglet);
+    numSeglets++;
+}
+
+/**
+ * Remove the given number of seglets from the pool, preferring those on a
+ * particular NUMA node. If the pool holds fewer than \a count seglets,
+ * remove nothing and return false.
+ *
+ * Seglets are taken in this order:
+ *   1) From \a numaNode's list, most recently freed first (they are the
+ *      likeliest to still be cached).
+ *   2) If that list runs out, from the lists of nodes numaNode + 1,
+ *      numaNode + 2, and so on, wrapping around after the last node.
+ * Seglets are appended to \a outSeglets in the order they are taken, so the
+ * ones from \a numaNode come first.
+ *
+ * \param count
+ *      The number of seglets to take.
+ * \param numaNode
+ *      Node to prefer seglets from. If negative, start with whichever node
+ *      has the most free seglets, which keeps the nodes evenly used.
+ * \param[out] outSeglets
+ *      Vector to return the seglets in.
+ * \return
+ *      True if the full allocation succeeded, otherwise false.
+ */
+bool
+SegletAllocator::NodePool::take(uint32_t count,
+                                int numaNode,
+                                vector<Seglet*>& outSeglets)
+{
+    if (numSeglets < count)
+        return false;
+    if (count == 0)
+        return true;
+
+    size_t first = 0;
+    if (numaNode >= 0 && downCast<size_t>(numaNode) < lists.size()) {
+        first = downCast<size_t>(numaNode);
+    } else {
+        for (size_t node = 1; node < lists.size(); node++) {
+            if (lists[node].size() > lists[first].size())
+                first = node;
+        }
+    }
+
+    size_t remaining = count;
+    for (size_t i = 0; i < lists.size() && remaining > 0; i++) {
+        vector<Seglet*>& list = lists[(first + i) % lists.size()];
+        size_t fromList = std::min(remaining, list.size());
+        outSeglets.insert(outSeglets.end(), list.rbegin(),
+                          list.rbegin() + fromList);
+        list.erase(list.end() - fromList, list.end());
+        remaining -= fromList;
+    }
+    numSeglets -= count;
+    return true;
+}
+
+/**
+ * Convert the log memory NUMA policy named in the server's configuration
+ * (see ServerConfig::Master::logMemoryNumaPolicy) to the corresponding
+ * NumaPlacement.
+ */
+NumaPlacement
+SegletAllocator::parseNumaPolicy(const string& policy)
+{
+    if (policy == "split")
+        return NumaPlacement::SPLIT;
+    if (policy == "interleave")
+        return NumaPlacement::INTERLEAVE;
+    if (policy == "local")
+        return NumaPlacement::DEFAULT;
+    DIE("Unknown log memory NUMA policy specified: \"%s\"", policy.c_str());
+}
+
 } // end RAMCloud
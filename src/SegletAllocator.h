@@ -56,6 +56,12 @@ class LogSegment;
  * segments and are freed by the Segment class they're assigned to, either at
  * destruction time, or when the segment is closed and told to free unused
  * seglets that have not had data appended to them.
+ *
+ * On NUMA machines the block of memory backing the seglets may be split into
+ * one contiguous range per node, each placed on its own node (see
+ * NumaPlacement::SPLIT). Callers that care
+ * (the log cleaner, mostly) can ask for seglets from a particular node so
+ * that the memory they touch is local to the core they run on.
  */
 class SegletAllocator {
   public:
@@ -75,7 +81,8 @@ class SegletAllocator {
     void getMetrics(ProtoBuf::LogMetrics_SegletMetrics& m);
     bool alloc(AllocationType type,
                uint32_t count,
-               vector<Seglet*>& outSeglets);
+               vector<Seglet*>& outSeglets,
+               int numaNode = -1);
     bool initializeEmergencyHeadReserve(uint32_t numSeglets);
     bool initializeCleanerReserve(uint32_t numSeglets);
     void free(Seglet* seglet);
@@ -86,14 +93,41 @@ class SegletAllocator {
     const void* getBaseAddress();
     uint64_t getTotalBytes();
     int getMemoryUtilization();
+    int getNumaNode(const void* p);
+    int getNumaNodeCount();
     LogSegment* getOwnerSegment(const void* p);
     void setOwnerSegment(Seglet* seglet, LogSegment* segment);
 
   PRIVATE:
+    /**
+     * A pool of free seglets kept as one list per NUMA node, so that an
+     * allocation preferring a node finds that node's seglets without
+     * searching. This class is not thread-safe; the allocator's monitor lock
+     * protects it.
+     */
+    class NodePool {
+      public:
+        NodePool() : lists(), numSeglets(0) {}
+        void push(Seglet* seglet, int numaNode);
+        bool take(uint32_t count, int numaNode, vector<Seglet*>& outSeglets);
+
+        /// Return the number of seglets in the pool, across all nodes.
+        size_t size() const { return numSeglets; }
+
+      PRIVATE:
+        /// Free seglets, indexed by the NUMA node they are placed on. Grows
+        /// to cover the highest node pushed.
+        vector<vector<Seglet*>> lists;
+
+        /// Total number of seglets in #lists.
+        size_t numSeglets;
+    };
+
     size_t getSegletIndex(const void* p);
     bool allocFromPool(vector<Seglet*>& pool,
                        uint32_t count,
                        vector<Seglet*>& outSeglets);
+    static NumaPlacement parseNumaPolicy(const string& policy);
 
     /// Size of each seglet in bytes.
     const uint32_t segletSize;
@@ -132,13 +166,13 @@ class SegletAllocator {
     ///
     /// The cleaner needs to ensure that enough seglets are kept in reserve so
     /// that it can continue to clean. Otherwise, it might deadlock.
-    vector<Seglet*> cleanerPool;
+    NodePool cleanerPool;
 
     /// Maximum number of seglets to reserve in the cleanerPool.
     uint32_t cleanerPoolReserve;
 
     /// Pool holding all other seglets not otherwise reserved.
-    vector<Seglet*> defaultPool;
+    NodePool defaultPool;
 
     /// Table mapping blocks of memory backing Seglets to their owner LogSegment
     /// objects. This allows getOwnerSegment() to look up a LogSegment object
@@ -148,6 +182,15 @@ class SegletAllocator {
     /// Single contiguous block of memory backing all of our seglets.
     LargeBlockOfMemory<uint8_t> block;
 
+    /// Number of NUMA nodes #block is split across. 1 if the machine isn't
+    /// NUMA, the memory wasn't split (e.g. it's interleaved instead), or
+    /// binding memory to nodes failed.
+    int numaNodes;
+
+    /// Number of consecutive seglets in #block placed on each NUMA node.
+    /// Seglet i lives on node min(i / segletsPerNode, numaNodes - 1).
+    size_t segletsPerNode;
+
     DISALLOW_COPY_AND_ASSIGN(SegletAllocator);
 };
 
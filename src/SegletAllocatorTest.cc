@@ -47,6 +47,26 @@ TEST_F(SegletAllocatorTest, constructor) {
         allocator.defaultPool.size());
 }
 
+TEST_F(SegletAllocatorTest, constructor_hugepagesUnavailable) {
+    // Either hugepages are reserved on this machine or we quietly fall back
+    // to regular pages; the allocator works the same either way.
+    serverConfig.master.useHugepages = true;
+    SegletAllocator allocator2(&serverConfig);
+    EXPECT_EQ(serverConfig.master.logBytes, allocator2.getTotalBytes());
+    EXPECT_EQ(1, allocator2.getNumaNodeCount());
+}
+
+TEST_F(SegletAllocatorTest, parseNumaPolicy) {
+    EXPECT_TRUE(NumaPlacement::SPLIT ==
+                SegletAllocator::parseNumaPolicy("split"));
+    EXPECT_TRUE(NumaPlacement::INTERLEAVE ==
+                SegletAllocator::parseNumaPolicy("interleave"));
+    EXPECT_TRUE(NumaPlacement::DEFAULT ==
+                SegletAllocator::parseNumaPolicy("local"));
+    TestLog::Enable _;
+    EXPECT_THROW(SegletAllocator::parseNumaPolicy("bogus"), FatalError);
+}
+
 TEST_F(SegletAllocatorTest, destructor) {
     TestLog::Enable _;
     Tub<SegletAllocator> allocator2;
@@ -82,6 +102,105 @@ TEST_F(SegletAllocatorTest, alloc) {
         s->free();
 }
 
+TEST_F(SegletAllocatorTest, alloc_numaNode) {
+    vector<Seglet*> seglets;
+    size_t total = allocator.getTotalCount();
+    uint32_t perNode = downCast<uint32_t>(total / 2);
+
+    // Pretend the block is split across two nodes, and re-sort the free
+    // seglets into per-node lists to match.
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT,
+            downCast<uint32_t>(total), seglets));
+    allocator.numaNodes = 2;
+    allocator.segletsPerNode = perNode;
+    foreach (Seglet* s, seglets)
+        s->free();
+    seglets.clear();
+
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 3, seglets, 0));
+    EXPECT_EQ(3U, seglets.size());
+    foreach (Seglet* s, seglets)
+        EXPECT_EQ(0, allocator.getNumaNode(s->get()));
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 1, seglets, 1));
+    EXPECT_EQ(1, allocator.getNumaNode(seglets[3]->get()));
+
+    // Not enough seglets left on node 0: all of node 0's come first, then
+    // the rest from node 1.
+    uint32_t rest = perNode - 3 + 2;
+    size_t before = seglets.size();
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, rest, seglets, 0));
+    EXPECT_EQ(before + rest, seglets.size());
+    for (size_t i = before; i < seglets.size(); i++) {
+        int expected = (i < before + perNode - 3) ? 0 : 1;
+        EXPECT_EQ(expected, allocator.getNumaNode(seglets[i]->get()));
+    }
+
+    // The most recently freed seglet on a node is handed out first.
+    Seglet* last = seglets.back();
+    seglets.pop_back();
+    last->free();
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 1, seglets, 1));
+    EXPECT_EQ(last, seglets.back());
+
+    // Without a preference, the node with the most free seglets is used.
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 1, seglets));
+    EXPECT_EQ(1, allocator.getNumaNode(seglets.back()->get()));
+
+    foreach (Seglet* s, seglets)
+        s->free();
+}
+
+TEST_F(SegletAllocatorTest, NodePool_take) {
+    SegletAllocator::NodePool pool;
+    vector<Seglet*> seglets;
+    EXPECT_TRUE(allocator.alloc(SegletAllocator::DEFAULT, 5, seglets));
+    pool.push(seglets[0], 0);
+    pool.push(seglets[1], 2);
+    pool.push(seglets[2], 2);
+    pool.push(seglets[3], 1);
+    EXPECT_EQ(4U, pool.size());
+    EXPECT_EQ(3U, pool.lists.size());
+
+    vector<Seglet*> out;
+    EXPECT_FALSE(pool.take(5, 0, out));
+    EXPECT_EQ(0U, out.size());
+    EXPECT_EQ(4U, pool.size());
+
+    // Node 2 first, newest first, then wrap around to node 0.
+    EXPECT_TRUE(pool.take(3, 2, out));
+    ASSERT_EQ(3U, out.size());
+    EXPECT_EQ(seglets[2], out[0]);
+    EXPECT_EQ(seglets[1], out[1]);
+    EXPECT_EQ(seglets[0], out[2]);
+    EXPECT_EQ(1U, pool.size());
+
+    // An unknown node is treated like no preference.
+    EXPECT_TRUE(pool.take(1, 7, out));
+    EXPECT_EQ(seglets[3], out[3]);
+    EXPECT_EQ(0U, pool.size());
+    EXPECT_TRUE(pool.take(0, 0, out));
+
+    foreach (Seglet* s, seglets)
+        s->free();
+}
+
+TEST_F(SegletAllocatorTest, getNumaNode) {
+    const uint8_t* base =
+            reinterpret_cast<const uint8_t*>(allocator.getBaseAddress());
+    EXPECT_EQ(1, allocator.getNumaNodeCount());
+    EXPECT_EQ(0, allocator.getNumaNode(base + allocator.getTotalBytes() - 1));
+
+    // Three nodes; the leftover seglets at the end go to the last node.
+    allocator.numaNodes = 3;
+    allocator.segletsPerNode = allocator.getTotalCount() / 3;
+    size_t nodeBytes = allocator.segletsPerNode * allocator.getSegletSize();
+    EXPECT_EQ(0, allocator.getNumaNode(base));
+    EXPECT_EQ(0, allocator.getNumaNode(base + nodeBytes - 1));
+    EXPECT_EQ(1, allocator.getNumaNode(base + nodeBytes));
+    EXPECT_EQ(2, allocator.getNumaNode(base + 3 * nodeBytes - 1));
+    EXPECT_EQ(2, allocator.getNumaNode(base + allocator.getTotalBytes() - 1));
+}
+
 TEST_F(SegletAllocatorTest, initializeEmergencyHeadReserve) {
     allocator.emergencyHeadPoolReserve = 1;
     EXPECT_FALSE(allocator.initializeEmergencyHeadReserve(1));
@@ -110,9 +229,11 @@ TEST_F(SegletAllocatorTest, initializeCleanerReserve) {
 
     EXPECT_TRUE(allocator.initializeCleanerReserve(maxSeglets));
     EXPECT_EQ(maxSeglets, allocator.cleanerPool.size());
-    foreach (Seglet* s, allocator.cleanerPool) {
-        EXPECT_EQ(static_cast<const vector<Seglet*>*>(NULL),
-                  s->getSourcePool());
+    foreach (vector<Seglet*>& list, allocator.cleanerPool.lists) {
+        foreach (Seglet* s, list) {
+            EXPECT_EQ(static_cast<const vector<Seglet*>*>(NULL),
+                      s->getSourcePool());
+        }
     }
 }
 
@@ -183,23 +304,20 @@ TEST_F(SegletAllocatorTest, getMemoryUtilization) {
 }
 
 TEST_F(SegletAllocatorTest, allocFromPool) {
+    vector<Seglet*> pool;
+    EXPECT_TRUE(allocator.defaultPool.take(4, -1, pool));
     vector<Seglet*> seglets;
-    uint32_t maxSeglets = downCast<uint32_t>(allocator.defaultPool.size());
 
-    EXPECT_FALSE(allocator.allocFromPool(allocator.defaultPool,
-                                         maxSeglets + 1,
-                                         seglets));
-
-    EXPECT_EQ(maxSeglets, allocator.defaultPool.size());
+    EXPECT_FALSE(allocator.allocFromPool(pool, 5, seglets));
+    EXPECT_EQ(4U, pool.size());
     EXPECT_EQ(0U, seglets.size());
-    EXPECT_TRUE(allocator.allocFromPool(allocator.defaultPool,
-                                        maxSeglets,
-                                        seglets));
-    EXPECT_EQ(0U, allocator.defaultPool.size());
-    EXPECT_EQ(maxSeglets, seglets.size());
+    EXPECT_TRUE(allocator.allocFromPool(pool, 4, seglets));
+    EXPECT_EQ(0U, pool.size());
+    EXPECT_EQ(4U, seglets.size());
 
     // return to allocator
-    allocator.allocFromPool(seglets, maxSeglets, allocator.defaultPool);
+    foreach (Seglet* s, seglets)
+        s->free();
 }
 
 } // namespace RAMCloud
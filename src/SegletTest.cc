@@ -64,7 +64,8 @@ TEST_F(SegletTest, constructor) {
 
 TEST_F(SegletTest, free) {
     s->free();
-    EXPECT_EQ(allocator.defaultPool.back(), s);
+    size_t node = downCast<size_t>(allocator.getNumaNode(buf));
+    EXPECT_EQ(allocator.defaultPool.lists[node].back(), s);
     s = NULL;
 }
 
@@ -200,30 +200,11 @@ Segment::append(LogEntryType type,
                 uint32_t length,
                 Reference* outReference)
 {
-    EntryHeader entryHeader(type, length);
-
-    if (!hasSpaceFor(&length, 1))
+    uint32_t dataOffset;
+    if (!reserve(type, length, &dataOffset, outReference))
         return false;
 
-    uint32_t startOffset = head;
-
-    copyIn(head, &entryHeader, sizeof(entryHeader));
-    checksum.update(&entryHeader, sizeof(entryHeader));
-    head += sizeof32(entryHeader);
-
-    // Note that this assumes a little-endian byte order. I think this is
-    // justified considering how widely we have assume byte order (if not
-    // x86 in particular).
-    copyIn(head, &length, entryHeader.getLengthBytes());
-    checksum.update(&length, entryHeader.getLengthBytes());
-    head += entryHeader.getLengthBytes();
-
-    copyIn(head, buffer, length);
-    head += length;
-
-    if (outReference != NULL)
-        *outReference = Reference(this, startOffset);
-
+    copyIn(dataOffset, buffer, length);
     return true;
 }
 
@@ -279,6 +260,109 @@ Segment::append(const void* buffer,
                 uint32_t* entryDataLength,
                 LogEntryType *type,
                 Reference* outReference)
+{
+    uint32_t startOffset = head;
+    uint32_t lengthWithoutMetadata = 0;
+    uint32_t dataOffset;
+    if (!reserve(buffer, &lengthWithoutMetadata, type, &dataOffset,
+                 outReference)) {
+        return false;
+    }
+
+    const uint8_t* contigPointer = reinterpret_cast<const uint8_t*>(buffer);
+    const uint8_t* entryContents = contigPointer + dataOffset - startOffset;
+    copyIn(dataOffset, entryContents, lengthWithoutMetadata);
+
+    if (entryDataLength)
+        *entryDataLength = lengthWithoutMetadata;
+
+    return true;
+}
+
+/**
+ * Reserve space for a typed entry at the end of this segment without copying
+ * in its contents. The entry's header is written and included in the segment
+ * checksum, and the segment's appended length advances past the (not yet
+ * written) contents. The caller must fill in the contents with copyInReserved()
+ * before anyone reads the entry or replicates the segment past it.
+ *
+ * This allows the log to serialize only the (small, order-dependent) metadata
+ * updates while multiple threads copy entry contents in parallel.
+ *
+ * \param type
+ *      Type of the entry. See LogEntryTypes.h.
+ * \param length
+ *      Number of bytes of entry contents to reserve space for.
+ * \param[out] outDataOffset
+ *      Offset in the segment at which the entry's contents must be copied.
+ * \param[out] outReference
+ *      If the reservation was successful, a Segment::Reference pointing to the
+ *      new entry is returned here.
+ * \return
+ *      True if the reservation succeeded, false if there was insufficient
+ *      space.
+ */
+bool
+Segment::reserve(LogEntryType type,
+                 uint32_t length,
+                 uint32_t* outDataOffset,
+                 Reference* outReference)
+{
+    EntryHeader entryHeader(type, length);
+
+    if (!hasSpaceFor(&length, 1))
+        return false;
+
+    uint32_t startOffset = head;
+
+    copyIn(head, &entryHeader, sizeof(entryHeader));
+    checksum.update(&entryHeader, sizeof(entryHeader));
+    head += sizeof32(entryHeader);
+
+    // Note that this assumes a little-endian byte order. I think this is
+    // justified considering how widely we have assume byte order (if not
+    // x86 in particular).
+    copyIn(head, &length, entryHeader.getLengthBytes());
+    checksum.update(&length, entryHeader.getLengthBytes());
+    head += entryHeader.getLengthBytes();
+
+    *outDataOffset = head;
+    head += length;
+
+    if (outReference != NULL)
+        *outReference = Reference(this, startOffset);
+
+    return true;
+}
+
+/**
+ * Reserve space for a complete log entry (one whose header is already part
+ * of the given buffer) without copying in its contents. See the other
+ * reserve() method for details.
+ *
+ * \param buffer
+ *      Pointer to the buffer containing the log entry to be appended. Only
+ *      its header and length bytes are read.
+ * \param[out] entryDataLength
+ *      Number of bytes that belong to the current entry's contents.
+ *      This does not include the log entry header information.
+ * \param[out] type
+ *      Type of the entry. See LogEntryTypes.h.
+ * \param[out] outDataOffset
+ *      Offset in the segment at which the entry's contents must be copied.
+ * \param[out] outReference
+ *      If the reservation was successful, a Segment::Reference pointing to the
+ *      new entry is returned here.
+ * \return
+ *      True if the reservation succeeded, false if there was insufficient
+ *      space.
+ */
+bool
+Segment::reserve(const void* buffer,
+                 uint32_t* entryDataLength,
+                 LogEntryType* type,
+                 uint32_t* outDataOffset,
+                 Reference* outReference)
 {
     const EntryHeader* entryHeader = reinterpret_cast<
                                      const EntryHeader*>(buffer);
@@ -296,16 +380,11 @@ Segment::append(const void* buffer,
     checksum.update(entryHeader, sizeof(*entryHeader));
     head += sizeof32(*entryHeader);
 
-    // Note that this assumes a little-endian byte order. I think this is
-    // justified considering how widely we have assume byte order (if not
-    // x86 in particular).
     copyIn(head, &lengthWithoutMetadata, entryHeader->getLengthBytes());
     checksum.update(&lengthWithoutMetadata, entryHeader->getLengthBytes());
     head += entryHeader->getLengthBytes();
 
-    const uint8_t* contigPointer = reinterpret_cast<const uint8_t*>(buffer);
-    const uint8_t* entryContents = contigPointer + head - startOffset;
-    copyIn(head, entryContents, lengthWithoutMetadata);
+    *outDataOffset = head;
     head += lengthWithoutMetadata;
 
     if (entryDataLength)
@@ -320,6 +399,27 @@ Segment::append(const void* buffer,
     return true;
 }
 
+/**
+ * Fill in the contents of an entry previously reserved with reserve(). This
+ * method does not modify any segment metadata, so calls for different
+ * entries may run concurrently with each other and with further
+ * reservations.
+ *
+ * \param dataOffset
+ *      Offset returned by reserve().
+ * \param buffer
+ *      Entry contents to copy in.
+ * \param length
+ *      Number of bytes to copy; must equal the length that was reserved.
+ */
+void
+Segment::copyInReserved(uint32_t dataOffset,
+                        const void* buffer,
+                        uint32_t length)
+{
+    copyIn(dataOffset, buffer, length);
+}
+
 /**
  * Adds a log entry header to a buffer. The size of the header is
  * determined by the object size for which this header is to be
@@ -761,14 +861,18 @@ Segment::checkMetadataIntegrity(const SegmentCertificate& certificate)
     uint32_t offset = 0;
     Crc32C currentChecksum;
 
+    // Entry metadata is only a few bytes at a time; batch it up so that the
+    // checksum is computed over large chunks.
+    Crc32C::Batch batch(currentChecksum);
+
     const void* unused = NULL;
     while (offset < certificate.segmentLength && peek(offset, &unused) > 0) {
         EntryHeader header = getEntryHeader(offset);
-        currentChecksum.update(&header, sizeof(header));
+        batch.add(&header, sizeof(header));
 
         uint32_t length = 0;
         copyOut(offset + sizeof32(header), &length, header.getLengthBytes());
-        currentChecksum.update(&length, header.getLengthBytes());
+        batch.add(&length, header.getLengthBytes());
 
         offset += (sizeof32(header) + header.getLengthBytes() + length);
         size_t segmentSize = segletBlocks.size() * segletSize;
@@ -787,6 +891,7 @@ Segment::checkMetadataIntegrity(const SegmentCertificate& certificate)
         return false;
     }
 
+    batch.flush();
     currentChecksum.update(&certificate, static_cast<unsigned>
                            (sizeof(certificate)-sizeof(certificate.checksum)));
 
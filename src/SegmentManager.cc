@@ -298,9 +298,16 @@ SegmentManager::allocHeadSegment(uint32_t flags)
  *
  *      If a survivor is being allocated for disk cleaning instead, this must be
  *      NULL (the default).
+ *
+ * \param numaNode
+ *      If non-negative, prefer memory on this NUMA node for the new segment.
+ *      Cleaner threads pass the node they run on so that survivor segments
+ *      are written to local memory.
  */
 LogSegment*
-SegmentManager::allocSideSegment(uint32_t flags, LogSegment* replacing)
+SegmentManager::allocSideSegment(uint32_t flags,
+                                 LogSegment* replacing,
+                                 int numaNode)
 {
     assert(replacing == NULL || states[replacing->slot] == CLEANABLE);
 
@@ -320,9 +327,9 @@ SegmentManager::allocSideSegment(uint32_t flags, LogSegment* replacing)
         }
 
         if (flags & FOR_CLEANING)
-            s = alloc(ALLOC_CLEANER_SIDELOG, id, creationTimestamp);
+            s = alloc(ALLOC_CLEANER_SIDELOG, id, creationTimestamp, numaNode);
         else
-            s = alloc(ALLOC_REGULAR_SIDELOG, id, creationTimestamp);
+            s = alloc(ALLOC_REGULAR_SIDELOG, id, creationTimestamp, numaNode);
 
         if (s != NULL)
             break;
@@ -691,16 +698,18 @@ SegmentManager::allocateVersion() {
 
 /**
  * Ensure the safeVersion is larger than given number.
- * Return true if safeVersion is revised.
+ * Return true if safeVersion is revised. Safe to call from several threads
+ * at once (e.g. concurrent segment replays during recovery).
  * \param minimum
  *      The version number to be compared against safeVersion.
  * \see #safeVersion
  */
 bool
 SegmentManager::raiseSafeVersion(uint64_t minimum) {
-    if (minimum > safeVersion) {
-        safeVersion = minimum;
-        return true;
+    uint_fast64_t current = safeVersion.load();
+    while (minimum > current) {
+        if (safeVersion.compare_exchange_weak(current, minimum))
+            return true;
     }
     return false;
 }
@@ -949,6 +958,8 @@ SegmentManager::changeState(LogSegment& s, State newState)
  *      WallTime seconds timestamp when this segment was created. Normally set
  *      to the current time, but when segments are compacted in memory this will
  *      be set to the prior segments' timestamp.
+ * \param numaNode
+ *      If non-negative, prefer seglets on this NUMA node.
  * \return
  *      NULL if the allocation failed, otherwise a pointer to the newly
  *      allocated segment.
@@ -956,7 +967,8 @@ SegmentManager::changeState(LogSegment& s, State newState)
 LogSegment*
 SegmentManager::alloc(AllocPurpose purpose,
                       uint64_t segmentId,
-                      uint32_t creationTimestamp)
+                      uint32_t creationTimestamp,
+                      int numaNode)
 {
     TEST_LOG("purpose: %d", static_cast<int>(purpose));
 
@@ -977,7 +989,7 @@ SegmentManager::alloc(AllocPurpose purpose,
     else if (purpose == ALLOC_EMERGENCY_HEAD)
         type = SegletAllocator::EMERGENCY_HEAD;
 
-    if (!allocator.alloc(type, segmentSize / segletSize, seglets)) {
+    if (!allocator.alloc(type, segmentSize / segletSize, seglets, numaNode)) {
         assert(purpose != ALLOC_EMERGENCY_HEAD);
         freeSlot(slot, false);
         return NULL;
@@ -997,6 +1009,8 @@ SegmentManager::alloc(AllocPurpose purpose,
 
     foreach (Seglet* seglet, seglets)
         allocator.setOwnerSegment(seglet, segments[slot].get());
+    if (!seglets.empty())
+        segments[slot]->numaNode = allocator.getNumaNode(seglets[0]->get());
 
     states[slot] = state;
     idToSlotMap[segmentId] = slot;
@@ -119,7 +119,8 @@ class SegmentManager {
     SegletAllocator& getAllocator() const;
     LogSegment* allocHeadSegment(uint32_t flags = EMPTY);
     LogSegment* allocSideSegment(uint32_t flags = EMPTY,
-                                 LogSegment* replacing = NULL);
+                                 LogSegment* replacing = NULL,
+                                 int numaNode = -1);
     void cleaningComplete(LogSegmentVector& clean, LogSegmentVector& survivors);
     void compactionComplete(LogSegment* oldSegment, LogSegment* newSegment);
     void injectSideSegments(LogSegmentVector& segments);
@@ -255,7 +256,8 @@ class SegmentManager {
 
     LogSegment* alloc(AllocPurpose purpose,
                       uint64_t segmentId,
-                      uint32_t creationTimestamp);
+                      uint32_t creationTimestamp,
+                      int numaNode = -1);
     void injectSideSegment(LogSegment* segment, State nextState,
                            const SpinLock::Guard& lock);
     void freeSegment(LogSegment* segment, bool waitForDigest,
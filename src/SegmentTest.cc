@@ -163,6 +163,32 @@ TEST_P(SegmentTest, append_whiteBox) {
     EXPECT_EQ(0, memcmp("hi", buffer.getRange(2, 2), 2));
 }
 
+TEST_P(SegmentTest, reserve_and_copyInReserved) {
+    SegmentAndAllocator segAndAlloc(GetParam());
+    Segment& s = *segAndAlloc.segment;
+
+    Segment::Reference ref;
+    uint32_t dataOffset = 0;
+    EXPECT_TRUE(s.reserve(LOG_ENTRY_TYPE_OBJ, 2, &dataOffset, &ref));
+    EXPECT_EQ(2U, dataOffset);
+    EXPECT_EQ(s.segletBlocks[0], reinterpret_cast<const void*>(ref.reference));
+
+    // The metadata (and hence the certificate) is complete before the
+    // contents are copied in.
+    SegmentCertificate certificate;
+    EXPECT_EQ(4U, s.getAppendedLength(&certificate));
+    EXPECT_EQ(4u, certificate.segmentLength);
+    EXPECT_EQ(0x87a632e2u, certificate.checksum);
+
+    s.copyInReserved(dataOffset, "hi", 2);
+    Buffer buffer;
+    EXPECT_EQ(LOG_ENTRY_TYPE_OBJ, s.getEntry(ref, &buffer));
+    EXPECT_EQ("hi", TestUtil::toString(&buffer));
+
+    s.close();
+    EXPECT_FALSE(s.reserve(LOG_ENTRY_TYPE_OBJ, 2, &dataOffset, &ref));
+}
+
 TEST_P(SegmentTest, append_fullLogEntry) {
     SegmentAndAllocator segAndAlloc(GetParam());
     Segment& s = *segAndAlloc.segment;
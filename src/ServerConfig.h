@@ -229,14 +229,21 @@ struct ServerConfig {
         Master(Testing) // NOLINT
             : logBytes(40 * 1024 * 1024)
             , hashTableBytes(1 * 1024 * 1024)
+            , hashTableResize(false)
             , disableLogCleaner(true)
             , disableInMemoryCleaning(true)
+            , disableNumaAwareCleaning(true)
             , diskExpansionFactor(1.0)
             , cleanerBalancer("tombstoneRatio:0.40")
             , cleanerWriteCostThreshold(0)
             , cleanerThreadCount(1)
+            , recoveryReplayThreads(1)
+            , trackTabletMembership(false)
+            , migrationStreams(1)
+            , numWitnesses(0)
             , numReplicas(0)
             , useHugepages(false)
+            , logMemoryNumaPolicy("local")
             , useMinCopysets(false)
             , usePlusOneBackup(false)
             , allowLocalBackup(false)
@@ -250,14 +257,21 @@ struct ServerConfig {
         Master()
             : logBytes()
             , hashTableBytes()
+            , hashTableResize()
             , disableLogCleaner()
             , disableInMemoryCleaning()
+            , disableNumaAwareCleaning()
             , diskExpansionFactor()
             , cleanerBalancer()
             , cleanerWriteCostThreshold()
             , cleanerThreadCount()
+            , recoveryReplayThreads()
+            , trackTabletMembership()
+            , migrationStreams()
+            , numWitnesses()
             , numReplicas()
             , useHugepages()
+            , logMemoryNumaPolicy()
             , useMinCopysets()
             , usePlusOneBackup()
             , allowLocalBackup()
@@ -271,14 +285,21 @@ struct ServerConfig {
         {
             config.set_log_bytes(logBytes);
             config.set_hash_table_bytes(hashTableBytes);
+            config.set_hash_table_resize(hashTableResize);
             config.set_disable_log_cleaner(disableLogCleaner);
             config.set_disable_in_memory_cleaning(disableInMemoryCleaning);
+            config.set_disable_numa_aware_cleaning(disableNumaAwareCleaning);
             config.set_backup_disk_expansion_factor(diskExpansionFactor);
             config.set_cleaner_balancer(cleanerBalancer);
             config.set_cleaner_write_cost_threshold(cleanerWriteCostThreshold);
             config.set_cleaner_thread_count(cleanerThreadCount);
+            config.set_recovery_replay_threads(recoveryReplayThreads);
+            config.set_track_tablet_membership(trackTabletMembership);
+            config.set_migration_streams(migrationStreams);
+            config.set_num_witnesses(numWitnesses);
             config.set_num_replicas(numReplicas);
             config.set_use_hugepages(useHugepages);
+            config.set_log_memory_numa_policy(logMemoryNumaPolicy);
             config.set_use_mincopysets(useMinCopysets);
             config.set_use_plusonebackup(usePlusOneBackup);
             config.set_use_local_backup(allowLocalBackup);
@@ -293,14 +314,21 @@ struct ServerConfig {
         {
             logBytes = config.log_bytes();
             hashTableBytes = config.hash_table_bytes();
+            hashTableResize = config.hash_table_resize();
             disableLogCleaner = config.disable_log_cleaner();
             disableInMemoryCleaning = config.disable_in_memory_cleaning();
+            disableNumaAwareCleaning = config.disable_numa_aware_cleaning();
             diskExpansionFactor = config.backup_disk_expansion_factor();
             cleanerBalancer = config.cleaner_balancer();
             cleanerWriteCostThreshold = config.cleaner_write_cost_threshold();
             cleanerThreadCount = config.cleaner_thread_count();
+            recoveryReplayThreads = config.recovery_replay_threads();
+            trackTabletMembership = config.track_tablet_membership();
+            migrationStreams = config.migration_streams();
+            numWitnesses = config.num_witnesses();
             numReplicas = config.num_replicas();
             useHugepages = config.use_hugepages();
+            logMemoryNumaPolicy = config.log_memory_numa_policy();
             useMinCopysets = config.use_mincopysets();
             usePlusOneBackup = config.use_plusonebackup();
             allowLocalBackup = config.use_local_backup();
@@ -312,6 +340,10 @@ struct ServerConfig {
         /// Total number of bytes to use for the HashTable.
         uint64_t hashTableBytes;
 
+        /// If true, the HashTable starts at hashTableBytes but is grown and
+        /// shrunk online as the number of objects on the master changes.
+        bool hashTableResize;
+
         /// If true, disable the log cleaner entirely.
         bool disableLogCleaner;
 
@@ -319,6 +351,11 @@ struct ServerConfig {
         /// on both in memory and on disk.
         bool disableInMemoryCleaning;
 
+        /// If true, cleaner threads are not pinned to NUMA nodes and don't
+        /// prefer segments on their own node. Has no effect unless log
+        /// memory is split across nodes (see logMemoryNumaPolicy).
+        bool disableNumaAwareCleaning;
+
         /// Specifies how many segments may be allocated on backup disks beyond
         /// the server's memory capacity. For instance, a value of 2.0 means
         /// that for every full segment's worth of space in the server's memory,
@@ -338,6 +375,29 @@ struct ServerConfig {
         /// at the expense of CPU cycles.
         uint32_t cleanerThreadCount;
 
+        /// Number of threads that replay recovery segments concurrently when
+        /// this server acts as a recovery master. 1 replays each segment on
+        /// the thread running the recovery, as it arrives.
+        uint32_t recoveryReplayThreads;
+
+        /// If true, the master keeps an index of which key hashes each table
+        /// holds, so that dropping, cleaning up after, or enumerating a small
+        /// tablet costs time proportional to the tablet rather than to the
+        /// whole hash table. See TabletMembership.
+        bool trackTabletMembership;
+
+        /// Number of pieces a tablet's key hash range is divided into when
+        /// this server migrates it to another master. Each piece is sent
+        /// over its own stream of RPCs, so the receiver replays up to this
+        /// many segments of the tablet at once.
+        uint32_t migrationStreams;
+
+        /// Number of witnesses (servers running backups) on which clients
+        /// record writes that this master acknowledges before replicating
+        /// them. 0 means every write is replicated before it is
+        /// acknowledged.
+        uint32_t numWitnesses;
+
         /// Number of replicas to keep per segment stored on backups.
         uint32_t numReplicas;
 
@@ -345,6 +405,12 @@ struct ServerConfig {
         /// LargeBlockOfMemory.
         bool useHugepages;
 
+        /// How to spread the log's memory across NUMA nodes: "split" (one
+        /// contiguous range per node; lets the cleaner work on local
+        /// memory), "interleave" (page by page round-robin), or "local"
+        /// (leave it to the kernel).
+        string logMemoryNumaPolicy;
+
         /// Specifies whether to use MinCopysets replication or random
         /// replication.
         bool useMinCopysets;
@@ -377,6 +443,7 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(100)
             , writeRateLimit(0)
+            , ioQueueDepth(0)
         {}
 
         /**
@@ -395,6 +462,7 @@ struct ServerConfig {
             , strategy(1)
             , mockSpeed(0)
             , writeRateLimit(0)
+            , ioQueueDepth(32)
         {}
 
         /**
@@ -413,6 +481,7 @@ struct ServerConfig {
             config.set_strategy(strategy);
             config.set_mock_speed(mockSpeed);
             config.set_write_rate_limit(writeRateLimit);
+            config.set_io_queue_depth(ioQueueDepth);
         }
 
         /**
@@ -432,6 +501,7 @@ struct ServerConfig {
             strategy = config.strategy();
             mockSpeed = config.mock_speed();
             writeRateLimit = config.write_rate_limit();
+            ioQueueDepth = config.io_queue_depth();
         }
 
         /**
@@ -497,6 +567,13 @@ struct ServerConfig {
          * If non-0, limit writes to backup to this many megabytes per second.
          */
         size_t writeRateLimit;
+
+        /**
+         * If non-0, disk-based storage issues its IO through an io_uring
+         * that keeps up to this many operations outstanding at once. If 0
+         * (or if the kernel doesn't support io_uring) it uses POSIX AIO.
+         */
+        uint32_t ioQueueDepth;
     } backup;
 
   public:
@@ -111,6 +111,12 @@ main(int argc, char *argv[])
             ("backupInMemory,m",
              ProgramOptions::bool_switch(&config.backup.inMemory),
              "Backup will store segment replicas in memory")
+            ("backupIoQueueDepth",
+             ProgramOptions::value<uint32_t>(
+                &config.backup.ioQueueDepth)->default_value(32),
+             "Number of IO operations the backup keeps outstanding on its "
+             "storage through io_uring. If 0, or if the kernel doesn't "
+             "support io_uring, the backup uses POSIX AIO instead.")
             ("backupOnly,B",
              ProgramOptions::bool_switch(&backupOnly),
              "The server should run the backup service only (no master)")
@@ -149,6 +155,11 @@ main(int argc, char *argv[])
              "Disable the in-memory cleaning portion of the log cleaner. When "
              "turned off, the cleaner will always clean both in memory and on "
              "backup disks at the same time.")
+            ("disableNumaAwareCleaning",
+             ProgramOptions::bool_switch(
+                &config.master.disableNumaAwareCleaning),
+             "Don't pin log cleaner threads to NUMA nodes or have them prefer "
+             "segments in their node's memory.")
             ("diskExpansionFactor,E",
              ProgramOptions::value<double>(&config.master.diskExpansionFactor)->
                 default_value(2.0),
@@ -166,12 +177,23 @@ main(int argc, char *argv[])
                 default_value("10%"),
              "Percentage or megabytes of master memory allocated to "
              "the hash table")
+            ("hashTableResize",
+             ProgramOptions::bool_switch(&config.master.hashTableResize),
+             "Grow and shrink the hash table online as the number of objects "
+             "changes; hashTableMemory gives its initial size")
             ("logCleanerThreads",
              ProgramOptions::value<uint32_t>(
                 &config.master.cleanerThreadCount)->default_value(1),
              "The number of cleaner threads controls the amount of parallelism "
              "in the cleaner. More threads will use more cores, but may be "
              "able to better keep up with high write rates.")
+            ("logMemoryNumaPolicy",
+             ProgramOptions::value<string>(
+                &config.master.logMemoryNumaPolicy)->default_value("split"),
+             "How to place log memory on a NUMA machine: \"split\" gives "
+             "each node a contiguous share (needed for NUMA-aware cleaning), "
+             "\"interleave\" spreads it page by page across all nodes, and "
+             "\"local\" leaves placement to the kernel.")
             ("masterOnly,M",
              ProgramOptions::bool_switch(&masterOnly),
              "The server should run the master service only (no backup)")
@@ -196,12 +218,24 @@ main(int argc, char *argv[])
                &config.backup.maxRecoveryReplicas)->default_value(20),
              "Maximum number of replicas any given master recovery will buffer "
              "in memory.")
+            ("migrationStreams",
+             ProgramOptions::value<uint32_t>(
+                &config.master.migrationStreams)->default_value(4),
+             "Number of parallel streams this master uses to send a tablet "
+             "it migrates to another master; the tablet's key hash range is "
+             "divided evenly between them.")
             ("preferredIndex",
              ProgramOptions::value<uint32_t>(
                 &config.preferredIndex)->default_value(0),
              "Use this value as the index number for this server's server id, "
              "if that number isn't already in use. Can be used to ensure "
              "a reproducible assignment of server ids.")
+            ("recoveryReplayThreads",
+             ProgramOptions::value<uint32_t>(
+                &config.master.recoveryReplayThreads)->default_value(4),
+             "Number of threads a recovery master uses to replay recovered "
+             "segments in parallel. Each thread appends to its own side log; "
+             "1 replays segments one at a time as they arrive from backups.")
             ("replicas,r",
              ProgramOptions::value<uint32_t>(&config.master.numReplicas),
              "Number of backup copies to make for each segment")
@@ -230,9 +264,17 @@ main(int argc, char *argv[])
                 default_value("500"),
              "Percentage or megabytes of system memory for master log & "
              "hash table")
+            ("trackTabletMembership",
+             ProgramOptions::bool_switch(
+                &config.master.trackTabletMembership),
+             "Keep an index of the key hashes stored for each table, so that "
+             "dropping, migrating or enumerating a small tablet doesn't scan "
+             "the whole hash table. Costs some memory per object.")
             ("hugepage",
              ProgramOptions::bool_switch(&config.master.useHugepages),
-             "Whether to use hugepage memory to allocate LargeBlockOfMemory")
+             "Whether to use hugepage memory to allocate LargeBlockOfMemory. "
+             "1GB pages are used if enough are reserved, otherwise 2MB ones, "
+             "otherwise regular pages.")
             ("useMinCopysets",
              ProgramOptions::value<bool>(&config.master.useMinCopysets)->
                 default_value(false),
@@ -242,6 +284,13 @@ main(int argc, char *argv[])
                 default_value(false),
              "Whether to use (masterServerId+1)modulo n or random "
              "replication for backupServerId")
+            ("witnesses",
+             ProgramOptions::value<uint32_t>(
+                &config.master.numWitnesses)->default_value(0),
+             "Number of backups on which clients record writes to this "
+             "master, so that the master can acknowledge writes before "
+             "replicating them (at most 5). 0 replicates every write before "
+             "acknowledging it.")
             ("writeCostThreshold,w",
              ProgramOptions::value<uint32_t>(
                 &config.master.cleanerWriteCostThreshold)->default_value(8),
@@ -0,0 +1,995 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "ShmTransport.h"
+#include "PerfStats.h"
+#include "ServiceLocator.h"
+#include "WireFormat.h"
+#include "WorkerManager.h"
+
+namespace RAMCloud {
+
+// Definitions for static constants that are passed by reference.
+const uint32_t ShmTransport::RING_BYTES;
+const uint32_t ShmTransport::MAX_FRAGMENT_BYTES;
+
+/**
+ * Construct a ShmTransport.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server or client.
+ * \param serviceLocator
+ *      If non-NULL this transport will accept sessions from clients on
+ *      this machine, as well as open sessions to servers; its "name"
+ *      option identifies the server. If NULL this transport will be used
+ *      only for outgoing requests.
+ *
+ * \throw TransportException
+ *      There was a problem that prevented us from creating the transport.
+ */
+ShmTransport::ShmTransport(Context* context,
+        const ServiceLocator* serviceLocator)
+    : context(context)
+    , locatorString()
+    , listenSocket(-1)
+    , acceptHandler()
+    , connections()
+    , nextConnectionId(1)
+    , sessions()
+    , poller(this)
+    , serverRpcPool()
+    , clientRpcPool()
+{
+    if (serviceLocator == NULL)
+        return;
+    locatorString = serviceLocator->getOriginalString();
+
+    struct sockaddr_un address;
+    socklen_t addressLength = makeAddress(serviceLocator->getOption("name"),
+            &address);
+    listenSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (listenSocket == -1) {
+        LOG(WARNING, "ShmTransport couldn't create listen socket: %s",
+                strerror(errno));
+        throw TransportException(HERE,
+                "ShmTransport couldn't create listen socket", errno);
+    }
+    if (bind(listenSocket, reinterpret_cast<struct sockaddr*>(&address),
+            addressLength) == -1) {
+        int error = errno;
+        close(listenSocket);
+        listenSocket = -1;
+        string message = format("ShmTransport couldn't bind to '%s'",
+                locatorString.c_str());
+        LOG(WARNING, "%s: %s", message.c_str(), strerror(error));
+        throw TransportException(HERE, message, error);
+    }
+    if (listen(listenSocket, INT_MAX) == -1) {
+        int error = errno;
+        close(listenSocket);
+        listenSocket = -1;
+        LOG(WARNING, "ShmTransport couldn't listen on socket: %s",
+                strerror(error));
+        throw TransportException(HERE,
+                "ShmTransport couldn't listen on socket", error);
+    }
+
+    // Arrange to be notified whenever a client connects.
+    acceptHandler.construct(listenSocket, this);
+}
+
+/**
+ * Destructor for ShmTransports: closes all sessions and connections.
+ */
+ShmTransport::~ShmTransport()
+{
+    while (!sessions.empty()) {
+        ShmSession& session = sessions.front();
+        session.close();
+        sessions.pop_front();
+    }
+    while (!connections.empty()) {
+        closeConnection(connections.begin()->first);
+    }
+    acceptHandler.destroy();
+    if (listenSocket >= 0) {
+        close(listenSocket);
+        listenSocket = -1;
+    }
+}
+
+/**
+ * Copy bytes into a ring, wrapping around its end if necessary. The bytes
+ * aren't visible to the consumer until #tail is advanced past them.
+ *
+ * \param position
+ *      Position in the ring's byte stream of the first byte to write.
+ * \param source
+ *      Bytes to copy.
+ * \param length
+ *      Number of bytes to copy; no more than RING_BYTES.
+ */
+void
+ShmTransport::Ring::copyIn(uint64_t position, const void* source,
+        uint32_t length)
+{
+    uint32_t offset = downCast<uint32_t>(position % RING_BYTES);
+    uint32_t first = std::min(length, RING_BYTES - offset);
+    memcpy(data + offset, source, first);
+    memcpy(data, static_cast<const char*>(source) + first, length - first);
+}
+
+/**
+ * Copy bytes out of a ring, wrapping around its end if necessary.
+ *
+ * \param position
+ *      Position in the ring's byte stream of the first byte to read.
+ * \param dest
+ *      Where to copy the bytes.
+ * \param length
+ *      Number of bytes to copy; no more than RING_BYTES.
+ */
+void
+ShmTransport::Ring::copyOut(uint64_t position, void* dest, uint32_t length)
+{
+    uint32_t offset = downCast<uint32_t>(position % RING_BYTES);
+    uint32_t first = std::min(length, RING_BYTES - offset);
+    memcpy(dest, data + offset, first);
+    memcpy(static_cast<char*>(dest) + first, data, length - first);
+}
+
+/**
+ * Write as much of a message to a ring as will fit, as one or more
+ * fragments.
+ *
+ * \param ring
+ *      The ring to write to; the caller must be its only producer.
+ * \param nonce
+ *      Identifies the RPC that the message belongs to.
+ * \param message
+ *      Contents of the message. NULL means send zeros (used for requests
+ *      canceled after they were partially sent).
+ * \param length
+ *      Total size of the message.
+ * \param[in,out] bytesSent
+ *      Number of bytes of the message already written to the ring;
+ *      updated to reflect the bytes written by this call.
+ * \return
+ *      True means the whole message has now been written; false means
+ *      the ring filled up, and this method should be called again once
+ *      the consumer has made room.
+ */
+bool
+ShmTransport::sendMessage(Ring* ring, uint64_t nonce, Buffer* message,
+        uint32_t length, uint32_t* bytesSent)
+{
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    do {
+        uint32_t space = RING_BYTES - downCast<uint32_t>(
+                tail - ring->head.load(std::memory_order_acquire));
+        uint32_t remaining = length - *bytesSent;
+        if (space < sizeof(FragmentHeader) + (remaining > 0 ? 1 : 0))
+            return false;
+        uint32_t fragmentLength = std::min(remaining,
+                std::min(space - sizeof32(FragmentHeader),
+                MAX_FRAGMENT_BYTES));
+
+        FragmentHeader header = {nonce, length, fragmentLength};
+        ring->copyIn(tail, &header, sizeof32(header));
+        uint64_t position = tail + sizeof(header);
+        if (message == NULL) {
+            string zeros(fragmentLength, '\0');
+            ring->copyIn(position, zeros.data(), fragmentLength);
+        } else {
+            Buffer::Iterator it(message, *bytesSent, fragmentLength);
+            while (!it.isDone()) {
+                ring->copyIn(position, it.getData(), it.getLength());
+                position += it.getLength();
+                it.next();
+            }
+        }
+        tail += sizeof(header) + fragmentLength;
+        ring->tail.store(tail, std::memory_order_release);
+        *bytesSent += fragmentLength;
+        PerfStats::threadStats.networkOutputBytes += fragmentLength;
+    } while (*bytesSent < length);
+    return true;
+}
+
+/**
+ * Check whether a ring holds a fragment, and if so return its header
+ * (the fragment remains in the ring).
+ *
+ * \param ring
+ *      The ring to read; the caller must be its only consumer.
+ * \param[out] header
+ *      The header of the next fragment is copied here.
+ * \return
+ *      True means a fragment is available.
+ */
+bool
+ShmTransport::peekFragment(Ring* ring, FragmentHeader* header)
+{
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    if (ring->tail.load(std::memory_order_acquire) - head <
+            sizeof(FragmentHeader))
+        return false;
+    ring->copyOut(head, header, sizeof32(*header));
+    return true;
+}
+
+/**
+ * Remove the next fragment from a ring, appending its data to a Buffer.
+ *
+ * \param ring
+ *      The ring to read; the caller must be its only consumer.
+ * \param header
+ *      The header of the fragment, as returned by #peekFragment. The
+ *      caller must have checked that its fragmentLength is reasonable.
+ * \param buffer
+ *      The fragment's data is appended here; NULL means discard it.
+ */
+void
+ShmTransport::consumeFragment(Ring* ring, const FragmentHeader& header,
+        Buffer* buffer)
+{
+    uint64_t head = ring->head.load(std::memory_order_relaxed) +
+            sizeof(FragmentHeader);
+    if (buffer != NULL && header.fragmentLength > 0) {
+        ring->copyOut(head, buffer->alloc(header.fragmentLength),
+                header.fragmentLength);
+    }
+    ring->head.store(head + header.fragmentLength, std::memory_order_release);
+    PerfStats::threadStats.networkInputBytes += header.fragmentLength;
+}
+
+/**
+ * Fill in the address of the Unix-domain socket on which a server
+ * listens. The socket is in the abstract namespace, so it never appears
+ * in the file system and vanishes when the server exits.
+ *
+ * \param name
+ *      The "name" option from the server's service locator.
+ * \param[out] address
+ *      Filled in with the socket's address.
+ * \return
+ *      The length of the address.
+ */
+socklen_t
+ShmTransport::makeAddress(const string& name, struct sockaddr_un* address)
+{
+    string path = "ramcloud-shm:" + name;
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    if (path.size() + 1 > sizeof(address->sun_path)) {
+        throw TransportException(HERE,
+                format("ShmTransport name too long: %s", name.c_str()));
+    }
+    memcpy(address->sun_path + 1, path.data(), path.size());
+    return downCast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 +
+            path.size());
+}
+
+/**
+ * Map the shared memory for a session.
+ *
+ * \param fd
+ *      File descriptor for the memory; the caller retains ownership.
+ * \return
+ *      The mapped memory.
+ *
+ * \throw TransportException
+ *      The memory couldn't be mapped.
+ */
+ShmTransport::SharedRegion*
+ShmTransport::mapRegion(int fd)
+{
+    void* memory = mmap(NULL, sizeof(SharedRegion), PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        throw TransportException(HERE,
+                "ShmTransport couldn't map shared memory", errno);
+    }
+    return static_cast<SharedRegion*>(memory);
+}
+
+/**
+ * Unmap memory returned by #mapRegion.
+ */
+void
+ShmTransport::unmapRegion(SharedRegion* region)
+{
+    munmap(region, sizeof(SharedRegion));
+}
+
+/**
+ * Close the server's end of a session and discard any related state.
+ *
+ * \param id
+ *      Identifies the ServerConnection.
+ */
+void
+ShmTransport::closeConnection(uint64_t id)
+{
+    auto it = connections.find(id);
+    if (it == connections.end())
+        return;
+    delete it->second;
+    connections.erase(it);
+}
+
+/**
+ * Constructor for AcceptHandlers.
+ *
+ * \param fd
+ *      The server's listening socket.
+ * \param transport
+ *      The transport that owns the socket.
+ */
+ShmTransport::AcceptHandler::AcceptHandler(int fd, ShmTransport* transport)
+    : Dispatch::File(transport->context->dispatch, fd,
+            Dispatch::FileEvent::READABLE)
+    , transport(transport)
+{
+}
+
+/**
+ * Invoked by Dispatch when a client connects to the server.
+ *
+ * \param events
+ *      Indicates whether the socket was readable, writable, or both
+ *      (OR-ed combination of Dispatch::FileEvent bits).
+ */
+void
+ShmTransport::AcceptHandler::handleFileEvent(int events)
+{
+    int acceptedFd = accept4(fd, NULL, NULL, SOCK_NONBLOCK);
+    if (acceptedFd < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+            LOG(WARNING, "ShmTransport couldn't accept connection: %s",
+                    strerror(errno));
+        }
+        return;
+    }
+    uint64_t id = transport->nextConnectionId++;
+    transport->connections[id] = new ServerConnection(transport, id,
+            acceptedFd);
+}
+
+/**
+ * Constructor for ServerConnections.
+ *
+ * \param transport
+ *      The transport that accepted the connection.
+ * \param id
+ *      Unique identifier for the connection.
+ * \param fd
+ *      Socket connected to the client; this object takes ownership.
+ */
+ShmTransport::ServerConnection::ServerConnection(ShmTransport* transport,
+        uint64_t id, int fd)
+    : transport(transport)
+    , id(id)
+    , fd(fd)
+    , region(NULL)
+    , incoming()
+    , current(NULL)
+    , rpcsWaitingToReply()
+    , bytesSent(0)
+    , handler()
+{
+    handler.construct(fd, transport, id);
+}
+
+/**
+ * Destructor for ServerConnections: discards any replies that haven't
+ * been sent. Replies for requests still being serviced are discarded
+ * when they are ready.
+ */
+ShmTransport::ServerConnection::~ServerConnection()
+{
+    handler.destroy();
+    close(fd);
+    if (current != NULL)
+        transport->serverRpcPool.destroy(current);
+    while (!rpcsWaitingToReply.empty()) {
+        ShmServerRpc& rpc = rpcsWaitingToReply.front();
+        rpcsWaitingToReply.pop_front();
+        transport->serverRpcPool.destroy(&rpc);
+    }
+    if (region != NULL)
+        unmapRegion(region);
+}
+
+/**
+ * Hand any complete requests in the connection's ring to the
+ * WorkerManager, and write any queued replies that now fit. This may
+ * delete the connection, if the client misbehaves.
+ *
+ * \return
+ *      1 means that useful work was done, 0 means there was nothing to do.
+ */
+int
+ShmTransport::ServerConnection::poll()
+{
+    if (region == NULL)
+        return 0;
+    int result = 0;
+    FragmentHeader header;
+    while (peekFragment(&region->requests, &header)) {
+        result = 1;
+        if (!incoming.active) {
+            if (header.messageLength > MAX_RPC_LEN) {
+                LOG(WARNING, "ShmTransport received oversize request "
+                        "(%u bytes); closing connection",
+                        header.messageLength);
+                transport->closeConnection(id);
+                return result;
+            }
+            uint64_t nonce = header.nonce;
+            current = transport->serverRpcPool.construct(transport, id,
+                    nonce);
+            incoming.active = true;
+            incoming.nonce = header.nonce;
+            incoming.messageLength = header.messageLength;
+            incoming.bytesReceived = 0;
+            incoming.buffer = &current->requestPayload;
+        }
+        if (header.nonce != incoming.nonce ||
+                header.fragmentLength > MAX_FRAGMENT_BYTES ||
+                header.fragmentLength >
+                incoming.messageLength - incoming.bytesReceived) {
+            LOG(WARNING, "ShmTransport received malformed request; "
+                    "closing connection");
+            transport->closeConnection(id);
+            return result;
+        }
+        consumeFragment(&region->requests, header, incoming.buffer);
+        incoming.bytesReceived += header.fragmentLength;
+        if (incoming.bytesReceived == incoming.messageLength) {
+            incoming.active = false;
+            ShmServerRpc* rpc = current;
+            current = NULL;
+            transport->context->workerManager->handleRpc(rpc);
+        }
+    }
+
+    while (!rpcsWaitingToReply.empty()) {
+        ShmServerRpc& rpc = rpcsWaitingToReply.front();
+        if (!sendMessage(&region->responses, rpc.nonce, &rpc.replyPayload,
+                rpc.replyPayload.size(), &bytesSent))
+            break;
+        result = 1;
+        bytesSent = 0;
+        rpcsWaitingToReply.pop_front();
+        transport->serverRpcPool.destroy(&rpc);
+    }
+    return result;
+}
+
+/**
+ * Constructor for ServerSocketHandlers.
+ *
+ * \param fd
+ *      Socket connected to a client.
+ * \param transport
+ *      The transport that accepted the connection.
+ * \param connectionId
+ *      Identifies the ServerConnection for the socket.
+ */
+ShmTransport::ServerSocketHandler::ServerSocketHandler(int fd,
+        ShmTransport* transport, uint64_t connectionId)
+    : Dispatch::File(transport->context->dispatch, fd,
+            Dispatch::FileEvent::READABLE)
+    , transport(transport)
+    , connectionId(connectionId)
+{
+}
+
+/**
+ * Invoked by Dispatch when a client's socket is readable. The first time,
+ * the client is passing us its shared memory; after that, it means the
+ * client has closed the session.
+ *
+ * \param events
+ *      Indicates whether the socket was readable, writable, or both
+ *      (OR-ed combination of Dispatch::FileEvent bits).
+ */
+void
+ShmTransport::ServerSocketHandler::handleFileEvent(int events)
+{
+    ServerConnection* connection = transport->connections[connectionId];
+    char data;
+    struct iovec iov = {&data, sizeof(data)};
+    char control[CMSG_SPACE(sizeof(int))];
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    ssize_t count = recvmsg(fd, &message, MSG_DONTWAIT | MSG_CMSG_CLOEXEC);
+    if (count < 0 && (errno == EAGAIN || errno == EINTR))
+        return;
+    if (count <= 0 || connection->region != NULL) {
+        // The client has closed its session (it sends nothing else).
+        transport->closeConnection(connectionId);
+        return;
+    }
+
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+    if (cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET ||
+            cmsg->cmsg_type != SCM_RIGHTS) {
+        LOG(WARNING, "ShmTransport client didn't send shared memory; "
+                "closing connection");
+        transport->closeConnection(connectionId);
+        return;
+    }
+    int memoryFd;
+    memcpy(&memoryFd, CMSG_DATA(cmsg), sizeof(memoryFd));
+    struct stat status;
+    try {
+        if (fstat(memoryFd, &status) != 0 ||
+                status.st_size < static_cast<off_t>(sizeof(SharedRegion))) {
+            throw TransportException(HERE,
+                    "ShmTransport client sent too little shared memory");
+        }
+        connection->region = mapRegion(memoryFd);
+    } catch (TransportException& e) {
+        LOG(WARNING, "%s; closing connection", e.message.c_str());
+        close(memoryFd);
+        transport->closeConnection(connectionId);
+        return;
+    }
+    close(memoryFd);
+}
+
+// See Transport::ServerRpc::sendReply for documentation.
+void
+ShmTransport::ShmServerRpc::sendReply()
+{
+    auto it = transport->connections.find(connectionId);
+    if (it == transport->connections.end()) {
+        // The client has gone away; just discard the reply.
+        transport->serverRpcPool.destroy(this);
+        return;
+    }
+    ServerConnection* connection = it->second;
+    if (connection->rpcsWaitingToReply.empty()) {
+        if (sendMessage(&connection->region->responses, nonce, &replyPayload,
+                replyPayload.size(), &connection->bytesSent)) {
+            // The common case: the whole reply fit in the ring.
+            connection->bytesSent = 0;
+            transport->serverRpcPool.destroy(this);
+            return;
+        }
+    }
+    connection->rpcsWaitingToReply.push_back(*this);
+}
+
+// See Transport::ServerRpc::getClientServiceLocator for documentation.
+string
+ShmTransport::ShmServerRpc::getClientServiceLocator()
+{
+    return format("shm:client=%lu", connectionId);
+}
+
+/**
+ * Construct a session, which creates shared memory and passes it to
+ * the server.
+ *
+ * \param transport
+ *      The transport that owns the session.
+ * \param serviceLocator
+ *      Identifies the server; its "name" option must match the server's.
+ * \param timeoutMs
+ *      If the server has an RPC outstanding and doesn't respond to pings
+ *      for this many milliseconds, the session is aborted. 0 means use a
+ *      default.
+ *
+ * \throw TransportException
+ *      The server couldn't be reached.
+ */
+ShmTransport::ShmSession::ShmSession(ShmTransport* transport,
+        const ServiceLocator* serviceLocator, uint32_t timeoutMs)
+    : Session(serviceLocator->getOriginalString())
+    , transport(transport)
+    , fd(-1)
+    , region(NULL)
+    , serial(1)
+    , rpcsWaitingToSend()
+    , bytesSent(0)
+    , rpcsWaitingForResponse()
+    , incoming()
+    , current(NULL)
+    , handler()
+    , alarm(transport->context->sessionAlarmTimer, this,
+            (timeoutMs != 0) ? timeoutMs : DEFAULT_TIMEOUT_MS)
+    , sessionEntries()
+{
+    struct sockaddr_un address;
+    socklen_t addressLength = makeAddress(serviceLocator->getOption("name"),
+            &address);
+    int memoryFd = -1;
+    try {
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd == -1) {
+            throw TransportException(HERE,
+                    "ShmTransport couldn't open socket for session", errno);
+        }
+        if (connect(fd, reinterpret_cast<struct sockaddr*>(&address),
+                addressLength) == -1) {
+            throw TransportException(HERE, format(
+                    "ShmTransport couldn't connect to %s",
+                    this->serviceLocator.c_str()), errno);
+        }
+        memoryFd = downCast<int>(syscall(SYS_memfd_create, "ramcloud-shm",
+                0));
+        if (memoryFd == -1 ||
+                ftruncate(memoryFd, sizeof(SharedRegion)) != 0) {
+            throw TransportException(HERE,
+                    "ShmTransport couldn't create shared memory", errno);
+        }
+        region = mapRegion(memoryFd);
+
+        // Pass the memory to the server, along with a byte of data (a
+        // message can't consist of control information alone).
+        char data = 0;
+        struct iovec iov = {&data, sizeof(data)};
+        char control[CMSG_SPACE(sizeof(int))];
+        memset(control, 0, sizeof(control));
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = &iov;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &memoryFd, sizeof(memoryFd));
+        if (sendmsg(fd, &message, MSG_NOSIGNAL) != 1) {
+            throw TransportException(HERE,
+                    "ShmTransport couldn't pass shared memory to server",
+                    errno);
+        }
+    } catch (TransportException& e) {
+        LOG(WARNING, "%s", e.str().c_str());
+        if (memoryFd >= 0)
+            ::close(memoryFd);
+        if (region != NULL)
+            unmapRegion(region);
+        region = NULL;
+        if (fd >= 0)
+            ::close(fd);
+        fd = -1;
+        throw;
+    }
+    ::close(memoryFd);
+
+    Dispatch::Lock lock(transport->context->dispatch);
+    handler.construct(fd, this);
+    transport->sessions.push_back(*this);
+}
+
+/**
+ * Destructor for ShmSessions.
+ */
+ShmTransport::ShmSession::~ShmSession()
+{
+    if (!sessionEntries.is_linked())
+        return;
+    close();
+    Dispatch::Lock lock(transport->context->dispatch);
+    transport->sessions.erase(transport->sessions.iterator_to(*this));
+}
+
+// See Transport::Session::abort for documentation.
+void
+ShmTransport::ShmSession::abort()
+{
+    close();
+}
+
+// See Transport::Session::cancelRequest for documentation.
+void
+ShmTransport::ShmSession::cancelRequest(RpcNotifier* notifier)
+{
+    foreach (ShmClientRpc& rpc, rpcsWaitingForResponse) {
+        if (rpc.notifier == notifier) {
+            rpcsWaitingForResponse.erase(
+                    rpcsWaitingForResponse.iterator_to(rpc));
+            if (&rpc == current) {
+                // Discard the rest of the response.
+                incoming.buffer = NULL;
+                current = NULL;
+            }
+            alarm.rpcFinished();
+            transport->clientRpcPool.destroy(&rpc);
+            return;
+        }
+    }
+    foreach (ShmClientRpc& rpc, rpcsWaitingToSend) {
+        if (rpc.notifier == notifier) {
+            alarm.rpcFinished();
+            if (&rpc == &rpcsWaitingToSend.front() && bytesSent > 0) {
+                // Part of the request is in the ring already, so the rest
+                // must follow; but the caller may reuse the request now.
+                rpc.request = NULL;
+                rpc.notifier = NULL;
+            } else {
+                rpcsWaitingToSend.erase(rpcsWaitingToSend.iterator_to(rpc));
+                transport->clientRpcPool.destroy(&rpc);
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * Shut down the session: fail all of its RPCs and release its socket and
+ * shared memory.
+ */
+void
+ShmTransport::ShmSession::close()
+{
+    if (handler) {
+        Dispatch::Lock lock(transport->context->dispatch);
+        handler.destroy();
+    }
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+    if (region != NULL) {
+        unmapRegion(region);
+        region = NULL;
+    }
+    incoming.active = false;
+    current = NULL;
+    while (!rpcsWaitingForResponse.empty()) {
+        ShmClientRpc& rpc = rpcsWaitingForResponse.front();
+        rpcsWaitingForResponse.pop_front();
+        alarm.rpcFinished();
+        rpc.notifier->failed();
+        transport->clientRpcPool.destroy(&rpc);
+    }
+    while (!rpcsWaitingToSend.empty()) {
+        ShmClientRpc& rpc = rpcsWaitingToSend.front();
+        rpcsWaitingToSend.pop_front();
+        if (rpc.notifier != NULL) {
+            alarm.rpcFinished();
+            rpc.notifier->failed();
+        }
+        transport->clientRpcPool.destroy(&rpc);
+    }
+    bytesSent = 0;
+}
+
+// See Transport::Session::getRpcInfo for documentation.
+string
+ShmTransport::ShmSession::getRpcInfo()
+{
+    const char* separator = "";
+    string result;
+    foreach (ShmClientRpc& rpc, rpcsWaitingForResponse) {
+        result += separator;
+        result += WireFormat::opcodeSymbol(rpc.request);
+        separator = ", ";
+    }
+    foreach (ShmClientRpc& rpc, rpcsWaitingToSend) {
+        if (rpc.request == NULL)
+            continue;
+        result += separator;
+        result += WireFormat::opcodeSymbol(rpc.request);
+        separator = ", ";
+    }
+    if (result.empty())
+        result = "no active RPCs";
+    result += " to server at ";
+    result += serviceLocator;
+    return result;
+}
+
+// See Transport::Session::sendRequest for documentation.
+void
+ShmTransport::ShmSession::sendRequest(Buffer* request, Buffer* response,
+        RpcNotifier* notifier)
+{
+    response->reset();
+    if (region == NULL) {
+        notifier->failed();
+        return;
+    }
+    alarm.rpcStarted();
+    ShmClientRpc* rpc = transport->clientRpcPool.construct(request, response,
+            notifier, serial);
+    serial++;
+    rpcsWaitingToSend.push_back(*rpc);
+    sendQueued();
+}
+
+/**
+ * Write queued requests to the ring, until they have all been sent or
+ * the ring is full.
+ */
+void
+ShmTransport::ShmSession::sendQueued()
+{
+    while (!rpcsWaitingToSend.empty()) {
+        ShmClientRpc& rpc = rpcsWaitingToSend.front();
+        if (!sendMessage(&region->requests, rpc.nonce, rpc.request,
+                rpc.requestLength, &bytesSent))
+            return;
+        bytesSent = 0;
+        rpcsWaitingToSend.pop_front();
+        if (rpc.notifier == NULL) {
+            transport->clientRpcPool.destroy(&rpc);
+        } else {
+            rpcsWaitingForResponse.push_back(rpc);
+        }
+    }
+}
+
+/**
+ * Send queued requests and deliver any responses that have arrived. This
+ * may close the session, if the server misbehaves.
+ *
+ * \return
+ *      1 means that useful work was done, 0 means there was nothing to do.
+ */
+int
+ShmTransport::ShmSession::poll()
+{
+    if (region == NULL)
+        return 0;
+    int result = 0;
+    if (!rpcsWaitingToSend.empty()) {
+        sendQueued();
+        result = 1;
+    }
+
+    FragmentHeader header;
+    while (region != NULL && peekFragment(&region->responses, &header)) {
+        result = 1;
+        if (!incoming.active) {
+            if (header.messageLength > MAX_RPC_LEN) {
+                LOG(WARNING, "ShmTransport received oversize response "
+                        "(%u bytes) from %s", header.messageLength,
+                        serviceLocator.c_str());
+                close();
+                return result;
+            }
+            incoming.active = true;
+            incoming.nonce = header.nonce;
+            incoming.messageLength = header.messageLength;
+            incoming.bytesReceived = 0;
+            incoming.buffer = NULL;
+            current = NULL;
+            foreach (ShmClientRpc& rpc, rpcsWaitingForResponse) {
+                if (rpc.nonce == header.nonce) {
+                    current = &rpc;
+                    incoming.buffer = rpc.response;
+                    break;
+                }
+            }
+        }
+        if (header.nonce != incoming.nonce ||
+                header.fragmentLength > MAX_FRAGMENT_BYTES ||
+                header.fragmentLength >
+                incoming.messageLength - incoming.bytesReceived) {
+            LOG(WARNING, "ShmTransport received malformed response from %s",
+                    serviceLocator.c_str());
+            close();
+            return result;
+        }
+        consumeFragment(&region->responses, header, incoming.buffer);
+        incoming.bytesReceived += header.fragmentLength;
+        if (incoming.bytesReceived == incoming.messageLength) {
+            incoming.active = false;
+            if (current != NULL) {
+                ShmClientRpc* rpc = current;
+                current = NULL;
+                rpcsWaitingForResponse.erase(
+                        rpcsWaitingForResponse.iterator_to(*rpc));
+                alarm.rpcFinished();
+                rpc->notifier->completed();
+                transport->clientRpcPool.destroy(rpc);
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Constructor for ClientSocketHandlers.
+ *
+ * \param fd
+ *      Socket connected to the server.
+ * \param session
+ *      The session that owns the socket.
+ */
+ShmTransport::ClientSocketHandler::ClientSocketHandler(int fd,
+        ShmSession* session)
+    : Dispatch::File(session->transport->context->dispatch, fd,
+            Dispatch::FileEvent::READABLE)
+    , session(session)
+{
+}
+
+/**
+ * Invoked by Dispatch when a session's socket becomes readable, which
+ * means the server has gone away (it never sends anything).
+ *
+ * \param events
+ *      Indicates whether the socket was readable, writable, or both
+ *      (OR-ed combination of Dispatch::FileEvent bits).
+ */
+void
+ShmTransport::ClientSocketHandler::handleFileEvent(int events)
+{
+    char data;
+    ssize_t count = recv(fd, &data, sizeof(data), MSG_DONTWAIT);
+    if (count > 0 || (count < 0 && (errno == EAGAIN || errno == EINTR)))
+        return;
+    LOG(NOTICE, "ShmTransport server at %s closed session",
+            session->serviceLocator.c_str());
+    session->abort();
+}
+
+/**
+ * Constructor for Pollers.
+ *
+ * \param transport
+ *      The transport whose rings will be polled.
+ */
+ShmTransport::Poller::Poller(ShmTransport* transport)
+    : Dispatch::Poller(transport->context->dispatch, "ShmTransport")
+    , transport(transport)
+{
+}
+
+/**
+ * Invoked by Dispatch to move messages through all of the transport's
+ * rings.
+ *
+ * \return
+ *      1 means that useful work was done, 0 means there was nothing to do.
+ */
+int
+ShmTransport::Poller::poll()
+{
+    int result = 0;
+    for (auto it = transport->connections.begin();
+            it != transport->connections.end(); ) {
+        // The connection may be deleted while it is polled.
+        ServerConnection* connection = it->second;
+        it++;
+        result |= connection->poll();
+    }
+    foreach (ShmSession& session, transport->sessions) {
+        result |= session.poll();
+    }
+    return result;
+}
+
+}  // namespace RAMCloud
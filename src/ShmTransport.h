@@ -0,0 +1,423 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_SHMTRANSPORT_H
+#define RAMCLOUD_SHMTRANSPORT_H
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <atomic>
+#include <unordered_map>
+
+#include "BoostIntrusive.h"
+#include "Dispatch.h"
+#include "ObjectPool.h"
+#include "ServerRpcPool.h"
+#include "SessionAlarm.h"
+#include "Transport.h"
+
+namespace RAMCloud {
+
+/**
+ * A transport for clients running on the same machine as the server they
+ * talk to. Each session owns a region of shared memory holding two
+ * single-producer, single-consumer rings, one for requests and one for
+ * responses; both sides find new messages by polling the rings from a
+ * Dispatch poller, so no system calls are made once a session is open.
+ * Each message is copied just once in each direction: from the sender's
+ * Buffer into the ring, and from the ring into the receiver's Buffer.
+ *
+ * Servers listen with a locator such as "shm:name=master1", which names a
+ * Unix-domain socket in the abstract namespace. Clients connect to it to
+ * pass the server a file descriptor for the shared memory; the socket is
+ * then used only to notice that the other side has gone away.
+ */
+class ShmTransport : public Transport {
+  public:
+    explicit ShmTransport(Context* context,
+            const ServiceLocator* serviceLocator = NULL);
+    ~ShmTransport();
+    SessionRef getSession(const ServiceLocator* serviceLocator,
+            uint32_t timeoutMs = 0) {
+        return new ShmSession(this, serviceLocator, timeoutMs);
+    }
+    string getServiceLocator() {
+        return locatorString;
+    }
+
+    /// Size in bytes of each ring of a session's shared memory.
+    static const uint32_t RING_BYTES = 1 << 20;
+
+    class ShmServerRpc;
+  PRIVATE:
+    class ServerConnection;
+    class ShmSession;
+
+    /**
+     * A single-producer, single-consumer queue of bytes in shared memory.
+     * Messages are written as a sequence of fragments, each a
+     * FragmentHeader followed by data; a fragment is made visible to the
+     * consumer all at once by advancing #tail.
+     */
+    struct Ring {
+        void copyIn(uint64_t position, const void* source, uint32_t length);
+        void copyOut(uint64_t position, void* dest, uint32_t length);
+
+        /// Total number of bytes consumed; written only by the consumer.
+        alignas(64) std::atomic<uint64_t> head;
+
+        /// Total number of bytes produced; written only by the producer.
+        alignas(64) std::atomic<uint64_t> tail;
+
+        /// Storage for the ring; byte i of the stream is stored at
+        /// data[i % RING_BYTES].
+        alignas(64) char data[RING_BYTES];
+    };
+
+    /// Layout of the shared memory for a session.
+    struct SharedRegion {
+        /// Requests from the client to the server.
+        Ring requests;
+
+        /// Responses from the server to the client.
+        Ring responses;
+    };
+
+    /// Precedes each fragment of a message in a Ring.
+    struct FragmentHeader {
+        /// Identifies the RPC: chosen by the client and echoed in the
+        /// response.
+        uint64_t nonce;
+
+        /// Total size of the message that this fragment is part of.
+        uint32_t messageLength;
+
+        /// Number of bytes of message data following this header.
+        uint32_t fragmentLength;
+    } __attribute__((packed));
+
+    /// Largest amount of message data in a single fragment, so that large
+    /// messages are passed through the ring in pieces.
+    static const uint32_t MAX_FRAGMENT_BYTES = RING_BYTES / 4;
+
+    /**
+     * Keeps track of a message that is partially received from a Ring.
+     */
+    struct IncomingMessage {
+        IncomingMessage()
+            : active(false), nonce(0), messageLength(0), bytesReceived(0),
+              buffer(NULL)
+        {}
+
+        /// True means a message has started to arrive and is incomplete.
+        bool active;
+
+        /// Nonce of the message.
+        uint64_t nonce;
+
+        /// Total size of the message.
+        uint32_t messageLength;
+
+        /// Number of bytes of the message received so far.
+        uint32_t bytesReceived;
+
+        /// Where the message is being assembled; NULL means it is being
+        /// discarded (for example, because its RPC was canceled).
+        Buffer* buffer;
+    };
+
+    static bool sendMessage(Ring* ring, uint64_t nonce, Buffer* message,
+            uint32_t length, uint32_t* bytesSent);
+    static bool peekFragment(Ring* ring, FragmentHeader* header);
+    static void consumeFragment(Ring* ring, const FragmentHeader& header,
+            Buffer* buffer);
+
+  public:
+    /**
+     * The server-side state of an RPC received over a ShmTransport.
+     */
+    class ShmServerRpc : public Transport::ServerRpc {
+        friend class ShmTransport;
+        friend class ObjectPool<ShmServerRpc>;
+      public:
+        virtual ~ShmServerRpc() {}
+        void sendReply();
+        string getClientServiceLocator();
+      PRIVATE:
+        ShmServerRpc(ShmTransport* transport, uint64_t connectionId,
+                uint64_t nonce)
+            : transport(transport)
+            , connectionId(connectionId)
+            , nonce(nonce)
+            , queueEntries()
+        {}
+
+        /// The transport that received the request.
+        ShmTransport* transport;
+
+        /// Identifies the ServerConnection the request arrived on; it may
+        /// have been closed by the time the reply is ready.
+        uint64_t connectionId;
+
+        /// Nonce of the request, to be returned with the response.
+        uint64_t nonce;
+
+        /// Links this RPC onto ServerConnection::rpcsWaitingToReply.
+        IntrusiveListHook queueEntries;
+
+        DISALLOW_COPY_AND_ASSIGN(ShmServerRpc);
+    };
+
+  PRIVATE:
+    /**
+     * The client-side state of an outstanding RPC.
+     */
+    struct ShmClientRpc {
+        ShmClientRpc(Buffer* request, Buffer* response,
+                RpcNotifier* notifier, uint64_t nonce)
+            : request(request)
+            , requestLength(request->size())
+            , response(response)
+            , notifier(notifier)
+            , nonce(nonce)
+            , queueEntries()
+        {}
+
+        /// Request message; NULL means the RPC was canceled while the
+        /// request was partially sent, so its remaining bytes are sent as
+        /// zeros to keep the ring consistent.
+        Buffer* request;
+
+        /// Size of the request message.
+        uint32_t requestLength;
+
+        /// Buffer for the response.
+        Buffer* response;
+
+        /// Used to report completion; NULL once canceled.
+        RpcNotifier* notifier;
+
+        /// Identifies the RPC's response.
+        uint64_t nonce;
+
+        /// Links this RPC onto one of the lists of its session.
+        IntrusiveListHook queueEntries;
+
+        DISALLOW_COPY_AND_ASSIGN(ShmClientRpc);
+    };
+
+    /**
+     * Invoked by Dispatch when the server's listening socket has a new
+     * connection.
+     */
+    class AcceptHandler : public Dispatch::File {
+      public:
+        AcceptHandler(int fd, ShmTransport* transport);
+        virtual void handleFileEvent(int events);
+      PRIVATE:
+        ShmTransport* transport;
+        DISALLOW_COPY_AND_ASSIGN(AcceptHandler);
+    };
+
+    /**
+     * Invoked by Dispatch when the socket for a ServerConnection is
+     * readable: first when the client sends its shared memory, then when
+     * the client goes away.
+     */
+    class ServerSocketHandler : public Dispatch::File {
+      public:
+        ServerSocketHandler(int fd, ShmTransport* transport,
+                uint64_t connectionId);
+        virtual void handleFileEvent(int events);
+      PRIVATE:
+        ShmTransport* transport;
+        uint64_t connectionId;
+        DISALLOW_COPY_AND_ASSIGN(ServerSocketHandler);
+    };
+
+    /**
+     * Invoked by Dispatch when a session's socket is readable, which only
+     * happens when the server goes away.
+     */
+    class ClientSocketHandler : public Dispatch::File {
+      public:
+        ClientSocketHandler(int fd, ShmSession* session);
+        virtual void handleFileEvent(int events);
+      PRIVATE:
+        ShmSession* session;
+        DISALLOW_COPY_AND_ASSIGN(ClientSocketHandler);
+    };
+
+    INTRUSIVE_LIST_TYPEDEF(ShmServerRpc, queueEntries) ServerRpcList;
+    INTRUSIVE_LIST_TYPEDEF(ShmClientRpc, queueEntries) ClientRpcList;
+
+    /**
+     * The server's side of a session.
+     */
+    class ServerConnection {
+      public:
+        ServerConnection(ShmTransport* transport, uint64_t id, int fd);
+        ~ServerConnection();
+        int poll();
+
+        /// The transport that owns this connection.
+        ShmTransport* transport;
+
+        /// Unique identifier for this connection.
+        uint64_t id;
+
+        /// Socket connected to the client.
+        int fd;
+
+        /// The client's shared memory; NULL until the client has sent it.
+        SharedRegion* region;
+
+        /// Request currently being received, if any.
+        IncomingMessage incoming;
+
+        /// The RPC for #incoming.
+        ShmServerRpc* current;
+
+        /// RPCs whose responses are ready but haven't been completely
+        /// written to the ring; the first one is being written.
+        ServerRpcList rpcsWaitingToReply;
+
+        /// Bytes of the first RPC's response already written.
+        uint32_t bytesSent;
+
+        /// Notices when the client sends its memory or goes away.
+        Tub<ServerSocketHandler> handler;
+
+        DISALLOW_COPY_AND_ASSIGN(ServerConnection);
+    };
+
+    /**
+     * A client's connection to a server.
+     */
+    class ShmSession : public Session {
+        friend class ShmTransport;
+      public:
+        ShmSession(ShmTransport* transport,
+                const ServiceLocator* serviceLocator, uint32_t timeoutMs);
+        ~ShmSession();
+        virtual void abort();
+        virtual void cancelRequest(RpcNotifier* notifier);
+        virtual string getRpcInfo();
+        virtual void sendRequest(Buffer* request, Buffer* response,
+                RpcNotifier* notifier);
+      PRIVATE:
+        void close();
+        int poll();
+        void sendQueued();
+
+        /// Transport that owns this session.
+        ShmTransport* transport;
+
+        /// Socket connected to the server; -1 once the session is closed.
+        int fd;
+
+        /// Shared memory for the session; NULL once the session is closed.
+        SharedRegion* region;
+
+        /// Used to generate nonces for RPCs.
+        uint64_t serial;
+
+        /// RPCs whose requests haven't been completely written to the
+        /// ring; the first one is being written.
+        ClientRpcList rpcsWaitingToSend;
+
+        /// Bytes of the first RPC's request already written.
+        uint32_t bytesSent;
+
+        /// RPCs whose requests have been sent, awaiting responses.
+        ClientRpcList rpcsWaitingForResponse;
+
+        /// Response currently being received, if any.
+        IncomingMessage incoming;
+
+        /// The RPC for #incoming; NULL if it is being discarded.
+        ShmClientRpc* current;
+
+        /// Notices when the server goes away.
+        Tub<ClientSocketHandler> handler;
+
+        /// Detects servers that stop responding.
+        SessionAlarm alarm;
+
+        /// Links this session onto ShmTransport::sessions.
+        IntrusiveListHook sessionEntries;
+
+        DISALLOW_COPY_AND_ASSIGN(ShmSession);
+    };
+
+    /**
+     * Moves messages through the rings of all open sessions and
+     * connections.
+     */
+    class Poller : public Dispatch::Poller {
+      public:
+        explicit Poller(ShmTransport* transport);
+        virtual int poll();
+      PRIVATE:
+        ShmTransport* transport;
+        DISALLOW_COPY_AND_ASSIGN(Poller);
+    };
+
+    void closeConnection(uint64_t id);
+    static SharedRegion* mapRegion(int fd);
+    static void unmapRegion(SharedRegion* region);
+    static socklen_t makeAddress(const string& name,
+            struct sockaddr_un* address);
+
+    /// Shared RAMCloud information.
+    Context* context;
+
+    /// Service locator used to open the transport, if it listens.
+    string locatorString;
+
+    /// Socket on which the server listens for sessions; -1 if none.
+    int listenSocket;
+
+    /// Handles new connections on #listenSocket.
+    Tub<AcceptHandler> acceptHandler;
+
+    /// Open connections from clients, indexed by connection id.
+    std::unordered_map<uint64_t, ServerConnection*> connections;
+
+    /// Id for the next ServerConnection.
+    uint64_t nextConnectionId;
+
+    INTRUSIVE_LIST_TYPEDEF(ShmSession, sessionEntries) SessionList;
+
+    /// All sessions opened through this transport that haven't been
+    /// destroyed. Modified only with the Dispatch lock held.
+    SessionList sessions;
+
+    /// Polls all rings.
+    Poller poller;
+
+    /// Pool allocator for ShmServerRpc objects.
+    ServerRpcPool<ShmServerRpc> serverRpcPool;
+
+    /// Pool allocator for ShmClientRpc objects.
+    ObjectPool<ShmClientRpc> clientRpcPool;
+
+    DISALLOW_COPY_AND_ASSIGN(ShmTransport);
+};
+
+}  // namespace RAMCloud
+
+#endif  // RAMCLOUD_SHMTRANSPORT_H
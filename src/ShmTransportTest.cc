@@ -0,0 +1,238 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "MockWrapper.h"
+#include "ServiceLocator.h"
+#include "ShmTransport.h"
+#include "WorkerManager.h"
+
+namespace RAMCloud {
+
+class ShmTransportTest : public ::testing::Test {
+  public:
+    Context context;
+    WorkerManager* workerManager;
+    ServiceLocator locator;
+    TestLog::Enable logEnabler;
+    ShmTransport server;
+    ShmTransport client;
+
+    ShmTransportTest()
+            : context()
+            , workerManager(NULL)
+            , locator("shm:name=ShmTransportTest")
+            , logEnabler()
+            , server(&context, &locator)
+            , client(&context)
+    {
+        workerManager = new WorkerManager(&context);
+        context.workerManager = workerManager;
+        workerManager->testingSaveRpcs = 1;
+    }
+
+    // Run the dispatcher until the server has mapped the shared memory
+    // for a session (but give up if it takes too long).  The return value
+    // is true if the memory has been mapped.
+    bool waitForConnection(ShmTransport& transport)
+    {
+        // See "Timing-Dependent Tests" in designNotes.
+        for (int i = 0; i < 1000; i++) {
+            context.dispatch->poll();
+            if (transport.connections.size() > 0 &&
+                    transport.connections.begin()->second->region != NULL)
+                return true;
+            usleep(1000);
+        }
+        return false;
+    }
+
+    // Fill a buffer with a recognizable pattern of the given length.
+    void fillBuffer(Buffer* buffer, uint32_t length)
+    {
+        char* data = static_cast<char*>(buffer->alloc(length));
+        for (uint32_t i = 0; i < length; i++) {
+            data[i] = static_cast<char>('a' + (i % 23));
+        }
+    }
+
+    // Returns true if the buffer holds the pattern from fillBuffer.
+    bool checkBuffer(Buffer* buffer, uint32_t length)
+    {
+        if (buffer->size() != length)
+            return false;
+        const char* data = static_cast<const char*>(
+                buffer->getRange(0, length));
+        for (uint32_t i = 0; i < length; i++) {
+            if (data[i] != static_cast<char>('a' + (i % 23)))
+                return false;
+        }
+        return true;
+    }
+    DISALLOW_COPY_AND_ASSIGN(ShmTransportTest);
+};
+
+TEST_F(ShmTransportTest, sanityCheck) {
+    Transport::SessionRef session = client.getSession(&locator);
+
+    // Send two requests from the client.
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+
+    // Receive the two requests on the server.
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+    EXPECT_EQ("request1", TestUtil::toString(&serverRpc1->requestPayload));
+    Transport::ServerRpc* serverRpc2 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc2 != NULL);
+    EXPECT_EQ("request2", TestUtil::toString(&serverRpc2->requestPayload));
+    EXPECT_EQ("shm:client=1", serverRpc1->getClientServiceLocator());
+
+    // Reply to the requests in backwards order.
+    serverRpc2->replyPayload.fillFromString("response2");
+    serverRpc2->sendReply();
+    serverRpc1->replyPayload.fillFromString("response1");
+    serverRpc1->sendReply();
+
+    // Receive the responses in the client.
+    EXPECT_STREQ("completed: 0, failed: 0", rpc1.getState());
+    EXPECT_STREQ("completed: 0, failed: 0", rpc2.getState());
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+    EXPECT_STREQ("completed: 1, failed: 0", rpc1.getState());
+    EXPECT_STREQ("completed: 1, failed: 0", rpc2.getState());
+    EXPECT_EQ("response1/0", TestUtil::toString(&rpc1.response));
+    EXPECT_EQ("response2/0", TestUtil::toString(&rpc2.response));
+}
+
+TEST_F(ShmTransportTest, constructor_nameInUse) {
+    string message("no exception");
+    try {
+        ShmTransport server2(&context, &locator);
+    } catch (TransportException& e) {
+        message = e.message;
+    }
+    EXPECT_EQ("ShmTransport couldn't bind to 'shm:name=ShmTransportTest': "
+            "Address already in use", message);
+}
+
+TEST_F(ShmTransportTest, getSession_noServer) {
+    ServiceLocator bogus("shm:name=noSuchServer");
+    EXPECT_THROW(client.getSession(&bogus), TransportException);
+}
+
+TEST_F(ShmTransportTest, sendMessage_largerThanRing) {
+    // Messages larger than the ring must be streamed through it in
+    // fragments, with the other side consuming as they arrive.
+    uint32_t length = ShmTransport::RING_BYTES * 3 + 1000;
+    Transport::SessionRef session = client.getSession(&locator);
+    MockWrapper rpc;
+    fillBuffer(&rpc.request, length);
+    session->sendRequest(&rpc.request, &rpc.response, &rpc);
+    Transport::ServerRpc* serverRpc = workerManager->waitForRpc(5.0);
+    ASSERT_TRUE(serverRpc != NULL);
+    EXPECT_TRUE(checkBuffer(&serverRpc->requestPayload, length));
+
+    fillBuffer(&serverRpc->replyPayload, length);
+    serverRpc->sendReply();
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc));
+    EXPECT_STREQ("completed: 1, failed: 0", rpc.getState());
+    EXPECT_TRUE(checkBuffer(&rpc.response, length));
+}
+
+TEST_F(ShmTransportTest, cancelRequest_waitingForResponse) {
+    Transport::SessionRef session = client.getSession(&locator);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+    Transport::ServerRpc* serverRpc2 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc2 != NULL);
+
+    // The response for a canceled RPC is discarded.
+    session->cancelRequest(&rpc1);
+    serverRpc1->replyPayload.fillFromString("response1");
+    serverRpc1->sendReply();
+    serverRpc2->replyPayload.fillFromString("response2");
+    serverRpc2->sendReply();
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc2));
+    EXPECT_STREQ("completed: 0, failed: 0", rpc1.getState());
+    EXPECT_EQ("", TestUtil::toString(&rpc1.response));
+    EXPECT_EQ("response2/0", TestUtil::toString(&rpc2.response));
+}
+
+TEST_F(ShmTransportTest, cancelRequest_partiallySent) {
+    // Fill the ring, so the second request is only partially sent.
+    uint32_t length = ShmTransport::RING_BYTES;
+    Transport::SessionRef session = client.getSession(&locator);
+    MockWrapper rpc1;
+    fillBuffer(&rpc1.request, length);
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+
+    // The rest of the canceled request is sent as zeros; the following
+    // request is unaffected.
+    session->cancelRequest(&rpc1);
+    rpc1.request.reset();
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(5.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+    EXPECT_EQ(length, serverRpc1->requestPayload.size());
+    Transport::ServerRpc* serverRpc2 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc2 != NULL);
+    EXPECT_EQ("request2", TestUtil::toString(&serverRpc2->requestPayload));
+    serverRpc1->sendReply();
+    serverRpc2->replyPayload.fillFromString("response2");
+    serverRpc2->sendReply();
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc2));
+    EXPECT_STREQ("completed: 0, failed: 0", rpc1.getState());
+}
+
+TEST_F(ShmTransportTest, serverClosesConnection) {
+    Transport::SessionRef session = client.getSession(&locator);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    EXPECT_TRUE(waitForConnection(server));
+    Transport::ServerRpc* serverRpc1 = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc1 != NULL);
+
+    // The client's RPC fails, and the server quietly discards the reply.
+    server.closeConnection(server.connections.begin()->first);
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+    EXPECT_STREQ("completed: 0, failed: 1", rpc1.getState());
+    serverRpc1->sendReply();
+
+    // Later requests fail immediately.
+    MockWrapper rpc2("request2");
+    session->sendRequest(&rpc2.request, &rpc2.response, &rpc2);
+    EXPECT_STREQ("completed: 0, failed: 1", rpc2.getState());
+}
+
+TEST_F(ShmTransportTest, clientClosesSession) {
+    Transport::SessionRef session = client.getSession(&locator);
+    EXPECT_TRUE(waitForConnection(server));
+    session = NULL;
+    for (int i = 0; i < 1000 && server.connections.size() > 0; i++) {
+        context.dispatch->poll();
+        usleep(1000);
+    }
+    EXPECT_EQ(0U, server.connections.size());
+}
+
+}  // namespace RAMCloud
@@ -98,6 +98,7 @@ SideLog::commit()
 
     // The last segment will still be open. Close it and begin replication.
     LogSegment* lastSegmentAllocated = segments.back();
+    waitForPendingCopies(lastSegmentAllocated);
     lastSegmentAllocated->close();
     lastSegmentAllocated->replicatedSegment->close();
 
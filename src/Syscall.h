@@ -135,6 +135,10 @@ class Syscall {
         return ::recvmmsg(sockfd, msgvec, vlen, flags, timeout);
     }
     VIRTUAL_FOR_TESTING
+    ssize_t recvmsg(int sockfd, msghdr *msg, int flags) {
+        return ::recvmsg(sockfd, msg, flags);
+    }
+    VIRTUAL_FOR_TESTING
     int select(int nfds, fd_set *readfds, fd_set *writefds,
            fd_set *errorfds, struct timeval *timeout)
     {
@@ -934,6 +934,19 @@ TEST_F(TableManagerTest, splitTablet_tabletRecovering) {
             RetryException);
 }
 
+TEST_F(TableManagerTest, splitTablet_byTableId) {
+    MasterService* master1 = cluster.addServer(masterConfig)->master.get();
+    uint64_t tableId = tableManager->createTable("foo", 1);
+
+    EXPECT_THROW(tableManager->splitTablet(tableId + 1, 0x1000),
+            TableManager::NoSuchTable);
+    tableManager->splitTablet(tableId, 0x1000);
+    EXPECT_EQ("{ foo(id 1): { 0x0-0xfff on 1.0 } "
+            "{ 0x1000-0xffffffffffffffff on 1.0 } }",
+            tableManager->debugString(true));
+    EXPECT_EQ(2U, master1->tabletManager.getNumTablets());
+}
+
 TEST_F(TableManagerTest, splitRecoveringTablet_splitAlreadyExists) {
     cluster.addServer(masterConfig);
     uint64_t tableId = tableManager->createTable("foo", 2);
@@ -0,0 +1,252 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TableScanner.h"
+#include "Dispatch.h"
+#include "ObjectFinder.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Constructor for TableScanner objects. No RPCs are sent until hasNext or
+ * next is first invoked.
+ *
+ * \param ramcloud
+ *      Overall information about the RAMCloud cluster to use for this
+ *      scan.
+ * \param tableId
+ *      Identifier for the table to scan.
+ * \param keysOnly
+ *      False means that objects are returned with their data (subject to
+ *      the filter's maxValueBytes). True means that the returned objects
+ *      have been truncated so that the object data is omitted.
+ * \param filter
+ *      Selects the objects to return; it is copied.
+ * \param maxOutstandingRpcs
+ *      Limit on the number of ENUMERATE requests (each for a different
+ *      tablet) in flight at once.
+ */
+TableScanner::TableScanner(RamCloud& ramcloud, uint64_t tableId,
+        bool keysOnly, const EnumerationFilter& filter,
+        uint32_t maxOutstandingRpcs)
+    : ramcloud(ramcloud)
+    , tableId(tableId)
+    , keysOnly(keysOnly)
+    , filter(filter)
+    , maxOutstandingRpcs(std::max(maxOutstandingRpcs, 1u))
+    , outstandingRpcs(0)
+    , streams()
+    , current(NULL)
+    , started(false)
+    , done(false)
+{
+}
+
+/**
+ * Test if any matching objects remain to be returned.
+ *
+ * \result
+ *      True if any objects remain, or false otherwise.
+ */
+bool
+TableScanner::hasNext()
+{
+    requestMoreObjects();
+    return !done;
+}
+
+/**
+ * Return the next matching object in the table.
+ *
+ * \param[out] size
+ *      After a successful return, this field will hold the size of
+ *      the object in bytes (which may be less than the size of the
+ *      stored object, if its value was truncated).
+ * \param[out] object
+ *      After a successful return, this will point to contiguous
+ *      memory containing an instance of Object immediately followed
+ *      by its key and data payloads. NULL is returned to indicate
+ *      that the scan is complete.
+ */
+void
+TableScanner::next(uint32_t* size, const void** object)
+{
+    *size = 0;
+    *object = NULL;
+
+    requestMoreObjects();
+    if (done) return;
+
+    uint32_t objectSize = *current->objects.getOffset<uint32_t>(
+            current->nextOffset);
+    current->nextOffset += downCast<uint32_t>(sizeof(uint32_t));
+    *object = current->objects.getRange(current->nextOffset, objectSize);
+    *size = objectSize;
+    current->nextOffset += objectSize;
+}
+
+/**
+ * Returns the next matching object, if any, with a more convenient
+ * interface than hasNext and next.
+ *
+ * \param[out] keyLength
+ *      After successful return, this field holds the size of the key in bytes.
+ * \param[out] key
+ *      After a successful return, this points to contiguous memory containing
+ *      the key. NULL is returned to indicate the scan is complete.
+ * \param[out] dataLength
+ *      After successful return, this field holds the size of the returned
+ *      data in bytes.
+ * \param[out] data
+ *      After a successful return, this points to contiguous memory
+ *      containing the data (or as much of it as the filter's
+ *      maxValueBytes allows). NULL if keysOnly was specified.
+ */
+void
+TableScanner::nextKeyAndData(uint32_t* keyLength, const void** key,
+                             uint32_t* dataLength, const void** data)
+{
+    *keyLength = 0;
+    *key = NULL;
+    *dataLength = 0;
+    *data = NULL;
+
+    uint32_t size = 0;
+    const void* buffer = NULL;
+    next(&size, &buffer);
+    if (done) return;
+
+    Object object(buffer, size);
+    *keyLength = object.getKeyLength();
+    *key = object.getKey();
+    if (!keysOnly) {
+        *data = object.getValue(dataLength);
+    }
+}
+
+/**
+ * Create one stream for each tablet of the table that the filter's key
+ * hash range overlaps.
+ *
+ * \throw TableDoesntExistException
+ *      The table doesn't exist.
+ */
+void
+TableScanner::findTablets()
+{
+    uint64_t keyHash = 0;
+    do {
+        TabletWithLocator* tablet = ramcloud.clientContext->objectFinder->
+                lookupTablet(tableId, keyHash);
+        uint64_t lastHash = tablet->tablet.endKeyHash;
+        if (keyHash > filter.lastKeyHash)
+            break;
+        streams.emplace_back(keyHash, std::min(lastHash, filter.lastKeyHash));
+        keyHash = lastHash + 1;
+    } while (keyHash != 0);
+}
+
+/**
+ * Used internally by #hasNext and #next to retrieve objects. Sets #done
+ * if the scan is complete; otherwise #current refers to a stream that has
+ * at least one object left to return.
+ */
+void
+TableScanner::requestMoreObjects()
+{
+    if (done) return;
+    if (current != NULL) {
+        if (current->nextOffset < current->objects.size())
+            return;
+        current->state = Stream::IDLE;
+        current = NULL;
+    }
+    if (!started) {
+        findTablets();
+        started = true;
+    }
+
+    while (true) {
+        sendRpcs();
+        if (outstandingRpcs == 0) {
+            done = true;
+            return;
+        }
+
+        // Take the first response to arrive, whichever tablet it's for.
+        Stream* stream = NULL;
+        while (stream == NULL) {
+            foreach (Stream& candidate, streams) {
+                if (candidate.state == Stream::ACTIVE &&
+                        candidate.rpc->isReady()) {
+                    stream = &candidate;
+                    break;
+                }
+            }
+            if (stream == NULL)
+                ramcloud.clientContext->dispatch->poll();
+        }
+
+        uint64_t nextHash = stream->rpc->wait(stream->iter);
+        stream->rpc.destroy();
+        outstandingRpcs--;
+        if (stream->objects.size() > 0) {
+            stream->state = Stream::READY;
+            stream->nextHash = nextHash;
+            stream->nextOffset = 0;
+            current = stream;
+            return;
+        }
+
+        // If nextHash didn't move and the master left iterator state, it
+        // merely reached its scan limit without a match (the end of a
+        // tablet clears the state), so the stream asks it again.
+        // Otherwise the master has nothing more in the part of the range it
+        // owns; continue with whoever owns the rest of the range, if anyone.
+        if (nextHash == stream->nextHash && stream->iter.size() > 0) {
+            stream->state = Stream::IDLE;
+        } else if (nextHash == 0 || nextHash > stream->lastHash) {
+            stream->state = Stream::DONE;
+        } else {
+            stream->nextHash = nextHash;
+            stream->state = Stream::IDLE;
+        }
+    }
+}
+
+/**
+ * Send requests for streams that need them, without exceeding
+ * #maxOutstandingRpcs.
+ */
+void
+TableScanner::sendRpcs()
+{
+    foreach (Stream& stream, streams) {
+        if (outstandingRpcs >= maxOutstandingRpcs)
+            return;
+        if (stream.state != Stream::IDLE)
+            continue;
+        EnumerationFilter streamFilter(filter);
+        streamFilter.lastKeyHash = stream.lastHash;
+        stream.objects.reset();
+        stream.rpc.construct(&ramcloud, tableId, keysOnly, stream.nextHash,
+                stream.iter, stream.objects, &streamFilter);
+        stream.state = Stream::ACTIVE;
+        outstandingRpcs++;
+    }
+}
+
+} // namespace RAMCloud
@@ -0,0 +1,127 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_TABLESCANNER_H
+#define RAMCLOUD_TABLESCANNER_H
+
+#include <list>
+
+#include "RamCloud.h"
+#include "EnumerationFilter.h"
+#include "Object.h"
+
+namespace RAMCloud {
+
+/**
+ * This class provides a client-side interface for scanning a table with a
+ * filter: like TableEnumerator, it returns the table's objects, but the
+ * masters only send the objects that match an EnumerationFilter (and only
+ * as much of each as the filter's projection allows), and several tablets
+ * are scanned at once, each with its own ENUMERATE requests in flight.
+ * Objects from different tablets are interleaved in the output; there is
+ * no ordering guarantee.
+ *
+ * The consistency guarantees are the same as TableEnumerator's: each
+ * matching object that exists throughout the scan is returned exactly once.
+ */
+class TableScanner {
+  public:
+    TableScanner(RamCloud& ramcloud, uint64_t tableId, bool keysOnly,
+            const EnumerationFilter& filter, uint32_t maxOutstandingRpcs = 4);
+    bool hasNext();
+    void next(uint32_t* size, const void** object);
+    void nextKeyAndData(uint32_t* keyLength, const void** key,
+                        uint32_t* dataLength, const void** data);
+
+  PRIVATE:
+    /**
+     * Scans the key hash range of one tablet (as the tablet was configured
+     * when the scan started; the range may move or be split among masters
+     * since, which EnumerateTableRpc copes with).
+     */
+    struct Stream {
+        enum State {
+            IDLE,       // Needs another RPC to make progress.
+            ACTIVE,     // An RPC is in flight.
+            READY,      // Objects have been received and not yet consumed.
+            DONE        // All of the range's objects have been returned.
+        };
+
+        /// Where to continue enumeration; see RamCloud::enumerateTable.
+        uint64_t nextHash;
+
+        /// Last key hash covered by this stream.
+        uint64_t lastHash;
+
+        State state;
+
+        /// Opaque enumeration state, managed by the masters.
+        Buffer iter;
+
+        /// Objects from the most recent RPC.
+        Buffer objects;
+
+        /// Offset of the next object to return within #objects.
+        uint32_t nextOffset;
+
+        Tub<EnumerateTableRpc> rpc;
+
+        Stream(uint64_t firstHash, uint64_t lastHash)
+            : nextHash(firstHash), lastHash(lastHash), state(IDLE)
+            , iter(), objects(), nextOffset(0), rpc()
+        {}
+    };
+
+    void findTablets();
+    void requestMoreObjects();
+    void sendRpcs();
+
+    /// The RamCloud master object.
+    RamCloud& ramcloud;
+
+    /// The table being scanned.
+    uint64_t tableId;
+
+    /// True means only keys are returned; see TableEnumerator.
+    bool keysOnly;
+
+    /// Selects the objects to return; sent with every request.
+    EnumerationFilter filter;
+
+    /// Limit on the number of RPCs in flight at once.
+    uint32_t maxOutstandingRpcs;
+
+    /// Number of RPCs currently in flight.
+    uint32_t outstandingRpcs;
+
+    /// One entry for each tablet of the table when the scan started;
+    /// empty until the first call to hasNext or next.
+    std::list<Stream> streams;
+
+    /// The stream whose objects are currently being returned, or NULL.
+    Stream* current;
+
+    /// Set to true once #streams has been filled in.
+    bool started;
+
+    /// Set to true once every object has been returned.
+    bool done;
+
+    DISALLOW_COPY_AND_ASSIGN(TableScanner);
+};
+
+} // end RAMCloud
+
+#endif  // RAMCLOUD_TABLESCANNER_H
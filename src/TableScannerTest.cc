@@ -0,0 +1,239 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <set>
+
+#include "TestUtil.h"
+#include "Enumeration.h"
+#include "MockCluster.h"
+#include "TableScanner.h"
+
+namespace RAMCloud {
+
+class TableScannerTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    RamCloud ramcloud;
+    uint64_t tableId1;
+    EnumerationFilter filter;
+
+  public:
+    TableScannerTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , ramcloud(&context, "mock:host=coordinator")
+        , tableId1(-1)
+        , filter()
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+
+        ServerConfig config = ServerConfig::forTesting();
+        config.services = {WireFormat::MASTER_SERVICE,
+                           WireFormat::ADMIN_SERVICE};
+        config.localLocator = "mock:host=master1";
+        cluster.addServer(config);
+        config.localLocator = "mock:host=master2";
+        cluster.addServer(config);
+
+        tableId1 = ramcloud.createTable("table1", 2);
+    }
+
+    /**
+     * Run a scan to completion and return "key:value" for each object,
+     * sorted (the scanner interleaves tablets in no particular order).
+     */
+    string
+    scan(bool keysOnly = false)
+    {
+        TableScanner scanner(ramcloud, tableId1, keysOnly, filter);
+        std::set<string> results;
+        while (scanner.hasNext()) {
+            uint32_t keyLength, dataLength;
+            const void *key, *data;
+            scanner.nextKeyAndData(&keyLength, &key, &dataLength, &data);
+            results.insert(string(static_cast<const char*>(key), keyLength)
+                    + ":" + string(static_cast<const char*>(data),
+                    dataLength));
+        }
+        string s;
+        foreach (const string& result, results) {
+            s.append(s.empty() ? "" : " ");
+            s.append(result);
+        }
+        return s;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TableScannerTest);
+};
+
+TEST_F(TableScannerTest, basics) {
+    ramcloud.write(tableId1, "0", 1, "abcdef", 6);
+    ramcloud.write(tableId1, "1", 1, "ghijkl", 6);
+    ramcloud.write(tableId1, "2", 1, "mnopqr", 6);
+    ramcloud.write(tableId1, "3", 1, "stuvwx", 6);
+    ramcloud.write(tableId1, "4", 1, "yzabcd", 6);
+
+    EXPECT_EQ("0:abcdef 1:ghijkl 2:mnopqr 3:stuvwx 4:yzabcd", scan());
+    EXPECT_EQ("0: 1: 2: 3: 4:", scan(true));
+}
+
+TEST_F(TableScannerTest, next) {
+    ramcloud.write(tableId1, "0", 1, "abcdef", 6);
+
+    uint32_t size = 0;
+    const void* buffer = NULL;
+    TableScanner scanner(ramcloud, tableId1, false, filter);
+    EXPECT_TRUE(scanner.hasNext());
+    scanner.next(&size, &buffer);
+    Object object(buffer, size);
+    EXPECT_EQ(tableId1, object.getTableId());
+    EXPECT_EQ("0", string(reinterpret_cast<const char*>(
+                   object.getKey()), 1));
+    EXPECT_FALSE(scanner.hasNext());
+    scanner.next(&size, &buffer);
+    EXPECT_EQ(0U, size);
+    EXPECT_TRUE(buffer == NULL);
+}
+
+TEST_F(TableScannerTest, emptyTable) {
+    EXPECT_EQ("", scan());
+}
+
+TEST_F(TableScannerTest, manyObjects) {
+    char data[1024 * 32];
+    memset(data, 'x', sizeof(data));
+    uint32_t totalObjects = 300;
+    for (uint32_t i = 0; i < totalObjects; i++)
+        ramcloud.write(tableId1, &i, 4, data, sizeof(data));
+
+    TableScanner scanner(ramcloud, tableId1, false, filter, 1);
+    std::set<uint32_t> keys;
+    while (scanner.hasNext()) {
+        uint32_t keyLength, dataLength;
+        const void *key, *value;
+        scanner.nextKeyAndData(&keyLength, &key, &dataLength, &value);
+        EXPECT_EQ(4U, keyLength);
+        EXPECT_EQ(sizeof(data), dataLength);
+        keys.insert(*static_cast<const uint32_t*>(key));
+    }
+    EXPECT_EQ(totalObjects, keys.size());
+}
+
+TEST_F(TableScannerTest, filter_keyPrefix) {
+    ramcloud.write(tableId1, "apple", 5, "1", 1);
+    ramcloud.write(tableId1, "apricot", 7, "2", 1);
+    ramcloud.write(tableId1, "banana", 6, "3", 1);
+    ramcloud.write(tableId1, "a", 1, "4", 1);
+
+    filter.setKeyPrefix("ap", 2);
+    EXPECT_EQ("apple:1 apricot:2", scan());
+}
+
+TEST_F(TableScannerTest, filter_bucketLimit) {
+    ramcloud.write(tableId1, "apple", 5, "1", 1);
+    ramcloud.write(tableId1, "apricot", 7, "2", 1);
+    ramcloud.write(tableId1, "banana", 6, "3", 1);
+
+    // Masters return empty payloads until their scans reach the matching
+    // objects; the scanner must keep asking rather than give up.
+    uint64_t savedLimit = Enumeration::maxFilteredBuckets;
+    Enumeration::maxFilteredBuckets = 1;
+    filter.setKeyPrefix("ap", 2);
+    EXPECT_EQ("apple:1 apricot:2", scan());
+    Enumeration::maxFilteredBuckets = savedLimit;
+}
+
+TEST_F(TableScannerTest, filter_minVersion) {
+    // New objects can all start out with the same version, so overwrite
+    // the newer ones to move them past it.
+    uint64_t version;
+    ramcloud.write(tableId1, "0", 1, "old", 3);
+    ramcloud.write(tableId1, "1", 1, "new", 3);
+    ramcloud.write(tableId1, "1", 1, "new", 3, NULL, &version);
+    ramcloud.write(tableId1, "2", 1, "newer", 5);
+    ramcloud.write(tableId1, "2", 1, "newer", 5);
+    ramcloud.write(tableId1, "2", 1, "newer", 5);
+
+    filter.minVersion = version;
+    EXPECT_EQ("1:new 2:newer", scan());
+}
+
+TEST_F(TableScannerTest, filter_maxValueBytes) {
+    ramcloud.write(tableId1, "0", 1, "abcdef", 6);
+    ramcloud.write(tableId1, "1", 1, "gh", 2);
+
+    filter.maxValueBytes = 3;
+    EXPECT_EQ("0:abc 1:gh", scan());
+    EXPECT_EQ("0: 1:", scan(true));
+}
+
+TEST_F(TableScannerTest, filter_indexKeyRange) {
+    KeyInfo keyList[2];
+    keyList[0].key = "alice";
+    keyList[0].keyLength = 5;
+    keyList[1].key = "30";
+    keyList[1].keyLength = 2;
+    ramcloud.write(tableId1, 2, keyList, "a");
+    keyList[0].key = "bob";
+    keyList[0].keyLength = 3;
+    keyList[1].key = "45";
+    ramcloud.write(tableId1, 2, keyList, "b");
+    keyList[0].key = "carol";
+    keyList[0].keyLength = 5;
+    keyList[1].key = "52";
+    ramcloud.write(tableId1, 2, keyList, "c");
+    ramcloud.write(tableId1, "dave", 4, "d", 1);
+
+    filter.setIndexKeyRange(1, "40", 2, "52", 2);
+    EXPECT_EQ("bob:b carol:c", scan());
+    filter.setIndexKeyRange(2, "00", 2, "99", 2);
+    EXPECT_EQ("", scan());
+}
+
+TEST_F(TableScannerTest, filter_serializeAndParse) {
+    filter.lastKeyHash = 1234;
+    filter.minVersion = 5;
+    filter.maxValueBytes = 6;
+    filter.setKeyPrefix("pre", 3);
+    filter.setIndexKeyRange(2, "first", 5, "last", 4);
+
+    Buffer request;
+    WireFormat::Enumerate::Request* reqHdr =
+            request.emplaceAppend<WireFormat::Enumerate::Request>();
+    filter.serializeToRequest(reqHdr, &request);
+    request.appendCopy("iter", 4);
+
+    EnumerationFilter parsed;
+    EXPECT_EQ(12U, parsed.parseFromRequest(reqHdr, &request,
+            downCast<uint32_t>(sizeof(*reqHdr))));
+    EXPECT_EQ(1234U, parsed.lastKeyHash);
+    EXPECT_EQ(5U, parsed.minVersion);
+    EXPECT_EQ(6U, parsed.maxValueBytes);
+    EXPECT_EQ("pre", parsed.keyPrefix);
+    EXPECT_EQ(2U, parsed.indexId);
+    EXPECT_EQ("first", parsed.firstIndexKey);
+    EXPECT_EQ("last", parsed.lastIndexKey);
+    EXPECT_FALSE(parsed.selectsAll());
+
+    request.truncate(downCast<uint32_t>(sizeof(*reqHdr)) + 4);
+    EXPECT_THROW(parsed.parseFromRequest(reqHdr, &request,
+            downCast<uint32_t>(sizeof(*reqHdr))), MessageTooShortError);
+}
+
+}  // namespace RAMCloud
@@ -164,6 +164,46 @@ decrement(MasterTableMetadata* mtm,
     }
 }
 
+/**
+ * Estimate how many bytes of log data belong to one tablet on this master,
+ * assuming the table's data is spread evenly over the key hashes this master
+ * owns. Used to report per-tablet sizes to the coordinator, so it can
+ * decide which tablets are worth moving when balancing load.
+ *
+ * \param mtm
+ *      Pointer to MasterTableMetadata container that is storing the current
+ *      stats information.  Must not be NULL.
+ * \param tableId
+ *      Id of the table containing the tablet.
+ * \param startKeyHash
+ *      First key hash value of the tablet.
+ * \param endKeyHash
+ *      Last key hash value of the tablet.
+ * \return
+ *      Estimated number of bytes of live and dead log data for the tablet;
+ *      0 if no stats are known for the table.
+ */
+uint64_t
+estimateByteCount(MasterTableMetadata* mtm,
+                  uint64_t tableId,
+                  uint64_t startKeyHash,
+                  uint64_t endKeyHash)
+{
+    MasterTableMetadata::Entry* entry;
+    entry = mtm->find(tableId);
+    if (entry == NULL)
+        return 0;
+
+    SpinLock::Guard _(entry->stats.lock);
+    double keyHashCount = entry->stats.totalOwnership
+            ? 18446744073709551616.0 : double(entry->stats.keyHashCount);
+    if (keyHashCount == 0)
+        return 0;
+    double keyRange = double(endKeyHash - startKeyHash) + 1;
+    double fraction = std::min(1.0, keyRange / keyHashCount);
+    return uint64_t(double(entry->stats.byteCount) * fraction);
+}
+
 
 /**
  * Compress and serialize all table stats information in the MasterTableMetadata
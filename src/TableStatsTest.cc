@@ -175,6 +175,21 @@ TEST_F(TableStatsTest, decrement) {
     }
 }
 
+TEST_F(TableStatsTest, estimateByteCount) {
+    EXPECT_EQ(0u, TableStats::estimateByteCount(&mtm, 1, 0, 9));
+
+    TableStats::addKeyHashRange(&mtm, 1, 0, 9);
+    TableStats::increment(&mtm, 1, 1000, 10);
+    EXPECT_EQ(1000u, TableStats::estimateByteCount(&mtm, 1, 0, 9));
+    EXPECT_EQ(500u, TableStats::estimateByteCount(&mtm, 1, 0, 4));
+    EXPECT_EQ(100u, TableStats::estimateByteCount(&mtm, 1, 7, 7));
+
+    TableStats::addKeyHashRange(&mtm, 2, 0, ~0UL);
+    TableStats::increment(&mtm, 2, 1000, 10);
+    EXPECT_EQ(1000u, TableStats::estimateByteCount(&mtm, 2, 0, ~0UL));
+    EXPECT_EQ(500u, TableStats::estimateByteCount(&mtm, 2, 0, ~0UL / 2));
+}
+
 TEST_F(TableStatsTest, serialize_basic) {
     // First Check an empty mtm.
     {
@@ -0,0 +1,372 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include <memory>
+
+#include "TabletBalancer.h"
+#include "CoordinatorServerList.h"
+#include "Cycles.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a TabletBalancer. The balancer does nothing until
+ * startBalancing is invoked.
+ *
+ * \param context
+ *      Overall information about the RAMCloud coordinator.
+ * \param tableManager
+ *      The coordinator's table manager, used to split tablets.
+ */
+TabletBalancer::TabletBalancer(Context* context, TableManager* tableManager)
+    : WorkerTimer(context->dispatch)
+    , intervalSeconds(0)
+    , maxConcurrentMigrations(1)
+    , highWaterMark(1.25)
+    , lowWaterMark(0.9)
+    , overloadedRounds(3)
+    , cooldownRounds(10)
+    , minOpsPerSecond(1000)
+    , maxMigrationBytes(1024lu*1024*1024)
+    , context(context)
+    , tableManager(tableManager)
+    , round(0)
+    , samples()
+    , overloadedCounts()
+    , recentlyMoved()
+    , migrations()
+{
+}
+
+/**
+ * Destructor for TabletBalancer. Migrations that are still in progress
+ * continue on the masters; we just stop waiting for them.
+ */
+TabletBalancer::~TabletBalancer()
+{
+    stop();
+}
+
+/**
+ * Invoked by the WorkerTimer mechanism once every #intervalSeconds; runs
+ * one round of balancing and reschedules the timer.
+ */
+void
+TabletBalancer::handleTimerEvent()
+{
+    uint64_t startTime = Cycles::rdtsc();
+    try {
+        balance();
+    } catch (const std::exception& e) {
+        // Most likely a master crashed or a tablet is being recovered;
+        // things should look different next round.
+        LOG(WARNING, "Tablet balancing round failed: %s", e.what());
+    }
+    if (intervalSeconds > 0)
+        start(startTime + Cycles::fromSeconds(intervalSeconds));
+}
+
+/**
+ * Start (or stop) periodic balancing.
+ *
+ * \param intervalSeconds
+ *      Seconds between balancing rounds; 0 stops the balancer.
+ * \param maxConcurrentMigrations
+ *      Limit on the number of tablet migrations outstanding at once.
+ */
+void
+TabletBalancer::startBalancing(double intervalSeconds,
+        uint32_t maxConcurrentMigrations)
+{
+    this->intervalSeconds = intervalSeconds;
+    this->maxConcurrentMigrations = maxConcurrentMigrations;
+    if (intervalSeconds > 0) {
+        LOG(NOTICE, "Balancing tablet load every %.1f seconds, with at most "
+                "%u concurrent migrations", intervalSeconds,
+                maxConcurrentMigrations);
+        start(Cycles::rdtsc() + Cycles::fromSeconds(intervalSeconds));
+    } else {
+        stop();
+    }
+}
+
+/**
+ * Run one round of balancing: learn how loaded each master is, then split
+ * or migrate at most one tablet.
+ */
+void
+TabletBalancer::balance()
+{
+    round++;
+    reapMigrations();
+    for (auto it = recentlyMoved.begin(); it != recentlyMoved.end(); ) {
+        if (round - it->second >= cooldownRounds)
+            it = recentlyMoved.erase(it);
+        else
+            ++it;
+    }
+
+    vector<ServerId> masters;
+    vector<TabletLoad> loads;
+    collectLoads(&masters, &loads);
+    Action action = chooseAction(masters, loads);
+    if (action.type == Action::SPLIT) {
+        LOG(NOTICE, "Splitting hot tablet [0x%lx,0x%lx] in tableId %lu on "
+                "%s at 0x%lx", action.tablet.startKeyHash,
+                action.tablet.endKeyHash, action.tablet.tableId,
+                action.source.toString().c_str(), action.splitKeyHash);
+        tableManager->splitTablet(action.tablet.tableId, action.splitKeyHash);
+    } else if (action.type == Action::MIGRATE) {
+        startMigration(action);
+    }
+}
+
+/**
+ * Decide what, if anything, to do about the load measured in this round.
+ * This also advances the per-master overload counts that provide
+ * hysteresis, so it must be called exactly once per round.
+ *
+ * \param masters
+ *      All of the masters that reported statistics in this round.
+ * \param loads
+ *      The load on each tablet of those masters.
+ * \return
+ *      The tablet to split or migrate, if any.
+ */
+TabletBalancer::Action
+TabletBalancer::chooseAction(const vector<ServerId>& masters,
+        const vector<TabletLoad>& loads)
+{
+    Action action;
+    std::unordered_map<uint64_t, double> masterLoads;
+    double totalLoad = 0;
+    foreach (const ServerId& master, masters)
+        masterLoads[master.getId()] = 0;
+    foreach (const TabletLoad& load, loads) {
+        if (load.opsPerSecond > 0) {
+            masterLoads[load.master.getId()] += load.opsPerSecond;
+            totalLoad += load.opsPerSecond;
+        }
+    }
+    if (masters.size() < 2 || totalLoad < minOpsPerSecond) {
+        overloadedCounts.clear();
+        return action;
+    }
+    double meanLoad = totalLoad / static_cast<double>(masters.size());
+
+    // Masters already sending or receiving a tablet are left alone until
+    // that finishes; their load is about to change anyway.
+    std::unordered_map<uint64_t, bool> busy;
+    foreach (const Migration& migration, migrations) {
+        busy[migration.source.getId()] = true;
+        busy[migration.target.getId()] = true;
+    }
+
+    ServerId source;
+    double sourceLoad = 0;
+    ServerId target;
+    double targetLoad = 0;
+    foreach (const ServerId& master, masters) {
+        double load = masterLoads[master.getId()];
+        uint32_t& count = overloadedCounts[master.getId()];
+        count = (load > meanLoad * highWaterMark) ? count + 1 : 0;
+        if (busy.find(master.getId()) != busy.end())
+            continue;
+        if (count >= overloadedRounds && load > sourceLoad) {
+            source = master;
+            sourceLoad = load;
+        }
+        if (load < meanLoad * lowWaterMark &&
+                (!target.isValid() || load < targetLoad)) {
+            target = master;
+            targetLoad = load;
+        }
+    }
+    if (!source.isValid() || !target.isValid() ||
+            migrations.size() >= maxConcurrentMigrations)
+        return action;
+
+    // Move the hottest tablet that fits in half the gap between the two
+    // masters, so that the source doesn't end up less loaded than the
+    // target (which would just move the problem). If none fits, the
+    // hottest tablet is too hot to move whole: split it instead.
+    double gap = (sourceLoad - targetLoad) / 2;
+    const TabletLoad* best = NULL;
+    const TabletLoad* hottest = NULL;
+    foreach (const TabletLoad& load, loads) {
+        if (load.master != source || !load.movable || load.opsPerSecond <= 0
+                || recentlyMoved.find(load.tablet) != recentlyMoved.end())
+            continue;
+        if (hottest == NULL || load.opsPerSecond > hottest->opsPerSecond)
+            hottest = &load;
+        if (load.opsPerSecond > gap || load.byteCount > maxMigrationBytes)
+            continue;
+        if (best == NULL || load.opsPerSecond > best->opsPerSecond ||
+                (load.opsPerSecond == best->opsPerSecond &&
+                 load.byteCount < best->byteCount))
+            best = &load;
+    }
+
+    if (best != NULL) {
+        action.type = Action::MIGRATE;
+        action.tablet = best->tablet;
+        action.target = target;
+    } else if (hottest != NULL &&
+            hottest->tablet.startKeyHash < hottest->tablet.endKeyHash) {
+        action.type = Action::SPLIT;
+        action.tablet = hottest->tablet;
+        action.splitKeyHash = hottest->tablet.startKeyHash +
+                (hottest->tablet.endKeyHash - hottest->tablet.startKeyHash)
+                / 2 + 1;
+    } else {
+        return action;
+    }
+    action.source = source;
+
+    // The source must prove itself overloaded all over again before we
+    // take anything else from it.
+    overloadedCounts[source.getId()] = 0;
+    return action;
+}
+
+/**
+ * Ask every master for its tablet statistics and compute the load on each
+ * tablet since the previous round.
+ *
+ * \param[out] masters
+ *      Filled in with the ids of the masters that responded.
+ * \param[out] loads
+ *      Filled in with the load on each tablet of those masters.
+ */
+void
+TabletBalancer::collectLoads(vector<ServerId>* masters,
+        vector<TabletLoad>* loads)
+{
+    vector<ServerId> candidates;
+    ServerId id;
+    while (true) {
+        bool end;
+        id = context->coordinatorServerList->nextServer(id,
+                ServiceMask({WireFormat::MASTER_SERVICE}), &end);
+        if (end || !id.isValid())
+            break;
+        candidates.push_back(id);
+    }
+
+    // Issue all of the RPCs before waiting for any, so a round takes
+    // about as long as the slowest master rather than the sum of them.
+    size_t numCandidates = candidates.size();
+    std::unique_ptr<Tub<GetMasterStatisticsRpc>[]> rpcs(
+            new Tub<GetMasterStatisticsRpc>[numCandidates]);
+    for (size_t i = 0; i < numCandidates; i++)
+        rpcs[i].construct(context, candidates[i]);
+
+    std::map<TabletKey, Sample> newSamples;
+    for (size_t i = 0; i < numCandidates; i++) {
+        ProtoBuf::ServerStatistics stats;
+        try {
+            rpcs[i]->wait(&stats);
+        } catch (const ServerNotUpException& e) {
+            continue;
+        }
+        uint64_t now = Cycles::rdtsc();
+        masters->push_back(candidates[i]);
+        foreach (const ProtoBuf::ServerStatistics::TabletEntry& entry,
+                stats.tabletentry()) {
+            TabletLoad load;
+            load.tablet = {entry.table_id(), entry.start_key_hash(),
+                    entry.end_key_hash()};
+            load.master = candidates[i];
+            load.byteCount = entry.byte_count();
+            load.movable = !tableManager->isIndexletTable(entry.table_id());
+
+            auto previous = samples.find(load.tablet);
+            if (previous != samples.end() &&
+                    previous->second.master == candidates[i] &&
+                    previous->second.readCount <= entry.read_count() &&
+                    previous->second.writeCount <= entry.write_count()) {
+                double seconds = Cycles::toSeconds(
+                        now - previous->second.cycles);
+                uint64_t ops = entry.read_count() + entry.write_count() -
+                        previous->second.readCount -
+                        previous->second.writeCount;
+                if (seconds > 0)
+                    load.opsPerSecond = static_cast<double>(ops) / seconds;
+            }
+            loads->push_back(load);
+            newSamples.emplace(load.tablet, Sample(candidates[i],
+                    entry.read_count(), entry.write_count(), now));
+        }
+    }
+    samples.swap(newSamples);
+}
+
+/**
+ * Clean up after migrations that have finished, successfully or not.
+ */
+void
+TabletBalancer::reapMigrations()
+{
+    for (auto it = migrations.begin(); it != migrations.end(); ) {
+        if (!it->rpc->isReady()) {
+            ++it;
+            continue;
+        }
+        try {
+            it->rpc->wait();
+            LOG(NOTICE, "Finished migrating tablet [0x%lx,0x%lx] in tableId "
+                    "%lu from %s to %s", it->tablet.startKeyHash,
+                    it->tablet.endKeyHash, it->tablet.tableId,
+                    it->source.toString().c_str(),
+                    it->target.toString().c_str());
+        } catch (const ClientException& e) {
+            LOG(WARNING, "Migration of tablet [0x%lx,0x%lx] in tableId %lu "
+                    "from %s to %s failed: %s", it->tablet.startKeyHash,
+                    it->tablet.endKeyHash, it->tablet.tableId,
+                    it->source.toString().c_str(),
+                    it->target.toString().c_str(), e.toSymbol());
+        }
+        it = migrations.erase(it);
+    }
+}
+
+/**
+ * Ask a master to migrate one of its tablets; the migration is reaped by
+ * reapMigrations in a later round.
+ *
+ * \param action
+ *      Describes the tablet to move and where to move it.
+ */
+void
+TabletBalancer::startMigration(const Action& action)
+{
+    LOG(NOTICE, "Migrating tablet [0x%lx,0x%lx] in tableId %lu from %s "
+            "to %s to balance load", action.tablet.startKeyHash,
+            action.tablet.endKeyHash, action.tablet.tableId,
+            action.source.toString().c_str(),
+            action.target.toString().c_str());
+    migrations.emplace_back();
+    Migration& migration = migrations.back();
+    migration.tablet = action.tablet;
+    migration.source = action.source;
+    migration.target = action.target;
+    migration.rpc.construct(context, action.source, action.tablet.tableId,
+            action.tablet.startKeyHash, action.tablet.endKeyHash,
+            action.target);
+    recentlyMoved[action.tablet] = round;
+}
+
+} // namespace RAMCloud
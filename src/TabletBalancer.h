@@ -0,0 +1,220 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#ifndef RAMCLOUD_TABLETBALANCER_H
+#define RAMCLOUD_TABLETBALANCER_H
+
+#include <list>
+#include <map>
+#include <unordered_map>
+
+#include "Common.h"
+#include "Context.h"
+#include "MasterClient.h"
+#include "ServerId.h"
+#include "TableManager.h"
+#include "Tub.h"
+#include "WorkerTimer.h"
+
+namespace RAMCloud {
+
+/**
+ * The TabletBalancer runs on the coordinator and moves load between masters
+ * while the cluster is running. Every few seconds it asks each master for
+ * the read and write counts and sizes of its tablets (GET_SERVER_STATISTICS),
+ * turns the counts into rates, and, if one master has been carrying much
+ * more than its share of the load for several rounds in a row, either
+ * migrates one of its tablets to the least loaded master or, if no single
+ * tablet can be moved without simply shifting the hot spot, splits the
+ * hottest tablet in half by key hash so that the pieces can be moved in
+ * later rounds.
+ *
+ * To keep the cluster from thrashing, a master must stay above the high
+ * water mark for #overloadedRounds consecutive rounds before anything is
+ * taken from it, only masters below the low water mark receive tablets,
+ * a tablet that was just moved stays put for #cooldownRounds, and at most
+ * #maxConcurrentMigrations migrations are outstanding at once.
+ *
+ * Tablets of indexlet backing tables are never touched, since their
+ * placement is tied to the indexlets they hold.
+ */
+class TabletBalancer : public WorkerTimer {
+  PUBLIC:
+    TabletBalancer(Context* context, TableManager* tableManager);
+    ~TabletBalancer();
+    virtual void handleTimerEvent();
+    void startBalancing(double intervalSeconds,
+            uint32_t maxConcurrentMigrations);
+
+    /// Seconds between balancing rounds. 0 means the balancer is off.
+    double intervalSeconds;
+
+    /// Limit on the number of migrations outstanding at once.
+    uint32_t maxConcurrentMigrations;
+
+    /// A master is overloaded when its load exceeds the mean load across
+    /// masters by this factor.
+    double highWaterMark;
+
+    /// Only masters whose load is below the mean by this factor receive
+    /// tablets.
+    double lowWaterMark;
+
+    /// Number of consecutive rounds a master must be overloaded before the
+    /// balancer takes a tablet from it.
+    uint32_t overloadedRounds;
+
+    /// Number of rounds after a migration during which the migrated tablet
+    /// won't be moved again.
+    uint32_t cooldownRounds;
+
+    /// Clusters handling fewer operations per second than this in total
+    /// are left alone: there is nothing worth balancing.
+    double minOpsPerSecond;
+
+    /// Tablets holding more than this many bytes are split rather than
+    /// migrated whole, to bound the length of each migration.
+    uint64_t maxMigrationBytes;
+
+  PRIVATE:
+    /**
+     * Identifies one tablet on one master.
+     */
+    struct TabletKey {
+        uint64_t tableId;
+        uint64_t startKeyHash;
+        uint64_t endKeyHash;
+
+        bool
+        operator<(const TabletKey& other) const
+        {
+            if (tableId != other.tableId)
+                return tableId < other.tableId;
+            if (startKeyHash != other.startKeyHash)
+                return startKeyHash < other.startKeyHash;
+            return endKeyHash < other.endKeyHash;
+        }
+    };
+
+    /**
+     * The access counts reported for a tablet in the previous round, used
+     * to turn the masters' cumulative counters into rates.
+     */
+    struct Sample {
+        ServerId master;
+        uint64_t readCount;
+        uint64_t writeCount;
+        uint64_t cycles;
+
+        Sample(ServerId master, uint64_t readCount, uint64_t writeCount,
+                uint64_t cycles)
+            : master(master), readCount(readCount), writeCount(writeCount)
+            , cycles(cycles)
+        {}
+    };
+
+    /**
+     * The load on one tablet, as measured in the current round.
+     */
+    struct TabletLoad {
+        TabletKey tablet;
+        ServerId master;
+
+        /// Reads and writes per second since the previous round; -1 if
+        /// this is the first round the tablet has been seen in (so its
+        /// rate is not known yet).
+        double opsPerSecond;
+
+        /// Estimated bytes of log data belonging to the tablet.
+        uint64_t byteCount;
+
+        /// False means the tablet must stay where it is (it backs an
+        /// indexlet); it still counts toward its master's load.
+        bool movable;
+
+        TabletLoad()
+            : tablet(), master(), opsPerSecond(-1), byteCount(0)
+            , movable(true)
+        {}
+    };
+
+    /**
+     * What one round of balancing decided to do.
+     */
+    struct Action {
+        enum Type { NONE, MIGRATE, SPLIT };
+        Type type;
+        TabletKey tablet;
+        ServerId source;
+
+        /// For MIGRATE, the master that receives the tablet; for SPLIT, the
+        /// first key hash of the upper half.
+        ServerId target;
+        uint64_t splitKeyHash;
+
+        Action()
+            : type(NONE), tablet(), source(), target(), splitKeyHash(0)
+        {}
+    };
+
+    /**
+     * A migration that has been requested but hasn't finished yet.
+     */
+    struct Migration {
+        TabletKey tablet;
+        ServerId source;
+        ServerId target;
+        Tub<MasterMigrateTabletRpc> rpc;
+
+        Migration()
+            : tablet(), source(), target(), rpc()
+        {}
+    };
+
+    void balance();
+    Action chooseAction(const vector<ServerId>& masters,
+            const vector<TabletLoad>& loads);
+    void collectLoads(vector<ServerId>* masters, vector<TabletLoad>* loads);
+    void reapMigrations();
+    void startMigration(const Action& action);
+
+    /// Shared information about the coordinator.
+    Context* context;
+
+    /// Used to split tablets and to recognize indexlet backing tables.
+    TableManager* tableManager;
+
+    /// Number of balancing rounds run so far.
+    uint64_t round;
+
+    /// The counters reported for each tablet in the previous round.
+    std::map<TabletKey, Sample> samples;
+
+    /// For each master (by ServerId::getId()), the number of consecutive
+    /// rounds it has been overloaded.
+    std::unordered_map<uint64_t, uint32_t> overloadedCounts;
+
+    /// For each recently migrated tablet, the round in which it moved.
+    std::map<TabletKey, uint64_t> recentlyMoved;
+
+    /// Migrations that haven't finished yet.
+    std::list<Migration> migrations;
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancer);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_TABLETBALANCER_H
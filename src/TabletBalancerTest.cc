@@ -0,0 +1,234 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "TestUtil.h"
+#include "MockCluster.h"
+#include "RamCloud.h"
+#include "TabletBalancer.h"
+
+namespace RAMCloud {
+
+class TabletBalancerTest : public ::testing::Test {
+  public:
+    TestLog::Enable logEnabler;
+    Context context;
+    MockCluster cluster;
+    TableManager* tableManager;
+    TabletBalancer* balancer;
+    ServerConfig masterConfig;
+    ServerId master1;
+    ServerId master2;
+    ServerId master3;
+    Tub<RamCloud> ramcloud;
+
+    TabletBalancerTest()
+        : logEnabler()
+        , context()
+        , cluster(&context)
+        , tableManager(&cluster.coordinator->tableManager)
+        , balancer(&cluster.coordinator->tabletBalancer)
+        , masterConfig(ServerConfig::forTesting())
+        , master1()
+        , master2()
+        , master3()
+        , ramcloud()
+    {
+        Logger::get().setLogLevels(RAMCloud::SILENT_LOG_LEVEL);
+        masterConfig.services = {WireFormat::MASTER_SERVICE,
+                                 WireFormat::ADMIN_SERVICE};
+        masterConfig.localLocator = "mock:host=master1";
+        master1 = cluster.addServer(masterConfig)->serverId;
+        masterConfig.localLocator = "mock:host=master2";
+        master2 = cluster.addServer(masterConfig)->serverId;
+        masterConfig.localLocator = "mock:host=master3";
+        master3 = cluster.addServer(masterConfig)->serverId;
+        ramcloud.construct(&context, "mock:host=coordinator");
+    }
+
+    TabletBalancer::TabletLoad
+    load(ServerId master, uint64_t startKeyHash, uint64_t endKeyHash,
+            double opsPerSecond, uint64_t byteCount = 0)
+    {
+        TabletBalancer::TabletLoad result;
+        result.tablet = {1, startKeyHash, endKeyHash};
+        result.master = master;
+        result.opsPerSecond = opsPerSecond;
+        result.byteCount = byteCount;
+        result.movable = true;
+        return result;
+    }
+
+    // Returns a key in table 1 whose hash falls within the given range.
+    string
+    keyInRange(uint64_t startKeyHash, uint64_t endKeyHash)
+    {
+        for (int i = 0; ; i++) {
+            string key = format("key%d", i);
+            KeyHash hash = Key::getHash(1, key.c_str(),
+                    downCast<uint16_t>(key.length()));
+            if (hash >= startKeyHash && hash <= endKeyHash)
+                return key;
+        }
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TabletBalancerTest);
+};
+
+TEST_F(TabletBalancerTest, chooseAction_idle) {
+    vector<ServerId> masters = {master1, master2, master3};
+    vector<TabletBalancer::TabletLoad> loads = {
+        load(master1, 0, 10, 900), load(master2, 11, 20, -1)};
+    balancer->overloadedCounts[master1.getId()] = 5;
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+    EXPECT_EQ(0U, balancer->overloadedCounts.size());
+}
+
+TEST_F(TabletBalancerTest, chooseAction_migrate) {
+    vector<ServerId> masters = {master1, master2, master3};
+    vector<TabletBalancer::TabletLoad> loads = {
+        load(master1, 0, 10, 2500), load(master1, 11, 20, 1000, 100),
+        load(master1, 21, 30, 1000, 50), load(master2, 31, 40, 500)};
+
+    // The overloaded master must stay that way for several rounds.
+    balancer->overloadedRounds = 2;
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+    EXPECT_EQ(1U, balancer->overloadedCounts[master1.getId()]);
+    EXPECT_EQ(0U, balancer->overloadedCounts[master2.getId()]);
+
+    // The hottest tablet that fits within half the gap wins; ties go to
+    // the smaller tablet. The least loaded master gets it.
+    TabletBalancer::Action action = balancer->chooseAction(masters, loads);
+    EXPECT_EQ(TabletBalancer::Action::MIGRATE, action.type);
+    EXPECT_EQ(21U, action.tablet.startKeyHash);
+    EXPECT_EQ(master1, action.source);
+    EXPECT_EQ(master3, action.target);
+    EXPECT_EQ(0U, balancer->overloadedCounts[master1.getId()]);
+
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+}
+
+TEST_F(TabletBalancerTest, chooseAction_split) {
+    vector<ServerId> masters = {master1, master2, master3};
+    vector<TabletBalancer::TabletLoad> loads = {
+        load(master1, 0, 99, 3000), load(master1, 100, 100, 0)};
+    balancer->overloadedRounds = 1;
+    TabletBalancer::Action action = balancer->chooseAction(masters, loads);
+    EXPECT_EQ(TabletBalancer::Action::SPLIT, action.type);
+    EXPECT_EQ(0U, action.tablet.startKeyHash);
+    EXPECT_EQ(50U, action.splitKeyHash);
+
+    // A single key hash can't be split any further.
+    loads = {load(master1, 5, 5, 3000)};
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+
+    // Tablets too large to move are split even if they would fit.
+    balancer->maxMigrationBytes = 10;
+    loads = {load(master1, 0, 99, 1000, 20), load(master1, 100, 199, 1000,
+            20)};
+    action = balancer->chooseAction(masters, loads);
+    EXPECT_EQ(TabletBalancer::Action::SPLIT, action.type);
+}
+
+TEST_F(TabletBalancerTest, chooseAction_ineligible) {
+    vector<ServerId> masters = {master1, master2, master3};
+    vector<TabletBalancer::TabletLoad> loads = {
+        load(master1, 0, 10, 1500), load(master1, 11, 20, 1500)};
+    loads[1].movable = false;
+    balancer->overloadedRounds = 1;
+    balancer->recentlyMoved[loads[0].tablet] = 0;
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+
+    // Too many migrations outstanding already.
+    balancer->recentlyMoved.clear();
+    balancer->maxConcurrentMigrations = 1;
+    balancer->migrations.emplace_back();
+    balancer->migrations.back().source = ServerId(10, 0);
+    balancer->migrations.back().target = ServerId(11, 0);
+    EXPECT_EQ(TabletBalancer::Action::NONE,
+            balancer->chooseAction(masters, loads).type);
+    balancer->maxConcurrentMigrations = 2;
+    TabletBalancer::Action action = balancer->chooseAction(masters, loads);
+    EXPECT_EQ(TabletBalancer::Action::MIGRATE, action.type);
+    EXPECT_EQ(0U, action.tablet.startKeyHash);
+    balancer->migrations.clear();
+}
+
+TEST_F(TabletBalancerTest, collectLoads) {
+    ramcloud->createTable("foo", 1);
+    string key = keyInRange(0, ~0UL);
+    ramcloud->write(1, key.c_str(), downCast<uint16_t>(key.length()),
+            "abcdef", 6);
+
+    vector<ServerId> masters;
+    vector<TabletBalancer::TabletLoad> loads;
+    balancer->collectLoads(&masters, &loads);
+    EXPECT_EQ(3U, masters.size());
+    ASSERT_EQ(1U, loads.size());
+    EXPECT_EQ(master1, loads[0].master);
+    EXPECT_EQ(-1, loads[0].opsPerSecond);
+    EXPECT_LT(0U, loads[0].byteCount);
+    EXPECT_TRUE(loads[0].movable);
+
+    Buffer value;
+    ramcloud->read(1, key.c_str(), downCast<uint16_t>(key.length()), &value);
+    masters.clear();
+    loads.clear();
+    balancer->collectLoads(&masters, &loads);
+    ASSERT_EQ(1U, loads.size());
+    EXPECT_LT(0, loads[0].opsPerSecond);
+}
+
+TEST_F(TabletBalancerTest, balance) {
+    ramcloud->createTable("foo", 1);
+    ramcloud->splitTablet("foo", 0x8000000000000000);
+    string low = keyInRange(0, 0x7fffffffffffffff);
+    string high = keyInRange(0x8000000000000000, ~0UL);
+    ramcloud->write(1, low.c_str(), downCast<uint16_t>(low.length()), "a", 1);
+    ramcloud->write(1, high.c_str(), downCast<uint16_t>(high.length()),
+            "b", 1);
+    balancer->overloadedRounds = 1;
+    balancer->minOpsPerSecond = 0;
+    balancer->balance();
+
+    // The low tablet is read twice as often as the high one, so it's too
+    // hot to move whole; the high one is moved instead.
+    TestLog::Enable _("startMigration", "reapMigrations", NULL);
+    Buffer value;
+    ramcloud->read(1, low.c_str(), downCast<uint16_t>(low.length()), &value);
+    ramcloud->read(1, low.c_str(), downCast<uint16_t>(low.length()), &value);
+    ramcloud->read(1, high.c_str(), downCast<uint16_t>(high.length()),
+            &value);
+    balancer->balance();
+    EXPECT_EQ("startMigration: Migrating tablet "
+            "[0x8000000000000000,0xffffffffffffffff] in tableId 1 from "
+            "1.0 to 2.0 to balance load", TestLog::get());
+    EXPECT_EQ("{ foo(id 1): { 0x0-0x7fffffffffffffff on 1.0 } "
+            "{ 0x8000000000000000-0xffffffffffffffff on 2.0 } }",
+            tableManager->debugString(true));
+
+    TestLog::reset();
+    balancer->balance();
+    EXPECT_EQ("reapMigrations: Finished migrating tablet "
+            "[0x8000000000000000,0xffffffffffffffff] in tableId 1 from "
+            "1.0 to 2.0", TestLog::get());
+    EXPECT_EQ(0U, balancer->migrations.size());
+}
+
+}  // namespace RAMCloud
@@ -24,6 +24,12 @@ namespace RAMCloud {
 TabletManager::TabletManager()
     : tabletMap()
     , lock("TabletManager::lock")
+    , readCounters()
+    , flatTabletsVersion(0)
+    , flatTablets(NULL)
+    , numFlatTablets(0)
+    , flatTabletsCapacity(0)
+    , flatTabletArrays()
     , numLoadingTablets(0)
 {
 }
@@ -59,8 +65,10 @@ TabletManager::addTablet(uint64_t tableId,
         return false;
     }
 
-    tabletMap.insert(std::make_pair(tableId,
-                     Tablet(tableId, startKeyHash, endKeyHash, state)));
+    Tablet tablet(tableId, startKeyHash, endKeyHash, state);
+    newReadCounter(guard, &tablet);
+    tabletMap.insert(std::make_pair(tableId, tablet));
+    rebuildFlatTablets(guard);
 
     if (state == TabletState::NOT_READY) {
         numLoadingTablets++;
@@ -73,31 +81,47 @@ TabletManager::addTablet(uint64_t tableId,
  * Given a key, determine whether a tablet exists for this key and has status
  * NORMAL.  We simultaneously increments the read count on the tablet. This is
  * called by ObjectManger::readObject to avoid looking up the Tablet twice, for
- * verification of state and incrementing the read count.
+ * verification of state and incrementing the read count. Unless the tablets
+ * are being changed concurrently, this doesn't take the monitor lock.
  *
  * \param key
  *      The Key whose tablet we're looking up.
  * \return
  *      True if a tablet was found, otherwise false.
+ * \throw RetryException
+ *      The tablet is locked for migration.
  */
 bool
 TabletManager::checkAndIncrementReadCount(Key& key) {
-    SpinLock::Guard guard(lock);
-    TabletMap::iterator it = lookup(key.getTableId(), key.getHash(), guard);
-
-    if (it == tabletMap.end())
-        return false;
-    if (it->second.state != NORMAL) {
-        if (it->second.state == TabletManager::LOCKED_FOR_MIGRATION)
-            throw RetryException(HERE, 1000, 2000,
-                    "Tablet is currently locked for migration!");
+    FlatTablet tablet;
+    if (!lookupForRead(key.getTableId(), key.getHash(), &tablet) ||
+            !isReadable(tablet)) {
         return false;
     }
-
-    it->second.readCount++;
+    tablet.readCounter->fetch_add(1, std::memory_order_relaxed);
     return true;
 }
 
+/**
+ * Same as checkAndIncrementReadCount(), except that the read isn't counted.
+ * Used by readers that must check the tablet again after having counted
+ * the read once already.
+ *
+ * \param key
+ *      The Key whose tablet we're looking up.
+ * \return
+ *      True if a tablet was found, otherwise false.
+ * \throw RetryException
+ *      The tablet is locked for migration.
+ */
+bool
+TabletManager::checkReadable(Key& key)
+{
+    FlatTablet tablet;
+    return lookupForRead(key.getTableId(), key.getHash(), &tablet) &&
+            isReadable(tablet);
+}
+
 /**
  * Given a key, obtain the data of the tablet associated with that key, if one
  * exists. Note that the data returned is a snapshot. The TabletManager's data
@@ -144,7 +168,7 @@ TabletManager::getTablet(uint64_t tableId, uint64_t keyHash, Tablet* outTablet)
         return false;
 
     if (outTablet != NULL)
-        *outTablet = it->second;
+        copyTablet(it->second, outTablet);
     return true;
 }
 
@@ -184,7 +208,7 @@ TabletManager::getTablet(uint64_t tableId,
         return false;
 
     if (outTablet != NULL)
-        *outTablet = *t;
+        copyTablet(*t, outTablet);
     return true;
 }
 
@@ -202,7 +226,8 @@ TabletManager::getTablets(vector<Tablet>* outTablets)
 
     TabletMap::iterator it = tabletMap.begin();
     for (size_t i = 0; it != tabletMap.end(); i++) {
-        outTablets->push_back(it->second);
+        outTablets->emplace_back();
+        copyTablet(it->second, &outTablets->back());
         ++it;
     }
 }
@@ -248,9 +273,11 @@ TabletManager::deleteTablet(uint64_t tableId,
         throw InternalError(HERE, STATUS_INTERNAL_ERROR);
     }
 
+    TabletState state = t->state;
     tabletMap.erase(it);
+    rebuildFlatTablets(guard);
 
-    if (t->state == TabletState::NOT_READY) {
+    if (state == TabletState::NOT_READY) {
         numLoadingTablets--;
     }
 
@@ -291,14 +318,17 @@ TabletManager::splitTablet(uint64_t tableId,
     // So to make it idempotent, check for this condition before you
     // decide to do the split
     if (splitKeyHash != t->startKeyHash) {
-        tabletMap.insert(std::make_pair(tableId, Tablet
-                         (tableId, splitKeyHash, t->endKeyHash, t->state)));
+        Tablet tablet(tableId, splitKeyHash, t->endKeyHash, t->state);
+        newReadCounter(guard, &tablet);
+        tabletMap.insert(std::make_pair(tableId, tablet));
         t->endKeyHash = splitKeyHash - 1;
 
         // It's unclear what to do with the counts when splitting. The old
         // behavior was to simply zero them, so for the time being we'll
         // stick with that. At the very least it's what Christian expects.
-        t->readCount = t->writeCount = 0;
+        t->readCounter->store(0, std::memory_order_relaxed);
+        t->writeCount = 0;
+        rebuildFlatTablets(guard);
 
         if (t->state == TabletState::NOT_READY) {
             numLoadingTablets++;
@@ -350,6 +380,7 @@ TabletManager::changeState(uint64_t tableId,
         return false;
 
     t->state = newState;
+    rebuildFlatTablets(guard);
 
     assert(oldState != newState);
     if (newState == TabletState::NOT_READY) {
@@ -378,10 +409,9 @@ TabletManager::incrementReadCount(Key& key)
 void
 TabletManager::incrementReadCount(uint64_t tableId, KeyHash keyHash)
 {
-    SpinLock::Guard guard(lock);
-    TabletMap::iterator it = lookup(tableId, keyHash, guard);
-    if (it != tabletMap.end())
-        it->second.readCount++;
+    FlatTablet tablet;
+    if (lookupForRead(tableId, keyHash, &tablet))
+        tablet.readCounter->fetch_add(1, std::memory_order_relaxed);
 }
 
 /**
@@ -424,9 +454,14 @@ TabletManager::getStatistics(ProtoBuf::ServerStatistics* serverStatistics)
         entry->set_table_id(t->tableId);
         entry->set_start_key_hash(t->startKeyHash);
         entry->set_end_key_hash(t->endKeyHash);
-        uint64_t totalOperations = t->readCount + t->writeCount;
+        uint64_t readCount = t->readCounter->load(std::memory_order_relaxed);
+        uint64_t totalOperations = readCount + t->writeCount;
         if (totalOperations > 0)
             entry->set_number_read_and_writes(totalOperations);
+        if (readCount > 0)
+            entry->set_read_count(readCount);
+        if (t->writeCount > 0)
+            entry->set_write_count(t->writeCount);
         ++it;
     }
 }
@@ -490,8 +525,10 @@ TabletManager::toString()
     TabletMap::iterator it;
     vector<Tablet> tablets;
 
-    for (it = tabletMap.begin(); it != tabletMap.end(); ++it)
-        tablets.push_back(it->second);
+    for (it = tabletMap.begin(); it != tabletMap.end(); ++it) {
+        tablets.emplace_back();
+        copyTablet(it->second, &tablets.back());
+    }
     sort(tablets.begin(), tablets.end(), compareTablet);
 
     for (size_t i = 0; i < tablets.size(); ++i)
@@ -499,7 +536,9 @@ TabletManager::toString()
 #else
     for (TabletMap::iterator it = tabletMap.begin();
             it != tabletMap.end(); ++it) {
-       printTablet(&(it->second), &output);
+       Tablet tablet;
+       copyTablet(it->second, &tablet);
+       printTablet(&tablet, &output);
     }
 #endif
 
@@ -539,6 +578,202 @@ TabletManager::lookup(uint64_t tableId, uint64_t keyHash,
     return tabletMap.end();
 }
 
+/**
+ * Find the tablet containing a key on behalf of checkAndIncrementReadCount()
+ * and its relatives: without taking the monitor lock if possible, otherwise
+ * with it.
+ *
+ * \param tableId
+ *      Identifier of the table to look up.
+ * \param keyHash
+ *      Key hash value corresponding to the desired tablet.
+ * \param[out] outTablet
+ *      Filled in with the tablet, if one was found.
+ * \return
+ *      True if a tablet was found, otherwise false.
+ */
+bool
+TabletManager::lookupForRead(uint64_t tableId, uint64_t keyHash,
+                             FlatTablet* outTablet)
+{
+    if (lookupLockFree(tableId, keyHash, outTablet))
+        return outTablet->readCounter != NULL;
+
+    SpinLock::Guard guard(lock);
+    TabletMap::iterator it = lookup(tableId, keyHash, guard);
+    if (it == tabletMap.end())
+        return false;
+    const Tablet& t = it->second;
+    *outTablet = {t.tableId, t.startKeyHash, t.endKeyHash, t.state,
+                  t.readCounter};
+    return true;
+}
+
+/**
+ * Find the tablet containing a key hash using only the flat array of
+ * tablets, without acquiring the monitor lock.
+ *
+ * \param tableId
+ *      Identifier of the table to look up.
+ * \param keyHash
+ *      Key hash value corresponding to the desired tablet.
+ * \param[out] outTablet
+ *      Filled in with the tablet, if one was found; otherwise its
+ *      readCounter is set to NULL.
+ * \return
+ *      False means the array is being rebuilt, so nothing was looked up;
+ *      the caller should take the slow path through tabletMap.
+ */
+bool
+TabletManager::lookupLockFree(uint64_t tableId, uint64_t keyHash,
+                              FlatTablet* outTablet)
+{
+    while (true) {
+        uint64_t version = flatTabletsVersion.load(std::memory_order_acquire);
+        if (version & 1) {
+            return false;
+        }
+        const FlatTablet* tablets =
+                flatTablets.load(std::memory_order_relaxed);
+        uint32_t count = numFlatTablets.load(std::memory_order_relaxed);
+
+        // Find the first tablet that starts after keyHash; the one before
+        // it is the only candidate.
+        const FlatTablet* first = tablets;
+        while (count > 0) {
+            uint32_t half = count / 2;
+            const FlatTablet* middle = first + half;
+            bool before = (middle->tableId < tableId) ||
+                    (middle->tableId == tableId &&
+                    middle->startKeyHash <= keyHash);
+            first = before ? middle + 1 : first;
+            count = before ? count - half - 1 : half;
+        }
+        outTablet->readCounter = NULL;
+        if (first != tablets) {
+            const FlatTablet* candidate = first - 1;
+            if (candidate->tableId == tableId &&
+                    keyHash <= candidate->endKeyHash) {
+                *outTablet = *candidate;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (flatTabletsVersion.load(std::memory_order_relaxed) == version) {
+            return true;
+        }
+    }
+}
+
+/**
+ * Copy a tablet from tabletMap for a caller, filling in its read count.
+ *
+ * \param tablet
+ *      The tablet in tabletMap to copy.
+ * \param[out] outTablet
+ *      Where to copy it.
+ */
+void
+TabletManager::copyTablet(const Tablet& tablet, Tablet* outTablet)
+{
+    *outTablet = tablet;
+    outTablet->readCount = tablet.readCounter->load(std::memory_order_relaxed);
+}
+
+/**
+ * Allocate a read counter for a tablet that is about to be added to
+ * tabletMap.
+ *
+ * \param lock
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ * \param tablet
+ *      The tablet; its readCounter is set.
+ */
+void
+TabletManager::newReadCounter(const SpinLock::Guard& lock, Tablet* tablet)
+{
+    readCounters.emplace_back(0);
+    tablet->readCounter = &readCounters.back();
+}
+
+/**
+ * Stop lock-free readers from using the flat array until the next call to
+ * rebuildFlatTablets finishes.
+ *
+ * \param lock
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ */
+void
+TabletManager::invalidateFlatTablets(const SpinLock::Guard& lock)
+{
+    uint64_t version = flatTabletsVersion.load(std::memory_order_relaxed);
+    if (version & 1) {
+        return;
+    }
+    flatTabletsVersion.store(version + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * Regenerate the flat array used by lookupLockFree from tabletMap. Must be
+ * invoked whenever a tablet is added, removed, or changed.
+ *
+ * \param lock
+ *      Ensures that the caller holds the monitor lock; not actually used.
+ */
+void
+TabletManager::rebuildFlatTablets(const SpinLock::Guard& lock)
+{
+    invalidateFlatTablets(lock);
+    uint64_t version = flatTabletsVersion.load(std::memory_order_relaxed);
+
+    uint32_t count = downCast<uint32_t>(tabletMap.size());
+    if (count > flatTabletsCapacity) {
+        flatTabletsCapacity = std::max(2 * flatTabletsCapacity, count);
+        flatTabletArrays.emplace_back(new FlatTablet[flatTabletsCapacity]);
+        flatTablets.store(flatTabletArrays.back().get(),
+                std::memory_order_relaxed);
+    }
+    FlatTablet* tablets = flatTablets.load(std::memory_order_relaxed);
+    uint32_t i = 0;
+    for (auto& entry : tabletMap) {
+        const Tablet& t = entry.second;
+        tablets[i] = {t.tableId, t.startKeyHash, t.endKeyHash, t.state,
+                      t.readCounter};
+        i++;
+    }
+    std::sort(tablets, tablets + count,
+            [](const FlatTablet& a, const FlatTablet& b) {
+                return (a.tableId < b.tableId) || (a.tableId == b.tableId &&
+                        a.startKeyHash < b.startKeyHash);
+            });
+    numFlatTablets.store(count, std::memory_order_relaxed);
+
+    flatTabletsVersion.store(version + 1, std::memory_order_release);
+}
+
+/**
+ * Decide whether objects in a tablet may be read.
+ *
+ * \param tablet
+ *      The tablet containing the objects.
+ * \return
+ *      True if the tablet is NORMAL, false if it isn't ready.
+ * \throw RetryException
+ *      The tablet is locked for migration; the read should be retried
+ *      once migration has finished.
+ */
+bool
+TabletManager::isReadable(const FlatTablet& tablet)
+{
+    if (tablet.state == NORMAL)
+        return true;
+    if (tablet.state == LOCKED_FOR_MIGRATION)
+        throw RetryException(HERE, 1000, 2000,
+                "Tablet is currently locked for migration!");
+    return false;
+}
+
 /**
  * Construct to freeze the state of tabletManager from outside.
  *
@@ -589,7 +824,7 @@ TabletManager::Protector::getTablet(uint64_t tableId, uint64_t keyHash,
         return false;
 
     if (outTablet != NULL)
-        *outTablet = it->second;
+        tabletManager->copyTablet(it->second, outTablet);
     return true;
 }
 
@@ -16,6 +16,9 @@
 #ifndef RAMCLOUD_TABLETMANAGER_H
 #define RAMCLOUD_TABLETMANAGER_H
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <unordered_map>
 
 #include "Common.h"
@@ -42,6 +45,13 @@ namespace RAMCloud {
  * read. The downside, of course, is that the caller needs to be aware that the
  * actual state may be permuted at any time and will not be reflected in the
  * cached copy obtained during the lookup.
+ *
+ * Reads are checked and counted on every object read, so that path doesn't
+ * take the monitor lock: the tablets are also kept in a sorted flat array
+ * that checkAndIncrementReadCount() and checkReadable() binary-search
+ * without writing to any shared memory other than the tablet's read
+ * counter. The array is rebuilt whenever a tablet is added, removed, or
+ * changed.
  */
 class TabletManager {
   PUBLIC:
@@ -79,6 +89,7 @@ class TabletManager {
             , state(NOT_READY)
             , readCount(-1)
             , writeCount(-1)
+            , readCounter(NULL)
         {
         }
 
@@ -92,6 +103,7 @@ class TabletManager {
             , state(state)
             , readCount(0)
             , writeCount(0)
+            , readCounter(NULL)
         {
         }
 
@@ -112,6 +124,11 @@ class TabletManager {
 
         /// The number of write operations performed on objects in this tablet.
         uint64_t writeCount;
+
+        /// For tablets in TabletManager::tabletMap, where reads are counted
+        /// (see TabletManager::readCounters); readCount is only filled in
+        /// from it in the copies handed out to callers.
+        std::atomic<uint64_t>* readCounter;
     };
 
     /**
@@ -152,6 +169,7 @@ class TabletManager {
                    uint64_t endKeyHash,
                    TabletState state);
     bool checkAndIncrementReadCount(Key& key);
+    bool checkReadable(Key& key);
     bool getTablet(Key& key,
                    Tablet* outTablet = NULL);
     bool getTablet(uint64_t tableId,
@@ -188,8 +206,29 @@ class TabletManager {
     /// relatively few for the same table.
     typedef std::unordered_multimap<uint64_t, Tablet> TabletMap;
 
+    /**
+     * An element of the array used for lock-free lookups: a copy of the
+     * fields of one tablet in tabletMap that reads need.
+     */
+    struct FlatTablet {
+        uint64_t tableId;
+        uint64_t startKeyHash;
+        uint64_t endKeyHash;
+        TabletState state;
+        std::atomic<uint64_t>* readCounter;
+    };
+
     TabletMap::iterator lookup(uint64_t tableId, uint64_t keyHash,
                                const SpinLock::Guard& lock);
+    bool lookupForRead(uint64_t tableId, uint64_t keyHash,
+                       FlatTablet* outTablet);
+    bool lookupLockFree(uint64_t tableId, uint64_t keyHash,
+                        FlatTablet* outTablet);
+    void copyTablet(const Tablet& tablet, Tablet* outTablet);
+    void newReadCounter(const SpinLock::Guard& lock, Tablet* tablet);
+    void invalidateFlatTablets(const SpinLock::Guard& lock);
+    void rebuildFlatTablets(const SpinLock::Guard& lock);
+    static bool isReadable(const FlatTablet& tablet);
 
     /// This unordered_multimap is used to store and access all tablet data.
     TabletMap tabletMap;
@@ -197,6 +236,43 @@ class TabletManager {
     /// Monitor spinlock used to protect the tabletMap from concurrent access.
     SpinLock lock;
 
+    /**
+     * Read counters for every tablet ever added; see Tablet::readCounter.
+     * Lock-free readers may increment a tablet's counter after it has been
+     * removed, so counters are only freed when this object is destroyed.
+     * Only grown with the monitor lock held.
+     */
+    std::deque<std::atomic<uint64_t>> readCounters;
+
+    /**
+     * Sequence number for the contents of flatTablets, in the style of a
+     * seqlock: odd while rebuildFlatTablets() is running. Lock-free readers
+     * fall back to the monitor lock if it is odd or changes during their
+     * lookup.
+     */
+    std::atomic<uint64_t> flatTabletsVersion;
+
+    /**
+     * All tablets in tabletMap, sorted by table id and start key hash.
+     * Points into flatTabletArrays.
+     */
+    std::atomic<FlatTablet*> flatTablets;
+
+    /// Number of valid entries in flatTablets.
+    std::atomic<uint32_t> numFlatTablets;
+
+    /// Number of entries that fit in flatTablets.
+    uint32_t flatTabletsCapacity;
+
+    /**
+     * Every array ever used for flatTablets. A lock-free reader may still
+     * be searching an array after it has been replaced by a larger one, so
+     * arrays are only freed when this object is destroyed; since each is
+     * at least twice the size of the previous one, this wastes at most as
+     * much memory as the current array uses.
+     */
+    std::vector<std::unique_ptr<FlatTablet[]>> flatTabletArrays;
+
     /// Count of tablets whose status is NOT_READY. Used to determine if there
     /// is any ongoing recovery.
     /// Main use case is to prevent UnackedRpcResult::cleanByTimeout() from
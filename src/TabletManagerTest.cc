@@ -80,6 +80,59 @@ TEST_F(TabletManagerTest, checkAndIncrementReadCount) {
             tm.toString());
 }
 
+TEST_F(TabletManagerTest, checkAndIncrementReadCount_lockedForMigration) {
+    Key key(5, "1", 1);
+    tm.addTablet(5, 0, ~0UL, TabletManager::LOCKED_FOR_MIGRATION);
+    EXPECT_THROW(tm.checkAndIncrementReadCount(key), RetryException);
+    tm.changeState(5, 0, ~0UL, TabletManager::LOCKED_FOR_MIGRATION,
+            TabletManager::NOT_READY);
+    EXPECT_FALSE(tm.checkAndIncrementReadCount(key));
+    EXPECT_EQ("{ tableId: 5 startKeyHash: 0 endKeyHash: 18446744073709551615 "
+            "state: 1 reads: 0 writes: 0 }", tm.toString());
+}
+
+TEST_F(TabletManagerTest, checkReadable) {
+    Key key(5, "1", 1);
+    EXPECT_FALSE(tm.checkReadable(key));
+    tm.addTablet(5, 0, ~0UL, TabletManager::NORMAL);
+    EXPECT_TRUE(tm.checkReadable(key));
+    EXPECT_EQ("{ tableId: 5 startKeyHash: 0 endKeyHash: 18446744073709551615 "
+            "state: 0 reads: 0 writes: 0 }", tm.toString());
+    tm.changeState(5, 0, ~0UL, TabletManager::NORMAL,
+            TabletManager::LOCKED_FOR_MIGRATION);
+    EXPECT_THROW(tm.checkReadable(key), RetryException);
+}
+
+TEST_F(TabletManagerTest, lookupLockFree) {
+    tm.addTablet(5, 0, 99, TabletManager::NORMAL);
+    tm.addTablet(5, 100, 199, TabletManager::NOT_READY);
+    tm.addTablet(7, 0, ~0UL, TabletManager::NORMAL);
+
+    TabletManager::FlatTablet tablet;
+    EXPECT_TRUE(tm.lookupLockFree(5, 150, &tablet));
+    EXPECT_EQ(100U, tablet.startKeyHash);
+    EXPECT_EQ(TabletManager::NOT_READY, tablet.state);
+    EXPECT_TRUE(tm.lookupLockFree(7, 5, &tablet));
+    EXPECT_EQ(7U, tablet.tableId);
+    EXPECT_TRUE(tm.lookupLockFree(5, 200, &tablet));
+    EXPECT_TRUE(tablet.readCounter == NULL);
+    EXPECT_TRUE(tm.lookupLockFree(6, 0, &tablet));
+    EXPECT_TRUE(tablet.readCounter == NULL);
+
+    // While the array is being rebuilt, readers must take the lock; the
+    // counts they record land in the same place either way.
+    tm.deleteTablet(5, 0, 99);
+    tm.addTablet(5, 0, 99, TabletManager::NORMAL);
+    tm.incrementReadCount(5, 50);
+    tm.flatTabletsVersion++;
+    EXPECT_FALSE(tm.lookupLockFree(5, 50, &tablet));
+    tm.incrementReadCount(5, 50);
+    tm.flatTabletsVersion++;
+    TabletManager::Tablet out;
+    EXPECT_TRUE(tm.getTablet(5, 50, &out));
+    EXPECT_EQ(2U, out.readCount);
+}
+
 TEST_F(TabletManagerTest, getTablet_byKey) {
     Key key(5, "hi", 2);
     EXPECT_FALSE(tm.getTablet(key));
@@ -278,7 +331,8 @@ TEST_F(TabletManagerTest, getStatistics) {
         ProtoBuf::ServerStatistics stats;
         tm.getStatistics(&stats);
         EXPECT_EQ("tabletentry { table_id: 58 start_key_hash: 0 "
-            "end_key_hash: 18446744073709551615 number_read_and_writes: 1 }",
+            "end_key_hash: 18446744073709551615 number_read_and_writes: 1 "
+            "read_count: 1 }",
             stats.ShortDebugString());
     }
 
@@ -288,7 +342,8 @@ TEST_F(TabletManagerTest, getStatistics) {
         ProtoBuf::ServerStatistics stats;
         tm.getStatistics(&stats);
         EXPECT_EQ("tabletentry { table_id: 58 start_key_hash: 0 "
-            "end_key_hash: 18446744073709551615 number_read_and_writes: 2 }",
+            "end_key_hash: 18446744073709551615 number_read_and_writes: 2 "
+            "read_count: 1 write_count: 1 }",
             stats.ShortDebugString());
     }
 }
@@ -0,0 +1,157 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include <algorithm>
+
+#include "TabletMembership.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty TabletMembership.
+ */
+TabletMembership::TabletMembership()
+    : stripes()
+{
+}
+
+/**
+ * Record that the hash table has gained an entry for a key in the given
+ * table with the given hash.
+ *
+ * \param tableId
+ *      Table the key belongs to.
+ * \param keyHash
+ *      Hash of the key.
+ */
+void
+TabletMembership::add(uint64_t tableId, KeyHash keyHash)
+{
+    Stripe& stripe = getStripe(keyHash);
+    SpinLock::Guard _(stripe.lock);
+    stripe.tables[tableId][keyHash]++;
+}
+
+/**
+ * Record that the hash table has lost an entry previously passed to add().
+ *
+ * \param tableId
+ *      Table the key belongs to.
+ * \param keyHash
+ *      Hash of the key.
+ */
+void
+TabletMembership::remove(uint64_t tableId, KeyHash keyHash)
+{
+    Stripe& stripe = getStripe(keyHash);
+    SpinLock::Guard _(stripe.lock);
+    auto table = stripe.tables.find(tableId);
+    if (table == stripe.tables.end())
+        return;
+    KeyHashCounts::iterator it = table->second.find(keyHash);
+    if (it == table->second.end())
+        return;
+    if (--it->second == 0) {
+        table->second.erase(it);
+        if (table->second.empty())
+            stripe.tables.erase(table);
+    }
+}
+
+/**
+ * Find the distinct key hashes recorded for part of a table.
+ *
+ * \param tableId
+ *      Table whose hashes are wanted.
+ * \param firstKeyHash
+ *      Smallest key hash to return.
+ * \param lastKeyHash
+ *      Largest key hash to return.
+ * \param[out] keyHashes
+ *      The key hashes in [firstKeyHash, lastKeyHash] are appended here, in
+ *      increasing order.
+ * \param maxKeyHashes
+ *      Give up once more than this many hashes have been found.
+ * \return
+ *      True if all of the hashes in the range were appended to \a keyHashes.
+ *      False if there were more than \a maxKeyHashes of them, in which case
+ *      \a keyHashes holds an arbitrary subset of them.
+ */
+bool
+TabletMembership::getKeyHashes(uint64_t tableId, KeyHash firstKeyHash,
+                               KeyHash lastKeyHash, vector<KeyHash>* keyHashes,
+                               size_t maxKeyHashes)
+{
+    size_t initialSize = keyHashes->size();
+    for (uint32_t i = 0; i < NUM_STRIPES; i++) {
+        Stripe& stripe = stripes[i];
+        SpinLock::Guard _(stripe.lock);
+        auto table = stripe.tables.find(tableId);
+        if (table == stripe.tables.end())
+            continue;
+        KeyHashCounts::iterator it = table->second.lower_bound(firstKeyHash);
+        for (; it != table->second.end() && it->first <= lastKeyHash; it++) {
+            if (keyHashes->size() - initialSize >= maxKeyHashes)
+                return false;
+            keyHashes->push_back(it->first);
+        }
+    }
+
+    // Each stripe's hashes are already sorted and distinct, and no hash
+    // appears in more than one stripe.
+    std::sort(keyHashes->begin() + initialSize, keyHashes->end());
+    return true;
+}
+
+/**
+ * Find every table that has at least one key hash recorded.
+ *
+ * \param[out] tableIds
+ *      The ids of those tables are appended here, in increasing order.
+ */
+void
+TabletMembership::getTableIds(vector<uint64_t>* tableIds)
+{
+    size_t initialSize = tableIds->size();
+    for (uint32_t i = 0; i < NUM_STRIPES; i++) {
+        Stripe& stripe = stripes[i];
+        SpinLock::Guard _(stripe.lock);
+        for (auto& table : stripe.tables)
+            tableIds->push_back(table.first);
+    }
+    std::sort(tableIds->begin() + initialSize, tableIds->end());
+    tableIds->erase(std::unique(tableIds->begin() + initialSize,
+                                tableIds->end()),
+                    tableIds->end());
+}
+
+/**
+ * Return the number of distinct (table, key hash) pairs recorded.
+ */
+uint64_t
+TabletMembership::getNumKeyHashes()
+{
+    uint64_t count = 0;
+    for (uint32_t i = 0; i < NUM_STRIPES; i++) {
+        Stripe& stripe = stripes[i];
+        SpinLock::Guard _(stripe.lock);
+        for (auto& table : stripe.tables)
+            count += table.second.size();
+    }
+    return count;
+}
+
+} // namespace RAMCloud
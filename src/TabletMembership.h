@@ -0,0 +1,97 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_TABLETMEMBERSHIP_H
+#define RAMCLOUD_TABLETMEMBERSHIP_H
+
+#include <map>
+#include <unordered_map>
+
+#include "Common.h"
+#include "Key.h"
+#include "SpinLock.h"
+
+namespace RAMCloud {
+
+/**
+ * Records which key hashes of which tables have entries in a master's
+ * HashTable, so that the objects of one tablet can be found without walking
+ * the entire hash table. ObjectManager keeps an instance up to date (if
+ * ServerConfig::Master::trackTabletMembership is set) by calling add() for
+ * every reference it inserts in the hash table and remove() for every one it
+ * removes. Dropping, cleaning up after, or enumerating a small tablet then
+ * costs time proportional to the size of that tablet.
+ *
+ * Only key hashes are recorded, not log references, so nothing needs to
+ * change here when the log cleaner relocates an entry or when the hash
+ * table is resized. Several keys in the same table may share a hash; each
+ * hash is counted so that it stays recorded until the last of them is gone.
+ *
+ * This class is thread-safe. Hashes are spread across several independently
+ * locked stripes so that concurrent writers rarely contend.
+ */
+class TabletMembership {
+  public:
+    TabletMembership();
+    void add(uint64_t tableId, KeyHash keyHash);
+    void remove(uint64_t tableId, KeyHash keyHash);
+    bool getKeyHashes(uint64_t tableId, KeyHash firstKeyHash,
+                      KeyHash lastKeyHash, vector<KeyHash>* keyHashes,
+                      size_t maxKeyHashes = ~0lu);
+    void getTableIds(vector<uint64_t>* tableIds);
+    uint64_t getNumKeyHashes();
+
+  PRIVATE:
+    /// Number of entries in #stripes; must be a power of two.
+    static const uint32_t NUM_STRIPES = 16;
+
+    /// For each key hash recorded in a table, the number of hash table
+    /// entries for that table with that hash.
+    typedef std::map<KeyHash, uint32_t> KeyHashCounts;
+
+    /**
+     * One independently locked part of the membership; a key hash always
+     * lives in the stripe selected by its low-order bits.
+     */
+    struct Stripe {
+        Stripe()
+            : lock("TabletMembership::lock")
+            , tables()
+        {}
+
+        /// Protects #tables.
+        SpinLock lock;
+
+        /// Key hashes in this stripe, by table id. Tables with no hashes
+        /// recorded in this stripe have no entry.
+        std::unordered_map<uint64_t, KeyHashCounts> tables;
+    };
+
+    /// Return the stripe that holds \a keyHash.
+    Stripe&
+    getStripe(KeyHash keyHash)
+    {
+        return stripes[keyHash & (NUM_STRIPES - 1)];
+    }
+
+    Stripe stripes[NUM_STRIPES];
+
+    DISALLOW_COPY_AND_ASSIGN(TabletMembership);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_TABLETMEMBERSHIP_H
@@ -0,0 +1,116 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "TabletMembership.h"
+
+namespace RAMCloud {
+
+class TabletMembershipTest : public ::testing::Test {
+  public:
+    TabletMembership membership;
+
+    TabletMembershipTest()
+        : membership()
+    {
+    }
+
+    string
+    getKeyHashes(uint64_t tableId, KeyHash first, KeyHash last,
+                 size_t maxKeyHashes = ~0lu)
+    {
+        vector<KeyHash> keyHashes;
+        if (!membership.getKeyHashes(tableId, first, last, &keyHashes,
+                                     maxKeyHashes)) {
+            return "too many";
+        }
+        string result;
+        foreach (KeyHash keyHash, keyHashes)
+            result += format("%s%lu", result.empty() ? "" : " ", keyHash);
+        return result;
+    }
+
+    DISALLOW_COPY_AND_ASSIGN(TabletMembershipTest);
+};
+
+TEST_F(TabletMembershipTest, add) {
+    membership.add(1, 17);
+    membership.add(1, 17);
+    membership.add(1, 33);
+    membership.add(2, 17);
+    EXPECT_EQ(3U, membership.getNumKeyHashes());
+    EXPECT_EQ(2U, membership.stripes[1].tables[1][17]);
+    EXPECT_EQ(1U, membership.stripes[1].tables[1][33]);
+    EXPECT_EQ(1U, membership.stripes[1].tables[2][17]);
+}
+
+TEST_F(TabletMembershipTest, remove) {
+    membership.add(1, 17);
+    membership.add(1, 17);
+    membership.add(1, 18);
+
+    membership.remove(1, 17);
+    EXPECT_EQ("17 18", getKeyHashes(1, 0, ~0lu));
+    membership.remove(1, 17);
+    EXPECT_EQ("18", getKeyHashes(1, 0, ~0lu));
+    EXPECT_EQ(0U, membership.stripes[1].tables.size());
+
+    // Unknown tables and hashes are ignored.
+    membership.remove(1, 17);
+    membership.remove(3, 18);
+    EXPECT_EQ("18", getKeyHashes(1, 0, ~0lu));
+
+    membership.remove(1, 18);
+    EXPECT_EQ(0U, membership.getNumKeyHashes());
+    EXPECT_EQ(0U, membership.stripes[2].tables.size());
+}
+
+TEST_F(TabletMembershipTest, getKeyHashes) {
+    for (KeyHash keyHash = 0; keyHash < 40; keyHash += 3)
+        membership.add(5, keyHash);
+    membership.add(6, 10);
+
+    EXPECT_EQ("9 12 15 18 21", getKeyHashes(5, 8, 21));
+    EXPECT_EQ("0 3", getKeyHashes(5, 0, 3));
+    EXPECT_EQ("", getKeyHashes(5, 40, ~0lu));
+    EXPECT_EQ("", getKeyHashes(7, 0, ~0lu));
+    EXPECT_EQ("10", getKeyHashes(6, 0, ~0lu));
+}
+
+TEST_F(TabletMembershipTest, getKeyHashes_maxKeyHashes) {
+    membership.add(5, 1);
+    membership.add(5, 2);
+    membership.add(5, 3);
+    EXPECT_EQ("1 2 3", getKeyHashes(5, 0, ~0lu, 3));
+    EXPECT_EQ("too many", getKeyHashes(5, 0, ~0lu, 2));
+    EXPECT_EQ("2 3", getKeyHashes(5, 2, ~0lu, 2));
+    EXPECT_EQ("", getKeyHashes(5, 4, ~0lu, 0));
+}
+
+TEST_F(TabletMembershipTest, getTableIds) {
+    membership.add(9, 1);
+    membership.add(9, 2);
+    membership.add(4, 2);
+    membership.add(7, 100);
+    vector<uint64_t> tableIds;
+    membership.getTableIds(&tableIds);
+    EXPECT_EQ(3U, tableIds.size());
+    EXPECT_EQ(4U, tableIds[0]);
+    EXPECT_EQ(7U, tableIds[1]);
+    EXPECT_EQ(9U, tableIds[2]);
+}
+
+}  // namespace RAMCloud
@@ -17,6 +17,7 @@
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
+#include <linux/errqueue.h>
 
 #include "Common.h"
 #include "PerfStats.h"
@@ -26,6 +27,21 @@
 
 namespace RAMCloud {
 
+// These come from linux/socket.h and linux/errqueue.h, but older C
+// libraries don't export them.
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+#ifndef SO_EE_CODE_ZEROCOPY_COPIED
+#define SO_EE_CODE_ZEROCOPY_COPIED 1
+#endif
+
 int TcpTransport::messageChunks = 0;
 
 /**
@@ -62,6 +78,7 @@ TcpTransport::TcpTransport(Context* context,
     , acceptHandler()
     , sockets()
     , nextSocketId(100)
+    , zeroCopy(false)
     , serverRpcPool()
     , clientRpcPool()
 {
@@ -69,6 +86,7 @@ TcpTransport::TcpTransport(Context* context,
         return;
     IpAddress address(serviceLocator);
     locatorString = serviceLocator->getOriginalString();
+    zeroCopy = serviceLocator->getOption<bool>("zeroCopy", false);
 
     listenSocket = sys->socket(PF_INET, SOCK_STREAM, 0);
     if (listenSocket == -1) {
@@ -145,6 +163,13 @@ TcpTransport::~TcpTransport()
  */
 void
 TcpTransport::closeSocket(int fd) {
+    if (!sockets[fd]->rpcsWaitingForZeroCopy.empty()) {
+        // The kernel may still be reading replies out of RPCs that are
+        // about to be recycled; make it discard any unsent data now
+        // rather than transmit from memory that may be reused.
+        struct linger linger = {1, 0};
+        sys->setsockopt(fd, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger));
+    }
     delete sockets[fd];
     sockets[fd] = NULL;
     sys->close(fd);
@@ -161,6 +186,11 @@ TcpTransport::Socket::Socket(int fd, TcpTransport* transport, sockaddr_in& sin)
     , rpcsWaitingToReply()
     , bytesLeftToSend(0)
     , sin(sin)
+    , zeroCopy(transport->zeroCopy)
+    , zeroCopySends(0)
+    , zeroCopyCompleted(0)
+    , earlyCompletions()
+    , rpcsWaitingForZeroCopy()
 {
     transport->nextSocketId++;
 }
@@ -177,6 +207,11 @@ TcpTransport::Socket::~Socket() {
         rpcsWaitingToReply.pop_front();
         transport->serverRpcPool.destroy(&rpc);
     }
+    while (!rpcsWaitingForZeroCopy.empty()) {
+        TcpServerRpc& rpc = rpcsWaitingForZeroCopy.front();
+        rpcsWaitingForZeroCopy.pop_front();
+        transport->serverRpcPool.destroy(&rpc);
+    }
 }
 
 
@@ -262,7 +297,16 @@ TcpTransport::AcceptHandler::handleFileEvent(int events)
             static_cast<unsigned int>(acceptedFd)) {
         transport->sockets.resize(acceptedFd + 1);
     }
-    transport->sockets[acceptedFd] = new Socket(acceptedFd, transport, sin);
+    Socket* socket = new Socket(acceptedFd, transport, sin);
+    transport->sockets[acceptedFd] = socket;
+    if (socket->zeroCopy && (sys->setsockopt(acceptedFd, SOL_SOCKET,
+            SO_ZEROCOPY, &flag, sizeof(flag)) != 0)) {
+        // Kernels before 4.14 don't support MSG_ZEROCOPY; fall back to
+        // copying replies.
+        LOG(NOTICE, "TcpTransport couldn't enable SO_ZEROCOPY on socket "
+                "(%s); replies will be copied", strerror(errno));
+        socket->zeroCopy = false;
+    }
 }
 
 /**
@@ -278,8 +322,7 @@ TcpTransport::AcceptHandler::handleFileEvent(int events)
 TcpTransport::ServerSocketHandler::ServerSocketHandler(int fd,
                                                        TcpTransport* transport,
                                                        Socket* socket)
-    : Dispatch::File(transport->context->dispatch, fd,
-                     Dispatch::FileEvent::READABLE)
+    : Dispatch::File(transport->context->dispatch, fd, IDLE_EVENTS)
     , fd(fd)
     , transport(transport)
     , socket(socket)
@@ -292,11 +335,12 @@ TcpTransport::ServerSocketHandler::ServerSocketHandler(int fd,
  * becomes readable or writable.  It attempts to read incoming messages from
  * the socket.  If a full message is available, a TcpServerRpc object gets
  * queued for service.  It also attempts to write responses to the socket
- * (if there are responses waiting for transmission).
+ * (if there are responses waiting for transmission), and reaps zero-copy
+ * send completions from the socket's error queue.
  *
  * \param events
- *      Indicates whether the socket was readable, writable, or both
- *      (OR-ed combination of Dispatch::FileEvent bits).
+ *      Indicates whether the socket was readable, writable, or had an
+ *      error pending (OR-ed combination of Dispatch::FileEvent bits).
  */
 void
 TcpTransport::ServerSocketHandler::handleFileEvent(int events)
@@ -308,6 +352,13 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
     Socket* socket = transport->sockets[socketFd];
     assert(socket != NULL);
     try {
+        // Completions for zero-copy sends arrive on the socket's error
+        // queue. Reap them even if no RPCs are waiting (a completion can
+        // arrive after its reply was recycled), since epoll keeps
+        // reporting the error until the queue is empty.
+        if (events & Dispatch::FileEvent::ERROR_PENDING) {
+            transport->reapZeroCopyCompletions(socket, fd);
+        }
         if (events & Dispatch::FileEvent::READABLE) {
             if (socket->rpc == NULL) {
                 socket->rpc = transport->serverRpcPool.construct(socket,
@@ -331,20 +382,26 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
         if (events & Dispatch::FileEvent::WRITABLE) {
             while (true) {
                 if (socket->rpcsWaitingToReply.empty()) {
-                    setEvents(Dispatch::FileEvent::READABLE);
+                    setEvents(IDLE_EVENTS);
                     break;
                 }
                 TcpServerRpc& rpc = socket->rpcsWaitingToReply.front();
+                uint32_t zeroCopySends = socket->zeroCopySends;
                 socket->bytesLeftToSend = TcpTransport::sendMessage(fd,
                         rpc.message.header.nonce, &rpc.replyPayload,
-                        socket->bytesLeftToSend);
+                        socket->bytesLeftToSend,
+                        socket->zeroCopy ? &socket->zeroCopySends : NULL);
+                if (socket->zeroCopySends != zeroCopySends) {
+                    rpc.sentWithZeroCopy = true;
+                    rpc.lastZeroCopySend = socket->zeroCopySends - 1;
+                }
                 if (socket->bytesLeftToSend != 0) {
                     break;
                 }
                 // The current reply is finished; start the next one, if
                 // there is one.
                 socket->rpcsWaitingToReply.pop_front();
-                transport->serverRpcPool.destroy(&rpc);
+                transport->replySent(socket, &rpc);
                 socket->bytesLeftToSend = -1;
             }
         }
@@ -371,6 +428,12 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
  *      Anything else means that part of the message was transmitted
  *      in a previous call, and the value of this parameter is the
  *      result returned by that call (always greater than 0).
+ * \param zeroCopySends
+ *      If non-NULL, fd has SO_ZEROCOPY enabled and large messages are
+ *      sent with MSG_ZEROCOPY; the value is incremented for each such
+ *      send that transmits data (this matches the kernel's numbering of
+ *      completions). In that case the caller must not modify or free
+ *      payload until the kernel reports the sends complete.
  *
  * \return
  *      The number of (trailing) bytes that could not be transmitted.
@@ -381,7 +444,7 @@ TcpTransport::ServerSocketHandler::handleFileEvent(int events)
  */
 int
 TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
-        int bytesToSend)
+        int bytesToSend, uint32_t* zeroCopySends)
 {
     assert(fd >= 0);
 
@@ -432,8 +495,20 @@ TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
     msg.msg_iov = iov;
     msg.msg_iovlen = iovecIndex;
 
-    int r = downCast<int>(sys->sendmsg(fd, &msg,
-            MSG_NOSIGNAL|MSG_DONTWAIT));
+    int flags = MSG_NOSIGNAL|MSG_DONTWAIT;
+    if ((zeroCopySends != NULL) && (bytesToSend >= MIN_ZERO_COPY_BYTES)) {
+        flags |= MSG_ZEROCOPY;
+    }
+    int r = downCast<int>(sys->sendmsg(fd, &msg, flags));
+    if ((r == -1) && (errno == ENOBUFS) && (flags & MSG_ZEROCOPY)) {
+        // The kernel couldn't pin any more pages for us (the optmem or
+        // locked memory limit was hit); just copy this time.
+        flags &= ~MSG_ZEROCOPY;
+        r = downCast<int>(sys->sendmsg(fd, &msg, flags));
+    }
+    if ((r > 0) && (flags & MSG_ZEROCOPY)) {
+        (*zeroCopySends)++;
+    }
     if (r == bytesToSend) {
         PerfStats::threadStats.networkOutputBytes += r;
         return 0;
@@ -455,6 +530,107 @@ TcpTransport::sendMessage(int fd, uint64_t nonce, Buffer* payload,
     return bytesToSend - r;
 }
 
+/**
+ * This method is invoked once the last byte of a reply has been passed to
+ * the kernel. Normally it recycles the RPC, but if any of the reply was
+ * sent with MSG_ZEROCOPY the kernel may still be transmitting straight out
+ * of replyPayload (which usually refers to objects in the log), so the RPC
+ * is parked until the kernel says it's done. While the RPC stays in
+ * serverRpcPool, the log cleaner can't free the segments it refers to.
+ *
+ * \param socket
+ *      Socket on which the reply was sent.
+ * \param rpc
+ *      The RPC whose reply was sent.
+ */
+void
+TcpTransport::replySent(Socket* socket, TcpServerRpc* rpc)
+{
+    if (rpc->sentWithZeroCopy && static_cast<int32_t>(
+            rpc->lastZeroCopySend - socket->zeroCopyCompleted) >= 0) {
+        socket->rpcsWaitingForZeroCopy.push_back(*rpc);
+        return;
+    }
+    serverRpcPool.destroy(rpc);
+}
+
+/**
+ * Read notifications of completed MSG_ZEROCOPY sends from a socket's error
+ * queue, then recycle any RPCs whose replies the kernel no longer needs.
+ *
+ * \param socket
+ *      Socket whose completions should be processed.
+ * \param fd
+ *      File descriptor for socket.
+ */
+void
+TcpTransport::reapZeroCopyCompletions(Socket* socket, int fd)
+{
+    while (true) {
+        char control[CMSG_SPACE(sizeof(sock_extended_err)) + 64];
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (sys->recvmsg(fd, &msg, MSG_ERRQUEUE|MSG_DONTWAIT) < 0) {
+            break;
+        }
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
+                cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (!((cmsg->cmsg_level == SOL_IP &&
+                    cmsg->cmsg_type == IP_RECVERR) ||
+                    (cmsg->cmsg_level == SOL_IPV6 &&
+                    cmsg->cmsg_type == IPV6_RECVERR))) {
+                continue;
+            }
+            sock_extended_err err;
+            memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+            if ((err.ee_errno != 0) ||
+                    (err.ee_origin != SO_EE_ORIGIN_ZEROCOPY)) {
+                continue;
+            }
+            if (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) {
+                // The kernel had to copy the data after all (e.g. the
+                // device can't gather from user pages, or this is a
+                // loopback connection); stop paying for pinning.
+                socket->zeroCopy = false;
+            }
+            // The notification covers sends ee_info through ee_data.
+            socket->earlyCompletions.emplace_back(err.ee_info, err.ee_data);
+        }
+    }
+
+    // Advance zeroCopyCompleted through any contiguous completed ranges.
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (size_t i = 0; i < socket->earlyCompletions.size(); i++) {
+            std::pair<uint32_t, uint32_t> range = socket->earlyCompletions[i];
+            if (static_cast<int32_t>(range.first -
+                    socket->zeroCopyCompleted) <= 0) {
+                if (static_cast<int32_t>(range.second + 1 -
+                        socket->zeroCopyCompleted) > 0) {
+                    socket->zeroCopyCompleted = range.second + 1;
+                }
+                socket->earlyCompletions[i] = socket->earlyCompletions.back();
+                socket->earlyCompletions.pop_back();
+                progress = true;
+                break;
+            }
+        }
+    }
+
+    while (!socket->rpcsWaitingForZeroCopy.empty()) {
+        TcpServerRpc& rpc = socket->rpcsWaitingForZeroCopy.front();
+        if (static_cast<int32_t>(rpc.lastZeroCopySend -
+                socket->zeroCopyCompleted) >= 0) {
+            break;
+        }
+        socket->rpcsWaitingForZeroCopy.pop_front();
+        serverRpcPool.destroy(&rpc);
+    }
+}
+
 /**
  * Read bytes from a socket and generate exceptions for errors and
  * end-of-file.
@@ -940,21 +1116,32 @@ TcpTransport::TcpServerRpc::sendReply()
             }
 
             // Try to transmit the response.
+            uint32_t zeroCopySends = socket->zeroCopySends;
             socket->bytesLeftToSend = TcpTransport::sendMessage(fd,
-                    message.header.nonce, &replyPayload, -1);
+                    message.header.nonce, &replyPayload, -1,
+                    socket->zeroCopy ? &socket->zeroCopySends : NULL);
+            if (socket->zeroCopySends != zeroCopySends) {
+                sentWithZeroCopy = true;
+                lastZeroCopySend = socket->zeroCopySends - 1;
+            }
             if (socket->bytesLeftToSend > 0) {
                 socket->rpcsWaitingToReply.push_back(*this);
-                socket->ioHandler.setEvents(Dispatch::FileEvent::READABLE |
+                socket->ioHandler.setEvents(
+                        ServerSocketHandler::IDLE_EVENTS |
                         Dispatch::FileEvent::WRITABLE);
                 return;
             }
+
+            // The whole response was sent immediately (this should be the
+            // common case).
+            transport->replySent(socket, this);
+            return;
         }
     } catch (TransportException& e) {
         transport->closeSocket(fd);
     }
 
-    // The whole response was sent immediately (this should be the
-    // common case).  Recycle the RPC object.
+    // The socket is gone; recycle the RPC object.
     transport->serverRpcPool.destroy(this);
 }
 
@@ -136,7 +136,8 @@ class TcpTransport : public Transport {
       PRIVATE:
         TcpServerRpc(Socket* socket, int fd, TcpTransport* transport)
             : fd(fd), socketId(socket->id), message(&requestPayload, NULL),
-            queueEntries(), transport(transport) { }
+            queueEntries(), transport(transport), sentWithZeroCopy(false),
+            lastZeroCopySend(0) { }
 
         int fd;                   /// File descriptor of the socket on
                                   /// which the request was received.
@@ -148,8 +149,22 @@ class TcpTransport : public Transport {
                                   /// request.
         IntrusiveListHook queueEntries;
                                   /// Used to link this RPC onto the
-                                  /// rpcsWaitingToReply list of the Socket.
+                                  /// rpcsWaitingToReply or
+                                  /// rpcsWaitingForZeroCopy list of the
+                                  /// Socket.
         TcpTransport* transport;  /// The parent TcpTransport object.
+        bool sentWithZeroCopy;    /// True means at least part of the reply
+                                  /// was sent with MSG_ZEROCOPY, so the
+                                  /// kernel may still be reading from
+                                  /// replyPayload (and the log memory it
+                                  /// refers to).
+        uint32_t lastZeroCopySend;
+                                  /// If sentWithZeroCopy, the kernel's id
+                                  /// for the last MSG_ZEROCOPY send of the
+                                  /// reply; once it has completed, this
+                                  /// RPC (and with it the LogProtector
+                                  /// epoch keeping the objects it read
+                                  /// alive) may be released.
 
         DISALLOW_COPY_AND_ASSIGN(TcpServerRpc);
     };
@@ -192,7 +207,14 @@ class TcpTransport : public Transport {
     void closeSocket(int fd);
     static ssize_t recvCarefully(int fd, void* buffer, size_t length);
     static int sendMessage(int fd, uint64_t nonce, Buffer* payload,
-            int bytesToSend);
+            int bytesToSend, uint32_t* zeroCopySends = NULL);
+    void replySent(Socket* socket, TcpServerRpc* rpc);
+    void reapZeroCopyCompletions(Socket* socket, int fd);
+
+    /// Replies with fewer bytes than this are always copied into the
+    /// kernel: below about 10 KB, the page pinning and completion
+    /// notification that MSG_ZEROCOPY requires cost more than the copy.
+    static const int MIN_ZERO_COPY_BYTES = 10 * 1024;
 
     /**
      * An event handler that will accept connections on a socket.
@@ -214,6 +236,13 @@ class TcpTransport : public Transport {
       public:
         ServerSocketHandler(int fd, TcpTransport* transport, Socket* socket);
         virtual void handleFileEvent(int events);
+
+        /// Events a server socket always waits for: incoming requests,
+        /// and MSG_ZEROCOPY completions arriving on its error queue.
+        enum {
+            IDLE_EVENTS = Dispatch::FileEvent::READABLE |
+                    Dispatch::FileEvent::ERROR_PENDING
+        };
       PRIVATE:
         // The following variables are just copies of constructor arguments.
         int fd;
@@ -348,6 +377,23 @@ class TcpTransport : public Transport {
         struct sockaddr_in sin;   /// sockaddr_in of the client host on the
                                   /// other end of the socket. Used to
                                   /// implement #getClientServiceLocator().
+        bool zeroCopy;            /// True means large replies are sent
+                                  /// with MSG_ZEROCOPY on this socket.
+        uint32_t zeroCopySends;   /// Number of MSG_ZEROCOPY sends on this
+                                  /// socket so far; the kernel numbers
+                                  /// them from 0 in its completions.
+        uint32_t zeroCopyCompleted;
+                                  /// All MSG_ZEROCOPY sends with ids less
+                                  /// than this have completed.
+        std::vector<std::pair<uint32_t, uint32_t>> earlyCompletions;
+                                  /// Completed ranges of send ids (first
+                                  /// and last, inclusive) the kernel
+                                  /// reported before earlier ones; rare.
+        ServerRpcList rpcsWaitingForZeroCopy;
+                                  /// RPCs whose replies have been fully
+                                  /// passed to the kernel with
+                                  /// MSG_ZEROCOPY but not yet transmitted,
+                                  /// in order of lastZeroCopySend.
         DISALLOW_COPY_AND_ASSIGN(Socket);
     };
 
@@ -363,6 +409,12 @@ class TcpTransport : public Transport {
     /// sendMessage (for testing only).
     static int messageChunks;
 
+    /// True means replies of at least MIN_ZERO_COPY_BYTES are transmitted
+    /// directly from their buffers (typically log memory) with
+    /// MSG_ZEROCOPY, rather than copied into the kernel. Set with the
+    /// "zeroCopy=1" service locator option.
+    bool zeroCopy;
+
     /// Pool allocator for our ServerRpc objects.
     ServerRpcPool<TcpServerRpc> serverRpcPool;
 
@@ -1242,6 +1242,115 @@ TEST_F(TcpTransportTest, sendReply_error) {
     EXPECT_TRUE(transport->sockets[fd] == NULL);
 }
 
+TEST_F(TcpTransportTest, sendReply_zeroCopy) {
+    TestLog::Enable _("~TcpServerRpc");
+    ServiceLocator zeroCopyLocator(
+            "tcp+ip:host=localhost,port=11001,zeroCopy=1");
+    TcpTransport zeroCopyServer(&context, &zeroCopyLocator);
+    EXPECT_TRUE(zeroCopyServer.zeroCopy);
+    Transport::SessionRef session = client.getSession(&zeroCopyLocator);
+    MockWrapper rpc1("request1");
+    session->sendRequest(&rpc1.request, &rpc1.response, &rpc1);
+    Transport::ServerRpc* serverRpc = workerManager->waitForRpc(1.0);
+    ASSERT_TRUE(serverRpc != NULL);
+    TcpTransport::Socket* socket =
+            zeroCopyServer.sockets[zeroCopyServer.sockets.size() - 1];
+    if (!socket->zeroCopy) {
+        // This kernel doesn't support MSG_ZEROCOPY.
+        serverRpc->sendReply();
+        EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+        return;
+    }
+    TestUtil::fillLargeBuffer(&serverRpc->replyPayload, 100000);
+    serverRpc->sendReply();
+    EXPECT_TRUE(TestUtil::waitForRpc(&context, rpc1));
+    EXPECT_EQ("ok", TestUtil::checkLargeBuffer(&rpc1.response, 100000));
+    EXPECT_NE(0u, socket->zeroCopySends);
+
+    // The RPC must stay allocated until the kernel reports the send
+    // complete.
+    for (int i = 0; i < 1000 && (TestLog::get().size() == 0); i++) {
+        context.dispatch->poll();
+        usleep(100);
+    }
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    EXPECT_EQ(0u, socket->rpcsWaitingForZeroCopy.size());
+    EXPECT_EQ(socket->zeroCopySends, socket->zeroCopyCompleted);
+}
+
+TEST_F(TcpTransportTest, reapZeroCopyCompletions_outOfOrder) {
+    TestLog::Enable _("~TcpServerRpc");
+    int fd = connectToServer(&locator);
+    EXPECT_TRUE(waitForSession(server));
+    int serverFd = downCast<int>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+
+    // RPCs whose replies used sends 0-1, 2, and 3.
+    TcpTransport::TcpServerRpc* rpcs[3];
+    uint32_t lastSends[3] = {1, 2, 3};
+    for (int i = 0; i < 3; i++) {
+        rpcs[i] = server.serverRpcPool.construct(socket, serverFd, &server);
+        rpcs[i]->sentWithZeroCopy = true;
+        rpcs[i]->lastZeroCopySend = lastSends[i];
+        server.replySent(socket, rpcs[i]);
+    }
+    socket->zeroCopySends = 4;
+    EXPECT_EQ(3u, socket->rpcsWaitingForZeroCopy.size());
+    EXPECT_EQ("", TestLog::get());
+
+    // Sends 2-3 completed before 0-1.
+    socket->earlyCompletions.emplace_back(2, 3);
+    server.reapZeroCopyCompletions(socket, serverFd);
+    EXPECT_EQ(0u, socket->zeroCopyCompleted);
+    EXPECT_EQ(3u, socket->rpcsWaitingForZeroCopy.size());
+
+    socket->earlyCompletions.emplace_back(0, 1);
+    server.reapZeroCopyCompletions(socket, serverFd);
+    EXPECT_EQ(4u, socket->zeroCopyCompleted);
+    EXPECT_EQ(0u, socket->earlyCompletions.size());
+    EXPECT_EQ(0u, socket->rpcsWaitingForZeroCopy.size());
+    EXPECT_EQ("~TcpServerRpc: deleted | ~TcpServerRpc: deleted | "
+            "~TcpServerRpc: deleted", TestLog::get());
+
+    // Replies that already completed are recycled immediately.
+    TestLog::reset();
+    rpcs[0] = server.serverRpcPool.construct(socket, serverFd, &server);
+    rpcs[0]->sentWithZeroCopy = true;
+    rpcs[0]->lastZeroCopySend = 3;
+    server.replySent(socket, rpcs[0]);
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    close(fd);
+}
+
+TEST_F(TcpTransportTest, ServerSocketHandler_handleFileEvent_errorPending) {
+    TestLog::Enable _("~TcpServerRpc");
+    int fd = connectToServer(&locator);
+    EXPECT_TRUE(waitForSession(server));
+    int serverFd = downCast<int>(server.sockets.size()) - 1;
+    TcpTransport::Socket* socket = server.sockets[serverFd];
+    EXPECT_EQ(TcpTransport::ServerSocketHandler::IDLE_EVENTS,
+            socket->ioHandler.events);
+
+    // Parking a reply doesn't make the socket wait for WRITABLE.
+    TcpTransport::TcpServerRpc* rpc =
+            server.serverRpcPool.construct(socket, serverFd, &server);
+    rpc->sentWithZeroCopy = true;
+    rpc->lastZeroCopySend = 0;
+    server.replySent(socket, rpc);
+    socket->zeroCopySends = 1;
+    EXPECT_EQ(TcpTransport::ServerSocketHandler::IDLE_EVENTS,
+            socket->ioHandler.events);
+
+    // Completions are only reaped when epoll reports an error.
+    socket->earlyCompletions.emplace_back(0, 0);
+    socket->ioHandler.handleFileEvent(Dispatch::FileEvent::WRITABLE);
+    EXPECT_EQ(1u, socket->rpcsWaitingForZeroCopy.size());
+    socket->ioHandler.handleFileEvent(Dispatch::FileEvent::ERROR_PENDING);
+    EXPECT_EQ(0u, socket->rpcsWaitingForZeroCopy.size());
+    EXPECT_EQ("~TcpServerRpc: deleted", TestLog::get());
+    close(fd);
+}
+
 TEST_F(TcpTransportTest, sessionAlarm) {
     TestLog::Enable _;
     TcpTransport::TcpSession* session = new TcpTransport::TcpSession(
@@ -20,6 +20,7 @@
 #include "OptionParser.h"
 #include "ShortMacros.h"
 #include "RawMetrics.h"
+#include "ShmTransport.h"
 #include "TransportManager.h"
 #include "TransportFactory.h"
 #include "TcpTransport.h"
@@ -52,6 +53,15 @@ static struct TcpTransportFactory : public TransportFactory {
     }
 } tcpTransportFactory;
 
+static struct ShmTransportFactory : public TransportFactory {
+    ShmTransportFactory()
+        : TransportFactory("shm") {}
+    Transport* createTransport(Context* context,
+            const ServiceLocator* localServiceLocator) {
+        return new ShmTransport(context, localServiceLocator);
+    }
+} shmTransportFactory;
+
 static struct BasicUdpTransportFactory : public TransportFactory {
     BasicUdpTransportFactory()
         : TransportFactory("basic+kernelUdp", "basic+udp") {}
@@ -58,20 +58,24 @@ UdpDriver::UdpDriver(Context* context,
         const ServiceLocator* localServiceLocator)
     : Driver(context)
     , socketFd(-1)
-    , packetBatches()
-    , currentBatch(0)
+    , shards()
+    , nextShard(0)
     , packetBufPool()
     , mutex("UdpDriver::packetBufPool")
     , locatorString("udp:")
     , bandwidthGbps(10)                   // Default bandwidth = 10 gbs
-    , readerThread()
     , readerThreadExit(false)
 {
+    int numShards = 1;
     if (localServiceLocator != NULL) {
         locatorString = localServiceLocator->getDriverLocatorString();
         try {
             bandwidthGbps = localServiceLocator->getOption<int>("gbs");
         } catch (ServiceLocator::NoSuchKeyException& e) {}
+        try {
+            numShards = std::max(1,
+                    localServiceLocator->getOption<int>("shards"));
+        } catch (ServiceLocator::NoSuchKeyException& e) {}
     }
     queueEstimator.setBandwidth(1000*bandwidthGbps);
     maxTransmitQueueSize = (uint32_t) (static_cast<double>(bandwidthGbps)
@@ -90,6 +94,14 @@ UdpDriver::UdpDriver(Context* context,
         throw DriverException(HERE, "UdpDriver couldn't create socket",
                               errno);
     }
+    int one = 1;
+    if (numShards > 1 && sys->setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one,
+            sizeof(one)) == -1) {
+        int e = errno;
+        sys->close(fd);
+        throw DriverException(HERE, "UdpDriver couldn't set SO_REUSEPORT",
+                e);
+    }
 
     if (localServiceLocator != NULL) {
         IpAddress ipAddress(localServiceLocator);
@@ -118,7 +130,22 @@ UdpDriver::UdpDriver(Context* context,
     }
 
     socketFd = fd;
-    readerThread.construct(readerThreadMain, this);
+    shards.push_back(new Shard(fd));
+    if (numShards > 1) {
+        try {
+            openShards(numShards);
+        } catch (DriverException& e) {
+            close();
+            for (Shard* shard : shards) {
+                delete shard;
+            }
+            shards.clear();
+            throw;
+        }
+    }
+    for (Shard* shard : shards) {
+        shard->readerThread.construct(readerThreadMain, this, shard);
+    }
 
     LOG(NOTICE, "Locator for UdpDriver: %s", locatorString.c_str());
 }
@@ -130,16 +157,18 @@ UdpDriver::UdpDriver(Context* context,
 UdpDriver::~UdpDriver()
 {
     close();
-    for (int batch = 0; batch < 2; batch++) {
-        for (int i = 0; i < PacketBatch::MAX_PACKETS; i++) {
-            if (packetBatches[batch].buffers[i] != NULL) {
-                // No need to sync before acessing packetBufPool since we have
-                // joined readerThread in close().
-                char* payload = packetBatches[batch].buffers[i]->payload;
-                packetBufPool.destroy(reinterpret_cast<PacketBuf*>(
-                        payload - OFFSET_OF(PacketBuf, payload)));
+    for (Shard* shard : shards) {
+        for (int batch = 0; batch < 2; batch++) {
+            for (int i = 0; i < PacketBatch::MAX_PACKETS; i++) {
+                PacketBuf* buffer = shard->packetBatches[batch].buffers[i];
+                if (buffer != NULL) {
+                    // No need to sync before acessing packetBufPool since
+                    // we have joined the reader threads in close().
+                    packetBufPool.destroy(buffer);
+                }
             }
         }
+        delete shard;
     }
 }
 
@@ -149,15 +178,76 @@ UdpDriver::~UdpDriver()
 void
 UdpDriver::close()
 {
-    if (readerThread) {
+    if (!shards.empty() && shards[0]->readerThread) {
         stopReaderThread();
-        readerThread->join();
-        readerThread.destroy();
     }
-    if (socketFd != -1) {
-        sys->close(socketFd);
-        socketFd = -1;
+    for (Shard* shard : shards) {
+        if (shard->readerThread) {
+            shard->readerThread->join();
+            shard->readerThread.destroy();
+        }
+        if (shard->socketFd != -1) {
+            sys->close(shard->socketFd);
+            shard->socketFd = -1;
+        }
+    }
+    socketFd = -1;
+}
+
+/**
+ * Called by the constructor to open the sockets for all shards after the
+ * first; they are bound to the same address as the first shard's socket.
+ *
+ * \param numShards
+ *      Total number of shards the driver should have.
+ *
+ * \throw DriverException
+ *      A socket couldn't be opened; the caller must clean up any shards
+ *      that were created.
+ */
+void
+UdpDriver::openShards(int numShards)
+{
+    // Use the bound address rather than the locator, in case the port
+    // was chosen dynamically.
+    struct sockaddr_in address;
+    socklen_t addressLength = sizeof(address);
+    if (sys->getsockname(socketFd, reinterpret_cast<struct sockaddr*>(
+            &address), &addressLength) == -1) {
+        throw DriverException(HERE, "UdpDriver couldn't get socket address",
+                errno);
+    }
+    int one = 1;
+    while (shards.size() < static_cast<size_t>(numShards)) {
+        int fd = sys->socket(AF_INET, SOCK_DGRAM, 0);
+        if (fd == -1) {
+            throw DriverException(HERE,
+                    "UdpDriver couldn't create socket for shard", errno);
+        }
+        if (sys->setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one,
+                sizeof(one)) == -1 || sys->bind(fd,
+                reinterpret_cast<struct sockaddr*>(&address),
+                addressLength) == -1) {
+            int e = errno;
+            sys->close(fd);
+            throw DriverException(HERE,
+                    "UdpDriver couldn't bind socket for shard", e);
+        }
+        shards.push_back(new Shard(fd));
     }
+
+    // The exit packet sent by stopReaderThread reaches only one of the
+    // shards, so the others must check readerThreadExit periodically.
+    struct timeval timeout = {0, SHARD_RECEIVE_TIMEOUT_MS * 1000};
+    for (Shard* shard : shards) {
+        if (sys->setsockopt(shard->socketFd, SOL_SOCKET, SO_RCVTIMEO,
+                &timeout, sizeof(timeout)) == -1) {
+            throw DriverException(HERE,
+                    "UdpDriver couldn't set receive timeout for shard",
+                    errno);
+        }
+    }
+    LOG(NOTICE, "UdpDriver receiving on %d shards", numShards);
 }
 
 // See docs in Driver class.
@@ -172,16 +262,44 @@ void
 UdpDriver::receivePackets(uint32_t maxPackets,
             std::vector<Received>* receivedPackets)
 {
-    PacketBatch* batch = &packetBatches[currentBatch];
+    uint32_t numShards = downCast<uint32_t>(shards.size());
+    for (uint32_t i = 0; i < numShards && maxPackets > 0; i++) {
+        maxPackets -= receiveShardPackets(shards[(nextShard + i) % numShards],
+                maxPackets, receivedPackets);
+    }
+    if (++nextShard >= numShards) {
+        nextShard = 0;
+    }
+}
+
+/**
+ * Helper for receivePackets: returns packets that have been received
+ * by one shard's reader thread.
+ *
+ * \param shard
+ *      The shard whose packets should be returned.
+ * \param maxPackets
+ *      The maximum number of packets to return.
+ * \param receivedPackets
+ *      Packets are appended here.
+ * \return
+ *      The number of packets appended to receivedPackets.
+ */
+uint32_t
+UdpDriver::receiveShardPackets(Shard* shard, uint32_t maxPackets,
+            std::vector<Received>* receivedPackets)
+{
+    PacketBatch* batch = &shard->packetBatches[shard->currentBatch];
     int available = batch->packetsAvailable.load();
     if (available == 0) {
-        return;
+        return 0;
     }
     Fence::enter();
     int limit = batch->packetsRemoved + maxPackets;
     if (limit > available) {
         limit = available;
     }
+    int count = limit - batch->packetsRemoved;
 
     for (int i = batch->packetsRemoved; i < limit; i++) {
         struct mmsghdr* header = &batch->messageHeaders[i];
@@ -198,8 +316,9 @@ UdpDriver::receivePackets(uint32_t maxPackets,
         batch->packetsRemoved = 0;
         Fence::leave();
         batch->packetsAvailable = 0;
-        currentBatch ^= 1;
+        shard->currentBatch ^= 1;
     }
+    return downCast<uint32_t>(count);
 }
 
 // See docs in Driver class.
@@ -268,8 +387,8 @@ UdpDriver::sendPacket(const Address* addr,
 }
 
 /**
- * Notify the reader thread that it should exit. Don't actually wait for the
- * thread to return here, though.
+ * Notify the reader threads that they should exit. Don't actually wait for
+ * the threads to return here, though.
  */
 void
 UdpDriver::stopReaderThread()
@@ -299,18 +418,20 @@ UdpDriver::getServiceLocator()
  * blocking kernel calls to wait for incoming packets.
  * \param driver
  *      The UdpDriver on behalf of which this thread is operating.
+ * \param shard
+ *      The shard whose socket this thread reads.
  */
 void
-UdpDriver::readerThreadMain(UdpDriver* driver)
+UdpDriver::readerThreadMain(UdpDriver* driver, Shard* shard)
 {
-    // Index within driver->packetBatches where we will read the next
+    // Index within shard->packetBatches where we will read the next
     // batch of packets.
     int currentBatch = 0;
 
     // Each iteration through the following loop makes one kernel call
     // to receive packets.
     while (1) {
-        PacketBatch* batch = &driver->packetBatches[currentBatch];
+        PacketBatch* batch = &shard->packetBatches[currentBatch];
 
         // Make sure that the dispatch thread isn't still working on the
         // current batch.
@@ -354,7 +475,7 @@ UdpDriver::readerThreadMain(UdpDriver* driver)
         }
 
         // Wait for one or more incoming packets
-        ssize_t numPackets = sys->recvmmsg(driver->socketFd,
+        ssize_t numPackets = sys->recvmmsg(shard->socketFd,
                 batch->messageHeaders, PacketBatch::MAX_PACKETS,
                 MSG_WAITFORONE, NULL);
         if (driver->readerThreadExit) {
@@ -60,7 +60,11 @@ class UdpDriver : public Driver {
     }
 
   PROTECTED:
-    static void readerThreadMain(UdpDriver* driver);
+    struct Shard;
+    void openShards(int numShards);
+    static void readerThreadMain(UdpDriver* driver, Shard* shard);
+    uint32_t receiveShardPackets(Shard* shard, uint32_t maxPackets,
+            std::vector<Received>* receivedPackets);
     void stopReaderThread();
 
     struct PacketBuf : Driver::PacketBuf<IpAddress, MAX_PAYLOAD_SIZE> {
@@ -121,18 +125,60 @@ class UdpDriver : public Driver {
         }
     };
 
-    /// File descriptor of the UDP socket this driver uses for communication.
-    /// -1 means socket was closed because of error.
+    /**
+     * Each shard has its own socket and reader thread. When a server
+     * driver has more than one shard, all of their sockets are bound to
+     * the same port with SO_REUSEPORT, so the kernel spreads incoming
+     * flows across them and the kernel calls to receive packets run in
+     * parallel on different cores.
+     */
+    struct Shard {
+        explicit Shard(int socketFd)
+            : socketFd(socketFd)
+            , packetBatches()
+            , currentBatch(0)
+            , readerThread()
+        {}
+
+        /// File descriptor of the UDP socket for this shard. -1 means the
+        /// socket was closed.
+        int socketFd;
+
+        /// Keeping two of these structures allows the background thread
+        /// to read the next batch of packets while the dispatch thread is
+        /// processing the previous batch of packets.
+        PacketBatch packetBatches[2];
+
+        /// 0 or 1: indicates which element of packetBatches will be
+        /// processed next by the dispatch thread.
+        int currentBatch;
+
+        /// The following thread runs in the background to wait for kernel
+        /// calls that receive packets on socketFd.
+        Tub<std::thread> readerThread;
+
+        DISALLOW_COPY_AND_ASSIGN(Shard);
+    };
+
+    /// How long reader threads wait in the kernel before checking
+    /// readerThreadExit, when there is more than one shard (an exit
+    /// packet sent to the driver's port may be delivered to any shard).
+    static const int SHARD_RECEIVE_TIMEOUT_MS = 10;
+
+    /// File descriptor of the UDP socket this driver uses to transmit
+    /// (the same as the socket for the first shard). -1 means socket was
+    /// closed because of error.
     int socketFd;
 
-    /// Keeping two of these structures allows the background thread to
-    /// read the next batch of packets while the dispatch thread is processing
-    /// the previous batch of packets.
-    PacketBatch packetBatches[2];
+    /// Receive queues for this driver; always at least one (the number
+    /// is given by the "shards" option in the service locator, and is
+    /// always 1 for client drivers).
+    std::vector<Shard*> shards;
 
-    /// 0 or 1: indicates which element of packetGroups will be processed
-    /// next by the dispatch thread.
-    int currentBatch;
+    /// Index in shards of the first shard that receivePackets will
+    /// check the next time it is called; rotates so that a busy shard
+    /// can't starve the others.
+    uint32_t nextShard;
 
     /// Holds packet buffers that are no longer in use, for use in future
     /// requests; saves the overhead of calling malloc/free for each request.
@@ -154,11 +200,7 @@ class UdpDriver : public Driver {
     // Effective network bandwidth, in Gbits/second.
     int bandwidthGbps;
 
-    /// The following thread runs in the background to wait for kernel calls
-    /// that receive packets.
-    Tub<std::thread> readerThread;
-
-    /// If the reader thread ever sees a true value in this variable, it
+    /// If a reader thread ever sees a true value in this variable, it
     /// will exit immediately.
     bool readerThreadExit;
 
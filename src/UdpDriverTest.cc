@@ -129,6 +129,43 @@ TEST_F(UdpDriverTest, constructor_gbsOption) {
     EXPECT_EQ(2800u, driver2.maxTransmitQueueSize);
     Cycles::mockCyclesPerSec = 0;
 }
+TEST_F(UdpDriverTest, constructor_shards) {
+    ServiceLocator locator("basic+udp:host=localhost,port=8101,shards=3");
+    Tub<UdpDriver> driver;
+    driver.construct(&context, &locator);
+    ASSERT_EQ(3u, driver->shards.size());
+    EXPECT_EQ(driver->socketFd, driver->shards[0]->socketFd);
+
+    // All of the shards share the same port, and packets from many
+    // clients are all delivered.
+    IpAddress address(&locator);
+    std::vector<UdpDriver*> clients;
+    for (int i = 0; i < 8; i++) {
+        clients.push_back(new UdpDriver(&context));
+        clients.back()->sendPacket(&address, "packet", 6, NULL);
+    }
+    uint32_t received = 0;
+    std::vector<Driver::Received> receivedPackets;
+    for (int i = 0; i < 1000 && received < clients.size(); i++) {
+        driver->receivePackets(10, &receivedPackets);
+        received = downCast<uint32_t>(receivedPackets.size());
+        usleep(1000);
+    }
+    EXPECT_EQ(clients.size(), received);
+    receivedPackets.clear();
+    for (UdpDriver* client : clients) {
+        delete client;
+    }
+
+    // All of the reader threads exit, and the port is released.
+    driver.destroy();
+    driver.construct(&context, &locator);
+    EXPECT_EQ(3u, driver->shards.size());
+}
+TEST_F(UdpDriverTest, constructor_shardsIgnoredForClients) {
+    UdpDriver client2(&context, NULL);
+    EXPECT_EQ(1u, client2.shards.size());
+}
 TEST_F(UdpDriverTest, constructor_errorInSocketCall) {
     sys->socketErrno = EPERM;
     try {
@@ -219,10 +256,19 @@ TEST_F(UdpDriverTest, receivePackets_noPacketsAvailable) {
     server.receivePackets(10, &received);
     EXPECT_EQ(0lu, received.size());
 }
+TEST_F(UdpDriverTest, receivePackets_rotateShards) {
+    ServiceLocator locator("basic+udp:host=localhost,port=8101,shards=2");
+    UdpDriver driver(&context, &locator);
+    std::vector<Driver::Received> received;
+    driver.receivePackets(10, &received);
+    EXPECT_EQ(1u, driver.nextShard);
+    driver.receivePackets(10, &received);
+    EXPECT_EQ(0u, driver.nextShard);
+}
 TEST_F(UdpDriverTest, receivePackets_receivePartialBatches) {
     // First, stall the reader thread, so we can queue up a bunch
     // of packets.
-    server.packetBatches[1].packetsAvailable = 2;
+    server.shards[0]->packetBatches[1].packetsAvailable = 2;
     client.sendPacket(&serverAddress, "packet1", 7, NULL);
     EXPECT_EQ("packet1", receivePackets(&server));
 
@@ -234,19 +280,19 @@ TEST_F(UdpDriverTest, receivePackets_receivePartialBatches) {
     client.sendPacket(&serverAddress, "packet6", 7, NULL);
 
     // Receive packets in 3 separate calls to receivePackets.
-    server.packetBatches[1].packetsAvailable = 0;
+    server.shards[0]->packetBatches[1].packetsAvailable = 0;
     EXPECT_EQ("packet2, packet3, packet4", receivePackets(&server, 3));
-    EXPECT_EQ(5, server.packetBatches[1].packetsAvailable);
-    EXPECT_EQ(3, server.packetBatches[1].packetsRemoved);
-    EXPECT_EQ(1, server.currentBatch);
+    EXPECT_EQ(5, server.shards[0]->packetBatches[1].packetsAvailable);
+    EXPECT_EQ(3, server.shards[0]->packetBatches[1].packetsRemoved);
+    EXPECT_EQ(1, server.shards[0]->currentBatch);
     EXPECT_EQ("packet5", receivePackets(&server, 1));
-    EXPECT_EQ(5, server.packetBatches[1].packetsAvailable);
-    EXPECT_EQ(4, server.packetBatches[1].packetsRemoved);
-    EXPECT_EQ(1, server.currentBatch);
+    EXPECT_EQ(5, server.shards[0]->packetBatches[1].packetsAvailable);
+    EXPECT_EQ(4, server.shards[0]->packetBatches[1].packetsRemoved);
+    EXPECT_EQ(1, server.shards[0]->currentBatch);
     EXPECT_EQ("packet6", receivePackets(&server));
-    EXPECT_EQ(0, server.packetBatches[1].packetsAvailable);
-    EXPECT_EQ(0, server.packetBatches[1].packetsRemoved);
-    EXPECT_EQ(0, server.currentBatch);
+    EXPECT_EQ(0, server.shards[0]->packetBatches[1].packetsAvailable);
+    EXPECT_EQ(0, server.shards[0]->packetBatches[1].packetsRemoved);
+    EXPECT_EQ(0, server.shards[0]->currentBatch);
 }
 
 TEST_F(UdpDriverTest, sendPacket_alreadyClosed) {
@@ -315,7 +361,7 @@ TEST_F(UdpDriverTest, stopReaderThread_errorInGetsockname) {
 }
 
 TEST_F(UdpDriverTest, readerThreadMain_waitForDispatchThread) {
-    server.packetBatches[1].packetsAvailable = 2;
+    server.shards[0]->packetBatches[1].packetsAvailable = 2;
     client.sendPacket(&serverAddress, "packet1", 7, NULL);
     EXPECT_EQ("packet1", receivePackets(&server));
 
@@ -324,23 +370,23 @@ TEST_F(UdpDriverTest, readerThreadMain_waitForDispatchThread) {
     client.sendPacket(&serverAddress, "packet2", 7, NULL);
     usleep(1000);
     EXPECT_TRUE(TestUtil::contains(TestLog::get(), "not keeping up"));
-    EXPECT_EQ(2, server.packetBatches[1].packetsAvailable);
-    EXPECT_TRUE(server.packetBatches[1].buffers[0] == NULL);
-    EXPECT_TRUE(server.packetBatches[1].buffers[1] == NULL);
+    EXPECT_EQ(2, server.shards[0]->packetBatches[1].packetsAvailable);
+    EXPECT_TRUE(server.shards[0]->packetBatches[1].buffers[0] == NULL);
+    EXPECT_TRUE(server.shards[0]->packetBatches[1].buffers[1] == NULL);
 
     // Release batch 1 and make sure that the second packet now arrives.
-    server.packetBatches[1].packetsAvailable = 0;
+    server.shards[0]->packetBatches[1].packetsAvailable = 0;
     EXPECT_EQ("packet2", receivePackets(&server));
 }
 TEST_F(UdpDriverTest, readerThreadMain_exitWhileWaitingForDispatchThread) {
-    server.packetBatches[1].packetsAvailable = 2;
+    server.shards[0]->packetBatches[1].packetsAvailable = 2;
     client.sendPacket(&serverAddress, "packet1", 7, NULL);
     EXPECT_EQ("packet1", receivePackets(&server));
 
     // The server should now be stuck waiting for batch 1 to become
     // available, so it shouldn't receive the following packet.
     usleep(1000);
-    EXPECT_TRUE(server.packetBatches[1].buffers[0] == NULL);
+    EXPECT_TRUE(server.shards[0]->packetBatches[1].buffers[0] == NULL);
 
     // Tell the thread to exit, and make sure it does exit.
     server.readerThreadExit = true;
@@ -351,9 +397,9 @@ TEST_F(UdpDriverTest, readerThreadMain_initializeMsgHdrs) {
     client.sendPacket(&serverAddress, "packet1", 7, NULL);
     EXPECT_EQ("packet1", receivePackets(&server));
     EXPECT_EQ(20lu, server.packetBufPool.outstandingObjects);
-    EXPECT_TRUE(server.packetBatches[0].buffers[0] == NULL);
-    EXPECT_FALSE(server.packetBatches[0].buffers[1] == NULL);
-    EXPECT_FALSE(server.packetBatches[1].buffers[0] == NULL);
+    EXPECT_TRUE(server.shards[0]->packetBatches[0].buffers[0] == NULL);
+    EXPECT_FALSE(server.shards[0]->packetBatches[0].buffers[1] == NULL);
+    EXPECT_FALSE(server.shards[0]->packetBatches[1].buffers[0] == NULL);
 }
 TEST_F(UdpDriverTest, readerThreadMain_errorInRecvmmsg) {
     sys->recvmmsgErrno = EPERM;
@@ -13,6 +13,8 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+#include <sys/syscall.h>
+#include <fstream>
 #include <sstream>
 
 #include "Util.h"
@@ -26,6 +28,73 @@ namespace Util {
 #define SPIN_BUFFER_SIZE 10000
 char spinBuffer[SPIN_BUFFER_SIZE];
 
+// Values from <linux/mempolicy.h>; spelled out here to avoid depending on
+// libnuma's headers.
+static const int MPOL_PREFERRED = 1;
+static const int MPOL_INTERLEAVE = 3;
+static const unsigned MPOL_MF_MOVE = 1 << 1;
+
+/**
+ * Set the NUMA memory policy for a range of memory with mbind(2). Pages
+ * already faulted in are migrated to conform to the new policy.
+ *
+ * \param address
+ *      Start of the range; must be page-aligned.
+ * \param length
+ *      Number of bytes in the range.
+ * \param mode
+ *      One of the MPOL_ values above.
+ * \param numNodes
+ *      The policy applies to nodes [firstNode, firstNode + numNodes).
+ * \param firstNode
+ *      See numNodes.
+ * \return
+ *      True if the kernel accepted the policy, false otherwise.
+ */
+static bool
+setMemoryPolicy(void* address, size_t length, int mode, int firstNode,
+                int numNodes)
+{
+    uint64_t nodeMask[16];
+    const int maxNodes = downCast<int>(8 * sizeof(nodeMask));
+    memset(nodeMask, 0, sizeof(nodeMask));
+    if (firstNode < 0 || numNodes < 1 || firstNode + numNodes > maxNodes)
+        return false;
+    for (int node = firstNode; node < firstNode + numNodes; node++)
+        nodeMask[node / 64] |= 1UL << (node % 64);
+    long r = syscall(SYS_mbind, address, length, mode, nodeMask, maxNodes,
+                     MPOL_MF_MOVE);
+    if (r != 0) {
+        RAMCLOUD_LOG(WARNING, "mbind of %lu bytes at %p to nodes %d-%d "
+                     "failed: %s", length, address, firstNode,
+                     firstNode + numNodes - 1, strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Ask the kernel to place the pages of a range of memory on a particular NUMA
+ * node. Pages already faulted in elsewhere are migrated, and future faults
+ * will prefer the node (though the kernel may fall back to other nodes if
+ * it runs out of memory there).
+ *
+ * \param address
+ *      Start of the range; must be page-aligned.
+ * \param length
+ *      Number of bytes in the range.
+ * \param node
+ *      NUMA node to place the memory on; see getNumaNodeCount().
+ * \return
+ *      True if the kernel accepted the request, false otherwise (for example
+ *      because the kernel was built without NUMA support).
+ */
+bool
+bindMemoryToNumaNode(void* address, size_t length, int node)
+{
+    return setMemoryPolicy(address, length, MPOL_PREFERRED, node, 1);
+}
+
 /**
  * Sets the allowable set of cores for the current threadto include
  * all of the available processors. It is used to restore a previously
@@ -70,6 +139,56 @@ getCpuAffinityString(void)
     return result;
 }
 
+/**
+ * Find the cores belonging to a NUMA node.
+ *
+ * \param node
+ *      NUMA node whose cores are wanted; see getNumaNodeCount().
+ * \param[out] cpuSet
+ *      Filled in with the node's cores.
+ * \return
+ *      True if the node's cores could be determined and there is at least
+ *      one of them, false otherwise.
+ */
+bool
+getNumaNodeCpus(int node, cpu_set_t* cpuSet)
+{
+    CPU_ZERO(cpuSet);
+    std::ifstream file(format("/sys/devices/system/node/node%d/cpulist",
+                              node));
+    string list;
+    if (!std::getline(file, list))
+        return false;
+    std::vector<int> cpus = parseRangeList(list);
+    foreach (int cpu, cpus) {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, cpuSet);
+    }
+    return CPU_COUNT(cpuSet) > 0;
+}
+
+/**
+ * Return the number of NUMA nodes (sockets, usually) in this machine. Nodes
+ * are numbered from 0. Returns 1 if the machine isn't NUMA or the topology
+ * can't be determined.
+ */
+int
+getNumaNodeCount(void)
+{
+#ifdef TESTING
+    if (mockNumaNodeCount)
+        return mockNumaNodeCount;
+#endif
+    std::ifstream file("/sys/devices/system/node/online");
+    string list;
+    if (!std::getline(file, list))
+        return 1;
+    std::vector<int> nodes = parseRangeList(list);
+    if (nodes.empty())
+        return 1;
+    return *std::max_element(nodes.begin(), nodes.end()) + 1;
+}
+
 /**
  * Generate a random string.
  *
@@ -132,6 +251,55 @@ hexDump(const void *buf, uint64_t bytes)
     return output.str();
 }
 
+/**
+ * Ask the kernel to spread the pages of a range of memory round-robin across
+ * NUMA nodes, so that memory accessed from every core is equally (un)local.
+ *
+ * \param address
+ *      Start of the range; must be page-aligned.
+ * \param length
+ *      Number of bytes in the range.
+ * \param numNodes
+ *      Pages are spread across nodes 0 through numNodes - 1; see
+ *      getNumaNodeCount().
+ * \return
+ *      True if the kernel accepted the request, false otherwise.
+ */
+bool
+interleaveMemoryAcrossNumaNodes(void* address, size_t length, int numNodes)
+{
+    return setMemoryPolicy(address, length, MPOL_INTERLEAVE, 0, numNodes);
+}
+
+/**
+ * Parse a list of integers in the form Linux uses for sets of cores and NUMA
+ * nodes in sysfs, such as "0-3,8,10-11".
+ *
+ * \param list
+ *      The list to parse.
+ * \return
+ *      The integers in the list, in the order they appear. Malformed
+ *      elements are skipped.
+ */
+std::vector<int>
+parseRangeList(const string& list)
+{
+    std::vector<int> result;
+    std::istringstream stream(list);
+    string range;
+    while (std::getline(stream, range, ',')) {
+        int first, last;
+        int n = sscanf(range.c_str(), "%d-%d", &first, &last);
+        if (n == 1)
+            last = first;
+        else if (n != 2)
+            continue;
+        for (int i = first; i <= last; i++)
+            result.push_back(i);
+    }
+    return result;
+}
+
 /**
  * This method has been used during performance testing. It executes
  * in a tight loop copying small blocks of memory (anything to consume
@@ -222,5 +390,11 @@ timespecAdd(const struct timespec& t1, const struct timespec& t2)
  */
 uint64_t mockPmcValue = 0;
 
+/**
+ * Used for testing: if nonzero then getNumaNodeCount() returns this value
+ * instead of inspecting the machine.
+ */
+int mockNumaNodeCount = 0;
+
 } // namespace Util
 } // namespace RAMCloud
@@ -27,10 +27,16 @@ namespace RAMCloud {
  */
 namespace Util {
 
+bool bindMemoryToNumaNode(void* address, size_t length, int node);
 void clearCpuAffinity(void);
 void genRandomString(char* str, const int length);
 string getCpuAffinityString(void);
+bool getNumaNodeCpus(int node, cpu_set_t* cpuSet);
+int getNumaNodeCount(void);
 string hexDump(const void *buffer, uint64_t bytes);
+bool interleaveMemoryAcrossNumaNodes(void* address, size_t length,
+                                     int numNodes);
+std::vector<int> parseRangeList(const string& list);
 void spinAndCheckGaps(int count);
 bool timespecLess(const struct timespec& t1, const struct timespec& t2);
 bool timespecLessEqual(const struct timespec& t1, const struct timespec& t2);
@@ -38,6 +44,7 @@ struct timespec timespecAdd(const struct timespec& t1,
         const struct timespec& t2);
 
 extern uint64_t mockPmcValue;
+extern int mockNumaNodeCount;
 
 /* Doxygen is stupid and cannot distinguish between attributes and arguments. */
 #define FORCE_INLINE __inline __attribute__((always_inline))
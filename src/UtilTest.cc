@@ -88,6 +88,22 @@ TEST(UtilTest, clearCpuAffinity) {
     }
 }
 
+TEST(UtilTest, getNumaNodeCount) {
+    EXPECT_LE(1, Util::getNumaNodeCount());
+    Util::mockNumaNodeCount = 3;
+    EXPECT_EQ(3, Util::getNumaNodeCount());
+    Util::mockNumaNodeCount = 0;
+}
+
+TEST(UtilTest, parseRangeList) {
+    std::vector<int> v = Util::parseRangeList("0-2,5,7-8\n");
+    EXPECT_EQ("0 1 2 5 7 8", format("%d %d %d %d %d %d",
+            v[0], v[1], v[2], v[3], v[4], v[5]));
+    EXPECT_EQ(6u, v.size());
+    EXPECT_EQ(0u, Util::parseRangeList("").size());
+    EXPECT_EQ(1u, Util::parseRangeList("x,4").size());
+}
+
 TEST(UtilTest, serialReadPmc) {
     Util::mockPmcValue = 1;
     EXPECT_EQ(Util::serialReadPmc(0), 1U);
@@ -22,6 +22,9 @@ namespace RAMCloud {
 
 namespace WireFormat {
 
+// Definitions for static constants that are passed by reference.
+const uint32_t GetWitnesses::MAX_WITNESSES;
+
 /**
  * Returns a string representation of a ServiceType.  Useful for error
  * messages and logging.
@@ -122,6 +125,11 @@ opcodeSymbol(uint32_t opcode)
         case TX_REQUEST_ABORT:             return "TX_REQUEST_ABORT";
         case TX_HINT_FAILED:               return "TX_HINT_FAILED";
         case ECHO:                         return "ECHO";
+        case LOOKUP_INDEX_OBJECTS:         return "LOOKUP_INDEX_OBJECTS";
+        case GET_WITNESSES:                return "GET_WITNESSES";
+        case WITNESS_RECORD:               return "WITNESS_RECORD";
+        case WITNESS_GC:                   return "WITNESS_GC";
+        case WITNESS_GET_RECOVERY_DATA:    return "WITNESS_GET_RECOVERY_DATA";
         case ILLEGAL_RPC_TYPE:             return "ILLEGAL_RPC_TYPE";
     }
 
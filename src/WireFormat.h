@@ -130,7 +130,12 @@ enum Opcode {
     TX_REQUEST_ABORT            = 78,
     TX_HINT_FAILED              = 79,
     ECHO                        = 80,
-    ILLEGAL_RPC_TYPE            = 81, // 1 + the highest legitimate Opcode
+    LOOKUP_INDEX_OBJECTS        = 81,
+    GET_WITNESSES               = 82,
+    WITNESS_RECORD              = 83,
+    WITNESS_GC                  = 84,
+    WITNESS_GET_RECOVERY_DATA   = 85,
+    ILLEGAL_RPC_TYPE            = 86, // 1 + the highest legitimate Opcode
 };
 
 /**
@@ -621,10 +626,27 @@ struct Enumerate {
                                     // (normally the last field of the object)
                                     // is omitted.
         uint64_t tabletFirstHash;
+        uint64_t lastKeyHash;       // Objects whose key hashes exceed this
+                                    // are skipped (~0 to return the whole
+                                    // tablet).
+        uint64_t minVersion;        // Objects with lower versions are
+                                    // skipped (0 to return all of them).
+        uint32_t maxValueBytes;     // At most this many bytes of each
+                                    // object's value are returned; the rest
+                                    // is truncated as with keysOnly.
+        uint16_t keyPrefixLength;   // If nonzero, only objects whose primary
+                                    // keys start with this many bytes, which
+                                    // follow this header, are returned.
+        uint8_t indexId;            // If nonzero, only objects whose
+                                    // secondary key for this index lies
+                                    // within a range are returned; the
+                                    // first and last keys of the range
+                                    // follow the key prefix.
+        uint16_t firstIndexKeyLength;
+        uint16_t lastIndexKeyLength;
         uint32_t iteratorBytes;     // Size of iterator in bytes. The
-                                    // actual iterator follows
-                                    // immediately after this header.
-                                    // See EnumerationIterator.
+                                    // actual iterator follows the above
+                                    // keys. See EnumerationIterator.
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
@@ -851,6 +873,32 @@ struct GetTableConfig {
     } __attribute__((packed));
 };
 
+struct GetWitnesses {
+    static const Opcode opcode = GET_WITNESSES;
+    static const ServiceType service = MASTER_SERVICE;
+    /// Upper limit on numWitnesses in a response.
+    static const uint32_t MAX_WITNESSES = 5;
+    struct Request {
+        RequestCommon common;
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint64_t masterId;            // ServerId of the master that
+                                      // responded.
+        uint32_t numWitnesses;        // Number of Witness entries that
+                                      // follow this header. 0 means the
+                                      // master doesn't accept witnessed
+                                      // writes.
+    } __attribute__((packed));
+    struct Witness {
+        uint64_t serverId;            // Id of a server recording this
+                                      // master's unsynced writes.
+        uint16_t locatorLength;       // Number of bytes in the server's
+                                      // service locator, which follows
+                                      // immediately (no terminating NULL).
+    } __attribute__((packed));
+};
+
 struct HintServerCrashed {
     static const Opcode opcode = HINT_SERVER_CRASHED;
     static const ServiceType service = COORDINATOR_SERVICE;
@@ -1012,6 +1060,41 @@ struct LookupIndexKeys {
     } __attribute__((packed));
 };
 
+struct LookupIndexObjects {
+    static const Opcode opcode = LOOKUP_INDEX_OBJECTS;
+    static const ServiceType service = MASTER_SERVICE;
+
+    struct Request {
+        RequestCommon common;
+        uint64_t tableId;               // Id of the table for the lookup.
+        uint8_t indexId;                // Id of the index for the lookup.
+        uint16_t firstKeyLength;        // Length of first key in bytes.
+        uint64_t firstAllowedKeyHash;   // Smallest primary key hash value
+                                        // allowed for firstKey.
+        uint16_t lastKeyLength;         // Length of last key in bytes.
+        uint32_t maxNumHashes;          // Max number of primary key hashes
+                                        // to be returned.
+        // In buffer: The actual first key and last key go here.
+    } __attribute__((packed));
+
+    struct Response {
+        ResponseCommon common;
+        uint32_t numHashes;     // Number of primary key hashes being returned.
+        uint16_t nextKeyLength; // Length of next key to fetch.
+        uint64_t nextKeyHash;   // Minimum allowed hash corresponding to
+                                // next key to be fetched.
+        uint32_t numHashesRead; // Number of key hashes, starting with the
+                                // first, whose objects are all returned
+                                // (or do not exist).
+        uint32_t numObjects;    // Number of objects being returned.
+        // In buffer: Key hashes of primary keys for matching objects go here.
+        // In buffer: Actual bytes for the next key for which
+        // the client should send another lookup request (if any) goes here.
+        // In buffer: The objects for the first numHashesRead key hashes,
+        // in the same format as the ReadHashes response, go here.
+    } __attribute__((packed));
+};
+
 struct MigrateTablet {
     static const Opcode opcode = MIGRATE_TABLET;
     static const ServiceType service = MASTER_SERVICE;
@@ -1923,6 +2006,67 @@ struct VerifyMembership {
     } __attribute__((packed));
 };
 
+struct WitnessGc {
+    static const Opcode opcode = WITNESS_GC;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t masterId;            // Master whose writes are now durable.
+        uint32_t numEntries;          // Number of Entry structures that
+                                      // follow this header.
+    } __attribute__((packed));
+    struct Entry {
+        uint64_t keyHash;             // Identify one recorded write; see
+        uint64_t clientId;            // WitnessRecord.
+        uint64_t rpcId;
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+    } __attribute__((packed));
+};
+
+struct WitnessGetRecoveryData {
+    static const Opcode opcode = WITNESS_GET_RECOVERY_DATA;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t crashedMasterId;     // Return this master's records; the
+                                      // witness stops accepting new ones.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint32_t numRecords;          // Number of Record structures that
+                                      // follow this header, each followed
+                                      // by requestLength bytes of request.
+    } __attribute__((packed));
+    struct Record {
+        uint64_t keyHash;
+        uint32_t requestLength;
+    } __attribute__((packed));
+};
+
+struct WitnessRecord {
+    static const Opcode opcode = WITNESS_RECORD;
+    static const ServiceType service = BACKUP_SERVICE;
+    struct Request {
+        RequestCommonWithId common;
+        uint64_t masterId;            // Master the write was sent to.
+        uint64_t keyHash;             // Hash of the object's primary key;
+                                      // records for the same hash conflict.
+        uint64_t clientId;            // Lease id and rpc id of the write,
+        uint64_t rpcId;               // used to garbage collect the record.
+        uint32_t requestLength;       // Number of bytes in the master's
+                                      // request (a complete WRITE request),
+                                      // which follows immediately.
+    } __attribute__((packed));
+    struct Response {
+        ResponseCommon common;
+        uint8_t accepted;             // 0 means the record conflicted with
+                                      // another or there was no room; the
+                                      // client must make the master sync.
+    } __attribute__((packed));
+};
+
 struct Write {
     static const Opcode opcode = WRITE;
     static const ServiceType service = MASTER_SERVICE;
@@ -1936,7 +2080,10 @@ struct Write {
                                       // keysAndValue blob in bytes.These
                                       // follow immediately after this header
         RejectRules rejectRules;
-        uint8_t async;
+        uint8_t async;                // Nonzero means the master may reply
+                                      // before the write is replicated;
+                                      // clients set this when the write is
+                                      // also recorded on witnesses.
     } __attribute__((packed));
     struct Response {
         ResponseCommon common;
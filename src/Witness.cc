@@ -0,0 +1,157 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "Witness.h"
+#include "WireFormat.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty Witness.
+ *
+ * \param numSlots
+ *      Maximum number of records to hold at once; rounded up to a
+ *      multiple of #ASSOCIATIVITY.
+ */
+Witness::Witness(uint32_t numSlots)
+    : slots()
+    , numSets((numSlots + ASSOCIATIVITY - 1) / ASSOCIATIVITY)
+    , numRecords(0)
+    , frozen(false)
+{
+    if (numSets == 0)
+        numSets = 1;
+    slots.resize(numSets * ASSOCIATIVITY);
+}
+
+/**
+ * Record a write that a client has sent to the master.
+ *
+ * \param keyHash
+ *      Hash of the written object's primary key.
+ * \param clientId
+ *      Lease id of the client that issued the write.
+ * \param rpcId
+ *      The client's id for the write.
+ * \param request
+ *      The complete WRITE request sent to the master; it is copied.
+ * \param length
+ *      Number of bytes in \a request.
+ * \return
+ *      True means the write is now recorded (or already was). False means
+ *      that another write to the same key hash is recorded, that there was
+ *      no room, or that the master has crashed; the client must not rely
+ *      on this witness for the write.
+ */
+bool
+Witness::record(uint64_t keyHash, uint64_t clientId, uint64_t rpcId,
+        const void* request, uint32_t length)
+{
+    if (frozen)
+        return false;
+
+    Record* set = getSet(keyHash);
+    Record* free = NULL;
+    for (uint32_t i = 0; i < ASSOCIATIVITY; i++) {
+        Record* record = &set[i];
+        if (!record->occupied) {
+            if (free == NULL)
+                free = record;
+            continue;
+        }
+        if (record->keyHash == keyHash) {
+            // A retry of the same write is fine; anything else conflicts.
+            return record->clientId == clientId && record->rpcId == rpcId;
+        }
+    }
+    if (free == NULL)
+        return false;
+
+    free->occupied = true;
+    free->keyHash = keyHash;
+    free->clientId = clientId;
+    free->rpcId = rpcId;
+    free->request.assign(static_cast<const char*>(request), length);
+    numRecords++;
+    return true;
+}
+
+/**
+ * Drop the record for a write, once the master has made it durable. This
+ * is a no-op if the record isn't present.
+ *
+ * \param keyHash
+ *      Hash of the written object's primary key.
+ * \param clientId
+ *      Lease id of the client that issued the write.
+ * \param rpcId
+ *      The client's id for the write.
+ */
+void
+Witness::gc(uint64_t keyHash, uint64_t clientId, uint64_t rpcId)
+{
+    Record* set = getSet(keyHash);
+    for (uint32_t i = 0; i < ASSOCIATIVITY; i++) {
+        Record* record = &set[i];
+        if (record->occupied && record->keyHash == keyHash &&
+                record->clientId == clientId && record->rpcId == rpcId) {
+            record->occupied = false;
+            record->request.clear();
+            numRecords--;
+            return;
+        }
+    }
+}
+
+/**
+ * Append every record to an outgoing WITNESS_GET_RECOVERY_DATA response,
+ * each as a WireFormat::WitnessGetRecoveryData::Record followed by the
+ * write's request. After this the witness accepts no new records.
+ *
+ * \param response
+ *      Records are appended here.
+ * \return
+ *      The number of records appended.
+ */
+uint32_t
+Witness::getRecoveryData(Buffer* response)
+{
+    frozen = true;
+    uint32_t count = 0;
+    foreach (const Record& record, slots) {
+        if (!record.occupied)
+            continue;
+        WireFormat::WitnessGetRecoveryData::Record* header =
+                response->emplaceAppend<
+                WireFormat::WitnessGetRecoveryData::Record>();
+        header->keyHash = record.keyHash;
+        header->requestLength = downCast<uint32_t>(record.request.size());
+        response->appendCopy(record.request.data(), header->requestLength);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Return the first record of the set that holds a given key hash.
+ */
+Witness::Record*
+Witness::getSet(uint64_t keyHash)
+{
+    return &slots[(keyHash % numSets) * ASSOCIATIVITY];
+}
+
+} // namespace RAMCloud
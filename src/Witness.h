@@ -0,0 +1,112 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_WITNESS_H
+#define RAMCLOUD_WITNESS_H
+
+#include "Common.h"
+#include "Buffer.h"
+
+namespace RAMCloud {
+
+/**
+ * Holds the writes that clients have recorded for one master while the
+ * master may not yet have replicated them. Clients send a write to its
+ * master and, in parallel, to each of the master's witnesses; the master
+ * replies before syncing its log, so the write completes in one round
+ * trip as long as every witness accepts the record. If the master crashes,
+ * recovery replays the records to recreate writes that never made it to
+ * backups. Once the master has synced a write it tells its witnesses to
+ * drop the record (see #gc).
+ *
+ * Records are only kept for writes that commute with one another: a
+ * record is rejected if one for the same key hash is already present,
+ * in which case the client has the master sync before completing. Records
+ * live in a fixed-size, set-associative table indexed by key hash, so a
+ * witness also rejects records when the set for a key hash is full.
+ *
+ * This class is not thread-safe; BackupService serializes access.
+ */
+class Witness {
+  public:
+    /// A write recorded by a client.
+    struct Record {
+        Record()
+            : occupied(false), keyHash(0), clientId(0), rpcId(0), request()
+        {}
+
+        /// False means this slot is free.
+        bool occupied;
+
+        /// Hash of the written object's primary key.
+        uint64_t keyHash;
+
+        /// Client lease id and RPC id of the write.
+        uint64_t clientId;
+        uint64_t rpcId;
+
+        /// The complete WRITE request sent to the master.
+        string request;
+    };
+
+    /// Number of records in each set of the table.
+    static const uint32_t ASSOCIATIVITY = 4;
+
+    explicit Witness(uint32_t numSlots);
+    bool record(uint64_t keyHash, uint64_t clientId, uint64_t rpcId,
+            const void* request, uint32_t length);
+    void gc(uint64_t keyHash, uint64_t clientId, uint64_t rpcId);
+    uint32_t getRecoveryData(Buffer* response);
+
+    /// Return the number of records currently held.
+    uint32_t
+    getNumRecords() const
+    {
+        return numRecords;
+    }
+
+    /// Return true once recovery has started for the master; see
+    /// #getRecoveryData.
+    bool
+    isFrozen() const
+    {
+        return frozen;
+    }
+
+  PRIVATE:
+    Record* getSet(uint64_t keyHash);
+
+    /// Slots for records; each group of #ASSOCIATIVITY consecutive entries
+    /// forms a set.
+    std::vector<Record> slots;
+
+    /// Number of sets in #slots.
+    uint32_t numSets;
+
+    /// Number of occupied entries in #slots.
+    uint32_t numRecords;
+
+    /// Set once the master has crashed and recovery has fetched the
+    /// records; no new records are accepted after that, since they could
+    /// be missed by the recovery.
+    bool frozen;
+
+    DISALLOW_COPY_AND_ASSIGN(Witness);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_WITNESS_H
@@ -0,0 +1,79 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "WitnessCache.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct an empty WitnessCache.
+ */
+WitnessCache::WitnessCache()
+    : lists()
+{
+}
+
+/**
+ * Return the witnesses of a master, if they are known.
+ *
+ * \param masterId
+ *      Master whose witnesses are wanted.
+ * \param[out] witnesses
+ *      Filled in with the master's witnesses if the return value is true;
+ *      empty means the master doesn't accept witnessed writes.
+ * \return
+ *      False means nothing is cached for the master; the caller should
+ *      ask it with GET_WITNESSES.
+ */
+bool
+WitnessCache::lookup(ServerId masterId, WitnessList* witnesses)
+{
+    auto it = lists.find(masterId.getId());
+    if (it == lists.end())
+        return false;
+    *witnesses = it->second;
+    return true;
+}
+
+/**
+ * Remember the witnesses of a master, replacing any list already cached
+ * for it.
+ *
+ * \param masterId
+ *      Master whose witnesses are given.
+ * \param witnesses
+ *      The master's witnesses, as returned by GET_WITNESSES.
+ */
+void
+WitnessCache::insert(ServerId masterId, const WitnessList& witnesses)
+{
+    lists[masterId.getId()] = witnesses;
+}
+
+/**
+ * Forget the witnesses of a master, typically because one of them could
+ * not be reached.
+ *
+ * \param masterId
+ *      Master whose witness list should be discarded.
+ */
+void
+WitnessCache::invalidate(ServerId masterId)
+{
+    lists.erase(masterId.getId());
+}
+
+} // namespace RAMCloud
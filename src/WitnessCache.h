@@ -0,0 +1,68 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_WITNESSCACHE_H
+#define RAMCLOUD_WITNESSCACHE_H
+
+#include <unordered_map>
+
+#include "ServerId.h"
+
+namespace RAMCloud {
+
+/**
+ * Remembers, for each master a client has written to, which servers act as
+ * that master's witnesses. WriteRpc records each write on all of them in
+ * parallel with sending it to the master, which lets the master reply
+ * before the write has been replicated. Lists are fetched from masters with
+ * GET_WITNESSES and dropped when a witness can't be reached, so that the
+ * next write fetches a fresh one.
+ *
+ * Like RamCloud objects, this class is not thread-safe.
+ */
+class WitnessCache {
+  public:
+    /// Identifies one witness.
+    struct Witness {
+        Witness(ServerId serverId, const string& locator)
+            : serverId(serverId)
+            , locator(locator)
+        {}
+
+        /// Id of the witness server.
+        ServerId serverId;
+
+        /// Service locator for the witness server.
+        string locator;
+    };
+    typedef std::vector<Witness> WitnessList;
+
+    WitnessCache();
+    bool lookup(ServerId masterId, WitnessList* witnesses);
+    void insert(ServerId masterId, const WitnessList& witnesses);
+    void invalidate(ServerId masterId);
+
+  PRIVATE:
+    /// Witness lists, keyed by master id. An empty list means the master
+    /// doesn't accept witnessed writes.
+    std::unordered_map<uint64_t, WitnessList> lists;
+
+    DISALLOW_COPY_AND_ASSIGN(WitnessCache);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_WITNESSCACHE_H
@@ -0,0 +1,229 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "WitnessManager.h"
+#include "BackupClient.h"
+#include "ClientException.h"
+#include "Context.h"
+#include "ServerList.h"
+#include "ShortMacros.h"
+
+namespace RAMCloud {
+
+/**
+ * Construct a WitnessManager.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server.
+ * \param masterId
+ *      The id of the master this object belongs to; read whenever needed,
+ *      since it isn't known until the master enlists.
+ * \param numWitnesses
+ *      Number of witnesses clients should record writes on; 0 disables
+ *      witnessed writes. Limited to
+ *      WireFormat::GetWitnesses::MAX_WITNESSES.
+ */
+WitnessManager::WitnessManager(Context* context, const ServerId* masterId,
+        uint32_t numWitnesses)
+    : context(context)
+    , masterId(masterId)
+    , numWitnesses(std::min(numWitnesses,
+            WireFormat::GetWitnesses::MAX_WITNESSES))
+    , mutex("WitnessManager")
+    , witnesses()
+    , pendingGc()
+    , flushing(false)
+{
+}
+
+/**
+ * Append the master's witnesses to an outgoing GET_WITNESSES response,
+ * each as a WireFormat::GetWitnesses::Witness followed by its service
+ * locator. The witnesses are chosen the first time this is called.
+ *
+ * \param response
+ *      The witnesses are appended here.
+ * \return
+ *      The number of witnesses appended: 0 if witnessed writes are
+ *      disabled or there aren't enough servers to act as witnesses.
+ */
+uint32_t
+WitnessManager::getWitnesses(Buffer* response)
+{
+    if (!isEnabled())
+        return 0;
+    Lock lock(mutex);
+    chooseWitnesses(lock);
+    if (witnesses.size() < numWitnesses)
+        return 0;
+    foreach (ServerId id, witnesses) {
+        string locator = context->serverList->getLocator(id);
+        WireFormat::GetWitnesses::Witness* witness =
+                response->emplaceAppend<WireFormat::GetWitnesses::Witness>();
+        witness->serverId = id.getId();
+        witness->locatorLength = downCast<uint16_t>(locator.size());
+        response->appendCopy(locator.data(), witness->locatorLength);
+    }
+    return downCast<uint32_t>(witnesses.size());
+}
+
+/**
+ * Invoked once a write that may have been recorded on the witnesses is
+ * durable. The witnesses are told to drop the record, along with any
+ * others that have become durable in the meantime; this may block while
+ * that happens, so the caller should have replied to its client already.
+ *
+ * \param keyHash
+ *      Hash of the written object's primary key.
+ * \param clientId
+ *      Lease id of the client that issued the write.
+ * \param rpcId
+ *      The client's id for the write.
+ */
+void
+WitnessManager::synced(uint64_t keyHash, uint64_t clientId, uint64_t rpcId)
+{
+    Lock lock(mutex);
+    if (witnesses.empty())
+        return;
+    pendingGc.push_back({keyHash, clientId, rpcId});
+    if (flushing)
+        return;
+
+    // Send batches until there's nothing left; entries added by other
+    // threads while we are waiting for the witnesses go in the next batch.
+    flushing = true;
+    while (!pendingGc.empty() && !witnesses.empty()) {
+        std::vector<WireFormat::WitnessGc::Entry> batch;
+        batch.swap(pendingGc);
+        std::vector<ServerId> targets(witnesses);
+        std::vector<ServerId> failed;
+        lock.unlock();
+
+        Tub<WitnessGcRpc> rpcs[WireFormat::GetWitnesses::MAX_WITNESSES];
+        for (size_t i = 0; i < targets.size(); i++)
+            rpcs[i].construct(context, targets[i], *masterId, batch);
+        for (size_t i = 0; i < targets.size(); i++) {
+            try {
+                rpcs[i]->wait();
+            } catch (const ServerNotUpException& e) {
+                failed.push_back(targets[i]);
+            }
+        }
+
+        lock.lock();
+        foreach (ServerId id, failed) {
+            LOG(NOTICE, "Witness %s is no longer up; replacing it",
+                id.toString().c_str());
+            witnesses.erase(std::remove(witnesses.begin(), witnesses.end(),
+                    id), witnesses.end());
+        }
+        if (!failed.empty())
+            chooseWitnesses(lock);
+    }
+    flushing = false;
+}
+
+/**
+ * Collect the writes recorded on witnesses for a crashed master. Since
+ * the crashed master's witnesses aren't known, every backup is asked;
+ * those that weren't its witnesses return nothing.
+ *
+ * \param context
+ *      Overall information about the RAMCloud server.
+ * \param crashedMasterId
+ *      The master being recovered.
+ * \param[out] requests
+ *      The recorded WRITE requests are appended here. A write may appear
+ *      more than once (once for each witness that recorded it).
+ */
+void
+WitnessManager::getRecoveryData(Context* context, ServerId crashedMasterId,
+        std::vector<string>* requests)
+{
+    std::vector<ServerId> servers;
+    bool end = false;
+    ServerId id;
+    while (true) {
+        id = context->serverList->nextServer(id,
+                {WireFormat::BACKUP_SERVICE}, &end);
+        if (end || !id.isValid())
+            break;
+        servers.push_back(id);
+    }
+
+    std::vector<std::unique_ptr<Buffer>> responses;
+    std::vector<std::unique_ptr<WitnessGetRecoveryDataRpc>> rpcs;
+    foreach (ServerId server, servers) {
+        responses.emplace_back(new Buffer());
+        rpcs.emplace_back(new WitnessGetRecoveryDataRpc(context, server,
+                crashedMasterId, responses.back().get()));
+    }
+    for (size_t i = 0; i < rpcs.size(); i++) {
+        uint32_t numRecords;
+        try {
+            numRecords = rpcs[i]->wait();
+        } catch (const ClientException& e) {
+            // Either the server has crashed (it's OK to lose the records
+            // of f-1 of the f witnesses) or it isn't a witness at all.
+            continue;
+        }
+        Buffer* response = responses[i].get();
+        uint32_t offset = 0;
+        for (uint32_t j = 0; j < numRecords; j++) {
+            const WireFormat::WitnessGetRecoveryData::Record* record =
+                    response->getOffset<
+                    WireFormat::WitnessGetRecoveryData::Record>(offset);
+            if (record == NULL)
+                throw MessageTooShortError(HERE);
+            offset += sizeof32(*record);
+            const char* request = static_cast<const char*>(
+                    response->getRange(offset, record->requestLength));
+            if (request == NULL)
+                throw MessageTooShortError(HERE);
+            requests->emplace_back(request, record->requestLength);
+            offset += record->requestLength;
+        }
+    }
+}
+
+/**
+ * Fill #witnesses up to #numWitnesses, choosing backups (other than this
+ * master) that are up and not already witnesses.
+ *
+ * \param lock
+ *      Ensures that the caller holds #mutex.
+ */
+void
+WitnessManager::chooseWitnesses(Lock& lock)
+{
+    if (witnesses.size() >= numWitnesses)
+        return;
+    bool end = false;
+    ServerId id;
+    while (witnesses.size() < numWitnesses) {
+        id = context->serverList->nextServer(id,
+                {WireFormat::BACKUP_SERVICE}, &end);
+        if (end || !id.isValid())
+            break;
+        if (id == *masterId || std::find(witnesses.begin(), witnesses.end(),
+                id) != witnesses.end())
+            continue;
+        witnesses.push_back(id);
+    }
+}
+
+} // namespace RAMCloud
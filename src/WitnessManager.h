@@ -0,0 +1,93 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#ifndef RAMCLOUD_WITNESSMANAGER_H
+#define RAMCLOUD_WITNESSMANAGER_H
+
+#include <mutex>
+
+#include "Common.h"
+#include "Buffer.h"
+#include "ServerId.h"
+#include "SpinLock.h"
+#include "WireFormat.h"
+
+namespace RAMCloud {
+
+class Context;
+
+/**
+ * A master's view of its witnesses: the servers (backups) on which clients
+ * record writes that the master has acknowledged but may not yet have
+ * replicated; see Witness. This class picks the witnesses, tells clients
+ * who they are (GET_WITNESSES), and tells the witnesses when recorded
+ * writes have become durable so they can drop the records. It also
+ * gathers the records of a crashed master for recovery.
+ *
+ * A witness that crashes is replaced; clients that still send records to
+ * it fail to reach it, fall back to having the master sync, and fetch the
+ * new list.
+ */
+class WitnessManager {
+  public:
+    WitnessManager(Context* context, const ServerId* masterId,
+            uint32_t numWitnesses);
+    uint32_t getWitnesses(Buffer* response);
+    void synced(uint64_t keyHash, uint64_t clientId, uint64_t rpcId);
+    static void getRecoveryData(Context* context, ServerId crashedMasterId,
+            std::vector<string>* requests);
+
+    /// Return true if this master accepts witnessed writes.
+    bool
+    isEnabled() const
+    {
+        return numWitnesses > 0;
+    }
+
+  PRIVATE:
+    typedef std::unique_lock<SpinLock> Lock;
+    void chooseWitnesses(Lock& lock);
+
+    /// Shared RAMCloud information.
+    Context* context;
+
+    /// The id of the master this object belongs to; may not be valid until
+    /// the master has enlisted.
+    const ServerId* masterId;
+
+    /// Number of witnesses to use; 0 disables witnessed writes.
+    const uint32_t numWitnesses;
+
+    /// Protects all of the members below.
+    SpinLock mutex;
+
+    /// The current witnesses. Empty until a client first asks for them.
+    std::vector<ServerId> witnesses;
+
+    /// Writes that are durable but whose records may still be held by
+    /// the witnesses.
+    std::vector<WireFormat::WitnessGc::Entry> pendingGc;
+
+    /// True means some thread is sending #pendingGc to the witnesses;
+    /// other threads just add to it.
+    bool flushing;
+
+    DISALLOW_COPY_AND_ASSIGN(WitnessManager);
+};
+
+} // namespace RAMCloud
+
+#endif // RAMCLOUD_WITNESSMANAGER_H
@@ -0,0 +1,118 @@
+/* Copyright (c) 2026 Stanford University
+ *
+ * Permission to use, copy, modify, and distribute this software for any
+ * purpose with or without fee is hereby granted, provided that the above
+ * copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR(S) DISCLAIM ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL AUTHORS BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+
+#include "TestUtil.h"
+#include "Witness.h"
+#include "WireFormat.h"
+
+namespace RAMCloud {
+
+class WitnessTest : public ::testing::Test {
+  public:
+    Witness witness;
+
+    WitnessTest()
+        : witness(8)
+    {}
+
+    DISALLOW_COPY_AND_ASSIGN(WitnessTest);
+};
+
+TEST_F(WitnessTest, constructor) {
+    EXPECT_EQ(8u, witness.slots.size());
+    EXPECT_EQ(2u, witness.numSets);
+    EXPECT_EQ(4u, Witness(1).slots.size());
+}
+
+TEST_F(WitnessTest, record) {
+    EXPECT_TRUE(witness.record(2, 1, 10, "abc", 3));
+    EXPECT_EQ(1u, witness.getNumRecords());
+    Witness::Record* set = witness.getSet(2);
+    EXPECT_TRUE(set[0].occupied);
+    EXPECT_EQ(2u, set[0].keyHash);
+    EXPECT_EQ(1u, set[0].clientId);
+    EXPECT_EQ(10u, set[0].rpcId);
+    EXPECT_EQ("abc", set[0].request);
+}
+
+TEST_F(WitnessTest, record_sameKeyHash) {
+    EXPECT_TRUE(witness.record(2, 1, 10, "abc", 3));
+    // A retransmission of the same write is fine...
+    EXPECT_TRUE(witness.record(2, 1, 10, "abc", 3));
+    // ... but another write of the same object isn't.
+    EXPECT_FALSE(witness.record(2, 1, 11, "def", 3));
+    EXPECT_FALSE(witness.record(2, 2, 10, "def", 3));
+    EXPECT_EQ(1u, witness.getNumRecords());
+}
+
+TEST_F(WitnessTest, record_setFull) {
+    for (uint64_t keyHash = 0; keyHash < 8; keyHash += 2)
+        EXPECT_TRUE(witness.record(keyHash, 1, keyHash + 1, "x", 1));
+    EXPECT_FALSE(witness.record(8, 1, 20, "x", 1));
+    EXPECT_TRUE(witness.record(9, 1, 21, "x", 1));
+    EXPECT_EQ(5u, witness.getNumRecords());
+}
+
+TEST_F(WitnessTest, record_frozen) {
+    Buffer buffer;
+    witness.getRecoveryData(&buffer);
+    EXPECT_FALSE(witness.record(2, 1, 10, "abc", 3));
+    EXPECT_EQ(0u, witness.getNumRecords());
+}
+
+TEST_F(WitnessTest, gc) {
+    witness.record(2, 1, 10, "abc", 3);
+    witness.record(4, 1, 11, "def", 3);
+
+    // Doesn't match the record.
+    witness.gc(2, 1, 11);
+    EXPECT_EQ(2u, witness.getNumRecords());
+
+    witness.gc(2, 1, 10);
+    EXPECT_EQ(1u, witness.getNumRecords());
+    EXPECT_FALSE(witness.getSet(2)[0].occupied);
+    EXPECT_TRUE(witness.record(2, 1, 12, "ghi", 3));
+
+    // Already gone.
+    witness.gc(2, 1, 10);
+    EXPECT_EQ(2u, witness.getNumRecords());
+}
+
+TEST_F(WitnessTest, getRecoveryData) {
+    witness.record(2, 1, 10, "abc", 3);
+    witness.record(3, 1, 11, "defg", 4);
+    Buffer buffer;
+    EXPECT_EQ(2u, witness.getRecoveryData(&buffer));
+    EXPECT_TRUE(witness.isFrozen());
+
+    uint32_t offset = 0;
+    std::set<string> requests;
+    for (int i = 0; i < 2; i++) {
+        const WireFormat::WitnessGetRecoveryData::Record* record =
+                buffer.getOffset<WireFormat::WitnessGetRecoveryData::Record>(
+                offset);
+        offset += downCast<uint32_t>(sizeof(*record));
+        requests.insert(string(static_cast<const char*>(
+                buffer.getRange(offset, record->requestLength)),
+                record->requestLength));
+        offset += record->requestLength;
+    }
+    EXPECT_EQ(buffer.size(), offset);
+    EXPECT_EQ(1u, requests.count("abc"));
+    EXPECT_EQ(1u, requests.count("defg"));
+}
+
+}  // namespace RAMCloud
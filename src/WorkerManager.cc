@@ -73,6 +73,11 @@ Syscall* WorkerManager::sys = &defaultSyscall;
 // time it takes to wake up the thread once it has gone to sleep (as of
 // September 2011 this time appears to be as much as 50 microseconds).
 int WorkerManager::pollMicros = 10000;
+
+// Long RPCs will not be passed over in favor of short ones for longer than
+// this; it bounds the extra delay that shortest-expected-first scheduling
+// can impose on long RPCs.
+int WorkerManager::maxLongDeferralMicros = 1000;
 // The following constant is used to signal a worker thread that
 // it should exit.
 #define WORKER_EXIT reinterpret_cast<Transport::ServerRpc*>(1)
@@ -96,6 +101,8 @@ WorkerManager::WorkerManager(Context* context, uint32_t maxCores)
     , idleThreads()
     , maxCores(maxCores)
     , rpcsWaiting(0)
+    , longRpcsRunning(0)
+    , maxLongRpcs(std::max(maxCores, 2u) - 1)
     , testingSaveRpcs(0)
     , testRpcs()
 {
@@ -199,7 +206,12 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
         return;
     }
 
-    int level = RpcLevel::getLevel(WireFormat::Opcode(header->opcode));
+    WaitingRpc waiting;
+    waiting.rpc = rpc;
+    waiting.opcode = WireFormat::Opcode(header->opcode);
+    waiting.longRpc = isLongRpc(waiting.opcode, rpc->requestPayload.size());
+    waiting.arrivalTime = Cycles::rdtsc();
+    int level = RpcLevel::getLevel(waiting.opcode);
     timeTrace("handleRpc processing opcode %d", header->opcode);
 #ifdef LOG_RPCS
     LOG(NOTICE, "Received %s RPC at %lu with %u bytes",
@@ -216,12 +228,15 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
     // occur if all of the servers use up all of their threads on high-level
     // requests, then those requests invoke lower-level RPCs to other
     // servers, but none of the servers have threads to execute those
-    // lower-level requests).
-    if (busyThreads.size() >= maxCores) {
+    // lower-level requests). Long requests are also deferred (subject to
+    // the same deadlock constraint) once maxLongRpcs of them are running,
+    // so that short requests don't wait for cores behind them.
+    if ((busyThreads.size() >= maxCores) ||
+            (waiting.longRpc && (longRpcsRunning >= maxLongRpcs))) {
         for (int i = level; i >= 0; i--) {
             if (levels[i].requestsRunning > 0) {
                 // Can't run this request right now.
-                levels[level].waitingRpcs.push(rpc);
+                levels[level].waitingRpcs.push(waiting);
                 rpcsWaiting++;
                 timeTrace("RPC deferred; threads busy");
                 return;
@@ -247,13 +262,74 @@ WorkerManager::handleRpc(Transport::ServerRpc* rpc)
     assert(!idleThreads.empty());
     Worker* worker = idleThreads.back();
     idleThreads.pop_back();
-    worker->opcode = WireFormat::Opcode(header->opcode);
-    worker->level = level;
-    worker->handoff(rpc);
+    startRpc(worker, level, waiting);
     worker->busyIndex = downCast<int>(busyThreads.size());
     busyThreads.push_back(worker);
 }
 
+/**
+ * Decide whether an RPC is likely to take much longer to execute than a
+ * typical read or write; the scheduler uses this to keep short RPCs from
+ * waiting behind long ones.
+ *
+ * \param opcode
+ *      Opcode of the RPC.
+ * \param requestLength
+ *      Total size of the RPC's request message.
+ * \return
+ *      True means the RPC is expected to be long.
+ */
+bool
+WorkerManager::isLongRpc(WireFormat::Opcode opcode, uint32_t requestLength)
+{
+    if (requestLength >= LONG_REQUEST_BYTES) {
+        return true;
+    }
+    switch (opcode) {
+        case WireFormat::BACKUP_GETRECOVERYDATA:
+        case WireFormat::ENUMERATE:
+        case WireFormat::FILL_WITH_TEST_DATA:
+        case WireFormat::LOOKUP_INDEX_KEYS:
+        case WireFormat::LOOKUP_INDEX_OBJECTS:
+        case WireFormat::MIGRATE_TABLET:
+        case WireFormat::MULTI_OP:
+        case WireFormat::READ_HASHES:
+        case WireFormat::RECEIVE_MIGRATION_DATA:
+        case WireFormat::SPLIT_AND_MIGRATE_INDEXLET:
+        case WireFormat::WITNESS_GET_RECOVERY_DATA:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Hand off an RPC to an idle worker, and record how long it waited.
+ * The caller must already have incremented requestsRunning for the
+ * RPC's level.
+ *
+ * \param worker
+ *      Idle worker that will execute the RPC.
+ * \param level
+ *      RpcLevel of the RPC.
+ * \param waiting
+ *      Describes the RPC.
+ */
+void
+WorkerManager::startRpc(Worker* worker, int level, const WaitingRpc& waiting)
+{
+    worker->opcode = waiting.opcode;
+    worker->level = level;
+    worker->longRpc = waiting.longRpc;
+    if (waiting.longRpc) {
+        longRpcsRunning++;
+    }
+    PerfStats::threadStats.rpcQueueCycles[waiting.opcode] +=
+            Cycles::rdtsc() - waiting.arrivalTime;
+    PerfStats::threadStats.rpcQueueCount[waiting.opcode]++;
+    worker->handoff(waiting.rpc);
+}
+
 /**
  * Returns true if there are currently no RPCs being serviced, false
  * if at least one RPC is currently being executed by a worker.  If true
@@ -302,6 +378,10 @@ WorkerManager::poll()
         bool startedNewRpc = false;
         if (state != Worker::POSTPROCESSING) {
             levels[worker->level].requestsRunning--;
+            if (worker->longRpc) {
+                longRpcsRunning--;
+                worker->longRpc = false;
+            }
             if (rpcsWaiting) {
                 // Start an RPC with the lowest level (this is most efficient,
                 // since it's more likely that there are other servers with
@@ -310,27 +390,31 @@ WorkerManager::poll()
                 // In addition, we must observe the core limits, which means
                 // we don't start another RPC unless we have spare cores, or
                 // unless the RPC we would start is at a level lower than any
-                // other running RPC.
-                for (int i = 0; ; i++) {
+                // other running RPC. Long RPCs are subject to a similar
+                // limit (maxLongRpcs).
+                bool lowerLevelRunning = false;
+                for (int i = 0; i < downCast<int>(levels.size()); i++) {
                     Level* level = &levels[i];
-                    if ((level->requestsRunning != 0) &&
-                            // Note: we haven't yet removed the current
-                            // thread from busyThreads, so the number of
-                            // running workers is one less than
-                            // busyThreads.size().
-                            (busyThreads.size() > maxCores)) {
-                        // Can't start another RPC without exceeding core
-                        // limits.
-                        break;
+                    if (level->requestsRunning != 0) {
+                        // Note: we haven't yet removed the current
+                        // thread from busyThreads, so the number of
+                        // running workers is one less than
+                        // busyThreads.size().
+                        if (busyThreads.size() > maxCores) {
+                            // Can't start another RPC without exceeding
+                            // core limits.
+                            break;
+                        }
+                        lowerLevelRunning = true;
                     }
-                    if (level->waitingRpcs.empty()) {
+                    WaitingRpc waiting;
+                    if (!level->waitingRpcs.pop(!lowerLevelRunning ||
+                            (longRpcsRunning < maxLongRpcs), &waiting)) {
                         continue;
                     }
                     rpcsWaiting--;
                     level->requestsRunning++;
-                    worker->level = i;
-                    worker->handoff(level->waitingRpcs.front());
-                    level->waitingRpcs.pop();
+                    startRpc(worker, i, waiting);
                     startedNewRpc = true;
                     break;
                 }
@@ -515,6 +599,53 @@ Worker::exit()
     exited = true;
 }
 
+/**
+ * Remove the next RPC to execute from a WaitingQueue. Short RPCs are
+ * preferred over long ones, unless the oldest long RPC has already been
+ * passed over for more than maxLongDeferralMicros.
+ *
+ * \param allowLong
+ *      False means only short RPCs may be returned.
+ * \param[out] result
+ *      Filled in with information about the RPC to execute.
+ * \return
+ *      True means an RPC was removed from the queue; false means there is
+ *      no suitable RPC.
+ */
+bool
+WorkerManager::WaitingQueue::pop(bool allowLong, WaitingRpc* result)
+{
+    bool useLong = false;
+    if (allowLong && !longRpcs.empty()) {
+        useLong = shortRpcs.empty() ||
+                (Cycles::rdtsc() - longRpcs.front().arrivalTime >
+                Cycles::fromMicroseconds(maxLongDeferralMicros));
+    }
+    std::deque<WaitingRpc>* queue = useLong ? &longRpcs : &shortRpcs;
+    if (queue->empty()) {
+        return false;
+    }
+    *result = queue->front();
+    queue->pop_front();
+    return true;
+}
+
+/**
+ * Add an RPC to a WaitingQueue.
+ *
+ * \param waiting
+ *      Describes the RPC.
+ */
+void
+WorkerManager::WaitingQueue::push(const WaitingRpc& waiting)
+{
+    if (waiting.longRpc) {
+        longRpcs.push_back(waiting);
+    } else {
+        shortRpcs.push_back(waiting);
+    }
+}
+
 /**
  * This method is invoked by the dispatch thread to pass an RPC to an idle
  * worker.  It should only be invoked when the worker is idle (i.e. #rpc is
@@ -16,6 +16,7 @@
 #ifndef RAMCLOUD_WORKERMANAGER_H
 #define RAMCLOUD_WORKERMANAGER_H
 
+#include <deque>
 #include <queue>
 
 #include "Dispatch.h"
@@ -60,9 +61,67 @@ class WorkerManager : Dispatch::Poller {
     /// testing.
     static int pollMicros;
 
+    /// How long (in microseconds) an RPC that is expected to be long
+    /// (see isLongRpc) may be passed over in favor of shorter RPCs at the
+    /// same level before it is started ahead of them. The value of this
+    /// variable is typically not modified except during testing.
+    static int maxLongDeferralMicros;
+
+    /// Requests at least this large are considered long regardless of
+    /// their opcode (see isLongRpc).
+    static const uint32_t LONG_REQUEST_BYTES = 16384;
+
     /// Shared RAMCloud information.
     Context* context;
 
+    /// Describes an RPC that is waiting for a worker thread.
+    struct WaitingRpc {
+        /// The RPC to execute.
+        Transport::ServerRpc* rpc;
+
+        /// Opcode of the RPC (copied from its header).
+        WireFormat::Opcode opcode;
+
+        /// True means the RPC is expected to take a long time (see
+        /// isLongRpc).
+        bool longRpc;
+
+        /// Cycles::rdtsc time when handleRpc was invoked for the RPC;
+        /// used to compute queueing delay.
+        uint64_t arrivalTime;
+    };
+
+    /**
+     * Holds the RPCs at one level that are waiting for worker threads.
+     * RPCs are started shortest-expected-first: RPCs that are expected
+     * to be short are started before those expected to be long, so that
+     * short requests don't wait behind long ones; otherwise RPCs are
+     * started in arrival order.
+     */
+    class WaitingQueue {
+      public:
+        WaitingQueue()
+            : shortRpcs()
+            , longRpcs()
+        {}
+        bool empty() const
+        {
+            return shortRpcs.empty() && longRpcs.empty();
+        }
+        size_t size() const
+        {
+            return shortRpcs.size() + longRpcs.size();
+        }
+        bool pop(bool allowLong, WaitingRpc* result);
+        void push(const WaitingRpc& waiting);
+
+        /// RPCs not expected to take long, in arrival order.
+        std::deque<WaitingRpc> shortRpcs;
+
+        /// RPCs expected to take a long time, in arrival order.
+        std::deque<WaitingRpc> longRpcs;
+    };
+
     // This class (along with the levels variable) stores information
     // for each of the levels defined by RpcLevel; if we run low on threads
     // for servicing RPCs, we queue RPCs according to their level.
@@ -70,8 +129,7 @@ class WorkerManager : Dispatch::Poller {
       public:
         int requestsRunning;           /// The number of RPCs at this level
                                        /// that are currently executing.
-        std::queue<Transport::ServerRpc*> waitingRpcs;
-                                       /// Requests that cannot execute until
+        WaitingQueue waitingRpcs;      /// Requests that cannot execute until
                                        /// a thread becomes available.
         explicit Level()
             : requestsRunning(0)
@@ -97,6 +155,15 @@ class WorkerManager : Dispatch::Poller {
     // Total number of RPCs (across all Levels) in waitingRpcs queues.
     int rpcsWaiting;
 
+    // Number of workers currently executing RPCs for which isLongRpc
+    // returned true.
+    uint32_t longRpcsRunning;
+
+    // Long RPCs are deferred once this many of them are running (unless
+    // that could cause distributed deadlock), which keeps at least one
+    // core available for short RPCs.
+    uint32_t maxLongRpcs;
+
     // Nonzero means save incoming RPCs rather than executing them.
     // Intended for use in unit tests only.
     int testingSaveRpcs;
@@ -105,6 +172,8 @@ class WorkerManager : Dispatch::Poller {
     // queued here, not sent to workers.
     std::queue<Transport::ServerRpc*> testRpcs;
 
+    static bool isLongRpc(WireFormat::Opcode opcode, uint32_t requestLength);
+    void startRpc(Worker* worker, int level, const WaitingRpc& waiting);
     static void workerMain(Worker* worker);
     static Syscall *sys;
 
@@ -144,6 +213,9 @@ class Worker {
                                        /// response sent (but the worker may
                                        /// still be in POSTPROCESSING state).
   PRIVATE:
+    bool longRpc;                      /// True means #rpc is expected to take
+                                       /// a long time (see
+                                       /// WorkerManager::isLongRpc).
     int busyIndex;                     /// Location of this worker in
                                        /// #busyThreads, or -1 if this worker
                                        /// is idle.
@@ -191,6 +263,7 @@ class Worker {
             , opcode(WireFormat::Opcode::ILLEGAL_RPC_TYPE)
             , level(0)
             , rpc(NULL)
+            , longRpc(false)
             , busyIndex(-1)
             , state(POLLING)
             , exited(false),
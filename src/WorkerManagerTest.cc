@@ -34,6 +34,7 @@ class WorkerManagerTest : public ::testing::Test {
     MockService service;
     TestLog::Enable logEnabler;
     Syscall *savedSyscall;
+    int savedMaxLongDeferralMicros;
     MockSyscall sys;
 
     WorkerManagerTest()
@@ -43,6 +44,7 @@ class WorkerManagerTest : public ::testing::Test {
         , service()
         , logEnabler()
         , savedSyscall(NULL)
+        , savedMaxLongDeferralMicros(WorkerManager::maxLongDeferralMicros)
         , sys()
     {
         static uint8_t levels[] = {0, 1, 2, 0, 1, 2};
@@ -62,6 +64,7 @@ class WorkerManagerTest : public ::testing::Test {
         // the worker thread is still using them.
         manager.destroy();
         WorkerManager::sys = savedSyscall;
+        WorkerManager::maxLongDeferralMicros = savedMaxLongDeferralMicros;
         RpcLevel::savedMaxLevel = -1;
         RpcLevel::levelsPtr = RpcLevel::levels;
     }
@@ -188,6 +191,55 @@ TEST_F(WorkerManagerTest, handleRpc_deferRpc) {
     EXPECT_EQ(0, manager->levels[1].requestsRunning);
 }
 
+TEST_F(WorkerManagerTest, handleRpc_deferLongRpc) {
+    // maxCores is 2, so only 1 long RPC may run at once.
+    service.gate = -1;
+    MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 1");
+    rpc1->requestPayload.appendCopy(string(
+            WorkerManager::LONG_REQUEST_BYTES, 'x').data(),
+            WorkerManager::LONG_REQUEST_BYTES);
+    MockTransport::MockServerRpc* rpc2 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 2");
+    rpc2->requestPayload.appendCopy(string(
+            WorkerManager::LONG_REQUEST_BYTES, 'x').data(),
+            WorkerManager::LONG_REQUEST_BYTES);
+    MockTransport::MockServerRpc* rpc3 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 3");
+    manager->handleRpc(rpc1);
+    EXPECT_EQ(1U, manager->longRpcsRunning);
+
+    // A core is free, but it is kept for short RPCs.
+    manager->handleRpc(rpc2);
+    EXPECT_EQ(1U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->levels[0].waitingRpcs.longRpcs.size());
+    manager->handleRpc(rpc3);
+    EXPECT_EQ(2U, manager->busyThreads.size());
+    EXPECT_EQ(1U, manager->longRpcsRunning);
+
+    // Once the first long RPC finishes, the second one starts.
+    service.gate = 1;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(0U, manager->levels[0].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->longRpcsRunning);
+    EXPECT_EQ(0, manager->rpcsWaiting);
+    service.gate = 0;
+    waitUntilDone(2);
+    manager->poll();
+    EXPECT_EQ(0U, manager->longRpcsRunning);
+}
+
+TEST_F(WorkerManagerTest, handleRpc_recordQueueingDelay) {
+    uint64_t count = PerfStats::threadStats.rpcQueueCount[0];
+    MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
+            &transport, "0x10000 1");
+    manager->handleRpc(rpc);
+    EXPECT_EQ(count + 1, PerfStats::threadStats.rpcQueueCount[0]);
+    waitUntilDone(1);
+    manager->poll();
+}
+
 TEST_F(WorkerManagerTest, handleRpc_handoffToWorker) {
     MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
             &transport, "0x10000 1");
@@ -200,6 +252,17 @@ TEST_F(WorkerManagerTest, handleRpc_handoffToWorker) {
     EXPECT_EQ(5U, manager->idleThreads.size());
 }
 
+TEST_F(WorkerManagerTest, isLongRpc) {
+    EXPECT_FALSE(WorkerManager::isLongRpc(WireFormat::READ, 100));
+    EXPECT_TRUE(WorkerManager::isLongRpc(WireFormat::READ,
+            WorkerManager::LONG_REQUEST_BYTES));
+    EXPECT_TRUE(WorkerManager::isLongRpc(WireFormat::MULTI_OP, 100));
+    EXPECT_TRUE(WorkerManager::isLongRpc(WireFormat::LOOKUP_INDEX_KEYS,
+            100));
+    EXPECT_TRUE(WorkerManager::isLongRpc(WireFormat::LOOKUP_INDEX_OBJECTS,
+            100));
+}
+
 TEST_F(WorkerManagerTest, idle) {
     EXPECT_TRUE(manager->idle());
     // Start one RPC.
@@ -372,6 +435,49 @@ TEST_F(WorkerManagerTest, poll_coreLimit) {
     EXPECT_EQ(0, manager->poll());
 }
 
+TEST_F(WorkerManagerTest, poll_preferShortRpcs) {
+    // Don't let the long RPC's wait limit expire on a slow machine (the
+    // fixture restores it).
+    WorkerManager::maxLongDeferralMicros = 1000000000;
+    service.gate = -1;
+    MockTransport::MockServerRpc* rpc1 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 1");
+    MockTransport::MockServerRpc* rpc2 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 2");
+    MockTransport::MockServerRpc* rpc3 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 3");
+    rpc3->requestPayload.appendCopy(string(
+            WorkerManager::LONG_REQUEST_BYTES, 'x').data(),
+            WorkerManager::LONG_REQUEST_BYTES);
+    MockTransport::MockServerRpc* rpc4 = new MockTransport::MockServerRpc(
+            &transport, "0x10000 4");
+    manager->handleRpc(rpc1);
+    manager->handleRpc(rpc2);
+    manager->handleRpc(rpc3);
+    manager->handleRpc(rpc4);
+    EXPECT_EQ(2, manager->rpcsWaiting);
+
+    // The short RPC (rpc4) starts ahead of the long one that arrived
+    // before it.
+    service.gate = 1;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(0U, manager->levels[0].waitingRpcs.shortRpcs.size());
+    EXPECT_EQ(1U, manager->levels[0].waitingRpcs.longRpcs.size());
+    EXPECT_EQ(0U, manager->longRpcsRunning);
+
+    service.gate = 2;
+    waitUntilDone(1);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(0U, manager->levels[0].waitingRpcs.size());
+    EXPECT_EQ(1U, manager->longRpcsRunning);
+
+    service.gate = 0;
+    waitUntilDone(2);
+    EXPECT_EQ(1, manager->poll());
+    EXPECT_EQ(0, manager->poll());
+}
+
 TEST_F(WorkerManagerTest, poll_postprocessing) {
     // This test makes sure that the POSTPROCESSING state is handled
     // correctly (along with the subsequent POLLING state).
@@ -467,6 +573,42 @@ TEST_F(WorkerManagerTest, workerMain_exit) {
             "workerMain: exiting", TestLog::get());
 }
 
+TEST_F(WorkerManagerTest, WaitingQueue_pop) {
+    Cycles::mockCyclesPerSec = 1e09;
+    Cycles::mockTscValue = 1000000;
+    WorkerManager::WaitingQueue queue;
+    WorkerManager::WaitingRpc waiting;
+    EXPECT_FALSE(queue.pop(true, &waiting));
+    MockTransport::MockServerRpc rpc1(&transport, "1");
+    MockTransport::MockServerRpc rpc2(&transport, "2");
+    MockTransport::MockServerRpc rpc3(&transport, "3");
+    queue.push({&rpc1, WireFormat::MULTI_OP, true, 999000});
+    queue.push({&rpc2, WireFormat::MULTI_OP, true, 999500});
+    queue.push({&rpc3, WireFormat::READ, false, 999600});
+    EXPECT_EQ(3U, queue.size());
+
+    // Short RPCs go first.
+    EXPECT_TRUE(queue.pop(true, &waiting));
+    EXPECT_EQ(&rpc3, waiting.rpc);
+
+    // Long RPCs are returned only when allowed.
+    EXPECT_FALSE(queue.pop(false, &waiting));
+    EXPECT_TRUE(queue.pop(true, &waiting));
+    EXPECT_EQ(&rpc1, waiting.rpc);
+
+    // A long RPC that has waited too long goes ahead of short ones.
+    queue.push({&rpc3, WireFormat::READ, false, 999600});
+    Cycles::mockTscValue = 999500 + WorkerManager::maxLongDeferralMicros*1000
+            + 1;
+    EXPECT_TRUE(queue.pop(true, &waiting));
+    EXPECT_EQ(&rpc2, waiting.rpc);
+    EXPECT_TRUE(queue.pop(true, &waiting));
+    EXPECT_EQ(&rpc3, waiting.rpc);
+    EXPECT_TRUE(queue.empty());
+    Cycles::mockTscValue = 0;
+    Cycles::mockCyclesPerSec = 0;
+}
+
 TEST_F(WorkerManagerTest, Worker_exit) {
     TestLog::Enable _;
     MockTransport::MockServerRpc* rpc = new MockTransport::MockServerRpc(
@@ -29,6 +29,8 @@
 #define _BTREE_H_
 
 #include <assert.h>
+#include <emmintrin.h>
+#include <atomic>
 
 #include "Buffer.h"
 #include "Object.h"
@@ -277,6 +279,34 @@ PRIVATE:
     /// considered read-only since any modifications will trash the logBuffer.
     std::map<NodeId, uint32_t> cache;
 
+    /// Incremented when a modification of the tree starts and again when it
+    /// finishes, so it is odd while one is in progress. Readers that don't
+    /// hold the lock serializing modifications use this to detect that they
+    /// may have seen a mix of old and new nodes; see readBegin().
+    std::atomic<uint64_t> version;
+
+    /**
+     * Marks a modification of the tree in #version for as long as it
+     * exists. Modifications must still be serialized by the caller.
+     */
+    class ModificationGuard {
+      public:
+        explicit ModificationGuard(IndexBtree* tree)
+            : tree(tree)
+        {
+            tree->version.fetch_add(1, std::memory_order_acq_rel);
+        }
+
+        ~ModificationGuard()
+        {
+            tree->version.fetch_add(1, std::memory_order_release);
+        }
+
+      PRIVATE:
+        IndexBtree* tree;
+        DISALLOW_COPY_AND_ASSIGN(ModificationGuard);
+    };
+
     DISALLOW_COPY_AND_ASSIGN(IndexBtree);
 
 PRIVATE:
@@ -333,9 +363,10 @@ PRIVATE:
      *
      * To support additional structures in subclasses, the base Node class
      * makes the serializeAppendToBuffer() and reinitFromRead() both virtual
-     * to support subclasses that need read/write additional data in a buffer
-     * for an objectManager read/write. Additionally serializedLength() is
-     * also virtual.
+     * to support subclasses that need read/write additional data when the
+     * node is copied between buffers. Additionally serializedLength() is
+     * also virtual. Nodes are not stored in the log in this form; see
+     * IndexBtree::packNode() for that.
      */
     struct Node {
         // Stores the metadata associated with every Secondary Key to
@@ -385,6 +416,22 @@ PRIVATE:
         /// Secondary key to primary key hash mappings stored within the node
         KeyInfo keys[IndexBtree::innerslotmax];
 
+        /// Number of leading bytes that all keys in the node had in common
+        /// when it was read from the log; see #heads.
+        uint16_t prefixLength;
+
+        /// True if #heads describes the keys currently in the node. Any
+        /// modification of the node clears this, so only nodes fresh from
+        /// readNode() can be searched through #heads.
+        bool headsValid;
+
+        /// For each slot, the (up to) 4 bytes of its key that follow the
+        /// first #prefixLength bytes, zero-padded and packed big-endian into
+        /// an integer with the sign bit flipped, so that comparing heads as
+        /// signed integers orders keys the way IndexKey::keyCompare() does
+        /// whenever the heads differ. See findEntryRange().
+        int32_t heads[IndexBtree::innerslotmax];
+
         DISALLOW_COPY_AND_ASSIGN(Node);
 
         /**
@@ -406,6 +453,9 @@ PRIVATE:
           , level(level)
           , slotuse(0)
           , keyStorageUsed(0)
+          , prefixLength(0)
+          , headsValid(false)
+          , heads()
         {}
 
         virtual ~Node() {}
@@ -467,6 +517,7 @@ PRIVATE:
         setAt(uint16_t index, BtreeEntry entry)
         {
             assert(index <= Node::slotuse);
+            headsValid = false;
 
             if (index < Node::slotuse) {
                 int32_t keyLengthDiff = entry.keyLength - keys[index].keyLength;
@@ -537,6 +588,7 @@ PRIVATE:
         pop_back(uint16_t n = 1)
         {
             assert(Node::slotuse >= n);
+            headsValid = false;
 
             // Do a virtual copy instead of just decrementing buffer size so
             // any other node's references to the old data will still be valid
@@ -755,6 +807,7 @@ PRIVATE:
         insertAtEntryOnly(uint16_t index, BtreeEntry entry)
         {
             assert(index <= Node::slotuse);
+            headsValid = false;
 
             // If the slot existed, shift everything to the right by 1 entry
             if (index < Node::slotuse) {
@@ -800,6 +853,7 @@ PRIVATE:
         eraseAtEntryOnly(uint16_t index)
         {
             assert(index <= Node::slotuse);
+            headsValid = false;
 
             uint32_t keyLength = keys[index].keyLength;
             uint32_t firstHalfSize = keys[index].relOffset;
@@ -840,6 +894,8 @@ PRIVATE:
         {
             assert(numEntries + dest->slotuse <= IndexBtree::innerslotmax);
             assert (numEntries <= slotuse);
+            headsValid = false;
+            dest->headsValid = false;
 
             uint16_t splitPoint = uint16_t(slotuse - numEntries);
             uint32_t bytesToMove = keyStorageUsed - keys[splitPoint].relOffset;
@@ -891,6 +947,8 @@ PRIVATE:
         {
             assert(numEntries + dest->slotuse <= IndexBtree::innerslotmax);
             assert(numEntries <= slotuse);
+            headsValid = false;
+            dest->headsValid = false;
 
             uint32_t bytesToMove = keys[numEntries - 1].endRelOffset();
             // Re-append to make sure keys are logically contiguous
@@ -1138,6 +1196,7 @@ PRIVATE:
             // n + 1 keys and n + 1 pointers, erasing the last pointer is
             // equivalent to promoting the nth pointer to the last pointer.
             if ( index == slotuse) {
+                headsValid = false;
                 slotuse--;
                 keyStorageUsed -= keys[slotuse].keyLength;
                 rightMostLeafKey.keyLength = keys[slotuse].keyLength;
@@ -1544,7 +1603,7 @@ PUBLIC:
      */
     explicit inline IndexBtree(uint64_t tableId, ObjectManager *objMgr)
         : m_stats(), treeTableId(tableId), objMgr(objMgr), nextNodeId(ROOT_ID),
-          m_rootId(ROOT_ID), logBuffer(), numEntries(0), cache()
+          m_rootId(ROOT_ID), logBuffer(), numEntries(0), cache(), version(0)
     { }
 
     /**
@@ -1567,7 +1626,7 @@ PUBLIC:
                           uint64_t nextNodeId)
     : m_stats(), treeTableId(tableId), objMgr(objMgr),
         nextNodeId(nextNodeId), m_rootId(ROOT_ID),  logBuffer(),
-        numEntries(0), cache()
+        numEntries(0), cache(), version(0)
     { }
 
     inline ~IndexBtree() { }
@@ -1586,9 +1645,38 @@ PUBLIC:
     /// result in live nodes being overwritten.
     void
     setNextNodeId(NodeId newNodeId) {
+        ModificationGuard guard(this);
         nextNodeId = newNodeId;
     }
 
+    /**
+     * Begin an optimistic read of the tree: one made without holding the
+     * lock that serializes modifications. Waits until no modification is
+     * in progress and returns a version which must be passed to
+     * readValidate() (or scanOptimistic()) once the read is complete;
+     * anything read in between is only meaningful if that succeeds.
+     */
+    uint64_t
+    readBegin() const {
+        uint64_t readVersion = version.load(std::memory_order_acquire);
+        while (readVersion & 1) {
+            _mm_pause();
+            readVersion = version.load(std::memory_order_acquire);
+        }
+        return readVersion;
+    }
+
+    /**
+     * Returns true if the tree hasn't been modified since readBegin()
+     * returned readVersion, in which case everything read from the tree
+     * in between was consistent.
+     */
+    bool
+    readValidate(uint64_t readVersion) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return version.load(std::memory_order_relaxed) == readVersion;
+    }
+
     /**
      * Given the value for the RAMCloud object encapsulating an indexlet
      * tree node, check if the node contains (or points to nodes containing)
@@ -1638,6 +1726,7 @@ PUBLIC:
      */
     void
     clear_fast() {
+        ModificationGuard guard(this);
         if (nextNodeId > ROOT_ID) {
             nextNodeId = ROOT_ID;
             m_stats = tree_stats();
@@ -1650,6 +1739,7 @@ PUBLIC:
      */
     void
     clear() {
+        ModificationGuard guard(this);
         if (nextNodeId > ROOT_ID) {
             clear_recursive(ROOT_ID);
             m_stats = tree_stats();
@@ -1908,6 +1998,72 @@ PUBLIC:
             return iterator(this, childId, slot);
     }
 
+    /**
+     * Visits entries in ascending order starting with the first one equal
+     * to or greater than key, without holding the lock that serializes
+     * modifications. Nodes may be replaced or freed by a concurrent
+     * modification while they are being read, so the traversal gives up as
+     * soon as it finds a missing node or a child that isn't below its
+     * parent, and it checks readVersion before following each leaf link.
+     *
+     * \param key
+     *      BtreeEntry to start the scan at.
+     * \param readVersion
+     *      Value returned by readBegin() before the scan.
+     * \param visit
+     *      Called with each entry in turn until it returns false. The
+     *      entry's key is only valid for the duration of the call. The
+     *      entries visited are only meaningful if the scan returns true.
+     *
+     * \return
+     *      True if the tree wasn't modified during the scan; false if the
+     *      caller should discard whatever it was given and try again.
+     */
+    template<typename Visitor>
+    bool
+    scanOptimistic(const BtreeEntry& key, uint64_t readVersion,
+                   Visitor visit) const
+    {
+        if (nextNodeId <= ROOT_ID)
+            return readValidate(readVersion);
+
+        Buffer buffer;
+        const Node *n = readNode(m_rootId, &buffer);
+        while (n != NULL && !n->isLeaf()) {
+            const InnerNode *inner = static_cast<const InnerNode*>(n);
+            uint16_t level = inner->level;
+            NodeId childId = inner->getChildAt(findEntryGE(inner, key));
+            buffer.reset();
+            n = readNode(childId, &buffer);
+            if (n != NULL && n->level >= level)
+                return false;
+        }
+        if (n == NULL)
+            return false;
+
+        const LeafNode *leaf = static_cast<const LeafNode*>(n);
+        uint16_t slot = findEntryGE(leaf, key);
+        while (true) {
+            for (; slot < leaf->slotuse; ++slot) {
+                if (!visit(leaf->getAt(slot)))
+                    return readValidate(readVersion);
+            }
+
+            NodeId nextId = leaf->nextleaf;
+            if (nextId == INVALID_NODEID)
+                return readValidate(readVersion);
+            if (!readValidate(readVersion))
+                return false;
+
+            buffer.reset();
+            n = readNode(nextId, &buffer);
+            if (n == NULL || !n->isLeaf())
+                return false;
+            leaf = static_cast<const LeafNode*>(n);
+            slot = 0;
+        }
+    }
+
     // *** Modify Functions Changing the Tree by Descending to a Leaf
     /**
      * Starts an insert operation from the root.
@@ -1917,6 +2073,7 @@ PUBLIC:
      */
     void
     insert(const BtreeEntry entry) {
+        ModificationGuard guard(this);
         if (nextNodeId == ROOT_ID) {
             Buffer rootBuffer;
             LeafNode *root = rootBuffer.emplaceAppend<LeafNode>(&rootBuffer);
@@ -1958,6 +2115,7 @@ PUBLIC:
      */
     bool
     erase(BtreeEntry entry) {
+        ModificationGuard guard(this);
         if (selfverify) verify();
 
         // The tree is empty; do nothing.
@@ -1975,6 +2133,95 @@ PUBLIC:
 PRIVATE:
     // *** Search functions to be used internally on nodes
 
+    /**
+     * Returns the head of a key as stored in Node::heads: the (up to) 4
+     * bytes that follow its first prefixLength bytes.
+     *
+     * \param key
+     *      Key to compute the head of.
+     * \param keyLength
+     *      Length of key in bytes.
+     * \param prefixLength
+     *      Number of leading bytes to skip; must not exceed keyLength.
+     */
+    static inline int32_t
+    keyHead(const void *key, uint16_t keyLength, uint16_t prefixLength)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t*>(key);
+        uint32_t head = 0;
+        for (uint32_t i = prefixLength; i < prefixLength + 4u; i++) {
+            head <<= 8;
+            if (i < keyLength)
+                head |= bytes[i];
+        }
+        return static_cast<int32_t>(head ^ 0x80000000u);
+    }
+
+    /**
+     * Narrows down where an entry falls within a node by comparing its head
+     * against the node's key heads 4 at a time, without touching the keys
+     * themselves. On return, every slot before *lo holds an entry less than
+     * the one given and every slot from *hi on holds a greater one; only
+     * the slots in between (those with the same prefix and head) need their
+     * full keys compared. If the node has no usable heads, the range is the
+     * whole node.
+     *
+     * \param n
+     *      Node to search within
+     * \param entry
+     *      BtreeEntry to compare against
+     * \param[out] lo
+     *      First slot that may hold an entry not less than entry.
+     * \param[out] hi
+     *      First slot known to hold an entry greater than entry.
+     */
+    inline void
+    findEntryRange(const Node *n, const BtreeEntry &entry,
+                   uint16_t *lo, uint16_t *hi) const
+    {
+        static_assert(innerslotmax % 4 == 0,
+                      "Node::heads must be searchable 4 at a time");
+        *lo = 0;
+        *hi = n->slotuse;
+
+        // IndexKey::keyCompare() orders empty keys both before and after
+        // everything else, which no head can represent.
+        if (!n->headsValid || n->slotuse == 0 || entry.keyLength == 0)
+            return;
+
+        uint16_t prefixLength = n->prefixLength;
+        if (prefixLength > 0) {
+            const void *prefix = n->getAt(0).key;
+            int cmp = memcmp(entry.key, prefix,
+                             std::min(entry.keyLength, prefixLength));
+            if (cmp < 0 || (cmp == 0 && entry.keyLength < prefixLength)) {
+                *hi = 0;
+                return;
+            } else if (cmp > 0) {
+                *lo = n->slotuse;
+                return;
+            }
+        }
+
+        __m128i head = _mm_set1_epi32(keyHead(entry.key, entry.keyLength,
+                                              prefixLength));
+        uint32_t less = 0, greater = 0;
+        for (uint16_t slot = 0; slot < n->slotuse; slot += 4) {
+            __m128i heads = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(&n->heads[slot]));
+            int valid = (n->slotuse - slot >= 4)
+                    ? 0xf : (1 << (n->slotuse - slot)) - 1;
+            less += __builtin_popcount(valid & _mm_movemask_ps(
+                    _mm_castsi128_ps(_mm_cmplt_epi32(heads, head))));
+            greater += __builtin_popcount(valid & _mm_movemask_ps(
+                    _mm_castsi128_ps(_mm_cmpgt_epi32(heads, head))));
+        }
+
+        // Keys are sorted, so their heads are too.
+        *lo = uint16_t(less);
+        *hi = uint16_t(n->slotuse - greater);
+    }
+
     /// Returns true if a < b first according to IndexKey and then by pKHash
     inline bool
     key_less(const BtreeEntry a, const BtreeEntry b) const
@@ -2053,7 +2300,8 @@ PRIVATE:
             if (n->slotuse == 0)
                 return 0;
 
-            uint16_t lo = 0, hi = n->slotuse;
+            uint16_t lo, hi;
+            findEntryRange(n, entry, &lo, &hi);
             while (lo < hi) {
                 uint16_t mid = uint16_t((lo + hi) >> 1);
                 if (key_lessequal(entry, n->getAt(mid))) {
@@ -2100,7 +2348,8 @@ PRIVATE:
             if (n->slotuse == 0)
                 return 0;
 
-            uint16_t lo = 0, hi = n->slotuse;
+            uint16_t lo, hi;
+            findEntryRange(n, entry, &lo, &hi);
             while (lo < hi) {
                 uint16_t mid = uint16_t((lo + hi) >> 1);
                 if (key_less(entry, n->getAt(mid))) {
@@ -2181,31 +2430,13 @@ PRIVATE:
             return NULL;
         }
 
-        // The trickiness here is that an inner node has more metadata
-        // than the other nodes types. Hence, we first read it back as a Node
-        // object, which is contains enough metadata to determine its real type.
-        // Then read it out in full.
-        Node *ptr;
-        uint32_t peekSize = outBuffer->peek(sizeBeforeRead, ((void**)&ptr));
-        if (peekSize < sizeof(Node)) {
-            ptr = static_cast<Node*>(outBuffer->getRange(sizeBeforeRead,
-                    sizeof(Node)));
-        }
-
-        uint32_t nodeSize =
-                (ptr->isLeaf() ? sizeof32(LeafNode) : sizeof32(InnerNode));
+        uint32_t packedLength = outBuffer->size() - sizeBeforeRead;
+        RAMCLOUD_LOG(DEBUG, "Read object from log, nodeId = %lu, size = %u",
+                     nodeId, packedLength);
 
-        if (peekSize < nodeSize) {
-            ptr = static_cast<Node*>(outBuffer->alloc(nodeSize));
-            memmove(ptr, outBuffer->getRange(sizeBeforeRead, nodeSize), nodeSize);
-        }
-
-        RAMCLOUD_LOG(DEBUG, "Read object from log, nodeId = %lu, size = %d",
-                     nodeId, ptr->serializedLength());
-
-        ptr->reinitFromRead(outBuffer, sizeBeforeRead);
+        Node *ptr = unpackNode(outBuffer, sizeBeforeRead, outBuffer);
         PerfStats::threadStats.btreeNodeReads++;
-        PerfStats::threadStats.btreeBytesRead += (ptr->serializedLength());
+        PerfStats::threadStats.btreeBytesRead += packedLength;
         return ptr;
     }
 
@@ -2223,28 +2454,263 @@ PRIVATE:
      */
     static Node*
     readNodeFromObjectValue(Buffer* nodeObjectValue) {
-        // The trickiness here is that an inner node has more metadata
-        // than the other nodes types. Hence, we first read it back as a Node
-        // object, which is contains enough metadata to determine its real type.
-        // Then read it out in full.
-        Node *ptr;
-        uint32_t peekSize = nodeObjectValue->peek(0, ((void**)&ptr));
-        if (peekSize < sizeof(Node)) {
-            ptr = static_cast<Node*>(
-                    nodeObjectValue->getRange(0, sizeof(Node)));
+        return unpackNode(nodeObjectValue, 0, nodeObjectValue);
+    }
+
+    /**
+     * Layout of the start of a node as it is stored in the log; see
+     * packNode(). The header is followed by:
+     *   - the prefix shared by all of the node's keys, stored once;
+     *   - a PackedKeyInfo for each slot;
+     *   - for leaves, prevleaf and nextleaf; for inner nodes, the
+     *     slotuse + 1 children and, unless it is infinite, a PackedKeyInfo
+     *     for the rightmost leaf key (whose length includes the prefix);
+     *   - the rest of each key after the shared prefix, in slot order;
+     *   - for inner nodes, the whole rightmost leaf key if it isn't
+     *     infinite.
+     * Unlike the in-memory Node this holds nothing for unused slots and
+     * nothing that is only meaningful in this process.
+     */
+    struct PackedNodeHeader {
+        /// Total length of the packed node in bytes, including this header.
+        uint32_t length;
+
+        /// Level of the node; see Node::level.
+        uint16_t level;
+
+        /// Number of entries in the node; see Node::slotuse.
+        uint16_t slotuse;
+
+        /// Length of the prefix shared by all of the node's keys.
+        uint16_t prefixLength;
+
+        /// See InnerNode::rightMostLeafKeyIsInfinite; false for leaves.
+        bool rightMostLeafKeyIsInfinite;
+    } __attribute__((packed));
+
+    /// Describes one key of a packed node; see PackedNodeHeader.
+    struct PackedKeyInfo {
+        /// Length of the key, not counting the node's shared prefix.
+        uint16_t suffixLength;
+
+        /// Primary key hash associated with the key.
+        uint64_t pkHash;
+    } __attribute__((packed));
+
+    /**
+     * Appends the form of a node that is stored in the log (see
+     * PackedNodeHeader) to a buffer, in contiguous memory. Storing the
+     * keys' common prefix once and leaving out unused slots makes this
+     * considerably smaller than the in-memory Node, which reduces the
+     * bytes logged and replicated for every node written.
+     *
+     * \param node
+     *      Node to pack.
+     * \param[out] packedOut
+     *      Buffer to append the packed node to.
+     *
+     * \return
+     *      Length of the packed node in bytes.
+     */
+    static uint32_t
+    packNode(const Node *node, Buffer *packedOut)
+    {
+        uint16_t slotuse = node->slotuse;
+        const uint8_t *prefix = NULL;
+        uint16_t prefixLength = 0;
+        // keyStorageUsed can also count keys that aren't in a slot (such
+        // as an inner node's rightmost leaf key), so add up the slots.
+        uint32_t keyBytes = 0;
+        for (uint16_t slot = 0; slot < slotuse; ++slot)
+            keyBytes += node->keys[slot].keyLength;
+        if (slotuse > 0) {
+            BtreeEntry first = node->getAt(0);
+            prefix = static_cast<const uint8_t*>(first.key);
+            prefixLength = first.keyLength;
+            for (uint16_t slot = 1; slot < slotuse && prefixLength > 0;
+                    ++slot) {
+                BtreeEntry entry = node->getAt(slot);
+                const uint8_t *key = static_cast<const uint8_t*>(entry.key);
+                uint16_t common = 0;
+                uint16_t limit = std::min(prefixLength, entry.keyLength);
+                while (common < limit && key[common] == prefix[common])
+                    ++common;
+                prefixLength = common;
+            }
         }
 
-        uint32_t nodeSize =
-                (ptr->isLeaf() ? sizeof32(LeafNode) : sizeof32(InnerNode));
+        const InnerNode *inner = node->isLeaf()
+                ? NULL : static_cast<const InnerNode*>(node);
+        bool hasRightMostLeafKey =
+                inner != NULL && !inner->rightMostLeafKeyIsInfinite;
+        uint32_t linksLength = (inner == NULL)
+                ? 2 * sizeof32(NodeId)
+                : (slotuse + 1) * sizeof32(NodeId) +
+                  (hasRightMostLeafKey ? sizeof32(PackedKeyInfo) : 0);
+        uint32_t length = sizeof32(PackedNodeHeader) + prefixLength
+                + slotuse * sizeof32(PackedKeyInfo) + linksLength
+                + keyBytes - slotuse * prefixLength
+                + (hasRightMostLeafKey ? inner->rightMostLeafKey.keyLength : 0);
+
+        uint8_t *packed = static_cast<uint8_t*>(packedOut->alloc(length));
+        PackedNodeHeader header;
+        header.length = length;
+        header.level = node->level;
+        header.slotuse = slotuse;
+        header.prefixLength = prefixLength;
+        header.rightMostLeafKeyIsInfinite =
+                inner != NULL && inner->rightMostLeafKeyIsInfinite;
+        memcpy(packed, &header, sizeof(header));
+        uint8_t *next = packed + sizeof(header);
+
+        if (prefixLength > 0)
+            memcpy(next, prefix, prefixLength);
+        next += prefixLength;
+
+        for (uint16_t slot = 0; slot < slotuse; ++slot) {
+            PackedKeyInfo info;
+            info.suffixLength = uint16_t(node->keys[slot].keyLength
+                                         - prefixLength);
+            info.pkHash = node->keys[slot].pkHash;
+            memcpy(next, &info, sizeof(info));
+            next += sizeof(info);
+        }
 
-        if (peekSize < nodeSize) {
-            ptr = static_cast<Node*>(nodeObjectValue->alloc(nodeSize));
-            memmove(ptr, nodeObjectValue->getRange(0, nodeSize),
-                    nodeSize);
+        if (inner == NULL) {
+            const LeafNode *leaf = static_cast<const LeafNode*>(node);
+            memcpy(next, &leaf->prevleaf, sizeof(NodeId));
+            memcpy(next + sizeof(NodeId), &leaf->nextleaf, sizeof(NodeId));
+            next += 2 * sizeof(NodeId);
+        } else {
+            memcpy(next, inner->child, (slotuse + 1) * sizeof(NodeId));
+            next += (slotuse + 1) * sizeof(NodeId);
+            if (hasRightMostLeafKey) {
+                PackedKeyInfo info;
+                info.suffixLength = inner->rightMostLeafKey.keyLength;
+                info.pkHash = inner->rightMostLeafKey.pkHash;
+                memcpy(next, &info, sizeof(info));
+                next += sizeof(info);
+            }
         }
 
-        ptr->reinitFromRead(nodeObjectValue, 0);
-        return ptr;
+        for (uint16_t slot = 0; slot < slotuse; ++slot) {
+            BtreeEntry entry = node->getAt(slot);
+            uint16_t suffixLength = uint16_t(entry.keyLength - prefixLength);
+            memcpy(next, static_cast<const uint8_t*>(entry.key) + prefixLength,
+                   suffixLength);
+            next += suffixLength;
+        }
+
+        if (hasRightMostLeafKey) {
+            BtreeEntry rightMost = inner->getRightMostLeafKey();
+            memcpy(next, rightMost.key, rightMost.keyLength);
+            next += rightMost.keyLength;
+        }
+
+        assert(next == packed + length);
+        return length;
+    }
+
+    /**
+     * Rebuilds a node from the form written by packNode(), with the keys'
+     * heads filled in so that it can be searched without comparing whole
+     * keys (see findEntryRange()). The packed node is never modified.
+     *
+     * \param packed
+     *      Buffer holding the packed node.
+     * \param offset
+     *      Where the packed node starts in the buffer.
+     * \param[out] outBuffer
+     *      Buffer to build the node in; this may be the same as packed.
+     *
+     * \return
+     *      A pointer to the node, or NULL if the buffer doesn't hold a
+     *      whole packed node.
+     */
+    static Node*
+    unpackNode(Buffer *packed, uint32_t offset, Buffer *outBuffer)
+    {
+        const PackedNodeHeader *header =
+                packed->getOffset<PackedNodeHeader>(offset);
+        if (header == NULL)
+            return NULL;
+        const uint8_t *src = static_cast<const uint8_t*>(
+                packed->getRange(offset, header->length));
+        if (src == NULL || header->slotuse > innerslotmax)
+            return NULL;
+
+        PackedNodeHeader h;
+        memcpy(&h, src, sizeof(h));
+        const uint8_t *prefix = src + sizeof(h);
+        const uint8_t *infos = prefix + h.prefixLength;
+        const uint8_t *links = infos + h.slotuse * sizeof(PackedKeyInfo);
+
+        Node *node;
+        const uint8_t *suffix;
+        if (h.level == 0) {
+            LeafNode *leaf = outBuffer->emplaceAppend<LeafNode>(outBuffer);
+            memcpy(&leaf->prevleaf, links, sizeof(NodeId));
+            memcpy(&leaf->nextleaf, links + sizeof(NodeId), sizeof(NodeId));
+            suffix = links + 2 * sizeof(NodeId);
+            node = leaf;
+        } else {
+            InnerNode *inner =
+                    outBuffer->emplaceAppend<InnerNode>(outBuffer,
+                                                     uint16_t(h.level));
+            memcpy(inner->child, links, (h.slotuse + 1) * sizeof(NodeId));
+            suffix = links + (h.slotuse + 1) * sizeof(NodeId);
+            if (!h.rightMostLeafKeyIsInfinite)
+                suffix += sizeof(PackedKeyInfo);
+            node = inner;
+        }
+
+        PackedKeyInfo info[innerslotmax];
+        uint32_t keyStorage = 0;
+        for (uint16_t slot = 0; slot < h.slotuse; ++slot) {
+            memcpy(&info[slot], infos + slot * sizeof(PackedKeyInfo),
+                   sizeof(PackedKeyInfo));
+            keyStorage += h.prefixLength + info[slot].suffixLength;
+        }
+
+        node->keysBeginOffset = outBuffer->size();
+        uint8_t *keys = (keyStorage == 0) ? NULL
+                : static_cast<uint8_t*>(outBuffer->alloc(keyStorage));
+        uint32_t relOffset = 0;
+        bool headsValid = true;
+        for (uint16_t slot = 0; slot < h.slotuse; ++slot) {
+            uint16_t keyLength =
+                    uint16_t(h.prefixLength + info[slot].suffixLength);
+            if (h.prefixLength > 0)
+                memcpy(keys + relOffset, prefix, h.prefixLength);
+            if (info[slot].suffixLength > 0) {
+                memcpy(keys + relOffset + h.prefixLength, suffix,
+                       info[slot].suffixLength);
+            }
+            suffix += info[slot].suffixLength;
+
+            node->keys[slot].relOffset = relOffset;
+            node->keys[slot].keyLength = keyLength;
+            node->keys[slot].pkHash = info[slot].pkHash;
+            node->heads[slot] = keyHead(keys + relOffset, keyLength,
+                                        h.prefixLength);
+            headsValid = headsValid && (keyLength > 0);
+            relOffset += keyLength;
+        }
+        node->slotuse = h.slotuse;
+        node->keyStorageUsed = keyStorage;
+        node->prefixLength = h.prefixLength;
+
+        if (h.level != 0 && !h.rightMostLeafKeyIsInfinite) {
+            PackedKeyInfo rightMost;
+            memcpy(&rightMost, links + (h.slotuse + 1) * sizeof(NodeId),
+                   sizeof(rightMost));
+            static_cast<InnerNode*>(node)->setRightMostLeafKey(BtreeEntry(
+                    suffix, rightMost.suffixLength, rightMost.pkHash));
+        }
+
+        // Set last: setRightMostLeafKey() doesn't touch the keys' heads.
+        node->headsValid = headsValid;
+        return node;
     }
 
     /**
@@ -2273,9 +2739,9 @@ PRIVATE:
       RAMCLOUD_LOG(DEBUG, "Writing key(nodeId) is %lu, size of node = %d",
                      nodeId, node->serializedLength());
 
-      Node *serializedNode = node->serializeAppendToBuffer(&buffer);
-      serializedNode->keyBuffer = NULL; // Helps catch errors in case a person reads a node back incorrectly.
-      Object object(key, serializedNode, node->serializedLength(), 1, 0, buffer);
+      uint32_t packedLength = packNode(node, &buffer);
+      Object object(key, buffer.getRange(0, packedLength), packedLength,
+                    1, 0, buffer);
 
       // here size is the size of the object's value. ObjectManager
       // will construct an object around this.
@@ -2292,7 +2758,7 @@ PRIVATE:
           numEntries++;
 
       PerfStats::threadStats.btreeNodeWrites++;
-      PerfStats::threadStats.btreeBytesWritten += node->serializedLength();
+      PerfStats::threadStats.btreeBytesWritten += packedLength;
 
       if (status != STATUS_OK) {
         assert(status == STATUS_OK);
@@ -2845,11 +3311,7 @@ PRIVATE:
             if (it == cache.end()) {
                 newRoot = readNode(childId, &buffer);
             } else {
-                newRoot = static_cast<Node*>(
-                                logBuffer.getRange(it->second, sizeof(Node)));
-
-                // Readjust buffer
-                newRoot->reinitFromRead(&logBuffer, it->second);
+                newRoot = unpackNode(&logBuffer, it->second, &buffer);
             }
 
             writeNode(newRoot, m_rootId);
@@ -1215,6 +1215,146 @@ TEST_F(BtreeTest, InnerNode_serializeAppendToBuffer) {
     EXPECT_EQ(0, bcmp(e2.key, query.key, query.keyLength));
 }
 
+TEST_F(BtreeTest, packNode_unpackNode_leaf) {
+    Buffer buffer_in, packed, buffer_out;
+    IndexBtree::LeafNode *n =
+            buffer_in.emplaceAppend<IndexBtree::LeafNode>(&buffer_in);
+    n->setAt(0, {"user:0001", 1});
+    n->setAt(1, {"user:0001", 2});
+    n->setAt(2, {"user:00020", 3});
+    n->setAt(3, {"user:1", 4});
+    n->prevleaf = 37;
+    n->nextleaf = 41;
+
+    uint32_t length = IndexBtree::packNode(n, &packed);
+    EXPECT_EQ(length, packed.size());
+    EXPECT_EQ(1U, packed.getNumberChunks());
+
+    // The 5-byte prefix is stored once and unused slots not at all.
+    EXPECT_EQ(sizeof(IndexBtree::PackedNodeHeader) + 5
+            + 4 * sizeof(IndexBtree::PackedKeyInfo) + 2 * sizeof(NodeId)
+            + n->keyStorageUsed - 4 * 5, length);
+    EXPECT_LT(length, n->serializedLength());
+
+    IndexBtree::LeafNode *rn = static_cast<IndexBtree::LeafNode*>(
+            IndexBtree::unpackNode(&packed, 0, &buffer_out));
+    ASSERT_TRUE(rn != NULL);
+    checkNodeEquals(n, rn);
+    EXPECT_EQ(37U, rn->prevleaf);
+    EXPECT_EQ(41U, rn->nextleaf);
+    EXPECT_TRUE(rn->headsValid);
+    EXPECT_EQ(5U, rn->prefixLength);
+
+    // Unpacking into the buffer holding the packed node works too.
+    rn = static_cast<IndexBtree::LeafNode*>(
+            IndexBtree::unpackNode(&packed, 0, &packed));
+    checkNodeEquals(n, rn);
+
+    // Empty keys can't be ordered by their heads.
+    n->setAt(0, {"", 0});
+    packed.reset();
+    IndexBtree::packNode(n, &packed);
+    rn = static_cast<IndexBtree::LeafNode*>(
+            IndexBtree::unpackNode(&packed, 0, &buffer_out));
+    checkNodeEquals(n, rn);
+    EXPECT_EQ(0U, rn->prefixLength);
+    EXPECT_FALSE(rn->headsValid);
+    EXPECT_TRUE(IndexBtree::unpackNode(&packed, 1000, &buffer_out) == NULL);
+}
+
+TEST_F(BtreeTest, packNode_unpackNode_inner) {
+    BtreeEntry eTest = {"key:Testing", 123};
+    BtreeEntry e0 = {"key:One", 1};
+    BtreeEntry e1 = {"key:Two", 2};
+    Buffer buffer_in, packed, buffer_out;
+    IndexBtree::InnerNode *n = buffer_in.emplaceAppend<IndexBtree::InnerNode>(
+                                                    &buffer_in, uint16_t(3));
+    n->insertAt(0, e0, 10, 11);
+    n->insertAt(1, e1, 11, 12);
+
+    IndexBtree::packNode(n, &packed);
+    IndexBtree::InnerNode *rn = static_cast<IndexBtree::InnerNode*>(
+            IndexBtree::unpackNode(&packed, 0, &buffer_out));
+    EXPECT_EQ(3U, rn->level);
+    EXPECT_EQ(2U, rn->slotuse);
+    EXPECT_EQ(4U, rn->prefixLength);
+    EXPECT_TRUE(rn->rightMostLeafKeyIsInfinite);
+    EXPECT_EQ(10U, rn->getChildAt(0));
+    EXPECT_EQ(11U, rn->getChildAt(1));
+    EXPECT_EQ(12U, rn->getChildAt(2));
+    EXPECT_EQ("key:Two", string(static_cast<const char*>(rn->getAt(1).key),
+                                rn->getAt(1).keyLength));
+    EXPECT_EQ(n->serializedLength(), rn->serializedLength());
+
+    n->setRightMostLeafKey(eTest);
+    packed.reset();
+    IndexBtree::packNode(n, &packed);
+    rn = static_cast<IndexBtree::InnerNode*>(
+            IndexBtree::unpackNode(&packed, 0, &buffer_out));
+    EXPECT_FALSE(rn->rightMostLeafKeyIsInfinite);
+    BtreeEntry rightMost = rn->getRightMostLeafKey();
+    EXPECT_EQ(123U, rightMost.pKHash);
+    EXPECT_EQ("key:Testing", string(static_cast<const char*>(rightMost.key),
+                                    rightMost.keyLength));
+    EXPECT_EQ(12U, rn->getChildAt(2));
+    EXPECT_EQ(n->serializedLength(), rn->serializedLength());
+    EXPECT_TRUE(rn->headsValid);
+
+    // Modifying an unpacked node stops its heads from being used.
+    rn->insertAt(2, {"key:Z", 3}, 13, 14);
+    EXPECT_FALSE(rn->headsValid);
+}
+
+TEST_F(BtreeTest, findEntryRange) {
+    IndexBtree bt(tableId, &objectManager);
+    Buffer buffer_in, packed, buffer_out;
+    IndexBtree::LeafNode *n =
+            buffer_in.emplaceAppend<IndexBtree::LeafNode>(&buffer_in);
+    n->setAt(0, {"ab", 1});
+    n->setAt(1, {"abc", 1});
+    n->setAt(2, {"abcd", 1});
+    n->setAt(3, {"abcd", 2});
+    n->setAt(4, {"abcdefgh", 1});
+    n->setAt(5, {"abd", 1});
+    IndexBtree::packNode(n, &packed);
+    const IndexBtree::Node *rn =
+            IndexBtree::unpackNode(&packed, 0, &buffer_out);
+    ASSERT_EQ(2U, rn->prefixLength);
+
+    uint16_t lo, hi;
+    bt.findEntryRange(rn, {"aa", 0}, &lo, &hi);
+    EXPECT_EQ(0U, lo);
+    EXPECT_EQ(0U, hi);
+    bt.findEntryRange(rn, {"a", 0}, &lo, &hi);
+    EXPECT_EQ(0U, hi);
+    bt.findEntryRange(rn, {"b", 0}, &lo, &hi);
+    EXPECT_EQ(6U, lo);
+    bt.findEntryRange(rn, {"abcd", 5}, &lo, &hi);
+    EXPECT_EQ(2U, lo);
+    EXPECT_EQ(4U, hi);
+    bt.findEntryRange(rn, {"abcdef", 5}, &lo, &hi);
+    EXPECT_EQ(4U, lo);
+    EXPECT_EQ(5U, hi);
+    bt.findEntryRange(rn, {"abe", 5}, &lo, &hi);
+    EXPECT_EQ(6U, lo);
+    EXPECT_EQ(6U, hi);
+    bt.findEntryRange(rn, {"", 5}, &lo, &hi);
+    EXPECT_EQ(0U, lo);
+    EXPECT_EQ(6U, hi);
+
+    // The narrowed search agrees with a search of the whole node.
+    const char* probes[] = {"a", "ab", "abb", "abc", "abcd", "abcde",
+                            "abcdefgh", "abcdefghi", "abd", "abda", "b"};
+    for (const char* probe : probes) {
+        for (uint64_t hash = 0; hash < 3; hash++) {
+            BtreeEntry entry(probe, hash);
+            EXPECT_EQ(bt.findEntryGE(n, entry), bt.findEntryGE(rn, entry));
+            EXPECT_EQ(bt.findEntryGreater(n, entry),
+                      bt.findEntryGreater(rn, entry));
+        }
+    }
+}
+
 TEST_F(BtreeTest, LeafNode_balanceWithRight) {
     Buffer b1, b2;
     std::vector<BtreeEntry> entries;
@@ -1589,6 +1729,53 @@ TEST_F(BtreeTest, lower_upper_bound) {
     EXPECT_EQ(bt.end(), it);\
 }
 
+TEST_F(BtreeTest, scanOptimistic) {
+    uint16_t slots = IndexBtree::innerslotmax;
+    uint32_t numEntries = static_cast<uint32_t>(slots*slots + 1);
+
+    std::vector<BtreeEntry> entries;
+    std::vector<std::string> entryKeys;
+    generateKeysInRange(0, numEntries, entryKeys, entries, 5);
+
+    IndexBtree bt(tableId, &objectManager);
+    uint64_t emptyVersion = bt.readBegin();
+    uint32_t visited = 0;
+    auto countAll = [&visited](const BtreeEntry& entry) {
+        visited++;
+        return true;
+    };
+    EXPECT_TRUE(bt.scanOptimistic(entries[0], emptyVersion, countAll));
+    EXPECT_EQ(0U, visited);
+
+    for (uint32_t i = 0; i < numEntries; i++)
+        bt.insert(entries[i]);
+    EXPECT_EQ(emptyVersion + 2 * numEntries, bt.readBegin());
+
+    // The scan crosses several leaves and stops when told to.
+    std::vector<uint64_t> hashes;
+    uint32_t wanted = 3 * slots;
+    auto collect = [&hashes, wanted](const BtreeEntry& entry) {
+        if (hashes.size() == wanted)
+            return false;
+        hashes.push_back(entry.pKHash);
+        return true;
+    };
+    EXPECT_TRUE(bt.scanOptimistic(entries[10], bt.readBegin(), collect));
+    ASSERT_EQ(wanted, hashes.size());
+    for (uint32_t i = 0; i < wanted; i++)
+        EXPECT_EQ(entries[10 + i].pKHash, hashes[i]);
+
+    // Scans starting before a modification must be retried.
+    uint64_t version = bt.readBegin();
+    bt.erase(entries[20]);
+    EXPECT_FALSE(bt.readValidate(version));
+    visited = 0;
+    EXPECT_FALSE(bt.scanOptimistic(entries[0], version, countAll));
+    visited = 0;
+    EXPECT_TRUE(bt.scanOptimistic(entries[0], bt.readBegin(), countAll));
+    EXPECT_EQ(numEntries - 1, visited);
+}
+
 TEST_F(BtreeTest, insert) {
   BtreeEntry result;
   uint64_t rootId = ROOT_ID;
@@ -2057,10 +2244,12 @@ TEST_F(BtreeTest, perfStats) {
     EXPECT_EQ(0U, now.btreeBytesWritten - start.btreeBytesWritten);
 
     // Simple write
+    Buffer packed;
+    uint32_t packedLength = IndexBtree::packNode(innerNode, &packed);
     NodeId nodeid = bt.writeNode(innerNode, 200);
     bt.flush();
     EXPECT_EQ(1U, now.btreeNodeWrites - start.btreeNodeWrites);
-    EXPECT_EQ(innerNode->serializedLength(),
+    EXPECT_EQ(packedLength,
                             now.btreeBytesWritten - start.btreeBytesWritten);
 
     // Invalid node read
@@ -2071,8 +2260,7 @@ TEST_F(BtreeTest, perfStats) {
     // valid node read
     bt.readNode(nodeid, &buffer);
     EXPECT_EQ(1U, now.btreeNodeReads - start.btreeNodeReads);
-    EXPECT_EQ(innerNode->serializedLength(),
-                                    now.btreeBytesRead - start.btreeBytesRead);
+    EXPECT_EQ(packedLength, now.btreeBytesRead - start.btreeBytesRead);
 }
 
 TEST_F(BtreeTest, perfStats_endToEnd) {